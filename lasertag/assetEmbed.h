@@ -0,0 +1,42 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef ASSETEMBED_H_
+#define ASSETEMBED_H_
+
+// Links binary files (sounds, bitmaps) into the program as arrays, with the
+// assembler's .incbin, instead of compiling them from C arrays of literals.
+// The bytes are copied as they are, so a file holds the array in the target's
+// byte order (little endian here). wav2c -b writes, for each sound, the file,
+// a header that declares the array and its size as before, so the code that
+// uses it does not change, and a C file of one ASSET_EMBED() line:
+//
+//   // gunEmpty48k.wav.c, compiled with -DASSET_DIR="<its directory>"
+//   ASSET_EMBED(gunEmpty48k_wav, "gunEmpty48k.wav.bin");
+//
+//   // gunEmpty48k.wav.h
+//   extern const uint16_t gunEmpty48k_wav[];
+//   #define GUNEMPTY48K_WAV_NUMBER_OF_SAMPLES 15456
+//
+// One asset per C file keeps each in an object file of its own, so a program
+// only links the assets it uses. The arrays are read only and aligned to 4
+// bytes. The build does not know that the C file depends on the binary file,
+// so list that in its OBJECT_DEPENDS property.
+
+// Defines name[] as the bytes of file, in ASSET_DIR. Use at file scope.
+#define ASSET_EMBED(name, file)                                                \
+  __asm__(".section .rodata\n"                                                 \
+          ".balign 4\n"                                                        \
+          ".global " #name "\n"                                                \
+          ".type " #name ", %object\n" #name ":\n"                             \
+          ".incbin \"" ASSET_DIR "/" file "\"\n"                               \
+          ".size " #name ", . - " #name "\n"                                   \
+          ".previous\n")
+
+#endif /* ASSETEMBED_H_ */
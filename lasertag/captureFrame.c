@@ -0,0 +1,117 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "captureFrame.h"
+
+#define CRC16_POLYNOMIAL 0x1021
+#define CRC16_INITIAL_VALUE 0xFFFF
+#define CRC16_TOP_BIT 0x8000
+#define BITS_PER_BYTE 8
+
+#define SEQUENCE_OFFSET 2
+#define COUNT_OFFSET 6
+
+// Stores value little-endian.
+static void captureFrame_put16(uint8_t buffer[], uint16_t value) {
+  buffer[0] = value & 0xFF;
+  buffer[1] = value >> BITS_PER_BYTE;
+}
+
+// Reads a little-endian value.
+static uint16_t captureFrame_get16(const uint8_t buffer[]) {
+  return buffer[0] | (buffer[1] << BITS_PER_BYTE);
+}
+
+// Updates a CRC-16/CCITT-FALSE (start with 0xFFFF) with length bytes.
+uint16_t captureFrame_crc16(uint16_t crc, const uint8_t data[], size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    crc ^= (uint16_t)data[i] << BITS_PER_BYTE;
+    for (uint16_t bit = 0; bit < BITS_PER_BYTE; bit++)
+      crc = (crc & CRC16_TOP_BIT) ? (crc << 1) ^ CRC16_POLYNOMIAL : crc << 1;
+  }
+  return crc;
+}
+
+// Encodes count samples as one frame in buffer[]. Returns the frame size.
+size_t captureFrame_encode(uint8_t buffer[], uint32_t sequence,
+                           const int16_t samples[], uint16_t count) {
+  buffer[0] = CAPTURE_FRAME_SYNC0;
+  buffer[1] = CAPTURE_FRAME_SYNC1;
+  captureFrame_put16(&buffer[SEQUENCE_OFFSET], sequence & 0xFFFF);
+  captureFrame_put16(&buffer[SEQUENCE_OFFSET + 2], sequence >> 16);
+  captureFrame_put16(&buffer[COUNT_OFFSET], count);
+  size_t size = CAPTURE_FRAME_HEADER_SIZE;
+  for (uint16_t i = 0; i < count; i++, size += 2)
+    captureFrame_put16(&buffer[size], (uint16_t)samples[i]);
+  // The sync bytes are not covered by the CRC.
+  uint16_t crc = captureFrame_crc16(CRC16_INITIAL_VALUE,
+                                    &buffer[SEQUENCE_OFFSET],
+                                    size - SEQUENCE_OFFSET);
+  captureFrame_put16(&buffer[size], crc);
+  return size + CAPTURE_FRAME_CRC_SIZE;
+}
+
+// Sends count samples as a series of frames followed by the end frame.
+void captureFrame_writeSamples(const int16_t samples[], uint32_t count,
+                               void (*putByte)(uint8_t)) {
+  uint8_t frame[CAPTURE_FRAME_MAX_SIZE];
+  uint32_t sequence = 0;
+  uint32_t index = 0;
+  // A last frame with no samples marks the end.
+  bool done = false;
+  while (!done) {
+    uint16_t frameCount = (count - index > CAPTURE_FRAME_MAX_SAMPLE_COUNT)
+                              ? CAPTURE_FRAME_MAX_SAMPLE_COUNT
+                              : count - index;
+    done = (frameCount == 0);
+    size_t size =
+        captureFrame_encode(frame, sequence++, &samples[index], frameCount);
+    for (size_t i = 0; i < size; i++)
+      putByte(frame[i]);
+    index += frameCount;
+  }
+}
+
+// Decodes the frame at the start of buffer[].
+captureFrame_decodeResult_t
+captureFrame_decode(const uint8_t buffer[], size_t length, uint32_t *sequence,
+                    int16_t samples[CAPTURE_FRAME_MAX_SAMPLE_COUNT],
+                    uint16_t *count, size_t *frameSize) {
+  if (length < 1)
+    return CAPTURE_FRAME_DECODE_NEED_MORE;
+  if (buffer[0] != CAPTURE_FRAME_SYNC0)
+    return CAPTURE_FRAME_DECODE_BAD_SYNC;
+  if (length < 2)
+    return CAPTURE_FRAME_DECODE_NEED_MORE;
+  if (buffer[1] != CAPTURE_FRAME_SYNC1)
+    return CAPTURE_FRAME_DECODE_BAD_SYNC;
+  if (length < CAPTURE_FRAME_HEADER_SIZE)
+    return CAPTURE_FRAME_DECODE_NEED_MORE;
+  uint16_t frameCount = captureFrame_get16(&buffer[COUNT_OFFSET]);
+  if (frameCount > CAPTURE_FRAME_MAX_SAMPLE_COUNT)
+    return CAPTURE_FRAME_DECODE_BAD_COUNT;
+  size_t size =
+      CAPTURE_FRAME_HEADER_SIZE + 2 * frameCount + CAPTURE_FRAME_CRC_SIZE;
+  if (length < size)
+    return CAPTURE_FRAME_DECODE_NEED_MORE;
+  uint16_t crc = captureFrame_crc16(
+      CRC16_INITIAL_VALUE, &buffer[SEQUENCE_OFFSET],
+      size - CAPTURE_FRAME_CRC_SIZE - SEQUENCE_OFFSET);
+  if (crc != captureFrame_get16(&buffer[size - CAPTURE_FRAME_CRC_SIZE]))
+    return CAPTURE_FRAME_DECODE_BAD_CRC;
+  *sequence =
+      captureFrame_get16(&buffer[SEQUENCE_OFFSET]) |
+      ((uint32_t)captureFrame_get16(&buffer[SEQUENCE_OFFSET + 2]) << 16);
+  for (uint16_t i = 0; i < frameCount; i++)
+    samples[i] = (int16_t)captureFrame_get16(
+        &buffer[CAPTURE_FRAME_HEADER_SIZE + 2 * i]);
+  *count = frameCount;
+  *frameSize = size;
+  return CAPTURE_FRAME_DECODE_OK;
+}
@@ -0,0 +1,69 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef CAPTUREFRAME_H_
+#define CAPTUREFRAME_H_
+
+// Framed binary format used to send ADC captures from the board to the host
+// (see runningModes_captureRawAdcValues() and tools/captureDecode.c).
+// All multi-byte fields are little-endian. Each frame is:
+//   sync      2 bytes  CAPTURE_FRAME_SYNC0, CAPTURE_FRAME_SYNC1
+//   sequence  4 bytes  frame number, starting at 0
+//   count     2 bytes  number of samples, 0..CAPTURE_FRAME_MAX_SAMPLE_COUNT
+//   samples   2 bytes each, sign-extended ADC values
+//   crc       2 bytes  CRC-16/CCITT-FALSE of sequence, count and samples
+// A capture ends with a frame that has no samples; its sequence number is the
+// number of data frames that preceded it.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define CAPTURE_FRAME_SYNC0 0xAA
+#define CAPTURE_FRAME_SYNC1 0x55
+#define CAPTURE_FRAME_MAX_SAMPLE_COUNT 256
+#define CAPTURE_FRAME_HEADER_SIZE 8 // sync, sequence and count.
+#define CAPTURE_FRAME_CRC_SIZE 2
+#define CAPTURE_FRAME_MAX_SIZE                                                 \
+  (CAPTURE_FRAME_HEADER_SIZE + 2 * CAPTURE_FRAME_MAX_SAMPLE_COUNT +            \
+   CAPTURE_FRAME_CRC_SIZE)
+
+// Results from captureFrame_decode().
+typedef enum {
+  CAPTURE_FRAME_DECODE_OK,        // A valid frame was decoded.
+  CAPTURE_FRAME_DECODE_NEED_MORE, // Not enough bytes yet for a whole frame.
+  CAPTURE_FRAME_DECODE_BAD_SYNC,  // No sync at the start of the buffer.
+  CAPTURE_FRAME_DECODE_BAD_COUNT, // The sample count is too large.
+  CAPTURE_FRAME_DECODE_BAD_CRC    // The CRC does not match.
+} captureFrame_decodeResult_t;
+
+// Updates a CRC-16/CCITT-FALSE (start with 0xFFFF) with length bytes.
+uint16_t captureFrame_crc16(uint16_t crc, const uint8_t data[], size_t length);
+
+// Encodes count samples (at most CAPTURE_FRAME_MAX_SAMPLE_COUNT) as one frame
+// in buffer[], which must hold CAPTURE_FRAME_MAX_SIZE bytes. Returns the frame
+// size in bytes.
+size_t captureFrame_encode(uint8_t buffer[], uint32_t sequence,
+                           const int16_t samples[], uint16_t count);
+
+// Sends count samples as a series of frames followed by the end frame, one
+// byte at a time through putByte.
+void captureFrame_writeSamples(const int16_t samples[], uint32_t count,
+                               void (*putByte)(uint8_t));
+
+// Decodes the frame at the start of buffer[] (length bytes available). On
+// CAPTURE_FRAME_DECODE_OK, *sequence, samples[] and *count are filled in and
+// *frameSize is the number of bytes the frame used. On a BAD_ result the
+// caller should drop one byte and try again to find the next sync.
+captureFrame_decodeResult_t
+captureFrame_decode(const uint8_t buffer[], size_t length, uint32_t *sequence,
+                    int16_t samples[CAPTURE_FRAME_MAX_SAMPLE_COUNT],
+                    uint16_t *count, size_t *frameSize);
+
+#endif /* CAPTUREFRAME_H_ */
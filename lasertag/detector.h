@@ -25,12 +25,10 @@ void detector_init(bool ignoredFrequencies[]);
 
 // Runs the entire detector: decimating fir-filter, iir-filters,
 // power-computation, hit-detection. if interruptsCurrentlyEnabled = true,
-// interrupts are running. If interruptsCurrentlyEnabled = false you can pop
-// values from the ADC buffer without disabling interrupts. If
-// interruptsCurrentlyEnabled = true, do the following:
-// 1. disable interrupts.
-// 2. pop the value from the ADC buffer.
-// 3. re-enable interrupts.
+// interrupts are running. The ADC buffer is lock-free (see isr.h), so values
+// can be removed with isr_removeDataFromAdcBufferBatch() whether or not
+// interrupts are running; there is no need to disable interrupts around each
+// removal.
 // Ignore hits that are detected on the frequencies specified during
 // detector_init(). Your own frequency (based on the switches) is a good choice
 // to ignore. Assumption: draining the ADC buffer occurs faster than it can
@@ -0,0 +1,127 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Multi-sensor filtering and fused hits. See detectorFusion.h.
+
+#include <stdio.h>
+
+#include "detectorFusion.h"
+#include "detectorHit.h"
+#include "filterFixedPoint.h"
+
+#if FILTER_CHANNEL_COUNT > 1 && !defined(FILTER_FIXED_POINT)
+#error "More than one channel is only implemented by filterFixedPoint.c."
+#endif
+
+// Latest power values of each channel.
+static double channelPowerValues[FILTER_CHANNEL_COUNT][FILTER_FREQUENCY_COUNT];
+
+// Calls filter_init() and sets every power value to 0.0.
+void detectorFusion_init() {
+  filter_init();
+  for (uint16_t c = 0; c < FILTER_CHANNEL_COUNT; c++)
+    for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+      channelPowerValues[c][n] = 0.0;
+}
+
+// Filters frameCount frames of interleaved values. Returns true if they
+// completed a FIR output.
+bool detectorFusion_addFrames(const double frames[], uint16_t frameCount) {
+  double input[FILTER_FIR_DECIMATION_FACTOR];
+  double firOutput[1]; // At most one output for this many inputs.
+  bool output = false;
+  for (uint16_t c = 0; c < FILTER_CHANNEL_COUNT; c++) {
+    for (uint16_t f = 0; f < frameCount; f++)
+      input[f] = frames[f * FILTER_CHANNEL_COUNT + c];
+#if FILTER_CHANNEL_COUNT > 1
+    filter_selectChannel(c);
+#endif
+    // Every channel has had the same inputs, so they reach an output together.
+    output = filter_firFilterBlock(input, frameCount, firOutput) > 0;
+    if (!output)
+      continue;
+    filter_iirFilterAll(NULL);
+    for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+      channelPowerValues[c][n] = filter_computePower(n, false, false);
+  }
+#if FILTER_CHANNEL_COUNT > 1
+  filter_selectChannel(0);
+#endif
+  return output;
+}
+
+// Copies the latest power values of channelNumber into powerValues[].
+void detectorFusion_getPowerValues(uint16_t channelNumber,
+                                   double powerValues[FILTER_FREQUENCY_COUNT]) {
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+    powerValues[n] = channelPowerValues[channelNumber][n];
+}
+
+// Fused hit decision on the latest power values of every channel.
+bool detectorFusion_detect(
+    const bool ignoredFrequencies[FILTER_FREQUENCY_COUNT], double fudgeFactor,
+    uint16_t *frequencyNumber, uint16_t *channelNumber) {
+  return detectorHit_detectFused(channelPowerValues, FILTER_CHANNEL_COUNT,
+                                 ignoredFrequencies, fudgeFactor,
+                                 frequencyNumber, channelNumber);
+}
+
+#define TEST_FRAME_COUNT 20000 // 0.2 s, one power window.
+#define TEST_FREQUENCY_NUMBER 2
+#define TEST_AMPLITUDE 0.5
+#define TEST_FUDGE_FACTOR 1000.0
+
+// Puts a tone on each channel in turn and checks the power values and the
+// fused hit. Returns true if the test passes.
+bool detectorFusion_runTest() {
+  bool success = true; // Be optimistic.
+  // The tone's power values on the first channel, to compare the others with.
+  double expected[FILTER_FREQUENCY_COUNT] = {0.0};
+  uint16_t tickCount = filter_frequencyTickTable[TEST_FREQUENCY_NUMBER];
+  for (uint16_t toneChannel = 0; toneChannel < FILTER_CHANNEL_COUNT;
+       toneChannel++) {
+    detectorFusion_init();
+    double frames[FILTER_FIR_DECIMATION_FACTOR * FILTER_CHANNEL_COUNT] = {0.0};
+    for (uint32_t f = 0; f < TEST_FRAME_COUNT;) {
+      for (uint16_t i = 0; i < FILTER_FIR_DECIMATION_FACTOR; i++, f++)
+        frames[i * FILTER_CHANNEL_COUNT + toneChannel] =
+            (f % tickCount) < tickCount / 2 ? TEST_AMPLITUDE : -TEST_AMPLITUDE;
+      detectorFusion_addFrames(frames, FILTER_FIR_DECIMATION_FACTOR);
+    }
+    for (uint16_t c = 0; c < FILTER_CHANNEL_COUNT; c++) {
+      double values[FILTER_FREQUENCY_COUNT];
+      detectorFusion_getPowerValues(c, values);
+      for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+        if (c == 0 && toneChannel == 0)
+          expected[n] = values[n];
+        double shouldBe = c == toneChannel ? expected[n] : 0.0;
+        if (values[n] != shouldBe) {
+          printf("detectorFusion_runTest: tone on channel %d: channel %d, "
+                 "frequency %d has power %le, should be %le.\n",
+                 toneChannel, c, n, values[n], shouldBe);
+          success = false;
+        }
+      }
+    }
+    uint16_t frequencyNumber, channelNumber;
+    bool hit = detectorFusion_detect(NULL, TEST_FUDGE_FACTOR, &frequencyNumber,
+                                     &channelNumber);
+    if (!hit || frequencyNumber != TEST_FREQUENCY_NUMBER ||
+        channelNumber != toneChannel) {
+      printf("detectorFusion_runTest: tone on channel %d: hit %d on channel "
+             "%d, frequency %d; should be 1, %d, %d.\n",
+             toneChannel, hit, channelNumber, frequencyNumber, toneChannel,
+             TEST_FREQUENCY_NUMBER);
+      success = false;
+    }
+  }
+  detectorFusion_init();
+  printf("detectorFusion_runTest %s.\n", success ? "passed" : "failed");
+  return success;
+}
@@ -0,0 +1,56 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef DETECTORFUSION_H_
+#define DETECTORFUSION_H_
+
+// Filtering and hit detection for FILTER_CHANNEL_COUNT sensors sampled
+// together (build with cmake -DFILTER_FIXED_POINT=1 -DFILTER_CHANNEL_COUNT=2).
+// The detector removes whole frames of interleaved values from the ADC buffer
+// (see isr.h), scales them with detector_getScaledAdcValue() and passes them
+// here. Each channel's values go through its own filter state
+// (filter_selectChannel() in filterFixedPoint.h) on the batched paths:
+// filter_firFilterBlock() and, at each FIR output, filter_iirFilterAll() and
+// filter_computePower() for every frequency. The channels' power values are
+// then fused by detectorHit_detectFused(), so a shot seen by several sensors is
+// one hit, reported on the sensor that saw it best.
+//
+// With one channel, the calls are those of the single-sensor batched path.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "filter.h"
+
+// Calls filter_init() and sets every power value to 0.0.
+void detectorFusion_init();
+
+// Filters frameCount frames, at most FILTER_FIR_DECIMATION_FACTOR, of
+// interleaved values: frames[f * FILTER_CHANNEL_COUNT + c] is the value of
+// channel c in frame f. Returns true if they completed a FIR output, which
+// updates the power values of every channel. Leaves channel 0 selected.
+bool detectorFusion_addFrames(const double frames[], uint16_t frameCount);
+
+// Copies the latest power values of channelNumber into powerValues[].
+void detectorFusion_getPowerValues(uint16_t channelNumber,
+                                   double powerValues[FILTER_FREQUENCY_COUNT]);
+
+// Fused hit decision on the latest power values of every channel. See
+// detectorHit_detectFused().
+bool detectorFusion_detect(
+    const bool ignoredFrequencies[FILTER_FREQUENCY_COUNT], double fudgeFactor,
+    uint16_t *frequencyNumber, uint16_t *channelNumber);
+
+// Puts a tone on each channel in turn, with the others silent, and checks that
+// only that channel's power values change, that they are the same whichever
+// channel it is, and that the fused hit is on that channel at the tone's
+// frequency. Returns true if the test passes. Leaves the filters initialized.
+bool detectorFusion_runTest();
+
+#endif /* DETECTORFUSION_H_ */
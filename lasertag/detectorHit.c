@@ -0,0 +1,280 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "detectorHit.h"
+#include "detectorProfile.h"
+
+#define MEDIAN_LOWER_INDEX ((FILTER_FREQUENCY_COUNT - 1) / 2)
+#define MEDIAN_UPPER_INDEX (FILTER_FREQUENCY_COUNT / 2)
+#define MAX_INDEX (FILTER_FREQUENCY_COUNT - 1)
+
+// Tracked power values.
+static double trackedPower[FILTER_FREQUENCY_COUNT];
+// Frequency numbers in increasing power order, and the place of each frequency
+// in powerOrder[]. Equal powers are ordered by decreasing frequency number, so
+// the last entry is the lowest-numbered frequency with the largest power, the
+// same one detectorHit_detect() picks.
+static uint16_t powerOrder[FILTER_FREQUENCY_COUNT];
+static uint16_t powerRank[FILTER_FREQUENCY_COUNT];
+// The last decision and what it depended on.
+static bool trackedChanged;
+static bool trackedHit;
+static double trackedFudgeFactor;
+static const bool *trackedIgnoredFrequencies;
+
+// Returns the median of powerValues[] (the mean of the two middle values).
+double detectorHit_median(const double powerValues[FILTER_FREQUENCY_COUNT]) {
+  double sorted[FILTER_FREQUENCY_COUNT];
+  // Insertion sort; there are only FILTER_FREQUENCY_COUNT values.
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    double value = powerValues[i];
+    int16_t j = i - 1;
+    while (j >= 0 && sorted[j] > value) {
+      sorted[j + 1] = sorted[j];
+      j--;
+    }
+    sorted[j + 1] = value;
+  }
+  return (sorted[MEDIAN_LOWER_INDEX] + sorted[MEDIAN_UPPER_INDEX]) / 2.0;
+}
+
+// Returns true if powerValues[] indicate a hit on a frequency that is not
+// ignored. *frequencyNumber is set to the frequency with the largest power.
+bool detectorHit_detect(const double powerValues[FILTER_FREQUENCY_COUNT],
+                        const bool ignoredFrequencies[FILTER_FREQUENCY_COUNT],
+                        double fudgeFactor, uint16_t *frequencyNumber) {
+  DETECTOR_PROFILE_START(profile);
+  uint16_t maxIndex = 0;
+  for (uint16_t i = 1; i < FILTER_FREQUENCY_COUNT; i++)
+    if (powerValues[i] > powerValues[maxIndex])
+      maxIndex = i;
+  *frequencyNumber = maxIndex;
+  bool hit = !(ignoredFrequencies && ignoredFrequencies[maxIndex]) &&
+             powerValues[maxIndex] >
+                 detectorHit_median(powerValues) * fudgeFactor;
+  DETECTOR_PROFILE_STOP(profile, DETECTOR_PROFILE_HIT);
+  return hit;
+}
+
+// Sets all tracked power values to 0.0.
+void detectorHit_initTracker() {
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    trackedPower[i] = 0.0;
+    // All powers are equal, so higher frequency numbers go first.
+    powerOrder[i] = MAX_INDEX - i;
+    powerRank[MAX_INDEX - i] = i;
+  }
+  trackedChanged = true;
+}
+
+// True if frequency a goes before frequency b in powerOrder[].
+static inline bool detectorHit_goesBefore(uint16_t a, uint16_t b) {
+  return trackedPower[a] < trackedPower[b] ||
+         (trackedPower[a] == trackedPower[b] && a > b);
+}
+
+// Sets the tracked power of frequencyNumber and moves it to its new place in
+// the power order. Does nothing if the power has not changed.
+void detectorHit_setTrackedPower(uint16_t frequencyNumber, double power) {
+  if (trackedPower[frequencyNumber] == power)
+    return;
+  trackedPower[frequencyNumber] = power;
+  trackedChanged = true;
+  // Shift the neighbors that are now on the wrong side of frequencyNumber.
+  uint16_t rank = powerRank[frequencyNumber];
+  while (rank > 0 &&
+         detectorHit_goesBefore(frequencyNumber, powerOrder[rank - 1])) {
+    powerOrder[rank] = powerOrder[rank - 1];
+    powerRank[powerOrder[rank]] = rank;
+    rank--;
+  }
+  while (rank < MAX_INDEX &&
+         detectorHit_goesBefore(powerOrder[rank + 1], frequencyNumber)) {
+    powerOrder[rank] = powerOrder[rank + 1];
+    powerRank[powerOrder[rank]] = rank;
+    rank++;
+  }
+  powerOrder[rank] = frequencyNumber;
+  powerRank[frequencyNumber] = rank;
+}
+
+// Calls detectorHit_setTrackedPower() for every frequency.
+void detectorHit_setTrackedPowers(
+    const double powerValues[FILTER_FREQUENCY_COUNT]) {
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    detectorHit_setTrackedPower(i, powerValues[i]);
+}
+
+// Returns the median of the tracked power values.
+double detectorHit_trackedMedian() {
+  return (trackedPower[powerOrder[MEDIAN_LOWER_INDEX]] +
+          trackedPower[powerOrder[MEDIAN_UPPER_INDEX]]) /
+         2.0;
+}
+
+// Same as detectorHit_detect() for the tracked power values, but only
+// evaluated when something it depends on has changed.
+bool detectorHit_detectTracked(
+    const bool ignoredFrequencies[FILTER_FREQUENCY_COUNT], double fudgeFactor,
+    uint16_t *frequencyNumber) {
+  DETECTOR_PROFILE_START(profile);
+  uint16_t maxIndex = powerOrder[MAX_INDEX];
+  *frequencyNumber = maxIndex;
+  if (trackedChanged || fudgeFactor != trackedFudgeFactor ||
+      ignoredFrequencies != trackedIgnoredFrequencies) {
+    trackedChanged = false;
+    trackedFudgeFactor = fudgeFactor;
+    trackedIgnoredFrequencies = ignoredFrequencies;
+    trackedHit = !(ignoredFrequencies && ignoredFrequencies[maxIndex]) &&
+                 trackedPower[maxIndex] >
+                     detectorHit_trackedMedian() * fudgeFactor;
+  }
+  DETECTOR_PROFILE_STOP(profile, DETECTOR_PROFILE_HIT);
+  return trackedHit;
+}
+
+// Decides every channel as detectorHit_detect() does and returns the one with
+// a hit, or any channel if none has one, whose largest power is the most times
+// its median.
+bool detectorHit_detectFused(
+    const double powerValues[][FILTER_FREQUENCY_COUNT], uint16_t channelCount,
+    const bool ignoredFrequencies[FILTER_FREQUENCY_COUNT], double fudgeFactor,
+    uint16_t *frequencyNumber, uint16_t *channelNumber) {
+  DETECTOR_PROFILE_START(profile);
+  bool hit = false;
+  double bestMax = 0.0;
+  double bestMedian = 0.0;
+  *frequencyNumber = *channelNumber = 0;
+  for (uint16_t c = 0; c < channelCount; c++) {
+    // The same decision as detectorHit_detect(), keeping the median.
+    uint16_t frequency = 0;
+    for (uint16_t i = 1; i < FILTER_FREQUENCY_COUNT; i++)
+      if (powerValues[c][i] > powerValues[c][frequency])
+        frequency = i;
+    double max = powerValues[c][frequency];
+    double median = detectorHit_median(powerValues[c]);
+    bool channelHit = !(ignoredFrequencies && ignoredFrequencies[frequency]) &&
+                      max > median * fudgeFactor;
+    // Compares the ratios without dividing, since a median can be zero.
+    bool stronger = channelHit == hit ? max * bestMedian > bestMax * median
+                                      : channelHit;
+    if (c == 0 || stronger) {
+      hit = channelHit;
+      bestMax = max;
+      bestMedian = median;
+      *frequencyNumber = frequency;
+      *channelNumber = c;
+    }
+  }
+  DETECTOR_PROFILE_STOP(profile, DETECTOR_PROFILE_HIT);
+  return hit;
+}
+
+#define TEST_STEP_COUNT 100000
+#define TEST_FUDGE_FACTOR 5.0
+#define TEST_LEVEL_COUNT 8 // Few levels so that equal powers are common.
+#define TEST_BIG_STEP_ODDS 16 // One step in this many jumps to a random power.
+// Returns a random power value.
+static double detectorHit_randomPower() {
+  return (double)(rand() % TEST_LEVEL_COUNT) * (rand() % TEST_LEVEL_COUNT);
+}
+
+#define TEST_CHANNEL_COUNT 2
+// Checks detectorHit_detectFused() on two channels, each with a tone over a
+// flat noise floor of 1.0 (or none), against the expected channel and
+// frequency. Returns true if the test passes.
+static bool detectorHit_testFused() {
+  const struct {
+    double tonePower[TEST_CHANNEL_COUNT]; // 0.0 for no tone.
+    uint16_t toneFrequency[TEST_CHANNEL_COUNT];
+    bool hit;
+    uint16_t channel;
+  } cases[] = {
+      {{0.0, 0.0}, {0, 0}, false, 0}, // Noise only; ties go to channel 0.
+      {{0.0, 20.0}, {0, 3}, true, 1}, // Only the second sensor is hit.
+      {{20.0, 0.0}, {2, 0}, true, 0},
+      {{20.0, 40.0}, {2, 3}, true, 1}, // Both; the stronger one wins.
+      {{40.0, 3.0}, {1, 3}, false, 0}, // Frequency 1 is ignored.
+      {{80.0, 20.0}, {1, 3}, true, 1}, // A real hit beats an ignored one.
+      {{3.0, 4.0}, {2, 3}, false, 1},  // Neither reaches the fudge factor.
+  };
+  bool ignoredFrequencies[FILTER_FREQUENCY_COUNT] = {false};
+  ignoredFrequencies[1] = true;
+  bool success = true;
+  for (uint16_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+    double powerValues[TEST_CHANNEL_COUNT][FILTER_FREQUENCY_COUNT];
+    for (uint16_t c = 0; c < TEST_CHANNEL_COUNT; c++) {
+      for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+        powerValues[c][n] = 1.0;
+      if (cases[i].tonePower[c] > 0.0)
+        powerValues[c][cases[i].toneFrequency[c]] = cases[i].tonePower[c];
+    }
+    uint16_t frequency, channel;
+    bool hit = detectorHit_detectFused(powerValues, TEST_CHANNEL_COUNT,
+                                       ignoredFrequencies, TEST_FUDGE_FACTOR,
+                                       &frequency, &channel);
+    uint16_t expectedFrequency = cases[i].toneFrequency[cases[i].channel];
+    bool hasTone = cases[i].tonePower[cases[i].channel] > 0.0;
+    if (hit != cases[i].hit || channel != cases[i].channel ||
+        (hasTone && frequency != expectedFrequency)) {
+      printf("detectorHit_runTest: fused case %d: hit %d, channel %d, "
+             "frequency %d; should be %d, %d, %d.\n",
+             i, hit, channel, frequency, cases[i].hit, cases[i].channel,
+             expectedFrequency);
+      success = false;
+    }
+  }
+  return success;
+}
+
+// Checks the tracked detection against detectorHit_detect(). Each step changes
+// one power, usually by a little, with ties and repeated values on purpose.
+// Then checks detectorHit_detectFused(). Returns true if the test passes.
+bool detectorHit_runTest() {
+  bool success = true; // Be optimistic.
+  double powerValues[FILTER_FREQUENCY_COUNT] = {0.0};
+  bool ignoredFrequencies[FILTER_FREQUENCY_COUNT] = {false};
+  ignoredFrequencies[1] = true;
+  detectorHit_initTracker();
+  for (uint32_t step = 0; step < TEST_STEP_COUNT && success; step++) {
+    uint16_t changed = rand() % FILTER_FREQUENCY_COUNT;
+    if (rand() % TEST_BIG_STEP_ODDS == 0)
+      powerValues[changed] = detectorHit_randomPower();
+    else
+      powerValues[changed] += (rand() % 3) - 1;
+    detectorHit_setTrackedPowers(powerValues);
+    uint16_t expectedFrequency, trackedFrequency;
+    bool expectedHit =
+        detectorHit_detect(powerValues, ignoredFrequencies, TEST_FUDGE_FACTOR,
+                           &expectedFrequency);
+    bool trackedHit = detectorHit_detectTracked(
+        ignoredFrequencies, TEST_FUDGE_FACTOR, &trackedFrequency);
+    if (trackedHit != expectedHit || trackedFrequency != expectedFrequency ||
+        detectorHit_trackedMedian() != detectorHit_median(powerValues)) {
+      printf("detectorHit_runTest: step %lu: hit %d, frequency %d, median %le; "
+             "should be %d, %d, %le.\n",
+             (unsigned long)step, trackedHit, trackedFrequency,
+             detectorHit_trackedMedian(), expectedHit, expectedFrequency,
+             detectorHit_median(powerValues));
+      success = false;
+    }
+    // The order must be consistent with the ranks and sorted.
+    for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT && success; i++)
+      if (powerRank[powerOrder[i]] != i ||
+          (i > 0 && !detectorHit_goesBefore(powerOrder[i - 1], powerOrder[i])))
+        success = false;
+  }
+  detectorHit_initTracker();
+  success &= detectorHit_testFused();
+  printf("detectorHit_runTest %s.\n", success ? "passed" : "failed");
+  return success;
+}
@@ -0,0 +1,80 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef DETECTORHIT_H_
+#define DETECTORHIT_H_
+
+// Hit decision used by the detector: a hit occurs when the largest power value
+// exceeds the median power value multiplied by a fudge factor. Kept separate
+// from detector.c so that host tools can use the same decision.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "filter.h"
+
+// Returns true if powerValues[] (one per frequency) indicate a hit. The
+// frequency with the largest power is returned in *frequencyNumber whether or
+// not there is a hit. A hit on a frequency whose ignoredFrequencies[] entry is
+// true is not reported; ignoredFrequencies may be NULL.
+bool detectorHit_detect(const double powerValues[FILTER_FREQUENCY_COUNT],
+                        const bool ignoredFrequencies[FILTER_FREQUENCY_COUNT],
+                        double fudgeFactor, uint16_t *frequencyNumber);
+
+// Fused hit decision for several channels (sensors), each with its own power
+// values. Each channel is decided as by detectorHit_detect(), and there is a
+// hit if any channel has one. The channel returned in *channelNumber, with its
+// largest-power frequency in *frequencyNumber, is the one whose largest power
+// is the most times its median: of the channels with a hit if there are any,
+// otherwise of all of them. Ties go to the lowest channel number.
+bool detectorHit_detectFused(
+    const double powerValues[][FILTER_FREQUENCY_COUNT], uint16_t channelCount,
+    const bool ignoredFrequencies[FILTER_FREQUENCY_COUNT], double fudgeFactor,
+    uint16_t *frequencyNumber, uint16_t *channelNumber);
+
+// Returns the median of powerValues[] (the mean of the two middle values).
+double detectorHit_median(const double powerValues[FILTER_FREQUENCY_COUNT]);
+
+// Tracked hit detection. Instead of sorting a copy of the power values for
+// every decision, the tracker keeps the frequencies in power order and moves a
+// frequency only when its power changes. Power values change a little at a
+// time, so a frequency usually moves by zero or one place. The median and the
+// largest power are then read directly from the order, and
+// detectorHit_detectTracked() costs the same whatever the power values are.
+// The decisions are the same as detectorHit_detect() on the same values.
+
+// Sets all tracked power values to 0.0.
+void detectorHit_initTracker();
+
+// Sets the tracked power of frequencyNumber and moves it to its new place in
+// the power order. Does nothing if the power has not changed.
+void detectorHit_setTrackedPower(uint16_t frequencyNumber, double power);
+
+// Calls detectorHit_setTrackedPower() for every frequency.
+void detectorHit_setTrackedPowers(
+    const double powerValues[FILTER_FREQUENCY_COUNT]);
+
+// Returns the median of the tracked power values.
+double detectorHit_trackedMedian();
+
+// Same as detectorHit_detect() for the tracked power values. The decision is
+// only evaluated again if a power value, the fudge factor or the
+// ignoredFrequencies pointer changed since the last call; otherwise the
+// previous result is returned. Call detectorHit_initTracker() after changing
+// the contents of ignoredFrequencies[].
+bool detectorHit_detectTracked(
+    const bool ignoredFrequencies[FILTER_FREQUENCY_COUNT], double fudgeFactor,
+    uint16_t *frequencyNumber);
+
+// Checks the tracked detection against detectorHit_detect() with random power
+// values, and detectorHit_detectFused() with fixed ones. Returns true if the
+// test passes.
+bool detectorHit_runTest();
+
+#endif /* DETECTORHIT_H_ */
@@ -0,0 +1,302 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "detectorProfile.h"
+#include "display.h"
+
+#ifdef ZYBO_BOARD
+#include "xparameters.h"
+#include "xpm_counter.h"
+#endif
+
+// The p99 comes from a histogram of cycle counts. Each power of two is split
+// into HISTOGRAM_SUB_BUCKET_COUNT buckets, so a bucket is at most 1/8 of its
+// lower bound wide. Values below HISTOGRAM_SUB_BUCKET_COUNT get a bucket each.
+#define HISTOGRAM_SUB_BUCKET_BITS 3
+#define HISTOGRAM_SUB_BUCKET_COUNT (1 << HISTOGRAM_SUB_BUCKET_BITS)
+#define HISTOGRAM_SUB_BUCKET_MASK (HISTOGRAM_SUB_BUCKET_COUNT - 1)
+#define COUNTER_BITS 32
+#define HISTOGRAM_BUCKET_COUNT                                                 \
+  ((COUNTER_BITS - HISTOGRAM_SUB_BUCKET_BITS + 1) * HISTOGRAM_SUB_BUCKET_COUNT)
+#define PERCENTILE 0.99
+
+#define CALIBRATION_COUNT 64 // START/STOP pairs timed by detectorProfile_init()
+
+// PMU control register bits and count-enable bits.
+#define PMU_CONTROL_ENABLE 0x1
+#define PMU_COUNT_ENABLE_CYCLES 0x80000000
+#define PMU_COUNT_ENABLE_EVENT(counter) (1 << (counter))
+
+#define TABLE_TEXT_SIZE 1 // 53 characters per line.
+#define TABLE_TEXT_COLOR DISPLAY_WHITE
+#define TABLE_LINE_LENGTH 80
+#define TABLE_NAME_LENGTH 8 // Stage names are cut to 7 characters.
+// Lines that fit on the TFT, of which the title, a blank line and the column
+// header use TABLE_HEADER_LINE_COUNT.
+#define TABLE_DISPLAY_LINE_COUNT                                               \
+  (DISPLAY_HEIGHT / (DISPLAY_CHAR_HEIGHT * TABLE_TEXT_SIZE))
+#define TABLE_HEADER_LINE_COUNT 3
+#define TABLE_DISPLAY_ROW_COUNT                                                \
+  (TABLE_DISPLAY_LINE_COUNT - TABLE_HEADER_LINE_COUNT)
+#define PERCENT 100.0
+
+typedef struct {
+  uint32_t count;
+  uint32_t minCycles;
+  uint32_t maxCycles;
+  uint64_t totalCycles;
+  uint64_t totalDataMisses;
+  uint64_t totalInstructionMisses;
+  uint32_t histogram[HISTOGRAM_BUCKET_COUNT];
+} detectorProfile_stageData_t;
+
+static detectorProfile_stageData_t stageData[DETECTOR_PROFILE_STAGE_COUNT];
+// Cycles taken by a START/STOP pair with nothing in between.
+static uint32_t overheadCycles;
+
+static const char *stageNames[DETECTOR_PROFILE_STAGE_COUNT] = {
+    [DETECTOR_PROFILE_ADC_POP] = "ADC pop",
+    [DETECTOR_PROFILE_FIR] = "FIR",
+    [DETECTOR_PROFILE_IIR_ALL] = "IIR all",
+    [DETECTOR_PROFILE_POWER] = "power",
+    [DETECTOR_PROFILE_HIT] = "hit"};
+
+// Returns the histogram bucket for cycles.
+static uint16_t detectorProfile_bucket(uint32_t cycles) {
+  if (cycles < HISTOGRAM_SUB_BUCKET_COUNT)
+    return cycles;
+  uint16_t msb = COUNTER_BITS - 1 - __builtin_clz(cycles);
+  uint16_t shift = msb - HISTOGRAM_SUB_BUCKET_BITS;
+  return (shift + 1) * HISTOGRAM_SUB_BUCKET_COUNT +
+         ((cycles >> shift) & HISTOGRAM_SUB_BUCKET_MASK);
+}
+
+// Returns the largest cycle count that falls in bucket.
+static uint32_t detectorProfile_bucketUpperBound(uint16_t bucket) {
+  if (bucket < HISTOGRAM_SUB_BUCKET_COUNT)
+    return bucket;
+  uint16_t shift = bucket / HISTOGRAM_SUB_BUCKET_COUNT - 1;
+  uint32_t lower = (uint32_t)(HISTOGRAM_SUB_BUCKET_COUNT +
+                              (bucket & HISTOGRAM_SUB_BUCKET_MASK))
+                   << shift;
+  return lower + ((1u << shift) - 1);
+}
+
+// Adds one run of a stage to its statistics.
+void detectorProfile_record(detectorProfile_stage_t stage, uint32_t cycles,
+                            uint32_t dataMisses, uint32_t instructionMisses) {
+  detectorProfile_stageData_t *data = &stageData[stage];
+  if (data->count == 0 || cycles < data->minCycles)
+    data->minCycles = cycles;
+  if (cycles > data->maxCycles)
+    data->maxCycles = cycles;
+  data->count++;
+  data->totalCycles += cycles;
+  data->totalDataMisses += dataMisses;
+  data->totalInstructionMisses += instructionMisses;
+  data->histogram[detectorProfile_bucket(cycles)]++;
+}
+
+// Records the end of a stage that started at *sample. The cycle counter is
+// read first so that the rest is not counted.
+void detectorProfile_stop(const detectorProfile_sample_t *sample,
+                          detectorProfile_stage_t stage) {
+  uint32_t cycles = detectorProfile_readCycles() - sample->cycles;
+  cycles = cycles > overheadCycles ? cycles - overheadCycles : 0;
+#ifdef ZYBO_BOARD
+  uint32_t dataMisses =
+      detectorProfile_readEventCounter(DETECTOR_PROFILE_DATA_MISS_COUNTER) -
+      sample->dataMisses;
+  uint32_t instructionMisses = detectorProfile_readEventCounter(
+                                   DETECTOR_PROFILE_INSTRUCTION_MISS_COUNTER) -
+                               sample->instructionMisses;
+#else
+  uint32_t dataMisses = 0;
+  uint32_t instructionMisses = 0;
+#endif
+  detectorProfile_record(stage, cycles, dataMisses, instructionMisses);
+}
+
+// Clears the statistics.
+void detectorProfile_reset() { memset(stageData, 0, sizeof(stageData)); }
+
+// Starts the cycle counter and the two cache-refill event counters.
+void detectorProfile_startCounters() {
+#ifdef ZYBO_BOARD
+  // The counters are only ever read as differences, so they are not reset.
+  mtcp(XREG_CP15_PERF_MONITOR_CTRL,
+       mfcp(XREG_CP15_PERF_MONITOR_CTRL) | PMU_CONTROL_ENABLE);
+  mtcp(XREG_CP15_EVENT_CNTR_SEL, DETECTOR_PROFILE_DATA_MISS_COUNTER);
+  mtcp(XREG_CP15_EVENT_TYPE_SEL, XPM_EVENT_DATA_CACHEREFILL);
+  mtcp(XREG_CP15_EVENT_CNTR_SEL, DETECTOR_PROFILE_INSTRUCTION_MISS_COUNTER);
+  mtcp(XREG_CP15_EVENT_TYPE_SEL, XPM_EVENT_INSRFETCH_CACHEREFILL);
+  mtcp(XREG_CP15_COUNT_ENABLE_SET,
+       PMU_COUNT_ENABLE_CYCLES |
+           PMU_COUNT_ENABLE_EVENT(DETECTOR_PROFILE_DATA_MISS_COUNTER) |
+           PMU_COUNT_ENABLE_EVENT(DETECTOR_PROFILE_INSTRUCTION_MISS_COUNTER));
+#endif
+}
+
+// Starts the PMU counters, measures the START/STOP overhead and clears the
+// statistics.
+void detectorProfile_init() {
+  detectorProfile_startCounters();
+  // Time empty START/STOP pairs. The smallest is the overhead; larger ones
+  // were interrupted.
+  overheadCycles = 0;
+  detectorProfile_reset();
+  for (uint16_t i = 0; i < CALIBRATION_COUNT; i++) {
+    detectorProfile_sample_t sample;
+    detectorProfile_start(&sample);
+    detectorProfile_stop(&sample, DETECTOR_PROFILE_ADC_POP);
+  }
+  overheadCycles = stageData[DETECTOR_PROFILE_ADC_POP].minCycles;
+  detectorProfile_reset();
+}
+
+// Fills in *stats for stage.
+void detectorProfile_getStats(detectorProfile_stage_t stage,
+                              detectorProfile_stats_t *stats) {
+  const detectorProfile_stageData_t *data = &stageData[stage];
+  memset(stats, 0, sizeof(*stats));
+  stats->count = data->count;
+  if (data->count == 0)
+    return;
+  stats->minCycles = data->minCycles;
+  stats->maxCycles = data->maxCycles;
+  stats->totalCycles = data->totalCycles;
+  stats->meanCycles = (double)data->totalCycles / data->count;
+  stats->meanDataMisses = (double)data->totalDataMisses / data->count;
+  stats->meanInstructionMisses =
+      (double)data->totalInstructionMisses / data->count;
+  // Find the bucket that holds the PERCENTILE'th value.
+  uint32_t rank = (uint32_t)(PERCENTILE * (data->count - 1)) + 1;
+  uint32_t seen = 0;
+  uint16_t bucket = 0;
+  while ((seen += data->histogram[bucket]) < rank)
+    bucket++;
+  uint32_t upperBound = detectorProfile_bucketUpperBound(bucket);
+  stats->p99Cycles =
+      upperBound < data->maxCycles ? upperBound : data->maxCycles;
+}
+
+// Prints line on the console, and on the TFT if onDisplay.
+static void detectorProfile_printLine(const char line[], bool onDisplay) {
+  if (onDisplay)
+    display_println(line);
+  printf("%s\n", line);
+}
+
+// Prints a table of the statistics of every stage that ran on the console and,
+// if onDisplay, on the TFT. Rows that do not fit on the TFT are only printed on
+// the console.
+void detectorProfile_printTable(bool onDisplay) {
+  char line[TABLE_LINE_LENGTH];
+  if (onDisplay) {
+    display_setTextSize(TABLE_TEXT_SIZE);
+    display_setTextColor(TABLE_TEXT_COLOR);
+    display_setCursor(0, 0);
+    display_fillScreen(DISPLAY_BLACK);
+  }
+#ifdef ZYBO_BOARD
+  snprintf(line, sizeof(line), "Detector stages (CPU cycles, %lu per sample)",
+           (unsigned long)(XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ /
+                           (FILTER_SAMPLE_FREQUENCY_IN_KHZ * 1000)));
+#else
+  snprintf(line, sizeof(line), "Detector stages (ns)");
+#endif
+  detectorProfile_printLine(line, onDisplay);
+  detectorProfile_printLine("", onDisplay);
+  // Share of the cycles spent in all stages, and the rows to print.
+  uint64_t allCycles = 0;
+  uint16_t rowCount = 0;
+  for (uint16_t stage = 0; stage < DETECTOR_PROFILE_STAGE_COUNT; stage++) {
+    allCycles += stageData[stage].totalCycles;
+    rowCount += stageData[stage].count > 0;
+  }
+  // Keep the last TFT line for a note if the rows do not fit.
+  uint16_t displayRowCount = rowCount > TABLE_DISPLAY_ROW_COUNT
+                                 ? TABLE_DISPLAY_ROW_COUNT - 1
+                                 : rowCount;
+  snprintf(line, sizeof(line), "%-7s %6s %6s %6s %6s %5s %5s %5s", "stage",
+           "min", "mean", "max", "p99", "%", "D$/c", "I$/c");
+  detectorProfile_printLine(line, onDisplay);
+  uint16_t row = 0;
+  for (uint16_t stage = 0; stage < DETECTOR_PROFILE_STAGE_COUNT; stage++) {
+    detectorProfile_stats_t stats;
+    detectorProfile_getStats(stage, &stats);
+    if (stats.count == 0)
+      continue;
+    char name[TABLE_NAME_LENGTH];
+    if (stageNames[stage])
+      snprintf(name, sizeof(name), "%s", stageNames[stage]);
+    else
+      snprintf(name, sizeof(name), "IIR %d", stage - DETECTOR_PROFILE_IIR);
+    snprintf(line, sizeof(line), "%-7s %6lu %6lu %6lu %6lu %5.1f %5.1f %5.1f",
+             name, (unsigned long)stats.minCycles,
+             (unsigned long)(stats.meanCycles + 0.5),
+             (unsigned long)stats.maxCycles, (unsigned long)stats.p99Cycles,
+             allCycles ? stats.totalCycles * PERCENT / allCycles : 0.0,
+             stats.meanDataMisses, stats.meanInstructionMisses);
+    detectorProfile_printLine(line, onDisplay && row < displayRowCount);
+    row++;
+  }
+  if (onDisplay && displayRowCount < rowCount) {
+    snprintf(line, sizeof(line), "... %d more rows on the console.",
+             rowCount - displayRowCount);
+    display_println(line);
+  }
+}
+
+#define TEST_STAGE DETECTOR_PROFILE_FIR
+#define TEST_VALUE_COUNT 1000
+#define TEST_P99 990
+#define TEST_MEAN ((TEST_VALUE_COUNT + 1) / 2.0)
+// Records 1..TEST_VALUE_COUNT and checks the statistics. Clears the statistics.
+// Returns true if the test passes.
+bool detectorProfile_runTest() {
+  bool success = true; // Be optimistic.
+  detectorProfile_reset();
+  // Record in a scrambled order; 7 and TEST_VALUE_COUNT share no factors.
+  for (uint32_t i = 0; i < TEST_VALUE_COUNT; i++)
+    detectorProfile_record(TEST_STAGE, (i * 7) % TEST_VALUE_COUNT + 1, i, 0);
+  detectorProfile_stats_t stats;
+  detectorProfile_getStats(TEST_STAGE, &stats);
+  if (stats.count != TEST_VALUE_COUNT || stats.minCycles != 1 ||
+      stats.maxCycles != TEST_VALUE_COUNT || stats.meanCycles != TEST_MEAN) {
+    printf("detectorProfile_runTest: count %lu, min %lu, max %lu, mean %f.\n",
+           (unsigned long)stats.count, (unsigned long)stats.minCycles,
+           (unsigned long)stats.maxCycles, stats.meanCycles);
+    success = false;
+  }
+  // The bucket holding TEST_P99 is at most 1/8 of its lower bound wide.
+  if (stats.p99Cycles < TEST_P99 ||
+      stats.p99Cycles > TEST_P99 + TEST_P99 / HISTOGRAM_SUB_BUCKET_COUNT) {
+    printf("detectorProfile_runTest: p99 is %lu, should be about %d.\n",
+           (unsigned long)stats.p99Cycles, TEST_P99);
+    success = false;
+  }
+  // Every bucket's upper bound must map back to the same bucket, and the next
+  // value to the next bucket.
+  for (uint16_t bucket = 0; bucket < HISTOGRAM_BUCKET_COUNT - 1; bucket++) {
+    uint32_t upperBound = detectorProfile_bucketUpperBound(bucket);
+    if (detectorProfile_bucket(upperBound) != bucket ||
+        detectorProfile_bucket(upperBound + 1) != bucket + 1) {
+      printf("detectorProfile_runTest: bucket %d is inconsistent.\n", bucket);
+      success = false;
+      break;
+    }
+  }
+  detectorProfile_reset();
+  printf("detectorProfile_runTest %s.\n", success ? "passed" : "failed");
+  return success;
+}
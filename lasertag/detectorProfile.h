@@ -0,0 +1,154 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef DETECTORPROFILE_H_
+#define DETECTORPROFILE_H_
+
+// Per-stage profiling of the detector using the Cortex-A9 performance monitor
+// (PMU). The cycle counter measures each stage, and two event counters count
+// L1 data and instruction cache refills (misses) during the stage. For every
+// stage the module keeps the call count, min, mean, max and 99th percentile of
+// the cycles, and the mean misses per call.
+//
+// The stages are marked in the code with DETECTOR_PROFILE_START() and
+// DETECTOR_PROFILE_STOP(). These compile to nothing unless DETECTOR_PROFILE is
+// defined (cmake -DDETECTOR_PROFILE=1), so normal builds pay nothing.
+//
+// Interrupts are left enabled while profiling, so a stage that is interrupted
+// also counts the time spent in the ISR. This shows up in max and p99 rather
+// than in min and mean.
+//
+// On the board the counts are CPU clock cycles. Elsewhere (the emulator) they
+// are nanoseconds from clock_gettime() and the miss counts are zero.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "filter.h"
+
+#ifdef ZYBO_BOARD
+#include "xpseudo_asm.h"
+#include "xreg_cortexa9.h"
+#else
+#include <time.h>
+#endif
+
+// Profiled stages, in the order they are printed.
+typedef enum {
+  DETECTOR_PROFILE_ADC_POP, // isr_removeDataFromAdcBuffer...()
+  DETECTOR_PROFILE_FIR,     // filter_firFilter() and filter_firFilterBlock()
+  DETECTOR_PROFILE_IIR,     // filter_iirFilter(), one stage per filter number.
+  DETECTOR_PROFILE_IIR_ALL = DETECTOR_PROFILE_IIR + FILTER_FREQUENCY_COUNT,
+  DETECTOR_PROFILE_POWER, // filter_computePower()
+  DETECTOR_PROFILE_HIT,   // detectorHit_detect()
+  DETECTOR_PROFILE_STAGE_COUNT
+} detectorProfile_stage_t;
+
+// Counter values at the start of a stage.
+typedef struct {
+  uint32_t cycles;
+  uint32_t dataMisses;
+  uint32_t instructionMisses;
+} detectorProfile_sample_t;
+
+// Statistics for one stage.
+typedef struct {
+  uint32_t count;     // Number of times the stage ran.
+  uint32_t minCycles; // 0 if count is 0.
+  double meanCycles;
+  uint32_t maxCycles;
+  uint32_t p99Cycles; // At most 12.5% above the true 99th percentile.
+  uint64_t totalCycles;
+  double meanDataMisses;        // L1 data cache refills per call.
+  double meanInstructionMisses; // L1 instruction cache refills per call.
+} detectorProfile_stats_t;
+
+#ifdef ZYBO_BOARD
+#define DETECTOR_PROFILE_DATA_MISS_COUNTER 0
+#define DETECTOR_PROFILE_INSTRUCTION_MISS_COUNTER 1
+
+// Reads event counter number counter.
+static inline uint32_t detectorProfile_readEventCounter(uint32_t counter) {
+  mtcp(XREG_CP15_EVENT_CNTR_SEL, counter);
+  return mfcp(XREG_CP15_PERF_MONITOR_COUNT);
+}
+#endif
+
+// Returns the current cycle count.
+static inline uint32_t detectorProfile_readCycles() {
+#ifdef ZYBO_BOARD
+  return mfcp(XREG_CP15_PERF_CYCLE_COUNTER);
+#else
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)now.tv_sec * 1000000000u + now.tv_nsec;
+#endif
+}
+
+// Records the counters at the start of a stage. The miss counters are read
+// before the cycle counter so that reading them is not counted as cycles.
+static inline void detectorProfile_start(detectorProfile_sample_t *sample) {
+#ifdef ZYBO_BOARD
+  sample->dataMisses =
+      detectorProfile_readEventCounter(DETECTOR_PROFILE_DATA_MISS_COUNTER);
+  sample->instructionMisses = detectorProfile_readEventCounter(
+      DETECTOR_PROFILE_INSTRUCTION_MISS_COUNTER);
+#else
+  sample->dataMisses = 0;
+  sample->instructionMisses = 0;
+#endif
+  sample->cycles = detectorProfile_readCycles();
+}
+
+// Adds one run of a stage to its statistics. cycles should already have the
+// measurement overhead removed.
+void detectorProfile_record(detectorProfile_stage_t stage, uint32_t cycles,
+                            uint32_t dataMisses, uint32_t instructionMisses);
+
+// Records the end of a stage that started at *sample.
+void detectorProfile_stop(const detectorProfile_sample_t *sample,
+                          detectorProfile_stage_t stage);
+
+#ifdef DETECTOR_PROFILE
+#define DETECTOR_PROFILE_START(sample)                                         \
+  detectorProfile_sample_t sample;                                             \
+  detectorProfile_start(&sample)
+#define DETECTOR_PROFILE_STOP(sample, stage)                                   \
+  detectorProfile_stop(&sample, stage)
+#else
+#define DETECTOR_PROFILE_START(sample)
+#define DETECTOR_PROFILE_STOP(sample, stage)
+#endif
+
+// Starts the PMU counters so that detectorProfile_readCycles() and
+// detectorProfile_start() count. Called by detectorProfile_init(); other
+// modules that only read the cycle counter can call it directly.
+void detectorProfile_startCounters();
+
+// Starts the PMU counters, measures the cost of a START/STOP pair (which is
+// subtracted from every measurement) and clears the statistics.
+void detectorProfile_init();
+
+// Clears the statistics.
+void detectorProfile_reset();
+
+// Fills in *stats for stage.
+void detectorProfile_getStats(detectorProfile_stage_t stage,
+                              detectorProfile_stats_t *stats);
+
+// Prints a table of the statistics of every stage that ran on the console and,
+// if onDisplay, on the TFT. The TFT holds 30 lines of the table; with many
+// frequencies the last rows are only printed on the console.
+void detectorProfile_printTable(bool onDisplay);
+
+// Checks the statistics against known data. Clears the statistics. Returns true
+// if the test passes.
+bool detectorProfile_runTest();
+
+#endif /* DETECTORPROFILE_H_ */
@@ -0,0 +1,201 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Event-driven scheduling of the detector. See detectorScheduler.h.
+
+#include <stdio.h>
+
+#include "detector.h"
+#include "detectorProfile.h"
+#include "detectorScheduler.h"
+#include "isr.h"
+#include "utils.h"
+
+// Blocks the detector has fully removed from the ADC buffer. Block
+// handledBlockCount therefore ended at handledBlockCount * ISR_ADC_BLOCK_SIZE
+// values added; all of the arithmetic below is modulo 2^32.
+static uint32_t handledBlockCount;
+
+static uint32_t invocationCount;
+static uint32_t processedBlockCount;
+static uint32_t latencyCount; // Calls that found a block waiting.
+static uint64_t latencySum;
+static uint32_t maxLatency;
+// Total and idle time, in cycles. Kept as running sums because the cycle
+// counter wraps every few seconds.
+static uint64_t totalCycles;
+static uint64_t idleCycles;
+static uint32_t lastCycles;
+
+// Adds the time since the last call to the total.
+static void detectorScheduler_updateTotal() {
+  uint32_t now = detectorProfile_readCycles();
+  totalCycles += now - lastCycles;
+  lastCycles = now;
+}
+
+// Starts the cycle counter and clears the statistics. Call after isr_init()
+// and before interrupts are enabled, while the ADC buffer is empty.
+void detectorScheduler_init() {
+  detectorProfile_startCounters();
+  handledBlockCount = isr_adcBufferBlockCount();
+  invocationCount = 0;
+  processedBlockCount = 0;
+  latencyCount = 0;
+  latencySum = 0;
+  maxLatency = 0;
+  totalCycles = 0;
+  idleCycles = 0;
+  lastCycles = detectorProfile_readCycles();
+}
+
+// Returns true if the ADC buffer holds a complete block that the detector has
+// not processed.
+bool detectorScheduler_blockReady() {
+  return isr_adcBufferBlockCount() != handledBlockCount;
+}
+
+// Waits for the next interrupt (WFI on the board) and counts the time as idle.
+// Only call with interrupts enabled.
+void detectorScheduler_sleep() {
+  detectorScheduler_updateTotal();
+  uint32_t start = lastCycles;
+#ifdef ZYBO_BOARD
+  __asm__ volatile("wfi" ::: "memory");
+#else
+  utils_sleep(); // The emulator wakes the thread on the next event.
+#endif
+  detectorScheduler_updateTotal();
+  idleCycles += lastCycles - start;
+}
+
+// Call just before the detector drains the ADC buffer. Records the latency of
+// the oldest waiting block, if there is one.
+static void detectorScheduler_startRun() {
+  detectorScheduler_updateTotal();
+  invocationCount++;
+  uint32_t blockCount = isr_adcBufferBlockCount();
+  // Read after the block count, so it includes every value of those blocks.
+  uint32_t addedCount = isr_adcBufferAddedCount();
+  if (blockCount == handledBlockCount)
+    return;
+  uint32_t oldestBlockEnd = (handledBlockCount + 1) * ISR_ADC_BLOCK_SIZE;
+  // In sample periods: each adds one value per channel.
+  uint32_t latency = (addedCount - oldestBlockEnd) / ISR_ADC_CHANNEL_COUNT;
+  latencyCount++;
+  latencySum += latency;
+  if (latency > maxLatency)
+    maxLatency = latency;
+}
+
+// Call after the detector drains the ADC buffer. Marks every block whose values
+// were all removed as handled and returns how many there were.
+static uint32_t detectorScheduler_finishRun() {
+  uint32_t removedCount = isr_adcBufferRemovedCount();
+  uint32_t blocks = (removedCount - handledBlockCount * ISR_ADC_BLOCK_SIZE) /
+                    ISR_ADC_BLOCK_SIZE;
+  handledBlockCount += blocks;
+  processedBlockCount += blocks;
+  return blocks;
+}
+
+// Runs detector() and records the latency of the oldest block it processes.
+// Returns the number of blocks processed.
+uint32_t detectorScheduler_runDetector(bool interruptsCurrentlyEnabled) {
+  detectorScheduler_startRun();
+  detector(interruptsCurrentlyEnabled);
+  return detectorScheduler_finishRun();
+}
+
+// Fills in *stats.
+void detectorScheduler_getStats(detectorScheduler_stats_t *stats) {
+  detectorScheduler_updateTotal();
+  stats->invocationCount = invocationCount;
+  stats->blockCount = processedBlockCount;
+  stats->meanLatencySamples =
+      latencyCount ? (double)latencySum / latencyCount : 0.0;
+  stats->maxLatencySamples = maxLatency;
+  stats->idlePercent = totalCycles ? 100.0 * idleCycles / totalCycles : 0.0;
+}
+
+#define TEST_BLOCK_COUNT 3   // Blocks added before the first run.
+// Values added after the last complete block: four sample periods.
+#define TEST_PARTIAL_COUNT (4 * ISR_ADC_CHANNEL_COUNT)
+#define TEST_VALUE_COUNT (TEST_BLOCK_COUNT * ISR_ADC_BLOCK_SIZE)
+// Checks the block bookkeeping by filling and draining the ADC buffer directly,
+// without running the detector. Returns true if the test passes. Call before
+// interrupts are enabled; leaves the ADC buffer empty.
+bool detectorScheduler_runTest() {
+  bool success = true; // Be optimistic.
+  isr_AdcValue_t values[TEST_VALUE_COUNT];
+  isr_initAdcBuffer();
+  detectorScheduler_init();
+  // A partial block is not ready.
+  for (uint32_t i = 0; i < ISR_ADC_BLOCK_SIZE - 1; i++)
+    isr_addDataToAdcBuffer(i);
+  if (detectorScheduler_blockReady()) {
+    printf("detectorScheduler_runTest: ready before a block was complete.\n");
+    success = false;
+  }
+  // Complete three blocks and start a fourth. The first block ended
+  // 2 * ISR_ADC_BLOCK_SIZE + TEST_PARTIAL_COUNT values ago.
+  while (isr_adcBufferAddedCount() < TEST_VALUE_COUNT + TEST_PARTIAL_COUNT)
+    isr_addDataToAdcBuffer(0);
+  if (!detectorScheduler_blockReady()) {
+    printf("detectorScheduler_runTest: not ready after a complete block.\n");
+    success = false;
+  }
+  // Drain everything, as detector() does.
+  detectorScheduler_startRun();
+  while (isr_removeDataFromAdcBufferBatch(values, TEST_VALUE_COUNT))
+    ;
+  uint32_t blocks = detectorScheduler_finishRun();
+  if (blocks != TEST_BLOCK_COUNT || detectorScheduler_blockReady()) {
+    printf("detectorScheduler_runTest: processed %lu blocks, should be %d.\n",
+           (unsigned long)blocks, TEST_BLOCK_COUNT);
+    success = false;
+  }
+  // Complete the fourth block, but only remove part of it.
+  while (isr_adcBufferAddedCount() < TEST_VALUE_COUNT + ISR_ADC_BLOCK_SIZE)
+    isr_addDataToAdcBuffer(0);
+  detectorScheduler_startRun();
+  isr_removeDataFromAdcBufferBatch(values, 1);
+  if (detectorScheduler_finishRun() != 0 || !detectorScheduler_blockReady()) {
+    printf("detectorScheduler_runTest: a partly removed block was handled.\n");
+    success = false;
+  }
+  // Finish it. It has been waiting since it was completed.
+  detectorScheduler_startRun();
+  while (isr_removeDataFromAdcBufferBatch(values, ISR_ADC_BLOCK_SIZE))
+    ;
+  if (detectorScheduler_finishRun() != 1 || detectorScheduler_blockReady()) {
+    printf("detectorScheduler_runTest: the fourth block was not handled.\n");
+    success = false;
+  }
+  detectorScheduler_stats_t stats;
+  detectorScheduler_getStats(&stats);
+  uint32_t firstLatency =
+      ((TEST_BLOCK_COUNT - 1) * ISR_ADC_BLOCK_SIZE + TEST_PARTIAL_COUNT) /
+      ISR_ADC_CHANNEL_COUNT;
+  if (stats.invocationCount != 3 || stats.blockCount != TEST_BLOCK_COUNT + 1 ||
+      stats.maxLatencySamples != firstLatency ||
+      stats.meanLatencySamples != firstLatency / 3.0) {
+    printf("detectorScheduler_runTest: %lu calls, %lu blocks, latency mean "
+           "%.2f max %lu; should be 3, %d, %.2f, %lu.\n",
+           (unsigned long)stats.invocationCount,
+           (unsigned long)stats.blockCount, stats.meanLatencySamples,
+           (unsigned long)stats.maxLatencySamples, TEST_BLOCK_COUNT + 1,
+           firstLatency / 3.0, (unsigned long)firstLatency);
+    success = false;
+  }
+  isr_initAdcBuffer();
+  detectorScheduler_init();
+  printf("detectorScheduler_runTest %s.\n", success ? "passed" : "failed");
+  return success;
+}
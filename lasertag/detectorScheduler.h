@@ -0,0 +1,80 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef DETECTORSCHEDULER_H_
+#define DETECTORSCHEDULER_H_
+
+// Runs the detector only when there is work for it. isr_function() adds a value
+// to the ADC buffer every 10 us and signals (isr_adcBufferBlockCount()) each
+// time a block of ISR_ADC_BLOCK_SIZE values, one FIR output's worth, is
+// complete. A main loop that uses this module looks like:
+//
+//   while (running) {
+//     if (detectorScheduler_blockReady())
+//       blocks += detectorScheduler_runDetector(true);
+//     else
+//       detectorScheduler_sleep(); // Wait for the next interrupt.
+//     if (blocks >= blocksPerDisplayUpdate)
+//       ...; // Update the display; new blocks wait in the ADC buffer.
+//   }
+//
+// instead of calling detector() as often as possible, which mostly finds less
+// than a block in the ADC buffer and returns. The running modes use it when
+// built with DETECTOR_SCHEDULER (cmake -DDETECTOR_SCHEDULER=1);
+// tools/detectorSchedulerTest runs detectorScheduler_runTest() on the host.
+//
+// The module counts detector() calls and processed blocks, the latency from a
+// block being complete to the start of the detector() call that processes it,
+// and the time spent asleep. Latency is counted in ADC sample periods, the time
+// base of the ISR: block k (counting from 1) is complete when
+// isr_adcBufferAddedCount() reaches k * ISR_ADC_BLOCK_SIZE, and each period
+// adds ISR_ADC_CHANNEL_COUNT values. Idle time is measured with the cycle
+// counter (see detectorProfile.h) and includes the ISR that ends each sleep.
+//
+// The interrupt that completes a block can arrive between
+// detectorScheduler_blockReady() and detectorScheduler_sleep(). The loop then
+// sleeps until the next timer interrupt, which adds one sample of latency.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+  uint32_t invocationCount; // Calls to detector().
+  uint32_t blockCount;      // Blocks processed.
+  // Latency of the oldest block processed by each detector() call, in samples.
+  double meanLatencySamples;
+  uint32_t maxLatencySamples;
+  double idlePercent; // Time spent in detectorScheduler_sleep().
+} detectorScheduler_stats_t;
+
+// Starts the cycle counter and clears the statistics. Call after isr_init()
+// and before interrupts are enabled, while the ADC buffer is empty.
+void detectorScheduler_init();
+
+// Returns true if the ADC buffer holds a complete block that the detector has
+// not processed.
+bool detectorScheduler_blockReady();
+
+// Waits for the next interrupt (WFI on the board) and counts the time as idle.
+// Only call with interrupts enabled.
+void detectorScheduler_sleep();
+
+// Runs detector() and records the latency of the oldest block it processes.
+// Returns the number of blocks processed.
+uint32_t detectorScheduler_runDetector(bool interruptsCurrentlyEnabled);
+
+// Fills in *stats.
+void detectorScheduler_getStats(detectorScheduler_stats_t *stats);
+
+// Checks the block bookkeeping by filling and draining the ADC buffer directly,
+// without running the detector. Returns true if the test passes. Call before
+// interrupts are enabled; leaves the ADC buffer empty.
+bool detectorScheduler_runTest();
+
+#endif /* DETECTORSCHEDULER_H_ */
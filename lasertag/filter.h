@@ -10,12 +10,27 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #ifndef FILTER_H_
 #define FILTER_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "queue.h"
 
 #define FILTER_SAMPLE_FREQUENCY_IN_KHZ 100
-#define FILTER_FREQUENCY_COUNT 10
+// The number of user frequencies, and so of players, is set at compile time
+// with cmake -DFILTER_FREQUENCY_COUNT=n. The IIR filter bank, the power values,
+// hit counting and the histogram are all sized by it. The build fails if the
+// filters for n frequencies miss the specification in filterDesign.h; up to 33
+// meet it.
+#define FILTER_DEFAULT_FREQUENCY_COUNT 10
+#ifndef FILTER_FREQUENCY_COUNT
+#define FILTER_FREQUENCY_COUNT FILTER_DEFAULT_FREQUENCY_COUNT
+#endif
+// The number of input channels (sensors), each filtered separately, is set
+// with cmake -DFILTER_CHANNEL_COUNT=n. Only filterFixedPoint.c supports more
+// than one (see filter_selectChannel() in filterFixedPoint.h).
+#ifndef FILTER_CHANNEL_COUNT
+#define FILTER_CHANNEL_COUNT 1
+#endif
 #define FILTER_FIR_DECIMATION_FACTOR                                           \
   10 // FIR-filter needs this many new inputs to compute a new output.
 #define FILTER_INPUT_PULSE_WIDTH                                               \
@@ -25,16 +40,26 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 // Not used in filter.h but are used to TEST the filter code.
 // Placed here for general access as they are essentially constant throughout
 // the code. The transmitter will also use these.
+// The default count keeps the lab's frequencies. For any other count the tick
+// counts are generated from the count at build time, with the filter
+// coefficients, into the generated filterCoefficients.c (see
+// filterDesign_frequencyTicks() in filterDesign.h). A transmitter sends an odd
+// tick count as tickCount / 2 ticks high and the rest low.
+#if FILTER_FREQUENCY_COUNT == FILTER_DEFAULT_FREQUENCY_COUNT
 static const uint16_t filter_frequencyTickTable[FILTER_FREQUENCY_COUNT] = {
     68, 58, 50, 44, 38, 34, 30, 28, 26, 24};
+#else
+extern const uint16_t filter_frequencyTickTable[FILTER_FREQUENCY_COUNT];
+#endif
 
 // Filtering routines for the laser-tag project.
 // Filtering is performed by a two-stage filter, as described below.
 
 // 1. First filter is a decimating FIR filter with a configurable number of taps
 // and decimation factor.
-// 2. The output from the decimating FIR filter is passed through a bank of 10
-// IIR filters. The characteristics of the IIR filter are fixed.
+// 2. The output from the decimating FIR filter is passed through a bank of
+// FILTER_FREQUENCY_COUNT IIR filters. The characteristics of the IIR filter are
+// fixed.
 
 /*******************************************************************************
 ***** Main Filter Functions
@@ -56,10 +81,26 @@ void filter_fillQueue(queue_t *q, double fillValue);
 // Output is returned and is also pushed on to yQueue.
 double filter_firFilter();
 
+// Decimating FIR-filter for a block of inputs. Adds the n values in in[] to
+// xQueue and computes an output only for every FILTER_FIR_DECIMATION_FACTOR'th
+// input; the skipped outputs are never computed. Outputs are written to out[]
+// and pushed onto yQueue. Inputs left over at the end of a block count toward
+// the next output, so out[] needs room for
+// n / FILTER_FIR_DECIMATION_FACTOR + 1 values. Returns the number of outputs.
+// filterFixedPoint.c and filterSlidingDft.c implement it; filter.c need not.
+size_t filter_firFilterBlock(const double *in, size_t n, double *out);
+
 // Use this to invoke a single iir filter. Input comes from yQueue.
 // Output is returned and is also pushed onto zQueue[filterNumber].
 double filter_iirFilter(uint16_t filterNumber);
 
+// Runs all FILTER_FREQUENCY_COUNT IIR filters on the newest value in yQueue in
+// a single pass. Same result as calling filter_iirFilter() for each filter
+// number. Outputs are written to outputs[filterNumber]; pass NULL if they are
+// not needed. filterFixedPoint.c and filterSlidingDft.c implement it; filter.c
+// need not.
+void filter_iirFilterAll(double outputs[]);
+
 // Use this to compute the power for values contained in an outputQueue.
 // If force == true, then recompute power by using all values in the
 // outputQueue. This option is necessary so that you can correctly compute power
@@ -73,6 +114,11 @@ double filter_iirFilter(uint16_t filterNumber);
 // 4. Compute new power as: prev-power - (oldest-value * oldest-value) +
 // (newest-value * newest-value). Note that this function will probably need an
 // array to keep track of these values for each of the 10 output queues.
+// In double precision this update slowly drifts. filterPower.h provides it
+// with compensated sums and periodic rebasing for filter.c to call (the
+// fixed-point filter keeps exact integer sums instead), so
+// forceComputeFromScratch is only needed after an output queue has been
+// modified from outside. tools/filterPowerTest checks it.
 double filter_computePower(uint16_t filterNumber, bool forceComputeFromScratch,
                            bool debugPrint);
 
@@ -109,7 +155,9 @@ const double *filter_getFirCoefficientArray();
 // Returns the number of FIR coefficients.
 uint32_t filter_getFirCoefficientCount();
 
-// Returns the array of coefficients for a particular filter number.
+// Returns the array of coefficients for a particular filter number. The IIR
+// getters return NULL (counts 0) in implementations without IIR filters, such
+// as filterSlidingDft.c.
 const double *filter_getIirACoefficientArray(uint16_t filterNumber);
 
 // Returns the number of A coefficients.
@@ -136,7 +184,8 @@ queue_t *filter_getYQueue();
 // Returns the address of zQueue for a specific filter number.
 queue_t *filter_getZQueue(uint16_t filterNumber);
 
-// Returns the address of the IIR output-queue for a specific filter-number.
+// Returns the address of the IIR output-queue for a specific filter-number, or
+// NULL without IIR filters.
 queue_t *filter_getIirOutputQueue(uint16_t filterNumber);
 
 #endif /* FILTER_H_ */
\ No newline at end of file
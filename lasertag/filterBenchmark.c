@@ -0,0 +1,184 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Filter-bank cost per input sample. See filterBenchmark.h.
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "detectorHit.h"
+#include "detectorProfile.h"
+#include "filter.h"
+#include "filterBenchmark.h"
+#include "filterFixedPoint.h" // filter_selectChannel()
+
+#ifdef ZYBO_BOARD
+#include "xparameters.h"
+#define BENCHMARK_UNITS "cycles"
+#define BENCHMARK_UNITS_PER_SECOND XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ
+#define BENCHMARK_HOST_NOTE ""
+#else
+#define BENCHMARK_UNITS "ns"
+#define BENCHMARK_UNITS_PER_SECOND 1000000000.0
+// Host times say nothing about whether the board keeps up.
+#define BENCHMARK_HOST_NOTE " (host timing, not the board)"
+#endif
+
+#define SAMPLE_FREQUENCY_HZ (FILTER_SAMPLE_FREQUENCY_IN_KHZ * 1000)
+#define TONE_FREQUENCY_NUMBER 0
+#define TONE_AMPLITUDE 0.5
+#define NOISE_AMPLITUDE 0.1
+#define FUDGE_FACTOR 1000.0
+#define CALIBRATION_COUNT 64 // Empty timings used to measure the overhead.
+
+// Stages timed separately.
+typedef enum {
+  STAGE_FIR,
+  STAGE_IIR,
+  STAGE_POWER,
+  STAGE_HIT,
+  STAGE_COUNT
+} filterBenchmark_stage_t;
+
+// Returns a uniform random value in [-1, 1). A small LCG, so that runs on the
+// board and the host filter the same input.
+static double filterBenchmark_noise(uint32_t *state) {
+  *state = *state * 1664525u + 1013904223u;
+  return (double)(*state >> 8) / (1u << 23) - 1.0;
+}
+
+// Selects the filter state of channel c.
+static inline void filterBenchmark_selectChannel(uint16_t c) {
+#if FILTER_CHANNEL_COUNT > 1
+  filter_selectChannel(c);
+#else
+  (void)c;
+#endif
+}
+
+// Returns the smallest time measured by an empty pair of cycle-counter reads.
+static uint32_t filterBenchmark_overhead() {
+  uint32_t overhead = UINT32_MAX;
+  for (uint16_t i = 0; i < CALIBRATION_COUNT; i++) {
+    uint32_t start = detectorProfile_readCycles();
+    uint32_t elapsed = detectorProfile_readCycles() - start;
+    if (elapsed < overhead)
+      overhead = elapsed;
+  }
+  return overhead;
+}
+
+// Calls filter_init(), filters outputCount decimated samples' worth of input
+// and fills in *result. Leaves the filters in an arbitrary state.
+void filterBenchmark_run(uint32_t outputCount,
+                         filterBenchmark_result_t *result) {
+#ifdef ZYBO_BOARD
+  detectorProfile_startCounters();
+#endif
+  filter_init();
+  detectorHit_initTracker();
+  uint32_t overhead = filterBenchmark_overhead();
+  uint64_t stageTotal[STAGE_COUNT] = {0};
+  double input[FILTER_CHANNEL_COUNT][FILTER_FIR_DECIMATION_FACTOR];
+  double firOutput[2]; // Room for n / FILTER_FIR_DECIMATION_FACTOR + 1.
+  double powerValues[FILTER_CHANNEL_COUNT][FILTER_FREQUENCY_COUNT];
+  bool ignoredFrequencies[FILTER_FREQUENCY_COUNT] = {false};
+  uint16_t tickCount = filter_frequencyTickTable[TONE_FREQUENCY_NUMBER];
+  uint32_t noiseState = 1;
+  uint32_t sampleNumber = 0;
+  uint32_t hitCount = 0;
+  for (uint32_t output = 0; output < outputCount; output++) {
+    for (uint16_t i = 0; i < FILTER_FIR_DECIMATION_FACTOR; i++) {
+      bool high = (sampleNumber++ % tickCount) < tickCount / 2;
+      input[0][i] = (high ? TONE_AMPLITUDE : -TONE_AMPLITUDE) +
+                    NOISE_AMPLITUDE * filterBenchmark_noise(&noiseState);
+      for (uint16_t c = 1; c < FILTER_CHANNEL_COUNT; c++)
+        input[c][i] = NOISE_AMPLITUDE * filterBenchmark_noise(&noiseState);
+    }
+    uint32_t start = detectorProfile_readCycles();
+    for (uint16_t c = 0; c < FILTER_CHANNEL_COUNT; c++) {
+      filterBenchmark_selectChannel(c);
+      filter_firFilterBlock(input[c], FILTER_FIR_DECIMATION_FACTOR, firOutput);
+    }
+    uint32_t firDone = detectorProfile_readCycles();
+    for (uint16_t c = 0; c < FILTER_CHANNEL_COUNT; c++) {
+      filterBenchmark_selectChannel(c);
+      filter_iirFilterAll(NULL);
+    }
+    uint32_t iirDone = detectorProfile_readCycles();
+    for (uint16_t c = 0; c < FILTER_CHANNEL_COUNT; c++) {
+      filterBenchmark_selectChannel(c);
+      for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+        powerValues[c][n] = filter_computePower(n, false, false);
+    }
+    uint32_t powerDone = detectorProfile_readCycles();
+    uint16_t frequencyNumber;
+#if FILTER_CHANNEL_COUNT > 1
+    uint16_t channelNumber;
+    hitCount += detectorHit_detectFused(powerValues, FILTER_CHANNEL_COUNT,
+                                        ignoredFrequencies, FUDGE_FACTOR,
+                                        &frequencyNumber, &channelNumber);
+#else
+    detectorHit_setTrackedPowers(powerValues[0]);
+    hitCount += detectorHit_detectTracked(ignoredFrequencies, FUDGE_FACTOR,
+                                          &frequencyNumber);
+#endif
+    uint32_t hitDone = detectorProfile_readCycles();
+    stageTotal[STAGE_FIR] += firDone - start - overhead;
+    stageTotal[STAGE_IIR] += iirDone - firDone - overhead;
+    stageTotal[STAGE_POWER] += powerDone - iirDone - overhead;
+    stageTotal[STAGE_HIT] += hitDone - powerDone - overhead;
+  }
+  double samples = (double)outputCount * FILTER_FIR_DECIMATION_FACTOR;
+  result->frequencyCount = FILTER_FREQUENCY_COUNT;
+  result->channelCount = FILTER_CHANNEL_COUNT;
+  result->outputCount = outputCount;
+  result->hitCount = hitCount;
+  result->firPerSample = stageTotal[STAGE_FIR] / samples;
+  result->iirPerSample = stageTotal[STAGE_IIR] / samples;
+  result->powerPerSample = stageTotal[STAGE_POWER] / samples;
+  result->hitPerSample = stageTotal[STAGE_HIT] / samples;
+  result->totalPerSample = result->firPerSample + result->iirPerSample +
+                           result->powerPerSample + result->hitPerSample;
+  result->budgetPerSample =
+      (double)BENCHMARK_UNITS_PER_SECOND / SAMPLE_FREQUENCY_HZ;
+  result->loadPercent =
+      100.0 * result->totalPerSample / result->budgetPerSample;
+  result->keepsUp = result->loadPercent <= FILTER_BENCHMARK_LOAD_PERCENT;
+  double perFrequency = (result->totalPerSample - result->firPerSample) /
+                        FILTER_FREQUENCY_COUNT;
+  double available =
+      result->budgetPerSample * FILTER_BENCHMARK_LOAD_PERCENT / 100.0 -
+      result->firPerSample;
+  result->maxFrequencyCount =
+      (available > 0.0 && perFrequency > 0.0) ? floor(available / perFrequency)
+                                              : 0;
+}
+
+// Prints *result on the console.
+void filterBenchmark_print(const filterBenchmark_result_t *result) {
+  printf("Filter bank, %d frequencies, %d channel%s (%s per sample period):\n",
+         result->frequencyCount, result->channelCount,
+         result->channelCount == 1 ? "" : "s", BENCHMARK_UNITS);
+  printf("  FIR %.1f, IIR %.1f, power %.1f, hit %.1f, total %.1f\n",
+         result->firPerSample, result->iirPerSample, result->powerPerSample,
+         result->hitPerSample, result->totalPerSample);
+  printf("  %.1f%% of the %.0f available at %d kHz\n", result->loadPercent,
+         result->budgetPerSample, FILTER_SAMPLE_FREQUENCY_IN_KHZ);
+  printf("  %s at %d kHz per channel within %d%% load%s\n",
+         result->keepsUp ? "Keeps up" : "Does NOT keep up",
+         FILTER_SAMPLE_FREQUENCY_IN_KHZ, FILTER_BENCHMARK_LOAD_PERCENT,
+         BENCHMARK_HOST_NOTE);
+  printf("  %lu of %lu decimated samples were hits\n",
+         (unsigned long)result->hitCount, (unsigned long)result->outputCount);
+  printf("  Estimated most frequencies within %d%% load: %lu%s\n",
+         FILTER_BENCHMARK_LOAD_PERCENT,
+         (unsigned long)result->maxFrequencyCount, BENCHMARK_HOST_NOTE);
+}
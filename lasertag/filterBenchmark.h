@@ -0,0 +1,78 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef FILTERBENCHMARK_H_
+#define FILTERBENCHMARK_H_
+
+// Measures what the filter bank and hit detection cost per 100 kHz input
+// sample at the compiled FILTER_FREQUENCY_COUNT, and estimates how many user
+// frequencies (players) the CPU could sustain. Build it at several counts
+// (cmake -DFILTER_FREQUENCY_COUNT=n) to see how the cost scales; the host tools
+// do this (see tools/README.md).
+//
+// Synthetic input (a tone on one user frequency in noise) goes through the same
+// calls that the detector makes for every decimated sample:
+// filter_firFilterBlock(), filter_iirFilterAll(), filter_computePower() for
+// every frequency and tracked hit detection. Each stage is timed with the cycle
+// counter (see detectorProfile.h), so on the board the costs are CPU cycles;
+// elsewhere they are nanoseconds. Taking values from the ADC buffer is not
+// included. Only a board build says whether the board keeps up:
+// filterBenchmark_print() marks the load verdict and the estimate as host
+// timing otherwise. Nothing in the board build calls filterBenchmark_run() yet,
+// and no board figures have been measured.
+//
+// The estimate assumes that the FIR filter costs the same at any count and that
+// the rest grows linearly with the count. Only FILTER_BENCHMARK_LOAD_PERCENT of
+// the time between samples is given to filtering; the rest is left for the ISR,
+// the display and the game.
+//
+// Built with FILTER_CHANNEL_COUNT above one (see filterFixedPoint.h), every
+// sample period brings one input per channel. Channel 0 gets the tone and the
+// others noise only; each stage runs for every channel in turn, selecting its
+// filter state, and the hit stage is the fused decision of
+// detectorHit_detectFused(). The costs are then per sample period, for all
+// channels together, so the load shows whether every channel keeps up at
+// FILTER_SAMPLE_FREQUENCY_IN_KHZ.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define FILTER_BENCHMARK_LOAD_PERCENT 50
+
+typedef struct {
+  uint16_t frequencyCount; // FILTER_FREQUENCY_COUNT.
+  uint16_t channelCount;   // FILTER_CHANNEL_COUNT.
+  uint32_t outputCount;    // Decimated samples filtered.
+  // Decimated samples with a hit on the tone. Also keeps the hit decisions
+  // from being optimized away.
+  uint32_t hitCount;
+  // Mean cost of each stage per input sample (per sample period, with more
+  // than one channel).
+  double firPerSample;
+  double iirPerSample;
+  double powerPerSample;
+  double hitPerSample;
+  double totalPerSample;
+  double budgetPerSample; // Time between input samples, in the same units.
+  double loadPercent;     // totalPerSample as a percentage of the budget.
+  // True if loadPercent is within FILTER_BENCHMARK_LOAD_PERCENT.
+  bool keepsUp;
+  // Largest frequency count that fits within FILTER_BENCHMARK_LOAD_PERCENT.
+  uint32_t maxFrequencyCount;
+} filterBenchmark_result_t;
+
+// Calls filter_init(), filters outputCount decimated samples' worth of input
+// and fills in *result. Leaves the filters in an arbitrary state.
+void filterBenchmark_run(uint32_t outputCount,
+                         filterBenchmark_result_t *result);
+
+// Prints *result on the console.
+void filterBenchmark_print(const filterBenchmark_result_t *result);
+
+#endif /* FILTERBENCHMARK_H_ */
@@ -0,0 +1,405 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Generated by tools/filterCoefficientGen.c for FILTER_FREQUENCY_COUNT 10.
+// Do not edit; see filterCoefficients.h and filterDesign.h.
+
+#include "filterCoefficients.h"
+
+#if FILTER_FREQUENCY_COUNT != 10
+#error "Generated for a different FILTER_FREQUENCY_COUNT."
+#endif
+
+const double filterCoefficients_fir[FILTER_FIR_COEFFICIENT_COUNT] = {
+    -0.00000000000000000000e+00, -2.05867321188749302467e-04,
+    -4.22843146180011187404e-04, -6.46890571633732978582e-04,
+    -8.64243456744098596280e-04, -1.04866576889474220381e-03,
+    -1.16165530685912832091e-03, -1.15617796154183528901e-03,
+    -9.83886009016222019136e-04, -6.05076846391512180104e-04,
+    0.00000000000000000000e+00, 8.20366259216355519016e-04,
+    1.80617524097742652295e-03, 2.86522152082531672904e-03,
+    3.86567792905117852548e-03, 4.64589553385037507677e-03,
+    5.03113433999088054127e-03, 4.85602149496013046903e-03,
+    3.99050809230909291070e-03, 2.36626898264438072575e-03,
+    -0.00000000000000000000e+00, -2.98998546772406186348e-03,
+    -6.37702614625564045969e-03, -9.83151286634024838829e-03,
+    -1.29393935461648307977e-02, -1.52332195221931178397e-02,
+    -1.62335639102205546436e-02, -1.54971716961218239361e-02,
+    -1.26670618263361352274e-02, -7.51915918227407872876e-03,
+    0.00000000000000000000e+00, 9.74933225379470518035e-03,
+    2.13866620468603045591e-02, 3.43814771972838148506e-02,
+    4.80468734108679962347e-02, 6.15884758535680254532e-02,
+    7.41661891139077378288e-02, 8.49630873204730574511e-02,
+    9.32548045542805487118e-02, 9.84725469959279592347e-02,
+    1.00253364822582125004e-01, 9.84725469959279592347e-02,
+    9.32548045542805487118e-02, 8.49630873204730574511e-02,
+    7.41661891139077378288e-02, 6.15884758535680323921e-02,
+    4.80468734108680031736e-02, 3.43814771972838148506e-02,
+    2.13866620468603114980e-02, 9.74933225379470691507e-03,
+    -0.00000000000000000000e+00, -7.51915918227408046348e-03,
+    -1.26670618263361369621e-02, -1.54971716961218222014e-02,
+    -1.62335639102205581130e-02, -1.52332195221931161050e-02,
+    -1.29393935461648360019e-02, -9.83151286634025359246e-03,
+    -6.37702614625564219442e-03, -2.98998546772406359820e-03,
+    0.00000000000000000000e+00, 2.36626898264438029207e-03,
+    3.99050809230909377806e-03, 4.85602149496012960167e-03,
+    5.03113433999088227599e-03, 4.64589553385037854621e-03,
+    3.86567792905117982652e-03, 2.86522152082531889744e-03,
+    1.80617524097742695663e-03, 8.20366259216355302175e-04,
+    -0.00000000000000000000e+00, -6.05076846391512071684e-04,
+    -9.83886009016222235976e-04, -1.15617796154183659005e-03,
+    -1.16165530685912875460e-03, -1.04866576889474307117e-03,
+    -8.64243456744098596280e-04, -6.46890571633732978582e-04,
+    -4.22843146180011458454e-04, -2.05867321188749302467e-04,
+    0.00000000000000000000e+00};
+
+const double filterCoefficients_cicCompensation
+    [FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT] = {
+        1.84509405489026684193e-03, -2.60159334804013209208e-02,
+        1.27661034579508975151e-01, -4.89602378714934116655e-01,
+        1.77226865855700621566e+00, -4.89602378714934116655e-01,
+        1.27661034579508975151e-01, -2.60159334804013209208e-02,
+        1.84509405489026684193e-03};
+
+const double filterCoefficients_iirA[FILTER_FREQUENCY_COUNT]
+                                    [FILTER_IIR_A_COEFFICIENT_COUNT] = {
+    {-5.96581679457801072886e+00, 1.91350936357477863226e+01,
+     -4.03669406881804633258e+01, 6.15800214139124904023e+01,
+     -7.00698390913041180283e+01, 6.03405121987242409887e+01,
+     -3.87582441188187942771e+01, 1.80027103285994058979e+01,
+     -5.49979053392765937502e+00, 9.03328285338000136484e-01},
+    {-4.63703672765712227033e+00, 1.34994036062158233591e+01,
+     -2.61490694350018415548e+01, 3.85789831867347885463e+01,
+     -4.30263963608026998031e+01, 3.78024575339821140574e+01,
+     -2.51069894196203158288e+01, 1.27005369795553715306e+01,
+     -4.27480956562754332850e+00, 9.03328285337999803417e-01},
+    {-3.05913179157509507178e+00, 8.64174896096375633192e+00,
+     -1.42787902538088520288e+01, 2.13022682833043184303e+01,
+     -2.21938539720792462617e+01, 2.08734997911054556141e+01,
+     -1.37097645206094043147e+01, 8.13035535779317442007e+00,
+     -2.82016438799005442206e+00, 9.03328285338000913640e-01},
+    {-1.40885405689509934923e+00, 5.69230559686226200711e+00,
+     -5.74485115782574418120e+00, 1.19637379292116428076e+01,
+     -8.55477569671534610052e+00, 1.17229402254261714234e+01,
+     -5.51591434465871444104e+00, 5.35545824356127297960e+00,
+     -1.29879989154868558110e+00, 9.03328285337999692395e-01},
+    {8.17499055587070588835e-01, 5.16566594713973614716e+00,
+     3.24738680865543871690e+00, 1.03878325399219697545e+01,
+     4.79431988006808218472e+00, 1.01787553588796004789e+01,
+     3.11797613133971163180e+00, 4.85998480540616473178e+00,
+     7.53639228663339766356e-01, 9.03328285337999581373e-01},
+    {2.70914276025616018728e+00, 7.83419493052866044991e+00,
+     1.22076045732165461288e+01, 1.86588964949877578192e+01,
+     1.87679726899337566692e+01, 1.82833352755451414851e+01,
+     1.17211189122897927462e+01, 7.37059187973657792270e+00,
+     2.49751513010875214604e+00, 9.03328285337999914439e-01},
+    {4.94977921483386218426e+00, 1.46987165119296783189e+01,
+     2.91000076346420328832e+01, 4.32077019260792027922e+01,
+     4.84735436172538527444e+01, 4.23380059353751150297e+01,
+     2.79403259937614265596e+01, 1.38288752828542520490e+01,
+     4.56312183362994439051e+00, 9.03328285337998804216e-01},
+    {6.17227372380248517914e+00, 2.01375167387536819774e+01,
+     4.30014150260298251283e+01, 6.60039720859575709255e+01,
+     7.52846188231625035314e+01, 6.46754136652856601586e+01,
+     4.12877278545401154020e+01, 1.89458106469938165617e+01,
+     5.69011985581439105886e+00, 9.03328285337999026261e-01},
+    {7.40992588675411756327e+00, 2.68617062662411356655e+01,
+     6.15896372122845363606e+01, 9.82775752833608180481e+01,
+     1.13617705444780966673e+02, 9.62993827050541568724e+01,
+     5.91351590478980568832e+01, 2.52720667611055276325e+01,
+     6.83109147537247363147e+00, 9.03328285337999359328e-01},
+    {8.57326908634063578063e+00, 3.42994752443658441621e+01,
+     8.40129409635226522823e+01, 1.39243303959436730111e+02,
+     1.63000383539884722950e+02, 1.36440509225274809069e+02,
+     8.06648298666612504348e+01, 3.22696731314889859732e+01,
+     7.90355885697393478750e+00, 9.03328285338000469551e-01}};
+
+const double filterCoefficients_iirB[FILTER_FREQUENCY_COUNT]
+                                    [FILTER_IIR_B_COEFFICIENT_COUNT] = {
+    {9.09286611481950899928e-10, 0.00000000000000000000e+00,
+     -4.54643305740975460304e-09, 0.00000000000000000000e+00,
+     9.09286611481950920608e-09, 0.00000000000000000000e+00,
+     -9.09286611481950920608e-09, 0.00000000000000000000e+00,
+     4.54643305740975460304e-09, 0.00000000000000000000e+00,
+     -9.09286611481950899928e-10},
+    {9.09286611481965272191e-10, 0.00000000000000000000e+00,
+     -4.54643305740982656775e-09, 0.00000000000000000000e+00,
+     9.09286611481965313550e-09, 0.00000000000000000000e+00,
+     -9.09286611481965313550e-09, 0.00000000000000000000e+00,
+     4.54643305740982656775e-09, 0.00000000000000000000e+00,
+     -9.09286611481965272191e-10},
+    {9.09286611481901269091e-10, 0.00000000000000000000e+00,
+     -4.54643305740950644885e-09, 0.00000000000000000000e+00,
+     9.09286611481901289771e-09, 0.00000000000000000000e+00,
+     -9.09286611481901289771e-09, 0.00000000000000000000e+00,
+     4.54643305740950644885e-09, 0.00000000000000000000e+00,
+     -9.09286611481901269091e-10},
+    {9.09286611481942421327e-10, 0.00000000000000000000e+00,
+     -4.54643305740971241683e-09, 0.00000000000000000000e+00,
+     9.09286611481942483365e-09, 0.00000000000000000000e+00,
+     -9.09286611481942483365e-09, 0.00000000000000000000e+00,
+     4.54643305740971241683e-09, 0.00000000000000000000e+00,
+     -9.09286611481942421327e-10},
+    {9.09286611481986158502e-10, 0.00000000000000000000e+00,
+     -4.54643305740993079251e-09, 0.00000000000000000000e+00,
+     9.09286611481986158502e-09, 0.00000000000000000000e+00,
+     -9.09286611481986158502e-09, 0.00000000000000000000e+00,
+     4.54643305740993079251e-09, 0.00000000000000000000e+00,
+     -9.09286611481986158502e-10},
+    {9.09286611481974577973e-10, 0.00000000000000000000e+00,
+     -4.54643305740987288987e-09, 0.00000000000000000000e+00,
+     9.09286611481974577973e-09, 0.00000000000000000000e+00,
+     -9.09286611481974577973e-09, 0.00000000000000000000e+00,
+     4.54643305740987288987e-09, 0.00000000000000000000e+00,
+     -9.09286611481974577973e-10},
+    {9.09286611481993809922e-10, 0.00000000000000000000e+00,
+     -4.54643305740996884282e-09, 0.00000000000000000000e+00,
+     9.09286611481993768563e-09, 0.00000000000000000000e+00,
+     -9.09286611481993768563e-09, 0.00000000000000000000e+00,
+     4.54643305740996884282e-09, 0.00000000000000000000e+00,
+     -9.09286611481993809922e-10},
+    {9.09286611481976025539e-10, 0.00000000000000000000e+00,
+     -4.54643305740988033449e-09, 0.00000000000000000000e+00,
+     9.09286611481976066898e-09, 0.00000000000000000000e+00,
+     -9.09286611481976066898e-09, 0.00000000000000000000e+00,
+     4.54643305740988033449e-09, 0.00000000000000000000e+00,
+     -9.09286611481976025539e-10},
+    {9.09286611481975922142e-10, 0.00000000000000000000e+00,
+     -4.54643305740987950731e-09, 0.00000000000000000000e+00,
+     9.09286611481975901462e-09, 0.00000000000000000000e+00,
+     -9.09286611481975901462e-09, 0.00000000000000000000e+00,
+     4.54643305740987950731e-09, 0.00000000000000000000e+00,
+     -9.09286611481975922142e-10},
+    {9.09286611481905508392e-10, 0.00000000000000000000e+00,
+     -4.54643305740952795555e-09, 0.00000000000000000000e+00,
+     9.09286611481905591110e-09, 0.00000000000000000000e+00,
+     -9.09286611481905591110e-09, 0.00000000000000000000e+00,
+     4.54643305740952795555e-09, 0.00000000000000000000e+00,
+     -9.09286611481905508392e-10}};
+
+const double
+    filterCoefficients_iirSos[FILTER_FREQUENCY_COUNT][FILTER_IIR_SECTION_COUNT]
+                             [FILTER_IIR_SECTION_COEFFICIENT_COUNT] = {
+    {{1.54663360286440756258e-02, 0.00000000000000000000e+00,
+      -1.54663360286440756258e-02, -1.18677463640854496951e+00,
+      9.69067417193793079200e-01},
+     {1.39511271009478271532e-02, 0.00000000000000000000e+00,
+      -1.39511271009478271532e-02, -1.17553452357921384142e+00,
+      9.74730157810967723364e-01},
+     {1.72463496519728032297e-02, 0.00000000000000000000e+00,
+      -1.72463496519728032297e-02, -1.20484861566960166357e+00,
+      9.75075853524814517570e-01},
+     {9.35232785014200942997e-03, 0.00000000000000000000e+00,
+      -9.35232785014200942997e-03, -1.17553631452282236758e+00,
+      9.90231737329224648292e-01},
+     {2.61268559007832024133e-02, 0.00000000000000000000e+00,
+      -2.61268559007832024133e-02, -1.22312270439782788678e+00,
+      9.90448665257240179471e-01}},
+    {{1.54663055536014715924e-02, 0.00000000000000000000e+00,
+      -1.54663055536014715924e-02, -9.22441597851247907514e-01,
+      9.69067417193793301244e-01},
+     {1.39228606006396617156e-02, 0.00000000000000000000e+00,
+      -1.39228606006396617156e-02, -9.08928643060323615543e-01,
+      9.74781655064682728273e-01},
+     {1.72813425282303742558e-02, 0.00000000000000000000e+00,
+      -1.72813425282303742558e-02, -9.41266296319017370386e-01,
+      9.75024340728734340011e-01},
+     {9.32167704843281375027e-03, 0.00000000000000000000e+00,
+      -9.32167704843281375027e-03, -9.05894534308266163869e-01,
+      9.90264051257949584617e-01},
+     {2.62128477353461807053e-02, 0.00000000000000000000e+00,
+      -2.62128477353461807053e-02, -9.58505656118267657106e-01,
+      9.90416345304258816107e-01}},
+    {{1.54663417653602263541e-02, 0.00000000000000000000e+00,
+      -1.54663417653602263541e-02, -6.08550370331839229898e-01,
+      9.69067417193793745334e-01},
+     {1.38966493894004863158e-02, 0.00000000000000000000e+00,
+      -1.38966493894004863158e-02, -5.92935766029583199987e-01,
+      9.74828628689338838598e-01},
+     {1.73139628436663091382e-02, 0.00000000000000000000e+00,
+      -1.73139628436663091382e-02, -6.27669222045726837855e-01,
+      9.74977357673391109572e-01},
+     {9.29285753371703222847e-03, 0.00000000000000000000e+00,
+      -9.29285753371703222847e-03, -5.86695567557319330732e-01,
+      9.90293528910322295999e-01},
+     {2.62940408312215961883e-02, 0.00000000000000000000e+00,
+      -2.62940408312215961883e-02, -6.43280865610626584328e-01,
+      9.90386863996062682958e-01}},
+    {{1.54663235307117112594e-02, 0.00000000000000000000e+00,
+      -1.54663235307117112594e-02, -2.80262086265197218893e-01,
+      9.69067417193792746133e-01},
+     {1.38737593496823172212e-02, 0.00000000000000000000e+00,
+      -1.38737593496823172212e-02, -2.63013651169664186558e-01,
+      9.74870084759987376444e-01},
+     {1.73425161697589036436e-02, 0.00000000000000000000e+00,
+      -1.73425161697589036436e-02, -2.99124369183776106507e-01,
+      9.74935897040992927032e-01},
+     {9.26794300318094579905e-03, 0.00000000000000000000e+00,
+      -9.26794300318094579905e-03, -2.53793190640148547121e-01,
+      9.90319545031724146611e-01},
+     {2.63647760325414030891e-02, 0.00000000000000000000e+00,
+      -2.63647760325414030891e-02, -3.12660759636313401177e-01,
+      9.90360846106162151514e-01}},
+    {{1.54664035658299437587e-02, 0.00000000000000000000e+00,
+      -1.54664035658299437587e-02, 1.62624361066605632731e-01,
+      9.69067417193792857155e-01},
+     {1.38660238090379042686e-02, 0.00000000000000000000e+00,
+      -1.38660238090379042686e-02, 1.44917010334372486913e-01,
+      9.74884026092165401067e-01},
+     {1.73522466643827102950e-02, 0.00000000000000000000e+00,
+      -1.73522466643827102950e-02, 1.81268160158939511950e-01,
+      9.74921954967033932427e-01},
+     {9.25957322149601261274e-03, 0.00000000000000000000e+00,
+      -9.25957322149601261274e-03, 1.34711844284339105071e-01,
+      9.90328294103361650436e-01},
+     {2.63883863526003514810e-02, 0.00000000000000000000e+00,
+      -2.63883863526003514810e-02, 1.93977679742813741148e-01,
+      9.90352096746943355576e-01}},
+    {{1.54662952600724632607e-02, 0.00000000000000000000e+00,
+      -1.54662952600724632607e-02, 5.38927363174126372591e-01,
+      9.69067417193793190222e-01},
+     {1.38917037000805196345e-02, 0.00000000000000000000e+00,
+      -1.38917037000805196345e-02, 5.22921072449041179908e-01,
+      9.74837873543402455567e-01},
+     {1.73200947298029345189e-02, 0.00000000000000000000e+00,
+      -1.73200947298029345189e-02, 5.58036987508935378166e-01,
+      9.74968111496532618965e-01},
+     {9.28771284074098556205e-03, 0.00000000000000000000e+00,
+      -9.28771284074098556205e-03, 5.16019053139652350559e-01,
+      9.90299330551507317466e-01},
+     {2.63087337465273650439e-02, 0.00000000000000000000e+00,
+      -2.63087337465273650439e-02, 5.73238283984404906057e-01,
+      9.90381061842064980283e-01}},
+    {{1.54663265354896377335e-02, 0.00000000000000000000e+00,
+      -1.54663265354896377335e-02, 9.84655183063251060460e-01,
+      9.69067417193792968177e-01},
+     {1.39289105454578412968e-02, 0.00000000000000000000e+00,
+      -1.39289105454578412968e-02, 9.71631009679328361273e-01,
+      9.74770856068051694265e-01},
+     {1.72738509564119395445e-02, 0.00000000000000000000e+00,
+      -1.72738509564119395445e-02, 1.00334934786418372710e+00,
+      9.75035142533593912617e-01},
+     {9.32793154091540385742e-03, 0.00000000000000000000e+00,
+      -9.32793154091540385742e-03, 9.69280421506710232471e-01,
+      9.90257274757375904883e-01},
+     {2.61952141992612234922e-02, 0.00000000000000000000e+00,
+      -2.61952141992612234922e-02, 1.02086325272038869194e+00,
+      9.90423122893379526133e-01}},
+    {{1.54663811525382628026e-02, 0.00000000000000000000e+00,
+      -1.54663811525382628026e-02, 1.22784492997456351482e+00,
+      9.69067417193793190222e-01},
+     {1.39564485067721691380e-02, 0.00000000000000000000e+00,
+      -1.39564485067721691380e-02, 1.21700858957654589609e+00,
+      9.74720473763412309509e-01},
+     {1.72398049379884552024e-02, 0.00000000000000000000e+00,
+      -1.72398049379884552024e-02, 1.24575163402284405656e+00,
+      9.75085541103140385211e-01},
+     {9.35800187764456066486e-03, 0.00000000000000000000e+00,
+      -9.35800187764456066486e-03, 1.21751629851944564997e+00,
+      9.90225661095695208758e-01},
+     {2.61108911681590498410e-02, 0.00000000000000000000e+00,
+      -2.61108911681590498410e-02, 1.26415227170908628374e+00,
+      9.90454742859169123825e-01}},
+    {{1.54664831133193274998e-02, 0.00000000000000000000e+00,
+      -1.54664831133193274998e-02, 1.47404997553045280512e+00,
+      9.69067417193792968177e-01},
+     {1.39984092085783367460e-02, 0.00000000000000000000e+00,
+      -1.39984092085783367460e-02, 1.46600770857563977856e+00,
+      9.74644634568624712578e-01},
+     {1.71881980783315235772e-02, 0.00000000000000000000e+00,
+      -1.71881980783315235772e-02, 1.49058034152060492339e+00,
+      9.75161414605813403611e-01},
+     {9.40356912087782041698e-03, 0.00000000000000000000e+00,
+      -9.40356912087782041698e-03, 1.46980563782267004136e+00,
+      9.90178081745316185369e-01},
+     {2.59840874267639604378e-02, 0.00000000000000000000e+00,
+      -2.59840874267639604378e-02, 1.50948222330474979280e+00,
+      9.90502335503476660783e-01}},
+    {{1.54662919839139868100e-02, 0.00000000000000000000e+00,
+      -1.54662919839139868100e-02, 1.70547280500158526806e+00,
+      9.69067417193793523289e-01},
+     {1.40753969067388094716e-02, 0.00000000000000000000e+00,
+      -1.40753969067388094716e-02, 1.70092153217319874692e+00,
+      9.74506470464224450190e-01},
+     {1.70940538401103542254e-02, 0.00000000000000000000e+00,
+      -1.70940538401103542254e-02, 1.71984479104271104077e+00,
+      9.75299671567238513070e-01},
+     {9.48688704765275961361e-03, 0.00000000000000000000e+00,
+      -9.48688704765275961361e-03, 1.70843279836305428354e+00,
+      9.90091438776747434503e-01},
+     {2.57563989917909096083e-02, 0.00000000000000000000e+00,
+      -2.57563989917909096083e-02, 1.73859715976008577520e+00,
+      9.90589014429645642323e-01}}};
+
+const int32_t filterCoefficients_firFixed[FILTER_FIR_COEFFICIENT_COUNT] = {
+    0, -442097, -908049, -1389187, -1855949, -2251993, -2494636, -2482873,
+    -2112879, -1299393, 0, 1761723, 3878732, 6153016, 8301480, 9976985,
+    10804279, 10428227, 8569551, 5081524, 0, -6420945, -13694559, -21113013,
+    -27787136, -32713090, -34861313, -33279923, -27202308, -16147271, 0,
+    20936532, 45927507, 73833660, 103179875, 132260245, 159270678, 182456841,
+    200263168, 211468184, 215292462, 211468184, 200263168, 182456841, 159270678,
+    132260245, 103179875, 73833660, 45927507, 20936532, 0, -16147271, -27202308,
+    -33279923, -34861313, -32713090, -27787136, -21113013, -13694559, -6420945,
+    0, 5081524, 8569551, 10428227, 10804279, 9976985, 8301480, 6153016, 3878732,
+    1761723, 0, -1299393, -2112879, -2482873, -2494636, -2251993, -1855949,
+    -1389187, -908049, -442097, 0};
+
+const int32_t
+    filterCoefficients_iirSosFixed[FILTER_IIR_SECTION_COUNT]
+                                  [FILTER_IIR_SECTION_COEFFICIENT_COUNT]
+                                  [FILTER_FREQUENCY_COUNT] = {
+    {{8303426, 8303410, 8303429, 8303419, 8303462, 8303404, 8303421, 8303450,
+      8303505, 8303402},
+     {0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+     {-8303426, -8303410, -8303429, -8303419, -8303462, -8303404, -8303421,
+      -8303450, -8303505, -8303402},
+     {-637144781, -495232062, -326712992, -150464562, 87308289, 289334425,
+      528632726, 659194227, 791374555, 915618740},
+     {520264108, 520264108, 520264108, 520264108, 520264108, 520264108,
+      520264108, 520264108, 520264108, 520264108}},
+    {{7489954, 7474779, 7460707, 7448418, 7444265, 7458052, 7478027, 7492811,
+      7515339, 7556671},
+     {0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+     {-7489954, -7474779, -7460707, -7448418, -7444265, -7458052, -7478027,
+      -7492811, -7515339, -7556671},
+     {-631110292, -487977350, -318329965, -141204379, 77801728, 280741113,
+      521640426, 653376511, 787056896, 913175294},
+     {523304269, 523331916, 523357135, 523379391, 523386876, 523362098,
+      523326118, 523299070, 523258354, 523184178}},
+    {{9259063, 9277850, 9295363, 9310692, 9315916, 9298655, 9273828, 9255550,
+      9227844, 9177300},
+     {0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+     {-9259063, -9277850, -9295363, -9310692, -9315916, -9298655, -9273828,
+      -9255550, -9227844, -9177300},
+     {-646848175, -505338495, -336977348, -160591173, 97317602, 299593826,
+      538669079, 668807816, 800249227, 923334641},
+     {523489863, 523462207, 523436983, 523414724, 523407239, 523432019,
+      523468006, 523495064, 523535798, 523610024}},
+    {{5020993, 5004537, 4989065, 4975689, 4971196, 4986303, 5007895, 5024039,
+      5048503, 5093234},
+     {0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+     {-5020993, -5004537, -4989065, -4975689, -4971196, -4986303, -5007895,
+      -5024039, -5048503, -5093234},
+     {-631111253, -486348425, -314979784, -136254182, 72322871, 277035620,
+      520378464, 653649086, 789095893, 917207875},
+     {531626616, 531643964, 531659790, 531673757, 531678454, 531662905,
+      531640326, 531623354, 531597810, 531551294}},
+    {{14026749, 14072915, 14116506, 14154481, 14167157, 14124394, 14063449,
+      14018178, 13950101, 13827861},
+     {0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+     {-14026749, -14072915, -14116506, -14154481, -14167157, -14124394,
+      -14063449, -14018178, -13950101, -13827861},
+     {-656659002, -514593806, -345358785, -167858467, 104140974, 307754960,
+      548071786, 678686583, 810397098, 933402243},
+     {531743078, 531725727, 531709899, 531695931, 531691233, 531706784,
+      531729365, 531746341, 531771892, 531818428}}};
+
+const int32_t filterCoefficients_cicCompensationFixed
+    [FILTER_CIC_COMPENSATION_HALF_COUNT] = {
+        1622962, -22883857, 112291834, -430658807, 1558903998};
@@ -0,0 +1,94 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef FILTERCOEFFICIENTS_H_
+#define FILTERCOEFFICIENTS_H_
+
+#include <stdint.h>
+
+#include "filter.h" // FILTER_FREQUENCY_COUNT
+
+// Coefficient tables shared by the filter implementations.
+// The FIR filter is an 81-tap Hamming-windowed low-pass filter with a 5 kHz
+// cutoff at the 100 kHz input rate. Each IIR filter is a 10th-order
+// Butterworth band-pass filter, 50 Hz wide, centered on one of the user
+// frequencies at the decimated 10 kHz rate.
+// The optional CIC front end (FILTER_CIC, see filterFixedPoint.h) replaces the
+// FIR filter with a FILTER_CIC_STAGE_COUNT-stage CIC decimator (decimation
+// FILTER_FIR_DECIMATION_FACTOR, differential delay 1) followed by a short
+// linear-phase compensation filter at 10 kHz. The compensation filter is a
+// least-squares fit, from 0 to 4.4 kHz, of the FIR response divided by the CIC
+// response, so the cascade matches the FIR filter to within 0.01 dB at every
+// user frequency.
+// filterCoefficients.c is generated by tools/filterCoefficientGen.c from
+// filter_frequencyTickTable (see filterDesign.h); do not edit it by hand. The
+// committed file is for the default FILTER_FREQUENCY_COUNT. Builds with any
+// other count compile a file generated for that count instead, which also
+// defines filter_frequencyTickTable, and the build fails if any filter misses
+// the specification in filterDesign.h.
+
+#define FILTER_FIR_COEFFICIENT_COUNT 81
+#define FILTER_IIR_A_COEFFICIENT_COUNT                                         \
+  10 // The leading 1 is not stored in the A-coefficient arrays.
+#define FILTER_IIR_B_COEFFICIENT_COUNT 11
+#define FILTER_IIR_SECTION_COUNT                                               \
+  5 // Each IIR filter factors into this many second-order sections.
+#define FILTER_IIR_SECTION_COEFFICIENT_COUNT                                   \
+  5 // Stored as b0, b1, b2, a1, a2 (a0 is always 1).
+#define FILTER_CIC_STAGE_COUNT 4
+#define FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT 9
+// The compensation filter is symmetric; the fixed-point table only stores the
+// first half, including the center tap.
+#define FILTER_CIC_COMPENSATION_HALF_COUNT                                     \
+  ((FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT + 1) / 2)
+
+// Indices into a single second-order section.
+#define FILTER_IIR_SECTION_B0 0
+#define FILTER_IIR_SECTION_B1 1
+#define FILTER_IIR_SECTION_B2 2
+#define FILTER_IIR_SECTION_A1 3
+#define FILTER_IIR_SECTION_A2 4
+
+// Decimating FIR-filter coefficients.
+extern const double filterCoefficients_fir[FILTER_FIR_COEFFICIENT_COUNT];
+
+// CIC compensation-filter coefficients (symmetric). The CIC gain is not
+// included; divide the CIC output by its DC gain before filtering.
+extern const double filterCoefficients_cicCompensation
+    [FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT];
+
+// Direct-form IIR coefficients, one row per user frequency.
+extern const double filterCoefficients_iirA[FILTER_FREQUENCY_COUNT]
+                                           [FILTER_IIR_A_COEFFICIENT_COUNT];
+extern const double filterCoefficients_iirB[FILTER_FREQUENCY_COUNT]
+                                           [FILTER_IIR_B_COEFFICIENT_COUNT];
+
+// The same IIR filters factored into cascaded second-order sections. Each
+// section is scaled so that the peak gain from the filter input to the output
+// of that section is 1.0. This keeps every intermediate value in range when the
+// filters are computed with fixed-point arithmetic.
+extern const double
+    filterCoefficients_iirSos[FILTER_FREQUENCY_COUNT][FILTER_IIR_SECTION_COUNT]
+                             [FILTER_IIR_SECTION_COEFFICIENT_COUNT];
+
+// The tables above in the fixed-point formats of filterFixedPoint.h, laid out
+// the way its kernels read them, so filter_init() has nothing to convert.
+// FIR coefficients (Q31), reversed so the oldest input lines up with index 0.
+extern const int32_t filterCoefficients_firFixed[FILTER_FIR_COEFFICIENT_COUNT];
+// Second-order sections (Q29), structure-of-arrays with the filter number last,
+// so that adjacent filters share a vector load in filter_iirFilterAll().
+extern const int32_t
+    filterCoefficients_iirSosFixed[FILTER_IIR_SECTION_COUNT]
+                                  [FILTER_IIR_SECTION_COEFFICIENT_COUNT]
+                                  [FILTER_FREQUENCY_COUNT];
+// First half of the compensation filter (Q43), divided by the CIC gain.
+extern const int32_t
+    filterCoefficients_cicCompensationFixed[FILTER_CIC_COMPENSATION_HALF_COUNT];
+
+#endif /* FILTERCOEFFICIENTS_H_ */
@@ -0,0 +1,443 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Filter design and specification checks for the filter bank. See
+// filterDesign.h.
+
+#include <complex.h>
+#include <math.h>
+#include <stdio.h>
+
+#include "filterDesign.h"
+
+#define INPUT_SAMPLE_FREQUENCY_HZ (FILTER_SAMPLE_FREQUENCY_IN_KHZ * 1000.0)
+#define PROTOTYPE_ORDER FILTER_IIR_SECTION_COUNT // One section per pole pair.
+// The section peaks lie well inside this distance from the center frequency,
+// so the peak search only visits the grid points within it.
+#define PEAK_SEARCH_HALF_WIDTH_HZ (4 * FILTER_DESIGN_IIR_BANDWIDTH_HZ)
+#define FIR_STOPBAND_STEP_HZ 10.0
+// The compensation filter is symmetric; the fit solves for its center tap and
+// the taps on one side.
+#define CIC_UNKNOWN_COUNT ((FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT + 1) / 2)
+
+#if FILTER_FREQUENCY_COUNT != FILTER_DEFAULT_FREQUENCY_COUNT
+// Writes the tick counts from FILTER_DESIGN_MIN_TICK_COUNT up, each the first
+// that is at least gap Hz below the one before, highest frequency first.
+// Returns how many fit, at most FILTER_FREQUENCY_COUNT.
+static uint16_t
+filterDesign_spreadTicks(double gap, uint16_t ticks[FILTER_FREQUENCY_COUNT]) {
+  uint16_t count = 0;
+  ticks[count++] = FILTER_DESIGN_MIN_TICK_COUNT;
+  for (uint16_t t = FILTER_DESIGN_MIN_TICK_COUNT + 1;
+       t <= FILTER_DESIGN_MAX_TICK_COUNT && count < FILTER_FREQUENCY_COUNT;
+       t++)
+    if (INPUT_SAMPLE_FREQUENCY_HZ / ticks[count - 1] -
+            INPUT_SAMPLE_FREQUENCY_HZ / t >=
+        gap)
+      ticks[count++] = t;
+  return count;
+}
+#endif
+
+// Writes the tick counts of the user frequencies, lowest frequency first.
+void filterDesign_frequencyTicks(uint16_t ticks[FILTER_FREQUENCY_COUNT]) {
+#if FILTER_FREQUENCY_COUNT == FILTER_DEFAULT_FREQUENCY_COUNT
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+    ticks[n] = filter_frequencyTickTable[n];
+#else
+  // The largest gap that fits is the distance between two tick counts.
+  uint16_t spread[FILTER_FREQUENCY_COUNT];
+  double bestGap = 0.0;
+  for (uint16_t a = FILTER_DESIGN_MIN_TICK_COUNT;
+       a <= FILTER_DESIGN_MAX_TICK_COUNT; a++)
+    for (uint16_t b = a + 1; b <= FILTER_DESIGN_MAX_TICK_COUNT; b++) {
+      double gap =
+          INPUT_SAMPLE_FREQUENCY_HZ / a - INPUT_SAMPLE_FREQUENCY_HZ / b;
+      if (gap > bestGap &&
+          filterDesign_spreadTicks(gap, spread) == FILTER_FREQUENCY_COUNT)
+        bestGap = gap;
+    }
+  filterDesign_spreadTicks(bestGap, spread);
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+    ticks[n] = spread[FILTER_FREQUENCY_COUNT - 1 - n];
+#endif
+}
+
+// Returns user frequency frequencyNumber in Hz.
+double filterDesign_userFrequency(uint16_t frequencyNumber) {
+#if FILTER_FREQUENCY_COUNT == FILTER_DEFAULT_FREQUENCY_COUNT
+  uint16_t tickCount = filter_frequencyTickTable[frequencyNumber];
+#else
+  // filter_frequencyTickTable is generated from these, so filterCoefficientGen
+  // does not have it yet.
+  static uint16_t ticks[FILTER_FREQUENCY_COUNT];
+  if (ticks[0] == 0)
+    filterDesign_frequencyTicks(ticks);
+  uint16_t tickCount = ticks[frequencyNumber];
+#endif
+  return INPUT_SAMPLE_FREQUENCY_HZ / tickCount;
+}
+
+// Returns the response of one second-order section at w (radians per sample).
+static double complex filterDesign_sectionResponse(const double section[],
+                                                   double w) {
+  double complex z1 = cexp(-I * w); // z^-1
+  return (section[FILTER_IIR_SECTION_B0] + section[FILTER_IIR_SECTION_B1] * z1 +
+          section[FILTER_IIR_SECTION_B2] * z1 * z1) /
+         (1.0 + section[FILTER_IIR_SECTION_A1] * z1 +
+          section[FILTER_IIR_SECTION_A2] * z1 * z1);
+}
+
+// Returns the gain of the filter made of the given sections at frequency (Hz).
+double filterDesign_iirGain(
+    const double sos[FILTER_IIR_SECTION_COUNT]
+                    [FILTER_IIR_SECTION_COEFFICIENT_COUNT],
+    double frequency) {
+  double w = 2.0 * M_PI * frequency / FILTER_DESIGN_SAMPLE_FREQUENCY_HZ;
+  double gain = 1.0;
+  for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++)
+    gain *= cabs(filterDesign_sectionResponse(sos[s], w));
+  return gain;
+}
+
+// Finds the poles of the band-pass filter in the upper half of the z plane,
+// one per section, sorted by increasing radius. Returns the frequency, in
+// radians per sample, that the bilinear transform maps the analog center of the
+// band to.
+static double filterDesign_findPoles(double centerFrequency,
+                                     double complex poles[]) {
+  double fs = FILTER_DESIGN_SAMPLE_FREQUENCY_HZ;
+  double halfBand = FILTER_DESIGN_IIR_BANDWIDTH_HZ / 2;
+  // Prewarped band edges, in radians per second.
+  double low = 2.0 * fs * tan(M_PI * (centerFrequency - halfBand) / fs);
+  double high = 2.0 * fs * tan(M_PI * (centerFrequency + halfBand) / fs);
+  double center = sqrt(low * high);
+  double bandwidth = high - low;
+  uint16_t poleCount = 0;
+  for (uint16_t k = 0; k < PROTOTYPE_ORDER; k++) {
+    // Low-pass prototype pole, on the left half of the unit circle.
+    double complex p =
+        cexp(I * M_PI * (2 * k + PROTOTYPE_ORDER + 1) / (2 * PROTOTYPE_ORDER));
+    // Each prototype pole becomes two band-pass poles. The band is narrow, so
+    // they are a complex pair only together with the poles of conj(p); keep
+    // the one above the real axis.
+    double complex half = p * bandwidth / 2;
+    double complex root = csqrt(half * half - center * center);
+    double complex s[2] = {half + root, half - root};
+    for (uint16_t j = 0; j < 2; j++) {
+      double complex z = (2.0 * fs + s[j]) / (2.0 * fs - s[j]);
+      if (cimag(z) > 0 && poleCount < FILTER_IIR_SECTION_COUNT)
+        poles[poleCount++] = z;
+    }
+  }
+  // Insertion sort by radius.
+  for (uint16_t i = 1; i < poleCount; i++) {
+    double complex pole = poles[i];
+    uint16_t j = i;
+    for (; j > 0 && cabs(poles[j - 1]) > cabs(pole); j--)
+      poles[j] = poles[j - 1];
+    poles[j] = pole;
+  }
+  return 2.0 * atan(center / (2.0 * fs));
+}
+
+// Designs the band-pass filter centered on centerFrequency (Hz). Writes the
+// second-order sections to sos and the same filter in direct form to a (without
+// the leading 1) and b.
+void filterDesign_iirBandPass(
+    double centerFrequency,
+    double sos[FILTER_IIR_SECTION_COUNT][FILTER_IIR_SECTION_COEFFICIENT_COUNT],
+    double a[FILTER_IIR_A_COEFFICIENT_COUNT],
+    double b[FILTER_IIR_B_COEFFICIENT_COUNT]) {
+  double complex poles[FILTER_IIR_SECTION_COUNT];
+  double centerW = filterDesign_findPoles(centerFrequency, poles);
+  // Unscaled sections: 1 - z^-2 over the pole pair.
+  for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++) {
+    sos[s][FILTER_IIR_SECTION_B0] = 1.0;
+    sos[s][FILTER_IIR_SECTION_B1] = 0.0;
+    sos[s][FILTER_IIR_SECTION_B2] = -1.0;
+    sos[s][FILTER_IIR_SECTION_A1] = -2.0 * creal(poles[s]);
+    sos[s][FILTER_IIR_SECTION_A2] = creal(poles[s] * conj(poles[s]));
+  }
+  // Peak gain of each leading run of sections, from the input to the output of
+  // section s.
+  double peak[FILTER_IIR_SECTION_COUNT] = {0.0};
+  double gridStep = FILTER_DESIGN_SAMPLE_FREQUENCY_HZ / 2 /
+                    FILTER_DESIGN_PEAK_GRID_SIZE; // Hz
+  int32_t first =
+      floor((centerFrequency - PEAK_SEARCH_HALF_WIDTH_HZ) / gridStep);
+  int32_t last = ceil((centerFrequency + PEAK_SEARCH_HALF_WIDTH_HZ) / gridStep);
+  for (int32_t g = first; g <= last; g++) {
+    double w = M_PI * g / FILTER_DESIGN_PEAK_GRID_SIZE;
+    double gain = 1.0;
+    for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++) {
+      gain *= cabs(filterDesign_sectionResponse(sos[s], w));
+      if (gain > peak[s])
+        peak[s] = gain;
+    }
+  }
+  // The gain of a Butterworth band-pass filter is exactly 1.0 at the center of
+  // the band.
+  double totalGain = 1.0;
+  for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++)
+    totalGain /= cabs(filterDesign_sectionResponse(sos[s], centerW));
+  double scale = 1.0; // Product of the section gains so far.
+  for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++) {
+    double gain = (s == FILTER_IIR_SECTION_COUNT - 1) ? totalGain / scale
+                                                      : 1.0 / peak[s] / scale;
+    sos[s][FILTER_IIR_SECTION_B0] = gain;
+    sos[s][FILTER_IIR_SECTION_B2] = -gain;
+    scale *= gain;
+  }
+  // Direct form. The numerator is totalGain * (1 - z^-2)^5.
+  double binomial = 1.0;
+  for (uint16_t i = 0; i < FILTER_IIR_B_COEFFICIENT_COUNT; i++)
+    b[i] = 0.0;
+  for (uint16_t i = 0; i <= FILTER_IIR_SECTION_COUNT; i++) {
+    b[2 * i] = ((i % 2) ? -totalGain : totalGain) * binomial;
+    binomial = binomial * (FILTER_IIR_SECTION_COUNT - i) / (i + 1);
+  }
+  // The denominator is the product of the section denominators.
+  double polynomial[FILTER_IIR_A_COEFFICIENT_COUNT + 1] = {1.0};
+  for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++) {
+    double a1 = sos[s][FILTER_IIR_SECTION_A1];
+    double a2 = sos[s][FILTER_IIR_SECTION_A2];
+    for (int16_t i = 2 * s + 2; i > 1; i--)
+      polynomial[i] += a1 * polynomial[i - 1] + a2 * polynomial[i - 2];
+    polynomial[1] += a1;
+  }
+  for (uint16_t i = 0; i < FILTER_IIR_A_COEFFICIENT_COUNT; i++)
+    a[i] = polynomial[i + 1];
+}
+
+
+// Designs the decimating FIR filter.
+void filterDesign_fir(double fir[FILTER_FIR_COEFFICIENT_COUNT]) {
+  // Cutoff as a fraction of the Nyquist frequency.
+  double cutoff = 2.0 * FILTER_DESIGN_FIR_CUTOFF_HZ / INPUT_SAMPLE_FREQUENCY_HZ;
+  double middle = (FILTER_FIR_COEFFICIENT_COUNT - 1) / 2.0;
+  double sum = 0.0;
+  for (uint16_t i = 0; i < FILTER_FIR_COEFFICIENT_COUNT; i++) {
+    double x = cutoff * (i - middle);
+    // Take whole half-periods out of sin(pi x) first, so that the taps on the
+    // zeros of the sinc come out as exactly zero.
+    double halfPeriods = round(x);
+    double sine = sin(M_PI * (x - halfPeriods));
+    if (fmod(halfPeriods, 2.0) != 0.0)
+      sine = -sine;
+    double sinc = (x == 0.0) ? 1.0 : sine / (M_PI * x);
+    double window =
+        0.54 - 0.46 * cos(2.0 * M_PI * i / (FILTER_FIR_COEFFICIENT_COUNT - 1));
+    fir[i] = cutoff * sinc * window;
+    sum += fir[i];
+  }
+  for (uint16_t i = 0; i < FILTER_FIR_COEFFICIENT_COUNT; i++)
+    fir[i] /= sum;
+}
+
+// Returns the gain at frequency (Hz) of an FIR filter with count coefficients
+// running at sampleFrequency (Hz).
+double filterDesign_firGain(const double coefficients[], uint16_t count,
+                            double frequency, double sampleFrequency) {
+  double w = 2.0 * M_PI * frequency / sampleFrequency;
+  double complex response = 0.0;
+  for (uint16_t i = 0; i < count; i++)
+    response += coefficients[i] * cexp(-I * w * i);
+  return cabs(response);
+}
+
+// Returns the gain of the CIC decimator (FILTER_CIC_STAGE_COUNT stages,
+// decimation FILTER_FIR_DECIMATION_FACTOR) at frequency (Hz), relative to its
+// gain at DC.
+double filterDesign_cicGain(double frequency) {
+  double x = M_PI * frequency / INPUT_SAMPLE_FREQUENCY_HZ;
+  if (x == 0.0)
+    return 1.0;
+  double stage = sin(FILTER_FIR_DECIMATION_FACTOR * x) /
+                 (FILTER_FIR_DECIMATION_FACTOR * sin(x));
+  return pow(fabs(stage), FILTER_CIC_STAGE_COUNT);
+}
+
+// Solves the n x n system a * x = b in place by Gaussian elimination with
+// partial pivoting. Leaves the solution in b.
+static void filterDesign_solve(double a[CIC_UNKNOWN_COUNT][CIC_UNKNOWN_COUNT],
+                               double b[CIC_UNKNOWN_COUNT]) {
+  for (uint16_t col = 0; col < CIC_UNKNOWN_COUNT; col++) {
+    uint16_t pivot = col;
+    for (uint16_t row = col + 1; row < CIC_UNKNOWN_COUNT; row++)
+      if (fabs(a[row][col]) > fabs(a[pivot][col]))
+        pivot = row;
+    for (uint16_t k = 0; k < CIC_UNKNOWN_COUNT; k++) {
+      double swap = a[col][k];
+      a[col][k] = a[pivot][k];
+      a[pivot][k] = swap;
+    }
+    double swap = b[col];
+    b[col] = b[pivot];
+    b[pivot] = swap;
+    for (uint16_t row = 0; row < CIC_UNKNOWN_COUNT; row++) {
+      if (row == col)
+        continue;
+      double factor = a[row][col] / a[col][col];
+      for (uint16_t k = col; k < CIC_UNKNOWN_COUNT; k++)
+        a[row][k] -= factor * a[col][k];
+      b[row] -= factor * b[col];
+    }
+  }
+  for (uint16_t i = 0; i < CIC_UNKNOWN_COUNT; i++)
+    b[i] /= a[i][i];
+}
+
+// Designs the CIC compensation filter for the given FIR filter.
+void filterDesign_cicCompensation(
+    const double fir[FILTER_FIR_COEFFICIENT_COUNT],
+    double compensation[FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT]) {
+  // The response of a symmetric filter is c[0] + sum 2 c[k] cos(w k), where
+  // c[k] is k taps from the center. Build the normal equations for c.
+  double a[CIC_UNKNOWN_COUNT][CIC_UNKNOWN_COUNT] = {{0.0}};
+  double c[CIC_UNKNOWN_COUNT] = {0.0};
+  for (uint16_t p = 0; p < FILTER_DESIGN_CIC_FIT_POINT_COUNT; p++) {
+    double f = FILTER_DESIGN_CIC_FIT_HZ * p /
+               (FILTER_DESIGN_CIC_FIT_POINT_COUNT - 1);
+    double target = filterDesign_firGain(fir, FILTER_FIR_COEFFICIENT_COUNT, f,
+                                         INPUT_SAMPLE_FREQUENCY_HZ) /
+                    filterDesign_cicGain(f);
+    double basis[CIC_UNKNOWN_COUNT];
+    basis[0] = 1.0;
+    double w = 2.0 * M_PI * f / FILTER_DESIGN_SAMPLE_FREQUENCY_HZ;
+    for (uint16_t k = 1; k < CIC_UNKNOWN_COUNT; k++)
+      basis[k] = 2.0 * cos(w * k);
+    for (uint16_t i = 0; i < CIC_UNKNOWN_COUNT; i++) {
+      c[i] += basis[i] * target;
+      for (uint16_t j = 0; j < CIC_UNKNOWN_COUNT; j++)
+        a[i][j] += basis[i] * basis[j];
+    }
+  }
+  filterDesign_solve(a, c);
+  uint16_t middle = CIC_UNKNOWN_COUNT - 1;
+  for (uint16_t i = 0; i < FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT; i++)
+    compensation[i] = c[(i < middle) ? middle - i : i - middle];
+}
+
+// Converts value to a fixed-point value with fractionBits, rounding to nearest
+// and saturating to 32 bits.
+int32_t filterDesign_toFixed(double value, uint16_t fractionBits) {
+  double scaled = round(value * (double)(1LL << fractionBits));
+  if (scaled > INT32_MAX)
+    return INT32_MAX;
+  if (scaled < INT32_MIN)
+    return INT32_MIN;
+  return (int32_t)scaled;
+}
+
+// Returns gain in dB.
+static double filterDesign_toDb(double gain) { return 20.0 * log10(gain); }
+
+// Check a filter against the specification. Each prints every miss and returns
+// true if the filter meets the specification.
+bool filterDesign_checkFir(const double fir[FILTER_FIR_COEFFICIENT_COUNT]) {
+  bool success = true;
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    double f = filterDesign_userFrequency(n);
+    double db = filterDesign_toDb(filterDesign_firGain(
+        fir, FILTER_FIR_COEFFICIENT_COUNT, f, INPUT_SAMPLE_FREQUENCY_HZ));
+    if (db < FILTER_DESIGN_FIR_PASSBAND_MIN_DB ||
+        db > FILTER_DESIGN_FIR_PASSBAND_MAX_DB) {
+      printf("FIR gain at user frequency %d (%.1f Hz) is %.2f dB; the "
+             "passband allows %.1f to %.1f dB.\n",
+             n, f, db, FILTER_DESIGN_FIR_PASSBAND_MIN_DB,
+             FILTER_DESIGN_FIR_PASSBAND_MAX_DB);
+      success = false;
+    }
+  }
+  // Report only the worst point of the stopband.
+  double worstDb = -INFINITY;
+  double worstFrequency = 0.0;
+  for (double f = FILTER_DESIGN_FIR_STOPBAND_HZ;
+       f <= INPUT_SAMPLE_FREQUENCY_HZ / 2; f += FIR_STOPBAND_STEP_HZ) {
+    double db = filterDesign_toDb(filterDesign_firGain(
+        fir, FILTER_FIR_COEFFICIENT_COUNT, f, INPUT_SAMPLE_FREQUENCY_HZ));
+    if (db > worstDb) {
+      worstDb = db;
+      worstFrequency = f;
+    }
+  }
+  if (worstDb > FILTER_DESIGN_FIR_STOPBAND_MAX_DB) {
+    printf("FIR gain at %.0f Hz is %.1f dB; the stopband allows at most %.1f "
+           "dB.\n",
+           worstFrequency, worstDb, FILTER_DESIGN_FIR_STOPBAND_MAX_DB);
+    success = false;
+  }
+  return success;
+}
+
+bool filterDesign_checkCicCompensation(
+    const double fir[FILTER_FIR_COEFFICIENT_COUNT],
+    const double compensation[FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT]) {
+  bool success = true;
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    double f = filterDesign_userFrequency(n);
+    double cascade =
+        filterDesign_cicGain(f) *
+        filterDesign_firGain(compensation,
+                             FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT, f,
+                             FILTER_DESIGN_SAMPLE_FREQUENCY_HZ);
+    double error = filterDesign_toDb(cascade) -
+                   filterDesign_toDb(filterDesign_firGain(
+                       fir, FILTER_FIR_COEFFICIENT_COUNT, f,
+                       INPUT_SAMPLE_FREQUENCY_HZ));
+    if (fabs(error) > FILTER_DESIGN_CIC_TOLERANCE_DB) {
+      printf("CIC cascade gain at user frequency %d (%.1f Hz) is %.3f dB off "
+             "the FIR filter; %.3f dB is allowed.\n",
+             n, f, error, FILTER_DESIGN_CIC_TOLERANCE_DB);
+      success = false;
+    }
+  }
+  return success;
+}
+
+// Checks IIR filter filterNumber, centered on user frequency filterNumber.
+bool filterDesign_checkIir(
+    uint16_t filterNumber,
+    const double sos[FILTER_IIR_SECTION_COUNT]
+                    [FILTER_IIR_SECTION_COEFFICIENT_COUNT]) {
+  bool success = true;
+  double center = filterDesign_userFrequency(filterNumber);
+  double db = filterDesign_toDb(filterDesign_iirGain(sos, center));
+  if (fabs(db) > FILTER_DESIGN_IIR_CENTER_TOLERANCE_DB) {
+    printf("IIR filter %d has gain %.3f dB at its frequency (%.1f Hz).\n",
+           filterNumber, db, center);
+    success = false;
+  }
+  double edges[2] = {center - FILTER_DESIGN_IIR_BANDWIDTH_HZ / 2,
+                     center + FILTER_DESIGN_IIR_BANDWIDTH_HZ / 2};
+  for (uint16_t i = 0; i < 2; i++) {
+    db = filterDesign_toDb(filterDesign_iirGain(sos, edges[i]));
+    if (fabs(db - FILTER_DESIGN_IIR_EDGE_DB) >
+        FILTER_DESIGN_IIR_EDGE_TOLERANCE_DB) {
+      printf("IIR filter %d has gain %.2f dB at its band edge (%.1f Hz); "
+             "expected %.2f dB.\n",
+             filterNumber, db, edges[i], FILTER_DESIGN_IIR_EDGE_DB);
+      success = false;
+    }
+  }
+  for (uint16_t m = 0; m < FILTER_FREQUENCY_COUNT; m++) {
+    if (m == filterNumber)
+      continue;
+    double f = filterDesign_userFrequency(m);
+    db = filterDesign_toDb(filterDesign_iirGain(sos, f));
+    if (db > -FILTER_DESIGN_IIR_REJECTION_DB) {
+      printf("IIR filter %d only rejects user frequency %d (%.1f Hz) by %.1f "
+             "dB; %.1f dB is required.\n",
+             filterNumber, m, f, -db, FILTER_DESIGN_IIR_REJECTION_DB);
+      success = false;
+    }
+  }
+  return success;
+}
@@ -0,0 +1,144 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef FILTERDESIGN_H_
+#define FILTERDESIGN_H_
+
+// Designs the filters whose coefficients are in filterCoefficients.c, and
+// checks them against the filter specification below. tools/
+// filterCoefficientGen.c uses it to generate filterCoefficients.c for
+// filter_frequencyTickTable at build time, and fails the build if a design
+// misses its specification.
+//
+// For counts other than the default, the user frequencies are designed too.
+// Their tick counts stay between FILTER_DESIGN_MIN_TICK_COUNT and
+// FILTER_DESIGN_MAX_TICK_COUNT (4.17 to 1.41 kHz), inside the FIR passband and
+// high enough that the third harmonic of a square wave does not land within
+// 50 Hz of another frequency.
+// Starting from the highest frequency, each next one is the first whole tick
+// count at least a gap lower, and the gap is the largest that fits
+// FILTER_FREQUENCY_COUNT frequencies. The closest are 154 Hz (16), 89 Hz (24)
+// and 55 Hz (32) apart; each IIR filter must reject its neighbours by
+// FILTER_DESIGN_IIR_REJECTION_DB.
+//
+// The FIR filter is a FILTER_FIR_COEFFICIENT_COUNT-tap Hamming-windowed sinc
+// low-pass filter with a FILTER_DESIGN_FIR_CUTOFF_HZ cutoff at the 100 kHz
+// input rate, scaled for unity gain at DC.
+//
+// Each IIR filter is a 10th-order Butterworth band-pass filter,
+// FILTER_DESIGN_IIR_BANDWIDTH_HZ wide and centered on its user frequency, at
+// the decimated sample rate. The poles of a 5th-order analog Butterworth
+// low-pass prototype are moved to the band with the low-pass to band-pass
+// transform and mapped to z with the bilinear transform, after prewarping the
+// band edges. The zeros are all at z = 1 and z = -1, so every second-order
+// section has the numerator b0 * (1 - z^-2). The sections are ordered by
+// increasing pole radius. Each section is scaled so that the peak gain from the
+// filter input to its output is 1.0, and the last so that the gain of the whole
+// filter is exactly 1.0 at its center frequency. Peaks are found on a grid of
+// FILTER_DESIGN_PEAK_GRID_SIZE points from 0 to the Nyquist frequency.
+//
+// The CIC compensation filter is a least-squares fit, over
+// FILTER_DESIGN_CIC_FIT_POINT_COUNT points from 0 to FILTER_DESIGN_CIC_FIT_HZ,
+// of the FIR response divided by the CIC response (see filterCoefficients.h).
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "filterCoefficients.h"
+
+// The rate the IIR filters run at, after decimation.
+#define FILTER_DESIGN_SAMPLE_FREQUENCY_HZ                                      \
+  (FILTER_SAMPLE_FREQUENCY_IN_KHZ * 1000.0 / FILTER_FIR_DECIMATION_FACTOR)
+#define FILTER_DESIGN_FIR_CUTOFF_HZ 5000.0
+#define FILTER_DESIGN_IIR_BANDWIDTH_HZ 50.0
+#define FILTER_DESIGN_PEAK_GRID_SIZE 20000 // 0.25 Hz steps at 10 kHz.
+#define FILTER_DESIGN_CIC_FIT_HZ 4400.0
+#define FILTER_DESIGN_CIC_FIT_POINT_COUNT 201
+#define FILTER_DESIGN_MIN_TICK_COUNT 24
+#define FILTER_DESIGN_MAX_TICK_COUNT 71
+#if FILTER_FREQUENCY_COUNT >                                                   \
+    FILTER_DESIGN_MAX_TICK_COUNT - FILTER_DESIGN_MIN_TICK_COUNT + 1
+#error "FILTER_FREQUENCY_COUNT is larger than the number of usable tick counts."
+#endif
+
+// The specification. FIR gain at every user frequency.
+#define FILTER_DESIGN_FIR_PASSBAND_MIN_DB (-2.0)
+#define FILTER_DESIGN_FIR_PASSBAND_MAX_DB 0.5
+// FIR gain from FILTER_DESIGN_FIR_STOPBAND_HZ to the input Nyquist frequency.
+#define FILTER_DESIGN_FIR_STOPBAND_HZ 7000.0
+#define FILTER_DESIGN_FIR_STOPBAND_MAX_DB (-45.0)
+// IIR gain at the filter's own frequency, at the band edges, and at every
+// other user frequency.
+#define FILTER_DESIGN_IIR_CENTER_TOLERANCE_DB 0.01
+#define FILTER_DESIGN_IIR_EDGE_DB (-3.01)
+#define FILTER_DESIGN_IIR_EDGE_TOLERANCE_DB 0.1
+#define FILTER_DESIGN_IIR_REJECTION_DB 30.0
+// Largest difference between the CIC cascade and the FIR filter at any user
+// frequency.
+#define FILTER_DESIGN_CIC_TOLERANCE_DB 0.01
+
+// Writes the tick counts of the user frequencies, lowest frequency first. For
+// the default count these are filter_frequencyTickTable; for any other count
+// they are designed as described above, and filter_frequencyTickTable is
+// generated from them.
+void filterDesign_frequencyTicks(uint16_t ticks[FILTER_FREQUENCY_COUNT]);
+
+// Returns user frequency frequencyNumber in Hz.
+double filterDesign_userFrequency(uint16_t frequencyNumber);
+
+// Designs the decimating FIR filter.
+void filterDesign_fir(double fir[FILTER_FIR_COEFFICIENT_COUNT]);
+
+// Designs the CIC compensation filter for the given FIR filter.
+void filterDesign_cicCompensation(
+    const double fir[FILTER_FIR_COEFFICIENT_COUNT],
+    double compensation[FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT]);
+
+// Designs the band-pass filter centered on centerFrequency (Hz). Writes the
+// second-order sections to sos and the same filter in direct form to a (without
+// the leading 1) and b.
+void filterDesign_iirBandPass(
+    double centerFrequency,
+    double sos[FILTER_IIR_SECTION_COUNT][FILTER_IIR_SECTION_COEFFICIENT_COUNT],
+    double a[FILTER_IIR_A_COEFFICIENT_COUNT],
+    double b[FILTER_IIR_B_COEFFICIENT_COUNT]);
+
+// Returns the gain at frequency (Hz) of an FIR filter with count coefficients
+// running at sampleFrequency (Hz).
+double filterDesign_firGain(const double coefficients[], uint16_t count,
+                            double frequency, double sampleFrequency);
+
+// Returns the gain of the filter made of the given sections at frequency (Hz).
+double filterDesign_iirGain(
+    const double sos[FILTER_IIR_SECTION_COUNT]
+                    [FILTER_IIR_SECTION_COEFFICIENT_COUNT],
+    double frequency);
+
+// Returns the gain of the CIC decimator (FILTER_CIC_STAGE_COUNT stages,
+// decimation FILTER_FIR_DECIMATION_FACTOR) at frequency (Hz), relative to its
+// gain at DC.
+double filterDesign_cicGain(double frequency);
+
+// Converts value to a fixed-point value with fractionBits, rounding to nearest
+// and saturating to 32 bits, as filterFixedPoint.c does.
+int32_t filterDesign_toFixed(double value, uint16_t fractionBits);
+
+// Check a filter against the specification. Each prints every miss and returns
+// true if the filter meets the specification.
+bool filterDesign_checkFir(const double fir[FILTER_FIR_COEFFICIENT_COUNT]);
+bool filterDesign_checkCicCompensation(
+    const double fir[FILTER_FIR_COEFFICIENT_COUNT],
+    const double compensation[FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT]);
+// Checks IIR filter filterNumber, centered on user frequency filterNumber.
+bool filterDesign_checkIir(
+    uint16_t filterNumber,
+    const double sos[FILTER_IIR_SECTION_COUNT]
+                    [FILTER_IIR_SECTION_COEFFICIENT_COUNT]);
+
+#endif /* FILTERDESIGN_H_ */
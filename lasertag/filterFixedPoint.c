@@ -0,0 +1,1079 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Fixed-point implementation of filter.h. See filterFixedPoint.h for the
+// number formats and error bounds. Only compiled when FILTER_FIXED_POINT is
+// defined, in which case filter.c must be left out of the build.
+#ifdef FILTER_FIXED_POINT
+
+#include <math.h>
+#include <stdio.h>
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+#include "detectorProfile.h"
+#include "filter.h"
+#include "filterCoefficients.h"
+#include "filterFixedPoint.h"
+
+#define X_QUEUE_SIZE FILTER_FIR_COEFFICIENT_COUNT
+#define Y_QUEUE_SIZE FILTER_IIR_B_COEFFICIENT_COUNT
+#define Z_QUEUE_SIZE FILTER_IIR_A_COEFFICIENT_COUNT
+#define OUTPUT_QUEUE_SIZE FILTER_INPUT_PULSE_WIDTH
+#define QUEUE_INIT_VALUE 0.0
+
+// Number of fractional bits in each stored format once headroom is removed.
+#define INPUT_SHIFT                                                            \
+  (FILTER_FIXED_POINT_INPUT_FRACTION_BITS - FILTER_FIXED_POINT_HEADROOM_BITS)
+#define SIGNAL_SHIFT                                                           \
+  (FILTER_FIXED_POINT_SIGNAL_FRACTION_BITS - FILTER_FIXED_POINT_HEADROOM_BITS)
+// Q31 coefficient * input leaves this many extra fractional bits.
+#define FIR_OUTPUT_SHIFT                                                       \
+  (FILTER_FIXED_POINT_FIR_COEFFICIENT_BITS + INPUT_SHIFT - SIGNAL_SHIFT)
+#define IIR_OUTPUT_SHIFT FILTER_FIXED_POINT_IIR_COEFFICIENT_BITS
+#define POWER_SHIFT (SIGNAL_SHIFT - FILTER_FIXED_POINT_POWER_BITS)
+
+// Conversion factors between doubles and the stored formats.
+#define INPUT_SCALE ((double)(1L << INPUT_SHIFT))
+#define SIGNAL_SCALE ((double)(1L << SIGNAL_SHIFT))
+#define POWER_SAMPLE_SCALE ((double)(1L << FILTER_FIXED_POINT_POWER_BITS))
+#define POWER_SCALE (POWER_SAMPLE_SCALE * POWER_SAMPLE_SCALE)
+
+#ifdef FILTER_CIC
+#define CIC_STAGE_COUNT FILTER_CIC_STAGE_COUNT
+#define CIC_TAP_COUNT FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT
+#if CIC_TAP_COUNT % 2 == 0
+#error "The CIC compensation filter must have an odd number of taps."
+#endif
+// The compensation filter is symmetric; only the first half is stored.
+#define CIC_HALF_TAP_COUNT FILTER_CIC_COMPENSATION_HALF_COUNT
+// Q43 coefficient * CIC output leaves this many extra fractional bits.
+#define CIC_OUTPUT_SHIFT                                                       \
+  (FILTER_FIXED_POINT_CIC_COEFFICIENT_BITS + INPUT_SHIFT - SIGNAL_SHIFT)
+#endif
+
+// Inputs per decimation phase (per FIR output) in filter_firFilterBlock().
+#define FIR_PHASE_COUNT FILTER_FIR_DECIMATION_FACTOR
+#ifndef FILTER_CIC
+// filter_firFilterBlock() runs the FIR filter as a polyphase decimator: branch
+// p holds every FIR_PHASE_COUNT'th input, those p inputs before a decimation
+// phase, and the taps that apply to them. Branch 0 has the extra tap.
+#define FIR_BRANCH_TAP_COUNT                                                   \
+  ((X_QUEUE_SIZE + FIR_PHASE_COUNT - 1) / FIR_PHASE_COUNT)
+#endif
+
+// Shift right with round-to-nearest.
+#define ROUNDING_SHIFT(value, shift)                                           \
+  (((value) + ((int64_t)1 << ((shift)-1))) >> (shift))
+
+/*******************************************************************************
+***** Internal state
+*******************************************************************************/
+
+#ifdef FILTER_GATING
+#define GATE_HISTORY_SIZE FILTER_GATING_HISTORY_SIZE
+// Leaky-average time constant of the envelopes, 2^GATE_ENVELOPE_SHIFT outputs.
+#define GATE_ENVELOPE_SHIFT 10
+#define GATE_ENVELOPE_SECTION_COUNT FILTER_GATING_ENVELOPE_SECTION_COUNT
+#endif
+
+// Output history (y[n-1], y[n-2]) for each second-order section. The IIR state
+// and coefficients are stored as structure-of-arrays, indexed by filter number
+// last, so that filter_iirFilterAll() can work on adjacent filters at once.
+#define IIR_STATE_Y1 0
+#define IIR_STATE_Y2 1
+#define IIR_STATE_COUNT 2
+
+// The state of the filters for one channel. Every channel has its own; the
+// filter functions work on the selected one (see filter_selectChannel()).
+typedef struct {
+  // The input history is stored twice, back to back, so that the newest
+  // X_QUEUE_SIZE inputs are always contiguous starting at xIndex.
+  int16_t xHistory[2 * X_QUEUE_SIZE];
+  uint32_t xIndex;
+  // Inputs received by filter_firFilterBlock() since its last output.
+  uint16_t firDecimationCount;
+#ifndef FILTER_CIC
+  // The polyphase branches, each stored twice like xHistory. The inputs since
+  // the last output are at firBranchIndex; the branch windows, oldest first,
+  // start there once the next output is due. Stale after inputs or an xQueue
+  // that did not go through filter_firFilterBlock(), which then rebuilds them
+  // from xHistory.
+  int16_t firBranches[FIR_PHASE_COUNT][2 * FIR_BRANCH_TAP_COUNT];
+  uint32_t firBranchIndex;
+  bool firBranchesStale;
+#endif
+  // FIR outputs, also stored twice. Only the newest three are used by the IIR
+  // filters; the rest are kept so that filter_getYQueue() has something to
+  // show.
+  int32_t yHistory[2 * Y_QUEUE_SIZE];
+  uint32_t yIndex;
+  int32_t iirState[FILTER_IIR_SECTION_COUNT][IIR_STATE_COUNT]
+                  [FILTER_FREQUENCY_COUNT];
+  // Most recent IIR outputs, for filter_getZQueue().
+  int32_t zHistory[FILTER_FREQUENCY_COUNT][Z_QUEUE_SIZE];
+  uint32_t zIndex[FILTER_FREQUENCY_COUNT];
+  // The last OUTPUT_QUEUE_SIZE IIR outputs, at power precision.
+  int32_t outputHistory[FILTER_FREQUENCY_COUNT][OUTPUT_QUEUE_SIZE];
+  uint32_t outputIndex[FILTER_FREQUENCY_COUNT];
+  // Running sum of squares of outputHistory, kept exact.
+  int64_t powerSum[FILTER_FREQUENCY_COUNT];
+  double currentPowerValue[FILTER_FREQUENCY_COUNT];
+#ifdef FILTER_CIC
+  // CIC integrator outputs, and the value each comb stage had as input at the
+  // previous FIR output. They are unsigned so that overflow wraps around; the
+  // comb differences are still exact because the CIC output (at most
+  // 2^15 * 10^4) fits in 32 bits.
+  uint32_t cicIntegrator[CIC_STAGE_COUNT];
+  uint32_t cicCombDelay[CIC_STAGE_COUNT];
+  // CIC outputs, stored twice like xHistory.
+  int32_t cicHistory[2 * CIC_TAP_COUNT];
+  uint32_t cicIndex;
+#endif
+#ifdef FILTER_GATING
+  // The newest GATE_HISTORY_SIZE FIR outputs; gateIndex is the newest.
+  int32_t gateHistory[GATE_HISTORY_SIZE];
+  uint32_t gateIndex;
+  // FIR outputs since filter_init(), wrapping around. Only differences are
+  // used.
+  uint32_t firOutputCount;
+  // Copy of the first sections of each closed band, run for its envelope, and
+  // envelope: the average of their squared output, at power precision.
+  int32_t gateEnvelopeState[GATE_ENVELOPE_SECTION_COUNT][IIR_STATE_COUNT]
+                           [FILTER_FREQUENCY_COUNT];
+  int64_t gateEnvelope[FILTER_FREQUENCY_COUNT];
+  bool gateOpen[FILTER_FREQUENCY_COUNT];
+  bool allGatesOpen; // Lets filter_iirFilterAll() keep its fast path.
+  uint32_t gateClosedAt[FILTER_FREQUENCY_COUNT]; // First skipped output.
+  // FIR outputs after filter_init() until gates may close: until the history
+  // is full.
+  uint32_t gateHoldRemaining;
+  uint16_t gateUpdateCountdown;
+  filter_gatingStats_t gatingStats[FILTER_FREQUENCY_COUNT];
+#endif
+} filter_channelState_t;
+
+static filter_channelState_t channelStates[FILTER_CHANNEL_COUNT];
+static filter_channelState_t *channel = &channelStates[0]; // Selected channel.
+
+#ifndef FILTER_CIC
+// The FIR coefficients of each polyphase branch, oldest input first, zero past
+// the end of the filter. Set by filter_init().
+static int32_t firBranchCoefficients[FIR_PHASE_COUNT][FIR_BRANCH_TAP_COUNT];
+#endif
+
+#ifdef FILTER_GATING
+static bool gatingEnabled = true; // All channels. Not reset by filter_init().
+// Noise power gain of each band divided by that of its envelope filter, which
+// scales an envelope to the band's power in white noise. Set by filter_init().
+static double gateNoiseScale[FILTER_FREQUENCY_COUNT];
+
+static void filter_updateGates(int32_t y); // Called for every FIR output.
+#endif
+
+// Queues handed out by the verification-assisting functions.
+static queue_t xQueue;
+static queue_t yQueue;
+static queue_t zQueue[FILTER_FREQUENCY_COUNT];
+static queue_t outputQueue[FILTER_FREQUENCY_COUNT];
+
+// Set when a queue has been handed out and may have been modified.
+static bool xQueueExported;
+static bool yQueueExported;
+static bool zQueueExported[FILTER_FREQUENCY_COUNT];
+static bool outputQueueExported[FILTER_FREQUENCY_COUNT];
+// True if any of the flags above is set. Checked once per filter operation.
+static bool queuesExported;
+
+/*******************************************************************************
+***** Fixed-point helpers
+*******************************************************************************/
+
+// Saturate a 64-bit value to 32 bits.
+static inline int32_t filter_saturate32(int64_t value) {
+  if (value > INT32_MAX)
+    return INT32_MAX;
+  if (value < INT32_MIN)
+    return INT32_MIN;
+  return (int32_t)value;
+}
+
+// Saturate a 32-bit value to 16 bits.
+static inline int16_t filter_saturate16(int32_t value) {
+  if (value > INT16_MAX)
+    return INT16_MAX;
+  if (value < INT16_MIN)
+    return INT16_MIN;
+  return (int16_t)value;
+}
+
+// Converts a double to a fixed-point value with fractionBits, saturating.
+static int32_t filter_toFixed(double value, uint16_t fractionBits) {
+  double scaled = round(value * (double)(1LL << fractionBits));
+  if (scaled > INT32_MAX)
+    return INT32_MAX;
+  if (scaled < INT32_MIN)
+    return INT32_MIN;
+  return (int32_t)scaled;
+}
+
+/*******************************************************************************
+***** Queue import/export
+*******************************************************************************/
+
+// Reads the newest count values of q into values[], oldest first. Missing
+// values (q holds fewer than count elements) are read as zero.
+static void filter_readQueueTail(queue_t *q, double values[], uint32_t count) {
+  uint32_t available = queue_elementCount(q);
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t missing = count - available;
+    values[i] = (available >= count || i >= missing)
+                    ? queue_readElementAt(q, available - count + i)
+                    : 0.0;
+  }
+}
+
+// Recomputes the running sum of squares for filterNumber from scratch.
+static void filter_recomputePowerSum(uint16_t filterNumber) {
+  int64_t sum = 0;
+  for (uint32_t i = 0; i < OUTPUT_QUEUE_SIZE; i++)
+    sum += (int64_t)channel->outputHistory[filterNumber][i] *
+           channel->outputHistory[filterNumber][i];
+  channel->powerSum[filterNumber] = sum;
+}
+
+// Copies anything written to the exported queues back into internal state.
+static void filter_importQueues() {
+  double values[OUTPUT_QUEUE_SIZE];
+  if (xQueueExported) {
+    filter_readQueueTail(&xQueue, values, X_QUEUE_SIZE);
+    channel->xIndex = 0;
+    for (uint32_t i = 0; i < X_QUEUE_SIZE; i++)
+      channel->xHistory[i] = channel->xHistory[i + X_QUEUE_SIZE] =
+          filter_saturate16(filter_toFixed(values[i], INPUT_SHIFT));
+#ifndef FILTER_CIC
+    channel->firBranchesStale = true;
+#endif
+    xQueueExported = false;
+  }
+  if (yQueueExported) {
+    filter_readQueueTail(&yQueue, values, Y_QUEUE_SIZE);
+    channel->yIndex = 0;
+    for (uint32_t i = 0; i < Y_QUEUE_SIZE; i++)
+      channel->yHistory[i] = channel->yHistory[i + Y_QUEUE_SIZE] =
+          filter_toFixed(values[i], SIGNAL_SHIFT);
+    yQueueExported = false;
+  }
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    if (zQueueExported[n]) {
+      // The sections keep their own state, so the only change to zQueue that
+      // can be imported is clearing it, which resets the filter.
+      bool allZero = true;
+      filter_readQueueTail(&zQueue[n], values, Z_QUEUE_SIZE);
+      channel->zIndex[n] = 0;
+      for (uint32_t i = 0; i < Z_QUEUE_SIZE; i++) {
+        channel->zHistory[n][i] = filter_toFixed(values[i], SIGNAL_SHIFT);
+        allZero &= (channel->zHistory[n][i] == 0);
+      }
+      if (allZero) {
+        for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++)
+          channel->iirState[s][IIR_STATE_Y1][n] =
+              channel->iirState[s][IIR_STATE_Y2][n] = 0;
+      }
+      zQueueExported[n] = false;
+    }
+    if (outputQueueExported[n]) {
+      filter_readQueueTail(&outputQueue[n], values, OUTPUT_QUEUE_SIZE);
+      channel->outputIndex[n] = 0;
+      for (uint32_t i = 0; i < OUTPUT_QUEUE_SIZE; i++)
+        channel->outputHistory[n][i] =
+            filter_toFixed(values[i], FILTER_FIXED_POINT_POWER_BITS);
+      filter_recomputePowerSum(n); // Contents changed, start over.
+      outputQueueExported[n] = false;
+    }
+  }
+  queuesExported = false;
+}
+
+// Call at the start of each filter operation.
+static inline void filter_checkQueues() {
+  if (queuesExported)
+    filter_importQueues();
+}
+
+// Overwrites the contents of q with size values from a ring buffer.
+static void filter_exportHistory(queue_t *q, const int32_t history[],
+                                 uint32_t size, uint32_t index, double scale) {
+  for (uint32_t i = 0; i < size; i++)
+    queue_overwritePush(q, history[(index + i) % size] / scale);
+}
+
+// Marks q as exported if it belongs to this file.
+static void filter_markExported(queue_t *q) {
+  if (q == &xQueue)
+    xQueueExported = true;
+  else if (q == &yQueue)
+    yQueueExported = true;
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    if (q == &zQueue[n])
+      zQueueExported[n] = true;
+    else if (q == &outputQueue[n])
+      outputQueueExported[n] = true;
+  }
+  queuesExported = true;
+}
+
+/*******************************************************************************
+***** Main Filter Functions
+*******************************************************************************/
+
+// Resets the state of the selected channel. The queues must be initialized.
+static void filter_initChannel() {
+#ifdef FILTER_CIC
+  for (uint16_t s = 0; s < CIC_STAGE_COUNT; s++)
+    channel->cicIntegrator[s] = channel->cicCombDelay[s] = 0;
+  for (uint32_t i = 0; i < 2 * CIC_TAP_COUNT; i++)
+    channel->cicHistory[i] = 0;
+  channel->cicIndex = 0;
+#endif
+  filter_fillQueue(&xQueue, QUEUE_INIT_VALUE);
+  filter_fillQueue(&yQueue, QUEUE_INIT_VALUE);
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    filter_fillQueue(&zQueue[n], QUEUE_INIT_VALUE);
+    filter_fillQueue(&outputQueue[n], QUEUE_INIT_VALUE);
+  }
+  // Every queue was just cleared, so importing resets all internal state.
+  channel->firDecimationCount = 0;
+  filter_importQueues();
+#ifdef FILTER_GATING
+  for (uint32_t i = 0; i < GATE_HISTORY_SIZE; i++)
+    channel->gateHistory[i] = 0;
+  channel->gateIndex = channel->firOutputCount = 0;
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    for (uint16_t s = 0; s < GATE_ENVELOPE_SECTION_COUNT; s++)
+      channel->gateEnvelopeState[s][IIR_STATE_Y1][n] =
+          channel->gateEnvelopeState[s][IIR_STATE_Y2][n] = 0;
+    channel->gateEnvelope[n] = 0;
+    channel->gateOpen[n] = true;
+    channel->gatingStats[n] = (filter_gatingStats_t){.open = true};
+  }
+  channel->allGatesOpen = true;
+  channel->gateHoldRemaining = GATE_HISTORY_SIZE;
+  channel->gateUpdateCountdown = FILTER_GATING_UPDATE_PERIOD;
+#endif
+}
+
+#ifdef FILTER_GATING
+// Runs input x through second-order section s of filterNumber, whose x[n-1],
+// x[n-2], y[n-1] and y[n-2] are in state[], and returns the output.
+static double filter_runGateSection(uint16_t filterNumber, uint16_t s,
+                                    double state[4], double x) {
+  const double *c = filterCoefficients_iirSos[filterNumber][s];
+  double y = c[FILTER_IIR_SECTION_B0] * x +
+             c[FILTER_IIR_SECTION_B1] * state[0] +
+             c[FILTER_IIR_SECTION_B2] * state[1] -
+             c[FILTER_IIR_SECTION_A1] * state[2] -
+             c[FILTER_IIR_SECTION_A2] * state[3];
+  state[1] = state[0];
+  state[0] = x;
+  state[3] = state[2];
+  state[2] = y;
+  return y;
+}
+
+// Sets gateNoiseScale[] from the energies of the impulse responses of each band
+// and of its envelope filter, which have died out after
+// FILTER_GATING_WARM_UP_SIZE outputs.
+static void filter_initGateNoiseScale() {
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    double state[FILTER_IIR_SECTION_COUNT][4] = {{0.0}};
+    double envelopeEnergy = 0.0, energy = 0.0;
+    for (uint32_t i = 0; i < FILTER_GATING_WARM_UP_SIZE; i++) {
+      double x = i == 0 ? 1.0 : 0.0;
+      for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++) {
+        x = filter_runGateSection(n, s, state[s], x);
+        if (s == GATE_ENVELOPE_SECTION_COUNT - 1)
+          envelopeEnergy += x * x;
+      }
+      energy += x * x;
+    }
+    gateNoiseScale[n] = energy / envelopeEnergy;
+  }
+}
+#endif
+
+#ifndef FILTER_CIC
+// Sets firBranchCoefficients[]. In branch p, the input at window position i
+// (oldest first) is p + (FIR_BRANCH_TAP_COUNT - 1 - i) * FIR_PHASE_COUNT inputs
+// before the phase; filterCoefficients_firFixed[] is oldest input first too.
+static void filter_initFirBranchCoefficients() {
+  for (uint16_t p = 0; p < FIR_PHASE_COUNT; p++)
+    for (uint16_t i = 0; i < FIR_BRANCH_TAP_COUNT; i++) {
+      uint32_t age = p + (FIR_BRANCH_TAP_COUNT - 1 - i) * FIR_PHASE_COUNT;
+      firBranchCoefficients[p][i] =
+          age < X_QUEUE_SIZE
+              ? filterCoefficients_firFixed[X_QUEUE_SIZE - 1 - age]
+              : 0;
+    }
+}
+
+// Refills the polyphase branches of the selected channel from xHistory. The
+// newest firDecimationCount inputs belong to the next output.
+static void filter_rebuildFirBranches() {
+  const int16_t *newest =
+      &channel->xHistory[channel->xIndex + X_QUEUE_SIZE - 1];
+  channel->firBranchIndex = 0;
+  for (uint32_t k = 0; k < FIR_BRANCH_TAP_COUNT; k++) {
+    // k outputs back; the inputs since the last output are at firBranchIndex.
+    uint32_t slot = (FIR_BRANCH_TAP_COUNT - k) % FIR_BRANCH_TAP_COUNT;
+    for (uint16_t p = 0; p < FIR_PHASE_COUNT; p++) {
+      // The age of the input, counted from the newest; it has not arrived yet
+      // if negative. Inputs older than xHistory have no tap left.
+      int32_t age = (int32_t)(p + k * FIR_PHASE_COUNT) -
+                    (FIR_PHASE_COUNT - channel->firDecimationCount);
+      int16_t value = age >= 0 && age < X_QUEUE_SIZE ? newest[-age] : 0;
+      channel->firBranches[p][slot] =
+          channel->firBranches[p][slot + FIR_BRANCH_TAP_COUNT] = value;
+    }
+  }
+  channel->firBranchesStale = false;
+}
+#endif
+
+// Must call this prior to using any filter functions. Resets every channel
+// and selects channel 0.
+void filter_init() {
+#ifndef FILTER_CIC
+  filter_initFirBranchCoefficients();
+#endif
+  queue_init(&xQueue, X_QUEUE_SIZE, "xQueue");
+  queue_init(&yQueue, Y_QUEUE_SIZE, "yQueue");
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    char name[QUEUE_MAX_NAME_SIZE];
+    snprintf(name, QUEUE_MAX_NAME_SIZE, "zQueue[%d]", n);
+    queue_init(&zQueue[n], Z_QUEUE_SIZE, name);
+    snprintf(name, QUEUE_MAX_NAME_SIZE, "outputQueue[%d]", n);
+    queue_init(&outputQueue[n], OUTPUT_QUEUE_SIZE, name);
+  }
+  for (uint16_t c = 0; c < FILTER_CHANNEL_COUNT; c++) {
+    channel = &channelStates[c];
+    filter_initChannel();
+  }
+  channel = &channelStates[0];
+#ifdef FILTER_GATING
+  filter_initGateNoiseScale();
+#endif
+}
+
+// Selects the channel that the other filter functions work on. Anything
+// written to the queues of the previously selected channel is imported into
+// it first; fetch the queues again after switching.
+void filter_selectChannel(uint16_t channelNumber) {
+  filter_checkQueues();
+  channel = &channelStates[channelNumber];
+}
+
+// Returns the selected channel.
+uint16_t filter_getSelectedChannel() { return channel - channelStates; }
+
+// Stores one input in the input history. With FILTER_CIC, also runs it
+// through the CIC integrators.
+static inline void filter_storeInput(int16_t value) {
+  channel->xHistory[channel->xIndex] =
+      channel->xHistory[channel->xIndex + X_QUEUE_SIZE] = value;
+  if (++channel->xIndex == X_QUEUE_SIZE)
+    channel->xIndex = 0;
+#ifdef FILTER_CIC
+  uint32_t sum = (uint32_t)(int32_t)value;
+  for (uint16_t s = 0; s < CIC_STAGE_COUNT; s++)
+    sum = channel->cicIntegrator[s] += sum;
+#endif
+}
+
+// Use this to copy an input into the input queue of the FIR-filter (xQueue).
+void filter_addNewInput(double x) {
+  filter_checkQueues();
+  filter_storeInput(filter_saturate16(filter_toFixed(x, INPUT_SHIFT)));
+#ifndef FILTER_CIC
+  channel->firBranchesStale = true;
+#endif
+}
+
+// Fills a queue with the given fillValue.
+void filter_fillQueue(queue_t *q, double fillValue) {
+  for (queue_size_t i = 0; i < queue_size(q); i++)
+    queue_overwritePush(q, fillValue);
+  filter_markExported(q);
+}
+
+#ifdef FILTER_CIC
+// Runs the CIC combs on the newest integrator output, then the compensation
+// filter on the newest CIC_TAP_COUNT CIC outputs.
+static inline int32_t filter_computeCicOutput() {
+  uint32_t value = channel->cicIntegrator[CIC_STAGE_COUNT - 1];
+  for (uint16_t s = 0; s < CIC_STAGE_COUNT; s++) {
+    uint32_t difference = value - channel->cicCombDelay[s];
+    channel->cicCombDelay[s] = value;
+    value = difference;
+  }
+  channel->cicHistory[channel->cicIndex] =
+      channel->cicHistory[channel->cicIndex + CIC_TAP_COUNT] = (int32_t)value;
+  if (++channel->cicIndex == CIC_TAP_COUNT)
+    channel->cicIndex = 0;
+  // Oldest output first.
+  const int32_t *x = &channel->cicHistory[channel->cicIndex];
+  const int32_t *c = filterCoefficients_cicCompensationFixed;
+  // Inputs that share a coefficient are added first. Each CIC output is below
+  // 2^29 in magnitude, so the pair sum cannot overflow.
+  int64_t sum = (int64_t)c[CIC_HALF_TAP_COUNT - 1] * x[CIC_HALF_TAP_COUNT - 1];
+  for (uint32_t i = 0; i < CIC_HALF_TAP_COUNT - 1; i++)
+    sum += (int64_t)c[i] * (x[i] + x[CIC_TAP_COUNT - 1 - i]);
+  return filter_saturate32(ROUNDING_SHIFT(sum, CIC_OUTPUT_SHIFT));
+}
+#endif
+
+// Pushes FIR output y onto the FIR output history and returns it.
+static inline int32_t filter_recordFirOutput(int32_t y) {
+  channel->yHistory[channel->yIndex] =
+      channel->yHistory[channel->yIndex + Y_QUEUE_SIZE] = y;
+  channel->yIndex = (channel->yIndex + 1) % Y_QUEUE_SIZE;
+#ifdef FILTER_GATING
+  filter_updateGates(y);
+#endif
+  return y;
+}
+
+// Computes one FIR output from the newest X_QUEUE_SIZE inputs and pushes it
+// onto the FIR output history.
+static inline int32_t filter_computeFirOutput() {
+#ifdef FILTER_CIC
+  return filter_recordFirOutput(filter_computeCicOutput());
+#else
+  const int16_t *x = &channel->xHistory[channel->xIndex]; // Oldest input first.
+  // The generated coefficients are reversed to line up with x.
+  const int32_t *c = filterCoefficients_firFixed;
+  int64_t sum = 0;
+  for (uint32_t i = 0; i < X_QUEUE_SIZE; i++)
+    sum += (int64_t)c[i] * x[i];
+  return filter_recordFirOutput(
+      filter_saturate32(ROUNDING_SHIFT(sum, FIR_OUTPUT_SHIFT)));
+#endif
+}
+
+#ifndef FILTER_CIC
+// Computes the FIR output at a decimation phase from the polyphase branches
+// and pushes it onto the FIR output history. Same result as
+// filter_computeFirOutput(): the integer sum is exact in any order.
+static inline int32_t filter_computePolyphaseOutput() {
+  int64_t sum = 0;
+  for (uint16_t p = 0; p < FIR_PHASE_COUNT; p++) {
+    const int16_t *x = &channel->firBranches[p][channel->firBranchIndex];
+    const int32_t *c = firBranchCoefficients[p];
+    for (uint32_t i = 0; i < FIR_BRANCH_TAP_COUNT; i++)
+      sum += (int64_t)c[i] * x[i];
+  }
+  return filter_recordFirOutput(
+      filter_saturate32(ROUNDING_SHIFT(sum, FIR_OUTPUT_SHIFT)));
+}
+#endif
+
+// Invokes the FIR-filter. Input is contents of xQueue.
+// Output is returned and is also pushed on to yQueue.
+double filter_firFilter() {
+  DETECTOR_PROFILE_START(profile);
+  filter_checkQueues();
+  double output = filter_computeFirOutput() / SIGNAL_SCALE;
+  DETECTOR_PROFILE_STOP(profile, DETECTOR_PROFILE_FIR);
+  return output;
+}
+
+// Decimating FIR-filter for a block of inputs. The inputs are taken one
+// decimation phase at a time: each is converted and dealt to its polyphase
+// branch, and the branches are summed once per phase. With FILTER_CIC, the CIC
+// integrators run on each input and the combs and compensation filter once
+// per phase instead. The outputs in between are never computed.
+size_t filter_firFilterBlock(const double *in, size_t n, double *out) {
+  DETECTOR_PROFILE_START(profile);
+  filter_checkQueues();
+#ifndef FILTER_CIC
+  if (channel->firBranchesStale)
+    filter_rebuildFirBranches();
+#endif
+  size_t outputCount = 0;
+  size_t i = 0;
+  while (i < n) {
+    // The inputs up to the next phase, or to the end of the block.
+    size_t phaseEnd = i + FIR_PHASE_COUNT - channel->firDecimationCount;
+    if (phaseEnd > n)
+      phaseEnd = n;
+    for (; i < phaseEnd; i++) {
+      int16_t x = filter_saturate16(filter_toFixed(in[i], INPUT_SHIFT));
+      filter_storeInput(x);
+#ifndef FILTER_CIC
+      // The newest input of a phase goes to branch 0.
+      uint16_t p = FIR_PHASE_COUNT - 1 - channel->firDecimationCount;
+      channel->firBranches[p][channel->firBranchIndex] =
+          channel->firBranches[p][channel->firBranchIndex +
+                                  FIR_BRANCH_TAP_COUNT] = x;
+#endif
+      channel->firDecimationCount++;
+    }
+    if (channel->firDecimationCount < FIR_PHASE_COUNT)
+      break; // The rest count toward the next output.
+    channel->firDecimationCount = 0;
+#ifdef FILTER_CIC
+    out[outputCount++] = filter_computeFirOutput() / SIGNAL_SCALE;
+#else
+    channel->firBranchIndex =
+        (channel->firBranchIndex + 1) % FIR_BRANCH_TAP_COUNT;
+    out[outputCount++] = filter_computePolyphaseOutput() / SIGNAL_SCALE;
+#endif
+  }
+  DETECTOR_PROFILE_STOP(profile, DETECTOR_PROFILE_FIR);
+  return outputCount;
+}
+
+// Pushes the newest output of filterNumber onto its zQueue and output history
+// and updates the running power with the exact integer difference.
+static inline void filter_recordIirOutput(uint16_t filterNumber, int32_t z) {
+  channel->zHistory[filterNumber][channel->zIndex[filterNumber]] = z;
+  channel->zIndex[filterNumber] =
+      (channel->zIndex[filterNumber] + 1) % Z_QUEUE_SIZE;
+  int32_t newest = (int32_t)ROUNDING_SHIFT((int64_t)z, POWER_SHIFT);
+  int32_t *oldest =
+      &channel->outputHistory[filterNumber][channel->outputIndex[filterNumber]];
+  channel->powerSum[filterNumber] +=
+      (int64_t)newest * newest - (int64_t)(*oldest) * (*oldest);
+  *oldest = newest;
+  channel->outputIndex[filterNumber] =
+      (channel->outputIndex[filterNumber] + 1) % OUTPUT_QUEUE_SIZE;
+}
+
+// Runs the sections of filterNumber on the FIR outputs in0 (newest), in1 and
+// in2 and returns the filter output.
+static inline int32_t filter_computeIirOutput(uint16_t filterNumber,
+                                              int32_t in0, int32_t in1,
+                                              int32_t in2) {
+  for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++) {
+    const int32_t(*c)[FILTER_FREQUENCY_COUNT] =
+        filterCoefficients_iirSosFixed[s];
+    int32_t(*state)[FILTER_FREQUENCY_COUNT] = channel->iirState[s];
+    int32_t y1 = state[IIR_STATE_Y1][filterNumber];
+    int32_t y2 = state[IIR_STATE_Y2][filterNumber];
+    int64_t sum = (int64_t)c[FILTER_IIR_SECTION_B0][filterNumber] * in0 +
+                  (int64_t)c[FILTER_IIR_SECTION_B1][filterNumber] * in1 +
+                  (int64_t)c[FILTER_IIR_SECTION_B2][filterNumber] * in2 -
+                  (int64_t)c[FILTER_IIR_SECTION_A1][filterNumber] * y1 -
+                  (int64_t)c[FILTER_IIR_SECTION_A2][filterNumber] * y2;
+    int32_t out = filter_saturate32(ROUNDING_SHIFT(sum, IIR_OUTPUT_SHIFT));
+    // The previous outputs of this section are the input history of the next.
+    in1 = y1;
+    in2 = y2;
+    state[IIR_STATE_Y2][filterNumber] = y1;
+    state[IIR_STATE_Y1][filterNumber] = out;
+    in0 = out;
+  }
+  return in0;
+}
+
+#ifdef FILTER_GATING
+// Returns FIR output number firOutputCount - age.
+static inline int32_t filter_gateHistoryAt(uint32_t age) {
+  return channel->gateHistory[(channel->gateIndex + GATE_HISTORY_SIZE - age) %
+                              GATE_HISTORY_SIZE];
+}
+
+// Returns the power of filterNumber estimated from its envelope.
+static double filter_gateEstimate(uint16_t filterNumber) {
+  return channel->gateEnvelope[filterNumber] * gateNoiseScale[filterNumber] *
+         OUTPUT_QUEUE_SIZE / POWER_SCALE;
+}
+
+// Returns the power of filterNumber: exact if it is open, estimated from its
+// envelope otherwise.
+static double filter_gatePower(uint16_t filterNumber) {
+  if (channel->gateOpen[filterNumber])
+    return channel->powerSum[filterNumber] / POWER_SCALE;
+  // Until the next evaluation opens it.
+  return fmin(filter_gateEstimate(filterNumber), FILTER_GATING_OPEN_POWER);
+}
+
+// Opens filterNumber and replays the FIR outputs it skipped, from the IIR
+// state it closed with if they are all still in the history.
+static void filter_openGate(uint16_t filterNumber) {
+  uint32_t skipped =
+      channel->firOutputCount - channel->gateClosedAt[filterNumber];
+  // The oldest replayed output needs the two before it as well.
+  if (skipped > GATE_HISTORY_SIZE - 3) {
+    skipped = GATE_HISTORY_SIZE - 3;
+    for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++)
+      channel->iirState[s][IIR_STATE_Y1][filterNumber] =
+          channel->iirState[s][IIR_STATE_Y2][filterNumber] = 0;
+    for (uint32_t i = 0; i < OUTPUT_QUEUE_SIZE; i++)
+      channel->outputHistory[filterNumber][i] = 0;
+    channel->powerSum[filterNumber] = 0;
+  }
+  // The newest output is filtered by the caller's filter_iirFilter() call.
+  for (uint32_t age = skipped; age > 0; age--)
+    filter_recordIirOutput(
+        filterNumber,
+        filter_computeIirOutput(filterNumber, filter_gateHistoryAt(age),
+                                filter_gateHistoryAt(age + 1),
+                                filter_gateHistoryAt(age + 2)));
+  channel->gateOpen[filterNumber] = true;
+  channel->gatingStats[filterNumber].replayedCount += skipped;
+  channel->gatingStats[filterNumber].openCount++;
+  channel->gatingStats[filterNumber].open = true;
+}
+
+// Opens the closed bands whose envelope has risen above
+// FILTER_GATING_OPEN_POWER and closes the open bands whose envelope and exact
+// power have both fallen below FILTER_GATING_CLOSE_POWER.
+static void filter_evaluateGates() {
+  bool allOpen = true;
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    double estimate = filter_gateEstimate(n);
+    if (!channel->gateOpen[n] && estimate > FILTER_GATING_OPEN_POWER) {
+      filter_openGate(n);
+    } else if (channel->gateOpen[n] && channel->gateHoldRemaining == 0 &&
+               estimate < FILTER_GATING_CLOSE_POWER &&
+               filter_gatePower(n) < FILTER_GATING_CLOSE_POWER) {
+      channel->gateOpen[n] = false;
+      // The envelope copy continues from the sections it leaves.
+      for (uint16_t s = 0; s < GATE_ENVELOPE_SECTION_COUNT; s++)
+        for (uint16_t i = 0; i < IIR_STATE_COUNT; i++)
+          channel->gateEnvelopeState[s][i][n] = channel->iirState[s][i][n];
+      // The newest output is skipped.
+      channel->gateClosedAt[n] = channel->firOutputCount;
+      channel->gatingStats[n].closeCount++;
+      channel->gatingStats[n].open = false;
+    }
+    allOpen &= channel->gateOpen[n];
+  }
+  channel->allGatesOpen = allOpen;
+}
+
+// Stores FIR output y in the gate history, evaluates the gates every
+// FILTER_GATING_UPDATE_PERIOD outputs and updates every envelope. An open band
+// takes the newest output of its own first sections, one output late; a closed
+// band runs a copy of them on y.
+static void filter_updateGates(int32_t y) {
+  int32_t in1 = filter_gateHistoryAt(0);
+  int32_t in2 = filter_gateHistoryAt(1);
+  channel->gateIndex = (channel->gateIndex + 1) % GATE_HISTORY_SIZE;
+  channel->gateHistory[channel->gateIndex] = y;
+  channel->firOutputCount++;
+  if (channel->gateHoldRemaining > 0)
+    channel->gateHoldRemaining--;
+  if (gatingEnabled && --channel->gateUpdateCountdown == 0) {
+    channel->gateUpdateCountdown = FILTER_GATING_UPDATE_PERIOD;
+    filter_evaluateGates();
+  }
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    int32_t in0 = channel->iirState[GATE_ENVELOPE_SECTION_COUNT - 1]
+                                   [IIR_STATE_Y1][n];
+    if (!channel->gateOpen[n]) {
+      in0 = y;
+      int32_t x1 = in1, x2 = in2;
+      for (uint16_t s = 0; s < GATE_ENVELOPE_SECTION_COUNT; s++) {
+        const int32_t(*c)[FILTER_FREQUENCY_COUNT] =
+            filterCoefficients_iirSosFixed[s];
+        int32_t(*state)[FILTER_FREQUENCY_COUNT] =
+            channel->gateEnvelopeState[s];
+        int32_t y1 = state[IIR_STATE_Y1][n];
+        int32_t y2 = state[IIR_STATE_Y2][n];
+        int64_t sum = (int64_t)c[FILTER_IIR_SECTION_B0][n] * in0 +
+                      (int64_t)c[FILTER_IIR_SECTION_B1][n] * x1 +
+                      (int64_t)c[FILTER_IIR_SECTION_B2][n] * x2 -
+                      (int64_t)c[FILTER_IIR_SECTION_A1][n] * y1 -
+                      (int64_t)c[FILTER_IIR_SECTION_A2][n] * y2;
+        int32_t out = filter_saturate32(ROUNDING_SHIFT(sum, IIR_OUTPUT_SHIFT));
+        x1 = y1;
+        x2 = y2;
+        state[IIR_STATE_Y2][n] = y1;
+        state[IIR_STATE_Y1][n] = out;
+        in0 = out;
+      }
+    }
+    int64_t value = ROUNDING_SHIFT((int64_t)in0, POWER_SHIFT);
+    channel->gateEnvelope[n] +=
+        (value * value - channel->gateEnvelope[n]) >> GATE_ENVELOPE_SHIFT;
+  }
+}
+
+// Turns gating on or off for every channel. Turning it off opens every band.
+void filter_setGatingEnabled(bool enabled) {
+  filter_checkQueues();
+  gatingEnabled = enabled;
+  if (enabled)
+    return;
+  filter_channelState_t *selected = channel;
+  for (uint16_t c = 0; c < FILTER_CHANNEL_COUNT; c++) {
+    channel = &channelStates[c];
+    for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+      if (!channel->gateOpen[n])
+        filter_openGate(n);
+    channel->allGatesOpen = true;
+  }
+  channel = selected;
+}
+
+// Copies the gating statistics of filterNumber in the selected channel into
+// *stats.
+void filter_getGatingStats(uint16_t filterNumber, filter_gatingStats_t *stats) {
+  *stats = channel->gatingStats[filterNumber];
+}
+
+// filter_iirFilterAll() while some bands are closed: one filter at a time.
+static void filter_iirFilterOpen(double outputs[]) {
+  const int32_t *y = &channel->yHistory[channel->yIndex + Y_QUEUE_SIZE - 1];
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    int32_t z = 0;
+    if (channel->gateOpen[n]) {
+      z = filter_computeIirOutput(n, y[0], y[-1], y[-2]);
+      filter_recordIirOutput(n, z);
+      channel->gatingStats[n].computedCount++;
+    } else {
+      channel->gatingStats[n].skippedCount++;
+    }
+    if (outputs)
+      outputs[n] = z / SIGNAL_SCALE;
+  }
+}
+#endif
+
+// Use this to invoke a single iir filter. Input comes from yQueue.
+// Output is returned and is also pushed onto zQueue[filterNumber].
+double filter_iirFilter(uint16_t filterNumber) {
+  DETECTOR_PROFILE_START(profile);
+  filter_checkQueues();
+#ifdef FILTER_GATING
+  if (!channel->gateOpen[filterNumber]) {
+    channel->gatingStats[filterNumber].skippedCount++;
+    DETECTOR_PROFILE_STOP(profile, DETECTOR_PROFILE_IIR + filterNumber);
+    return 0.0;
+  }
+  channel->gatingStats[filterNumber].computedCount++;
+#endif
+  // Newest three FIR outputs.
+  const int32_t *y = &channel->yHistory[channel->yIndex + Y_QUEUE_SIZE - 1];
+  int32_t z = filter_computeIirOutput(filterNumber, y[0], y[-1], y[-2]);
+  filter_recordIirOutput(filterNumber, z);
+  DETECTOR_PROFILE_STOP(profile, DETECTOR_PROFILE_IIR + filterNumber);
+  return z / SIGNAL_SCALE;
+}
+
+// Runs all FILTER_FREQUENCY_COUNT IIR filters on the newest value in yQueue in
+// a single pass. Same result as calling filter_iirFilter() for each filter
+// number. Outputs are written to outputs[filterNumber]; pass NULL if they are
+// not needed.
+void filter_iirFilterAll(double outputs[]) {
+  DETECTOR_PROFILE_START(profile);
+  filter_checkQueues();
+#ifdef FILTER_GATING
+  if (!channel->allGatesOpen) {
+    filter_iirFilterOpen(outputs);
+    DETECTOR_PROFILE_STOP(profile, DETECTOR_PROFILE_IIR_ALL);
+    return;
+  }
+#endif
+  // Section inputs for every filter: newest first. The first section of every
+  // filter sees the same three FIR outputs.
+  int32_t in0[FILTER_FREQUENCY_COUNT];
+  int32_t in1[FILTER_FREQUENCY_COUNT];
+  int32_t in2[FILTER_FREQUENCY_COUNT];
+  const int32_t *y = &channel->yHistory[channel->yIndex + Y_QUEUE_SIZE - 1];
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    in0[n] = y[0];
+    in1[n] = y[-1];
+    in2[n] = y[-2];
+  }
+  for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++) {
+    const int32_t(*c)[FILTER_FREQUENCY_COUNT] =
+        filterCoefficients_iirSosFixed[s];
+    int32_t *y1 = channel->iirState[s][IIR_STATE_Y1];
+    int32_t *y2 = channel->iirState[s][IIR_STATE_Y2];
+    uint16_t n = 0;
+#ifdef __ARM_NEON
+    // Two filters per iteration; products are accumulated in 64 bits.
+    for (; n + 2 <= FILTER_FREQUENCY_COUNT; n += 2) {
+      int32x2_t vy1 = vld1_s32(&y1[n]);
+      int32x2_t vy2 = vld1_s32(&y2[n]);
+      int64x2_t sum = vmull_s32(vld1_s32(&c[FILTER_IIR_SECTION_B0][n]),
+                                vld1_s32(&in0[n]));
+      sum = vmlal_s32(sum, vld1_s32(&c[FILTER_IIR_SECTION_B1][n]),
+                      vld1_s32(&in1[n]));
+      sum = vmlal_s32(sum, vld1_s32(&c[FILTER_IIR_SECTION_B2][n]),
+                      vld1_s32(&in2[n]));
+      sum = vmlsl_s32(sum, vld1_s32(&c[FILTER_IIR_SECTION_A1][n]), vy1);
+      sum = vmlsl_s32(sum, vld1_s32(&c[FILTER_IIR_SECTION_A2][n]), vy2);
+      // Same rounding and saturation as the scalar code below.
+      int32x2_t out = vqmovn_s64(vrshrq_n_s64(sum, IIR_OUTPUT_SHIFT));
+      vst1_s32(&in1[n], vy1);
+      vst1_s32(&in2[n], vy2);
+      vst1_s32(&y2[n], vy1);
+      vst1_s32(&y1[n], out);
+      vst1_s32(&in0[n], out);
+    }
+#endif
+    // Portable version; also handles an odd filter left over from NEON.
+    for (; n < FILTER_FREQUENCY_COUNT; n++) {
+      int64_t sum = (int64_t)c[FILTER_IIR_SECTION_B0][n] * in0[n] +
+                    (int64_t)c[FILTER_IIR_SECTION_B1][n] * in1[n] +
+                    (int64_t)c[FILTER_IIR_SECTION_B2][n] * in2[n] -
+                    (int64_t)c[FILTER_IIR_SECTION_A1][n] * y1[n] -
+                    (int64_t)c[FILTER_IIR_SECTION_A2][n] * y2[n];
+      int32_t out = filter_saturate32(ROUNDING_SHIFT(sum, IIR_OUTPUT_SHIFT));
+      in1[n] = y1[n];
+      in2[n] = y2[n];
+      y2[n] = y1[n];
+      y1[n] = out;
+      in0[n] = out;
+    }
+  }
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    filter_recordIirOutput(n, in0[n]);
+#ifdef FILTER_GATING
+    channel->gatingStats[n].computedCount++;
+#endif
+    if (outputs)
+      outputs[n] = in0[n] / SIGNAL_SCALE;
+  }
+  DETECTOR_PROFILE_STOP(profile, DETECTOR_PROFILE_IIR_ALL);
+}
+
+// Use this to compute the power for values contained in an outputQueue.
+// The running sum is exact, so forceComputeFromScratch only matters when the
+// output queue has been modified from outside.
+double filter_computePower(uint16_t filterNumber, bool forceComputeFromScratch,
+                           bool debugPrint) {
+  DETECTOR_PROFILE_START(profile);
+  filter_checkQueues();
+  if (forceComputeFromScratch)
+    filter_recomputePowerSum(filterNumber);
+#ifdef FILTER_GATING
+  // The output history of a closed band is stale; it reports its estimate.
+  channel->currentPowerValue[filterNumber] = filter_gatePower(filterNumber);
+#else
+  channel->currentPowerValue[filterNumber] =
+      channel->powerSum[filterNumber] / POWER_SCALE;
+#endif
+  DETECTOR_PROFILE_STOP(profile, DETECTOR_PROFILE_POWER);
+  if (debugPrint)
+    printf("filter_computePower(%d): %le\n", filterNumber,
+           channel->currentPowerValue[filterNumber]);
+  return channel->currentPowerValue[filterNumber];
+}
+
+// Returns the last-computed output power value for the IIR filter
+// [filterNumber].
+double filter_getCurrentPowerValue(uint16_t filterNumber) {
+  return channel->currentPowerValue[filterNumber];
+}
+
+// Sets a current power value for a specific filter number.
+void filter_setCurrentPowerValue(uint16_t filterNumber, double value) {
+  channel->currentPowerValue[filterNumber] = value;
+}
+
+// Get a copy of the current power values.
+void filter_getCurrentPowerValues(double powerValues[]) {
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+    powerValues[n] = channel->currentPowerValue[n];
+}
+
+// Copies the current power values into normalizedArray[] and divides them by
+// the maximum power value.
+void filter_getNormalizedPowerValues(double normalizedArray[],
+                                     uint16_t *indexOfMaxValue) {
+  *indexOfMaxValue = 0;
+  for (uint16_t n = 1; n < FILTER_FREQUENCY_COUNT; n++)
+    if (channel->currentPowerValue[n] >
+        channel->currentPowerValue[*indexOfMaxValue])
+      *indexOfMaxValue = n;
+  double maxValue = channel->currentPowerValue[*indexOfMaxValue];
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+    normalizedArray[n] =
+        maxValue > 0.0 ? channel->currentPowerValue[n] / maxValue : 0.0;
+}
+
+/*******************************************************************************
+***** Verification-Assisting Functions
+*******************************************************************************/
+
+// Returns the array of FIR coefficients.
+const double *filter_getFirCoefficientArray() { return filterCoefficients_fir; }
+
+// Returns the number of FIR coefficients.
+uint32_t filter_getFirCoefficientCount() { return X_QUEUE_SIZE; }
+
+// Returns the array of coefficients for a particular filter number.
+const double *filter_getIirACoefficientArray(uint16_t filterNumber) {
+  return filterCoefficients_iirA[filterNumber];
+}
+
+// Returns the number of A coefficients.
+uint32_t filter_getIirACoefficientCount() { return Z_QUEUE_SIZE; }
+
+// Returns the array of coefficients for a particular filter number.
+const double *filter_getIirBCoefficientArray(uint16_t filterNumber) {
+  return filterCoefficients_iirB[filterNumber];
+}
+
+// Returns the number of B coefficients.
+uint32_t filter_getIirBCoefficientCount() { return Y_QUEUE_SIZE; }
+
+// Returns the size of the yQueue.
+uint32_t filter_getYQueueSize() { return Y_QUEUE_SIZE; }
+
+// Returns the decimation value.
+uint16_t filter_getDecimationValue() { return FILTER_FIR_DECIMATION_FACTOR; }
+
+// Returns the address of xQueue.
+queue_t *filter_getXQueue() {
+  filter_checkQueues();
+  for (uint32_t i = 0; i < X_QUEUE_SIZE; i++)
+    queue_overwritePush(&xQueue,
+                        channel->xHistory[channel->xIndex + i] / INPUT_SCALE);
+  filter_markExported(&xQueue);
+  return &xQueue;
+}
+
+// Returns the address of yQueue.
+queue_t *filter_getYQueue() {
+  filter_checkQueues();
+  filter_exportHistory(&yQueue, channel->yHistory, Y_QUEUE_SIZE,
+                       channel->yIndex, SIGNAL_SCALE);
+  filter_markExported(&yQueue);
+  return &yQueue;
+}
+
+// Returns the address of zQueue for a specific filter number.
+queue_t *filter_getZQueue(uint16_t filterNumber) {
+  filter_checkQueues();
+  filter_exportHistory(&zQueue[filterNumber], channel->zHistory[filterNumber],
+                       Z_QUEUE_SIZE, channel->zIndex[filterNumber],
+                       SIGNAL_SCALE);
+  filter_markExported(&zQueue[filterNumber]);
+  return &zQueue[filterNumber];
+}
+
+// Returns the address of the IIR output-queue for a specific filter-number.
+queue_t *filter_getIirOutputQueue(uint16_t filterNumber) {
+  filter_checkQueues();
+  filter_exportHistory(&outputQueue[filterNumber],
+                       channel->outputHistory[filterNumber], OUTPUT_QUEUE_SIZE,
+                       channel->outputIndex[filterNumber], POWER_SAMPLE_SCALE);
+  filter_markExported(&outputQueue[filterNumber]);
+  return &outputQueue[filterNumber];
+}
+
+#endif /* FILTER_FIXED_POINT */
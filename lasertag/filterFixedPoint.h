@@ -0,0 +1,174 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef FILTERFIXEDPOINT_H_
+#define FILTERFIXEDPOINT_H_
+
+// filterFixedPoint.c is a fixed-point implementation of the filter.h API. It is
+// selected at compile time by defining FILTER_FIXED_POINT (cmake
+// -DFILTER_FIXED_POINT=1) and is then used in place of filter.c. The detector
+// keeps calling the same filter_*() functions.
+//
+// Number formats used by each stage:
+// 1. Inputs are stored as Q15 values. All signals carry
+// FILTER_FIXED_POINT_HEADROOM_BITS of headroom, so a stored value of 1.0
+// represents 4.0. A square wave of +/-1.0 produces FIR and IIR outputs up to
+// about 1.3, which would otherwise saturate.
+// 2. FIR coefficients are Q31. Products are accumulated in 64 bits and the
+// output is rounded and saturated to Q31.
+// 3. The IIR filters are computed as cascaded second-order sections with Q29
+// coefficients (|a1| can approach 2.0) and Q31 state. Each section is
+// pre-scaled for unity peak gain (see filterCoefficients.h), so no
+// intermediate value can overflow. Section state and coefficients are stored
+// structure-of-arrays so that filter_iirFilterAll() can run the whole bank in
+// one pass, two filters per NEON register when built with -mfpu=neon
+// (cmake -DFILTER_NEON=1), and with a scalar loop otherwise.
+// 4. Power is computed from IIR outputs rounded to
+// FILTER_FIXED_POINT_POWER_BITS fractional bits. The running sum of squares is
+// kept in a 64-bit integer. The incremental update is exact, so it never drifts
+// from the from-scratch value.
+// The coefficients in these formats are generated along with the
+// double-precision ones (see filterCoefficients.h); nothing is converted at
+// run time.
+//
+// How much faster this is than the double-precision filter.c on the Cortex-A9,
+// with or without NEON and the block FIR, has not been measured; host timings
+// (tools/filterBenchmark) say nothing about it. To measure it, compare the
+// detector invocations per second shown by
+// runningModes_printRunTimeStatistics() with each filter, or the cycles of each
+// stage with cmake -DDETECTOR_PROFILE=1 (see detectorProfile.h).
+//
+// Defining FILTER_CIC as well (cmake -DFILTER_CIC=1) replaces the 81-tap FIR
+// filter with a CIC decimator and a 9-tap compensation filter (see
+// filterCoefficients.h). The CIC integrators run at the input rate with 32-bit
+// wrap-around adds only. At each FIR output the combs and the compensation
+// filter run once, at 10 kHz: five multiplies, since the coefficients are
+// symmetric, instead of 81. The CIC gain is folded into the Q43 compensation
+// coefficients. The FIR coefficient getters still return the 81-tap design, so
+// the direct-form FIR tests do not apply; filterTest.c compares the cascade's
+// square-wave response with the 81-tap filter instead. Writing to xQueue does
+// not change the CIC state.
+//
+// Defining FILTER_GATING as well (cmake -DFILTER_GATING=1) skips the IIR
+// filters of quiet bands. Each band keeps an envelope: a leaky average of the
+// squared output of its first FILTER_GATING_ENVELOPE_SECTION_COUNT sections,
+// scaled to the power the whole band would have in white noise. An open band
+// takes those outputs from its own IIR filter; a closed band runs a copy of
+// just those sections on every FIR output. Every FILTER_GATING_UPDATE_PERIOD
+// FIR outputs, each band is gated on its own envelope, against fixed powers
+// rather than the other bands:
+// - An open band closes when both its envelope and its exact power are below
+// FILTER_GATING_CLOSE_POWER. Its IIR filter is then skipped (filter_iirFilter()
+// returns 0.0 and leaves the queues alone), and filter_computePower() returns
+// its envelope, at most FILTER_GATING_OPEN_POWER.
+// - A closed band opens when its envelope rises above FILTER_GATING_OPEN_POWER.
+// The FIR outputs it skipped are replayed through its IIR filter from the
+// state it closed with, which gives exactly the outputs and power of an
+// ungated build. Only the newest FILTER_GATING_HISTORY_SIZE FIR outputs are
+// kept. A band closed for longer starts from zero state and replays all of
+// them; the first FILTER_GATING_WARM_UP_SIZE let the start-up transient die
+// out, and its power is then within FILTER_FIXED_POINT_POWER_RELATIVE_EPSILON
+// of the ungated value (the two differ by rounding noise, which does not die
+// out).
+// Two sections keep the envelopes of the other bands below
+// FILTER_GATING_OPEN_POWER during a shot, so only the bands near the shot open.
+// The median of the powers then comes partly from envelopes, so a hit can come
+// a little earlier or later than in an ungated build, or not at all when the
+// largest power is within a few percent of the fudge factor times the median.
+// On captureSynth captures (one shot every 0.5 s, the lockout time, noise from
+// 0.0 to 0.05), the hits are those of an ungated build, up to 7 ms later: the
+// quieter the noise, the more the far bands' envelopes pick up of the shot
+// compared with their whole filters. 42% to 47% of the IIR outputs are not
+// computed (80% at one shot every 3 s), which after the envelope sections of
+// the closed bands saves 19% to 22% of the IIR section work (44% at 3 s). The
+// gates see FIR outputs only, not values written to yQueue; tests that write
+// the queues should call filter_setGatingEnabled(false) first.
+//
+// Built with FILTER_CHANNEL_COUNT above one (cmake -DFILTER_CHANNEL_COUNT=2),
+// every channel (sensor) has its own input, FIR, IIR, power and gating state,
+// and filter_selectChannel() chooses the one the filter.h functions work on.
+// The coefficients and the kernels are shared: filter_iirFilterAll() runs the
+// same vectorized pass over whichever state is selected, so filtering two
+// channels costs twice as much as one and nothing more. The queues belong to
+// the selected channel as well. The gating setting applies to all channels,
+// and each channel gates its own bands against its own median.
+//
+// The verification-assisting queues (filter_getXQueue(), etc.) are not used
+// on the hot path. Calling a getter copies the internal state into the queue
+// as doubles. Anything written to the queue is copied back before the next
+// filter operation, so fetch the queue again after calling a filter function.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define FILTER_FIXED_POINT_HEADROOM_BITS 2
+#define FILTER_FIXED_POINT_INPUT_FRACTION_BITS 15  // Q15 inputs.
+#define FILTER_FIXED_POINT_SIGNAL_FRACTION_BITS 31 // Q31 FIR/IIR signals.
+#define FILTER_FIXED_POINT_FIR_COEFFICIENT_BITS 31 // Q31 FIR coefficients.
+#define FILTER_FIXED_POINT_IIR_COEFFICIENT_BITS 29 // Q29 IIR coefficients.
+#define FILTER_FIXED_POINT_POWER_BITS                                          \
+  19 // IIR outputs keep this many fractional bits for power computation.
+#define FILTER_FIXED_POINT_CIC_COEFFICIENT_BITS                                \
+  43 // CIC compensation coefficients, divided by the CIC gain.
+
+// Documented error bounds, measured against the double-precision coefficients
+// and used by filterTest.c when FILTER_FIXED_POINT is defined.
+// Absolute error of a single FIR output for inputs in [-1.0, 1.0].
+#define FILTER_FIXED_POINT_FIR_EPSILON 1.0E-6
+// Absolute error of a single IIR output for inputs in [-1.0, 1.0].
+#define FILTER_FIXED_POINT_IIR_EPSILON 1.0E-6
+// Relative error of a computed power value.
+#define FILTER_FIXED_POINT_POWER_RELATIVE_EPSILON 1.0E-4
+// Largest difference, at a user frequency, between the square-wave output power
+// of the CIC front end and of the 81-tap FIR filter.
+#define FILTER_FIXED_POINT_CIC_PASSBAND_TOLERANCE_DB 0.1
+
+// Selects the channel, 0 to FILTER_CHANNEL_COUNT - 1, that the filter.h
+// functions work on. filter_init() resets every channel and selects channel 0.
+// Anything written to the queues of the previously selected channel is
+// imported into it first; fetch the queues again after switching.
+void filter_selectChannel(uint16_t channelNumber);
+
+// Returns the selected channel.
+uint16_t filter_getSelectedChannel();
+
+#ifdef FILTER_GATING
+#define FILTER_GATING_UPDATE_PERIOD 16 // FIR outputs between gate evaluations.
+// Band powers, as filter_computePower() returns them, that open and close a
+// gate. A square wave of 0.005 of full scale at a band's frequency gives it
+// 0.04; the noise in captureSynth's default capture, 0.002 to 0.01.
+#define FILTER_GATING_OPEN_POWER 0.02
+#define FILTER_GATING_CLOSE_POWER 0.01
+#define FILTER_GATING_ENVELOPE_SECTION_COUNT 2
+#define FILTER_GATING_WARM_UP_SIZE 6000
+#define FILTER_GATING_HISTORY_SIZE                                             \
+  (FILTER_INPUT_PULSE_WIDTH + FILTER_GATING_WARM_UP_SIZE)
+
+// Gating statistics for one band, counted in FIR outputs since filter_init().
+// The IIR work saved is skippedCount - replayedCount.
+typedef struct {
+  uint32_t computedCount; // IIR outputs computed as the FIR outputs arrived.
+  uint32_t skippedCount;  // FIR outputs skipped while the band was closed.
+  uint32_t replayedCount; // IIR outputs computed when the band opened again.
+  uint32_t closeCount;
+  uint32_t openCount; // Times the band opened again after closing.
+  bool open;
+} filter_gatingStats_t;
+
+// Turns gating on or off for every channel. Turning it off opens every band.
+// Gating is on by default and filter_init() does not change the setting, but
+// no band closes until FILTER_GATING_HISTORY_SIZE FIR outputs have been seen.
+void filter_setGatingEnabled(bool enabled);
+
+// Copies the gating statistics of filterNumber in the selected channel into
+// *stats.
+void filter_getGatingStats(uint16_t filterNumber, filter_gatingStats_t *stats);
+#endif
+
+#endif /* FILTERFIXEDPOINT_H_ */
@@ -0,0 +1,172 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "filter.h"
+#include "filterPower.h"
+
+// A compensated sum: the true sum is sum + compensation.
+typedef struct {
+  double sum;
+  double compensation;
+} filterPower_sum_t;
+
+static uint32_t windowLength;
+// Sum of squares of the whole window, updated incrementally.
+static filterPower_sum_t runningSum[FILTER_FREQUENCY_COUNT];
+// Sum of squares of the newest shadowCount values.
+static filterPower_sum_t shadowSum[FILTER_FREQUENCY_COUNT];
+static uint32_t shadowCount[FILTER_FREQUENCY_COUNT];
+static double lastRebaseError[FILTER_FREQUENCY_COUNT];
+static double maxRebaseError;
+static uint32_t rebaseCount;
+
+// Adds value to s with Kahan-Neumaier compensation.
+static inline void filterPower_add(filterPower_sum_t *s, double value) {
+  double t = s->sum + value;
+  if (fabs(s->sum) >= fabs(value))
+    s->compensation += (s->sum - t) + value;
+  else
+    s->compensation += (value - t) + s->sum;
+  s->sum = t;
+}
+
+// Returns the value of a compensated sum.
+static inline double filterPower_value(const filterPower_sum_t *s) {
+  return s->sum + s->compensation;
+}
+
+// Must be called before use. Assumes the windows start out filled with zeros.
+void filterPower_init(uint32_t length) {
+  windowLength = length;
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    runningSum[n] = (filterPower_sum_t){0.0, 0.0};
+    shadowSum[n] = (filterPower_sum_t){0.0, 0.0};
+    // The windows are all zeros, so any number of the newest values sum to
+    // zero. Start each shadow part-way through so the rebases are staggered.
+    shadowCount[n] = (n * length) / FILTER_FREQUENCY_COUNT;
+    lastRebaseError[n] = 0.0;
+  }
+  maxRebaseError = 0.0;
+  rebaseCount = 0;
+}
+
+// Updates the power of filterNumber after newest has been added to its window
+// and oldest has been pushed out. Returns the new power value.
+double filterPower_update(uint16_t filterNumber, double newest, double oldest) {
+  double newestSquared = newest * newest;
+  filterPower_add(&runningSum[filterNumber], newestSquared);
+  filterPower_add(&runningSum[filterNumber], -(oldest * oldest));
+  filterPower_add(&shadowSum[filterNumber], newestSquared);
+  // Once the shadow covers the whole window it is a from-scratch sum.
+  if (++shadowCount[filterNumber] == windowLength) {
+    double error = filterPower_value(&runningSum[filterNumber]) -
+                   filterPower_value(&shadowSum[filterNumber]);
+    lastRebaseError[filterNumber] = error;
+    if (fabs(error) > maxRebaseError)
+      maxRebaseError = fabs(error);
+    rebaseCount++;
+    runningSum[filterNumber] = shadowSum[filterNumber];
+    shadowSum[filterNumber] = (filterPower_sum_t){0.0, 0.0};
+    shadowCount[filterNumber] = 0;
+  }
+  return filterPower_value(&runningSum[filterNumber]);
+}
+
+// Returns the current power value of filterNumber.
+double filterPower_getPower(uint16_t filterNumber) {
+  return filterPower_value(&runningSum[filterNumber]);
+}
+
+// Sets the power of filterNumber to a value computed elsewhere. The shadow sum
+// only depends on the window, so it is left alone to keep the stagger.
+void filterPower_setPower(uint16_t filterNumber, double power) {
+  runningSum[filterNumber] = (filterPower_sum_t){power, 0.0};
+}
+
+// Returns the error that had accumulated at the last rebase of filterNumber.
+double filterPower_getLastRebaseError(uint16_t filterNumber) {
+  return lastRebaseError[filterNumber];
+}
+
+// Returns the largest rebase error seen since filterPower_init().
+double filterPower_getMaxRebaseError() { return maxRebaseError; }
+
+// Returns the number of rebases performed since filterPower_init().
+uint32_t filterPower_getRebaseCount() { return rebaseCount; }
+
+#define TEST_WINDOW_LENGTH FILTER_INPUT_PULSE_WIDTH
+#define TEST_UPDATE_COUNT 1000000 // About 100 seconds of decimated samples.
+#define TEST_BURST_PERIOD 5000    // Alternate loud and quiet bursts.
+#define TEST_LOUD_AMPLITUDE 1000.0
+#define TEST_QUIET_AMPLITUDE 0.001
+#define TEST_RELATIVE_EPSILON 1.0E-12
+#define TEST_FILTER_NUMBER 0
+#define TEST_STAGGER_FILTER_NUMBER (FILTER_FREQUENCY_COUNT / 2)
+#define TEST_STAGGER_VALUE 1.0
+// Runs a long random sequence that alternates between loud and quiet bursts,
+// which is the worst case for an incremental sum: the quiet power is tiny
+// compared to the rounding error left behind by the loud values.
+bool filterPower_runTest() {
+  static double window[TEST_WINDOW_LENGTH];
+  uint32_t oldestIndex = 0;
+  double naiveSum = 0.0;
+  bool success = true; // Be optimistic.
+  for (uint32_t i = 0; i < TEST_WINDOW_LENGTH; i++)
+    window[i] = 0.0;
+  filterPower_init(TEST_WINDOW_LENGTH);
+  for (uint32_t i = 0; i < TEST_UPDATE_COUNT; i++) {
+    double amplitude = ((i / TEST_BURST_PERIOD) % 2) ? TEST_QUIET_AMPLITUDE
+                                                     : TEST_LOUD_AMPLITUDE;
+    double newest = amplitude * (((double)rand() / RAND_MAX) - 0.5);
+    double oldest = window[oldestIndex];
+    window[oldestIndex] = newest;
+    oldestIndex = (oldestIndex + 1) % TEST_WINDOW_LENGTH;
+    naiveSum += newest * newest - oldest * oldest;
+    filterPower_update(TEST_FILTER_NUMBER, newest, oldest);
+  }
+  double goldenSum = 0.0;
+  for (uint32_t i = 0; i < TEST_WINDOW_LENGTH; i++)
+    goldenSum += window[i] * window[i];
+  double trackedSum = filterPower_getPower(TEST_FILTER_NUMBER);
+  double trackedError = fabs(trackedSum - goldenSum) / goldenSum;
+  double naiveError = fabs(naiveSum - goldenSum) / goldenSum;
+  printf("filterPower_runTest: from scratch: %le, tracked: %le (relative error "
+         "%le), uncompensated: %le (relative error %le).\n",
+         goldenSum, trackedSum, trackedError, naiveSum, naiveError);
+  printf("filterPower_runTest: %lu rebases, max rebase error %le.\n",
+         (unsigned long)filterPower_getRebaseCount(),
+         filterPower_getMaxRebaseError());
+  if (trackedError > TEST_RELATIVE_EPSILON)
+    success = false;
+
+  // filterPower_setPower() must not move the rebase of a filter: it still
+  // comes when the shadow started by filterPower_init() covers the window.
+  filterPower_init(TEST_WINDOW_LENGTH);
+  uint32_t rebaseUpdate = TEST_WINDOW_LENGTH -
+                          (TEST_STAGGER_FILTER_NUMBER * TEST_WINDOW_LENGTH) /
+                              FILTER_FREQUENCY_COUNT;
+  for (uint32_t i = 1; i <= rebaseUpdate; i++) {
+    filterPower_setPower(TEST_STAGGER_FILTER_NUMBER, 0.0);
+    filterPower_update(TEST_STAGGER_FILTER_NUMBER, TEST_STAGGER_VALUE, 0.0);
+    if (filterPower_getRebaseCount() != (i == rebaseUpdate)) {
+      printf("filterPower_runTest: %lu rebases after %lu updates, expected "
+             "the first after %lu.\n",
+             (unsigned long)filterPower_getRebaseCount(), (unsigned long)i,
+             (unsigned long)rebaseUpdate);
+      success = false;
+      break;
+    }
+  }
+  printf("filterPower_runTest %s.\n", success ? "passed" : "failed");
+  return success;
+}
@@ -0,0 +1,69 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef FILTERPOWER_H_
+#define FILTERPOWER_H_
+
+// Sliding-window power tracking for the double-precision filters. Intended to
+// be called from filter_computePower() in filter.c so that power never needs to
+// be recomputed from scratch while the game is running. Nothing in this tree
+// calls it: filter.c is written in the labs, filterFixedPoint.c keeps exact
+// integer sums and filterSlidingDft.c tracks its bins itself.
+//
+// Each filter keeps a running sum of squares that is updated with
+// newest^2 - oldest^2 using Kahan-Neumaier compensated addition, which keeps
+// the rounding error from growing with the number of updates.
+//
+// Each filter also keeps a shadow sum that only ever adds newest^2. Once it
+// has seen a full window of values it holds the from-scratch sum of the current
+// window, so the running sum is replaced with it (a rebase) and the shadow
+// starts over. This costs one extra addition per update instead of a
+// window-length loop. The filters start their shadows at different times so
+// that at most one filter rebases on any given update.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Must be called before use. windowLength is the number of values in the
+// power window (the size of the IIR output queues). Assumes the windows start
+// out filled with zeros, as filter_init() leaves them.
+void filterPower_init(uint32_t windowLength);
+
+// Updates the power of filterNumber after newest has been added to its window
+// and oldest has been pushed out. Returns the new power value.
+double filterPower_update(uint16_t filterNumber, double newest, double oldest);
+
+// Returns the current power value of filterNumber.
+double filterPower_getPower(uint16_t filterNumber);
+
+// Sets the power of filterNumber to a value computed elsewhere, for example a
+// from-scratch computation of the same window. The shadow sum carries on, so
+// the rebases stay staggered. After the windows are refilled with zeros, call
+// filterPower_init() instead.
+void filterPower_setPower(uint16_t filterNumber, double power);
+
+// Returns the difference between the running sum and the shadow sum at the
+// last rebase of filterNumber, i.e., the error that had accumulated.
+double filterPower_getLastRebaseError(uint16_t filterNumber);
+
+// Returns the largest rebase error seen on any filter since
+// filterPower_init().
+double filterPower_getMaxRebaseError();
+
+// Returns the number of rebases performed on all filters since
+// filterPower_init().
+uint32_t filterPower_getRebaseCount();
+
+// Runs a long random sequence through filterPower_update() and compares the
+// result against a from-scratch sum, and against a plain uncompensated
+// incremental sum. Returns true if the tracked power stays within a small
+// relative error of the from-scratch value.
+bool filterPower_runTest();
+
+#endif /* FILTERPOWER_H_ */
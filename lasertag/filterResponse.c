@@ -0,0 +1,126 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Steady-state square-wave response of the filters. See filterResponse.h.
+
+#include <complex.h>
+#include <math.h>
+
+#include "filterResponse.h"
+
+#define CIC_STAGE_LENGTH FILTER_FIR_DECIMATION_FACTOR // Moving-sum length.
+
+// Fills x[] with one period of the filterTest.c square wave.
+void filterResponse_squareWave(uint16_t period, double x[]) {
+  for (uint16_t n = 0; n < period; n++)
+    x[n] = (n < period / 2) ? -1.0 : 1.0;
+}
+
+// Computes one period of the steady-state output of the filter with impulse
+// response h[] for the periodic input x[].
+void filterResponse_impulseResponseOutput(const double h[], uint32_t length,
+                                          const double x[], uint16_t period,
+                                          double y[]) {
+  // Fold the impulse response onto one period.
+  double folded[FILTER_RESPONSE_MAX_PERIOD] = {0.0};
+  for (uint32_t i = 0; i < length; i++)
+    folded[i % period] += h[i];
+  for (uint16_t n = 0; n < period; n++) {
+    double sum = 0.0;
+    for (uint16_t i = 0; i < period; i++)
+      sum += folded[i] * x[(n + period - i) % period];
+    y[n] = sum;
+  }
+}
+
+// Computes one period of the steady-state output of the IIR filter b/a for the
+// periodic input x[], from its transfer function at the harmonics of x[].
+void filterResponse_transferFunctionOutput(const double b[], uint16_t bCount,
+                                           const double a[], uint16_t aCount,
+                                           const double x[], uint16_t period,
+                                           double y[]) {
+  // twiddle[k] = exp(-j 2 pi k / period); every exponential below is one of
+  // these.
+  double complex twiddle[FILTER_RESPONSE_MAX_PERIOD];
+  for (uint16_t k = 0; k < period; k++)
+    twiddle[k] = cexp(-I * 2.0 * M_PI * k / period);
+  double complex output[FILTER_RESPONSE_MAX_PERIOD]; // Output harmonics.
+  for (uint16_t k = 0; k < period; k++) {
+    double complex input = 0.0;
+    for (uint16_t n = 0; n < period; n++)
+      input += x[n] * twiddle[(uint32_t)k * n % period];
+    double complex numerator = 0.0;
+    for (uint16_t i = 0; i < bCount; i++)
+      numerator += b[i] * twiddle[(uint32_t)k * i % period];
+    double complex denominator = 1.0;
+    for (uint16_t i = 0; i < aCount; i++)
+      denominator += a[i] * twiddle[(uint32_t)k * (i + 1) % period];
+    output[k] = input * numerator / denominator;
+  }
+  for (uint16_t n = 0; n < period; n++) {
+    double complex sum = 0.0;
+    for (uint16_t k = 0; k < period; k++)
+      sum += output[k] * conj(twiddle[(uint32_t)k * n % period]);
+    y[n] = creal(sum) / period;
+  }
+}
+
+// Returns the greatest common divisor of a and b.
+static uint16_t filterResponse_gcd(uint16_t a, uint16_t b) {
+  while (b) {
+    uint16_t remainder = a % b;
+    a = b;
+    b = remainder;
+  }
+  return a;
+}
+
+// Writes one period of y[] decimated by factor, starting at phase, to z[] and
+// returns its period.
+uint16_t filterResponse_decimate(const double y[], uint16_t period,
+                                 uint16_t factor, uint16_t phase, double z[]) {
+  uint16_t decimatedPeriod = period / filterResponse_gcd(period, factor);
+  for (uint16_t m = 0; m < decimatedPeriod; m++)
+    z[m] = y[(phase + (uint32_t)factor * m) % period];
+  return decimatedPeriod;
+}
+
+// Returns the mean of the squares of values[].
+double filterResponse_meanSquare(const double values[], uint16_t count) {
+  double sum = 0.0;
+  for (uint16_t i = 0; i < count; i++)
+    sum += values[i] * values[i];
+  return sum / count;
+}
+
+// Computes the impulse response at the input rate of the CIC front end.
+void filterResponse_cicImpulseResponse(
+    const double compensation[FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT],
+    double h[FILTER_RESPONSE_CIC_IMPULSE_RESPONSE_LENGTH]) {
+  // The CIC decimator is FILTER_CIC_STAGE_COUNT moving sums, one after the
+  // other, followed by decimation.
+  double cic[FILTER_RESPONSE_CIC_IMPULSE_RESPONSE_LENGTH] = {1.0};
+  uint16_t cicLength = 1;
+  for (uint16_t s = 0; s < FILTER_CIC_STAGE_COUNT; s++) {
+    cicLength += CIC_STAGE_LENGTH - 1;
+    for (int16_t n = cicLength - 1; n >= 0; n--) {
+      double sum = 0.0;
+      for (int16_t i = 0; i < CIC_STAGE_LENGTH && i <= n; i++)
+        sum += cic[n - i];
+      cic[n] = sum / CIC_STAGE_LENGTH;
+    }
+  }
+  // The compensation filter at the decimated rate is, at the input rate, the
+  // same filter with FILTER_FIR_DECIMATION_FACTOR - 1 zeros between taps.
+  for (uint16_t n = 0; n < FILTER_RESPONSE_CIC_IMPULSE_RESPONSE_LENGTH; n++)
+    h[n] = 0.0;
+  for (uint16_t k = 0; k < FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT; k++)
+    for (uint16_t n = 0; n < cicLength; n++)
+      h[k * FILTER_FIR_DECIMATION_FACTOR + n] += compensation[k] * cic[n];
+}
@@ -0,0 +1,71 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef FILTERRESPONSE_H_
+#define FILTERRESPONSE_H_
+
+// Steady-state response of the filters to the periodic square waves that
+// filterTest.c uses, computed directly instead of by simulation. A filter's
+// steady-state output for an input with a period of P samples is also periodic
+// with period P, and only depends on the filter's transfer function at the P
+// harmonics of the input. Given an impulse response h, that is the same as
+// folding h onto one period (adding h[n + kP] into h[n]) and convolving
+// circularly with one period of the input. Given direct-form coefficients, the
+// transfer function is evaluated at the harmonics instead. Either way, a period
+// of at most FILTER_RESPONSE_MAX_PERIOD samples costs at most P * P
+// multiplies, whatever the filter's length.
+
+#include <stdint.h>
+
+#include "filter.h"
+#include "filterCoefficients.h"
+
+#define FILTER_RESPONSE_MAX_PERIOD 128
+// Length of the impulse response of the CIC front end at the input rate: the
+// CIC decimator, then the compensation filter at the decimated rate.
+#define FILTER_RESPONSE_CIC_IMPULSE_RESPONSE_LENGTH                            \
+  (FILTER_CIC_STAGE_COUNT * (FILTER_FIR_DECIMATION_FACTOR - 1) + 1 +           \
+   (FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT - 1) *                           \
+       FILTER_FIR_DECIMATION_FACTOR)
+
+// Fills x[] with one period of the filterTest.c square wave: -1.0 for the first
+// period / 2 samples and 1.0 for the rest.
+void filterResponse_squareWave(uint16_t period, double x[]);
+
+// Computes y[], one period of the steady-state output of the filter with
+// impulse response h[] (length values, h[0] first) for the periodic input whose
+// period is x[]. y[n] is the output after input x[n].
+void filterResponse_impulseResponseOutput(const double h[], uint32_t length,
+                                          const double x[], uint16_t period,
+                                          double y[]);
+
+// Same as filterResponse_impulseResponseOutput() for the IIR filter with
+// direct-form coefficients b[] and a[] (without the leading 1), from its
+// transfer function.
+void filterResponse_transferFunctionOutput(const double b[], uint16_t bCount,
+                                           const double a[], uint16_t aCount,
+                                           const double x[], uint16_t period,
+                                           double y[]);
+
+// Writes z[m] = y[(phase + factor * m) % period], one period of y[] decimated
+// by factor, and returns the period of z[].
+uint16_t filterResponse_decimate(const double y[], uint16_t period,
+                                 uint16_t factor, uint16_t phase, double z[]);
+
+// Returns the mean of the squares of values[].
+double filterResponse_meanSquare(const double values[], uint16_t count);
+
+// Computes the impulse response at the input rate of the CIC front end (see
+// filterCoefficients.h), divided by the CIC gain. Decimating its output is the
+// same as decimating the CIC output and then running the compensation filter.
+void filterResponse_cicImpulseResponse(
+    const double compensation[FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT],
+    double h[FILTER_RESPONSE_CIC_IMPULSE_RESPONSE_LENGTH]);
+
+#endif /* FILTERRESPONSE_H_ */
@@ -0,0 +1,503 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Sliding-DFT implementation of filter.h. See filterSlidingDft.h for how the
+// bins are computed. Only compiled when FILTER_SLIDING_DFT is defined, in which
+// case filter.c must be left out of the build.
+#ifdef FILTER_SLIDING_DFT
+
+#if defined(FILTER_FIXED_POINT)
+#error "Define only one of FILTER_FIXED_POINT and FILTER_SLIDING_DFT."
+#endif
+#ifdef FILTER_CIC
+#error "FILTER_CIC is only implemented by filterFixedPoint.c."
+#endif
+#if defined(FILTER_CHANNEL_COUNT) && FILTER_CHANNEL_COUNT > 1
+#error "More than one channel is only implemented by filterFixedPoint.c."
+#endif
+
+#include <math.h>
+#include <stdio.h>
+
+#include "detectorProfile.h"
+#include "filter.h"
+#include "filterCoefficients.h"
+#include "filterSlidingDft.h"
+
+#define X_QUEUE_SIZE FILTER_FIR_COEFFICIENT_COUNT
+#define Y_QUEUE_SIZE FILTER_IIR_B_COEFFICIENT_COUNT
+#define Z_QUEUE_SIZE FILTER_IIR_A_COEFFICIENT_COUNT
+#define WINDOW_SIZE FILTER_SLIDING_DFT_WINDOW_SIZE
+#define QUEUE_INIT_VALUE 0.0
+
+// FIR outputs are kept in a ring that holds the window plus the catch-up
+// samples. Its size must be a power of two.
+#define HISTORY_SIZE (WINDOW_SIZE + FILTER_SLIDING_DFT_CATCH_UP_COUNT)
+#define HISTORY_INDEX_MASK (HISTORY_SIZE - 1)
+#if (HISTORY_SIZE & HISTORY_INDEX_MASK) != 0
+#error "The sliding DFT window plus catch-up count must be a power of two."
+#endif
+
+// Largest number of decimated samples before e^(-jwn) repeats.
+#define PHASE_TABLE_SIZE 128
+#define TWO_PI (2.0 * M_PI)
+// Converts |X|^2 to the sum-of-squares power of a sinusoid in the bin.
+#define POWER_SCALE (2.0 / WINDOW_SIZE)
+// Converts the real part of a bin to the amplitude of a sinusoid in the bin.
+#define OUTPUT_SCALE (2.0 / WINDOW_SIZE)
+
+/*******************************************************************************
+***** Internal state
+*******************************************************************************/
+
+// The input history is stored twice, back to back, so that the newest
+// X_QUEUE_SIZE inputs are always contiguous starting at xIndex.
+static double xHistory[2 * X_QUEUE_SIZE];
+static uint32_t xIndex;
+// Inputs received by filter_firFilterBlock() since its last output.
+static uint16_t firDecimationCount;
+// FIR coefficients, reversed so the oldest input lines up with index 0.
+static double firCoefficients[X_QUEUE_SIZE];
+
+// FIR output number n is stored at firOutputs[n & HISTORY_INDEX_MASK].
+static double firOutputs[HISTORY_SIZE];
+static uint32_t firOutputCount;
+
+// e^(-jwn) for each bin, indexed by n modulo phasePeriod[].
+static double phaseCos[FILTER_FREQUENCY_COUNT][PHASE_TABLE_SIZE];
+static double phaseSin[FILTER_FREQUENCY_COUNT][PHASE_TABLE_SIZE];
+static uint16_t phasePeriod[FILTER_FREQUENCY_COUNT];
+// WINDOW_SIZE modulo phasePeriod[]: the phase step back to the sample that
+// leaves the window.
+static uint16_t windowPhaseShift[FILTER_FREQUENCY_COUNT];
+
+// The bins. binCount[] is the number of FIR outputs included so far and
+// binPhase[] is binCount[] modulo phasePeriod[].
+static double binReal[FILTER_FREQUENCY_COUNT];
+static double binImaginary[FILTER_FREQUENCY_COUNT];
+static uint32_t binCount[FILTER_FREQUENCY_COUNT];
+static uint16_t binPhase[FILTER_FREQUENCY_COUNT];
+
+// Most recent band-pass outputs, for filter_getZQueue().
+static double zHistory[FILTER_FREQUENCY_COUNT][Z_QUEUE_SIZE];
+static uint32_t zIndex[FILTER_FREQUENCY_COUNT];
+static double currentPowerValue[FILTER_FREQUENCY_COUNT];
+
+// See filter_getFudgeFactorScale().
+static double fudgeFactorScale;
+
+// Queues handed out by the verification-assisting functions.
+static queue_t xQueue;
+static queue_t yQueue;
+static queue_t zQueue[FILTER_FREQUENCY_COUNT];
+// Set when xQueue has been handed out and may have been modified.
+static bool xQueueExported;
+
+/*******************************************************************************
+***** Sliding DFT
+*******************************************************************************/
+
+// Returns the greatest common divisor of a and b.
+static uint16_t filter_greatestCommonDivisor(uint16_t a, uint16_t b) {
+  while (b != 0) {
+    uint16_t remainder = a % b;
+    a = b;
+    b = remainder;
+  }
+  return a;
+}
+
+// Fills the phase tables. A user frequency has a period of tickCount input
+// samples, so w = 2*pi*FILTER_FIR_DECIMATION_FACTOR/tickCount radians per FIR
+// output, and e^(-jwn) repeats every tickCount/gcd(tickCount, decimation) FIR
+// outputs.
+static void filter_initPhaseTables() {
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    uint16_t tickCount = filter_frequencyTickTable[n];
+    phasePeriod[n] =
+        tickCount /
+        filter_greatestCommonDivisor(tickCount, FILTER_FIR_DECIMATION_FACTOR);
+    if (phasePeriod[n] > PHASE_TABLE_SIZE) {
+      printf("filter_init: phase period %d of frequency %d is too long.\n",
+             phasePeriod[n], n);
+      phasePeriod[n] = PHASE_TABLE_SIZE;
+    }
+    double w = TWO_PI * FILTER_FIR_DECIMATION_FACTOR / tickCount;
+    for (uint16_t i = 0; i < phasePeriod[n]; i++) {
+      phaseCos[n][i] = cos(w * i);
+      phaseSin[n][i] = sin(w * i);
+    }
+    windowPhaseShift[n] = WINDOW_SIZE % phasePeriod[n];
+  }
+}
+
+// Computes fudgeFactorScale from the IIR design: W/2 times the mean energy of
+// the IIR filters' impulse responses, which have died out within a window, is
+// the ratio of the mean noise powers. The power of a bin is the squared
+// magnitude of one complex sum, so its noise is exponentially distributed and
+// the median is ln 2 of the mean; the IIR powers sum many outputs and their
+// median is close to their mean.
+static void filter_initFudgeFactorScale() {
+  static double iirOutputs[WINDOW_SIZE];
+  double energy = 0.0;
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    const double *a = filterCoefficients_iirA[n]; // Without the leading 1.
+    const double *b = filterCoefficients_iirB[n];
+    for (uint32_t i = 0; i < WINDOW_SIZE; i++) {
+      double z = i < Y_QUEUE_SIZE ? b[i] : 0.0; // Impulse at i = 0.
+      for (uint32_t k = 1; k <= Z_QUEUE_SIZE && k <= i; k++)
+        z -= a[k - 1] * iirOutputs[i - k];
+      iirOutputs[i] = z;
+      energy += z * z;
+    }
+  }
+  fudgeFactorScale = WINDOW_SIZE / 2.0 * energy / FILTER_FREQUENCY_COUNT /
+                     M_LN2 * FILTER_SLIDING_DFT_DETECTION_MARGIN;
+}
+
+// Returns phase - step, modulo the period of filterNumber. step must be less
+// than the period.
+static inline uint16_t filter_phaseBack(uint16_t filterNumber, uint16_t phase,
+                                        uint16_t step) {
+  return phase >= step ? phase - step
+                       : phase + phasePeriod[filterNumber] - step;
+}
+
+// Recomputes a bin from the FIR outputs in the window.
+static void filter_recomputeBin(uint16_t filterNumber) {
+  uint32_t lag = firOutputCount - binCount[filterNumber];
+  binPhase[filterNumber] =
+      (binPhase[filterNumber] + lag) % phasePeriod[filterNumber];
+  uint16_t phase = filter_phaseBack(filterNumber, binPhase[filterNumber],
+                                    windowPhaseShift[filterNumber]);
+  double real = 0.0, imaginary = 0.0;
+  for (uint32_t i = 0; i < WINDOW_SIZE; i++) {
+    double y = firOutputs[(firOutputCount - WINDOW_SIZE + i) &
+                          HISTORY_INDEX_MASK];
+    real += y * phaseCos[filterNumber][phase];
+    imaginary -= y * phaseSin[filterNumber][phase];
+    if (++phase == phasePeriod[filterNumber])
+      phase = 0;
+  }
+  binReal[filterNumber] = real;
+  binImaginary[filterNumber] = imaginary;
+  binCount[filterNumber] = firOutputCount;
+}
+
+// Brings a bin up to date with all FIR outputs. Usually this is one sliding
+// update; a bin that fell more than FILTER_SLIDING_DFT_CATCH_UP_COUNT outputs
+// behind is recomputed.
+static void filter_updateBin(uint16_t filterNumber) {
+  if (firOutputCount - binCount[filterNumber] >
+      FILTER_SLIDING_DFT_CATCH_UP_COUNT) {
+    filter_recomputeBin(filterNumber);
+    return;
+  }
+  const double *cosTable = phaseCos[filterNumber];
+  const double *sinTable = phaseSin[filterNumber];
+  double real = binReal[filterNumber];
+  double imaginary = binImaginary[filterNumber];
+  uint32_t count = binCount[filterNumber];
+  uint16_t phase = binPhase[filterNumber];
+  while (count != firOutputCount) {
+    double newest = firOutputs[count & HISTORY_INDEX_MASK];
+    double oldest = firOutputs[(count - WINDOW_SIZE) & HISTORY_INDEX_MASK];
+    uint16_t oldestPhase =
+        filter_phaseBack(filterNumber, phase, windowPhaseShift[filterNumber]);
+    real += newest * cosTable[phase] - oldest * cosTable[oldestPhase];
+    imaginary -= newest * sinTable[phase] - oldest * sinTable[oldestPhase];
+    if (++phase == phasePeriod[filterNumber])
+      phase = 0;
+    count++;
+  }
+  binReal[filterNumber] = real;
+  binImaginary[filterNumber] = imaginary;
+  binCount[filterNumber] = count;
+  binPhase[filterNumber] = phase;
+}
+
+// Returns the band-pass output of a bin for the newest FIR output: the real
+// part of the bin rotated back to the current sample.
+static inline double filter_binOutput(uint16_t filterNumber) {
+  uint16_t phase = filter_phaseBack(filterNumber, binPhase[filterNumber], 1);
+  return OUTPUT_SCALE *
+         (binReal[filterNumber] * phaseCos[filterNumber][phase] -
+          binImaginary[filterNumber] * phaseSin[filterNumber][phase]);
+}
+
+// Updates a bin and records its output.
+static inline double filter_runBin(uint16_t filterNumber) {
+  filter_updateBin(filterNumber);
+  double z = filter_binOutput(filterNumber);
+  zHistory[filterNumber][zIndex[filterNumber]] = z;
+  zIndex[filterNumber] = (zIndex[filterNumber] + 1) % Z_QUEUE_SIZE;
+  return z;
+}
+
+/*******************************************************************************
+***** Queue import
+*******************************************************************************/
+
+// Copies anything written to xQueue back into the FIR input history. Call at
+// the start of each FIR operation.
+static inline void filter_checkXQueue() {
+  if (!xQueueExported)
+    return;
+  queue_size_t count = queue_elementCount(&xQueue);
+  for (uint32_t i = 0; i < X_QUEUE_SIZE; i++) {
+    // Missing values (xQueue holds fewer than X_QUEUE_SIZE) are read as zero.
+    uint32_t missing = X_QUEUE_SIZE - count;
+    xHistory[i] = xHistory[i + X_QUEUE_SIZE] =
+        (count >= X_QUEUE_SIZE || i >= missing)
+            ? queue_readElementAt(&xQueue, count - X_QUEUE_SIZE + i)
+            : 0.0;
+  }
+  xIndex = 0;
+  xQueueExported = false;
+}
+
+/*******************************************************************************
+***** Main Filter Functions
+*******************************************************************************/
+
+// Must call this prior to using any filter functions.
+void filter_init() {
+  for (uint32_t i = 0; i < X_QUEUE_SIZE; i++)
+    firCoefficients[i] = filterCoefficients_fir[X_QUEUE_SIZE - 1 - i];
+  for (uint32_t i = 0; i < 2 * X_QUEUE_SIZE; i++)
+    xHistory[i] = QUEUE_INIT_VALUE;
+  xIndex = 0;
+  firDecimationCount = 0;
+  for (uint32_t i = 0; i < HISTORY_SIZE; i++)
+    firOutputs[i] = QUEUE_INIT_VALUE;
+  firOutputCount = 0;
+  filter_initPhaseTables();
+  filter_initFudgeFactorScale();
+  queue_init(&xQueue, X_QUEUE_SIZE, "xQueue");
+  xQueueExported = false;
+  queue_init(&yQueue, Y_QUEUE_SIZE, "yQueue");
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    binReal[n] = binImaginary[n] = 0.0;
+    binCount[n] = 0;
+    binPhase[n] = 0;
+    for (uint32_t i = 0; i < Z_QUEUE_SIZE; i++)
+      zHistory[n][i] = QUEUE_INIT_VALUE;
+    zIndex[n] = 0;
+    currentPowerValue[n] = 0.0;
+    char name[QUEUE_MAX_NAME_SIZE];
+    snprintf(name, QUEUE_MAX_NAME_SIZE, "zQueue[%d]", n);
+    queue_init(&zQueue[n], Z_QUEUE_SIZE, name);
+  }
+}
+
+// Use this to copy an input into the input queue of the FIR-filter (xQueue).
+void filter_addNewInput(double x) {
+  filter_checkXQueue();
+  xHistory[xIndex] = xHistory[xIndex + X_QUEUE_SIZE] = x;
+  xIndex = (xIndex + 1) % X_QUEUE_SIZE;
+}
+
+// Fills a queue with the given fillValue. Only filling xQueue changes the
+// filter state (see filterSlidingDft.h).
+void filter_fillQueue(queue_t *q, double fillValue) {
+  for (queue_size_t i = 0; i < queue_size(q); i++)
+    queue_overwritePush(q, fillValue);
+  if (q == &xQueue)
+    xQueueExported = true;
+}
+
+// Computes one FIR output from the newest X_QUEUE_SIZE inputs and adds it to
+// the FIR output history.
+static inline double filter_computeFirOutput() {
+  const double *x = &xHistory[xIndex]; // Oldest input first.
+  double y = 0.0;
+  for (uint32_t i = 0; i < X_QUEUE_SIZE; i++)
+    y += firCoefficients[i] * x[i];
+  firOutputs[firOutputCount & HISTORY_INDEX_MASK] = y;
+  firOutputCount++;
+  return y;
+}
+
+// Invokes the FIR-filter. Input is contents of xQueue.
+// Output is returned and is also pushed on to yQueue.
+double filter_firFilter() {
+  filter_checkXQueue();
+  DETECTOR_PROFILE_START(profile);
+  double output = filter_computeFirOutput();
+  DETECTOR_PROFILE_STOP(profile, DETECTOR_PROFILE_FIR);
+  return output;
+}
+
+// Decimating FIR-filter for a block of inputs. Only every
+// FILTER_FIR_DECIMATION_FACTOR'th output is computed.
+size_t filter_firFilterBlock(const double *in, size_t n, double *out) {
+  filter_checkXQueue();
+  DETECTOR_PROFILE_START(profile);
+  size_t outputCount = 0;
+  for (size_t i = 0; i < n; i++) {
+    xHistory[xIndex] = xHistory[xIndex + X_QUEUE_SIZE] = in[i];
+    if (++xIndex == X_QUEUE_SIZE)
+      xIndex = 0;
+    if (++firDecimationCount == FILTER_FIR_DECIMATION_FACTOR) {
+      firDecimationCount = 0;
+      out[outputCount++] = filter_computeFirOutput();
+    }
+  }
+  DETECTOR_PROFILE_STOP(profile, DETECTOR_PROFILE_FIR);
+  return outputCount;
+}
+
+// Updates sliding DFT bin filterNumber with the new FIR outputs. Returns the
+// band-pass output for the newest FIR output, which is also pushed onto
+// zQueue[filterNumber].
+double filter_iirFilter(uint16_t filterNumber) {
+  DETECTOR_PROFILE_START(profile);
+  double z = filter_runBin(filterNumber);
+  DETECTOR_PROFILE_STOP(profile, DETECTOR_PROFILE_IIR + filterNumber);
+  return z;
+}
+
+// Updates every bin. Same result as calling filter_iirFilter() for each filter
+// number. Outputs are written to outputs[filterNumber]; pass NULL if they are
+// not needed.
+void filter_iirFilterAll(double outputs[]) {
+  DETECTOR_PROFILE_START(profile);
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    double z = filter_runBin(n);
+    if (outputs)
+      outputs[n] = z;
+  }
+  DETECTOR_PROFILE_STOP(profile, DETECTOR_PROFILE_IIR_ALL);
+}
+
+// Returns 2|X|^2/W for bin filterNumber as of its last update.
+// forceComputeFromScratch recomputes the bin from the window first.
+double filter_computePower(uint16_t filterNumber, bool forceComputeFromScratch,
+                           bool debugPrint) {
+  DETECTOR_PROFILE_START(profile);
+  if (forceComputeFromScratch)
+    filter_recomputeBin(filterNumber);
+  double real = binReal[filterNumber];
+  double imaginary = binImaginary[filterNumber];
+  currentPowerValue[filterNumber] =
+      POWER_SCALE * (real * real + imaginary * imaginary);
+  DETECTOR_PROFILE_STOP(profile, DETECTOR_PROFILE_POWER);
+  if (debugPrint)
+    printf("filter_computePower(%d): %le\n", filterNumber,
+           currentPowerValue[filterNumber]);
+  return currentPowerValue[filterNumber];
+}
+
+// Returns the last-computed output power value for the IIR filter
+// [filterNumber].
+double filter_getCurrentPowerValue(uint16_t filterNumber) {
+  return currentPowerValue[filterNumber];
+}
+
+// Sets a current power value for a specific filter number.
+void filter_setCurrentPowerValue(uint16_t filterNumber, double value) {
+  currentPowerValue[filterNumber] = value;
+}
+
+// Get a copy of the current power values.
+void filter_getCurrentPowerValues(double powerValues[]) {
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+    powerValues[n] = currentPowerValue[n];
+}
+
+// Copies the current power values into normalizedArray[] and divides them by
+// the maximum power value.
+void filter_getNormalizedPowerValues(double normalizedArray[],
+                                     uint16_t *indexOfMaxValue) {
+  *indexOfMaxValue = 0;
+  for (uint16_t n = 1; n < FILTER_FREQUENCY_COUNT; n++)
+    if (currentPowerValue[n] > currentPowerValue[*indexOfMaxValue])
+      *indexOfMaxValue = n;
+  double maxValue = currentPowerValue[*indexOfMaxValue];
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+    normalizedArray[n] = maxValue > 0.0 ? currentPowerValue[n] / maxValue : 0.0;
+}
+
+/*******************************************************************************
+***** Verification-Assisting Functions
+*******************************************************************************/
+
+// Returns the array of FIR coefficients.
+const double *filter_getFirCoefficientArray() { return filterCoefficients_fir; }
+
+// Returns the number of FIR coefficients.
+uint32_t filter_getFirCoefficientCount() { return X_QUEUE_SIZE; }
+
+// There are no IIR filters: returns NULL.
+const double *filter_getIirACoefficientArray(uint16_t filterNumber) {
+  (void)filterNumber;
+  return NULL;
+}
+
+// There are no IIR filters: returns 0.
+uint32_t filter_getIirACoefficientCount() { return 0; }
+
+// There are no IIR filters: returns NULL.
+const double *filter_getIirBCoefficientArray(uint16_t filterNumber) {
+  (void)filterNumber;
+  return NULL;
+}
+
+// There are no IIR filters: returns 0.
+uint32_t filter_getIirBCoefficientCount() { return 0; }
+
+// Returns the size of the yQueue.
+uint32_t filter_getYQueueSize() { return Y_QUEUE_SIZE; }
+
+// Returns the decimation value.
+uint16_t filter_getDecimationValue() { return FILTER_FIR_DECIMATION_FACTOR; }
+
+// Copies the newest size FIR outputs into q, oldest first.
+static void filter_exportFirOutputs(queue_t *q, uint32_t size) {
+  for (uint32_t i = 0; i < size; i++)
+    queue_overwritePush(
+        q, firOutputs[(firOutputCount - size + i) & HISTORY_INDEX_MASK]);
+}
+
+// Returns a copy of the FIR inputs. Anything written to it is copied back
+// before the next FIR operation.
+queue_t *filter_getXQueue() {
+  filter_checkXQueue();
+  for (uint32_t i = 0; i < X_QUEUE_SIZE; i++)
+    queue_overwritePush(&xQueue, xHistory[xIndex + i]);
+  xQueueExported = true;
+  return &xQueue;
+}
+
+// Returns a copy of the newest FIR outputs. Writes to it are ignored.
+queue_t *filter_getYQueue() {
+  filter_exportFirOutputs(&yQueue, Y_QUEUE_SIZE);
+  return &yQueue;
+}
+
+// Returns a copy of the newest band-pass outputs of bin filterNumber. Writes to
+// it are ignored.
+queue_t *filter_getZQueue(uint16_t filterNumber) {
+  for (uint32_t i = 0; i < Z_QUEUE_SIZE; i++)
+    queue_overwritePush(
+        &zQueue[filterNumber],
+        zHistory[filterNumber][(zIndex[filterNumber] + i) % Z_QUEUE_SIZE]);
+  return &zQueue[filterNumber];
+}
+
+// There are no IIR output queues, since the bins keep the power: returns NULL.
+queue_t *filter_getIirOutputQueue(uint16_t filterNumber) {
+  (void)filterNumber;
+  return NULL;
+}
+
+// Returns the factor by which to multiply the hit detection fudge factor.
+double filter_getFudgeFactorScale() { return fudgeFactorScale; }
+
+#endif /* FILTER_SLIDING_DFT */
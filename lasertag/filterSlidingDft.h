@@ -0,0 +1,68 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef FILTERSLIDINGDFT_H_
+#define FILTERSLIDINGDFT_H_
+
+// filterSlidingDft.c is another implementation of the filter.h API. It is
+// selected at compile time by defining FILTER_SLIDING_DFT
+// (cmake -DFILTER_SLIDING_DFT=1) and is then used in place of filter.c. The
+// detector keeps calling the same filter_*() functions.
+//
+// The decimating FIR filter is unchanged. The IIR bank and the power windows
+// are replaced by one sliding DFT bin per user frequency. Each bin is the DFT
+// of the last FILTER_INPUT_PULSE_WIDTH FIR outputs, evaluated exactly at the
+// frequency of filter_frequencyTickTable[]:
+//   X[n] = X[n-1] + y[n] * e^(-jwn) - y[n-W] * e^(-jw(n-W))
+// where W is the window width. Every user frequency is a whole number of
+// periods of the decimated rate, so e^(-jwn) repeats after a few samples and is
+// read from a table. The value subtracted when a sample leaves the window is
+// bit-for-bit the value that was added when it entered, so the sum does not
+// drift. The only error left is ordinary rounding in the additions.
+//
+// filter_iirFilter(filterNumber) updates bin filterNumber. It costs four
+// multiplies instead of five second-order sections plus a power update. A bin
+// that was not updated for some FIR outputs catches up on its next call, so
+// bins can be skipped (e.g. ignored frequencies) without losing track.
+// filter_computePower() returns 2|X|^2/W. For a sinusoid in the bin this is the
+// same sum-of-squares power the IIR bank reports. The bins are much narrower
+// than the IIR filters, though, so noise gives about ten times less power than
+// in the IIR bank and the median the detector compares against drops with it.
+// Multiply the detector's fudge factor by filter_getFudgeFactorScale() to
+// detect down to the same amplitude as the IIR bank.//
+// The verification-assisting queues are copies of the internal state made when
+// the getter is called. Values written to the xQueue are copied back before the
+// next FIR operation, as filterFixedPoint.c does. The yQueue and the zQueues,
+// which hold the real part of each bin (a W-tap band-pass output), are read
+// only: writes to them are ignored. There are no IIR filters or IIR output
+// queues, so filter_getIirACoefficientArray(), filter_getIirBCoefficientArray()
+// and filter_getIirOutputQueue() return NULL and the coefficient counts are 0.
+// filterTest.c skips its IIR tests for this implementation and checks the
+// power of the bins against a direct DFT instead.
+
+// Width of the DFT window in FIR outputs (200 ms).
+#define FILTER_SLIDING_DFT_WINDOW_SIZE FILTER_INPUT_PULSE_WIDTH
+// FIR outputs kept in addition to the window, so that a bin can catch up on
+// this many outputs without a full recompute.
+#define FILTER_SLIDING_DFT_CATCH_UP_COUNT 48
+
+// Bin powers that are as far above the noise as the IIR powers still give
+// more hits on weak shots, since noise spreads the power of a bin more. This
+// factor puts the amplitude at which half of the shots are detected where it
+// is for the IIR bank: about 0.057 at noise 0.05 (tools/compareBackends.sh
+// with amplitudes between 0.05 and 0.07).
+#define FILTER_SLIDING_DFT_DETECTION_MARGIN 1.4
+
+// Returns the factor by which to multiply the detector's fudge factor so that
+// shots must be as strong, relative to the noise, as with the IIR bank: the
+// ratio of the median noise powers of the IIR design in filterCoefficients.c
+// and of the bins (about 15), times FILTER_SLIDING_DFT_DETECTION_MARGIN.
+double filter_getFudgeFactorScale();
+
+#endif /* FILTERSLIDINGDFT_H_ */
@@ -25,9 +25,50 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #endif
 
 #include "filter.h"
+#include "filterTest.h"
 #include "histogram.h"
 #include "utils.h"
 
+// The filters in this directory use the coefficient tables in
+// filterCoefficients.c and implement filter_firFilterBlock() and
+// filter_iirFilterAll(). A filter.c written for the labs need not, so the tests
+// of those only run with one of them.
+#if defined(FILTER_FIXED_POINT) || defined(FILTER_SLIDING_DFT)
+#define FILTER_TEST_BUILT_IN_FILTER
+#include "filterCoefficients.h"
+#include "filterDesign.h"
+#endif
+
+#ifdef FILTER_FIXED_POINT
+#include "filterFixedPoint.h"
+#endif
+
+#ifdef FILTER_SLIDING_DFT
+#include "filterSlidingDft.h"
+// The detector test reads the IIR output queues, which the sliding DFT lacks.
+#ifdef ADC_THROUGH_DETECTOR_FILTER_TEST
+#error "ADC_THROUGH_DETECTOR_FILTER_TEST cannot be used with FILTER_SLIDING_DFT."
+#endif
+#endif
+
+#ifdef FILTER_TEST_ANALYTIC
+#include "filterResponse.h"
+#endif
+
+#ifdef FILTER_TEST_WORKERS
+// The square-wave simulations run in parallel, one worker process per CPU (see
+// filterTest_runJobs()). The filter state is global, so workers are processes,
+// each with its own copy of it, instead of threads. fork() copies only the
+// calling thread, so only a single-threaded host program may define this:
+// tools/CMakeLists.txt does for filterTestHost. The detector test needs the
+// interrupt-driven ADC buffer, so it always runs them one after the other.
+#ifdef ADC_THROUGH_DETECTOR_FILTER_TEST
+#error "FILTER_TEST_WORKERS cannot be used with ADC_THROUGH_DETECTOR_FILTER_TEST."
+#endif
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 /****************************************************************************************************
  * Uncomment the line below if your IIR-A coefficient arrays contain a leading
  *'1'.
@@ -48,7 +89,8 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
  * 1. test basic functionality of the fir and iir filters,
  * 2. plots the frequency response of the decimating fir filter.
  * 3. plots the frequency response of each of the iir filters.
- * A square-wave input is used for all plots.
+ * A square-wave input is used for all plots. Build with FILTER_TEST_ANALYTIC
+ * to compute the frequency responses instead of simulating them.
  ****************************************************************************************************/
 
 // A histogram bar for each frequency.
@@ -104,7 +146,13 @@ void filterTest_init() {
 }
 
 // Performs a floating-point compare that allows for some error.
+// The fixed-point filters are only accurate to the bound documented in
+// filterFixedPoint.h.
+#ifdef FILTER_FIXED_POINT
+#define TEST_FILTER_FLOATING_POINT_EPSILON FILTER_FIXED_POINT_FIR_EPSILON
+#else
 #define TEST_FILTER_FLOATING_POINT_EPSILON 1.0E-12L
+#endif
 bool filterTest_floatingPointEqual(double a, double b) {
   return fabs(a - b) < TEST_FILTER_FLOATING_POINT_EPSILON;
 }
@@ -298,6 +346,35 @@ void filterTest_plotInputValues(double xValues[], double yValues[],
   }
 }
 
+#if defined(FILTER_CIC) && !defined(ADC_THROUGH_DETECTOR_FILTER_TEST)
+// The CIC front end is checked against the FIR filter that it replaces,
+// computed here in double precision from the same inputs.
+#define FILTER_TEST_CIC_REFERENCE
+static double filterTest_referenceFirInputs[FILTER_FIR_COEFFICIENT_COUNT];
+static uint32_t filterTest_referenceFirIndex = 0; // Where the next input goes.
+
+// Adds an input to the reference FIR filter.
+static void filterTest_addReferenceFirInput(double x) {
+  filterTest_referenceFirInputs[filterTest_referenceFirIndex] = x;
+  filterTest_referenceFirIndex =
+      (filterTest_referenceFirIndex + 1) % FILTER_FIR_COEFFICIENT_COUNT;
+}
+
+// Computes the reference FIR output from the newest inputs.
+static double filterTest_computeReferenceFirOutput() {
+  const double *b = filter_getFirCoefficientArray();
+  double sum = 0.0;
+  for (uint32_t i = 0; i < FILTER_FIR_COEFFICIENT_COUNT; i++) {
+    // b[0] multiplies the newest input.
+    uint32_t index = (filterTest_referenceFirIndex +
+                      FILTER_FIR_COEFFICIENT_COUNT - 1 - i) %
+                     FILTER_FIR_COEFFICIENT_COUNT;
+    sum += b[i] * filterTest_referenceFirInputs[index];
+  }
+  return sum;
+}
+#endif
+
 // Helper function to create input waveform when testing only the filter.c code.
 double computeFilterInput(uint16_t freqTick, uint16_t currentPeriodTickCount) {
   double filterValue;
@@ -333,6 +410,196 @@ uint16_t computeAdcBufferInput(uint16_t freqTick,
 #define PERIODS_TO_PLOT                                                        \
   2 // The number of period's worth of data to collect and plot.
 #define INPUT_PLOT_VIEW_DELAY 1000 // The plot will be visible for this long.
+// Plots PERIODS_TO_PLOT periods of the square wave with the given period, as it
+// is fed to the filters.
+static void filterTest_plotSquareWaveInput(uint16_t currentPeriodTickCount) {
+  double xValues[PLOT_VALUE_MAX_COUNT]; // Store the x-values here.
+  double yValues[PLOT_VALUE_MAX_COUNT]; // Store the y-values here.
+  uint32_t plotCount = currentPeriodTickCount * PERIODS_TO_PLOT;
+  for (uint32_t i = 0; i < plotCount; i++) {
+    uint16_t freqTick = i % currentPeriodTickCount;
+    xValues[i] = i; // You just need x to increment.
+#ifdef ADC_THROUGH_DETECTOR_FILTER_TEST
+    yValues[i] = computeAdcBufferInput(freqTick, currentPeriodTickCount);
+#else
+    yValues[i] = computeFilterInput(freqTick, currentPeriodTickCount) +
+                 FILTER_TEST_INPUT_OFFSET; // The offset ensure that the input
+                                           // is unipolar for plotting purposes.
+#endif
+  }
+  printf("plotting input square wave.\n");
+  filterTest_plotInputValues(xValues, yValues, plotCount);
+  utils_msDelay(INPUT_PLOT_VIEW_DELAY);
+}
+
+// Fills the queue with the fillValue, overwriting all previous contents.
+void filterTest_fillQueue(queue_t *q, double fillValue) {
+  for (queue_size_t i = 0; i < q->size; i++) {
+    queue_overwritePush(q, fillValue);
+  }
+}
+
+// Longer than the impulse response of the FIR filter or the CIC front end
+// (FILTER_RESPONSE_CIC_IMPULSE_RESPONSE_LENGTH), and a multiple of
+// FILTER_FIR_DECIMATION_FACTOR.
+#define FILTER_TEST_FRONT_END_LENGTH 120
+#ifdef FILTER_SLIDING_DFT
+// The bins span a pulse-width of FIR outputs, and writes to the yQueue and the
+// zQueues of filterSlidingDft.c are ignored, so the bins are flushed with zeros
+// too.
+#define FILTER_TEST_FLUSH_LENGTH FILTER_TEST_PULSE_WIDTH_LENGTH
+#else
+#define FILTER_TEST_FLUSH_LENGTH FILTER_TEST_FRONT_END_LENGTH
+#endif
+#if defined(FILTER_TEST_WORKERS) || defined(FILTER_TEST_ANALYTIC) ||           \
+    defined(FILTER_SLIDING_DFT)
+// Runs zeros through the FIR filter (or the CIC front end) until no earlier
+// input affects its output, then zeroes the IIR filters. Each impulse
+// measurement of filterTest_runAnalyticTest() starts from here, and so does
+// each square-wave simulation with FILTER_TEST_WORKERS, so that its result does
+// not depend on which process ran it (see filterTest_runJobs()), and each IIR
+// simulation of the sliding DFT. Clearing the
+// xQueue is not enough: the CIC integrators keep their own state.
+static void filterTest_flushFilters() {
+  firDecimationCount = 0;
+  for (uint32_t i = 0; i < FILTER_TEST_FLUSH_LENGTH; i++) {
+    filter_addNewInput(0.0);
+    filterTest_decimatingFirFilter();
+  }
+#ifdef FILTER_TEST_CIC_REFERENCE
+  for (uint32_t i = 0; i < FILTER_FIR_COEFFICIENT_COUNT; i++)
+    filterTest_addReferenceFirInput(0.0);
+#endif
+  filterTest_fillQueue(filter_getYQueue(), 0.0); // zero out the y-queue.
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+    filterTest_fillQueue(filter_getZQueue(n), 0.0); // zero out the z-queues.
+}
+#endif
+
+// Each square-wave simulation is a job that writes up to this many results.
+#define FILTER_TEST_JOB_RESULT_COUNT 2
+typedef void (*filterTest_job_t)(uint16_t jobIndex, double results[]);
+
+// Runs job(i, results[i]) for each of the jobCount jobs: in any order, in
+// worker processes, with FILTER_TEST_WORKERS, and in order otherwise.
+static void filterTest_runJobs(filterTest_job_t job, uint16_t jobCount,
+                               double results[][FILTER_TEST_JOB_RESULT_COUNT]) {
+  bool done[FILTER_TEST_FIR_POWER_TEST_PERIOD_COUNT] = {false};
+#ifdef FILTER_TEST_WORKERS
+  // Each worker sends back one record per job through a pipe. A record is
+  // smaller than PIPE_BUF, so records from different workers do not mix.
+  struct {
+    uint16_t jobIndex;
+    double results[FILTER_TEST_JOB_RESULT_COUNT];
+  } record;
+  long workerCount = sysconf(_SC_NPROCESSORS_ONLN);
+  if (workerCount > jobCount)
+    workerCount = jobCount;
+  int fds[2];
+  if (workerCount > 1 && pipe(fds) == 0) {
+    pid_t workers[FILTER_TEST_FIR_POWER_TEST_PERIOD_COUNT];
+    fflush(stdout); // Or each worker would print it again.
+    for (long w = 0; w < workerCount; w++) {
+      workers[w] = fork();
+      if (workers[w] == 0) {
+        close(fds[0]);
+        for (uint16_t i = w; i < jobCount; i += workerCount) {
+          record.jobIndex = i;
+          job(i, record.results);
+          if (write(fds[1], &record, sizeof(record)) != sizeof(record))
+            break;
+        }
+        _exit(0); // Skip exit handlers that belong to the parent.
+      }
+    }
+    close(fds[1]);
+    while (read(fds[0], &record, sizeof(record)) == sizeof(record)) {
+      for (uint16_t r = 0; r < FILTER_TEST_JOB_RESULT_COUNT; r++)
+        results[record.jobIndex][r] = record.results[r];
+      done[record.jobIndex] = true;
+    }
+    close(fds[0]);
+    for (long w = 0; w < workerCount; w++)
+      if (workers[w] > 0)
+        waitpid(workers[w], NULL, 0);
+  }
+#endif
+  // Run anything that no worker did, because there were no workers, or one
+  // could not be started.
+  for (uint16_t i = 0; i < jobCount; i++)
+    if (!done[i])
+      job(i, results[i]);
+}
+
+// Results of filterTest_simulateFirPower().
+#define FIR_JOB_POWER 0
+#define FIR_JOB_REFERENCE_POWER 1
+// Simulates running everything at 100 kHz: feeds a pulse-width of the square
+// wave with period filterTest_firTestTickCounts[testPeriodIndex] to the FIR
+// filter and writes its output power to results[FIR_JOB_POWER]. With
+// FILTER_TEST_CIC_REFERENCE, also writes the output power of the 81-tap FIR
+// filter to results[FIR_JOB_REFERENCE_POWER].
+static void filterTest_simulateFirPower(uint16_t testPeriodIndex,
+                                        double results[]) {
+  double firPower = 0.0; // Power will be accumulated here.
+  double referencePower = 0.0;
+#ifdef FILTER_TEST_WORKERS
+  filterTest_flushFilters(); // The worker did not run the previous frequency.
+#endif
+  uint16_t currentPeriodTickCount =
+      filterTest_firTestTickCounts[testPeriodIndex];
+  uint32_t totalTickCount = 0; // Keep track of where you are in the period.
+  // The #ifdef below allow the code to adapt to early usage when only the
+  // filter.c code is being tested up through late-end verification when the
+  // isr.c, detector.c and so forth have been coded and are being tested.
+  while (totalTickCount <
+         FILTER_TEST_PULSE_WIDTH_LENGTH) { // Keep going until you have
+                                           // completed the entire pulse-width.
+    for (uint16_t freqTick = 0; freqTick < currentPeriodTickCount;
+         freqTick++) { // This loop completes a single period.
+#ifdef ADC_THROUGH_DETECTOR_FILTER_TEST
+      uint16_t adcValue;
+      adcValue = computeAdcBufferInput(freqTick, currentPeriodTickCount);
+      isr_addDataToAdcBuffer(adcValue); // Put the data into the adcBuffer.
+#else
+      double filterValue;
+      filterValue = computeFilterInput(freqTick, currentPeriodTickCount);
+      filter_addNewInput(
+          filterValue); // Put the data into the input queue of the filter.
+#ifdef FILTER_TEST_CIC_REFERENCE
+      filterTest_addReferenceFirInput(filterValue);
+#endif
+      if (filterTest_decimatingFirFilter()) {
+        double firOutput = filterTest_readMostRecentValueFromQueue(
+            filter_getYQueue());           // Get the output from the yQueue.
+        firPower += firOutput * firOutput; // Compute the power so far.
+#ifdef FILTER_TEST_CIC_REFERENCE
+        double referenceOutput = filterTest_computeReferenceFirOutput();
+        referencePower += referenceOutput * referenceOutput;
+#endif
+      }
+#endif
+      totalTickCount++; // This keeps track of the total ticks in the
+                        // pulse-width.
+    }
+  }
+#ifdef DETECTOR_H_
+  bool interruptsEnabled = false; // Need to tell the detector that interrupts
+                                  // are not currently enabled.
+  detector(interruptsEnabled, false); // Run the detector so that it runs the
+                                      // decimating FIR and IIR filters.
+  for (queue_index_t i = 0;
+       i < queue_elementCount(filter_getFirOutputDebugQueue());
+       i++) { // Iterate over the FIR output debug queue.
+    double firOutput = queue_readElementAt(filter_getFirOutputDebugQueue(),
+                                           i); // Read an output.
+    firPower += firOutput * firOutput;         // Square the output.
+  }
+#endif
+  results[FIR_JOB_POWER] = firPower;
+  results[FIR_JOB_REFERENCE_POWER] = referencePower;
+}
+
 // Plots the frequency response of the FIR filter on the TFT.
 // Everything is defined assuming a 100 kHz sample rate.
 // Frequencies run from 1.1 kHz to 50 kHz.
@@ -340,13 +607,20 @@ uint16_t computeAdcBufferInput(uint16_t freqTick,
 // filter_getFirOutputDebugQueue()). Power is computed internally. Does not use
 // the filter_computePower... functions. To plot the input as well as output,
 // pass true to plotInputFlag.
-void filterTest_runSquareWaveFirPowerTest(bool printMessageFlag,
+// With FILTER_CIC, the power at each user frequency is also compared with the
+// power of the 81-tap FIR filter. Returns false if they differ by more than
+// FILTER_FIXED_POINT_CIC_PASSBAND_TOLERANCE_DB, and true otherwise.
+bool filterTest_runSquareWaveFirPowerTest(bool printMessageFlag,
                                           bool plotInputFlag) {
   if (!filterTest_initFlag) {
     printf("Must call filterTest_init() before running any filter tests.\n");
-    return;
+    return false;
   }
-  double firPower = 0.0; // Power will be accumulated here.
+  bool success = true; // Be optimistic.
+#ifdef FILTER_TEST_CIC_REFERENCE
+  for (uint32_t i = 0; i < FILTER_FIR_COEFFICIENT_COUNT; i++)
+    filterTest_addReferenceFirInput(0.0);
+#endif
 #ifdef ADC_THROUGH_DETECTOR_FILTER_TEST
   detector_init(); // You will be using the detector to invoke the filters.
   isr_init(); // You will be using adcBuffer to provide data to the filters.
@@ -364,94 +638,47 @@ void filterTest_runSquareWaveFirPowerTest(bool printMessageFlag,
          filterTest_firTestTickCounts[FILTER_TEST_FIR_POWER_TEST_PERIOD_COUNT -
                                       1]));
   }
+  if (plotInputFlag) { // Only plot the input if the flag is true.
+    for (uint16_t testPeriodIndex = 0;
+         testPeriodIndex < FILTER_TEST_FIR_POWER_TEST_PERIOD_COUNT;
+         testPeriodIndex++)
+      filterTest_plotSquareWaveInput(
+          filterTest_firTestTickCounts[testPeriodIndex]);
+  }
+  double results[FILTER_TEST_FIR_POWER_TEST_PERIOD_COUNT]
+                [FILTER_TEST_JOB_RESULT_COUNT];
+  filterTest_runJobs(filterTest_simulateFirPower,
+                     FILTER_TEST_FIR_POWER_TEST_PERIOD_COUNT, results);
   double testPeriodPowerValue
       [FILTER_TEST_FIR_POWER_TEST_PERIOD_COUNT]; // Computed power values will
                                                  // go here.
-  uint16_t freqCount = 0;                        // Used to print info message.
-  // Simulate running everything at 100 kHz. Simply add either 1.0 or -1.0 to
-  // xQueue based upon the the frequency you are simulating. Iterate over all of
-  // the test-periods.
-  double xValues[PLOT_VALUE_MAX_COUNT]; // Store the x-values here.
-  double yValues[PLOT_VALUE_MAX_COUNT]; // Store the y-values here.
-  for (uint16_t testPeriodIndex = 0;
-       testPeriodIndex < FILTER_TEST_FIR_POWER_TEST_PERIOD_COUNT;
-       testPeriodIndex++) {
-    firPower = 0.0; // Reset the power value.
-    uint16_t currentPeriodTickCount =
-        filterTest_firTestTickCounts[testPeriodIndex];
-    uint32_t totalTickCount = 0; // Keep track of where you are in the period.
-    // The #ifdef below allow the code to adapt to early usage when only the
-    // filter.c code is being tested up through late-end verification when the
-    // isr.c, detector.c and so forth have been coded and are being tested.
-    while (
-        totalTickCount <
-        FILTER_TEST_PULSE_WIDTH_LENGTH) { // Keep going until you have completed
-                                          // the entire pulse-width.
-      for (uint16_t freqTick = 0; freqTick < currentPeriodTickCount;
-           freqTick++) { // This loop completes a single period.
-#ifdef ADC_THROUGH_DETECTOR_FILTER_TEST
-        uint16_t adcValue;
-        adcValue = computeAdcBufferInput(freqTick, currentPeriodTickCount);
-        isr_addDataToAdcBuffer(adcValue); // Put the data into the adcBuffer.
-#else
-        double filterValue;
-        filterValue = computeFilterInput(freqTick, currentPeriodTickCount);
-        filter_addNewInput(
-            filterValue); // Put the data into the input queue of the filter.
-        if (filterTest_decimatingFirFilter()) {
-          double firOutput = filterTest_readMostRecentValueFromQueue(
-              filter_getYQueue());           // Get the output from the yQueue.
-          firPower += firOutput * firOutput; // Compute the power so far.
-        }
-#endif
-        if (plotInputFlag &&
-            (totalTickCount <
-             currentPeriodTickCount *
-                 PERIODS_TO_PLOT)) { // You can capture multiple periods of
-                                     // data.
-          xValues[totalTickCount] =
-              totalTickCount; // You just need x to increment.
-#ifdef ADC_THROUGH_DETECTOR_FILTER_TEST
-          yValues[totalTickCount] = adcValue; // y is the adcValue.
-#else
-          yValues[totalTickCount] =
-              filterValue +
-              FILTER_TEST_INPUT_OFFSET; // The offset ensure that the input is
-                                        // unipolar for plotting purposes.
-#endif
-        }
-        totalTickCount++; // This keeps track of the total ticks in the
-                          // pulse-width.
-      }
-    }
-    if (plotInputFlag) { // Only plot the data if the flag is true.
-      printf("plotting input square wave.\n");
-      filterTest_plotInputValues(xValues, yValues,
-                                 currentPeriodTickCount * PERIODS_TO_PLOT);
-      utils_msDelay(INPUT_PLOT_VIEW_DELAY);
-    }
-#ifdef DETECTOR_H_
-    bool interruptsEnabled = false; // Need to tell the detector that interrupts
-                                    // are not currently enabled.
-    detector(interruptsEnabled, false); // Run the detector so that it runs the
-                                        // decimating FIR and IIR filters.
-    for (queue_index_t i = 0;
-         i < queue_elementCount(filter_getFirOutputDebugQueue());
-         i++) { // Iterate over the FIR output debug queue.
-      double firOutput = queue_readElementAt(filter_getFirOutputDebugQueue(),
-                                             i); // Read an output.
-      firPower += firOutput * firOutput;         // Square the output.
-    }
-#endif
-    testPeriodPowerValue[testPeriodIndex] =
-        firPower; // Store the resulting power.
+  for (uint16_t freqCount = 0;
+       freqCount < FILTER_TEST_FIR_POWER_TEST_PERIOD_COUNT; freqCount++) {
+    testPeriodPowerValue[freqCount] =
+        results[freqCount][FIR_JOB_POWER]; // Store the resulting power.
     printf("freqCount:%d, testPeriodPowerValue:%le\n", freqCount,
-           testPeriodPowerValue[testPeriodIndex]); // Info. print.
-    freqCount++;
+           testPeriodPowerValue[freqCount]); // Info. print.
+  }
+#ifdef FILTER_TEST_CIC_REFERENCE
+  // The user frequencies come first.
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    double errorDb = 10.0 * log10(testPeriodPowerValue[i] /
+                                  results[i][FIR_JOB_REFERENCE_POWER]);
+    if (fabs(errorDb) > FILTER_FIXED_POINT_CIC_PASSBAND_TOLERANCE_DB) {
+      success = false;
+      printf("filter_runFirPowerTest: CIC power at user frequency %d is "
+             "%+.3f dB from the FIR filter.\n",
+             i, errorDb);
+    } else if (printMessageFlag) {
+      printf("user frequency %d: CIC power is %+.3f dB from the FIR filter.\n",
+             i, errorDb);
+    }
   }
+#endif
   // After running all of the data through the filters, plot it out.
   printf("Plotting response to square-wave input.\n");
   filterTest_plotFirFrequencyResponse(testPeriodPowerValue);
+  return success;
 }
 
 // Plots the output power for a given filter across the standard 10 user
@@ -505,14 +732,78 @@ void filterTest_plotIirFrequencyResponse(double iirPowerValues[],
   histogram_updateDisplay();      // Redraw the histogram.
 }
 
-// Fills the queue with the fillValue, overwriting all previous contents.
-void filterTest_fillQueue(queue_t *q, double fillValue) {
-  for (queue_size_t i = 0; i < q->size; i++) {
-    queue_overwritePush(q, fillValue);
+#define FILTER_IIR_POWER_TEST_PERIOD_COUNT FILTER_FREQUENCY_COUNT
+// The IIR filter that filterTest_simulateIirPower() runs.
+static uint16_t filterTest_jobFilterNumber = 0;
+// Simulates running everything at 100 kHz: feeds a pulse-width of user
+// frequency testPeriodIndex through the FIR filter to IIR filter
+// filterTest_jobFilterNumber, and writes its output power to results[0].
+static void filterTest_simulateIirPower(uint16_t testPeriodIndex,
+                                        double results[]) {
+  uint16_t filterNumber = filterTest_jobFilterNumber;
+  double power = 0.0;
+#if defined(FILTER_TEST_WORKERS) || defined(FILTER_SLIDING_DFT)
+  // The worker did not run the previous frequency, or the bins cannot be
+  // zeroed through the zQueues.
+  filterTest_flushFilters();
+#else
+  filterTest_fillQueue(filter_getXQueue(), 0.0); // zero out the x-queue.
+  filterTest_fillQueue(filter_getYQueue(), 0.0); // zero out the y-queue.
+  filterTest_fillQueue(
+      filter_getZQueue(filterNumber),
+      0.0); // zero out the z-queue for the IIR filter under test.
+#endif
+  uint16_t currentPeriodTickCount =
+      filterTest_firTestTickCounts[testPeriodIndex]; // You will be generating
+                                                     // a frequency with this
+                                                     // period.
+  uint32_t totalTickCount =
+      0; // Keep track of where you are in the given period.
+  while (totalTickCount <
+         FILTER_TEST_PULSE_WIDTH_LENGTH) { // Generate a pulse-width of periods.
+    for (uint16_t freqTick = 0; freqTick < currentPeriodTickCount;
+         freqTick++) { // This loop generates one period of the frequency.
+#ifdef ADC_THROUGH_DETECTOR_FILTER_TEST // from adc-buffer to detector.
+      uint16_t adcValue;
+      adcValue = computeAdcBufferInput(freqTick, currentPeriodTickCount);
+      isr_addDataToAdcBuffer(adcValue); // Put the data into the adcBuffer.
+#else // From fir-filter input to iir-filter output only.
+      double filterValue; // Values will be fed directly to the filter.
+      double iirOutput;   // This will hold the latest output from the iir
+                          // filter.
+      filterValue = computeFilterInput(
+          freqTick, currentPeriodTickCount); // Compute a filter value.
+      filter_addNewInput(
+          filterValue); // Put the data into the input queue of the filter.
+      if (filterTest_decimatingFirFilter()) { // Run the IIR filter if the
+                                              // fir-filter ran.
+        filter_iirFilter(filterNumber);
+        // Get the latest output from the iir-filter.
+        iirOutput = filterTest_readMostRecentValueFromQueue(
+            filter_getZQueue(filterNumber));
+        power +=
+            iirOutput * iirOutput; // Multiply-accumulate the iir-filter output
+      }
+#endif
+      totalTickCount++; // Go to the next tick.
+    }
+  }
+#ifdef ADC_THROUGH_DETECTOR_FILTER_TEST // Run the detector to run the filters.
+  bool interruptsEnabled = false; // Need to tell the detector that interrupts
+                                  // are not currently enabled.
+  detector(interruptsEnabled, false); // Run the detector so that it runs the
+                                      // decimating FIR and IIR filters.
+  for (queue_index_t i = 0;
+       i < queue_elementCount(filter_getIirOutputQueue(filterNumber));
+       i++) { // Iterate over the IIR output debug queue.
+    double iirOutput = queue_readElementAt(
+        filter_getIirOutputQueue(filterNumber), i); // Read an output.
+    power += iirOutput * iirOutput;                 // Square the output.
   }
+#endif
+  results[0] = power;
 }
 
-#define FILTER_IIR_POWER_TEST_PERIOD_COUNT FILTER_FREQUENCY_COUNT
 // Plots frequency response for the selected filterNumber against the 10
 // standard frequencies (square-wave). Plots the IIR power for a specific
 // filterNumber for the supplied iirPowerValues. IIR outputs are retrieved via
@@ -533,71 +824,17 @@ void filterTest_runSquareWaveIirPowerTest(uint16_t filterNumber,
            "frequencies for IIR filter(%d) to TFT display.\n",
            filterNumber, filterNumber);
   }
+  double results[FILTER_IIR_POWER_TEST_PERIOD_COUNT]
+                [FILTER_TEST_JOB_RESULT_COUNT];
+  filterTest_jobFilterNumber = filterNumber;
+  filterTest_runJobs(filterTest_simulateIirPower,
+                     FILTER_IIR_POWER_TEST_PERIOD_COUNT, results);
   double testPeriodPowerValue
       [FILTER_IIR_POWER_TEST_PERIOD_COUNT]; // Keep track of power values here.
-  uint16_t freqCount = 0;
-  // Simulate running everything at 100 kHz.
-  for (uint16_t testPeriodIndex = 0; testPeriodIndex < FILTER_FREQUENCY_COUNT;
-       testPeriodIndex++) { // Only use the first 10 standard frequencies.
-    double power = 0.0;
-    filterTest_fillQueue(filter_getXQueue(), 0.0); // zero out the x-queue.
-    filterTest_fillQueue(filter_getYQueue(), 0.0); // zero out the y-queue.
-    filterTest_fillQueue(
-        filter_getZQueue(filterNumber),
-        0.0); // zero out the z-queue for the IIR filter under test.
-    uint16_t currentPeriodTickCount =
-        filterTest_firTestTickCounts[testPeriodIndex]; // You will be generating
-                                                       // a frequency with this
-                                                       // period.
-    uint32_t totalTickCount =
-        0; // Keep track of where you are in the given period.
-    while (
-        totalTickCount <
-        FILTER_TEST_PULSE_WIDTH_LENGTH) { // Generate a pulse-width of periods.
-      for (uint16_t freqTick = 0; freqTick < currentPeriodTickCount;
-           freqTick++) { // This loop generates one period of the frequency.
-#ifdef ADC_THROUGH_DETECTOR_FILTER_TEST // from adc-buffer to detector.
-        uint16_t adcValue;
-        adcValue = computeAdcBufferInput(freqTick, currentPeriodTickCount);
-        isr_addDataToAdcBuffer(adcValue); // Put the data into the adcBuffer.
-#else // From fir-filter input to iir-filter output only.
-        double filterValue; // Values will be fed directly to the filter.
-        double
-            iirOutput; // This will hold the latest output from the iir filter.
-        filterValue = computeFilterInput(
-            freqTick, currentPeriodTickCount); // Compute a filter value.
-        filter_addNewInput(
-            filterValue); // Put the data into the input queue of the filter.
-        if (filterTest_decimatingFirFilter()) { // Run the IIR filter if the
-                                                // fir-filter ran.
-          filter_iirFilter(filterNumber);
-          // Get the latest output from the iir-filter.
-          iirOutput = filterTest_readMostRecentValueFromQueue(
-              filter_getZQueue(filterNumber));
-          power += iirOutput *
-                   iirOutput; // Multiply-accumulate the iir-filter output
-        }
-#endif
-        totalTickCount++; // Go to the next tick.
-      }
-    }
-#ifdef ADC_THROUGH_DETECTOR_FILTER_TEST // Run the detector to run the filters.
-    bool interruptsEnabled = false; // Need to tell the detector that interrupts
-                                    // are not currently enabled.
-    detector(interruptsEnabled, false); // Run the detector so that it runs the
-                                        // decimating FIR and IIR filters.
-    for (queue_index_t i = 0;
-         i < queue_elementCount(filter_getIirOutputQueue(filterNumber));
-         i++) { // Iterate over the IIR output debug queue.
-      double iirOutput = queue_readElementAt(
-          filter_getIirOutputQueue(filterNumber), i); // Read an output.
-      power += iirOutput * iirOutput;                 // Square the output.
-    }
-#endif
-    testPeriodPowerValue[testPeriodIndex] =
-        power;   // keep track of the power for each frequency.
-    freqCount++; // Next frequency.
-  }
+  for (uint16_t freqCount = 0; freqCount < FILTER_IIR_POWER_TEST_PERIOD_COUNT;
+       freqCount++)
+    testPeriodPowerValue[freqCount] =
+        results[freqCount][0]; // keep track of the power for each frequency.
   filterTest_plotIirFrequencyResponse(
       testPeriodPowerValue, filterNumber); // Finally, plot the results.
 }
@@ -802,6 +1039,72 @@ bool filterTest_runIirAAlignmentTest(uint16_t filterNumber,
   return success; // Return the failure or success of the test.
 }
 
+#define IIR_IMPULSE_RESPONSE_TEST_LENGTH                                       \
+  FILTER_INPUT_PULSE_WIDTH // Compare this many outputs.
+#define IIR_IMPULSE_RESPONSE_MAX_COEFFICIENT_COUNT                             \
+  16 // Large enough for the A and B arrays.
+// Pushes a single 1.0 through the yQueue and compares the output of
+// filter_iirFilter() against the impulse response computed here, in double
+// precision, from the direct-form A and B coefficients. Unlike the alignment
+// tests, this does not depend on how the IIR filter stores its state, so it
+// also checks filter implementations that use second-order sections.
+bool filterTest_runIirImpulseResponseTest(uint16_t filterNumber,
+                                          bool printMessageFlag,
+                                          double epsilon) {
+  if (!filterTest_initFlag) {
+    printf("Must call filterTest_init() before running any filter tests.\n");
+    return false;
+  }
+  bool success = true; // Be optimistic.
+  const double *a = filter_getIirACoefficientArray(filterNumber);
+  const double *b = filter_getIirBCoefficientArray(filterNumber);
+  uint16_t aStart = filterTest_getIirACoefficientArrayStartingIndex();
+  uint32_t aCount = filter_getIirACoefficientCount() - aStart;
+  uint32_t bCount = filter_getIirBCoefficientCount();
+  double x[IIR_IMPULSE_RESPONSE_MAX_COEFFICIENT_COUNT] = {0.0}; // x[0] is newest.
+  double y[IIR_IMPULSE_RESPONSE_MAX_COEFFICIENT_COUNT] = {0.0}; // y[0] is newest.
+  filter_fillQueue(filter_getYQueue(), 0.0); // zero-out the yQueue.
+  filter_fillQueue(filter_getZQueue(filterNumber),
+                   0.0); // zero out the zQueue for filterNumber.
+  queue_overwritePush(filter_getYQueue(),
+                      1.0); // Place a single 1.0 in the yQueue.
+  x[0] = 1.0;
+  for (uint32_t i = 0; i < IIR_IMPULSE_RESPONSE_TEST_LENGTH; i++) {
+    double iirValue = filter_iirFilter(filterNumber); // Run the IIR filter.
+    double iirGoldenOutput = 0.0; // Direct-form computation of the output.
+    for (uint32_t j = 0; j < bCount; j++)
+      iirGoldenOutput += b[j] * x[j];
+    for (uint32_t j = 0; j < aCount; j++)
+      iirGoldenOutput -= a[j + aStart] * y[j];
+    if (fabs(iirValue - iirGoldenOutput) > epsilon) {
+      success = false; // Note test failure and print message.
+      printf("filter_runIirImpulseResponseTest: Output from IIR "
+             "Filter[%d](%24.20le) does not match test-data(%24.20le) at "
+             "index(%d).\n",
+             filterNumber, iirValue, iirGoldenOutput, i);
+      break;
+    }
+    // Shift the histories by one position.
+    for (uint32_t j = bCount - 1; j > 0; j--)
+      x[j] = x[j - 1];
+    x[0] = 0.0;
+    for (uint32_t j = aCount - 1; j > 0; j--)
+      y[j] = y[j - 1];
+    y[0] = iirGoldenOutput;
+    queue_overwritePush(filter_getYQueue(),
+                        0.0); // Shift the 1.0 over one position in the yQueue.
+  }
+  // Print informational messages.
+  if (printMessageFlag) {
+    printf("filter_runIirImpulseResponseTest ");
+    if (success)
+      printf("passed.\n");
+    else
+      printf("failed.\n");
+  }
+  return success; // Return the success or failure of the test.
+}
+
 // Normalizes the values in the array argument.
 // void filterTest_normalizeArrayValues(double *array, uint16_t size) {
 //   // Find the maximum value
@@ -829,6 +1132,150 @@ void filterTest_fillQueueWithRandomValues(queue_t *q) {
         q, filterTest_randomValue0To1()); // Use rand to generate random values.
 }
 
+#ifdef FILTER_TEST_BUILT_IN_FILTER
+#define FIR_BLOCK_TEST_LENGTH 1000 // Number of inputs to filter.
+#define FIR_BLOCK_TEST_MAX_BLOCK_SIZE                                          \
+  37 // Block sizes vary from 1 to this value.
+#define FIR_BLOCK_TEST_FETCH_PERIOD 3 // Blocks between xQueue fetches.
+// Runs inputs[] through filter_firFilterBlock() in blocks of blockSizes[] into
+// outputs[] and returns the number of outputs. If fetchXQueue, the xQueue is
+// fetched before every FIR_BLOCK_TEST_FETCH_PERIOD'th block, which makes the
+// filters import it, in the middle of a decimation group most of the time.
+static uint32_t filterTest_runFirBlocks(const double inputs[],
+                                        const uint32_t blockSizes[],
+                                        double outputs[], bool fetchXQueue) {
+  filter_init();
+  uint32_t outputCount = 0;
+  uint32_t block = 0;
+  for (uint32_t i = 0; i < FIR_BLOCK_TEST_LENGTH; block++) {
+    if (fetchXQueue && block % FIR_BLOCK_TEST_FETCH_PERIOD == 0)
+      filter_getXQueue();
+    outputCount += filter_firFilterBlock(&inputs[i], blockSizes[block],
+                                         &outputs[outputCount]);
+    i += blockSizes[block];
+  }
+  return outputCount;
+}
+
+// Checks that filter_firFilterBlock() produces the same outputs as calling
+// filter_addNewInput() for every input and filter_firFilter() for every
+// FILTER_FIR_DECIMATION_FACTOR'th input. Blocks of varying size are used so that
+// decimation groups span block boundaries, once as they are and once with the
+// xQueue fetched in between.
+bool filterTest_runFirBlockTest(bool printMessageFlag) {
+  if (!filterTest_initFlag) {
+    printf("Must call filterTest_init() before running any filter tests.\n");
+    return false;
+  }
+  bool success = true; // Be optimistic.
+  static double inputs[FIR_BLOCK_TEST_LENGTH];
+  static double goldenOutputs[FIR_BLOCK_TEST_LENGTH];
+  static double outputs[FIR_BLOCK_TEST_LENGTH];
+  static uint32_t blockSizes[FIR_BLOCK_TEST_LENGTH];
+  for (uint32_t i = 0; i < FIR_BLOCK_TEST_LENGTH; i++)
+    inputs[i] = TIMES2_FP(filterTest_randomValue0To1()) - 1.0;
+  for (uint32_t i = 0, block = 0; i < FIR_BLOCK_TEST_LENGTH; block++) {
+    blockSizes[block] = (rand() % FIR_BLOCK_TEST_MAX_BLOCK_SIZE) + 1;
+    if (i + blockSizes[block] > FIR_BLOCK_TEST_LENGTH)
+      blockSizes[block] = FIR_BLOCK_TEST_LENGTH - i;
+    i += blockSizes[block];
+  }
+  // First run: one input at a time.
+  filter_init();
+  uint32_t goldenCount = 0;
+  for (uint32_t i = 0; i < FIR_BLOCK_TEST_LENGTH; i++) {
+    filter_addNewInput(inputs[i]);
+    if ((i + 1) % FILTER_FIR_DECIMATION_FACTOR == 0)
+      goldenOutputs[goldenCount++] = filter_firFilter();
+  }
+  // Then blocks of varying size, without and with xQueue fetches.
+  for (uint16_t run = 0; run < 2 && success; run++) {
+    bool fetchXQueue = run == 1;
+    uint32_t outputCount =
+        filterTest_runFirBlocks(inputs, blockSizes, outputs, fetchXQueue);
+    if (outputCount != goldenCount) {
+      success = false;
+      printf("filter_runFirBlockTest: filter_firFilterBlock() returned %d "
+             "outputs, expected %d.\n",
+             outputCount, goldenCount);
+    }
+    for (uint32_t i = 0; i < goldenCount && success; i++) {
+      if (outputs[i] != goldenOutputs[i]) {
+        success = false; // Note test failure and print message.
+        printf("filter_runFirBlockTest: Output from filter_firFilterBlock() "
+               "(%24.20le) does not match filter_firFilter() (%24.20le) at "
+               "index(%d)%s.\n",
+               outputs[i], goldenOutputs[i], i,
+               fetchXQueue ? " with xQueue fetches" : "");
+      }
+    }
+  }
+  // Print informational messages.
+  if (printMessageFlag) {
+    printf("filter_runFirBlockTest ");
+    if (success)
+      printf("passed.\n");
+    else
+      printf("failed.\n");
+  }
+  return success; // Return the success or failure of the test.
+}
+
+#define IIR_FILTER_ALL_TEST_LENGTH 500 // Compare this many sets of outputs.
+// Checks that filter_iirFilterAll() produces the same outputs as calling
+// filter_iirFilter() for each filter number. Both runs start from cleared
+// zQueues and are fed the same random FIR outputs through the yQueue.
+bool filterTest_runIirFilterAllTest(bool printMessageFlag) {
+  if (!filterTest_initFlag) {
+    printf("Must call filterTest_init() before running any filter tests.\n");
+    return false;
+  }
+  bool success = true; // Be optimistic.
+  static double inputs[IIR_FILTER_ALL_TEST_LENGTH];
+  static double goldenOutputs[IIR_FILTER_ALL_TEST_LENGTH]
+                             [FILTER_FREQUENCY_COUNT];
+  for (uint32_t i = 0; i < IIR_FILTER_ALL_TEST_LENGTH; i++)
+    inputs[i] = ONE_HALF_FP(filterTest_randomValue0To1()) - 0.25;
+  // First run: one filter at a time.
+  filter_fillQueue(filter_getYQueue(), 0.0);
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+    filter_fillQueue(filter_getZQueue(n), 0.0);
+  for (uint32_t i = 0; i < IIR_FILTER_ALL_TEST_LENGTH; i++) {
+    queue_overwritePush(filter_getYQueue(), inputs[i]);
+    for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+      goldenOutputs[i][n] = filter_iirFilter(n);
+  }
+  // Second run: all filters at once.
+  filter_fillQueue(filter_getYQueue(), 0.0);
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+    filter_fillQueue(filter_getZQueue(n), 0.0);
+  for (uint32_t i = 0; i < IIR_FILTER_ALL_TEST_LENGTH && success; i++) {
+    double outputs[FILTER_FREQUENCY_COUNT];
+    queue_overwritePush(filter_getYQueue(), inputs[i]);
+    filter_iirFilterAll(outputs);
+    for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+      if (outputs[n] != goldenOutputs[i][n]) {
+        success = false; // Note test failure and print message.
+        printf("filter_runIirFilterAllTest: Output from filter_iirFilterAll() "
+               "for filter %d (%24.20le) does not match filter_iirFilter() "
+               "(%24.20le) at index(%d).\n",
+               n, outputs[n], goldenOutputs[i][n], i);
+        break;
+      }
+    }
+  }
+  // Print informational messages.
+  if (printMessageFlag) {
+    printf("filter_runIirFilterAllTest ");
+    if (success)
+      printf("passed.\n");
+    else
+      printf("failed.\n");
+  }
+  return success; // Return the success or failure of the test.
+}
+#endif
+
 // Golden compute power function.
 // Accepts a queue and computes the power value by computing the sum of the
 // squares. Returns the computer power value.
@@ -852,9 +1299,159 @@ double filterTest_computeGoldenPowerValue(queue_t *q) {
 }
 
 #define TEST_PASS_EPSILON 10E-11 // Should be in this range.
+// Power values computed by the fixed-point filters are compared with a relative
+// bound instead (see filterFixedPoint.h).
+#ifdef FILTER_FIXED_POINT
+#define FILTER_TEST_POWER_ERROR(testValue, goldenValue)                        \
+  (fabs((testValue) - (goldenValue)) >                                         \
+   FILTER_FIXED_POINT_POWER_RELATIVE_EPSILON * fabs(goldenValue))
+#else
+#define FILTER_TEST_POWER_ERROR(testValue, goldenValue)                        \
+  (fabs((testValue) - (goldenValue)) > TEST_PASS_EPSILON)
+#endif
 #define TEST_INCREMENTAL_LOOP_COUNT                                            \
   3000 // Loop over the incremental test this many times.
 #define OUTPUT_QUEUE_SIZE 2000
+#ifdef FILTER_GATING
+// Input for the gating test, in FIR outputs: noise, with a square-wave shot
+// every FILTER_TEST_GATING_SHOT_PERIOD outputs, 0.5 s, the lockout time and so
+// the most hits a sensor can take. Each shot is at the next frequency. The
+// first one comes after the gates' warm-up and a gap shorter than
+// FILTER_GATING_HISTORY_SIZE, the others after longer gaps in their own band.
+#define FILTER_TEST_GATING_FIRST_SHOT 12000
+#define FILTER_TEST_GATING_SHOT_PERIOD 5000
+#define FILTER_TEST_GATING_SHOT_COUNT FILTER_FREQUENCY_COUNT
+#define FILTER_TEST_GATING_SHOT_LENGTH OUTPUT_QUEUE_SIZE
+#define FILTER_TEST_GATING_LENGTH                                              \
+  (FILTER_TEST_GATING_FIRST_SHOT +                                             \
+   FILTER_TEST_GATING_SHOT_COUNT * FILTER_TEST_GATING_SHOT_PERIOD)
+#define FILTER_TEST_GATING_CHECK_PERIOD 100 // Powers are compared this often.
+#define FILTER_TEST_GATING_NOISE 0.05
+#define FILTER_TEST_GATING_AMPLITUDE 0.5
+#define FILTER_TEST_GATING_SEED 1
+// IIR outputs that must not be computed from the first shot on. The test
+// input saves 50.9%.
+#define FILTER_TEST_GATING_MIN_SAVED_PERCENT 45.0
+
+// Runs the gating test input through the filters and writes, every
+// FILTER_TEST_GATING_CHECK_PERIOD FIR outputs, the power of every band to
+// powers[][] and whether it was open to open[][]. Returns the percentage of IIR
+// outputs not computed from the first shot on.
+static double filterTest_runGatingInput(double powers[][FILTER_FREQUENCY_COUNT],
+                                        bool open[][FILTER_FREQUENCY_COUNT]) {
+  filter_init();
+  srand(FILTER_TEST_GATING_SEED);
+  // IIR outputs, and those not computed, before the first shot.
+  int64_t outputsBefore = 0, savedBefore = 0;
+  for (uint32_t i = 0; i < FILTER_TEST_GATING_LENGTH; i++) {
+    int32_t shotTime = (int32_t)i - FILTER_TEST_GATING_FIRST_SHOT;
+    uint16_t shot = shotTime / FILTER_TEST_GATING_SHOT_PERIOD;
+    bool inShot = shotTime >= 0 && shotTime % FILTER_TEST_GATING_SHOT_PERIOD <
+                                       FILTER_TEST_GATING_SHOT_LENGTH;
+    uint16_t period = filter_frequencyTickTable[shot % FILTER_FREQUENCY_COUNT];
+    for (uint16_t j = 0; j < FILTER_FIR_DECIMATION_FACTOR; j++) {
+      uint32_t tick = i * FILTER_FIR_DECIMATION_FACTOR + j;
+      double x = FILTER_TEST_GATING_NOISE *
+                 (2.0 * filterTest_randomValue0To1() - 1.0);
+      if (inShot)
+        x += FILTER_TEST_GATING_AMPLITUDE *
+             computeFilterInput(tick % period, period);
+      filter_addNewInput(x);
+    }
+    filter_firFilter();
+    filter_iirFilterAll(NULL);
+    if (i + 1 == FILTER_TEST_GATING_FIRST_SHOT) {
+      for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+        filter_gatingStats_t stats;
+        filter_getGatingStats(n, &stats);
+        outputsBefore += (int64_t)stats.computedCount + stats.skippedCount;
+        savedBefore += (int64_t)stats.skippedCount - stats.replayedCount;
+      }
+    }
+    if ((i + 1) % FILTER_TEST_GATING_CHECK_PERIOD == 0) {
+      uint32_t check = i / FILTER_TEST_GATING_CHECK_PERIOD;
+      for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+        filter_gatingStats_t stats;
+        filter_getGatingStats(n, &stats);
+        powers[check][n] = filter_computePower(n, false, false);
+        open[check][n] = stats.open;
+      }
+    }
+  }
+  int64_t outputs = -outputsBefore, saved = -savedBefore;
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    filter_gatingStats_t stats;
+    filter_getGatingStats(n, &stats);
+    outputs += (int64_t)stats.computedCount + stats.skippedCount;
+    saved += (int64_t)stats.skippedCount - stats.replayedCount;
+  }
+  return 100.0 * saved / outputs;
+}
+
+#define FILTER_TEST_GATING_CHECK_COUNT                                         \
+  (FILTER_TEST_GATING_LENGTH / FILTER_TEST_GATING_CHECK_PERIOD)
+// Checks that gating skips enough IIR work at one shot every 0.5 s, that the
+// band of each shot is open for it, that the powers of open bands match an
+// ungated run and that closed bands report less than FILTER_GATING_OPEN_POWER.
+static bool filterTest_runGatingTest(bool printMessageFlag) {
+  static double goldenPowers[FILTER_TEST_GATING_CHECK_COUNT]
+                            [FILTER_FREQUENCY_COUNT];
+  static double powers[FILTER_TEST_GATING_CHECK_COUNT][FILTER_FREQUENCY_COUNT];
+  static bool open[FILTER_TEST_GATING_CHECK_COUNT][FILTER_FREQUENCY_COUNT];
+  bool success = true; // Be optimistic.
+  filter_setGatingEnabled(false);
+  filterTest_runGatingInput(goldenPowers, open);
+  filter_setGatingEnabled(true);
+  double savedPercent = filterTest_runGatingInput(powers, open);
+  filter_setGatingEnabled(false);
+  if (savedPercent < FILTER_TEST_GATING_MIN_SAVED_PERCENT) {
+    success = false;
+    printf("filterTest_runGatingTest: only %.1f%% of IIR outputs were not "
+           "computed; expected at least %.1f%%.\n",
+           savedPercent, FILTER_TEST_GATING_MIN_SAVED_PERCENT);
+  }
+  for (uint16_t shot = 0; shot < FILTER_TEST_GATING_SHOT_COUNT; shot++) {
+    // The last check in the shot.
+    uint32_t check =
+        (FILTER_TEST_GATING_FIRST_SHOT + shot * FILTER_TEST_GATING_SHOT_PERIOD +
+         FILTER_TEST_GATING_SHOT_LENGTH) /
+            FILTER_TEST_GATING_CHECK_PERIOD -
+        1;
+    if (!open[check][shot % FILTER_FREQUENCY_COUNT]) {
+      success = false;
+      printf("filterTest_runGatingTest: the band of shot %d was not open.\n",
+             shot);
+    }
+  }
+  for (uint32_t check = 0; check < FILTER_TEST_GATING_CHECK_COUNT && success;
+       check++) {
+    for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+      if (open[check][n] ? FILTER_TEST_POWER_ERROR(powers[check][n],
+                                                   goldenPowers[check][n])
+                         : powers[check][n] > FILTER_GATING_OPEN_POWER) {
+        success = false;
+        printf("filterTest_runGatingTest: power of %s filter %d (%le) does "
+               "not match the ungated power (%le) at FIR output %d.\n",
+               open[check][n] ? "open" : "closed", n, powers[check][n],
+               goldenPowers[check][n],
+               (check + 1) * FILTER_TEST_GATING_CHECK_PERIOD);
+        break;
+      }
+    }
+  }
+  if (printMessageFlag) {
+    printf("filterTest_runGatingTest: %.1f%% of IIR outputs not computed at "
+           "one shot every 0.5 s. ",
+           savedPercent);
+    if (success)
+      printf("passed.\n");
+    else
+      printf("failed.\n");
+  }
+  return success;
+}
+#endif
+
 // Performs a test of the filter_computePower() function.
 // This test:
 // 1. fills all 10 IIR output queues with random values,
@@ -893,7 +1490,11 @@ bool filterTest_runPowerTest() {
     // Compute power with the filter function.
     double testValue = filter_computePower(
         i, true, false);            // true, false = no force, no debug print.
+#ifdef FILTER_FIXED_POINT
+    if (FILTER_TEST_POWER_ERROR(testValue, goldenValue)) { // Check for errors.
+#else
     if (testValue != goldenValue) { // Check for errors.
+#endif
       printf("filter_runPowerTest failed for index: %d: , golden value: %lf, "
              "filter_computePower(): %lf\n",
              i, goldenValue, testValue);
@@ -923,9 +1524,9 @@ bool filterTest_runPowerTest() {
           filterTest_computeGoldenPowerValue(q); // Compute the golden value.
       double testValue = filter_computePower(
           i, false, false); // false, false = no force, no debug print.
-      if (fabs(testValue - goldenValue) >
-          TEST_PASS_EPSILON) { // See if the value is in error beyond some
-                               // epsilon.
+      if (FILTER_TEST_POWER_ERROR(
+              testValue, goldenValue)) { // See if the value is in error beyond
+                                         // some epsilon.
         printf("Loop count:%d\n",
                loopCount); // Print out the current loop count for reference.
         // Print out values that indicates the failure.
@@ -947,6 +1548,88 @@ bool filterTest_runPowerTest() {
   return firstComputeStatus & incrementalComputeStatus;
 }
 
+#ifdef FILTER_SLIDING_DFT
+// FIR outputs fed to the bins by filterTest_runSlidingDftPowerTest().
+#define SLIDING_DFT_POWER_TEST_LENGTH (3 * FILTER_SLIDING_DFT_WINDOW_SIZE)
+// Bin n is updated every 1 + n * SLIDING_DFT_POWER_TEST_STRIDE_STEP FIR
+// outputs, so later bins lag by more than FILTER_SLIDING_DFT_CATCH_UP_COUNT.
+#define SLIDING_DFT_POWER_TEST_STRIDE_STEP 7
+// Every bin is brought up to date and checked this often.
+#define SLIDING_DFT_POWER_TEST_CHECK_PERIOD 250
+#define SLIDING_DFT_POWER_TEST_RELATIVE_EPSILON 1.0e-9
+
+// Returns 2|X|^2/W for the DFT X of window[], which holds the last W FIR
+// outputs starting at index start, at the frequency of filterNumber.
+static double filterTest_computeGoldenDftPower(const double window[],
+                                               uint32_t start,
+                                               uint16_t filterNumber) {
+  double w = 2.0 * M_PI * FILTER_FIR_DECIMATION_FACTOR /
+             filter_frequencyTickTable[filterNumber];
+  double real = 0.0;
+  double imaginary = 0.0;
+  for (uint32_t i = 0; i < FILTER_SLIDING_DFT_WINDOW_SIZE; i++) {
+    double y = window[(start + i) % FILTER_SLIDING_DFT_WINDOW_SIZE];
+    real += y * cos(w * i);
+    imaginary -= y * sin(w * i);
+  }
+  return 2.0 * (real * real + imaginary * imaginary) /
+         FILTER_SLIDING_DFT_WINDOW_SIZE;
+}
+
+// Performs a test of filter_computePower() for filterSlidingDft.c, which has
+// no IIR output queues. Feeds random inputs through the FIR filter and updates
+// bin n every 1 + n * SLIDING_DFT_POWER_TEST_STRIDE_STEP FIR outputs, so that
+// bins both catch up and are recomputed. Every
+// SLIDING_DFT_POWER_TEST_CHECK_PERIOD outputs, updates every bin and compares
+// its power, incremental and forced, with a DFT of the last W FIR outputs.
+bool filterTest_runSlidingDftPowerTest(bool printMessageFlag) {
+  static double window[FILTER_SLIDING_DFT_WINDOW_SIZE]; // Last W FIR outputs.
+  bool success = true; // Be optimistic.
+  filter_init();
+  for (uint32_t i = 0; i < FILTER_SLIDING_DFT_WINDOW_SIZE; i++)
+    window[i] = 0.0;
+  for (uint32_t count = 1; count <= SLIDING_DFT_POWER_TEST_LENGTH && success;
+       count++) {
+    for (uint16_t i = 0; i < FILTER_FIR_DECIMATION_FACTOR; i++)
+      filter_addNewInput(TIMES2_FP(filterTest_randomValue0To1()) - 1.0);
+    filter_firFilter();
+    window[count % FILTER_SLIDING_DFT_WINDOW_SIZE] =
+        filterTest_readMostRecentValueFromQueue(filter_getYQueue());
+    bool check = count % SLIDING_DFT_POWER_TEST_CHECK_PERIOD == 0;
+    for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+      if (check || count % (1 + n * SLIDING_DFT_POWER_TEST_STRIDE_STEP) == 0)
+        filter_iirFilter(n);
+      if (!check)
+        continue;
+      double goldenValue = filterTest_computeGoldenDftPower(
+          window, count + 1, n); // The oldest output follows the newest.
+      double values[] = {filter_computePower(n, false, false),
+                         filter_computePower(n, true, false)};
+      for (uint16_t forced = 0; forced < 2; forced++) {
+        if (fabs(values[forced] - goldenValue) >
+            SLIDING_DFT_POWER_TEST_RELATIVE_EPSILON * goldenValue) {
+          printf("filterTest_runSlidingDftPowerTest failed for index %d after "
+                 "%d FIR outputs (%s): golden value: %le, "
+                 "filter_computePower(): %le\n",
+                 n, count, forced ? "forced" : "incremental", goldenValue,
+                 values[forced]);
+          success = false;
+        }
+      }
+    }
+  }
+  // Print informational messages.
+  if (printMessageFlag) {
+    printf("filterTest_runSlidingDftPowerTest ");
+    if (success)
+      printf("passed.\n");
+    else
+      printf("failed.\n");
+  }
+  return success; // Return the success or failure of the test.
+}
+#endif
+
 // Copies powerValues to currentPowerValues, the same array
 // that is used to hold the values after power has been computed
 // by filter_computePower().
@@ -956,6 +1639,331 @@ bool filterTest_runPowerTest() {
 //  }
 //}
 
+#ifdef FILTER_TEST_BUILT_IN_FILTER
+// Largest difference between the tables in filterCoefficients.c and the
+// design, relative to the largest coefficient of the same row. The tables were
+// generated by the same code, perhaps with a different math library.
+#define FILTER_TEST_DESIGN_TOLERANCE 1.0e-9
+
+// Returns true if designed matches table to within
+// FILTER_TEST_DESIGN_TOLERANCE. Prints the first mismatch.
+static bool filterTest_compareDesign(const char *name, uint16_t row,
+                                     const double designed[],
+                                     const double table[], uint16_t count) {
+  double largest = 0.0;
+  for (uint16_t i = 0; i < count; i++)
+    if (fabs(table[i]) > largest)
+      largest = fabs(table[i]);
+  for (uint16_t i = 0; i < count; i++) {
+    if (fabs(designed[i] - table[i]) > FILTER_TEST_DESIGN_TOLERANCE * largest) {
+      printf("%s[%d][%d] is %.17e, the design has %.17e.\n", name, row, i,
+             table[i], designed[i]);
+      return false;
+    }
+  }
+  return true;
+}
+
+#ifdef FILTER_FIXED_POINT
+// Returns true if the fixed-point table entry is value rounded to
+// fractionBits. Prints a mismatch.
+static bool filterTest_compareFixed(const char *name, uint16_t index,
+                                    int32_t fixed, double value,
+                                    uint16_t fractionBits) {
+  if (fixed == filterDesign_toFixed(value, fractionBits))
+    return true;
+  printf("%s[%d] is %ld, %.17e rounds to %ld.\n", name, index, (long)fixed,
+         value, (long)filterDesign_toFixed(value, fractionBits));
+  return false;
+}
+#endif
+
+// Checks that filterCoefficients.c is up to date: filter_frequencyTickTable
+// must hold the frequencies of filterDesign_frequencyTicks(), and the tables
+// must match the filters that filterDesign.c designs for them, and meet the
+// specification in filterDesign.h. With FILTER_FIXED_POINT, also checks
+// that the fixed-point tables hold the same coefficients.
+static bool filterTest_runCoefficientTest() {
+  printf("+++++ Starting filterTest_runCoefficientTest +++++\n");
+  bool success = true; // Be optimistic.
+  double fir[FILTER_FIR_COEFFICIENT_COUNT];
+  double compensation[FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT];
+  uint16_t ticks[FILTER_FREQUENCY_COUNT];
+  filterDesign_frequencyTicks(ticks);
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    if (filter_frequencyTickTable[n] != ticks[n]) {
+      printf("filter_frequencyTickTable[%d] is %d, the design gives %d.\n", n,
+             filter_frequencyTickTable[n], ticks[n]);
+      success = false;
+    }
+  }
+  filterDesign_fir(fir);
+  filterDesign_cicCompensation(fir, compensation);
+  success &= filterTest_compareDesign("filterCoefficients_fir", 0, fir,
+                                      filterCoefficients_fir,
+                                      FILTER_FIR_COEFFICIENT_COUNT);
+  success &= filterTest_compareDesign(
+      "filterCoefficients_cicCompensation", 0, compensation,
+      filterCoefficients_cicCompensation,
+      FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT);
+  success &= filterDesign_checkFir(filterCoefficients_fir);
+  success &= filterDesign_checkCicCompensation(
+      filterCoefficients_fir, filterCoefficients_cicCompensation);
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++) {
+    double sos[FILTER_IIR_SECTION_COUNT][FILTER_IIR_SECTION_COEFFICIENT_COUNT];
+    double a[FILTER_IIR_A_COEFFICIENT_COUNT];
+    double b[FILTER_IIR_B_COEFFICIENT_COUNT];
+    filterDesign_iirBandPass(filterDesign_userFrequency(n), sos, a, b);
+    for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++)
+      success &= filterTest_compareDesign(
+          "filterCoefficients_iirSos", n, sos[s],
+          filterCoefficients_iirSos[n][s],
+          FILTER_IIR_SECTION_COEFFICIENT_COUNT);
+    success &= filterTest_compareDesign("filterCoefficients_iirA", n, a,
+                                        filterCoefficients_iirA[n],
+                                        FILTER_IIR_A_COEFFICIENT_COUNT);
+    success &= filterTest_compareDesign("filterCoefficients_iirB", n, b,
+                                        filterCoefficients_iirB[n],
+                                        FILTER_IIR_B_COEFFICIENT_COUNT);
+    success &= filterDesign_checkIir(n, filterCoefficients_iirSos[n]);
+  }
+#ifdef FILTER_FIXED_POINT
+  for (uint16_t i = 0; i < FILTER_FIR_COEFFICIENT_COUNT; i++)
+    success &= filterTest_compareFixed(
+        "filterCoefficients_firFixed", i, filterCoefficients_firFixed[i],
+        filterCoefficients_fir[FILTER_FIR_COEFFICIENT_COUNT - 1 - i],
+        FILTER_FIXED_POINT_FIR_COEFFICIENT_BITS);
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+    for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++)
+      for (uint16_t c = 0; c < FILTER_IIR_SECTION_COEFFICIENT_COUNT; c++)
+        success &= filterTest_compareFixed(
+            "filterCoefficients_iirSosFixed", n,
+            filterCoefficients_iirSosFixed[s][c][n],
+            filterCoefficients_iirSos[n][s][c],
+            FILTER_FIXED_POINT_IIR_COEFFICIENT_BITS);
+  double cicGain = pow(FILTER_FIR_DECIMATION_FACTOR, FILTER_CIC_STAGE_COUNT);
+  for (uint16_t i = 0; i < FILTER_CIC_COMPENSATION_HALF_COUNT; i++)
+    success &= filterTest_compareFixed(
+        "filterCoefficients_cicCompensationFixed", i,
+        filterCoefficients_cicCompensationFixed[i],
+        filterCoefficients_cicCompensation[i] / cicGain,
+        FILTER_FIXED_POINT_CIC_COEFFICIENT_BITS);
+#endif
+  printf("+++++ Exiting filterTest_runCoefficientTest (%s) +++++\n",
+         success ? "passed" : "failed");
+  return success;
+}
+#endif
+
+#ifdef FILTER_TEST_ANALYTIC
+// The analytic test computes the steady-state power of the filters for the
+// square waves of the simulations above with filterResponse.h, instead of
+// simulating a pulse-width of inputs. It measures the impulse responses of the
+// filters as built, and compares the powers they give with the powers the
+// coefficient tables give. Amplitudes (square roots of the powers) may differ
+// by FILTER_TEST_ANALYTIC_RELATIVE_TOLERANCE of the golden amplitude plus
+// FILTER_TEST_ANALYTIC_ABSOLUTE_TOLERANCE of the largest golden amplitude of
+// the same filter.
+#ifdef FILTER_FIXED_POINT
+#define FILTER_TEST_ANALYTIC_RELATIVE_TOLERANCE 1.0e-3
+#define FILTER_TEST_ANALYTIC_ABSOLUTE_TOLERANCE 1.0e-4
+#else
+#define FILTER_TEST_ANALYTIC_RELATIVE_TOLERANCE 1.0e-9
+#define FILTER_TEST_ANALYTIC_ABSOLUTE_TOLERANCE 1.0e-9
+#endif
+// The IIR impulse responses are measured for this many outputs. The rest of
+// each response adds up to less than 1e-14 of its peak.
+#define FILTER_TEST_IIR_IMPULSE_RESPONSE_LENGTH 8000
+// The FIR filter runs after every FILTER_FIR_DECIMATION_FACTOR-th input,
+// starting with input FILTER_TEST_DECIMATION_PHASE.
+#define FILTER_TEST_DECIMATION_PHASE (FILTER_FIR_DECIMATION_FACTOR - 1)
+// Steady-state powers are scaled to this many outputs, the number of FIR
+// outputs in a pulse-width, to compare with the simulations.
+#define FILTER_TEST_DECIMATED_PULSE_WIDTH_LENGTH                               \
+  (FILTER_TEST_PULSE_WIDTH_LENGTH / FILTER_FIR_DECIMATION_FACTOR)
+
+// Measures the impulse response of the FIR filter (or the CIC front end) as
+// built, decimation included: after an impulse at input p, FIR output m is
+// h[FILTER_FIR_DECIMATION_FACTOR * m + FILTER_TEST_DECIMATION_PHASE - p]. Each
+// p gives every FILTER_FIR_DECIMATION_FACTOR-th value of h[].
+static void filterTest_measureFrontEnd(double h[FILTER_TEST_FRONT_END_LENGTH]) {
+  for (uint16_t p = 0; p < FILTER_FIR_DECIMATION_FACTOR; p++) {
+    filterTest_flushFilters();
+    uint32_t outputCount = 0;
+    for (uint32_t i = 0;
+         i < FILTER_TEST_FRONT_END_LENGTH + FILTER_FIR_DECIMATION_FACTOR; i++) {
+      filter_addNewInput(i == p ? 1.0 : 0.0);
+      if (filterTest_decimatingFirFilter()) {
+        uint32_t n = FILTER_FIR_DECIMATION_FACTOR * outputCount++ +
+                     FILTER_TEST_DECIMATION_PHASE - p;
+        if (n < FILTER_TEST_FRONT_END_LENGTH)
+          h[n] = filterTest_readMostRecentValueFromQueue(filter_getYQueue());
+      }
+    }
+  }
+}
+
+// Computes the impulse response of the FIR filter (or the CIC front end) from
+// the coefficient tables.
+static void filterTest_computeGoldenFrontEnd(
+    double h[FILTER_TEST_FRONT_END_LENGTH]) {
+  for (uint32_t n = 0; n < FILTER_TEST_FRONT_END_LENGTH; n++)
+    h[n] = 0.0;
+#ifdef FILTER_CIC
+  filterResponse_cicImpulseResponse(filterCoefficients_cicCompensation, h);
+#else
+  for (uint32_t n = 0; n < filter_getFirCoefficientCount(); n++)
+    h[n] = filter_getFirCoefficientArray()[n];
+#endif
+}
+
+// Returns the power over a pulse-width of the steady-state FIR output for the
+// square wave with period tickCount, for the front end with impulse response
+// h[]. Writes one period of the FIR output to z[] and its length to zPeriod.
+static double filterTest_computeFrontEndPower(const double h[],
+                                              uint16_t tickCount, double z[],
+                                              uint16_t *zPeriod) {
+  double x[FILTER_RESPONSE_MAX_PERIOD];
+  double y[FILTER_RESPONSE_MAX_PERIOD];
+  filterResponse_squareWave(tickCount, x);
+  filterResponse_impulseResponseOutput(h, FILTER_TEST_FRONT_END_LENGTH, x,
+                                       tickCount, y);
+  *zPeriod = filterResponse_decimate(y, tickCount, FILTER_FIR_DECIMATION_FACTOR,
+                                     FILTER_TEST_DECIMATION_PHASE, z);
+  return filterResponse_meanSquare(z, *zPeriod) *
+         FILTER_TEST_DECIMATED_PULSE_WIDTH_LENGTH;
+}
+
+// Returns true if the measured power is close enough to the golden power.
+// peak is the largest golden power of the same filter. Prints a mismatch.
+static bool filterTest_compareAnalyticPower(const char *name,
+                                            uint16_t testPeriodIndex,
+                                            double power, double goldenPower,
+                                            double peak) {
+  if (fabs(sqrt(power) - sqrt(goldenPower)) <=
+      FILTER_TEST_ANALYTIC_RELATIVE_TOLERANCE * sqrt(goldenPower) +
+          FILTER_TEST_ANALYTIC_ABSOLUTE_TOLERANCE * sqrt(peak))
+    return true;
+  printf("filterTest_runAnalyticTest: %s power for a period of %d ticks is "
+         "%le, the coefficients give %le.\n",
+         name, filterTest_firTestTickCounts[testPeriodIndex], power,
+         goldenPower);
+  return false;
+}
+
+#ifndef FILTER_SLIDING_DFT
+// Measures the impulse response of IIR filter filterNumber as built, by
+// pushing a single 1.0 through the yQueue.
+static void filterTest_measureIir(
+    uint16_t filterNumber, double h[FILTER_TEST_IIR_IMPULSE_RESPONSE_LENGTH]) {
+  filter_fillQueue(filter_getYQueue(), 0.0); // zero-out the yQueue.
+  filter_fillQueue(filter_getZQueue(filterNumber),
+                   0.0); // zero out the zQueue for filterNumber.
+  queue_overwritePush(filter_getYQueue(),
+                      1.0); // Place a single 1.0 in the yQueue.
+  for (uint32_t i = 0; i < FILTER_TEST_IIR_IMPULSE_RESPONSE_LENGTH; i++) {
+    h[i] = filter_iirFilter(filterNumber); // Run the IIR filter.
+    queue_overwritePush(filter_getYQueue(),
+                        0.0); // Shift the 1.0 over one position in the yQueue.
+  }
+}
+#endif
+
+// Checks the frequency response of the filters without simulating them. The
+// FIR filter is checked at all test frequencies, and each IIR filter at the
+// user frequencies, using the FIR output as its input. Plots the same
+// frequency responses as the square-wave tests, and returns true if every
+// power matches the coefficient tables.
+bool filterTest_runAnalyticTest(bool printMessageFlag) {
+  if (!filterTest_initFlag) {
+    printf("Must call filterTest_init() before running any filter tests.\n");
+    return false;
+  }
+  bool success = true; // Be optimistic.
+  double frontEnd[FILTER_TEST_FRONT_END_LENGTH];
+  double goldenFrontEnd[FILTER_TEST_FRONT_END_LENGTH];
+  filterTest_measureFrontEnd(frontEnd);
+  filterTest_computeGoldenFrontEnd(goldenFrontEnd);
+  // One period of the FIR output for each test frequency, to feed to the IIR
+  // filters. The measured and golden periods are the same length.
+  static double firOutput[FILTER_TEST_FIR_POWER_TEST_PERIOD_COUNT]
+                         [FILTER_RESPONSE_MAX_PERIOD];
+  static double goldenFirOutput[FILTER_TEST_FIR_POWER_TEST_PERIOD_COUNT]
+                               [FILTER_RESPONSE_MAX_PERIOD];
+  uint16_t firOutputPeriod[FILTER_TEST_FIR_POWER_TEST_PERIOD_COUNT];
+  double firPower[FILTER_TEST_FIR_POWER_TEST_PERIOD_COUNT];
+  double goldenFirPower[FILTER_TEST_FIR_POWER_TEST_PERIOD_COUNT];
+  for (uint16_t i = 0; i < FILTER_TEST_FIR_POWER_TEST_PERIOD_COUNT; i++) {
+    firPower[i] = filterTest_computeFrontEndPower(
+        frontEnd, filterTest_firTestTickCounts[i], firOutput[i],
+        &firOutputPeriod[i]);
+    goldenFirPower[i] = filterTest_computeFrontEndPower(
+        goldenFrontEnd, filterTest_firTestTickCounts[i], goldenFirOutput[i],
+        &firOutputPeriod[i]);
+  }
+  double peak = findMax(goldenFirPower, FILTER_TEST_FIR_POWER_TEST_PERIOD_COUNT);
+  for (uint16_t i = 0; i < FILTER_TEST_FIR_POWER_TEST_PERIOD_COUNT; i++) {
+    success &= filterTest_compareAnalyticPower("FIR", i, firPower[i],
+                                               goldenFirPower[i], peak);
+    if (printMessageFlag)
+      printf("freqCount:%d, testPeriodPowerValue:%le\n", i, firPower[i]);
+  }
+  filterTest_plotFirFrequencyResponse(firPower);
+#ifndef FILTER_SLIDING_DFT
+  // The sliding DFT has no IIR coefficients to compare with.
+  static double iir[FILTER_TEST_IIR_IMPULSE_RESPONSE_LENGTH];
+  uint16_t aStart = filterTest_getIirACoefficientArrayStartingIndex();
+  for (uint16_t filterNumber = 0; filterNumber < FILTER_FREQUENCY_COUNT;
+       filterNumber++) {
+    filterTest_measureIir(filterNumber, iir);
+    double iirPower[FILTER_FREQUENCY_COUNT];
+    double goldenIirPower[FILTER_FREQUENCY_COUNT];
+    for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+      double z[FILTER_RESPONSE_MAX_PERIOD];
+      filterResponse_impulseResponseOutput(
+          iir, FILTER_TEST_IIR_IMPULSE_RESPONSE_LENGTH, firOutput[i],
+          firOutputPeriod[i], z);
+      iirPower[i] = filterResponse_meanSquare(z, firOutputPeriod[i]) *
+                    FILTER_TEST_DECIMATED_PULSE_WIDTH_LENGTH;
+      filterResponse_transferFunctionOutput(
+          filter_getIirBCoefficientArray(filterNumber),
+          filter_getIirBCoefficientCount(),
+          filter_getIirACoefficientArray(filterNumber) + aStart,
+          filter_getIirACoefficientCount() - aStart, goldenFirOutput[i],
+          firOutputPeriod[i], z);
+      goldenIirPower[i] = filterResponse_meanSquare(z, firOutputPeriod[i]) *
+                          FILTER_TEST_DECIMATED_PULSE_WIDTH_LENGTH;
+    }
+    char name[MAX_BUF];
+    snprintf(name, MAX_BUF, "IIR(%d)", filterNumber);
+    peak = findMax(goldenIirPower, FILTER_FREQUENCY_COUNT);
+    double strongestOther = 0.0; // Largest power at another user frequency.
+    for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+      success &= filterTest_compareAnalyticPower(name, i, iirPower[i],
+                                                 goldenIirPower[i], peak);
+      if (i != filterNumber && iirPower[i] > strongestOther)
+        strongestOther = iirPower[i];
+    }
+    if (printMessageFlag)
+      printf("IIR filter %d rejects the other user frequencies by at least "
+             "%.1f dB.\n",
+             filterNumber,
+             10.0 * log10(iirPower[filterNumber] / strongestOther));
+    filterTest_plotIirFrequencyResponse(iirPower, filterNumber);
+  }
+#endif
+  // Print informational messages.
+  if (printMessageFlag) {
+    printf("filterTest_runAnalyticTest ");
+    if (success)
+      printf("passed.\n");
+    else
+      printf("failed.\n");
+  }
+  return success; // Return the success or failure of the test.
+}
+#endif
+
 #define TEN_SECONDS 10000
 #define TWO_SECONDS 2000
 #define FOUR_SECONDS 4000
@@ -971,16 +1979,46 @@ bool filterTest_runPowerTest() {
 // 5. Plots the frequency response of each of the IIR bandpass filters on the
 // TFT display. Returns true if all tests passed, false otherwise. Various
 // informational prints are provided in the console during the run of the test.
+// With FILTER_TEST_ANALYTIC, 4. and 5. are computed from the impulse responses
+// (see filterTest_runAnalyticTest()) instead of simulated, and are checked
+// against the coefficients.
 bool filterTest_runTest() {
   printf("******** filterTest_runTest() **********\n");
   bool success = true; // Be optimistic.
   filter_init();       // Always must init stuff.
   filterTest_init();   // More init stuff.
+#ifdef FILTER_TEST_BUILT_IN_FILTER
+  // Check that the coefficient tables are the current design, and that it
+  // meets the filter specification.
+  success &= filterTest_runCoefficientTest();
+#endif
+#ifdef FILTER_GATING
+  // The tests below write the queues directly (see filterFixedPoint.h).
+  filter_setGatingEnabled(false);
+#endif
+#ifndef FILTER_CIC
   // Confirm that the FIR coefficients are properly aligned with the incoming
-  // data.
+  // data. The CIC front end is checked by the square-wave test below instead.
   success &= filterTest_runFirAlignmentTest(PRINT_INFO_MESSAGES);
   // Confirm that the FIR properly computes its output.
   success &= filterTest_runFirArithmeticTest(PRINT_INFO_MESSAGES);
+#endif
+#ifdef FILTER_TEST_BUILT_IN_FILTER
+  // Confirm that block filtering matches filtering one input at a time.
+  success &= filterTest_runFirBlockTest(PRINT_INFO_MESSAGES);
+#endif
+#if defined(FILTER_SLIDING_DFT)
+  // The sliding DFT has no IIR filters or IIR output queues (see
+  // filterSlidingDft.h). Check the power of its bins against a direct DFT.
+  success &= filterTest_runSlidingDftPowerTest(PRINT_INFO_MESSAGES);
+#elif defined(FILTER_FIXED_POINT)
+  // The fixed-point IIR filters are second-order sections, so the direct-form
+  // alignment tests do not apply. Check every filter's impulse response against
+  // the direct-form coefficients instead.
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    success &= filterTest_runIirImpulseResponseTest(
+        i, PRINT_INFO_MESSAGES, FILTER_FIXED_POINT_IIR_EPSILON);
+#else
   // Confirm that the IIR A coefficients are properly aligned with the incoming
   // data.
   success &= filterTest_runIirAAlignmentTest(TEST_IIR_FILTER_NUMBER,
@@ -989,11 +2027,30 @@ bool filterTest_runTest() {
   // data.
   success &= filterTest_runIirBAlignmentTest(TEST_IIR_FILTER_NUMBER,
                                              PRINT_INFO_MESSAGES);
+#endif
+#ifndef FILTER_SLIDING_DFT
+#ifdef FILTER_FIXED_POINT
+  // Confirm that running all IIR filters at once matches running them one at
+  // a time.
+  success &= filterTest_runIirFilterAllTest(PRINT_INFO_MESSAGES);
+#endif
   // Verifies correct functionality of the power computation.
   success &= filterTest_runPowerTest();
+#endif
+#ifdef FILTER_GATING
+  // Confirm that gating saves IIR work and that open bands stay exact.
+  success &= filterTest_runGatingTest(PRINT_INFO_MESSAGES);
+#endif
+#ifdef FILTER_TEST_ANALYTIC
+  // Computes the same frequency responses from the impulse responses and
+  // checks them against the coefficients. The plots are not held on the
+  // display.
+  success &= filterTest_runAnalyticTest(PRINT_INFO_MESSAGES);
+#else
   // Plots the frequency response of the FIR filter against all user and other
   // test frequencies. All frequencies are expressed as a square wave.
-  filterTest_runSquareWaveFirPowerTest(PRINT_INFO_MESSAGES, PLOT_INPUT);
+  success &=
+      filterTest_runSquareWaveFirPowerTest(PRINT_INFO_MESSAGES, PLOT_INPUT);
   utils_msDelay(FOUR_SECONDS); // Leave on the display for a couple of seconds.
   for (int i = 0; i < FILTER_FREQUENCY_COUNT;
        i++) { // Plot all 10 IIR filters against the test freqs.
@@ -1001,6 +2058,10 @@ bool filterTest_runTest() {
         i, true);               // This plots the individual filter response.
     utils_msDelay(TWO_SECONDS); // Leave on the display for a few seconds.
   }
+#endif
+#ifdef FILTER_GATING
+  filter_setGatingEnabled(true);
+#endif
   return success;
 }
 
@@ -10,9 +10,18 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #ifndef FILTERTEST_H_
 #define FILTERTEST_H_
 
+#include <stdbool.h>
+
 // Initialize filterTest. Called by filterTest_runTest().
 void filterTest_init();
 
+// Plots the power of the FIR filter's output for square waves at the user and
+// other test frequencies on the TFT. With FILTER_CIC, also compares the power at
+// each user frequency with that of the 81-tap FIR filter. Returns false if that
+// comparison fails.
+bool filterTest_runSquareWaveFirPowerTest(bool printMessageFlag,
+                                          bool plotInputFlag);
+
 // Performs a comprehensive test of the FIR, IIR filters and plots frequency
 // response on the TFT.
 bool filterTest_runTest();
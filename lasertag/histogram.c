@@ -23,6 +23,7 @@ static uint16_t histogram_barCount = HISTOGRAM_DEFAULT_BAR_COUNT;
 static uint16_t
     histogram_barWidth; // May share this with other functions in this package.
 static uint16_t topLabelMaxWidthInChars; // How many chars will be printed.
+static uint16_t bottomLabelTextSize;     // Depends on the bar width.
 static histogram_data_t
     currentBarData[HISTOGRAM_MAX_BAR_COUNT]; // Current histogram data.
 static histogram_data_t
@@ -42,36 +43,22 @@ static char
 
 static bool initFlag =
     false; // Keep track whether histogram_init() has been called.
-// These are the default colors for the bars.
-const static uint16_t histogram_defaultBarColors[HISTOGRAM_MAX_BAR_COUNT] = {
-    DISPLAY_BLUE,    DISPLAY_RED,    DISPLAY_GREEN,   DISPLAY_CYAN,
-    DISPLAY_MAGENTA, DISPLAY_YELLOW, DISPLAY_WHITE,   DISPLAY_BLUE,
-    DISPLAY_RED,     DISPLAY_GREEN,  DISPLAY_BLUE,    DISPLAY_RED,
-    DISPLAY_GREEN,   DISPLAY_CYAN,   DISPLAY_MAGENTA, DISPLAY_YELLOW,
-    DISPLAY_WHITE,   DISPLAY_BLUE,   DISPLAY_RED,     DISPLAY_GREEN,
-    DISPLAY_BLUE,    DISPLAY_RED,    DISPLAY_GREEN,   DISPLAY_CYAN,
-    DISPLAY_MAGENTA};
-static uint16_t histogram_barColors[HISTOGRAM_MAX_BAR_COUNT];
-// Default colors for the white dynamic labels.
+// These are the default colors for the bars. Bar i gets color
+// i % HISTOGRAM_DEFAULT_BAR_COLOR_COUNT.
+#define HISTOGRAM_DEFAULT_BAR_COLOR_COUNT 10
 const static uint16_t
-    histogram_defaultBarTopLabelColors[HISTOGRAM_MAX_BAR_COUNT] = {
-        DISPLAY_WHITE, DISPLAY_WHITE, DISPLAY_WHITE, DISPLAY_WHITE,
-        DISPLAY_WHITE, DISPLAY_WHITE, DISPLAY_WHITE, DISPLAY_WHITE,
-        DISPLAY_WHITE, DISPLAY_WHITE, DISPLAY_WHITE, DISPLAY_WHITE,
-        DISPLAY_WHITE, DISPLAY_WHITE, DISPLAY_WHITE, DISPLAY_WHITE,
-        DISPLAY_WHITE, DISPLAY_WHITE, DISPLAY_WHITE, DISPLAY_WHITE,
-        DISPLAY_WHITE, DISPLAY_WHITE, DISPLAY_WHITE, DISPLAY_WHITE,
-        DISPLAY_WHITE};
+    histogram_defaultBarColors[HISTOGRAM_DEFAULT_BAR_COLOR_COUNT] = {
+        DISPLAY_BLUE,    DISPLAY_RED,    DISPLAY_GREEN, DISPLAY_CYAN,
+        DISPLAY_MAGENTA, DISPLAY_YELLOW, DISPLAY_WHITE, DISPLAY_BLUE,
+        DISPLAY_RED,     DISPLAY_GREEN};
+static uint16_t histogram_barColors[HISTOGRAM_MAX_BAR_COUNT];
+// Default color for the white dynamic labels.
+#define HISTOGRAM_DEFAULT_BAR_TOP_LABEL_COLOR DISPLAY_WHITE
 static uint16_t histogram_barTopLabelColors[HISTOGRAM_MAX_BAR_COUNT];
-// Default labels for the histogram bars.
+// Default labels for the histogram bars, one character per bar.
 // These labels do not change during operation.
-const static char histogram_defaultLabel[HISTOGRAM_MAX_BAR_COUNT]
-                                        [HISTOGRAM_MAX_BAR_LABEL_WIDTH] = {
-                                            {"0"}, {"1"}, {"2"}, {"3"}, {"4"},
-                                            {"5"}, {"6"}, {"7"}, {"8"}, {"9"},
-                                            {"A"}, {"B"}, {"C"}, {"D"}, {"E"},
-                                            {"F"}, {"G"}, {"H"}, {"I"}, {"J"},
-                                            {"K"}, {"L"}, {"M"}, {"N"}, {"O"}};
+const static char histogram_defaultLabels[HISTOGRAM_MAX_BAR_COUNT + 1] =
+    "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijkl";
 static char histogram_label[HISTOGRAM_MAX_BAR_COUNT]
                            [HISTOGRAM_MAX_BAR_LABEL_WIDTH];
 
@@ -79,14 +66,13 @@ static char histogram_label[HISTOGRAM_MAX_BAR_COUNT]
 void histogram_drawBottomLabels() {
   uint16_t labelOffset =
       ONE_HALF(histogram_barWidth -
-               (DISPLAY_CHAR_WIDTH *
-                HISTOGRAM_BOTTOM_LABEL_TEXT_SIZE));      // Center the label.
-  display_setTextSize(HISTOGRAM_BOTTOM_LABEL_TEXT_SIZE); // Set the text-size.
-  for (int i = 0; i < histogram_barCount; i++) {         //
-    display_setCursor(
-        i * (histogram_barWidth + HISTOGRAM_BAR_X_GAP) + labelOffset,
-        display_height() -
-            (DISPLAY_CHAR_HEIGHT * HISTOGRAM_BOTTOM_LABEL_TEXT_SIZE));
+               (DISPLAY_CHAR_WIDTH * bottomLabelTextSize)); // Center the label.
+  display_setTextSize(bottomLabelTextSize); // Set the text-size.
+  for (int i = 0; i < histogram_barCount; i++) { //
+    display_setCursor(i * (histogram_barWidth + HISTOGRAM_BAR_X_GAP) +
+                          labelOffset,
+                      display_height() -
+                          (DISPLAY_CHAR_HEIGHT * bottomLabelTextSize));
     display_setTextColor(histogram_barColors[i]);
     display_print(histogram_label[i]);
   }
@@ -103,6 +89,10 @@ void histogram_init(uint16_t barCount) {
   display_init(); // Init the display package.
   histogram_barWidth =
       (display_width() / histogram_barCount) - HISTOGRAM_BAR_X_GAP;
+  // Use smaller bottom labels if the large ones are wider than the bars.
+  bottomLabelTextSize = HISTOGRAM_BOTTOM_LABEL_TEXT_SIZE;
+  if (histogram_barWidth < DISPLAY_CHAR_WIDTH * bottomLabelTextSize)
+    bottomLabelTextSize = 1;
   topLabelMaxWidthInChars =
       (histogram_barWidth /
        DISPLAY_CHAR_WIDTH); // The top-label can be this wide.
@@ -121,10 +111,11 @@ void histogram_init(uint16_t barCount) {
     oldTopLabel[i][0] = 0; // Start out with empty strings.
   }
   for (int i = 0; i < HISTOGRAM_MAX_BAR_COUNT; i++) {
-    strncpy(histogram_label[i], histogram_defaultLabel[i],
-            HISTOGRAM_MAX_BAR_LABEL_WIDTH);
-    histogram_barColors[i] = histogram_defaultBarColors[i];
-    histogram_barTopLabelColors[i] = histogram_defaultBarTopLabelColors[i];
+    histogram_label[i][0] = histogram_defaultLabels[i];
+    histogram_label[i][1] = 0;
+    histogram_barColors[i] =
+        histogram_defaultBarColors[i % HISTOGRAM_DEFAULT_BAR_COLOR_COUNT];
+    histogram_barTopLabelColors[i] = HISTOGRAM_DEFAULT_BAR_TOP_LABEL_COLOR;
   }
   display_fillScreen(DISPLAY_BLACK);
   histogram_drawBottomLabels();
@@ -32,7 +32,7 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #endif
 
 #define HISTOGRAM_BOTTOM_LABEL_TEXT_SIZE                                       \
-  2 // Max text-size for the bottom label.
+  2 // Max text-size for the bottom label. Narrower bars use size 1.
 
 // Allow up to this many chars for the label on top of the histogram bar.
 // Actually printed chars depends upon width of bar.
@@ -42,8 +42,10 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 
 //#define HISTOGRAM_MAX_BAR_COUNT 10		// You can have up to 10 bars on
 // your histogram.
+// Enough bars for the FIR response plot in filterTest.c, which has 11 more bars
+// than there are user frequencies, with 32 user frequencies.
 #define HISTOGRAM_MAX_BAR_COUNT                                                \
-  25 // You can have up to 25 bars on your histogram.
+  48 // You can have up to 48 bars on your histogram.
 ///#define HISTOGRAM_BAR_COUNT 10				// This is the
 /// number of histogram bars that you want.
 //#define HISTOGRAM_BAR_X_GAP 5					// This is the
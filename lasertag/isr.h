@@ -10,15 +10,38 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #ifndef ISR_H_
 #define ISR_H_
 
+#include <stdbool.h>
 #include <stdint.h>
 
+#include "filter.h"
+
+// Number of values the ADC buffer can hold. Must be a power of two.
+#define ISR_ADC_BUFFER_SIZE 32768
+// Values added to the ADC buffer every 10 us, one per sensor (see
+// FILTER_CHANNEL_COUNT in filter.h).
+#define ISR_ADC_CHANNEL_COUNT FILTER_CHANNEL_COUNT
+// The FIR filter needs this many new values for each output, so the detector
+// has nothing to do until a whole block of them is in the ADC buffer.
+#define ISR_ADC_BLOCK_SIZE                                                     \
+  (FILTER_FIR_DECIMATION_FACTOR * ISR_ADC_CHANNEL_COUNT)
+
 typedef uint32_t
     isr_AdcValue_t; // Used to represent ADC values in the ADC buffer.
 
 // isr provides the isr_function() where you will place functions that require
 // accurate timing. A buffer for storing values from the Analog to Digital
-// Converter (ADC) is implemented in isr.c Values are added to this buffer by
-// the code in isr.c. Values are removed from this buffer by code in detector.c
+// Converter (ADC) is implemented in isrAdcBuffer.c Values are added to this
+// buffer by the code in isr.c. Values are removed from this buffer by code in
+// detector.c. The buffer is a lock-free single-producer/single-consumer ring:
+// as long as isr_function() is the only code that adds values and detector()
+// is the only code that removes them, neither side needs to disable interrupts.
+//
+// With more than one channel, every sample period adds a frame of
+// ISR_ADC_CHANNEL_COUNT values, channel 0 first, so the values of each channel
+// are interleaved in the ADC buffer and a block holds whole frames. The second
+// sensor goes on AUX 6 (XADC_AUX_CHANNEL_6 in armInterrupts.h), which the XADC
+// pairs with AUX 14 in simultaneous sampling mode, so a frame's values are
+// taken at the same instant. detectorFusion.h filters the frames.
 
 // Performs inits for anything in isr.c
 void isr_init();
@@ -26,13 +49,70 @@ void isr_init();
 // This function is invoked by the timer interrupt at 100 kHz.
 void isr_function();
 
-// This adds data to the ADC buffer.
+// Resets the ADC buffer to empty. Call from isr_init(), before interrupts are
+// enabled.
+void isr_initAdcBuffer();
+
+// This adds data to the ADC buffer. If the buffer is full, the value is
+// dropped and counted in isr_adcBufferOverrunCount(). With more than one
+// channel, call it once per channel of each frame, channel 0 first: a frame
+// that does not fit is dropped whole, so the channels stay in their places.
 void isr_addDataToAdcBuffer(isr_AdcValue_t value);
 
-// This removes a value from the ADC buffer.
+// Adds a frame of ISR_ADC_CHANNEL_COUNT values, channel 0 first, or drops and
+// counts all of them if they do not fit.
+void isr_addFrameToAdcBuffer(const isr_AdcValue_t frame[]);
+
+// Adds count values, whole frames, to the ADC buffer, oldest first, as if each
+// frame had been added with isr_addFrameToAdcBuffer(): the frames that do not
+// fit, and the values of a partial frame at the end, are dropped and counted in
+// isr_adcBufferOverrunCount(), and every block completed is signaled in
+// isr_adcBufferBlockCount(). The values are published together. Call between
+// frames.
+void isr_addBlockToAdcBuffer(const isr_AdcValue_t values[], uint32_t count);
+
+// This removes a value from the ADC buffer. Returns 0 if the buffer is empty.
 isr_AdcValue_t isr_removeDataFromAdcBuffer();
 
+// Removes up to max values from the ADC buffer into buf[], oldest first.
+// Returns the number of values removed.
+uint32_t isr_removeDataFromAdcBufferBatch(isr_AdcValue_t buf[], uint32_t max);
+
 // This returns the number of values in the ADC buffer.
 uint32_t isr_adcBufferElementCount();
 
+// Returns the number of values dropped because the ADC buffer was full.
+uint32_t isr_adcBufferOverrunCount();
+
+// Returns the number of values added to the ADC buffer since
+// isr_initAdcBuffer(), not counting dropped values. Wraps around.
+uint32_t isr_adcBufferAddedCount();
+
+// Returns the number of values removed from the ADC buffer since
+// isr_initAdcBuffer(). Wraps around.
+uint32_t isr_adcBufferRemovedCount();
+
+// Returns the number of complete blocks of ISR_ADC_BLOCK_SIZE values added to
+// the ADC buffer since isr_initAdcBuffer(). Wraps around. This is the signal
+// from isr_function() to the main loop that there is work for the detector:
+// block k (counting from 1) is complete once isr_adcBufferAddedCount() reaches
+// k * ISR_ADC_BLOCK_SIZE (see detectorScheduler.h).
+uint32_t isr_adcBufferBlockCount();
+
+#ifdef ADC_CAPTURE
+// Records every value added from now on into buffer[], up to size values
+// rounded down to whole frames, instead of adding them to the ADC buffer, so
+// that nothing is lost to a slow consumer. The values are stored as added, one
+// frame after another. Call after isr_init() and before interrupts are enabled.
+// isr_initAdcBuffer() ends the capture.
+void isr_startAdcCapture(int16_t buffer[], uint32_t size);
+
+// Returns the number of values recorded since isr_startAdcCapture().
+uint32_t isr_adcCaptureCount();
+#endif
+
+// Tests the ADC buffer from a single thread. Returns true if the test passes.
+// Call before interrupts are enabled.
+bool isr_runAdcBufferTest();
+
 #endif /* ISR_H_ */
@@ -0,0 +1,456 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Lock-free single-producer/single-consumer ADC buffer. isr_function() is the
+// only producer and detector() is the only consumer, so each index is written
+// by exactly one side:
+// - writeCount is only written by the isr_add...ToAdcBuffer() functions,
+// - readCount is only written by the isr_removeDataFromAdcBuffer...()
+// functions.
+// Both are free-running counters; their difference is the element count. A
+// release store of a counter publishes the buffer contents written before it,
+// and the other side reads the counter with an acquire load before touching
+// the buffer. Neither side ever has to disable interrupts.
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "detectorProfile.h"
+#include "isr.h"
+
+#define ADC_BUFFER_INDEX_MASK (ISR_ADC_BUFFER_SIZE - 1)
+
+#if (ISR_ADC_BUFFER_SIZE & ADC_BUFFER_INDEX_MASK) != 0
+#error "ISR_ADC_BUFFER_SIZE must be a power of two."
+#endif
+
+static isr_AdcValue_t adcBuffer[ISR_ADC_BUFFER_SIZE];
+static _Atomic uint32_t writeCount; // Total values added.
+static _Atomic uint32_t readCount;  // Total values removed.
+// Values dropped because the buffer was full. Only written by the producer.
+static volatile uint32_t overrunCount;
+// Complete blocks of ISR_ADC_BLOCK_SIZE values added, and the values added to
+// the current block. Only written by the producer.
+static _Atomic uint32_t blockCount;
+static uint32_t blockFill;
+// Values of the current frame given to isr_addDataToAdcBuffer(), and whether
+// the frame is being dropped. Only written by the producer.
+static uint32_t frameFill;
+static bool frameDropped;
+#ifdef ADC_CAPTURE
+// Buffer of the capture started by isr_startAdcCapture(), if any, its size in
+// values, and the values captured so far.
+static int16_t *captureBuffer;
+static uint32_t captureSize;
+static _Atomic uint32_t captureCount;
+#endif
+
+// Resets the ADC buffer to empty. Call from isr_init(), before interrupts are
+// enabled.
+void isr_initAdcBuffer() {
+  atomic_store(&writeCount, 0);
+  atomic_store(&readCount, 0);
+  overrunCount = 0;
+  atomic_store(&blockCount, 0);
+  blockFill = 0;
+  frameFill = 0;
+  frameDropped = false;
+#ifdef ADC_CAPTURE
+  captureBuffer = NULL;
+  captureSize = 0;
+  atomic_store(&captureCount, 0);
+#endif
+}
+
+#ifdef ADC_CAPTURE
+// Sends values to the capture buffer instead of the ADC buffer. Once the
+// capture is full, the values are dropped. Returns false if no capture is
+// running.
+static bool isr_captureValues(const isr_AdcValue_t values[], uint32_t count) {
+  if (!captureBuffer)
+    return false;
+  uint32_t captured = atomic_load_explicit(&captureCount, memory_order_relaxed);
+  if (count > captureSize - captured)
+    count = captureSize - captured;
+  for (uint32_t i = 0; i < count; i++)
+    captureBuffer[captured + i] = (int16_t)values[i];
+  // Publish the values.
+  atomic_store_explicit(&captureCount, captured + count, memory_order_release);
+  return true;
+}
+
+// Records every value added from now on into buffer[], up to size values
+// rounded down to whole frames, instead of adding them to the ADC buffer. Call
+// after isr_init() and before interrupts are enabled, so that the capture
+// starts with channel 0. isr_initAdcBuffer() ends the capture.
+void isr_startAdcCapture(int16_t buffer[], uint32_t size) {
+  captureSize = size - size % ISR_ADC_CHANNEL_COUNT;
+  atomic_store(&captureCount, 0);
+  captureBuffer = buffer;
+}
+
+// Returns the number of values recorded since isr_startAdcCapture().
+uint32_t isr_adcCaptureCount() {
+  return atomic_load_explicit(&captureCount, memory_order_acquire);
+}
+#endif
+
+// This adds data to the ADC buffer. If the buffer is full the value is
+// dropped and counted (see isr_adcBufferOverrunCount()); the producer never
+// moves readCount. The first value of a frame decides for the whole frame, and
+// only the producer adds, so the rest of a frame that fits always does.
+void isr_addDataToAdcBuffer(isr_AdcValue_t value) {
+#ifdef ADC_CAPTURE
+  if (isr_captureValues(&value, 1))
+    return;
+#endif
+  uint32_t write = atomic_load_explicit(&writeCount, memory_order_relaxed);
+  if (frameFill == 0) {
+    uint32_t read = atomic_load_explicit(&readCount, memory_order_acquire);
+    frameDropped = ISR_ADC_BUFFER_SIZE - (write - read) < ISR_ADC_CHANNEL_COUNT;
+  }
+  if (++frameFill == ISR_ADC_CHANNEL_COUNT)
+    frameFill = 0;
+  if (frameDropped) {
+    overrunCount++;
+    return;
+  }
+  adcBuffer[write & ADC_BUFFER_INDEX_MASK] = value;
+  // Publish the value.
+  atomic_store_explicit(&writeCount, write + 1, memory_order_release);
+  // Signal the consumer once a block is complete.
+  if (++blockFill == ISR_ADC_BLOCK_SIZE) {
+    blockFill = 0;
+    atomic_store_explicit(
+        &blockCount,
+        atomic_load_explicit(&blockCount, memory_order_relaxed) + 1,
+        memory_order_release);
+  }
+}
+
+// Adds a frame of ISR_ADC_CHANNEL_COUNT values, or drops all of them.
+void isr_addFrameToAdcBuffer(const isr_AdcValue_t frame[]) {
+  isr_addBlockToAdcBuffer(frame, ISR_ADC_CHANNEL_COUNT);
+}
+
+// Adds count values to the ADC buffer. The frames that do not fit are dropped
+// and counted, like isr_addDataToAdcBuffer() does one frame at a time, and so
+// is a partial frame at the end.
+void isr_addBlockToAdcBuffer(const isr_AdcValue_t values[], uint32_t count) {
+#ifdef ADC_CAPTURE
+  if (isr_captureValues(values, count - count % ISR_ADC_CHANNEL_COUNT))
+    return;
+#endif
+  uint32_t write = atomic_load_explicit(&writeCount, memory_order_relaxed);
+  uint32_t read = atomic_load_explicit(&readCount, memory_order_acquire);
+  uint32_t space = ISR_ADC_BUFFER_SIZE - (write - read);
+  space -= space % ISR_ADC_CHANNEL_COUNT; // Whole frames only.
+  uint32_t fitting = count - count % ISR_ADC_CHANNEL_COUNT;
+  if (fitting > space)
+    fitting = space;
+  overrunCount += count - fitting;
+  count = fitting;
+  // Copy in at most two pieces, as isr_removeDataFromAdcBufferBatch() does.
+  uint32_t start = write & ADC_BUFFER_INDEX_MASK;
+  uint32_t firstCount = ISR_ADC_BUFFER_SIZE - start;
+  if (firstCount > count)
+    firstCount = count;
+  memcpy(&adcBuffer[start], values, firstCount * sizeof(isr_AdcValue_t));
+  memcpy(adcBuffer, &values[firstCount],
+         (count - firstCount) * sizeof(isr_AdcValue_t));
+  // Publish the values, then signal the blocks they complete.
+  atomic_store_explicit(&writeCount, write + count, memory_order_release);
+  blockFill += count;
+  if (blockFill >= ISR_ADC_BLOCK_SIZE) {
+    atomic_store_explicit(
+        &blockCount,
+        atomic_load_explicit(&blockCount, memory_order_relaxed) +
+            blockFill / ISR_ADC_BLOCK_SIZE,
+        memory_order_release);
+    blockFill %= ISR_ADC_BLOCK_SIZE;
+  }
+}
+
+// This removes a value from the ADC buffer. Returns 0 if the buffer is empty.
+isr_AdcValue_t isr_removeDataFromAdcBuffer() {
+  isr_AdcValue_t value = 0;
+  isr_removeDataFromAdcBufferBatch(&value, 1);
+  return value;
+}
+
+// Removes up to max values from the ADC buffer into buf[], oldest first.
+// Returns the number of values removed.
+uint32_t isr_removeDataFromAdcBufferBatch(isr_AdcValue_t buf[], uint32_t max) {
+  DETECTOR_PROFILE_START(profile);
+  uint32_t read = atomic_load_explicit(&readCount, memory_order_relaxed);
+  uint32_t write = atomic_load_explicit(&writeCount, memory_order_acquire);
+  uint32_t count = write - read;
+  if (count > max)
+    count = max;
+  // Copy in at most two pieces: up to the end of the buffer, then from the
+  // start.
+  uint32_t start = read & ADC_BUFFER_INDEX_MASK;
+  uint32_t firstCount = ISR_ADC_BUFFER_SIZE - start;
+  if (firstCount > count)
+    firstCount = count;
+  memcpy(buf, &adcBuffer[start], firstCount * sizeof(isr_AdcValue_t));
+  memcpy(&buf[firstCount], adcBuffer,
+         (count - firstCount) * sizeof(isr_AdcValue_t));
+  // Hand the slots back to the producer.
+  atomic_store_explicit(&readCount, read + count, memory_order_release);
+  DETECTOR_PROFILE_STOP(profile, DETECTOR_PROFILE_ADC_POP);
+  return count;
+}
+
+// This returns the number of values in the ADC buffer.
+uint32_t isr_adcBufferElementCount() {
+  return atomic_load_explicit(&writeCount, memory_order_acquire) -
+         atomic_load_explicit(&readCount, memory_order_acquire);
+}
+
+// Returns the number of values dropped because the ADC buffer was full.
+uint32_t isr_adcBufferOverrunCount() { return overrunCount; }
+
+// Returns the number of values added to the ADC buffer since
+// isr_initAdcBuffer(), not counting dropped values. Wraps around.
+uint32_t isr_adcBufferAddedCount() {
+  return atomic_load_explicit(&writeCount, memory_order_acquire);
+}
+
+// Returns the number of values removed from the ADC buffer since
+// isr_initAdcBuffer(). Wraps around.
+uint32_t isr_adcBufferRemovedCount() {
+  return atomic_load_explicit(&readCount, memory_order_acquire);
+}
+
+// Returns the number of complete blocks of ISR_ADC_BLOCK_SIZE values added to
+// the ADC buffer since isr_initAdcBuffer(). Wraps around.
+uint32_t isr_adcBufferBlockCount() {
+  return atomic_load_explicit(&blockCount, memory_order_acquire);
+}
+
+#define TEST_BATCH_SIZE 100 // Values removed per batch.
+#define TEST_PASS_COUNT 3   // Fill and drain the buffer this many times.
+
+#if ISR_ADC_CHANNEL_COUNT > 1
+// Adds frame number frame with isr_addDataToAdcBuffer() or, if whole,
+// isr_addFrameToAdcBuffer(). Value c of frame f is f * ISR_ADC_CHANNEL_COUNT +
+// c, so its channel is its value modulo ISR_ADC_CHANNEL_COUNT.
+static void isr_testAddFrame(uint32_t frame, bool whole) {
+  isr_AdcValue_t values[ISR_ADC_CHANNEL_COUNT];
+  for (uint32_t c = 0; c < ISR_ADC_CHANNEL_COUNT; c++)
+    values[c] = frame * ISR_ADC_CHANNEL_COUNT + c;
+  if (whole) {
+    isr_addFrameToAdcBuffer(values);
+    return;
+  }
+  for (uint32_t c = 0; c < ISR_ADC_CHANNEL_COUNT; c++)
+    isr_addDataToAdcBuffer(values[c]);
+}
+
+// Adds frameCount frames from frame number frame with
+// isr_addBlockToAdcBuffer(), plus extraCount values of the next frame.
+static void isr_testAddFrames(uint32_t frame, uint32_t frameCount,
+                              uint32_t extraCount) {
+  static isr_AdcValue_t values[4 * ISR_ADC_CHANNEL_COUNT];
+  uint32_t count = frameCount * ISR_ADC_CHANNEL_COUNT + extraCount;
+  for (uint32_t i = 0; i < count; i++)
+    values[i] = frame * ISR_ADC_CHANNEL_COUNT + i;
+  isr_addBlockToAdcBuffer(values, count);
+}
+
+// Overruns the buffer with every way of adding values, with room for less than
+// a frame and for a number of values that is not a whole number of frames, then
+// checks that every value removed is still in its channel's place and that the
+// frames that did not fit were dropped whole.
+static bool isr_runAdcFrameTest() {
+  bool success = true; // Be optimistic.
+  uint32_t frame = 0;  // The next frame to add.
+  isr_initAdcBuffer();
+  while (isr_adcBufferElementCount() + ISR_ADC_CHANNEL_COUNT <=
+         ISR_ADC_BUFFER_SIZE)
+    isr_testAddFrame(frame++, false);
+  // Leave room for all but one value of a frame.
+  isr_AdcValue_t batch[TEST_BATCH_SIZE];
+  isr_removeDataFromAdcBufferBatch(batch, ISR_ADC_CHANNEL_COUNT - 1 -
+                                              ISR_ADC_BUFFER_SIZE %
+                                                  ISR_ADC_CHANNEL_COUNT);
+  isr_testAddFrame(frame++, false); // Dropped, value by value.
+  isr_testAddFrame(frame++, true);  // Dropped.
+  isr_testAddFrames(frame, 2, 0);   // Both dropped.
+  frame += 2;
+  // Room for two frames and all but one value of a third.
+  isr_removeDataFromAdcBufferBatch(batch, 2 * ISR_ADC_CHANNEL_COUNT);
+  isr_testAddFrames(frame, 3, 0); // The third is dropped.
+  frame += 3;
+  // Room for three frames and all but one value of a fourth.
+  isr_removeDataFromAdcBufferBatch(batch, 3 * ISR_ADC_CHANNEL_COUNT);
+  isr_testAddFrames(frame, 2, 1); // The partial third frame is dropped.
+  frame += 3;
+  isr_testAddFrame(frame++, false);
+  uint32_t dropped = 5 * ISR_ADC_CHANNEL_COUNT + 1;
+  if (isr_adcBufferOverrunCount() != dropped) {
+    printf("isr_runAdcFrameTest: overrun count is %lu, should be %lu.\n",
+           (unsigned long)isr_adcBufferOverrunCount(), (unsigned long)dropped);
+    success = false;
+  }
+  // The values removed were in their places, so check from the next one.
+  uint32_t position = isr_adcBufferRemovedCount();
+  isr_AdcValue_t previous = 0;
+  bool first = true;
+  uint32_t count;
+  while (success &&
+         (count = isr_removeDataFromAdcBufferBatch(batch, TEST_BATCH_SIZE)) >
+             0) {
+    for (uint32_t i = 0; i < count; i++, position++) {
+      if (batch[i] % ISR_ADC_CHANNEL_COUNT !=
+              position % ISR_ADC_CHANNEL_COUNT ||
+          (!first && batch[i] <= previous)) {
+        printf("isr_runAdcFrameTest: value %lu, of channel %lu, is in the "
+               "place of channel %lu.\n",
+               (unsigned long)batch[i],
+               (unsigned long)(batch[i] % ISR_ADC_CHANNEL_COUNT),
+               (unsigned long)(position % ISR_ADC_CHANNEL_COUNT));
+        success = false;
+        break;
+      }
+      previous = batch[i];
+      first = false;
+    }
+  }
+  // The last frame, after the overruns, came out last and whole.
+  if (success && previous != frame * ISR_ADC_CHANNEL_COUNT - 1) {
+    printf("isr_runAdcFrameTest: the last value is %lu, should be %lu.\n",
+           (unsigned long)previous,
+           (unsigned long)(frame * ISR_ADC_CHANNEL_COUNT - 1));
+    success = false;
+  }
+  isr_initAdcBuffer();
+  printf("isr_runAdcFrameTest %s.\n", success ? "passed" : "failed");
+  return success;
+}
+#endif
+
+#ifdef ADC_CAPTURE
+#define TEST_CAPTURE_FRAME_COUNT 100 // Frames that fit in the test capture.
+
+// Adds more frames than the capture holds, value by value and in blocks, with a
+// partial frame at the end of a block, then checks that the capture holds the
+// first whole frames in order, that the ADC buffer got nothing, and that
+// isr_initAdcBuffer() ends the capture.
+static bool isr_runAdcCaptureTest() {
+  bool success = true; // Be optimistic.
+  // Room for all but one value of another frame, too.
+  static int16_t capture[(TEST_CAPTURE_FRAME_COUNT + 1) * ISR_ADC_CHANNEL_COUNT -
+                         1];
+  static isr_AdcValue_t values[3 * ISR_ADC_CHANNEL_COUNT + 1];
+  isr_AdcValue_t next = 0; // Next value to add.
+  isr_initAdcBuffer();
+  isr_startAdcCapture(capture, sizeof(capture) / sizeof(capture[0]));
+  while (next < 2 * TEST_CAPTURE_FRAME_COUNT * ISR_ADC_CHANNEL_COUNT) {
+    for (uint32_t c = 0; c < ISR_ADC_CHANNEL_COUNT; c++)
+      isr_addDataToAdcBuffer(next++);
+    // Three frames and a value, which is dropped with more than one channel.
+    uint32_t count = 3 * ISR_ADC_CHANNEL_COUNT + 1;
+    for (uint32_t i = 0; i < count; i++)
+      values[i] = next + i;
+    isr_addBlockToAdcBuffer(values, count);
+    next += count - count % ISR_ADC_CHANNEL_COUNT;
+  }
+  uint32_t count = isr_adcCaptureCount();
+  if (count != TEST_CAPTURE_FRAME_COUNT * ISR_ADC_CHANNEL_COUNT) {
+    printf("isr_runAdcCaptureTest: %lu values captured, should be %lu.\n",
+           (unsigned long)count,
+           (unsigned long)(TEST_CAPTURE_FRAME_COUNT * ISR_ADC_CHANNEL_COUNT));
+    success = false;
+  }
+  for (uint32_t i = 0; i < count && success; i++) {
+    if (capture[i] != (int16_t)i) {
+      printf("isr_runAdcCaptureTest: captured %d, should be %lu.\n",
+             capture[i], (unsigned long)i);
+      success = false;
+    }
+  }
+  if (isr_adcBufferElementCount() != 0) {
+    printf("isr_runAdcCaptureTest: values added to the ADC buffer.\n");
+    success = false;
+  }
+  isr_initAdcBuffer();
+  isr_addDataToAdcBuffer(next);
+  if (isr_adcCaptureCount() != 0 || isr_adcBufferElementCount() != 1) {
+    printf("isr_runAdcCaptureTest: the capture did not end.\n");
+    success = false;
+  }
+  isr_initAdcBuffer();
+  printf("isr_runAdcCaptureTest %s.\n", success ? "passed" : "failed");
+  return success;
+}
+#endif
+
+// Checks the ADC buffer from a single thread: fill it (including overrun),
+// then drain it with a mix of batch and single removes so that the indices wrap
+// several times. Values are checked for order and count. With more than one
+// channel, also runs isr_runAdcFrameTest(), and with ADC_CAPTURE,
+// isr_runAdcCaptureTest(). Returns true if the test passes.
+// Call before interrupts are enabled.
+bool isr_runAdcBufferTest() {
+  bool success = true; // Be optimistic.
+  isr_AdcValue_t batch[TEST_BATCH_SIZE];
+  isr_AdcValue_t expected = 0; // Next value that should be removed.
+  isr_AdcValue_t next = 0;     // Next value to add.
+  isr_initAdcBuffer();
+  // Start at an offset so that the batches straddle the end of the buffer.
+  for (uint32_t i = 0; i < TEST_BATCH_SIZE / 2; i++)
+    isr_addDataToAdcBuffer(next++);
+  expected += isr_removeDataFromAdcBufferBatch(batch, TEST_BATCH_SIZE);
+  for (uint32_t pass = 0; pass < TEST_PASS_COUNT && success; pass++) {
+    while (isr_adcBufferElementCount() < ISR_ADC_BUFFER_SIZE)
+      isr_addDataToAdcBuffer(next++);
+    for (uint32_t c = 0; c < ISR_ADC_CHANNEL_COUNT; c++)
+      isr_addDataToAdcBuffer(next); // A frame that should be dropped.
+    if (isr_adcBufferOverrunCount() != (pass + 1) * ISR_ADC_CHANNEL_COUNT) {
+      printf("isr_runAdcBufferTest: overrun count is %lu, should be %lu.\n",
+             (unsigned long)isr_adcBufferOverrunCount(),
+             (unsigned long)((pass + 1) * ISR_ADC_CHANNEL_COUNT));
+      success = false;
+    }
+    bool single = false; // Alternate between batch and single removes.
+    while (isr_adcBufferElementCount() > 0 && success) {
+      uint32_t count = single ? 1 : TEST_BATCH_SIZE;
+      if (single)
+        batch[0] = isr_removeDataFromAdcBuffer();
+      else
+        count = isr_removeDataFromAdcBufferBatch(batch, count);
+      for (uint32_t i = 0; i < count; i++) {
+        if (batch[i] != expected) {
+          printf("isr_runAdcBufferTest: removed %lu, should be %lu.\n",
+                 (unsigned long)batch[i], (unsigned long)expected);
+          success = false;
+          break;
+        }
+        expected++;
+      }
+      single = !single;
+    }
+  }
+  if (isr_removeDataFromAdcBufferBatch(batch, TEST_BATCH_SIZE) != 0) {
+    printf("isr_runAdcBufferTest: values removed from an empty buffer.\n");
+    success = false;
+  }
+  isr_initAdcBuffer();
+#if ISR_ADC_CHANNEL_COUNT > 1
+  success = isr_runAdcFrameTest() && success;
+#endif
+#ifdef ADC_CAPTURE
+  success = isr_runAdcCaptureTest() && success;
+#endif
+  printf("isr_runAdcBufferTest %s.\n", success ? "passed" : "failed");
+  return success;
+}
@@ -92,6 +92,13 @@ void queue_overwritePush(queue_t *q, queue_data_t value);
 // meaningful error message if an error condition is detected.
 queue_data_t queue_readElementAt(queue_t *q, queue_index_t index);
 
+// Returns a pointer to the newest n elements of the queue, oldest first, so
+// that they can be read as a flat array. The pointer is valid until the next
+// push or pop. Prints an error message and returns NULL if the queue contains
+// fewer than n elements. Only provided by the mirrored queue (queueMirrored.c,
+// compile using cmake -DQUEUE_MIRRORED=1).
+const queue_data_t *queue_contiguousWindow(queue_t *q, queue_size_t n);
+
 // Returns a count of the elements currently contained in the queue.
 queue_size_t queue_elementCount(queue_t *q);
 
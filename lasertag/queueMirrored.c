@@ -0,0 +1,158 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Mirrored implementation of queue.h. Only compiled when QUEUE_MIRRORED is
+// defined, in which case it is used in place of libqueue.
+//
+// The data array holds two copies of the ring: every push writes data[i] and
+// data[i + size]. Any run of up to size - 1 consecutive elements, including
+// the newest n, can then be read from one copy or the other without wrapping,
+// so queue_contiguousWindow() can hand out a plain pointer and
+// queue_readElementAt() needs no modulo.
+#ifdef QUEUE_MIRRORED
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "queue.h"
+
+// Advances a ring index by one, wrapping at size.
+static inline queue_index_t queue_nextIndex(queue_t *q, queue_index_t index) {
+  return (index + 1 == q->size) ? 0 : index + 1;
+}
+
+// Allocates memory for the queue (the data* pointer) and initializes all
+// parts of the data structure. Prints out an error message if malloc() fails
+// and calls assert(false) to print-out line-number information and die.
+void queue_init(queue_t *q, queue_size_t size, const char *name) {
+  // Keep the documented layout: the ring has one more slot than the capacity.
+  q->size = size + 1;
+  q->data = (queue_data_t *)malloc(2 * q->size * sizeof(queue_data_t));
+  if (q->data == NULL) {
+    printf("queue_init(%s): malloc() failed.\n", name);
+    assert(false);
+  }
+  q->indexIn = 0;
+  q->indexOut = 0;
+  q->elementCount = 0;
+  q->underflowFlag = false;
+  q->overflowFlag = false;
+  strncpy(q->name, name, QUEUE_MAX_NAME_SIZE - 1);
+  q->name[QUEUE_MAX_NAME_SIZE - 1] = '\0';
+}
+
+// Get the user-assigned name for the queue.
+const char *queue_name(queue_t *q) { return q->name; }
+
+// Returns the capacity of the queue.
+queue_size_t queue_size(queue_t *q) { return q->size - 1; }
+
+// Returns true if the queue is full.
+bool queue_full(queue_t *q) { return q->elementCount == q->size - 1; }
+
+// Returns true if the queue is empty.
+bool queue_empty(queue_t *q) { return q->elementCount == 0; }
+
+// If the queue is not full, pushes a new element into the queue and clears the
+// underflowFlag. IF the queue is full, set the overflowFlag, print an error
+// message and DO NOT change the queue.
+void queue_push(queue_t *q, queue_data_t value) {
+  if (queue_full(q)) {
+    printf("queue_push(%s): queue overflow.\n", q->name);
+    q->overflowFlag = true;
+    return;
+  }
+  q->data[q->indexIn] = q->data[q->indexIn + q->size] = value;
+  q->indexIn = queue_nextIndex(q, q->indexIn);
+  q->elementCount++;
+  q->underflowFlag = false;
+}
+
+// If the queue is not empty, remove and return the oldest element in the queue.
+// If the queue is empty, set the underflowFlag, print an error message, and DO
+// NOT change the queue.
+queue_data_t queue_pop(queue_t *q) {
+  if (queue_empty(q)) {
+    printf("queue_pop(%s): queue underflow.\n", q->name);
+    q->underflowFlag = true;
+    return QUEUE_RETURN_ERROR_VALUE;
+  }
+  queue_data_t value = q->data[q->indexOut];
+  q->indexOut = queue_nextIndex(q, q->indexOut);
+  q->elementCount--;
+  q->overflowFlag = false;
+  return value;
+}
+
+// If the queue is full, call queue_pop() and then call queue_push().
+// If the queue is not full, just call queue_push().
+void queue_overwritePush(queue_t *q, queue_data_t value) {
+  if (queue_full(q))
+    queue_pop(q);
+  queue_push(q, value);
+}
+
+// Provides random-access read capability to the queue.
+// Low-valued indexes access older queue elements while higher-value indexes
+// access newer elements (according to the order that they were added). Print a
+// meaningful error message if an error condition is detected.
+queue_data_t queue_readElementAt(queue_t *q, queue_index_t index) {
+  if (index >= q->elementCount) {
+    printf("queue_readElementAt(%s): index %u is out of bounds, queue contains "
+           "%u elements.\n",
+           q->name, index, q->elementCount);
+    return QUEUE_RETURN_ERROR_VALUE;
+  }
+  // indexOut + index < 2 * size, so the mirror copy covers any wrap.
+  return q->data[q->indexOut + index];
+}
+
+// Returns a pointer to the newest n elements, oldest first. The pointer is
+// valid until the next push or pop. Prints an error message and returns NULL
+// if the queue contains fewer than n elements.
+const queue_data_t *queue_contiguousWindow(queue_t *q, queue_size_t n) {
+  if (n > q->elementCount) {
+    printf("queue_contiguousWindow(%s): window of %u elements requested, queue "
+           "contains %u elements.\n",
+           q->name, n, q->elementCount);
+    return NULL;
+  }
+  // The window ends just before indexIn in the mirror copy.
+  return &q->data[q->indexIn + q->size - n];
+}
+
+// Returns a count of the elements currently contained in the queue.
+queue_size_t queue_elementCount(queue_t *q) { return q->elementCount; }
+
+// Returns true if an underflow has occurred (queue_pop() called on an empty
+// queue).
+bool queue_underflow(queue_t *q) { return q->underflowFlag; }
+
+// Returns true if an overflow has occurred (queue_push() called on a full
+// queue).
+bool queue_overflow(queue_t *q) { return q->overflowFlag; }
+
+// Frees the storage that you malloc'd before.
+void queue_garbageCollect(queue_t *q) {
+  free(q->data);
+  q->data = NULL;
+}
+
+// Prints the current contents of the queue. Handy for debugging.
+// This must print out the contents of the queue in the order of oldest element
+// first to newest element last.
+void queue_print(queue_t *q) {
+  printf("queue name: %s\n", q->name);
+  for (queue_index_t i = 0; i < q->elementCount; i++)
+    printf("%le\n", queue_readElementAt(q, i));
+}
+
+#endif /* QUEUE_MIRRORED */
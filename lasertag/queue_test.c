@@ -512,6 +512,41 @@ bool queue_overwritePushTest() {
   return testResult;
 }
 
+#ifdef QUEUE_MIRRORED
+#define CONTIGUOUS_WINDOW_TEST_QUEUE_SIZE 37 // Not a power of two.
+#define CONTIGUOUS_WINDOW_TEST_PUSH_COUNT                                      \
+  200 // Enough pushes to wrap several times.
+#define CONTIGUOUS_WINDOW_TEST_QUEUE_NAME "windowQ"
+// Checks that queue_contiguousWindow() returns the same values as
+// queue_readElementAt() for every window size, as the queue fills and then
+// wraps around.
+bool queue_contiguousWindowTest() {
+  bool testResult = true; // Keep track of overall test results.
+  queue_t testQ;
+  queue_init(&testQ, CONTIGUOUS_WINDOW_TEST_QUEUE_SIZE,
+             CONTIGUOUS_WINDOW_TEST_QUEUE_NAME);
+  for (uint16_t i = 0; i < CONTIGUOUS_WINDOW_TEST_PUSH_COUNT && testResult;
+       i++) {
+    queue_overwritePush(&testQ, (double)rand());
+    queue_size_t count = queue_elementCount(&testQ);
+    for (queue_size_t n = 1; n <= count && testResult; n++) {
+      const queue_data_t *window = queue_contiguousWindow(&testQ, n);
+      for (queue_size_t j = 0; j < n; j++) {
+        if (window[j] != queue_readElementAt(&testQ, count - n + j)) {
+          printf("* Error: queue_contiguousWindow(%s, %u)[%u] does not match "
+                 "queue_readElementAt(%s, %u).\n",
+                 queue_name(&testQ), n, j, queue_name(&testQ), count - n + j);
+          testResult = false;
+          break;
+        }
+      }
+    }
+  }
+  queue_garbageCollect(&testQ);
+  return testResult;
+}
+#endif
+
 #define QUEUE_TEST_MAX_QUEUE_SIZE 100 // Used for the fill/empty tests.
 #define QUEUE_TEST_MAX_LOOP_COUNT                                              \
   10 // All tests will be invoked this many times.
@@ -616,6 +651,20 @@ bool queue_runTest() {
     testResult = tempResult
                      ? testResult
                      : false; // Logical AND of testResult and tempResult.
+#ifdef QUEUE_MIRRORED
+    printf("=== Commencing contiguous-window test. === \n");
+    tempResult = queue_contiguousWindowTest();
+    if (tempResult) {
+      printf("=== Queue: %s passed contiguous-window test.\n",
+             queue_name(&testQ));
+    } else {
+      printf("=== Queue: %s failed contiguous-window test.\n",
+             queue_name(&testQ));
+    }
+    testResult = tempResult
+                     ? testResult
+                     : false; // Logical AND of testResult and tempResult.
+#endif
     if (testResult) {
       printf("=== All queue tests passed. ===\n\n");
     } else {
@@ -14,7 +14,14 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #include <string.h>
 
 #include "buttons.h"
+#ifdef ADC_CAPTURE
+#include "captureFrame.h"
+#endif
 #include "detector.h"
+#include "detectorProfile.h"
+#ifdef DETECTOR_SCHEDULER
+#include "detectorScheduler.h"
+#endif
 #include "display.h"
 #include "filter.h"
 #include "histogram.h"
@@ -30,6 +37,10 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #include "utils.h"
 #include "xparameters.h"
 
+#if defined(ADC_CAPTURE) && defined(ZYBO_BOARD)
+#include "xil_printf.h" // outbyte()
+#endif
+
 // Uncomment this code so that the code in the various modes will
 // ignore your own frequency. You still must properly implement
 // the ability to ignore frequencies in detector.c
@@ -50,8 +61,13 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #define MAIN_CUMULATIVE_TIMER                                                  \
   INTERVAL_TIMER_2 // Used to compute cumulative run-time in main.
 
+#ifdef DETECTOR_SCHEDULER
+#define BLOCKS_PER_HISTOGRAM_UPDATE                                            \
+  3333 // Update the histogram about 3 times per second (10000 blocks/s).
+#else
 #define SYSTEM_TICKS_PER_HISTOGRAM_UPDATE                                      \
   30000 // Update the histogram about 3 times per second.
+#endif
 
 #define RUNNING_MODE_WARNING_TEXT_SIZE 2 // Upsize the text for visibility.
 #define RUNNING_MODE_WARNING_TEXT_COLOR DISPLAY_RED // Red for more visibility.
@@ -60,8 +76,14 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #define RUNNING_MODE_SCREEN_X_ORIGIN 0 // Origin for reporting text.
 #define RUNNING_MODE_SCREEN_Y_ORIGIN 0 // Origin for reporting text.
 
+#ifdef DETECTOR_SCHEDULER
+// A complete block of ADC values should wait no longer than this many samples
+// (50 ms) before the detector processes it.
+#define SUGGESTED_MAX_BLOCK_LATENCY_SAMPLES 5000
+#else
 // Detector should be invoked this often for good performance.
 #define SUGGESTED_DETECTOR_INVOCATIONS_PER_SECOND 30000
+#endif
 // ADC queue should have no more than this number of unprocessed elements for
 // good performance.
 #define SUGGESTED_REMAINING_ELEMENT_COUNT 500
@@ -70,14 +92,27 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #define INTERRUPTS_CURRENTLY_ENABLED true
 #define INTERRUPTS_CURRENTLY_DISABLE false
 
+#ifndef DETECTOR_SCHEDULER
 // Keep track of detector invocations.
 uint32_t detectorInvocationCount = 0;
+#endif
 
 // This array is indexed by frequency number. If array-element[freq_no] == true,
 // the frequency is ignored, e.g., no hit will ever occur at that frequency.
 // static bool ignoredFrequenciesArray[FILTER_FREQUENCY_COUNT] =
 //  {false, false, false, false, false, false, false, false, false, false};
 
+#ifdef DETECTOR_PROFILE
+// Prints the per-stage detector profile (see detectorProfile.h) on the console,
+// leaving the run-time statistics on the TFT.
+static void runningModes_printDetectorProfile() {
+  display_setTextSize(RUNNING_MODE_NORMAL_TEXT_SIZE);
+  display_setTextColor(RUNNING_MODE_NORMAL_TEXT_COLOR);
+  display_println("\nDetector stage profile sent to the console.");
+  detectorProfile_printTable(false);
+}
+#endif
+
 // Prints out various run-time statistics on the TFT display.
 // Assumes the following:
 // detected interrupts is retrieved with interrupts_isrInvocationCount(),
@@ -139,6 +174,40 @@ void runningModes_printRunTimeStatistics() {
   display_print("Total interrupts:            ");
   display_printlnDecimalInt(interruptCount);
   display_printChar('\n');
+#ifdef DETECTOR_SCHEDULER
+  // The detector is only invoked when a block of ADC values is ready (see
+  // detectorScheduler.h).
+  detectorScheduler_stats_t schedulerStats;
+  detectorScheduler_getStats(&schedulerStats);
+  display_print("Detector invocations: ");
+  sprintf(sprintfBuffer, "%lu (%.0f per second)",
+          (unsigned long)schedulerStats.invocationCount,
+          schedulerStats.invocationCount / runningSeconds);
+  display_println(sprintfBuffer);
+  display_print("Blocks processed: ");
+  sprintf(sprintfBuffer, "%lu (%.0f per second)",
+          (unsigned long)schedulerStats.blockCount,
+          schedulerStats.blockCount / runningSeconds);
+  display_println(sprintfBuffer);
+  display_print("Block latency in samples: ");
+  sprintf(sprintfBuffer, "mean %.2f, max %lu",
+          schedulerStats.meanLatencySamples,
+          (unsigned long)schedulerStats.maxLatencySamples);
+  display_println(sprintfBuffer);
+  display_print("Idle (waiting for a block): ");
+  sprintf(sprintfBuffer, "%5.2f%%", schedulerStats.idlePercent);
+  display_println(sprintfBuffer);
+  display_printChar('\n');
+  // If blocks waited too long, inform the user.
+  if (schedulerStats.maxLatencySamples > SUGGESTED_MAX_BLOCK_LATENCY_SAMPLES) {
+    display_setTextColor(RUNNING_MODE_WARNING_TEXT_COLOR);
+    display_setTextSize(RUNNING_MODE_WARNING_TEXT_SIZE);
+    display_print("Blocks should wait less than ");
+    display_printDecimalInt(SUGGESTED_MAX_BLOCK_LATENCY_SAMPLES);
+    display_println(" samples.");
+    display_printChar('\n');
+  }
+#else
   display_print("Detector invocation count: ");
   // Print out detector invocations per second.
   display_printlnDecimalInt(detectorInvocationCount);
@@ -158,6 +227,7 @@ void runningModes_printRunTimeStatistics() {
     display_println(" times per second.");
     display_printChar('\n');
   }
+#endif
   // If the unprocessed element count is too high, inform the user.
   if (remainingElementCount >= SUGGESTED_REMAINING_ELEMENT_COUNT) {
     display_setTextColor(RUNNING_MODE_WARNING_TEXT_COLOR);
@@ -167,6 +237,9 @@ void runningModes_printRunTimeStatistics() {
     display_printDecimalInt(SUGGESTED_REMAINING_ELEMENT_COUNT);
     display_println(" elements.");
   }
+#ifdef DETECTOR_PROFILE
+  runningModes_printDetectorProfile();
+#endif
 }
 
 // Group all of the inits together to reduce visual clutter.
@@ -177,6 +250,12 @@ void runningModes_initAll() {
   filter_init();
   isr_init(); // includes: transmitter, trigger, hitLedTimer, lockoutTimer, &
               // sound init
+#ifdef DETECTOR_SCHEDULER
+  detectorScheduler_init(); // Starts counting blocks from the empty buffer.
+#endif
+#ifdef DETECTOR_PROFILE
+  detectorProfile_init(); // Start the PMU and clear the stage statistics.
+#endif
 }
 
 // Returns the current switch-setting
@@ -213,8 +292,13 @@ void runningModes_continuous() {
   interrupts_enableTimerGlobalInts(); // Allows the timer to generate
                                       // interrupts.
   interrupts_startArmPrivateTimer();  // Start the private ARM timer running.
+#ifdef DETECTOR_SCHEDULER
+  uint16_t histogramBlocks =
+      0; // Only update the histogram display every so many blocks.
+#else
   uint16_t histogramSystemTicks =
       0; // Only update the histogram display every so many ticks.
+#endif
   intervalTimer_reset(
       ISR_CUMULATIVE_TIMER); // Used to measure ISR execution time.
   intervalTimer_reset(
@@ -224,9 +308,37 @@ void runningModes_continuous() {
   intervalTimer_start(
       TOTAL_RUNTIME_TIMER);            // Start measuring total execution time.
   transmitter_setContinuousMode(true); // Run the transmitter continuously.
-  interrupts_enableArmInts();  // The ARM will start seeing interrupts after
-                               // this.
-  transmitter_run();           // Start the transmitter.
+  interrupts_enableArmInts(); // The ARM will start seeing interrupts after
+                              // this.
+  transmitter_run();          // Start the transmitter.
+#ifdef DETECTOR_SCHEDULER
+  while (!(buttons_read() &
+           BUTTONS_BTN3_MASK)) { // Run until you detect btn3 pressed.
+    transmitter_setFrequencyNumber(runningModes_getFrequencySetting());
+    if (detectorScheduler_blockReady()) {
+      // Run filters, compute power, etc.
+      intervalTimer_start(MAIN_CUMULATIVE_TIMER); // Measure run-time when you
+                                                  // are doing something.
+      histogramBlocks += detectorScheduler_runDetector(
+          INTERRUPTS_CURRENTLY_ENABLED); // Interrupts are currently enabled.
+      intervalTimer_stop(MAIN_CUMULATIVE_TIMER);
+    } else {
+      detectorScheduler_sleep(); // Nothing to do until the next interrupt.
+    }
+    // If enough blocks have been processed, update the histogram. The blocks
+    // that arrive meanwhile wait in the ADC buffer.
+    if (histogramBlocks >= BLOCKS_PER_HISTOGRAM_UPDATE) {
+      double powerValues[FILTER_FREQUENCY_COUNT]; // Copy the current power
+                                                  // values to here.
+      filter_getCurrentPowerValues(
+          powerValues); // Copy the current power values.
+      histogram_plotUserFrequencyPower(
+          powerValues); // Plot the power values on the TFT.
+      histogramBlocks =
+          0; // Reset the block count and wait for the next update time.
+    }
+  }
+#else
   detectorInvocationCount = 0; // Keep track of detector invocations.
   while (!(buttons_read() &
            BUTTONS_BTN3_MASK)) { // Run until you detect btn3 pressed.
@@ -251,6 +363,7 @@ void runningModes_continuous() {
           0; // Reset the tick count and wait for the next update time.
     }
   }
+#endif
   interrupts_disableArmInts();           // Stop interrupts.
   runningModes_printRunTimeStatistics(); // Print the run-time statistics.
 }
@@ -272,15 +385,19 @@ void runningModes_shooter() {
 #endif
   detector_init(ignoredFrequencies);
   uint16_t hitCount = 0;
+#ifndef DETECTOR_SCHEDULER
   detectorInvocationCount = 0; // Keep track of detector invocations.
+#endif
   trigger_enable();         // Makes the trigger state machine responsive to the
                             // trigger.
   interrupts_initAll(true); // Inits all interrupts but does not enable them.
   interrupts_enableTimerGlobalInts(); // Allows the timer to generate
                                       // interrupts.
   interrupts_startArmPrivateTimer();  // Start the private ARM timer running.
+#ifndef DETECTOR_SCHEDULER
   uint16_t histogramSystemTicks =
       0; // Only update the histogram display every so many ticks.
+#endif
   intervalTimer_reset(
       ISR_CUMULATIVE_TIMER); // Used to measure ISR execution time.
   intervalTimer_reset(
@@ -296,15 +413,26 @@ void runningModes_shooter() {
   while ((!(buttons_read() & BUTTONS_BTN3_MASK)) &&
          hitCount < MAX_HIT_COUNT) { // Run until you detect btn3 pressed.
     transmitter_setFrequencyNumber(
-        runningModes_getFrequencySetting());    // Read the switches and switch
-                                                // frequency as required.
+        runningModes_getFrequencySetting()); // Read the switches and switch
+                                             // frequency as required.
+#ifdef DETECTOR_SCHEDULER
+    if (!detectorScheduler_blockReady()) {
+      detectorScheduler_sleep(); // Nothing to do until the next interrupt.
+      continue;
+    }
+#endif
     intervalTimer_start(MAIN_CUMULATIVE_TIMER); // Measure run-time when you are
                                                 // doing something.
+    // Run filters, compute power, run hit-detection.
+#ifdef DETECTOR_SCHEDULER
+    detectorScheduler_runDetector(
+        INTERRUPTS_CURRENTLY_ENABLED); // Interrupts are currently enabled.
+#else
     histogramSystemTicks++; // Keep track of ticks so you know when to update
                             // the histogram.
-    // Run filters, compute power, run hit-detection.
     detectorInvocationCount++;              // Used for run-time statistics.
     detector(INTERRUPTS_CURRENTLY_ENABLED); // Interrupts are currently enabled.
+#endif
     if (detector_hitDetected()) {           // Hit detected
       hitCount++;                           // increment the hit count.
       detector_clearHit();                  // Clear the hit.
@@ -341,3 +469,58 @@ void runningModes_dumpRawAdcValues() {
     printf("raw ADC value: %d\n", signExtendedValue);
   }
 }
+
+#ifdef ADC_CAPTURE
+#define CAPTURE_SECONDS 10
+#define CAPTURE_VALUE_COUNT                                                    \
+  (CAPTURE_SECONDS * FILTER_SAMPLE_FREQUENCY_IN_KHZ * 1000 *                   \
+   ISR_ADC_CHANNEL_COUNT) // 100 kHz frames.
+#define ADC_SIGN_BIT 0x800
+#define ADC_SIGN_EXTENSION 0xF000
+
+// Capture buffer, in DDR (2 MB per channel at 10 seconds).
+static int16_t captureBuffer[CAPTURE_VALUE_COUNT];
+
+// Sends one byte of the capture. On the board, outbyte() is used directly
+// because stdout adds a '\r' before every '\n' byte.
+static void runningModes_putCaptureByte(uint8_t byte) {
+#ifdef ZYBO_BOARD
+  outbyte(byte);
+#else
+  putchar(byte);
+#endif
+}
+
+// Records ADC values at the full 100 kHz rate for CAPTURE_SECONDS (or until
+// btn3 is pressed), then sends them to the console as framed binary (see
+// captureFrame.h). isr_function() records the values itself, so none are lost
+// while this loop is busy. With more than one channel, the channels are
+// interleaved, channel 0 first. Use tools/captureDecode to turn the console
+// output into a capture file that tools/detectorReplay can read.
+void runningModes_captureRawAdcValues() {
+  runningModes_initAll();
+  printf("Capturing %d seconds of ADC values from %d channel(s). Press btn3 to "
+         "stop early.\n",
+         CAPTURE_SECONDS, ISR_ADC_CHANNEL_COUNT);
+  interrupts_initAll(true); // Sets up interrupts and the XADC.
+  isr_startAdcCapture(captureBuffer, CAPTURE_VALUE_COUNT);
+  interrupts_enableTimerGlobalInts(); // isr_function() fills the capture.
+  interrupts_startArmPrivateTimer();
+  interrupts_enableArmInts();
+  while (isr_adcCaptureCount() < CAPTURE_VALUE_COUNT &&
+         !(buttons_read() & BUTTONS_BTN3_MASK))
+    ;
+  interrupts_disableArmInts();
+  uint32_t count = isr_adcCaptureCount();
+  count -= count % ISR_ADC_CHANNEL_COUNT; // Whole frames only.
+  for (uint32_t i = 0; i < count; i++) {
+    // Same sign-extension as runningModes_dumpRawAdcValues().
+    captureBuffer[i] |=
+        (captureBuffer[i] & ADC_SIGN_BIT) ? ADC_SIGN_EXTENSION : 0x0000;
+  }
+  printf("Captured %lu values. Sending.\n", (unsigned long)count);
+  fflush(stdout); // Keep the text ahead of the frames.
+  captureFrame_writeSamples(captureBuffer, count, runningModes_putCaptureByte);
+  printf("\nCapture sent.\n");
+}
+#endif
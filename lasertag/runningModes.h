@@ -68,4 +68,11 @@ void runningModes_creative();
 // Will loop forever. Stop the program with an external reset or Ctl-C.
 void runningModes_dumpRawAdcValues();
 
+#ifdef ADC_CAPTURE
+// Records ADC values at the full sample rate into a DDR buffer, then sends them
+// to the console as framed binary with sequence numbers and CRCs. Decode with
+// tools/captureDecode.
+void runningModes_captureRawAdcValues();
+#endif
+
 #endif /* RUNNINGMODES_H_ */
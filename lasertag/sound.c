@@ -9,8 +9,24 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 
 #include <stdio.h>
 
-#include "interrupts.h" // Just for sound_runTest().
 #include "sound.h"
+#ifdef SOUND_ADPCM
+#include "soundAdpcm.h"
+#include "sounds/bcfire01_48k.wav.adpcm.h"
+#include "sounds/gameBoyStartup.wav.adpcm.h"
+#include "sounds/gameOver48k.wav.adpcm.h"
+#include "sounds/gunEmpty48k.wav.adpcm.h"
+#include "sounds/ouch48k.wav.adpcm.h"
+#include "sounds/pacmanDeath.wav.adpcm.h"
+#include "sounds/powerUp48k.wav.adpcm.h"
+#include "sounds/screamAndDie48k.wav.adpcm.h"
+#ifdef SOUND_RESAMPLE
+#include "sounds/gameOver22k.wav.adpcm.h"
+#include "sounds/pacmanDeath16k.wav.adpcm.h"
+#include "sounds/powerUp16k.wav.adpcm.h"
+#include "sounds/screamAndDie22k.wav.adpcm.h"
+#endif
+#else
 #include "sounds/bcfire01_48k.wav.h"
 #include "sounds/gameBoyStartup.wav.h"
 #include "sounds/gameOver48k.wav.h"
@@ -19,10 +35,29 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #include "sounds/pacmanDeath.wav.h"
 #include "sounds/powerUp48k.wav.h"
 #include "sounds/screamAndDie48k.wav.h"
+#ifdef SOUND_RESAMPLE
+#include "sounds/gameOver22k.wav.h"
+#include "sounds/pacmanDeath16k.wav.h"
+#include "sounds/powerUp16k.wav.h"
+#include "sounds/screamAndDie22k.wav.h"
+#endif
+#endif
+#ifdef SOUND_DMA
+#include "soundDma.h"
+#endif
+#ifdef SOUND_MIXER
+#include "soundMixer.h"
+#endif
+#ifdef SOUND_RESAMPLE
+#include "soundResample.h"
+#endif
+#ifdef ZYBO_BOARD
+#include "interrupts.h" // Just for sound_runTest().
 #include "timer_ps.h"
 #include "xiicps.h"
 #include "xil_printf.h"
 #include "xil_types.h"
+#endif
 
 /***************************************************************
  * Quite a bit of this code was obtained from digilentinc.com
@@ -57,8 +92,10 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
   48000 // The sample rate is 48k so that is 1 second's worth.
 uint16_t soundOfSilence[ONE_SECOND_OF_SOUND_ARRAY_SIZE];
 
+#ifdef ZYBO_BOARD
 // Declared below the sound state-machine code.
 static int AudioInitialize(u16 timerID, u16 iicID, u32 i2sAddr);
+#endif
 
 /****************************************************************
  *                 sound state machine code                     *
@@ -73,14 +110,104 @@ volatile static bool sound_playSoundFlag = false;
 
 // Keep track of the base pointer to the sound array with current sample-rate
 // and sample count.
-volatile static uint16_t *sound_array; // Base pointer to the sound array.
+static const uint16_t *volatile sound_array; // Base pointer to the sound array.
 
-// static uint32_t sound_sampleRate;  // Sample rate for this sound.
+static uint32_t sound_sampleRate;           // Sample rate for this sound.
 volatile static uint32_t sound_sampleCount; // Number of samples in this sound.
+#ifndef SOUND_MIXER
+static uint32_t arrayIndex; // The next sample of the sound to play.
+#endif
+#if defined(SOUND_DMA) && !defined(SOUND_MIXER)
+static uint32_t sound_frameCount; // Of the sound, at the codec rate.
+static uint32_t frameIndex;       // The next frame of the sound to play.
+#ifdef SOUND_RESAMPLE
+// Converts the sound if it is stored below the codec rate.
+static bool sound_resampling;
+static sound_resampler_t sound_resampler;
+static uint16_t sound_resampledFrames[SOUND_DMA_BLOCK_FRAMES];
+// A block of frames reads up to this many samples.
+#define SOUND_BLOCK_SAMPLES                                                    \
+  (SOUND_DMA_BLOCK_FRAMES + SOUND_RESAMPLE_EXTRA_SAMPLES)
+#else
+#define SOUND_BLOCK_SAMPLES SOUND_DMA_BLOCK_FRAMES
+#endif
+#endif
+
+#ifdef SOUND_ADPCM
+// The IMA-ADPCM encoding of the sound, which is played instead of sound_array
+// unless NULL (the silence is not encoded).
+static const uint8_t *sound_adpcmData;
+#ifndef SOUND_MIXER
+static sound_adpcmDecoder_t sound_decoder; // The sound being played.
+static uint16_t sound_decodedSamples[SOUND_BLOCK_SAMPLES];
+#endif
+
+// Sets the sound to the asset NAME (array, its name in upper case).
+#define SOUND_SET_ASSET(array, NAME)                                           \
+  sound_adpcmData = array##_adpcm;                                             \
+  sound_sampleCount = NAME##_ADPCM_NUMBER_OF_SAMPLES;                          \
+  sound_sampleRate = NAME##_ADPCM_SAMPLE_RATE
+
+// The assets, for sound_printAdpcmReport().
+#define SOUND_ADPCM_ASSET(name, NAME)                                          \
+  {#name, name##_wav_adpcm, NAME##_WAV_ADPCM_NUMBER_OF_SAMPLES,                \
+   NAME##_WAV_ADPCM_NUMBER_OF_BYTES, NAME##_WAV_ADPCM_SAMPLE_RATE}
+static const struct {
+  const char *name;
+  const uint8_t *data;
+  uint32_t sampleCount;
+  uint32_t byteCount;
+  uint32_t sampleRate;
+} sound_adpcmAssets[] = {
+    SOUND_ADPCM_ASSET(bcfire01_48k, BCFIRE01_48K),
+    SOUND_ADPCM_ASSET(gameBoyStartup, GAMEBOYSTARTUP),
+    SOUND_ADPCM_ASSET(gameOver48k, GAMEOVER48K),
+    SOUND_ADPCM_ASSET(gunEmpty48k, GUNEMPTY48K),
+    SOUND_ADPCM_ASSET(ouch48k, OUCH48K),
+    SOUND_ADPCM_ASSET(pacmanDeath, PACMANDEATH),
+    SOUND_ADPCM_ASSET(powerUp48k, POWERUP48K),
+    SOUND_ADPCM_ASSET(screamAndDie48k, SCREAMANDDIE48K),
+#ifdef SOUND_RESAMPLE
+    SOUND_ADPCM_ASSET(gameOver22k, GAMEOVER22K),
+    SOUND_ADPCM_ASSET(pacmanDeath16k, PACMANDEATH16K),
+    SOUND_ADPCM_ASSET(powerUp16k, POWERUP16K),
+    SOUND_ADPCM_ASSET(screamAndDie22k, SCREAMANDDIE22K),
+#endif
+};
+#define SOUND_ADPCM_ASSET_COUNT                                                \
+  (sizeof(sound_adpcmAssets) / sizeof(sound_adpcmAssets[0]))
+#else
+// Sets the sound to the asset NAME (array, its name in upper case).
+#define SOUND_SET_ASSET(array, NAME)                                           \
+  sound_array = array;                                                         \
+  sound_sampleCount = NAME##_NUMBER_OF_SAMPLES;                                \
+  sound_sampleRate = NAME##_SAMPLE_RATE
+#endif
+
+// Returns true if sound_setSound() has set the samples of a sound.
+static inline bool sound_hasSamples() {
+#ifdef SOUND_ADPCM
+  if (sound_adpcmData != NULL)
+    return true;
+#endif
+  return sound_array != NULL;
+}
 
 // Keep track of the current volume setting.
 volatile static sound_volume_t sound_currentVolume = sound_minimumVolume_e;
 
+#ifdef SOUND_MIXER
+// Mixer priorities. A sound can take the voice of a sound of the same or lower
+// priority (see soundMixer.h).
+static const uint8_t sound_priorities[] = {
+    [sound_gameStart_e] = 3,       [sound_gunFire_e] = 1,
+    [sound_hit_e] = 2,             [sound_gunClick_e] = 1,
+    [sound_gunReload_e] = 1,       [sound_loseLife_e] = 3,
+    [sound_gameOver_e] = 3,        [sound_returnToBase_e] = 2,
+    [sound_oneSecondSilence_e] = 0};
+static uint8_t sound_priority; // Of the sound set by sound_setSound().
+#endif
+
 // Sound state-machine states.
 typedef enum {
   sound_init_st, // Waiting for sound_init() to be invoked.
@@ -90,6 +217,7 @@ typedef enum {
 
 volatile static sound_st_t currentState = sound_init_st;
 
+#ifdef ZYBO_BOARD
 // Reset the TX FIFO.
 static void sound_resetTxFifo() {
   Xil_Out32(AUDIO_CTRL_BASEADDR + I2S_RESET_REG, 0b010); // Reset TX Fifo
@@ -113,16 +241,30 @@ static void sound_sendDataToBothChannels(uint32_t sampleValue) {
   Xil_Out32(AUDIO_CTRL_BASEADDR + I2S_TX_FIFO_REG,
             sampleValue); // add to right Channel.
 }
+#endif
 
 // Must be called before using the sound state machine.
 sound_status_t sound_init() {
+#ifdef ZYBO_BOARD
   // Setup the audio CODEC.
   AudioInitialize(SCU_TIMER_ID, AUDIO_IIC_ID, AUDIO_CTRL_BASEADDR);
+#ifdef SOUND_DMA
+  // The transfers keep the TX FIFO fed, with silence between sounds.
+  sound_resetTxFifo();
+  sound_enableTxFifo();
+#endif
+#endif
   sound_initFlag = true;
   // Initialize the silence array.
   for (uint32_t i = 0; i < ONE_SECOND_OF_SOUND_ARRAY_SIZE; i++)
     soundOfSilence[i] = NO_SOUND;
   sound_setVolume(sound_minimumVolume_e); // Init the volume level.
+#ifdef SOUND_MIXER
+  sound_mixerInit();
+#endif
+#ifdef SOUND_DMA
+  sound_dmaInit(); // sound_dmaStart() starts the transfers.
+#endif
   return SOUND_STATUS_OK;
 }
 
@@ -155,10 +297,11 @@ static void debugStatePrint() {
   }
 }
 
-// Standard tick function.
+// Standard tick function. With SOUND_DMA, does nothing: sound_renderBlock()
+// plays the sounds.
 void sound_tick() {
+#ifndef SOUND_DMA
   //  debugStatePrint();
-  static uint32_t arrayIndex = 0;
   // Action switch statement.
   switch (currentState) {
   case sound_init_st:
@@ -210,6 +353,117 @@ void sound_tick() {
     }
     break;
   }
+#endif
+}
+
+#if defined(SOUND_DMA) && !defined(SOUND_MIXER)
+// Returns the next count samples of the sound being played, at most
+// SOUND_BLOCK_SAMPLES, decoded if it is encoded.
+static const uint16_t *sound_readSamples(uint32_t count) {
+#ifdef SOUND_ADPCM
+  if (sound_adpcmData != NULL) {
+    sound_adpcmDecode(&sound_decoder, sound_decodedSamples, count);
+    arrayIndex += count;
+    return sound_decodedSamples;
+  }
+#endif
+  const uint16_t *samples = &sound_array[arrayIndex];
+  arrayIndex += count;
+  return samples;
+}
+
+// Points *frames at up to count of the next frames of the sound being played,
+// converted to the codec rate if it is stored below it, and returns how many.
+static uint32_t sound_nextFrames(const uint16_t **frames, uint32_t count) {
+  if (count > sound_frameCount - frameIndex)
+    count = sound_frameCount - frameIndex;
+  if (count > SOUND_DMA_BLOCK_FRAMES)
+    count = SOUND_DMA_BLOCK_FRAMES;
+  frameIndex += count;
+#ifdef SOUND_RESAMPLE
+  if (sound_resampling) {
+    const uint16_t *samples =
+        sound_readSamples(sound_resampleSampleCount(&sound_resampler, count));
+    sound_resample(&sound_resampler, samples, sound_resampledFrames, count);
+    *frames = sound_resampledFrames;
+    return count;
+  }
+#endif
+  *frames = sound_readSamples(count);
+  return count;
+}
+#endif
+
+#ifdef SOUND_DMA
+// Renders the next frameCount frames into words[] as sound_tick() would have
+// written them to the TX FIFO. A sound started with sound_startSound() starts
+// at the next block.
+void sound_renderBlock(uint32_t words[], uint32_t frameCount) {
+#ifdef SOUND_MIXER
+  sound_mixerRender(words, frameCount);
+#else
+  // Transitions, once per block.
+  if (currentState == sound_init_st && sound_initFlag)
+    currentState = sound_wait_st;
+  if (currentState == sound_wait_st && sound_playSoundFlag) {
+    arrayIndex = 0;
+    frameIndex = 0;
+    sound_frameCount = sound_sampleCount;
+#ifdef SOUND_RESAMPLE
+    sound_resampling = sound_sampleRate != SOUND_DMA_SAMPLE_RATE;
+    if (sound_resampling) {
+      sound_resampleStart(&sound_resampler, sound_sampleRate);
+      sound_frameCount =
+          sound_resampleFrameCount(sound_sampleCount, sound_sampleRate);
+    }
+#endif
+#ifdef SOUND_ADPCM
+    if (sound_adpcmData != NULL)
+      sound_adpcmStart(&sound_decoder, sound_adpcmData, sound_sampleCount);
+#endif
+    currentState = sound_play_st;
+  }
+  if (currentState == sound_play_st && !sound_playSoundFlag) // Stopped.
+    currentState = sound_wait_st;
+  if (currentState == sound_play_st && !sound_hasSamples()) {
+    printf("ERROR, sound_renderBlock: sound array has not been set.\n");
+    sound_stopSound();
+  }
+  uint32_t frame = 0;
+  if (currentState == sound_play_st) {
+    uint32_t volume = sound_currentVolume;
+    const uint16_t *frames;
+    uint32_t count;
+    while (frame < frameCount &&
+           (count = sound_nextFrames(&frames, frameCount - frame)) > 0) {
+      for (uint32_t i = 0; i < count; i++, frame++) {
+        uint32_t sampleValue = frames[i] * volume;
+        words[2 * frame] = sampleValue;     // Left channel.
+        words[2 * frame + 1] = sampleValue; // Right channel.
+      }
+    }
+    if (frameIndex == sound_frameCount) { // All done?
+      sound_playSoundFlag = false;
+      currentState = sound_wait_st;
+    }
+  }
+  for (; frame < frameCount; frame++) {
+    words[2 * frame] = NO_SOUND;
+    words[2 * frame + 1] = NO_SOUND;
+  }
+#endif
+}
+#endif
+
+// Plays the sound in sound_runTest(): a tick or, with the simulated DMA
+// transfers, a block.
+static void sound_runTestTick() {
+#if defined(SOUND_DMA) && !defined(ZYBO_BOARD)
+  uint32_t words[SOUND_DMA_BLOCK_WORDS];
+  sound_dmaSimulateBlock(words);
+#else
+  sound_tick();
+#endif
 }
 
 // Sets the sound and starts playing it immediately.
@@ -220,58 +474,79 @@ void sound_playSound(sound_sounds_t sound) {
 
 // Returns true if the sound is still playing.
 bool sound_isBusy() {
+#ifdef SOUND_MIXER
+  return sound_mixerActiveCount() > 0; // Busy while any voice plays.
+#else
   return (sound_playSoundFlag); // Busy if NOT in the wait state.
+#endif
 }
 
 // Returns true if the sound has finished playing.
 bool sound_isSoundComplete() { return (!sound_isBusy()); }
 
 // Use this to set the base address for the array containing sound data.
-// Allow sounds to be interrupted.
+// Allow sounds to be interrupted. With SOUND_MIXER, the sounds playing go on.
 void sound_setSound(sound_sounds_t sound) {
+#ifdef SOUND_MIXER
+  if ((uint32_t)sound < sizeof(sound_priorities))
+    sound_priority = sound_priorities[sound];
+#else
   if (sound_isBusy()) { // You are currently playing some sound.
     sound_stopSound(); // Stop the sound and reset the state-machine, FIFO, etc.
   }
+#endif
   sound_array =
       NULL; // Set the pointer to NULL so you can detect it never being set.
+#ifdef SOUND_ADPCM
+  sound_adpcmData = NULL;
+#endif
   switch (sound) {
   case sound_gameStart_e:
-    sound_array = gameBoyStartup_wav; // Set the array holding the data.
-    sound_sampleCount =
-        GAMEBOYSTARTUP_WAV_NUMBER_OF_SAMPLES; // Size of the array.
+    // Set the array holding the data and its size.
+    SOUND_SET_ASSET(gameBoyStartup_wav, GAMEBOYSTARTUP_WAV);
     break;
   case sound_gunFire_e:
-    sound_array = bcfire01_48k_wav; // Set the array holding the data.
-    sound_sampleCount =
-        BCFIRE01_48K_WAV_NUMBER_OF_SAMPLES; // Size of the array.
+    SOUND_SET_ASSET(bcfire01_48k_wav, BCFIRE01_48K_WAV); // You get the idea...
     break;
   case sound_hit_e:
-    sound_array = ouch48k_wav; // You get the idea...
-    sound_sampleCount = OUCH48K_WAV_NUMBER_OF_SAMPLES;
+    SOUND_SET_ASSET(ouch48k_wav, OUCH48K_WAV);
     break;
   case sound_gunClick_e:
-    sound_array = gunEmpty48k_wav;
-    sound_sampleCount = GUNEMPTY48K_WAV_NUMBER_OF_SAMPLES;
+    SOUND_SET_ASSET(gunEmpty48k_wav, GUNEMPTY48K_WAV);
     break;
+#ifdef SOUND_RESAMPLE
+  // These have nothing much above 8 or 11 kHz, so they are stored at 16 or
+  // 22.05 kHz and converted as they play.
   case sound_gunReload_e:
-    sound_array = powerUp48k_wav;
-    sound_sampleCount = POWERUP48K_WAV_NUMBER_OF_SAMPLES;
+    SOUND_SET_ASSET(powerUp16k_wav, POWERUP16K_WAV);
     break;
   case sound_loseLife_e:
-    sound_array = screamAndDie48k_wav;
-    sound_sampleCount = SCREAMANDDIE48K_WAV_NUMBER_OF_SAMPLES;
+    SOUND_SET_ASSET(screamAndDie22k_wav, SCREAMANDDIE22K_WAV);
     break;
   case sound_gameOver_e:
-    sound_array = pacmanDeath_wav;
-    sound_sampleCount = PACMANDEATH_WAV_NUMBER_OF_SAMPLES;
+    SOUND_SET_ASSET(pacmanDeath16k_wav, PACMANDEATH16K_WAV);
     break;
   case sound_returnToBase_e:
-    sound_array = gameOver48k_wav;
-    sound_sampleCount = GAMEOVER48K_WAV_NUMBER_OF_SAMPLES;
+    SOUND_SET_ASSET(gameOver22k_wav, GAMEOVER22K_WAV);
+    break;
+#else
+  case sound_gunReload_e:
+    SOUND_SET_ASSET(powerUp48k_wav, POWERUP48K_WAV);
     break;
+  case sound_loseLife_e:
+    SOUND_SET_ASSET(screamAndDie48k_wav, SCREAMANDDIE48K_WAV);
+    break;
+  case sound_gameOver_e:
+    SOUND_SET_ASSET(pacmanDeath_wav, PACMANDEATH_WAV);
+    break;
+  case sound_returnToBase_e:
+    SOUND_SET_ASSET(gameOver48k_wav, GAMEOVER48K_WAV);
+    break;
+#endif
   case sound_oneSecondSilence_e:
     sound_array = soundOfSilence;
     sound_sampleCount = ONE_SECOND_OF_SOUND_ARRAY_SIZE;
+    sound_sampleRate = ONE_SECOND_OF_SOUND_ARRAY_SIZE; // Samples per second.
     break;
   default:
     printf("sound_setSound(): bogus sound value(%d)\n", sound);
@@ -281,11 +556,34 @@ void sound_setSound(sound_sounds_t sound) {
 // Used to set the volume. Use one of the provided values.
 void sound_setVolume(sound_volume_t volume) { sound_currentVolume = volume; }
 
-// Tell the state machine to start playing the sound.
-void sound_startSound() { sound_playSoundFlag = true; }
+// Tell the state machine to start playing the sound. With SOUND_MIXER, starts
+// it on a voice of its own at the current volume.
+void sound_startSound() {
+#ifdef SOUND_MIXER
+  if (!sound_hasSamples()) {
+    printf("ERROR, sound_startSound: sound array has not been set.\n");
+    return;
+  }
+#ifdef SOUND_ADPCM
+  if (sound_adpcmData != NULL) {
+    sound_mixerPlayAdpcm(sound_adpcmData, sound_sampleCount, sound_sampleRate,
+                         sound_currentVolume, sound_priority);
+    return;
+  }
+#endif
+  sound_mixerPlay(sound_array, sound_sampleCount, sound_sampleRate,
+                  sound_currentVolume, sound_priority);
+#else
+  sound_playSoundFlag = true;
+#endif
+}
 
-// Stops playing the sound and resets the state-machine to the wait state.
+// Stops playing the sound and resets the state-machine to the wait state. With
+// SOUND_MIXER, stops every voice.
 void sound_stopSound() {
+#ifdef SOUND_MIXER
+  sound_mixerStopAll();
+#endif
   sound_playSoundFlag = false; // disable the state-machine.
   currentState =
       sound_wait_st; // Force the state-machine back to the wait state.
@@ -293,17 +591,22 @@ void sound_stopSound() {
 
 // Plays several sounds.
 // To invoke, just place this in your main.
-// Completely stand alone, doesn't require interrupts, etc.
+// Completely stand alone, doesn't require interrupts, etc. With SOUND_DMA on the
+// board, the blocks are rendered in the DMA interrupt, so call after
+// interrupts_initAll() and interrupts_enableArmInts().
 void sound_runTest() {
   printf("****************** sound_runTest() ******************\n");
 
   sound_init();
-  sound_tick();
+#ifdef SOUND_DMA
+  sound_dmaStart();
+#endif
+  sound_runTestTick();
   sound_setSound(sound_gunClick_e);
   printf("playing gunClick_e\n");
   sound_startSound();
   while (1) {
-    sound_tick();
+    sound_runTestTick();
     if (!sound_isBusy())
       break;
   }
@@ -311,7 +614,7 @@ void sound_runTest() {
   printf("playing gunFire_e\n");
   sound_startSound();
   while (1) {
-    sound_tick();
+    sound_runTestTick();
     if (!sound_isBusy())
       break;
   }
@@ -319,7 +622,7 @@ void sound_runTest() {
   printf("playing gunReload_e\n");
   sound_startSound();
   while (1) {
-    sound_tick();
+    sound_runTestTick();
     if (!sound_isBusy())
       break;
   }
@@ -327,7 +630,7 @@ void sound_runTest() {
   printf("playing loseLife_e\n");
   sound_startSound();
   while (1) {
-    sound_tick();
+    sound_runTestTick();
     if (!sound_isBusy())
       break;
   }
@@ -335,13 +638,47 @@ void sound_runTest() {
   printf("playing gameOver_e\n");
   sound_startSound();
   while (1) {
-    sound_tick();
+    sound_runTestTick();
     if (!sound_isBusy())
       break;
   }
+#ifdef SOUND_DMA
+  sound_dmaStop();
+#endif
+#ifdef SOUND_ADPCM
+  sound_printAdpcmReport();
+#endif
   printf("done.\n");
 }
 
+#ifdef SOUND_ADPCM
+// Prints the size of each asset, 16-bit and encoded, and the cycles it takes to
+// decode a second of it.
+void sound_printAdpcmReport() {
+  uint32_t rawBytes = 0;
+  uint32_t adpcmBytes = 0;
+  printf("%-16s %8s %8s %8s %6s %14s\n", "Sound", "Seconds", "16-bit",
+         "ADPCM", "Ratio", "Decode/second");
+  for (uint16_t i = 0; i < SOUND_ADPCM_ASSET_COUNT; i++) {
+    double seconds = (double)sound_adpcmAssets[i].sampleCount /
+                     sound_adpcmAssets[i].sampleRate;
+    uint32_t bytes = sound_adpcmAssets[i].sampleCount * sizeof(uint16_t);
+    uint32_t cycles = sound_adpcmMeasureDecode(
+        sound_adpcmAssets[i].data, sound_adpcmAssets[i].sampleCount);
+    printf("%-16s %8.2f %8lu %8lu %6.2f %14.0f\n", sound_adpcmAssets[i].name,
+           seconds, (unsigned long)bytes,
+           (unsigned long)sound_adpcmAssets[i].byteCount,
+           (double)bytes / sound_adpcmAssets[i].byteCount, cycles / seconds);
+    rawBytes += bytes;
+    adpcmBytes += sound_adpcmAssets[i].byteCount;
+  }
+  printf("%-16s %8s %8lu %8lu %6.2f\n", "Total", "", (unsigned long)rawBytes,
+         (unsigned long)adpcmBytes, (double)rawBytes / adpcmBytes);
+}
+#endif
+
+#ifdef ZYBO_BOARD
+
 /**********************************************************************************
  * Note from BLH: Most of this code was re-purposed from the original Digilent
  * demonstration code. The code initializes the IIC controller that is
@@ -581,3 +918,4 @@ static u32 I2SFifoRead(u32 i2sBaseAddr) {
   return Xil_In32(i2sBaseAddr + I2S_RX_FIFO_REG);
 }
 /* ------------------------------------------------------------ */
+#endif
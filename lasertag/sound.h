@@ -73,6 +73,25 @@ void sound_startSound();
 // Stops playing the sound and resets the state-machine to the wait state.
 void sound_stopSound();
 
+#ifdef SOUND_DMA
+// Renders the next frameCount frames of output, two words each (left, then
+// right), into words[]: the rest of the sound being played, scaled by the
+// volume, then silence. With SOUND_ADPCM, decodes the sound as it goes. With
+// SOUND_MIXER, mixes every sound playing instead (see soundMixer.h). Replaces
+// sound_tick() for the DMA transfers of soundDma.h, which call it from their
+// interrupt. A sound ends, and sound_isBusy() returns false, when its last
+// sample is rendered, up to two blocks before it is heard.
+void sound_renderBlock(uint32_t words[], uint32_t frameCount);
+#endif
+
+#ifdef SOUND_ADPCM
+// Prints, for each IMA-ADPCM asset (see soundAdpcm.h), its length, its size as
+// 16-bit samples and encoded, and the cycles it takes to decode a second of it
+// (nanoseconds off the board). On the board, call
+// detectorProfile_startCounters() first.
+void sound_printAdpcmReport();
+#endif
+
 // Plays several sounds.
 // To invoke, just place this in your main.
 // Completely stand alone, doesn't require interrupts, etc.
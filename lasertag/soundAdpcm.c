@@ -0,0 +1,341 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// IMA-ADPCM encoding and streaming decoding. See soundAdpcm.h.
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "detectorProfile.h"
+#include "soundAdpcm.h"
+#include "soundDma.h"
+
+#define MAX_STEP_INDEX 88
+#define SAMPLE_LIMIT INT16_MAX // Keeps offset-binary samples within 16 bits.
+#define NIBBLE_SIGN 0x8
+#define NIBBLE_MASK 0xF
+#define CODE_COUNT 16
+#define ENCODE_LOOKAHEAD 3 // Samples the encoder tries ahead for each code.
+
+// The IMA-ADPCM step sizes, and the step index changes for each magnitude.
+static const int16_t stepTable[MAX_STEP_INDEX + 1] = {
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17,
+    19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+    337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+    876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+    5894,  6484,  7132,  7845,  8630,  9493,  10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+static const int8_t indexTable[NIBBLE_SIGN] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+// Limits a sample to +/-SAMPLE_LIMIT.
+static inline int32_t sound_adpcmClamp(int32_t sample) {
+  if (sample > SAMPLE_LIMIT)
+    return SAMPLE_LIMIT;
+  if (sample < -SAMPLE_LIMIT)
+    return -SAMPLE_LIMIT;
+  return sample;
+}
+
+// Applies code to the predictor and step index. The encoder does the same, so
+// both track the same predictor.
+static inline void sound_adpcmDecodeNibble(int32_t *predictor,
+                                           int16_t *stepIndex, uint8_t code) {
+  int32_t step = stepTable[*stepIndex];
+  int32_t delta = step >> 3;
+  if (code & 0x4)
+    delta += step;
+  if (code & 0x2)
+    delta += step >> 1;
+  if (code & 0x1)
+    delta += step >> 2;
+  *predictor = sound_adpcmClamp(code & NIBBLE_SIGN ? *predictor - delta
+                                                   : *predictor + delta);
+  *stepIndex += indexTable[code & (NIBBLE_SIGN - 1)];
+  if (*stepIndex < 0)
+    *stepIndex = 0;
+  if (*stepIndex > MAX_STEP_INDEX)
+    *stepIndex = MAX_STEP_INDEX;
+}
+
+// Returns the code of the standard IMA-ADPCM encoder for sample: the bits of
+// the difference from the predictor, in steps of step, step / 2 and step / 4.
+static uint8_t sound_adpcmEncodeNibble(int32_t predictor, int16_t stepIndex,
+                                       int32_t sample) {
+  int32_t step = stepTable[stepIndex];
+  int32_t difference = sample - predictor;
+  uint8_t code = 0;
+  if (difference < 0) {
+    code = NIBBLE_SIGN;
+    difference = -difference;
+  }
+  for (uint8_t bit = 0x4; bit != 0; bit >>= 1, step >>= 1) {
+    if (difference >= step) {
+      code |= bit;
+      difference -= step;
+    }
+  }
+  return code;
+}
+
+// Returns the least squared error with which the next count samples can be
+// coded from the predictor and step index, and sets *bestCode, unless NULL, to
+// the first code of that coding.
+static int64_t sound_adpcmSearch(int32_t predictor, int16_t stepIndex,
+                                 const int16_t samples[], uint32_t count,
+                                 uint8_t *bestCode) {
+  int64_t bestError = INT64_MAX;
+  for (uint8_t code = 0; code < CODE_COUNT; code++) {
+    int32_t nextPredictor = predictor;
+    int16_t nextStepIndex = stepIndex;
+    sound_adpcmDecodeNibble(&nextPredictor, &nextStepIndex, code);
+    int64_t error = (int64_t)(nextPredictor - samples[0]) *
+                    (nextPredictor - samples[0]);
+    if (error >= bestError) // The samples after can only add to it.
+      continue;
+    if (count > 1)
+      error += sound_adpcmSearch(nextPredictor, nextStepIndex, &samples[1],
+                                 count - 1, NULL);
+    if (error < bestError) {
+      bestError = error;
+      if (bestCode != NULL)
+        *bestCode = code;
+    }
+  }
+  return bestError;
+}
+
+// Returns the number of bytes sampleCount samples are encoded in.
+uint32_t sound_adpcmEncodedBytes(uint32_t sampleCount) {
+  uint32_t fullBlocks = sampleCount / SOUND_ADPCM_SAMPLES_PER_BLOCK;
+  uint32_t rest = sampleCount % SOUND_ADPCM_SAMPLES_PER_BLOCK;
+  uint32_t bytes = fullBlocks * SOUND_ADPCM_BLOCK_BYTES;
+  if (rest > 0) // The header, then the other samples two per byte.
+    bytes += SOUND_ADPCM_HEADER_BYTES + rest / 2;
+  return bytes;
+}
+
+// Encodes the count samples of a block into block[], starting from *stepIndex,
+// with the code that has the least error over up to lookahead samples, or with
+// the standard encoder if lookahead is 0. Leaves *stepIndex where the block
+// ends and returns the squared error.
+static int64_t sound_adpcmEncodeBlock(const int16_t samples[], uint32_t count,
+                                      int16_t *stepIndex, uint32_t lookahead,
+                                      uint8_t block[]) {
+  int32_t predictor = sound_adpcmClamp(samples[0]);
+  block[0] = predictor & 0xFF;
+  block[1] = (predictor >> 8) & 0xFF;
+  block[2] = *stepIndex; // Carried over from the previous block.
+  block[3] = 0;
+  uint8_t *nibbles = &block[SOUND_ADPCM_HEADER_BYTES];
+  int64_t error = 0;
+  for (uint32_t k = 1; k < count; k++) {
+    // No further than the end of the block, where the header resets the
+    // predictor.
+    uint32_t ahead = count - k < lookahead ? count - k : lookahead;
+    uint8_t code = 0;
+    if (lookahead == 0)
+      code = sound_adpcmEncodeNibble(predictor, *stepIndex, samples[k]);
+    else
+      sound_adpcmSearch(predictor, *stepIndex, &samples[k], ahead, &code);
+    sound_adpcmDecodeNibble(&predictor, stepIndex, code);
+    error += (int64_t)(predictor - samples[k]) * (predictor - samples[k]);
+    if ((k - 1) % 2 == 0)
+      nibbles[(k - 1) / 2] = code;
+    else
+      nibbles[(k - 1) / 2] |= code << 4;
+  }
+  return error;
+}
+
+// Encodes sampleCount signed samples into data[]. Each block is encoded both
+// with the standard encoder and trying ENCODE_LOOKAHEAD samples ahead, and
+// keeps the one with less error: trying ahead follows the sudden changes most
+// of the sound assets have better, the standard encoder smooth sounds.
+void sound_adpcmEncode(const int16_t samples[], uint32_t sampleCount,
+                       uint8_t data[]) {
+  uint8_t standardBlock[SOUND_ADPCM_BLOCK_BYTES];
+  int16_t stepIndex = 0;
+  for (uint32_t first = 0; first < sampleCount;
+       first += SOUND_ADPCM_SAMPLES_PER_BLOCK) {
+    uint8_t *block = &data[first / SOUND_ADPCM_SAMPLES_PER_BLOCK *
+                           SOUND_ADPCM_BLOCK_BYTES];
+    uint32_t count = sampleCount - first < SOUND_ADPCM_SAMPLES_PER_BLOCK
+                         ? sampleCount - first
+                         : SOUND_ADPCM_SAMPLES_PER_BLOCK;
+    int16_t standardStepIndex = stepIndex;
+    int64_t standardError = sound_adpcmEncodeBlock(
+        &samples[first], count, &standardStepIndex, 0, standardBlock);
+    int64_t error = sound_adpcmEncodeBlock(&samples[first], count, &stepIndex,
+                                           ENCODE_LOOKAHEAD, block);
+    if (standardError < error) {
+      memcpy(block, standardBlock, sound_adpcmEncodedBytes(count));
+      stepIndex = standardStepIndex;
+    }
+  }
+}
+
+// Starts decoding the sampleCount samples encoded in data[].
+void sound_adpcmStart(sound_adpcmDecoder_t *decoder, const uint8_t data[],
+                      uint32_t sampleCount) {
+  decoder->data = data;
+  decoder->sampleCount = sampleCount;
+  decoder->position = 0;
+  decoder->predictor = 0;
+  decoder->stepIndex = 0;
+}
+
+// Decodes the next count samples into samples[]. Returns the number decoded.
+uint32_t sound_adpcmDecode(sound_adpcmDecoder_t *decoder, uint16_t samples[],
+                           uint32_t count) {
+  if (count > decoder->sampleCount - decoder->position)
+    count = decoder->sampleCount - decoder->position;
+  int32_t predictor = decoder->predictor;
+  int16_t stepIndex = decoder->stepIndex;
+  uint32_t i = 0;
+  while (i < count) {
+    uint32_t k = decoder->position % SOUND_ADPCM_SAMPLES_PER_BLOCK;
+    const uint8_t *block =
+        &decoder->data[decoder->position / SOUND_ADPCM_SAMPLES_PER_BLOCK *
+                       SOUND_ADPCM_BLOCK_BYTES];
+    if (k == 0) { // The header holds the first sample.
+      predictor = (int16_t)(block[0] | block[1] << 8);
+      stepIndex = block[2] > MAX_STEP_INDEX ? MAX_STEP_INDEX : block[2];
+      samples[i++] = predictor + SOUND_DMA_SAMPLE_ZERO;
+      decoder->position++;
+      continue;
+    }
+    // The rest of this block, or of the samples asked for.
+    uint32_t end = k + (count - i);
+    if (end > SOUND_ADPCM_SAMPLES_PER_BLOCK)
+      end = SOUND_ADPCM_SAMPLES_PER_BLOCK;
+    const uint8_t *nibbles = &block[SOUND_ADPCM_HEADER_BYTES];
+    decoder->position += end - k;
+    for (; k < end; k++) {
+      uint8_t byte = nibbles[(k - 1) / 2];
+      uint8_t code = (k - 1) % 2 ? byte >> 4 : byte & NIBBLE_MASK;
+      sound_adpcmDecodeNibble(&predictor, &stepIndex, code);
+      samples[i++] = predictor + SOUND_DMA_SAMPLE_ZERO;
+    }
+  }
+  decoder->predictor = predictor;
+  decoder->stepIndex = stepIndex;
+  return count;
+}
+
+// Decodes a whole sound and returns the cycles it took.
+uint32_t sound_adpcmMeasureDecode(const uint8_t data[], uint32_t sampleCount) {
+  static uint16_t samples[SOUND_DMA_BLOCK_FRAMES];
+  sound_adpcmDecoder_t decoder;
+  uint32_t startCycles = detectorProfile_readCycles();
+  sound_adpcmStart(&decoder, data, sampleCount);
+  while (sound_adpcmDecode(&decoder, samples, SOUND_DMA_BLOCK_FRAMES) > 0)
+    ;
+  return detectorProfile_readCycles() - startCycles;
+}
+
+#define TEST_SAMPLE_COUNT (3 * SOUND_ADPCM_SAMPLES_PER_BLOCK + 100)
+#define TEST_BYTES (3 * SOUND_ADPCM_BLOCK_BYTES + SOUND_ADPCM_HEADER_BYTES + 50)
+#define TEST_SAMPLE_RATE 48000.0
+#define TEST_AMPLITUDE 12000.0
+#define TEST_MIN_SNR_DB 30.0
+#define TEST_SQUARE_PERIOD 20 // Full-scale square wave in the last block.
+#define TEST_SQUARE_START (3 * SOUND_ADPCM_SAMPLES_PER_BLOCK)
+#define TEST_PIECE_SIZES {1, 7, 256, TEST_SAMPLE_COUNT}
+
+static int16_t testSamples[TEST_SAMPLE_COUNT];
+static uint8_t testData[TEST_BYTES];
+static uint16_t testDecoded[TEST_SAMPLE_COUNT];
+static uint16_t testPieces[TEST_SAMPLE_COUNT];
+
+// Encodes and decodes synthetic sounds and checks the result.
+bool sound_runAdpcmTest() {
+  bool success = true; // Be optimistic.
+  // A chirp from 200 Hz to 4 kHz, then a full-scale square wave.
+  for (uint32_t i = 0; i < TEST_SAMPLE_COUNT; i++) {
+    double t = i / TEST_SAMPLE_RATE;
+    double frequency = 200.0 + 3800.0 * i / TEST_SQUARE_START;
+    testSamples[i] = TEST_AMPLITUDE * sin(M_PI * frequency * t);
+    if (i >= TEST_SQUARE_START)
+      testSamples[i] = i % TEST_SQUARE_PERIOD < TEST_SQUARE_PERIOD / 2
+                           ? INT16_MAX
+                           : INT16_MIN;
+  }
+  if (sound_adpcmEncodedBytes(TEST_SAMPLE_COUNT) != TEST_BYTES) {
+    printf("sound_runAdpcmTest: %lu bytes, should be %d.\n",
+           (unsigned long)sound_adpcmEncodedBytes(TEST_SAMPLE_COUNT),
+           TEST_BYTES);
+    success = false;
+  }
+  sound_adpcmEncode(testSamples, TEST_SAMPLE_COUNT, testData);
+  sound_adpcmDecoder_t decoder;
+  sound_adpcmStart(&decoder, testData, TEST_SAMPLE_COUNT);
+  uint32_t count = sound_adpcmDecode(&decoder, testDecoded, TEST_SAMPLE_COUNT);
+  if (count != TEST_SAMPLE_COUNT ||
+      sound_adpcmDecode(&decoder, testDecoded, 1) != 0) {
+    printf("sound_runAdpcmTest: decoded %lu samples, should be %d.\n",
+           (unsigned long)count, TEST_SAMPLE_COUNT);
+    success = false;
+  }
+
+  // The chirp is decoded within TEST_MIN_SNR_DB, the first sample of each
+  // block exactly, and nothing leaves the 16 bits.
+  double signal = 0.0;
+  double noise = 0.0;
+  for (uint32_t i = 0; i < TEST_SAMPLE_COUNT; i++) {
+    int32_t decoded = (int32_t)testDecoded[i] - SOUND_DMA_SAMPLE_ZERO;
+    int32_t expected = sound_adpcmClamp(testSamples[i]);
+    if (i % SOUND_ADPCM_SAMPLES_PER_BLOCK == 0 && decoded != expected) {
+      printf("sound_runAdpcmTest: sample %lu is %ld, should be %ld.\n",
+             (unsigned long)i, (long)decoded, (long)expected);
+      success = false;
+    }
+    if (decoded > SAMPLE_LIMIT || decoded < -SAMPLE_LIMIT) {
+      printf("sound_runAdpcmTest: sample %lu is %ld, out of range.\n",
+             (unsigned long)i, (long)decoded);
+      success = false;
+    }
+    if (i < TEST_SQUARE_START) {
+      signal += (double)expected * expected;
+      noise += (double)(decoded - expected) * (decoded - expected);
+    }
+  }
+  double snr = 10.0 * log10(signal / noise);
+  if (!(snr >= TEST_MIN_SNR_DB)) {
+    printf("sound_runAdpcmTest: SNR %.1f dB, should be at least %.1f dB.\n",
+           snr, TEST_MIN_SNR_DB);
+    success = false;
+  }
+
+  // Decoding in pieces of any size gives the same samples.
+  const uint32_t pieceSizes[] = TEST_PIECE_SIZES;
+  for (uint16_t p = 0; p < sizeof(pieceSizes) / sizeof(pieceSizes[0]); p++) {
+    sound_adpcmStart(&decoder, testData, TEST_SAMPLE_COUNT);
+    uint32_t decoded = 0;
+    while ((count = sound_adpcmDecode(&decoder, &testPieces[decoded],
+                                      pieceSizes[p])) > 0)
+      decoded += count;
+    for (uint32_t i = 0; i < TEST_SAMPLE_COUNT; i++) {
+      if (decoded != TEST_SAMPLE_COUNT || testPieces[i] != testDecoded[i]) {
+        printf("sound_runAdpcmTest: in pieces of %lu, sample %lu is %u, "
+               "should be %u.\n",
+               (unsigned long)pieceSizes[p], (unsigned long)i, testPieces[i],
+               testDecoded[i]);
+        success = false;
+        break;
+      }
+    }
+  }
+  printf("sound_runAdpcmTest %s (SNR %.1f dB).\n",
+         success ? "passed" : "failed", snr);
+  return success;
+}
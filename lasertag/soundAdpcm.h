@@ -0,0 +1,71 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SOUNDADPCM_H_
+#define SOUNDADPCM_H_
+
+// IMA-ADPCM sound assets (build with SOUND_ADPCM, which requires SOUND_DMA).
+// wav2c -a encodes a WAV file as 4 bits per sample instead of 16
+// (sounds/*.wav.adpcm.bin), and sound_renderBlock() decodes the sound a block
+// at a time as it plays, so the samples are never stored whole.
+//
+// The layout is that of IMA-ADPCM WAV files: blocks of SOUND_ADPCM_BLOCK_BYTES
+// bytes, each starting with a header that holds its first sample (16 bits,
+// little endian) and the step index, so every block can be decoded on its own,
+// followed by the other samples, two per byte, low nibble first. The last
+// block is cut short after the last sample. That is 3.95 times smaller than
+// the 16-bit samples.
+//
+// Decoded samples are offset binary, signed + SOUND_DMA_SAMPLE_ZERO (see
+// soundDma.h), which the mixer centers them on.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SOUND_ADPCM_BLOCK_BYTES 256
+#define SOUND_ADPCM_HEADER_BYTES 4
+#define SOUND_ADPCM_SAMPLES_PER_BLOCK                                          \
+  (2 * (SOUND_ADPCM_BLOCK_BYTES - SOUND_ADPCM_HEADER_BYTES) + 1)
+
+// Decoder state of one sound.
+typedef struct {
+  const uint8_t *data; // The encoded sound.
+  uint32_t sampleCount;
+  uint32_t position; // The next sample to decode.
+  int32_t predictor; // The last sample decoded.
+  int16_t stepIndex;
+} sound_adpcmDecoder_t;
+
+// Returns the number of bytes sampleCount samples are encoded in.
+uint32_t sound_adpcmEncodedBytes(uint32_t sampleCount);
+
+// Encodes sampleCount signed samples into data[sound_adpcmEncodedBytes()].
+void sound_adpcmEncode(const int16_t samples[], uint32_t sampleCount,
+                       uint8_t data[]);
+
+// Starts decoding the sampleCount samples encoded in data[].
+void sound_adpcmStart(sound_adpcmDecoder_t *decoder, const uint8_t data[],
+                      uint32_t sampleCount);
+
+// Decodes the next count samples into samples[], offset binary. Returns the
+// number decoded, less than count at the end of the sound.
+uint32_t sound_adpcmDecode(sound_adpcmDecoder_t *decoder, uint16_t samples[],
+                           uint32_t count);
+
+// Decodes all sampleCount samples in data[], in blocks of
+// SOUND_DMA_BLOCK_FRAMES, and returns the cycles it took (nanoseconds off the
+// board, see detectorProfile_readCycles()).
+uint32_t sound_adpcmMeasureDecode(const uint8_t data[], uint32_t sampleCount);
+
+// Encodes and decodes synthetic sounds and checks the signal-to-noise ratio,
+// that decoding in any size of pieces gives the same samples and that the
+// encoded size is as documented. Returns true if the test passes.
+bool sound_runAdpcmTest();
+
+#endif /* SOUNDADPCM_H_ */
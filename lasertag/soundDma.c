@@ -0,0 +1,324 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// DMA-fed audio output. See soundDma.h.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sound.h"
+#include "soundDma.h"
+#ifdef SOUND_ADPCM
+#include "soundAdpcm.h"
+#include "sounds/gunEmpty48k.wav.adpcm.h"
+#else
+#include "sounds/gunEmpty48k.wav.h"
+#endif
+#ifdef SOUND_MIXER
+#include "soundMixer.h"
+#endif
+
+#ifdef ZYBO_BOARD
+#include "xdmaps.h"
+#include "xil_cache.h"
+#include "xparameters.h"
+#include "xscugic.h"
+#endif
+
+// The DMA reads the buffers straight from memory, so each starts a cache line.
+static uint32_t dmaBuffers[SOUND_DMA_BUFFER_COUNT][SOUND_DMA_BLOCK_WORDS]
+    __attribute__((aligned(32)));
+static uint16_t sendingBuffer; // The buffer the transfer reads.
+static volatile bool running;
+static volatile uint32_t blockCount;
+
+#ifdef ZYBO_BOARD
+#define DMA_CHANNEL 1
+#define DMA_EVENT DMA_CHANNEL
+#define DMA_DONE_INTERRUPT XPAR_XDMAPS_0_DONE_INTR_1
+#define DMA_PERIPHERAL 0 // DMA0_REQ, the I2S TX request.
+// The TX FIFO of the I2S controller at sound.c's AUDIO_CTRL_BASEADDR.
+#define I2S_TX_FIFO_ADDRESS (XPAR_AXI_I2S_ADI_1_S_AXI_BASEADDR + 0x2C)
+#define DMA_WORD_SIZE_LOG2 2 // 4-byte reads and writes.
+// Channel control: incrementing source, fixed destination, single 4-byte beats.
+#define DMA_CCR                                                                \
+  (0x1 | (DMA_WORD_SIZE_LOG2 << 1) | (DMA_WORD_SIZE_LOG2 << 15))
+// The program loops over the words of a block with two loop counters, which
+// count to at most 256 each.
+#define DMA_INNER_LOOP 256
+#define DMA_OUTER_LOOP (SOUND_DMA_BLOCK_WORDS / DMA_INNER_LOOP)
+#if DMA_OUTER_LOOP * DMA_INNER_LOOP != SOUND_DMA_BLOCK_WORDS ||                \
+    DMA_OUTER_LOOP > 256
+#error "SOUND_DMA_BLOCK_WORDS must be a multiple of 256, up to 65536."
+#endif
+
+// DMA controller instructions (PL330 TRM, chapter 4).
+#define DMA_END 0x00
+#define DMA_FLUSHP 0x35
+#define DMA_LD 0x04
+#define DMA_LP(loopCounter) (0x20 | (loopCounter) << 1)
+#define DMA_LPEND(loopCounter) (0x38 | (loopCounter) << 2)
+#define DMA_LPFE 0x28 // DMALPEND without a loop counter: loops forever.
+#define DMA_MOV 0xBC
+#define DMA_MOV_SAR 0
+#define DMA_MOV_CCR 1
+#define DMA_MOV_DAR 2
+#define DMA_SEV 0x34
+#define DMA_STPS 0x29
+#define DMA_WFPS 0x30
+#define DMA_PROGRAM_SIZE 64
+
+static uint8_t dmaProgram[DMA_PROGRAM_SIZE] __attribute__((aligned(32)));
+static XDmaPs dma;
+static XDmaPs_Cmd dmaCommand;
+#endif
+
+// Renders buffer and, on the board, writes it back to memory for the DMA.
+static void sound_dmaRender(uint16_t buffer) {
+  sound_renderBlock(dmaBuffers[buffer], SOUND_DMA_BLOCK_FRAMES);
+#ifdef ZYBO_BOARD
+  Xil_DCacheFlushRange((INTPTR)dmaBuffers[buffer], sizeof(dmaBuffers[buffer]));
+#endif
+}
+
+// Renders both buffers and resets the block count.
+void sound_dmaInit() {
+  running = false;
+  sendingBuffer = 0;
+  blockCount = 0;
+  for (uint16_t i = 0; i < SOUND_DMA_BUFFER_COUNT; i++)
+    sound_dmaRender(i);
+}
+
+// A buffer has been sent: the transfer has moved on to the other one, so
+// refill it.
+static void sound_dmaBlockSent() {
+  uint16_t sentBuffer = sendingBuffer;
+  sendingBuffer = (sendingBuffer + 1) % SOUND_DMA_BUFFER_COUNT;
+  sound_dmaRender(sentBuffer);
+  blockCount++;
+}
+
+#ifdef ZYBO_BOARD
+// Appends an instruction with an 8-bit operand to the program.
+static uint32_t sound_dmaEmit2(uint32_t at, uint8_t instruction,
+                               uint8_t operand) {
+  dmaProgram[at] = instruction;
+  dmaProgram[at + 1] = operand;
+  return at + 2;
+}
+
+// Appends DMAMOV of value to register.
+static uint32_t sound_dmaEmitMov(uint32_t at, uint8_t reg, uint32_t value) {
+  at = sound_dmaEmit2(at, DMA_MOV, reg);
+  for (uint16_t i = 0; i < sizeof(value); i++)
+    dmaProgram[at++] = value >> (8 * i); // Little endian.
+  return at;
+}
+
+// Writes the program: after setting up the channel, it loops forever over the
+// buffers, sending each word when the I2S controller requests it and
+// signalling DMA_EVENT after each buffer.
+static void sound_dmaWriteProgram() {
+  uint32_t at = sound_dmaEmitMov(0, DMA_MOV_CCR, DMA_CCR);
+  at = sound_dmaEmitMov(at, DMA_MOV_DAR, I2S_TX_FIFO_ADDRESS);
+  at = sound_dmaEmit2(at, DMA_FLUSHP, DMA_PERIPHERAL << 3);
+  uint32_t forever = at;
+  for (uint16_t i = 0; i < SOUND_DMA_BUFFER_COUNT; i++) {
+    at = sound_dmaEmitMov(at, DMA_MOV_SAR, (uint32_t)(UINTPTR)dmaBuffers[i]);
+    at = sound_dmaEmit2(at, DMA_LP(1), DMA_OUTER_LOOP - 1);
+    uint32_t outer = at;
+    at = sound_dmaEmit2(at, DMA_LP(0), DMA_INNER_LOOP - 1);
+    uint32_t inner = at;
+    at = sound_dmaEmit2(at, DMA_WFPS, DMA_PERIPHERAL << 3);
+    dmaProgram[at++] = DMA_LD;
+    at = sound_dmaEmit2(at, DMA_STPS, DMA_PERIPHERAL << 3);
+    at = sound_dmaEmit2(at, DMA_LPEND(0), at - inner); // Jumps back.
+    at = sound_dmaEmit2(at, DMA_LPEND(1), at - outer);
+    at = sound_dmaEmit2(at, DMA_SEV, DMA_EVENT << 3);
+  }
+  at = sound_dmaEmit2(at, DMA_LPFE, at - forever);
+  dmaProgram[at++] = DMA_END;
+  Xil_DCacheFlushRange((INTPTR)dmaProgram, sizeof(dmaProgram));
+}
+
+// DMA event interrupt: one per block. The driver's done handler only runs for
+// the first event of a program, so this clears the event itself.
+static void sound_dmaInterrupt(void *callbackRef) {
+  XDmaPs_WriteReg(XPAR_XDMAPS_0_BASEADDR, XDMAPS_INTCLR_OFFSET,
+                  1 << DMA_EVENT);
+  sound_dmaBlockSent();
+}
+#endif
+
+// Starts the transfers.
+void sound_dmaStart() {
+  running = true;
+#ifdef ZYBO_BOARD
+  sound_dmaWriteProgram();
+  XDmaPs_CfgInitialize(&dma, XDmaPs_LookupConfig(XPAR_XDMAPS_0_DEVICE_ID),
+                       XPAR_XDMAPS_0_BASEADDR);
+  memset(&dmaCommand, 0, sizeof(dmaCommand));
+  dmaCommand.UserDmaProg = dmaProgram;
+  dmaCommand.UserDmaProgLength = sizeof(dmaProgram);
+  // Connect the event interrupt to the GIC that interrupts_initAll() set up.
+  XScuGic_RegisterHandler(XPAR_SCUGIC_0_CPU_BASEADDR, DMA_DONE_INTERRUPT,
+                          (Xil_InterruptHandler)sound_dmaInterrupt, NULL);
+  XScuGic_EnableIntr(XPAR_SCUGIC_0_DIST_BASEADDR, DMA_DONE_INTERRUPT);
+  XDmaPs_WriteReg(XPAR_XDMAPS_0_BASEADDR, XDMAPS_INTEN_OFFSET,
+                  XDmaPs_ReadReg(XPAR_XDMAPS_0_BASEADDR, XDMAPS_INTEN_OFFSET) |
+                      1 << DMA_EVENT);
+  XDmaPs_Start(&dma, DMA_CHANNEL, &dmaCommand, 0);
+#endif
+}
+
+// Stops the transfers.
+void sound_dmaStop() {
+  running = false;
+#ifdef ZYBO_BOARD
+  XScuGic_DisableIntr(XPAR_SCUGIC_0_DIST_BASEADDR, DMA_DONE_INTERRUPT);
+  // DMAKILL, through the debug registers, ends the program.
+  while (XDmaPs_ReadReg(XPAR_XDMAPS_0_BASEADDR, XDMAPS_DBGSTATUS_OFFSET) &
+         XDMAPS_DBGSTATUS_BUSY)
+    ;
+  XDmaPs_WriteReg(XPAR_XDMAPS_0_BASEADDR, XDMAPS_DBGINST0_OFFSET,
+                  XDmaPs_DBGINST0(0, 0x01, DMA_CHANNEL, 1));
+  XDmaPs_WriteReg(XPAR_XDMAPS_0_BASEADDR, XDMAPS_DBGINST1_OFFSET, 0);
+  XDmaPs_WriteReg(XPAR_XDMAPS_0_BASEADDR, XDMAPS_DBGCMD_OFFSET, 0);
+#endif
+}
+
+// Returns the number of blocks sent since sound_dmaInit().
+uint32_t sound_dmaBlockCount() { return blockCount; }
+
+#ifndef ZYBO_BOARD
+// Copies the buffer that is being sent into words[] and refills it.
+bool sound_dmaSimulateBlock(uint32_t words[SOUND_DMA_BLOCK_WORDS]) {
+  if (!running)
+    return false;
+  memcpy(words, dmaBuffers[sendingBuffer], sizeof(dmaBuffers[sendingBuffer]));
+  sound_dmaBlockSent();
+  return true;
+}
+
+#define TEST_SOUND sound_gunClick_e // Plays gunEmpty48k_wav.
+#ifdef SOUND_ADPCM
+#define TEST_SAMPLE_COUNT GUNEMPTY48K_WAV_ADPCM_NUMBER_OF_SAMPLES
+// The sound decoded whole, to check the blocks decoded as it plays against.
+static uint16_t testSamples[TEST_SAMPLE_COUNT];
+#define TEST_SAMPLES testSamples
+#else
+#define TEST_SAMPLES gunEmpty48k_wav
+#define TEST_SAMPLE_COUNT GUNEMPTY48K_WAV_NUMBER_OF_SAMPLES
+#endif
+#define TEST_VOLUME sound_mediumHighVolume_e
+#define TEST_LATENCY_BLOCKS SOUND_DMA_BUFFER_COUNT // Rendered before the start.
+#define TEST_STOP_BLOCKS 3 // Blocks of the sound played before stopping it.
+
+// Returns the word that sample is sent as at TEST_VOLUME.
+static uint32_t sound_dmaTestWord(uint16_t sample) {
+#ifdef SOUND_MIXER
+  return ((int32_t)sample - SOUND_DMA_SAMPLE_ZERO) * (int32_t)TEST_VOLUME;
+#else
+  return sample * (uint32_t)TEST_VOLUME;
+#endif
+}
+
+// Sends a block and checks that it holds the samples of TEST_SAMPLES from
+// *sample on, then silence, the same in both channels. Advances *sample past
+// the samples that were sent. Returns true if it does.
+static bool sound_dmaTestBlock(uint32_t *sample) {
+  uint32_t words[SOUND_DMA_BLOCK_WORDS];
+  if (!sound_dmaSimulateBlock(words)) {
+    printf("sound_runDmaTest: block %lu was not sent.\n",
+           (unsigned long)sound_dmaBlockCount());
+    return false;
+  }
+  for (uint32_t i = 0; i < SOUND_DMA_BLOCK_WORDS; i++) {
+    uint32_t expected = 0; // Silence.
+    if (*sample + i / SOUND_DMA_WORDS_PER_FRAME < TEST_SAMPLE_COUNT)
+      expected = sound_dmaTestWord(
+          TEST_SAMPLES[*sample + i / SOUND_DMA_WORDS_PER_FRAME]);
+    if (words[i] != expected) {
+      printf("sound_runDmaTest: word %lu of block %lu is %lu, should be %lu.\n",
+             (unsigned long)i, (unsigned long)sound_dmaBlockCount() - 1,
+             (unsigned long)words[i], (unsigned long)expected);
+      return false;
+    }
+  }
+  *sample += SOUND_DMA_BLOCK_FRAMES;
+  return true;
+}
+
+// Checks the simulated transfers: nothing is sent until they start; a sound
+// starts TEST_LATENCY_BLOCKS blocks after sound_startSound(), plays every
+// sample at the volume in both channels, and is followed by silence;
+// sound_isBusy() is false once it has been rendered; a stopped sound is silent
+// from the next block rendered. Returns true if the test passes. Leaves the
+// transfers stopped.
+bool sound_runDmaTest() {
+  bool success = true; // Be optimistic.
+  uint32_t words[SOUND_DMA_BLOCK_WORDS];
+  uint32_t silence = TEST_SAMPLE_COUNT; // Past the end: expect silence.
+#ifdef SOUND_ADPCM
+  sound_adpcmDecoder_t decoder;
+  sound_adpcmStart(&decoder, gunEmpty48k_wav_adpcm, TEST_SAMPLE_COUNT);
+  sound_adpcmDecode(&decoder, testSamples, TEST_SAMPLE_COUNT);
+#endif
+  sound_init();
+  sound_setVolume(TEST_VOLUME);
+  sound_setSound(TEST_SOUND);
+  if (sound_dmaSimulateBlock(words)) {
+    printf("sound_runDmaTest: a block was sent before sound_dmaStart().\n");
+    success = false;
+  }
+  sound_dmaStart();
+  sound_startSound();
+  // The buffers were rendered silent before the sound started.
+  for (uint16_t i = 0; i < TEST_LATENCY_BLOCKS; i++)
+    success &= sound_dmaTestBlock(&silence);
+  uint32_t sample = 0;
+  while (success && sample < TEST_SAMPLE_COUNT)
+    success &= sound_dmaTestBlock(&sample);
+  if (sound_isBusy()) {
+    printf("sound_runDmaTest: busy after the sound was sent.\n");
+    success = false;
+  }
+  success &= sound_dmaTestBlock(&silence);
+
+  // Stop the sound partway: the blocks already rendered are still sent.
+  sound_startSound();
+  for (uint16_t i = 0; i < TEST_LATENCY_BLOCKS; i++)
+    success &= sound_dmaTestBlock(&silence);
+  sample = 0;
+  for (uint16_t i = 0; i < TEST_STOP_BLOCKS; i++)
+    success &= sound_dmaTestBlock(&sample);
+  sound_stopSound();
+  for (uint16_t i = 0; i < TEST_LATENCY_BLOCKS; i++)
+    success &= sound_dmaTestBlock(&sample);
+  success &= sound_dmaTestBlock(&silence);
+  // Each sound followed the latency and was followed by a silent block.
+  uint32_t soundBlocks = (TEST_SAMPLE_COUNT + SOUND_DMA_BLOCK_FRAMES - 1) /
+                         SOUND_DMA_BLOCK_FRAMES;
+  uint32_t expectedCount = 2 * (TEST_LATENCY_BLOCKS + 1) + soundBlocks +
+                           TEST_STOP_BLOCKS + TEST_LATENCY_BLOCKS;
+  if (sound_dmaBlockCount() != expectedCount) {
+    printf("sound_runDmaTest: %lu blocks sent, should be %lu.\n",
+           (unsigned long)sound_dmaBlockCount(), (unsigned long)expectedCount);
+    success = false;
+  }
+  sound_dmaStop();
+  if (sound_dmaSimulateBlock(words)) {
+    printf("sound_runDmaTest: a block was sent after sound_dmaStop().\n");
+    success = false;
+  }
+  printf("sound_runDmaTest %s.\n", success ? "passed" : "failed");
+  return success;
+}
+#endif
@@ -0,0 +1,73 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SOUNDDMA_H_
+#define SOUNDDMA_H_
+
+// DMA-fed audio output (build with SOUND_DMA). Instead of sound_tick() polling
+// the I2S TX FIFO and writing each sample into it, the I2S controller is fed
+// from two ping-pong buffers of SOUND_DMA_BLOCK_FRAMES frames (left and right
+// words) each. While one is being sent, the other holds the next block. When a
+// buffer has been sent, one interrupt refills it with sound_renderBlock()
+// (sound.h), which advances the current sound, or writes silence when there is
+// none. sound_tick() does nothing, the transfers never stop between sounds, and
+// a sound starts within two blocks (10.7 ms) of sound_startSound().
+//
+// On the board, a PS DMA controller channel runs a program that loops over both
+// buffers forever, waiting on the I2S controller's TX request (DMA0_REQ in
+// platforms/hw) before each word, and signals its done interrupt at the end of
+// each buffer. The refill only has to finish within one block, instead of
+// within the 8-word FIFO.
+//
+// The emulator and the host tools have neither, so sound_dmaSimulateBlock()
+// "sends" the next buffer and raises the interrupt itself. tools/soundRender
+// writes what it sends to a WAV file.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SOUND_DMA_SAMPLE_RATE 48000 // The codec rate set in sound_init().
+#define SOUND_DMA_BLOCK_FRAMES 256  // 5.3 ms, one interrupt per block.
+#define SOUND_DMA_WORDS_PER_FRAME 2 // Left, then right.
+#define SOUND_DMA_BLOCK_WORDS                                                  \
+  (SOUND_DMA_BLOCK_FRAMES * SOUND_DMA_WORDS_PER_FRAME)
+#define SOUND_DMA_BUFFER_COUNT 2 // Ping-pong.
+// Silence in an offset-binary sample, as the mixer centers them and the
+// IMA-ADPCM decoder writes them. The 16-bit assets are signed + INT16_MAX, one
+// below, which is not audible.
+#define SOUND_DMA_SAMPLE_ZERO 0x8000
+
+// Renders both buffers and resets the block count. Call from sound_init(),
+// after the sound state is initialized.
+void sound_dmaInit();
+
+// Starts the transfers. On the board, also sets up the DMA controller and
+// connects its done interrupt, so call after interrupts_initAll(), which sets
+// up the GIC, and after the I2S controller is set up and its TX FIFO enabled.
+void sound_dmaStart();
+
+// Stops the transfers.
+void sound_dmaStop();
+
+// Returns the number of blocks sent since sound_dmaInit().
+uint32_t sound_dmaBlockCount();
+
+#ifndef ZYBO_BOARD
+// Simulated transfer: copies the buffer that is being sent into
+// words[SOUND_DMA_BLOCK_WORDS], then refills it as the done interrupt does.
+// Returns false and does nothing unless the transfers are started.
+bool sound_dmaSimulateBlock(uint32_t words[SOUND_DMA_BLOCK_WORDS]);
+
+// Plays a sound, and stops one partway, through the simulated transfers and
+// checks every word sent and when the sound starts and ends. Returns true if
+// the test passes. Leaves the transfers stopped.
+bool sound_runDmaTest();
+#endif
+
+#endif /* SOUNDDMA_H_ */
@@ -0,0 +1,458 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Multi-voice mixer. See soundMixer.h.
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif
+
+#include "detectorProfile.h"
+#include "soundDma.h"
+#include "soundMixer.h"
+#ifdef SOUND_ADPCM
+#include "soundAdpcm.h"
+#endif
+#ifdef SOUND_RESAMPLE
+#include "soundResample.h"
+#endif
+
+#define CHUNK_FRAMES SOUND_DMA_BLOCK_FRAMES // Mixed at a time.
+#define NEON_FRAMES 8                       // Samples per NEON iteration.
+#ifdef SOUND_RESAMPLE
+// A chunk of frames reads up to this many samples.
+#define CHUNK_SAMPLES (CHUNK_FRAMES + SOUND_RESAMPLE_EXTRA_SAMPLES)
+#else
+#define CHUNK_SAMPLES CHUNK_FRAMES
+#endif
+
+typedef struct {
+  const uint16_t *samples; // The next sample to read.
+#ifdef SOUND_ADPCM
+  bool adpcm; // Decoded from decoder instead of read from samples.
+  sound_adpcmDecoder_t decoder;
+#endif
+#ifdef SOUND_RESAMPLE
+  bool resample; // Stored below the codec rate, converted by resampler.
+  sound_resampler_t resampler;
+#endif
+  uint32_t frameCount; // At the codec rate.
+  uint32_t position;   // The next frame to mix.
+  int16_t volume;
+  uint8_t priority;
+  uint32_t startNumber; // Orders the voices by age.
+  volatile bool active; // Set last: the interrupt only mixes active voices.
+} sound_mixerVoice_t;
+
+static sound_mixerVoice_t voices[SOUND_MIXER_VOICE_COUNT];
+static int32_t mixBuffer[CHUNK_FRAMES];
+#ifdef SOUND_ADPCM
+static uint16_t decodeBuffer[CHUNK_SAMPLES]; // A voice's decoded samples.
+#endif
+#ifdef SOUND_RESAMPLE
+static uint16_t resampleBuffer[CHUNK_FRAMES]; // A voice's converted frames.
+#endif
+static sound_mixerStats_t stats;
+
+// Stops every voice and clears the statistics.
+void sound_mixerInit() {
+  sound_mixerStopAll();
+  memset(&stats, 0, sizeof(stats));
+}
+
+// Returns the voice for a new sound of priority: a free one or else the one to
+// steal. Returns SOUND_MIXER_NO_VOICE if every voice plays a sound of higher
+// priority.
+static int16_t sound_mixerFindVoice(uint8_t priority) {
+  int16_t victim = SOUND_MIXER_NO_VOICE;
+  for (int16_t v = 0; v < SOUND_MIXER_VOICE_COUNT; v++) {
+    if (!voices[v].active)
+      return v;
+    if (voices[v].priority > priority)
+      continue;
+    if (victim == SOUND_MIXER_NO_VOICE ||
+        voices[v].priority < voices[victim].priority ||
+        (voices[v].priority == voices[victim].priority &&
+         voices[v].startNumber < voices[victim].startNumber))
+      victim = v;
+  }
+  if (victim != SOUND_MIXER_NO_VOICE)
+    stats.stolenCount++;
+  return victim;
+}
+
+// Takes a voice for a sound of priority and sets it up, inactive, for
+// sampleCount samples at sampleRate. Returns the voice or
+// SOUND_MIXER_NO_VOICE.
+static int16_t sound_mixerSetUpVoice(uint32_t sampleCount, uint32_t sampleRate,
+                                     uint16_t volume, uint8_t priority) {
+  int16_t v = sound_mixerFindVoice(priority);
+  if (v == SOUND_MIXER_NO_VOICE) {
+    stats.droppedCount++;
+    return SOUND_MIXER_NO_VOICE;
+  }
+  sound_mixerVoice_t *voice = &voices[v];
+  voice->active = false; // Taken from the interrupt while it is set up.
+  voice->frameCount = sampleCount;
+#ifdef SOUND_RESAMPLE
+  voice->resample = sampleRate != SOUND_DMA_SAMPLE_RATE;
+  if (voice->resample) {
+    sound_resampleStart(&voice->resampler, sampleRate);
+    voice->frameCount = sound_resampleFrameCount(sampleCount, sampleRate);
+  }
+#else
+  (void)sampleRate; // Played at the codec rate.
+#endif
+  voice->position = 0;
+  voice->volume = volume > INT16_MAX ? INT16_MAX : volume;
+  voice->priority = priority;
+  voice->startNumber = stats.startCount++;
+  return v;
+}
+
+// Starts the samples on a voice. Returns the voice or SOUND_MIXER_NO_VOICE.
+int16_t sound_mixerPlay(const uint16_t samples[], uint32_t sampleCount,
+                        uint32_t sampleRate, uint16_t volume,
+                        uint8_t priority) {
+  int16_t v = sound_mixerSetUpVoice(sampleCount, sampleRate, volume, priority);
+  if (v == SOUND_MIXER_NO_VOICE)
+    return SOUND_MIXER_NO_VOICE;
+  voices[v].samples = samples;
+#ifdef SOUND_ADPCM
+  voices[v].adpcm = false;
+#endif
+  voices[v].active = voices[v].frameCount > 0;
+  return v;
+}
+
+#ifdef SOUND_ADPCM
+// Starts the encoded samples on a voice. Returns the voice or
+// SOUND_MIXER_NO_VOICE.
+int16_t sound_mixerPlayAdpcm(const uint8_t data[], uint32_t sampleCount,
+                             uint32_t sampleRate, uint16_t volume,
+                             uint8_t priority) {
+  int16_t v = sound_mixerSetUpVoice(sampleCount, sampleRate, volume, priority);
+  if (v == SOUND_MIXER_NO_VOICE)
+    return SOUND_MIXER_NO_VOICE;
+  voices[v].adpcm = true;
+  sound_adpcmStart(&voices[v].decoder, data, sampleCount);
+  voices[v].active = voices[v].frameCount > 0;
+  return v;
+}
+#endif
+
+// Stops voice.
+void sound_mixerStop(int16_t voice) {
+  if (voice >= 0 && voice < SOUND_MIXER_VOICE_COUNT)
+    voices[voice].active = false;
+}
+
+// Stops every voice.
+void sound_mixerStopAll() {
+  for (int16_t v = 0; v < SOUND_MIXER_VOICE_COUNT; v++)
+    voices[v].active = false;
+}
+
+// Returns the number of voices playing.
+uint16_t sound_mixerActiveCount() {
+  uint16_t count = 0;
+  for (int16_t v = 0; v < SOUND_MIXER_VOICE_COUNT; v++)
+    count += voices[v].active;
+  return count;
+}
+
+// Adds the centered samples, scaled by volume, into mix[], saturating.
+static void sound_mixerAddVoice(int32_t mix[], const uint16_t samples[],
+                                uint32_t count, int16_t volume) {
+  uint32_t i = 0;
+#ifdef __ARM_NEON
+  const uint16x8_t zero = vdupq_n_u16(SOUND_DMA_SAMPLE_ZERO);
+  for (; i + NEON_FRAMES <= count; i += NEON_FRAMES) {
+    // Flipping the top bit centers an offset-binary sample.
+    int16x8_t centered =
+        vreinterpretq_s16_u16(veorq_u16(vld1q_u16(&samples[i]), zero));
+    int32x4_t low = vmull_n_s16(vget_low_s16(centered), volume);
+    int32x4_t high = vmull_n_s16(vget_high_s16(centered), volume);
+    vst1q_s32(&mix[i], vqaddq_s32(vld1q_s32(&mix[i]), low));
+    vst1q_s32(&mix[i + 4], vqaddq_s32(vld1q_s32(&mix[i + 4]), high));
+  }
+#endif
+  // Portable version; also handles the samples left over from NEON.
+  for (; i < count; i++) {
+    int64_t sum = (int64_t)mix[i] +
+                  ((int32_t)samples[i] - SOUND_DMA_SAMPLE_ZERO) * volume;
+    mix[i] = sum > INT32_MAX ? INT32_MAX : sum < INT32_MIN ? INT32_MIN : sum;
+  }
+}
+
+// Returns the next count samples of voice, decoded if it is encoded, and
+// advances it past them.
+static const uint16_t *sound_mixerReadSamples(sound_mixerVoice_t *voice,
+                                              uint32_t count) {
+#ifdef SOUND_ADPCM
+  if (voice->adpcm) {
+    sound_adpcmDecode(&voice->decoder, decodeBuffer, count);
+    return decodeBuffer;
+  }
+#endif
+  const uint16_t *samples = voice->samples;
+  voice->samples += count;
+  return samples;
+}
+
+// Returns the next count frames of voice, converted to the codec rate if it is
+// stored below it.
+static const uint16_t *sound_mixerNextFrames(sound_mixerVoice_t *voice,
+                                             uint32_t count) {
+#ifdef SOUND_RESAMPLE
+  if (voice->resample) {
+    const uint16_t *samples = sound_mixerReadSamples(
+        voice, sound_resampleSampleCount(&voice->resampler, count));
+    sound_resample(&voice->resampler, samples, resampleBuffer, count);
+    return resampleBuffer;
+  }
+#endif
+  return sound_mixerReadSamples(voice, count);
+}
+
+// Mixes up to CHUNK_FRAMES frames into words[]. Returns the voices mixed.
+static uint16_t sound_mixerRenderChunk(uint32_t words[], uint32_t frameCount) {
+  uint16_t activeCount = 0;
+  memset(mixBuffer, 0, frameCount * sizeof(mixBuffer[0]));
+  for (int16_t v = 0; v < SOUND_MIXER_VOICE_COUNT; v++) {
+    sound_mixerVoice_t *voice = &voices[v];
+    if (!voice->active)
+      continue;
+    activeCount++;
+    uint32_t count = voice->frameCount - voice->position;
+    if (count > frameCount)
+      count = frameCount;
+    sound_mixerAddVoice(mixBuffer, sound_mixerNextFrames(voice, count), count,
+                        voice->volume);
+    voice->position += count;
+    if (voice->position == voice->frameCount)
+      voice->active = false; // All done.
+  }
+  for (uint32_t i = 0; i < frameCount; i++) {
+    words[2 * i] = mixBuffer[i];     // Left channel.
+    words[2 * i + 1] = mixBuffer[i]; // Right channel.
+  }
+  return activeCount;
+}
+
+// Mixes the next frameCount frames of every voice into words[].
+void sound_mixerRender(uint32_t words[], uint32_t frameCount) {
+  uint32_t startCycles = detectorProfile_readCycles();
+  uint16_t activeCount = 0;
+  for (uint32_t frame = 0; frame < frameCount; frame += CHUNK_FRAMES) {
+    uint32_t count = frameCount - frame;
+    if (count > CHUNK_FRAMES)
+      count = CHUNK_FRAMES;
+    uint16_t chunkActive = sound_mixerRenderChunk(
+        &words[SOUND_DMA_WORDS_PER_FRAME * frame], count);
+    if (chunkActive > activeCount)
+      activeCount = chunkActive;
+  }
+  uint32_t cycles = detectorProfile_readCycles() - startCycles;
+  stats.blockCount++;
+  stats.frameCount += frameCount;
+  if (activeCount > stats.maxActive)
+    stats.maxActive = activeCount;
+  stats.totalCycles += cycles;
+  if (cycles > stats.maxCycles)
+    stats.maxCycles = cycles;
+}
+
+// Fills in *stats.
+void sound_mixerGetStats(sound_mixerStats_t *statsOut) { *statsOut = stats; }
+
+// Prints the statistics on the console.
+void sound_mixerPrintStats() {
+  printf("Sound mixer: %lu started, %lu stolen, %lu dropped, at most %lu of "
+         "%d voices.\n",
+         (unsigned long)stats.startCount, (unsigned long)stats.stolenCount,
+         (unsigned long)stats.droppedCount, (unsigned long)stats.maxActive,
+         SOUND_MIXER_VOICE_COUNT);
+  if (stats.blockCount == 0)
+    return;
+  double seconds = (double)stats.frameCount / SOUND_DMA_SAMPLE_RATE;
+  printf("Mixing: %lu blocks, %.1f cycles per block (max %lu), %.0f cycles "
+         "per second of sound.\n",
+         (unsigned long)stats.blockCount,
+         (double)stats.totalCycles / stats.blockCount,
+         (unsigned long)stats.maxCycles, stats.totalCycles / seconds);
+}
+
+#define TEST_SAMPLE_COUNT 100 // Not a multiple of NEON_FRAMES.
+#define TEST_FRAMES 64        // Frames per test block.
+#define TEST_RATE SOUND_DMA_SAMPLE_RATE
+#define TEST_VOLUME 1000
+#define TEST_LOW_PRIORITY 1
+#define TEST_HIGH_PRIORITY 2
+#define TEST_LOW_RATE 16000 // With SOUND_RESAMPLE.
+
+static uint16_t testRamp[TEST_SAMPLE_COUNT];
+static uint16_t testLoud[TEST_SAMPLE_COUNT];  // Full scale, positive.
+static uint16_t testQuiet[TEST_SAMPLE_COUNT]; // Full scale, negative.
+#ifdef SOUND_RESAMPLE
+// The ramp at TEST_LOW_RATE, converted.
+static uint16_t testConverted[TEST_SAMPLE_COUNT * SOUND_DMA_SAMPLE_RATE /
+                              TEST_LOW_RATE];
+static uint32_t testConvertedCount;
+#endif
+
+// Mixes a test block and checks that each word is expected(frame) in both
+// channels. Returns true if they are.
+static bool sound_mixerTestBlock(const char *name,
+                                 int32_t (*expected)(uint32_t frame),
+                                 uint32_t *frame) {
+  uint32_t words[TEST_FRAMES * SOUND_DMA_WORDS_PER_FRAME];
+  sound_mixerRender(words, TEST_FRAMES);
+  for (uint32_t i = 0; i < TEST_FRAMES; i++, (*frame)++) {
+    int32_t want = expected(*frame);
+    if ((int32_t)words[2 * i] != want || (int32_t)words[2 * i + 1] != want) {
+      printf("sound_runMixerTest (%s): frame %lu is %ld, %ld; should be %ld.\n",
+             name, (unsigned long)*frame, (long)(int32_t)words[2 * i],
+             (long)(int32_t)words[2 * i + 1], (long)want);
+      return false;
+    }
+  }
+  return true;
+}
+
+// The ramp, centered and scaled, for one voice or two.
+static int32_t sound_mixerTestRamp(uint32_t frame) {
+  if (frame >= TEST_SAMPLE_COUNT)
+    return 0;
+  return ((int32_t)testRamp[frame] - SOUND_DMA_SAMPLE_ZERO) * TEST_VOLUME;
+}
+static int32_t sound_mixerTestTwoRamps(uint32_t frame) {
+  return 2 * sound_mixerTestRamp(frame);
+}
+#ifdef SOUND_RESAMPLE
+static int32_t sound_mixerTestConverted(uint32_t frame) {
+  if (frame >= testConvertedCount)
+    return 0;
+  return ((int32_t)testConverted[frame] - SOUND_DMA_SAMPLE_ZERO) *
+         TEST_VOLUME;
+}
+#endif
+// Four loud voices at full volume saturate, then the quiet ones do.
+static int32_t sound_mixerTestLoud(uint32_t frame) {
+  return frame < TEST_SAMPLE_COUNT ? INT32_MAX : 0;
+}
+static int32_t sound_mixerTestQuiet(uint32_t frame) {
+  return frame < TEST_SAMPLE_COUNT ? INT32_MIN : 0;
+}
+
+// Checks the mixing, saturation, voice stealing and the statistics.
+bool sound_runMixerTest() {
+  bool success = true; // Be optimistic.
+  for (uint32_t i = 0; i < TEST_SAMPLE_COUNT; i++) {
+    testRamp[i] = SOUND_DMA_SAMPLE_ZERO + 300 * i - 15000;
+    testLoud[i] = UINT16_MAX;
+    testQuiet[i] = 0;
+  }
+  uint32_t frame;
+
+  // One voice, then two at once: the sum of each.
+  sound_mixerInit();
+  sound_mixerPlay(testRamp, TEST_SAMPLE_COUNT, TEST_RATE, TEST_VOLUME,
+                  TEST_LOW_PRIORITY);
+  for (frame = 0; success && frame < 2 * TEST_SAMPLE_COUNT;)
+    success &= sound_mixerTestBlock("one voice", sound_mixerTestRamp, &frame);
+  for (int16_t v = 0; v < 2; v++)
+    sound_mixerPlay(testRamp, TEST_SAMPLE_COUNT, TEST_RATE, TEST_VOLUME,
+                    TEST_LOW_PRIORITY);
+  for (frame = 0; success && frame < 2 * TEST_SAMPLE_COUNT;)
+    success &= sound_mixerTestBlock("two voices", sound_mixerTestTwoRamps,
+                                    &frame);
+  if (sound_mixerActiveCount() != 0) {
+    printf("sound_runMixerTest: %d voices still playing.\n",
+           sound_mixerActiveCount());
+    success = false;
+  }
+#ifdef SOUND_RESAMPLE
+  // A sound stored at a lower rate is mixed as sound_resample() converts it.
+  sound_resampler_t resampler;
+  sound_resampleStart(&resampler, TEST_LOW_RATE);
+  testConvertedCount =
+      sound_resampleFrameCount(TEST_SAMPLE_COUNT, TEST_LOW_RATE);
+  sound_resample(&resampler, testRamp, testConverted, testConvertedCount);
+  sound_mixerPlay(testRamp, TEST_SAMPLE_COUNT, TEST_LOW_RATE, TEST_VOLUME,
+                  TEST_LOW_PRIORITY);
+  for (frame = 0; success && frame < testConvertedCount + TEST_FRAMES;)
+    success &= sound_mixerTestBlock("converted", sound_mixerTestConverted,
+                                    &frame);
+#endif
+
+  // Every voice at full scale saturates instead of wrapping.
+  for (int16_t v = 0; v < SOUND_MIXER_VOICE_COUNT; v++)
+    sound_mixerPlay(testLoud, TEST_SAMPLE_COUNT, TEST_RATE, INT16_MAX,
+                    TEST_LOW_PRIORITY);
+  for (frame = 0; success && frame < 2 * TEST_SAMPLE_COUNT;)
+    success &= sound_mixerTestBlock("loud", sound_mixerTestLoud, &frame);
+  for (int16_t v = 0; v < SOUND_MIXER_VOICE_COUNT; v++)
+    sound_mixerPlay(testQuiet, TEST_SAMPLE_COUNT, TEST_RATE, INT16_MAX,
+                    TEST_LOW_PRIORITY);
+  for (frame = 0; success && frame < 2 * TEST_SAMPLE_COUNT;)
+    success &= sound_mixerTestBlock("quiet", sound_mixerTestQuiet, &frame);
+
+  // With every voice busy, a sound of the same priority takes the oldest voice
+  // and a sound of lower priority is dropped. A higher priority sound then
+  // takes the voice of a low-priority one, and can't be taken by them.
+  sound_mixerInit();
+  for (int16_t v = 0; v < SOUND_MIXER_VOICE_COUNT; v++)
+    sound_mixerPlay(testRamp, TEST_SAMPLE_COUNT, TEST_RATE, TEST_VOLUME,
+                    TEST_LOW_PRIORITY);
+  int16_t stolen = sound_mixerPlay(testRamp, TEST_SAMPLE_COUNT, TEST_RATE,
+                                   TEST_VOLUME, TEST_LOW_PRIORITY);
+  int16_t dropped = sound_mixerPlay(testRamp, TEST_SAMPLE_COUNT, TEST_RATE,
+                                    TEST_VOLUME, TEST_LOW_PRIORITY - 1);
+  int16_t high = sound_mixerPlay(testRamp, TEST_SAMPLE_COUNT, TEST_RATE,
+                                 TEST_VOLUME, TEST_HIGH_PRIORITY);
+  for (int16_t v = 0; v < SOUND_MIXER_VOICE_COUNT; v++)
+    sound_mixerPlay(testRamp, TEST_SAMPLE_COUNT, TEST_RATE, TEST_VOLUME,
+                    TEST_LOW_PRIORITY);
+  if (stolen != 0 || dropped != SOUND_MIXER_NO_VOICE || high != 1 ||
+      voices[high].priority != TEST_HIGH_PRIORITY) {
+    printf("sound_runMixerTest: voices %d, %d, %d (priority %d); should be 0, "
+           "%d, 1 (priority %d).\n",
+           stolen, dropped, high, voices[high].priority, SOUND_MIXER_NO_VOICE,
+           TEST_HIGH_PRIORITY);
+    success = false;
+  }
+  sound_mixerStats_t testStats;
+  sound_mixerGetStats(&testStats);
+  uint32_t stealCount = 1 + 1 + SOUND_MIXER_VOICE_COUNT;
+  if (testStats.startCount != SOUND_MIXER_VOICE_COUNT + stealCount ||
+      testStats.stolenCount != stealCount || testStats.droppedCount != 1) {
+    printf("sound_runMixerTest: %lu started, %lu stolen, %lu dropped; should "
+           "be %lu, %lu, 1.\n",
+           (unsigned long)testStats.startCount,
+           (unsigned long)testStats.stolenCount,
+           (unsigned long)testStats.droppedCount,
+           (unsigned long)(SOUND_MIXER_VOICE_COUNT + stealCount),
+           (unsigned long)stealCount);
+    success = false;
+  }
+  sound_mixerStop(high);
+  if (sound_mixerActiveCount() != SOUND_MIXER_VOICE_COUNT - 1) {
+    printf("sound_runMixerTest: %d voices playing after a stop, should be "
+           "%d.\n",
+           sound_mixerActiveCount(), SOUND_MIXER_VOICE_COUNT - 1);
+    success = false;
+  }
+  sound_mixerInit();
+  printf("sound_runMixerTest %s.\n", success ? "passed" : "failed");
+  return success;
+}
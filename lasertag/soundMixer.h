@@ -0,0 +1,105 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SOUNDMIXER_H_
+#define SOUNDMIXER_H_
+
+// Multi-voice mixer (build with SOUND_MIXER, which requires SOUND_DMA). Sounds
+// no longer cut each other off: sound_startSound() gives the sound a voice of
+// its own, at the volume set when it starts and with the priority of the sound
+// (see sound_setSound()). sound_renderBlock() mixes every playing voice into
+// the block; sound_isBusy() is true while any voice plays and
+// sound_stopSound() stops them all.
+//
+// Each voice's samples are centered (the assets are offset binary), scaled by
+// its volume and added into a block of 32-bit sums that saturate instead of
+// wrapping, one voice at a time. With NEON (cmake -DFILTER_NEON=1), eight
+// samples go through each iteration; the scalar loop does the rest. Silence is
+// 0, the level the sounds are centered on, so unlike the single-voice output
+// there is no step when a sound starts or ends.
+//
+// When every voice is busy, a new sound takes the voice of the lowest-priority
+// sound, the oldest among equals, if that priority is no higher than its own.
+// Otherwise it is dropped. sound_mixerGetStats() counts both, along with the
+// time spent mixing.
+//
+// With SOUND_ADPCM, sound_mixerPlayAdpcm() plays an IMA-ADPCM asset (see
+// soundAdpcm.h), which its voice decodes a chunk at a time before mixing it.
+// With SOUND_RESAMPLE, a voice converts a sound stored below the codec rate to
+// it, after decoding and before mixing (see soundResample.h).
+//
+// sound_mixerPlay() and sound_mixerStop...() run in the main loop and
+// sound_mixerRender() in the DMA interrupt. A voice is only marked active once
+// it is set up, and the interrupt only sees whole voices.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SOUND_MIXER_VOICE_COUNT 4
+#define SOUND_MIXER_NO_VOICE -1 // Returned when a sound is dropped.
+
+// Mixer statistics since sound_mixerInit(). The cycles are CPU clock cycles on
+// the board, once detectorProfile_startCounters() has started the counter, and
+// nanoseconds elsewhere.
+typedef struct {
+  uint32_t startCount;   // Sounds given a voice, including stolen ones.
+  uint32_t stolenCount;  // Sounds that took the voice of another.
+  uint32_t droppedCount; // Sounds that found no voice.
+  uint32_t blockCount;   // Calls to sound_mixerRender().
+  uint32_t frameCount;   // Frames mixed.
+  uint32_t maxActive;    // Most voices mixed into one block.
+  uint64_t totalCycles;  // In sound_mixerRender().
+  uint32_t maxCycles;    // The longest sound_mixerRender().
+} sound_mixerStats_t;
+
+// Stops every voice and clears the statistics.
+void sound_mixerInit();
+
+// Starts sampleCount offset-binary samples, stored at sampleRate, on a voice at
+// volume (up to INT16_MAX) and priority. Without SOUND_RESAMPLE, every sound
+// plays at SOUND_DMA_SAMPLE_RATE. Returns the voice number, or
+// SOUND_MIXER_NO_VOICE if the sound was dropped.
+int16_t sound_mixerPlay(const uint16_t samples[], uint32_t sampleCount,
+                        uint32_t sampleRate, uint16_t volume,
+                        uint8_t priority);
+
+#ifdef SOUND_ADPCM
+// Starts the sampleCount samples IMA-ADPCM encoded in data[] on a voice, as
+// sound_mixerPlay() does.
+int16_t sound_mixerPlayAdpcm(const uint8_t data[], uint32_t sampleCount,
+                             uint32_t sampleRate, uint16_t volume,
+                             uint8_t priority);
+#endif
+
+// Stops voice.
+void sound_mixerStop(int16_t voice);
+
+// Stops every voice.
+void sound_mixerStopAll();
+
+// Returns the number of voices playing.
+uint16_t sound_mixerActiveCount();
+
+// Mixes the next frameCount frames of every voice into words[], two words per
+// frame (left, then right, the same), and advances the voices. A voice stops
+// after its last sample.
+void sound_mixerRender(uint32_t words[], uint32_t frameCount);
+
+// Fills in *stats.
+void sound_mixerGetStats(sound_mixerStats_t *stats);
+
+// Prints the statistics on the console.
+void sound_mixerPrintStats();
+
+// Checks the mixing, saturation, voice stealing and the statistics against
+// synthetic sounds. Call while the transfers are stopped. Leaves the mixer
+// initialized. Returns true if the test passes.
+bool sound_runMixerTest();
+
+#endif /* SOUNDMIXER_H_ */
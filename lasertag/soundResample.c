@@ -0,0 +1,206 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Sample-rate conversion by linear interpolation. See soundResample.h.
+
+#include <math.h>
+#include <stdio.h>
+
+#include "detectorProfile.h"
+#include "soundDma.h"
+#include "soundResample.h"
+
+#define POSITION_ONE (1UL << SOUND_RESAMPLE_FRACTION_BITS) // One sample.
+// The weight of the next sample has 15 bits, so that its product with the
+// difference of two 16-bit samples fits in 32 bits.
+#define WEIGHT_BITS 15
+#define WEIGHT_SHIFT (SOUND_RESAMPLE_FRACTION_BITS - WEIGHT_BITS)
+
+// Returns the step for sampleRate, rounded.
+static uint32_t sound_resampleStep(uint32_t sampleRate) {
+  if (sampleRate > SOUND_DMA_SAMPLE_RATE)
+    sampleRate = SOUND_DMA_SAMPLE_RATE;
+  return ((uint64_t)sampleRate * POSITION_ONE + SOUND_DMA_SAMPLE_RATE / 2) /
+         SOUND_DMA_SAMPLE_RATE;
+}
+
+// Returns the frames before the last sample.
+uint32_t sound_resampleFrameCount(uint32_t sampleCount, uint32_t sampleRate) {
+  uint32_t step = sound_resampleStep(sampleRate);
+  if (sampleCount < 2 || step == 0)
+    return 0;
+  // Frame k reads up to sample floor(k * step) + 1.
+  return ((uint64_t)(sampleCount - 1) * POSITION_ONE + step - 1) / step;
+}
+
+// Starts converting a sound stored at sampleRate.
+void sound_resampleStart(sound_resampler_t *resampler, uint32_t sampleRate) {
+  if (sampleRate > SOUND_DMA_SAMPLE_RATE)
+    printf("ERROR, sound_resampleStart: %lu Hz is above %d Hz; playing it at "
+           "%d Hz.\n",
+           (unsigned long)sampleRate, SOUND_DMA_SAMPLE_RATE,
+           SOUND_DMA_SAMPLE_RATE);
+  resampler->step = sound_resampleStep(sampleRate);
+  resampler->position = 2 * POSITION_ONE; // Both samples are read first.
+  resampler->previous = 0;
+  resampler->next = 0;
+}
+
+// Returns the samples the next frameCount frames read.
+uint32_t sound_resampleSampleCount(const sound_resampler_t *resampler,
+                                   uint32_t frameCount) {
+  if (frameCount == 0)
+    return 0;
+  uint64_t last =
+      resampler->position + (uint64_t)(frameCount - 1) * resampler->step;
+  return last >> SOUND_RESAMPLE_FRACTION_BITS;
+}
+
+// Renders the next frameCount frames from samples[].
+void sound_resample(sound_resampler_t *resampler, const uint16_t samples[],
+                    uint16_t frames[], uint32_t frameCount) {
+  uint32_t step = resampler->step;
+  uint32_t position = resampler->position;
+  int32_t previous = resampler->previous;
+  int32_t next = resampler->next;
+  for (uint32_t i = 0; i < frameCount; i++) {
+    while (position >= POSITION_ONE) {
+      previous = next;
+      next = *samples++;
+      position -= POSITION_ONE;
+    }
+    int32_t weight = position >> WEIGHT_SHIFT;
+    frames[i] = previous + (((next - previous) * weight) >> WEIGHT_BITS);
+    position += step;
+  }
+  resampler->position = position;
+  resampler->previous = previous;
+  resampler->next = next;
+}
+
+#define TEST_RATE 16000
+#define TEST_ZERO SOUND_DMA_SAMPLE_ZERO // Silence, offset binary.
+#define TEST_RAMP_SAMPLES 1000
+#define TEST_RAMP_SLOPE 30 // Per sample, from TEST_ZERO - TEST_RAMP_START.
+#define TEST_RAMP_START 15000
+#define TEST_RAMP_FRAMES 2998 // Before the last sample, at TEST_RATE.
+#define TEST_PIECE_SIZES {1, 7, 256, TEST_RAMP_FRAMES}
+#define TEST_TONE_SAMPLES TEST_RATE // One second.
+#define TEST_TONE_FREQUENCY 1000.0
+#define TEST_AMPLITUDE 12000.0
+#define TEST_MIN_SNR_DB 35.0
+
+static uint16_t testRamp[TEST_RAMP_SAMPLES];
+static uint16_t testFrames[TEST_RAMP_FRAMES];
+static uint16_t testPieces[TEST_RAMP_FRAMES];
+static uint16_t testTone[TEST_TONE_SAMPLES];
+
+// Converts a ramp and a tone and checks the result.
+bool sound_runResampleTest() {
+  bool success = true; // Be optimistic.
+  for (uint32_t i = 0; i < TEST_RAMP_SAMPLES; i++)
+    testRamp[i] = TEST_ZERO - TEST_RAMP_START + TEST_RAMP_SLOPE * i;
+
+  // The frames of a ramp read every sample and are on the ramp, within the
+  // rounding. One more frame would read past the last sample.
+  sound_resampler_t resampler;
+  sound_resampleStart(&resampler, TEST_RATE);
+  uint32_t frameCount = sound_resampleFrameCount(TEST_RAMP_SAMPLES, TEST_RATE);
+  uint32_t sampleCount = sound_resampleSampleCount(&resampler, frameCount);
+  if (frameCount != TEST_RAMP_FRAMES || sampleCount != TEST_RAMP_SAMPLES ||
+      sound_resampleSampleCount(&resampler, frameCount + 1) <=
+          TEST_RAMP_SAMPLES) {
+    printf("sound_runResampleTest: %lu frames read %lu samples; should be %d "
+           "frames, reading %d.\n",
+           (unsigned long)frameCount, (unsigned long)sampleCount,
+           TEST_RAMP_FRAMES, TEST_RAMP_SAMPLES);
+    success = false;
+  }
+  sound_resample(&resampler, testRamp, testFrames, TEST_RAMP_FRAMES);
+  for (uint32_t i = 0; i < TEST_RAMP_FRAMES; i++) {
+    double position = (double)i * resampler.step / POSITION_ONE;
+    double expected = TEST_ZERO - TEST_RAMP_START + TEST_RAMP_SLOPE * position;
+    if (fabs(testFrames[i] - expected) > 1.0) {
+      printf("sound_runResampleTest: frame %lu is %u, should be %.1f.\n",
+             (unsigned long)i, testFrames[i], expected);
+      success = false;
+      break;
+    }
+  }
+
+  // Converting in pieces of any size gives the same frames.
+  const uint32_t pieceSizes[] = TEST_PIECE_SIZES;
+  for (uint16_t p = 0; p < sizeof(pieceSizes) / sizeof(pieceSizes[0]); p++) {
+    sound_resampleStart(&resampler, TEST_RATE);
+    uint32_t sample = 0;
+    for (uint32_t frame = 0; frame < TEST_RAMP_FRAMES;
+         frame += pieceSizes[p]) {
+      uint32_t count = TEST_RAMP_FRAMES - frame;
+      if (count > pieceSizes[p])
+        count = pieceSizes[p];
+      uint32_t samples = sound_resampleSampleCount(&resampler, count);
+      sound_resample(&resampler, &testRamp[sample], &testPieces[frame], count);
+      sample += samples;
+    }
+    for (uint32_t i = 0; i < TEST_RAMP_FRAMES; i++) {
+      if (sample != TEST_RAMP_SAMPLES || testPieces[i] != testFrames[i]) {
+        printf("sound_runResampleTest: in pieces of %lu, frame %lu is %u, "
+               "should be %u, after %lu samples.\n",
+               (unsigned long)pieceSizes[p], (unsigned long)i, testPieces[i],
+               testFrames[i], (unsigned long)sample);
+        success = false;
+        break;
+      }
+    }
+  }
+
+  // A second of a tone, a block at a time as sound_renderBlock() converts it,
+  // is within TEST_MIN_SNR_DB of the tone at the codec rate.
+  for (uint32_t i = 0; i < TEST_TONE_SAMPLES; i++)
+    testTone[i] = TEST_ZERO + lround(TEST_AMPLITUDE *
+                                     sin(2.0 * M_PI * TEST_TONE_FREQUENCY *
+                                         i / TEST_RATE));
+  sound_resampleStart(&resampler, TEST_RATE);
+  frameCount = sound_resampleFrameCount(TEST_TONE_SAMPLES, TEST_RATE);
+  uint16_t block[SOUND_DMA_BLOCK_FRAMES];
+  double signal = 0.0;
+  double noise = 0.0;
+  uint32_t cycles = 0;
+  uint32_t sample = 0;
+  for (uint32_t frame = 0; frame < frameCount;
+       frame += SOUND_DMA_BLOCK_FRAMES) {
+    uint32_t count = frameCount - frame;
+    if (count > SOUND_DMA_BLOCK_FRAMES)
+      count = SOUND_DMA_BLOCK_FRAMES;
+    uint32_t startCycles = detectorProfile_readCycles();
+    uint32_t samples = sound_resampleSampleCount(&resampler, count);
+    sound_resample(&resampler, &testTone[sample], block, count);
+    cycles += detectorProfile_readCycles() - startCycles;
+    sample += samples;
+    for (uint32_t i = 0; i < count; i++) {
+      double position = (double)(frame + i) * resampler.step / POSITION_ONE;
+      double expected = TEST_AMPLITUDE * sin(2.0 * M_PI * TEST_TONE_FREQUENCY *
+                                             position / TEST_RATE);
+      double error = (double)block[i] - TEST_ZERO - expected;
+      signal += expected * expected;
+      noise += error * error;
+    }
+  }
+  double snr = 10.0 * log10(signal / noise);
+  if (!(snr >= TEST_MIN_SNR_DB)) {
+    printf("sound_runResampleTest: SNR %.1f dB, should be at least %.1f dB.\n",
+           snr, TEST_MIN_SNR_DB);
+    success = false;
+  }
+  printf("sound_runResampleTest %s (SNR %.1f dB, %lu cycles per second).\n",
+         success ? "passed" : "failed", snr,
+         (unsigned long)((uint64_t)cycles * SOUND_DMA_SAMPLE_RATE /
+                         frameCount));
+  return success;
+}
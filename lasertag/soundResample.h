@@ -0,0 +1,71 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SOUNDRESAMPLE_H_
+#define SOUNDRESAMPLE_H_
+
+// Sample-rate conversion (build with SOUND_RESAMPLE, which requires SOUND_DMA).
+// Each asset keeps its own sample rate, so an effect with nothing above 8 or
+// 11 kHz can be stored at 16 or 22.05 kHz, in a third or half of the memory.
+// sound_renderBlock() converts it to the codec rate, SOUND_DMA_SAMPLE_RATE, a
+// block at a time as it plays. Sounds stored at the codec rate are copied as
+// before.
+//
+// Each frame is interpolated linearly between the two stored samples around
+// it, at a position that advances by a fixed-point step per frame: one
+// multiply per frame. The images this leaves above the stored rate's Nyquist
+// frequency are small for sounds that were low-pass filtered before they were
+// stored at the lower rate (tools/soundAssetWav -r does). Rates above the
+// codec rate would need a filter and are not supported.
+//
+// Samples and frames are offset binary, as in the raw assets.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Of the position and step: the rounding of the step moves a sound by less
+// than a frame in a minute.
+#define SOUND_RESAMPLE_FRACTION_BITS 24
+// sound_resample() reads up to this many samples more than it renders frames.
+#define SOUND_RESAMPLE_EXTRA_SAMPLES 1
+
+// Converter state of one sound.
+typedef struct {
+  uint32_t step;     // Stored samples per frame, in fixed point.
+  uint32_t position; // Of the next frame, from previous, in fixed point.
+  uint16_t previous; // The stored samples around the next frame.
+  uint16_t next;
+} sound_resampler_t;
+
+// Returns the number of frames sound_resample() renders from sampleCount
+// samples at sampleRate: those before the last sample.
+uint32_t sound_resampleFrameCount(uint32_t sampleCount, uint32_t sampleRate);
+
+// Starts converting a sound stored at sampleRate, at most
+// SOUND_DMA_SAMPLE_RATE.
+void sound_resampleStart(sound_resampler_t *resampler, uint32_t sampleRate);
+
+// Returns the number of samples sound_resample() reads to render the next
+// frameCount frames.
+uint32_t sound_resampleSampleCount(const sound_resampler_t *resampler,
+                                   uint32_t frameCount);
+
+// Renders the next frameCount frames into frames[] from the next
+// sound_resampleSampleCount() samples, in samples[].
+void sound_resample(sound_resampler_t *resampler, const uint16_t samples[],
+                    uint16_t frames[], uint32_t frameCount);
+
+// Converts synthetic sounds and checks the frame count, the samples read, that
+// converting in any size of pieces gives the same frames, and the
+// signal-to-noise ratio of a tone. Prints the cycles it takes to render a
+// second of sound (nanoseconds off the board). Returns true if the test
+// passes.
+bool sound_runResampleTest();
+
+#endif /* SOUNDRESAMPLE_H_ */
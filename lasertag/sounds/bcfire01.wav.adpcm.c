@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -a -b bcfire01.wav
+
+#include "assetEmbed.h"
+
+ASSET_EMBED(bcfire01_wav_adpcm, "bcfire01.wav.adpcm.bin");
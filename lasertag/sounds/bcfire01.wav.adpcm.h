@@ -0,0 +1,7 @@
+// This file was generated by executing this statement: wav2c -a -b bcfire01.wav
+extern const uint8_t bcfire01_wav_adpcm[];
+#define BCFIRE01_WAV_ADPCM_SAMPLE_RATE 22050
+#define BCFIRE01_WAV_ADPCM_BITS_PER_SAMPLE 4
+#define BCFIRE01_WAV_ADPCM_BLOCK_BYTES 256
+#define BCFIRE01_WAV_ADPCM_NUMBER_OF_SAMPLES 24640
+#define BCFIRE01_WAV_ADPCM_NUMBER_OF_BYTES 12492
@@ -1,24646 +1,5 @@
-// This file was generated by executing this statement: wav2c bcfire01.wav
+// This file was generated by executing this statement: wav2c -b bcfire01.wav
 
-#include <stdint.h>
+#include "assetEmbed.h"
 
-int16_t bcfire01_wav[24640] = {
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
--32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767
-};
+ASSET_EMBED(bcfire01_wav, "bcfire01.wav.bin");
@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -a -b bcfire01_48k.wav
+
+#include "assetEmbed.h"
+
+ASSET_EMBED(bcfire01_48k_wav_adpcm, "bcfire01_48k.wav.adpcm.bin");
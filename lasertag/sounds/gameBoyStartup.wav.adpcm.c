@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -a -b gameBoyStartup.wav
+
+#include "assetEmbed.h"
+
+ASSET_EMBED(gameBoyStartup_wav_adpcm, "gameBoyStartup.wav.adpcm.bin");
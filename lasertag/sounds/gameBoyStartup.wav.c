@@ -1,105494 +1,5 @@
-// This file was generated by executing this statement: wav2c gameBoyStartup.wav
+// This file was generated by executing this statement: wav2c -b gameBoyStartup.wav
 
-#include <stdint.h>
+#include "assetEmbed.h"
 
-uint16_t gameBoyStartup_wav[105488] = {
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32762,
-32773,
-32762,
-32770,
-32765,
-32768,
-32768,
-32765,
-32769,
-32764,
-32770,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32772,
-32762,
-32771,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32770,
-32763,
-32772,
-32761,
-32772,
-32763,
-32770,
-32766,
-32768,
-32765,
-32769,
-32765,
-32768,
-32769,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32766,
-32769,
-32766,
-32768,
-32766,
-32766,
-32770,
-32764,
-32770,
-32764,
-32768,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32762,
-32772,
-32763,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32765,
-32771,
-32763,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32763,
-32771,
-32765,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32769,
-32765,
-32769,
-32767,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32769,
-32763,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32766,
-32770,
-32762,
-32773,
-32762,
-32769,
-32767,
-32767,
-32766,
-32770,
-32763,
-32769,
-32768,
-32764,
-32771,
-32764,
-32767,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32765,
-32770,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32769,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32767,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32765,
-32771,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32768,
-32769,
-32764,
-32771,
-32763,
-32768,
-32770,
-32762,
-32772,
-32763,
-32770,
-32766,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32772,
-32762,
-32770,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32770,
-32765,
-32767,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32771,
-32762,
-32772,
-32763,
-32768,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32772,
-32760,
-32775,
-32760,
-32772,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32770,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32773,
-32761,
-32771,
-32765,
-32768,
-32767,
-32767,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32767,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32764,
-32773,
-32759,
-32775,
-32760,
-32772,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32767,
-32765,
-32770,
-32763,
-32772,
-32763,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32767,
-32764,
-32771,
-32765,
-32768,
-32767,
-32766,
-32767,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32767,
-32769,
-32765,
-32769,
-32764,
-32769,
-32767,
-32767,
-32767,
-32766,
-32767,
-32769,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32768,
-32767,
-32766,
-32767,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32768,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32769,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32766,
-32766,
-32768,
-32767,
-32767,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32765,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32768,
-32764,
-32770,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32766,
-32766,
-32770,
-32763,
-32771,
-32765,
-32766,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32772,
-32762,
-32771,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32770,
-32762,
-32772,
-32763,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32769,
-32767,
-32767,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32769,
-32765,
-32770,
-32765,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32766,
-32770,
-32764,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32761,
-32773,
-32762,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32767,
-32769,
-32764,
-32771,
-32764,
-32768,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32767,
-32770,
-32761,
-32773,
-32763,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32771,
-32762,
-32771,
-32765,
-32767,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32767,
-32768,
-32766,
-32769,
-32765,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32767,
-32765,
-32768,
-32767,
-32767,
-32768,
-32766,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32772,
-32762,
-32772,
-32762,
-32772,
-32762,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32769,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32772,
-32761,
-32773,
-32763,
-32768,
-32768,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32766,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32765,
-32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32770,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32772,
-32761,
-32772,
-32763,
-32770,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32767,
-32766,
-32769,
-32763,
-32772,
-32762,
-32772,
-32763,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32770,
-32762,
-32772,
-32764,
-32767,
-32770,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32766,
-32765,
-32771,
-32763,
-32769,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32769,
-32764,
-32770,
-32763,
-32772,
-32763,
-32770,
-32765,
-32767,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32769,
-32765,
-32770,
-32765,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32763,
-32772,
-32761,
-32772,
-32765,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32767,
-32766,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32767,
-32769,
-32763,
-32772,
-32763,
-32768,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32768,
-32764,
-32771,
-32763,
-32769,
-32768,
-32764,
-32770,
-32766,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32764,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32767,
-32766,
-32769,
-32765,
-32767,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32769,
-32768,
-32764,
-32770,
-32764,
-32769,
-32767,
-32765,
-32771,
-32762,
-32771,
-32765,
-32767,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32762,
-32772,
-32762,
-32772,
-32762,
-32771,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32764,
-32768,
-32768,
-32765,
-32771,
-32762,
-32770,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32767,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32769,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32769,
-32763,
-32772,
-32762,
-32772,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32768,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32765,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32766,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32771,
-32762,
-32771,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32765,
-32768,
-32766,
-32767,
-32769,
-32765,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32764,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32769,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32765,
-32769,
-32767,
-32767,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32771,
-32762,
-32771,
-32765,
-32767,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32765,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32765,
-32771,
-32762,
-32773,
-32761,
-32771,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32767,
-32769,
-32763,
-32773,
-32761,
-32772,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32767,
-32769,
-32764,
-32770,
-32766,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32764,
-32770,
-32763,
-32772,
-32763,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32767,
-32769,
-32764,
-32771,
-32763,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32772,
-32761,
-32773,
-32762,
-32771,
-32764,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32771,
-32766,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32773,
-32761,
-32772,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32766,
-32769,
-32764,
-32772,
-32761,
-32773,
-32761,
-32772,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32767,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32768,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32761,
-32773,
-32763,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32761,
-32773,
-32762,
-32771,
-32765,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32771,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32762,
-32773,
-32761,
-32771,
-32766,
-32765,
-32772,
-32760,
-32774,
-32762,
-32770,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32765,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32763,
-32772,
-32763,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32768,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32770,
-32762,
-32773,
-32762,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32770,
-32762,
-32772,
-32763,
-32769,
-32767,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32768,
-32764,
-32770,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32762,
-32773,
-32761,
-32772,
-32763,
-32770,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32764,
-32772,
-32762,
-32771,
-32763,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32764,
-32770,
-32766,
-32767,
-32767,
-32766,
-32768,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32768,
-32764,
-32770,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32767,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32761,
-32773,
-32762,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32766,
-32771,
-32762,
-32772,
-32762,
-32771,
-32765,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32770,
-32763,
-32770,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32769,
-32763,
-32772,
-32763,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32762,
-32773,
-32760,
-32774,
-32761,
-32771,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32771,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32769,
-32763,
-32772,
-32762,
-32772,
-32762,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32767,
-32770,
-32763,
-32770,
-32765,
-32767,
-32770,
-32763,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32769,
-32764,
-32769,
-32766,
-32767,
-32769,
-32765,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32771,
-32762,
-32771,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32762,
-32773,
-32762,
-32769,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32770,
-32765,
-32769,
-32766,
-32766,
-32768,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32763,
-32771,
-32765,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32768,
-32767,
-32768,
-32766,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32766,
-32767,
-32767,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32768,
-32766,
-32768,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32768,
-32764,
-32772,
-32762,
-32771,
-32763,
-32772,
-32762,
-32772,
-32762,
-32770,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32769,
-32767,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32763,
-32772,
-32763,
-32770,
-32764,
-32769,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32766,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32767,
-32765,
-32771,
-32763,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32763,
-32772,
-32763,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32770,
-32762,
-32772,
-32764,
-32768,
-32767,
-32767,
-32766,
-32770,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32765,
-32770,
-32764,
-32771,
-32761,
-32774,
-32760,
-32773,
-32763,
-32768,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32771,
-32762,
-32771,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32769,
-32765,
-32769,
-32767,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32766,
-32769,
-32765,
-32770,
-32762,
-32772,
-32763,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32766,
-32766,
-32770,
-32762,
-32773,
-32761,
-32773,
-32762,
-32770,
-32766,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32768,
-32764,
-32772,
-32762,
-32771,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32771,
-32763,
-32769,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32763,
-32772,
-32762,
-32772,
-32762,
-32772,
-32763,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32771,
-32761,
-32774,
-32761,
-32771,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32765,
-32767,
-32768,
-32765,
-32770,
-32765,
-32767,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32768,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32767,
-32768,
-32767,
-32765,
-32771,
-32762,
-32771,
-32766,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32764,
-32768,
-32769,
-32763,
-32772,
-32763,
-32769,
-32766,
-32767,
-32767,
-32769,
-32763,
-32772,
-32761,
-32773,
-32762,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32767,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32765,
-32769,
-32767,
-32766,
-32768,
-32765,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32767,
-32764,
-32772,
-32763,
-32770,
-32765,
-32767,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32771,
-32762,
-32773,
-32761,
-32771,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32767,
-32769,
-32764,
-32770,
-32766,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32770,
-32762,
-32772,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32767,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32767,
-32766,
-32768,
-32768,
-32765,
-32769,
-32764,
-32770,
-32764,
-32772,
-32761,
-32772,
-32762,
-32771,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32770,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32772,
-32761,
-32772,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32768,
-32764,
-32772,
-32762,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32768,
-32764,
-32770,
-32765,
-32767,
-32770,
-32762,
-32773,
-32760,
-32774,
-32762,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32766,
-32768,
-32764,
-32770,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32767,
-32769,
-32764,
-32770,
-32766,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32770,
-32762,
-32773,
-32761,
-32773,
-32762,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32769,
-32763,
-32772,
-32763,
-32769,
-32767,
-32766,
-32768,
-32767,
-32765,
-32771,
-32763,
-32771,
-32762,
-32772,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32771,
-32761,
-32773,
-32763,
-32769,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32765,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32763,
-32771,
-32764,
-32770,
-32765,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32771,
-32762,
-32772,
-32762,
-32772,
-32764,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32763,
-32771,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32769,
-32763,
-32772,
-32762,
-32772,
-32763,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32763,
-32773,
-32760,
-32773,
-32764,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32769,
-32764,
-32771,
-32762,
-32771,
-32766,
-32766,
-32769,
-32764,
-32769,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32769,
-32765,
-32769,
-32767,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32765,
-32766,
-32769,
-32764,
-32771,
-32764,
-32769,
-32766,
-32766,
-32768,
-32767,
-32767,
-32768,
-32765,
-32768,
-32766,
-32768,
-32768,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32767,
-32767,
-32768,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32767,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32768,
-32767,
-32766,
-32770,
-32762,
-32772,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32763,
-32772,
-32763,
-32768,
-32770,
-32761,
-32773,
-32763,
-32769,
-32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32768,
-32768,
-32764,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32771,
-32763,
-32770,
-32764,
-32770,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32764,
-32770,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32767,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32768,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32763,
-32771,
-32765,
-32766,
-32771,
-32761,
-32773,
-32762,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32763,
-32769,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32765,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32766,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32763,
-32773,
-32761,
-32771,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32764,
-32768,
-32767,
-32766,
-32769,
-32767,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32768,
-32767,
-32766,
-32770,
-32762,
-32772,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32765,
-32771,
-32762,
-32772,
-32764,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32764,
-32771,
-32762,
-32771,
-32765,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32767,
-32768,
-32765,
-32771,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32767,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32772,
-32761,
-32773,
-32762,
-32770,
-32767,
-32764,
-32772,
-32761,
-32773,
-32762,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32764,
-32772,
-32762,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32768,
-32767,
-32766,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32769,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32767,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32770,
-32766,
-32767,
-32767,
-32768,
-32764,
-32770,
-32766,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32763,
-32771,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32766,
-32765,
-32770,
-32763,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32768,
-32763,
-32773,
-32761,
-32771,
-32766,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32767,
-32768,
-32767,
-32766,
-32769,
-32763,
-32772,
-32763,
-32769,
-32767,
-32766,
-32769,
-32765,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32766,
-32768,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32768,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32770,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32767,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32762,
-32773,
-32762,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32767,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32768,
-32764,
-32772,
-32761,
-32772,
-32764,
-32767,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32765,
-32771,
-32762,
-32773,
-32761,
-32772,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32764,
-32772,
-32762,
-32770,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32762,
-32773,
-32762,
-32770,
-32766,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32765,
-32770,
-32763,
-32772,
-32762,
-32770,
-32766,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32767,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32771,
-32765,
-32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32769,
-32763,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32770,
-32764,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32766,
-32771,
-32762,
-32771,
-32765,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32761,
-32773,
-32761,
-32773,
-32761,
-32773,
-32761,
-32772,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32762,
-32771,
-32765,
-32768,
-32766,
-32768,
-32765,
-32769,
-32767,
-32766,
-32768,
-32765,
-32769,
-32766,
-32769,
-32763,
-32771,
-32763,
-32771,
-32765,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32762,
-32773,
-32761,
-32772,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32762,
-32774,
-32759,
-32775,
-32759,
-32774,
-32762,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32768,
-32767,
-32766,
-32767,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32765,
-32771,
-32762,
-32771,
-32765,
-32767,
-32769,
-32764,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32761,
-32774,
-32760,
-32773,
-32763,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32766,
-32770,
-32764,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32765,
-32771,
-32762,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32763,
-32772,
-32763,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32764,
-32770,
-32766,
-32768,
-32766,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32771,
-32762,
-32771,
-32765,
-32767,
-32769,
-32763,
-32771,
-32765,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32765,
-32767,
-32769,
-32763,
-32772,
-32763,
-32770,
-32765,
-32767,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32765,
-32769,
-32766,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32771,
-32762,
-32771,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32766,
-32771,
-32761,
-32773,
-32762,
-32770,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32769,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32769,
-32764,
-32770,
-32763,
-32772,
-32762,
-32772,
-32762,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32769,
-32767,
-32766,
-32769,
-32766,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32767,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32764,
-32772,
-32761,
-32773,
-32761,
-32772,
-32764,
-32768,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32770,
-32762,
-32773,
-32761,
-32771,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32770,
-32762,
-32772,
-32763,
-32770,
-32766,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32767,
-32769,
-32765,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32768,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32769,
-32764,
-32770,
-32763,
-32771,
-32765,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32767,
-32769,
-32764,
-32769,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32765,
-32770,
-32766,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32769,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32767,
-32770,
-32763,
-32771,
-32763,
-32769,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32767,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32771,
-32765,
-32768,
-32766,
-32769,
-32763,
-32772,
-32763,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32766,
-32769,
-32764,
-32771,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32767,
-32768,
-32766,
-32770,
-32762,
-32772,
-32761,
-32774,
-32762,
-32769,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32764,
-32772,
-32761,
-32773,
-32763,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32765,
-32769,
-32767,
-32765,
-32770,
-32763,
-32772,
-32763,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32767,
-32769,
-32765,
-32769,
-32765,
-32767,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32767,
-32769,
-32764,
-32771,
-32762,
-32772,
-32762,
-32772,
-32762,
-32772,
-32763,
-32770,
-32765,
-32767,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32767,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32766,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32768,
-32764,
-32772,
-32761,
-32772,
-32764,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32767,
-32766,
-32768,
-32766,
-32766,
-32770,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32767,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32766,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32770,
-32764,
-32768,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32765,
-32767,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32766,
-32770,
-32763,
-32771,
-32765,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32766,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32767,
-32770,
-32762,
-32772,
-32763,
-32770,
-32765,
-32769,
-32764,
-32769,
-32768,
-32764,
-32771,
-32763,
-32769,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32773,
-32762,
-32770,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32767,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32763,
-32772,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32771,
-32762,
-32772,
-32762,
-32771,
-32764,
-32770,
-32765,
-32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32766,
-32770,
-32764,
-32768,
-32768,
-32764,
-32772,
-32762,
-32771,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32768,
-32768,
-32766,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32763,
-32773,
-32760,
-32774,
-32761,
-32771,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32764,
-32772,
-32762,
-32772,
-32762,
-32771,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32769,
-32768,
-32764,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32764,
-32772,
-32761,
-32773,
-32762,
-32770,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32767,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32769,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32767,
-32768,
-32767,
-32765,
-32771,
-32762,
-32771,
-32765,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32768,
-32766,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32772,
-32761,
-32772,
-32764,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32765,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32767,
-32769,
-32763,
-32772,
-32763,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32762,
-32773,
-32760,
-32774,
-32761,
-32772,
-32763,
-32769,
-32766,
-32767,
-32768,
-32767,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32771,
-32762,
-32772,
-32762,
-32771,
-32765,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32768,
-32765,
-32768,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32766,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32765,
-32771,
-32763,
-32769,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32769,
-32764,
-32768,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32762,
-32771,
-32765,
-32767,
-32769,
-32763,
-32771,
-32765,
-32767,
-32768,
-32766,
-32766,
-32770,
-32763,
-32772,
-32762,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32766,
-32770,
-32764,
-32770,
-32765,
-32766,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32769,
-32763,
-32771,
-32765,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32768,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32769,
-32767,
-32765,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32765,
-32771,
-32763,
-32771,
-32763,
-32769,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32767,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32770,
-32763,
-32772,
-32763,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32769,
-32767,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32766,
-32769,
-32765,
-32770,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32763,
-32770,
-32766,
-32767,
-32768,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32767,
-32769,
-32766,
-32767,
-32766,
-32768,
-32766,
-32769,
-32766,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32767,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32768,
-32764,
-32771,
-32762,
-32771,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32763,
-32772,
-32762,
-32772,
-32763,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32766,
-32770,
-32763,
-32772,
-32762,
-32770,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32768,
-32769,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32771,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32772,
-32762,
-32770,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32767,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32772,
-32761,
-32772,
-32764,
-32769,
-32767,
-32765,
-32768,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32765,
-32769,
-32765,
-32771,
-32762,
-32771,
-32763,
-32770,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32766,
-32766,
-32770,
-32764,
-32770,
-32765,
-32767,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32769,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32763,
-32773,
-32760,
-32774,
-32762,
-32769,
-32768,
-32765,
-32768,
-32768,
-32764,
-32772,
-32761,
-32772,
-32764,
-32769,
-32767,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32765,
-32771,
-32762,
-32773,
-32760,
-32774,
-32761,
-32772,
-32763,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32772,
-32761,
-32773,
-32763,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32765,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32765,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32770,
-32761,
-32774,
-32761,
-32772,
-32764,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32767,
-32769,
-32764,
-32769,
-32767,
-32765,
-32770,
-32765,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32773,
-32761,
-32772,
-32763,
-32770,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32766,
-32767,
-32766,
-32768,
-32767,
-32767,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32770,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32770,
-32764,
-32768,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32767,
-32766,
-32770,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32766,
-32765,
-32771,
-32763,
-32771,
-32764,
-32767,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32769,
-32765,
-32767,
-32768,
-32767,
-32767,
-32768,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32761,
-32773,
-32763,
-32769,
-32766,
-32768,
-32764,
-32773,
-32761,
-32772,
-32763,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32770,
-32763,
-32772,
-32762,
-32770,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32763,
-32772,
-32762,
-32772,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32766,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32772,
-32760,
-32775,
-32759,
-32774,
-32761,
-32772,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32771,
-32763,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32765,
-32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32766,
-32770,
-32763,
-32772,
-32761,
-32772,
-32763,
-32770,
-32766,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32767,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32766,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32767,
-32770,
-32762,
-32772,
-32763,
-32769,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32769,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
-32768,
-32764,
-32770,
-32766,
-32765,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32772,
-32763,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32767,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32772,
-32762,
-32772,
-32762,
-32772,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32769,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32762,
-32773,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32771,
-32763,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32772,
-32761,
-32772,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32767,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32770,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32768,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32761,
-32773,
-32762,
-32771,
-32765,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32767,
-32769,
-32764,
-32771,
-32763,
-32769,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32766,
-32770,
-32762,
-32772,
-32765,
-32765,
-32771,
-32763,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32770,
-32764,
-32768,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32769,
-32764,
-32770,
-32763,
-32771,
-32765,
-32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
-32766,
-32771,
-32761,
-32773,
-32762,
-32770,
-32766,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32768,
-32764,
-32769,
-32767,
-32765,
-32771,
-32762,
-32771,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32763,
-32771,
-32763,
-32772,
-32762,
-32771,
-32764,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32765,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32769,
-32767,
-32767,
-32767,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
-32766,
-32769,
-32766,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32767,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32771,
-32762,
-32772,
-32762,
-32771,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32764,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32771,
-32763,
-32770,
-32765,
-32767,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32762,
-32771,
-32765,
-32768,
-32767,
-32767,
-32765,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32764,
-32770,
-32766,
-32767,
-32766,
-32768,
-32766,
-32770,
-32763,
-32771,
-32762,
-32772,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32769,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32767,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32766,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32763,
-32770,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32765,
-32766,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32766,
-32769,
-32765,
-32770,
-32764,
-32767,
-32770,
-32762,
-32774,
-32760,
-32772,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32767,
-32765,
-32771,
-32762,
-32771,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32766,
-32768,
-32768,
-32764,
-32771,
-32763,
-32769,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32772,
-32762,
-32770,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32767,
-32765,
-32770,
-32763,
-32772,
-32763,
-32769,
-32767,
-32765,
-32770,
-32765,
-32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32766,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32765,
-32771,
-32763,
-32769,
-32766,
-32767,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32765,
-32767,
-32769,
-32763,
-32771,
-32764,
-32770,
-32764,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32766,
-32767,
-32767,
-32766,
-32768,
-32767,
-32768,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32768,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32768,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32773,
-32761,
-32771,
-32765,
-32768,
-32767,
-32767,
-32765,
-32770,
-32764,
-32771,
-32763,
-32769,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32765,
-32771,
-32762,
-32772,
-32764,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32772,
-32762,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32764,
-32770,
-32764,
-32768,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32767,
-32766,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32767,
-32765,
-32770,
-32764,
-32768,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32767,
-32765,
-32771,
-32762,
-32773,
-32761,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32763,
-32772,
-32762,
-32772,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32764,
-32772,
-32763,
-32769,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32769,
-32765,
-32769,
-32767,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32767,
-32766,
-32769,
-32764,
-32768,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32764,
-32771,
-32762,
-32772,
-32762,
-32772,
-32763,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32771,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32764,
-32771,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32767,
-32769,
-32763,
-32773,
-32761,
-32771,
-32765,
-32767,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32768,
-32768,
-32764,
-32773,
-32760,
-32772,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32762,
-32771,
-32765,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32764,
-32770,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32765,
-32771,
-32763,
-32770,
-32764,
-32769,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32763,
-32769,
-32766,
-32767,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32769,
-32765,
-32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32765,
-32770,
-32764,
-32771,
-32763,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32767,
-32766,
-32769,
-32763,
-32771,
-32764,
-32770,
-32765,
-32768,
-32765,
-32770,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32767,
-32766,
-32767,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32767,
-32769,
-32764,
-32771,
-32762,
-32773,
-32761,
-32772,
-32763,
-32769,
-32768,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32764,
-32771,
-32762,
-32772,
-32762,
-32772,
-32764,
-32767,
-32769,
-32764,
-32770,
-32766,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32767,
-32766,
-32767,
-32768,
-32766,
-32769,
-32765,
-32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32772,
-32761,
-32773,
-32763,
-32768,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32765,
-32771,
-32763,
-32770,
-32766,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32766,
-32768,
-32766,
-32769,
-32766,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32766,
-32768,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32767,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
-32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32763,
-32772,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32765,
-32771,
-32762,
-32771,
-32764,
-32769,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32771,
-32762,
-32771,
-32765,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32761,
-32774,
-32760,
-32774,
-32761,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32768,
-32766,
-32767,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32768,
-32768,
-32764,
-32772,
-32761,
-32772,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32771,
-32765,
-32768,
-32766,
-32769,
-32763,
-32772,
-32762,
-32772,
-32762,
-32772,
-32762,
-32772,
-32763,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32767,
-32769,
-32763,
-32772,
-32762,
-32770,
-32767,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32767,
-32770,
-32764,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32771,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32764,
-32772,
-32763,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32768,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32772,
-32761,
-32773,
-32762,
-32771,
-32764,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32770,
-32764,
-32768,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32768,
-32765,
-32769,
-32764,
-32770,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32762,
-32773,
-32761,
-32772,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
-32766,
-32768,
-32767,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32767,
-32766,
-32769,
-32763,
-32771,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32770,
-32764,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32767,
-32769,
-32764,
-32771,
-32763,
-32769,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32762,
-32773,
-32760,
-32774,
-32761,
-32772,
-32764,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32766,
-32768,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32767,
-32766,
-32769,
-32763,
-32771,
-32765,
-32767,
-32769,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32766,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32771,
-32762,
-32772,
-32762,
-32771,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32767,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32770,
-32765,
-32768,
-32768,
-32763,
-32773,
-32761,
-32772,
-32763,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32762,
-32774,
-32759,
-32774,
-32762,
-32770,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32771,
-32765,
-32768,
-32767,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32768,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32765,
-32771,
-32762,
-32773,
-32761,
-32771,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32765,
-32771,
-32762,
-32773,
-32760,
-32773,
-32764,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32772,
-32761,
-32773,
-32762,
-32769,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32769,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32766,
-32765,
-32770,
-32763,
-32772,
-32763,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32769,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32771,
-32762,
-32773,
-32761,
-32772,
-32762,
-32772,
-32763,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32765,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32762,
-32773,
-32761,
-32771,
-32766,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32765,
-32771,
-32762,
-32771,
-32765,
-32766,
-32770,
-32765,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32768,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32768,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32767,
-32769,
-32765,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32762,
-32773,
-32760,
-32773,
-32764,
-32768,
-32767,
-32765,
-32769,
-32767,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32772,
-32761,
-32773,
-32763,
-32769,
-32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32763,
-32772,
-32763,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32771,
-32764,
-32767,
-32769,
-32764,
-32770,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32767,
-32769,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32765,
-32767,
-32769,
-32763,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32767,
-32766,
-32769,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32763,
-32772,
-32763,
-32769,
-32767,
-32765,
-32769,
-32767,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32772,
-32760,
-32774,
-32762,
-32770,
-32766,
-32767,
-32767,
-32766,
-32770,
-32762,
-32774,
-32759,
-32774,
-32761,
-32772,
-32764,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32771,
-32762,
-32772,
-32764,
-32767,
-32769,
-32764,
-32771,
-32763,
-32771,
-32762,
-32772,
-32764,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32770,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32767,
-32767,
-32765,
-32769,
-32766,
-32769,
-32765,
-32768,
-32765,
-32771,
-32763,
-32770,
-32765,
-32767,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32772,
-32763,
-32769,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32771,
-32763,
-32769,
-32766,
-32768,
-32767,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32767,
-32770,
-32762,
-32773,
-32761,
-32771,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32773,
-32761,
-32772,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32764,
-32772,
-32762,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32767,
-32766,
-32770,
-32762,
-32771,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32768,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32767,
-32770,
-32762,
-32773,
-32762,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32765,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32769,
-32763,
-32773,
-32761,
-32771,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32768,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32767,
-32766,
-32769,
-32766,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32763,
-32772,
-32762,
-32770,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32765,
-32770,
-32765,
-32767,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
-32767,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32763,
-32772,
-32763,
-32769,
-32767,
-32765,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32768,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32763,
-32773,
-32761,
-32771,
-32765,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32768,
-32764,
-32771,
-32765,
-32769,
-32766,
-32766,
-32768,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32766,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32766,
-32767,
-32768,
-32764,
-32770,
-32765,
-32767,
-32764,
-32769,
-32765,
-32769,
-32767,
-32765,
-32769,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32767,
-32768,
-32766,
-32769,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32769,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
-32766,
-32768,
-32768,
-32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32765,
-32768,
-32767,
-32765,
-32770,
-32763,
-32770,
-32764,
-32770,
-32763,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32770,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32763,
-32771,
-32763,
-32772,
-32762,
-32772,
-32763,
-32771,
-32765,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32768,
-32767,
-32765,
-32770,
-32765,
-32769,
-32765,
-32767,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32771,
-32765,
-32768,
-32767,
-32765,
-32768,
-32768,
-32764,
-32772,
-32761,
-32772,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32768,
-32765,
-32769,
-32765,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32770,
-32764,
-32765,
-32771,
-32763,
-32770,
-32764,
-32771,
-32764,
-32771,
-32763,
-32768,
-32767,
-32765,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32765,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32768,
-32766,
-32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32770,
-32762,
-32773,
-32761,
-32768,
-32765,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32767,
-32768,
-32765,
-32765,
-32767,
-32765,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32767,
-32766,
-32768,
-32768,
-32765,
-32770,
-32763,
-32770,
-32764,
-32767,
-32767,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32768,
-32764,
-32770,
-32763,
-32771,
-32765,
-32767,
-32769,
-32764,
-32767,
-32764,
-32768,
-32766,
-32768,
-32767,
-32767,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32765,
-32765,
-32767,
-32767,
-32769,
-32765,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32768,
-32766,
-32768,
-32769,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32764,
-32772,
-32761,
-32768,
-32765,
-32765,
-32770,
-32764,
-32767,
-32769,
-32766,
-32766,
-32769,
-32763,
-32770,
-32765,
-32769,
-32766,
-32768,
-32765,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32765,
-32768,
-32766,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32768,
-32766,
-32766,
-32764,
-32765,
-32767,
-32764,
-32771,
-32761,
-32774,
-32761,
-32771,
-32764,
-32769,
-32767,
-32765,
-32769,
-32764,
-32771,
-32764,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32771,
-32764,
-32769,
-32767,
-32765,
-32770,
-32763,
-32772,
-32763,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32769,
-32765,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32763,
-32768,
-32764,
-32770,
-32764,
-32769,
-32765,
-32769,
-32762,
-32766,
-32767,
-32766,
-32768,
-32768,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32761,
-32771,
-32764,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32767,
-32768,
-32767,
-32766,
-32770,
-32763,
-32772,
-32762,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32765,
-32763,
-32767,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32766,
-32768,
-32765,
-32768,
-32767,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32766,
-32767,
-32769,
-32765,
-32769,
-32764,
-32769,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32769,
-32765,
-32768,
-32767,
-32765,
-32767,
-32766,
-32769,
-32766,
-32766,
-32768,
-32766,
-32768,
-32768,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32765,
-32770,
-32765,
-32770,
-32764,
-32770,
-32764,
-32768,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32764,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32763,
-32771,
-32762,
-32771,
-32763,
-32771,
-32765,
-32768,
-32766,
-32768,
-32764,
-32769,
-32761,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32769,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32768,
-32767,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32769,
-32767,
-32766,
-32768,
-32762,
-32766,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32770,
-32764,
-32769,
-32767,
-32764,
-32770,
-32764,
-32769,
-32767,
-32764,
-32771,
-32763,
-32771,
-32763,
-32772,
-32763,
-32773,
-32762,
-32769,
-32763,
-32768,
-32767,
-32765,
-32769,
-32765,
-32768,
-32765,
-32767,
-32767,
-32767,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32765,
-32771,
-32763,
-32771,
-32765,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32764,
-32766,
-32764,
-32767,
-32769,
-32764,
-32771,
-32763,
-32769,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32765,
-32768,
-32765,
-32770,
-32763,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32767,
-32767,
-32768,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32764,
-32767,
-32766,
-32769,
-32766,
-32768,
-32766,
-32767,
-32766,
-32767,
-32768,
-32767,
-32765,
-32770,
-32761,
-32770,
-32762,
-32770,
-32765,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32764,
-32765,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32762,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32770,
-32766,
-32767,
-32769,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32767,
-32764,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32766,
-32768,
-32765,
-32771,
-32763,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32768,
-32767,
-32765,
-32771,
-32763,
-32768,
-32768,
-32766,
-32770,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32768,
-32766,
-32767,
-32768,
-32763,
-32768,
-32765,
-32767,
-32766,
-32767,
-32768,
-32766,
-32764,
-32768,
-32762,
-32773,
-32762,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32766,
-32764,
-32767,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32770,
-32766,
-32767,
-32768,
-32764,
-32769,
-32763,
-32765,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32766,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32770,
-32764,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32767,
-32768,
-32766,
-32769,
-32767,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32766,
-32767,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32767,
-32767,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32770,
-32761,
-32771,
-32761,
-32772,
-32764,
-32764,
-32767,
-32765,
-32769,
-32764,
-32769,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32770,
-32764,
-32770,
-32766,
-32767,
-32767,
-32766,
-32767,
-32767,
-32767,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32764,
-32766,
-32765,
-32766,
-32766,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32764,
-32770,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32765,
-32770,
-32765,
-32769,
-32764,
-32769,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32769,
-32765,
-32765,
-32765,
-32770,
-32763,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32767,
-32766,
-32770,
-32763,
-32770,
-32759,
-32770,
-32763,
-32768,
-32767,
-32768,
-32767,
-32767,
-32766,
-32767,
-32767,
-32766,
-32769,
-32764,
-32768,
-32765,
-32768,
-32766,
-32767,
-32767,
-32769,
-32768,
-32767,
-32766,
-32768,
-32765,
-32764,
-32766,
-32765,
-32768,
-32767,
-32767,
-32766,
-32767,
-32767,
-32768,
-32768,
-32766,
-32768,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32766,
-32766,
-32769,
-32766,
-32768,
-32766,
-32766,
-32764,
-32765,
-32769,
-32765,
-32767,
-32765,
-32766,
-32769,
-32765,
-32770,
-32765,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32768,
-32769,
-32766,
-32768,
-32767,
-32765,
-32769,
-32765,
-32767,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32762,
-32772,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32765,
-32767,
-32767,
-32765,
-32766,
-32764,
-32769,
-32765,
-32768,
-32768,
-32764,
-32769,
-32766,
-32767,
-32769,
-32763,
-32771,
-32765,
-32767,
-32769,
-32765,
-32768,
-32767,
-32765,
-32765,
-32765,
-32768,
-32766,
-32769,
-32764,
-32768,
-32765,
-32768,
-32767,
-32768,
-32764,
-32771,
-32763,
-32769,
-32767,
-32767,
-32768,
-32766,
-32767,
-32765,
-32767,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32766,
-32762,
-32766,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32765,
-32769,
-32767,
-32768,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32764,
-32771,
-32763,
-32769,
-32766,
-32767,
-32769,
-32766,
-32764,
-32766,
-32766,
-32767,
-32767,
-32767,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32767,
-32763,
-32770,
-32763,
-32770,
-32764,
-32770,
-32765,
-32769,
-32767,
-32765,
-32772,
-32761,
-32771,
-32764,
-32770,
-32765,
-32769,
-32762,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32767,
-32766,
-32766,
-32768,
-32766,
-32767,
-32768,
-32763,
-32769,
-32763,
-32770,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32763,
-32769,
-32764,
-32769,
-32767,
-32766,
-32769,
-32763,
-32769,
-32765,
-32768,
-32764,
-32768,
-32769,
-32766,
-32769,
-32766,
-32769,
-32764,
-32772,
-32763,
-32769,
-32765,
-32766,
-32764,
-32765,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32764,
-32770,
-32766,
-32767,
-32766,
-32763,
-32766,
-32767,
-32768,
-32768,
-32764,
-32770,
-32762,
-32770,
-32768,
-32765,
-32769,
-32767,
-32768,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32766,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32763,
-32764,
-32768,
-32765,
-32770,
-32765,
-32767,
-32768,
-32762,
-32767,
-32766,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32768,
-32765,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32765,
-32767,
-32766,
-32769,
-32766,
-32768,
-32766,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32765,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32763,
-32768,
-32767,
-32766,
-32770,
-32764,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32765,
-32769,
-32766,
-32769,
-32765,
-32766,
-32763,
-32769,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32766,
-32768,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32767,
-32768,
-32764,
-32768,
-32769,
-32765,
-32771,
-32763,
-32769,
-32768,
-32765,
-32768,
-32766,
-32765,
-32770,
-32765,
-32767,
-32770,
-32764,
-32769,
-32764,
-32769,
-32764,
-32770,
-32764,
-32766,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32762,
-32767,
-32764,
-32770,
-32764,
-32768,
-32765,
-32768,
-32766,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32765,
-32769,
-32766,
-32769,
-32766,
-32766,
-32767,
-32768,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32767,
-32765,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32768,
-32768,
-32766,
-32769,
-32764,
-32769,
-32767,
-32767,
-32767,
-32766,
-32767,
-32767,
-32767,
-32769,
-32766,
-32767,
-32767,
-32765,
-32770,
-32765,
-32770,
-32762,
-32770,
-32764,
-32767,
-32766,
-32768,
-32763,
-32770,
-32763,
-32771,
-32763,
-32767,
-32767,
-32768,
-32767,
-32766,
-32770,
-32764,
-32768,
-32767,
-32766,
-32768,
-32765,
-32769,
-32763,
-32772,
-32763,
-32769,
-32766,
-32767,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32765,
-32769,
-32760,
-32771,
-32763,
-32769,
-32766,
-32767,
-32766,
-32767,
-32763,
-32770,
-32765,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32769,
-32766,
-32770,
-32765,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32766,
-32768,
-32768,
-32764,
-32768,
-32765,
-32769,
-32766,
-32765,
-32770,
-32762,
-32770,
-32764,
-32770,
-32765,
-32771,
-32763,
-32772,
-32764,
-32768,
-32766,
-32767,
-32767,
-32763,
-32766,
-32765,
-32770,
-32764,
-32770,
-32763,
-32770,
-32764,
-32769,
-32764,
-32768,
-32767,
-32767,
-32769,
-32764,
-32768,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32769,
-32764,
-32773,
-32762,
-32769,
-32764,
-32769,
-32765,
-32769,
-32763,
-32770,
-32767,
-32764,
-32770,
-32764,
-32768,
-32767,
-32765,
-32770,
-32765,
-32767,
-32766,
-32767,
-32765,
-32770,
-32764,
-32769,
-32764,
-32768,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32765,
-32767,
-32766,
-32768,
-32766,
-32769,
-32766,
-32767,
-32766,
-32764,
-32769,
-32763,
-32770,
-32764,
-32769,
-32765,
-32768,
-32761,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32768,
-32765,
-32769,
-32766,
-32765,
-32771,
-32763,
-32769,
-32767,
-32766,
-32767,
-32767,
-32767,
-32767,
-32765,
-32768,
-32765,
-32769,
-32766,
-32769,
-32765,
-32767,
-32766,
-32768,
-32767,
-32773,
-32766,
-32771,
-32762,
-32767,
-32766,
-32770,
-32765,
-32763,
-32764,
-32766,
-32767,
-32765,
-32768,
-32767,
-32766,
-32767,
-32766,
-32768,
-32766,
-32768,
-32768,
-32766,
-32767,
-32767,
-32765,
-32770,
-32762,
-32773,
-32764,
-32768,
-32767,
-32768,
-32766,
-32769,
-32763,
-32768,
-32767,
-32765,
-32767,
-32762,
-32768,
-32765,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32769,
-32763,
-32772,
-32763,
-32769,
-32768,
-32764,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32770,
-32764,
-32768,
-32765,
-32766,
-32768,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32765,
-32769,
-32763,
-32768,
-32764,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32767,
-32765,
-32768,
-32765,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32770,
-32767,
-32766,
-32768,
-32761,
-32771,
-32765,
-32769,
-32765,
-32767,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32767,
-32766,
-32766,
-32763,
-32769,
-32765,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32770,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32767,
-32763,
-32764,
-32769,
-32765,
-32769,
-32763,
-32769,
-32763,
-32770,
-32766,
-32767,
-32767,
-32764,
-32767,
-32766,
-32768,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32765,
-32767,
-32766,
-32767,
-32768,
-32766,
-32769,
-32765,
-32771,
-32766,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32762,
-32768,
-32763,
-32772,
-32765,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32765,
-32767,
-32770,
-32764,
-32773,
-32763,
-32770,
-32765,
-32769,
-32763,
-32768,
-32761,
-32767,
-32763,
-32768,
-32766,
-32769,
-32763,
-32771,
-32765,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32765,
-32767,
-32766,
-32766,
-32768,
-32766,
-32766,
-32770,
-32765,
-32768,
-32765,
-32769,
-32766,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32764,
-32768,
-32765,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32766,
-32768,
-32768,
-32762,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32763,
-32768,
-32766,
-32769,
-32767,
-32766,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32769,
-32765,
-32767,
-32768,
-32765,
-32771,
-32766,
-32766,
-32772,
-32763,
-32769,
-32762,
-32767,
-32765,
-32765,
-32770,
-32770,
-32769,
-32766,
-32769,
-32766,
-32767,
-32768,
-32767,
-32768,
-32768,
-32764,
-32770,
-32763,
-32771,
-32760,
-32771,
-32768,
-32769,
-32763,
-32767,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32768,
-32766,
-32767,
-32764,
-32766,
-32766,
-32768,
-32766,
-32768,
-32765,
-32771,
-32764,
-32769,
-32765,
-32767,
-32768,
-32765,
-32766,
-32767,
-32766,
-32767,
-32767,
-32766,
-32771,
-32766,
-32766,
-32766,
-32763,
-32768,
-32766,
-32764,
-32765,
-32767,
-32770,
-32764,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32770,
-32768,
-32766,
-32764,
-32768,
-32768,
-32769,
-32767,
-32767,
-32768,
-32766,
-32766,
-32766,
-32765,
-32770,
-32763,
-32769,
-32766,
-32767,
-32769,
-32767,
-32767,
-32766,
-32765,
-32766,
-32767,
-32767,
-32766,
-32769,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32769,
-32764,
-32767,
-32765,
-32766,
-32767,
-32767,
-32768,
-32768,
-32766,
-32765,
-32769,
-32766,
-32765,
-32764,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32766,
-32766,
-32767,
-32768,
-32767,
-32765,
-32769,
-32763,
-32772,
-32762,
-32772,
-32764,
-32770,
-32765,
-32770,
-32764,
-32770,
-32767,
-32765,
-32763,
-32766,
-32766,
-32768,
-32765,
-32769,
-32767,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32767,
-32766,
-32768,
-32765,
-32766,
-32768,
-32765,
-32770,
-32767,
-32766,
-32768,
-32766,
-32767,
-32764,
-32766,
-32768,
-32765,
-32766,
-32765,
-32767,
-32767,
-32766,
-32769,
-32763,
-32772,
-32762,
-32772,
-32767,
-32764,
-32769,
-32763,
-32767,
-32768,
-32767,
-32766,
-32767,
-32768,
-32769,
-32768,
-32768,
-32765,
-32771,
-32761,
-32771,
-32762,
-32771,
-32764,
-32768,
-32765,
-32768,
-32767,
-32769,
-32768,
-32765,
-32769,
-32764,
-32766,
-32760,
-32765,
-32768,
-32767,
-32764,
-32765,
-32767,
-32768,
-32766,
-32769,
-32764,
-32765,
-32767,
-32771,
-32769,
-32767,
-32765,
-32770,
-32766,
-32767,
-32767,
-32765,
-32767,
-32768,
-32765,
-32768,
-32764,
-32768,
-32769,
-32767,
-32769,
-32768,
-32767,
-32767,
-32763,
-32765,
-32761,
-32768,
-32764,
-32763,
-32765,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32768,
-32765,
-32768,
-32763,
-32769,
-32764,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32762,
-32768,
-32767,
-32767,
-32768,
-32762,
-32770,
-32763,
-32770,
-32764,
-32772,
-32762,
-32771,
-32763,
-32770,
-32763,
-32766,
-32764,
-32769,
-32762,
-32773,
-32764,
-32768,
-32765,
-32765,
-32768,
-32767,
-32767,
-32770,
-32766,
-32768,
-32765,
-32769,
-32764,
-32770,
-32766,
-32767,
-32767,
-32764,
-32768,
-32765,
-32770,
-32766,
-32767,
-32768,
-32766,
-32765,
-32771,
-32764,
-32770,
-32764,
-32768,
-32765,
-32769,
-32770,
-32768,
-32768,
-32765,
-32768,
-32763,
-32766,
-32767,
-32769,
-32765,
-32769,
-32768,
-32767,
-32766,
-32767,
-32768,
-32767,
-32765,
-32770,
-32766,
-32767,
-32769,
-32767,
-32768,
-32765,
-32768,
-32766,
-32769,
-32766,
-32769,
-32765,
-32767,
-32767,
-32770,
-32764,
-32769,
-32762,
-32768,
-32765,
-32772,
-32764,
-32768,
-32768,
-32767,
-32771,
-32765,
-32768,
-32765,
-32768,
-32766,
-32763,
-32764,
-32769,
-32766,
-32769,
-32768,
-32766,
-32769,
-32764,
-32768,
-32768,
-32770,
-32768,
-32767,
-32764,
-32767,
-32766,
-32769,
-32764,
-32765,
-32760,
-32767,
-32765,
-32769,
-32766,
-32765,
-32768,
-32766,
-32765,
-32765,
-32765,
-32765,
-32767,
-32768,
-32768,
-32769,
-32764,
-32768,
-32768,
-32762,
-32769,
-32766,
-32767,
-32766,
-32767,
-32766,
-32767,
-32768,
-32767,
-32765,
-32769,
-32762,
-32768,
-32764,
-32768,
-32764,
-32767,
-32766,
-32766,
-32767,
-32766,
-32768,
-32767,
-32770,
-32766,
-32766,
-32770,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32762,
-32768,
-32765,
-32768,
-32767,
-32767,
-32766,
-32770,
-32767,
-32768,
-32766,
-32766,
-32768,
-32765,
-32767,
-32769,
-32766,
-32768,
-32767,
-32764,
-32770,
-32761,
-32772,
-32760,
-32771,
-32766,
-32767,
-32768,
-32770,
-32772,
-32766,
-32770,
-32764,
-32766,
-32764,
-32766,
-32766,
-32766,
-32767,
-32768,
-32768,
-32768,
-32766,
-32770,
-32765,
-32770,
-32764,
-32767,
-32766,
-32769,
-32767,
-32768,
-32766,
-32765,
-32769,
-32768,
-32769,
-32764,
-32769,
-32765,
-32767,
-32771,
-32761,
-32772,
-32763,
-32764,
-32768,
-32759,
-32770,
-32770,
-32768,
-32767,
-32765,
-32767,
-32765,
-32770,
-32766,
-32770,
-32766,
-32768,
-32769,
-32767,
-32767,
-32765,
-32767,
-32765,
-32767,
-32768,
-32765,
-32771,
-32770,
-32767,
-32767,
-32769,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32762,
-32764,
-32765,
-32767,
-32764,
-32764,
-32765,
-32765,
-32765,
-32769,
-32764,
-32771,
-32765,
-32769,
-32764,
-32769,
-32764,
-32766,
-32767,
-32767,
-32767,
-32764,
-32766,
-32768,
-32764,
-32769,
-32766,
-32768,
-32766,
-32764,
-32768,
-32766,
-32769,
-32766,
-32765,
-32767,
-32767,
-32767,
-32766,
-32769,
-32772,
-32765,
-32766,
-32764,
-32763,
-32769,
-32766,
-32767,
-32769,
-32763,
-32767,
-32765,
-32765,
-32767,
-32767,
-32767,
-32766,
-32764,
-32763,
-32769,
-32762,
-32770,
-32763,
-32765,
-32769,
-32765,
-32761,
-32767,
-32762,
-32773,
-32762,
-32767,
-32765,
-32764,
-32767,
-32764,
-32770,
-32768,
-32769,
-32767,
-32764,
-32768,
-32767,
-32769,
-32764,
-32768,
-32765,
-32770,
-32763,
-32766,
-32764,
-32770,
-32770,
-32767,
-32767,
-32769,
-32765,
-32767,
-32766,
-32765,
-32766,
-32768,
-32765,
-32767,
-32766,
-32767,
-32764,
-32769,
-32764,
-32770,
-32764,
-32770,
-32768,
-32764,
-32769,
-32770,
-32764,
-32770,
-32763,
-32770,
-32764,
-32767,
-32769,
-32768,
-32773,
-32766,
-32764,
-32762,
-32763,
-32770,
-32765,
-32772,
-32766,
-32771,
-32765,
-32768,
-32765,
-32768,
-32766,
-32770,
-32762,
-32771,
-32762,
-32770,
-32763,
-32766,
-32763,
-32767,
-32768,
-32767,
-32768,
-32767,
-32766,
-32771,
-32766,
-32763,
-32760,
-32763,
-32766,
-32767,
-32766,
-32767,
-32769,
-32765,
-32768,
-32760,
-32766,
-32762,
-32757,
-32766,
-32763,
-32771,
-32763,
-32768,
-32760,
-32767,
-32764,
-32770,
-32763,
-32762,
-32766,
-32768,
-32772,
-32762,
-32771,
-32763,
-32772,
-32762,
-32766,
-32770,
-32766,
-32769,
-32765,
-32766,
-32765,
-32767,
-32770,
-32766,
-32771,
-32764,
-32767,
-32768,
-32766,
-32771,
-32761,
-32768,
-32763,
-32764,
-32764,
-32765,
-32767,
-32765,
-32768,
-32765,
-32765,
-32769,
-32768,
-32771,
-32771,
-32772,
-32766,
-32762,
-32765,
-32771,
-32766,
-32766,
-32768,
-32765,
-32764,
-32763,
-32767,
-32767,
-32765,
-32766,
-32764,
-32766,
-32770,
-32771,
-32766,
-32762,
-32759,
-32769,
-32769,
-32775,
-32770,
-32767,
-32763,
-32772,
-32766,
-32772,
-32761,
-32766,
-32767,
-32772,
-32769,
-32761,
-32765,
-32769,
-32770,
-32765,
-32771,
-32771,
-32771,
-32763,
-32764,
-32764,
-32769,
-32768,
-32765,
-32768,
-32767,
-32771,
-32757,
-32766,
-32767,
-32777,
-32767,
-32769,
-32765,
-32766,
-32767,
-32768,
-32770,
-32770,
-32768,
-32770,
-32773,
-32771,
-32766,
-32767,
-32766,
-32769,
-32768,
-32768,
-32759,
-32764,
-32767,
-32773,
-32766,
-32767,
-32759,
-32771,
-32766,
-32768,
-32766,
-32765,
-32772,
-32766,
-32766,
-32769,
-32765,
-32771,
-32765,
-32769,
-32767,
-32766,
-32769,
-32766,
-32769,
-32762,
-32769,
-32768,
-32764,
-32763,
-32769,
-32773,
-32775,
-32775,
-32775,
-32771,
-32766,
-32768,
-32767,
-32769,
-32769,
-32763,
-32767,
-32767,
-32767,
-32765,
-32763,
-32771,
-32771,
-32765,
-32769,
-32768,
-32771,
-32766,
-32771,
-32762,
-32767,
-32760,
-32766,
-32766,
-32768,
-32758,
-32757,
-32768,
-32772,
-32773,
-32762,
-32761,
-32766,
-32765,
-32771,
-32762,
-32769,
-32765,
-32766,
-32762,
-32763,
-32763,
-32767,
-32767,
-32770,
-32769,
-32765,
-32767,
-32764,
-32767,
-32765,
-32770,
-32763,
-32771,
-32764,
-32771,
-32766,
-32769,
-32767,
-32760,
-32768,
-32767,
-32765,
-32762,
-32765,
-32770,
-32764,
-32767,
-32767,
-32774,
-32769,
-32764,
-32757,
-32769,
-32763,
-32768,
-32761,
-32773,
-32768,
-32766,
-32766,
-32764,
-32768,
-32764,
-32766,
-32765,
-32769,
-32766,
-32768,
-32768,
-32768,
-32768,
-32761,
-32768,
-32767,
-32769,
-32767,
-32769,
-32773,
-32769,
-32765,
-32765,
-32764,
-32772,
-32767,
-32774,
-32766,
-32767,
-32763,
-32766,
-32766,
-32772,
-32766,
-32771,
-32759,
-32764,
-32764,
-32771,
-32770,
-32772,
-32765,
-32761,
-32768,
-32769,
-32765,
-32769,
-32769,
-32772,
-32775,
-32766,
-32768,
-32766,
-32771,
-32768,
-32766,
-32769,
-32771,
-32765,
-32769,
-32765,
-32768,
-32762,
-32767,
-32768,
-32767,
-32763,
-32763,
-32771,
-32768,
-32773,
-32764,
-32770,
-32771,
-32772,
-32763,
-32765,
-32769,
-32775,
-32765,
-32764,
-32767,
-32768,
-32768,
-32759,
-32769,
-32770,
-32777,
-32768,
-32767,
-32766,
-32766,
-32770,
-32763,
-32771,
-32767,
-32761,
-32765,
-32768,
-32763,
-32766,
-32768,
-32776,
-32768,
-32763,
-32765,
-32768,
-32765,
-32769,
-32768,
-32768,
-32768,
-32768,
-32761,
-32761,
-32759,
-32761,
-32771,
-32772,
-32774,
-32770,
-32767,
-32774,
-32763,
-32769,
-32768,
-32768,
-32767,
-32766,
-32762,
-32771,
-32767,
-32773,
-32758,
-32762,
-32766,
-32766,
-32764,
-32768,
-32767,
-32766,
-32759,
-32769,
-32765,
-32764,
-32759,
-32763,
-32769,
-32764,
-32766,
-32764,
-32766,
-32770,
-32767,
-32770,
-32769,
-32762,
-32763,
-32761,
-32766,
-32757,
-32765,
-32763,
-32768,
-32768,
-32774,
-32772,
-32766,
-32774,
-32768,
-32774,
-32759,
-32764,
-32764,
-32771,
-32769,
-32763,
-32764,
-32781,
-32771,
-32761,
-32755,
-32762,
-32763,
-32762,
-32764,
-32763,
-32766,
-32767,
-32768,
-32764,
-32765,
-32768,
-32765,
-32761,
-32765,
-32766,
-32769,
-32771,
-32766,
-32763,
-32767,
-32775,
-32775,
-32769,
-32766,
-32768,
-32775,
-32765,
-32767,
-32758,
-32764,
-32763,
-32775,
-32773,
-32769,
-32763,
-32758,
-32757,
-32765,
-32769,
-32773,
-32765,
-32758,
-32757,
-32755,
-32766,
-32772,
-32771,
-32771,
-32773,
-32762,
-32761,
-32774,
-32778,
-32775,
-32775,
-32777,
-32763,
-32764,
-32762,
-32760,
-32759,
-32766,
-32766,
-32767,
-32771,
-32770,
-32763,
-32761,
-32761,
-32770,
-32767,
-32774,
-32772,
-32762,
-32766,
-32767,
-32771,
-32774,
-32772,
-32775,
-32766,
-32775,
-32771,
-32772,
-32768,
-32776,
-32771,
-32771,
-32771,
-32770,
-32770,
-32775,
-32776,
-32773,
-32775,
-32770,
-32776,
-32766,
-32767,
-32762,
-32766,
-32757,
-32764,
-32767,
-32766,
-32763,
-32754,
-32766,
-32765,
-32772,
-32765,
-32767,
-32767,
-32767,
-32772,
-32767,
-32766,
-32771,
-32771,
-32768,
-32767,
-32767,
-32772,
-32770,
-32767,
-32765,
-32768,
-32766,
-32768,
-32760,
-32767,
-32770,
-32775,
-32774,
-32767,
-32760,
-32751,
-32763,
-32767,
-32769,
-32777,
-32775,
-32779,
-32770,
-32774,
-32766,
-32771,
-32769,
-32774,
-32769,
-32765,
-32765,
-32768,
-32769,
-32772,
-32760,
-32766,
-32772,
-32769,
-32769,
-32759,
-32764,
-32758,
-32770,
-32771,
-32771,
-32765,
-32763,
-32762,
-32758,
-32768,
-32768,
-32772,
-32763,
-32767,
-32765,
-32770,
-32766,
-32765,
-32775,
-32778,
-32774,
-32757,
-32767,
-32769,
-32772,
-32762,
-32761,
-32767,
-32770,
-32766,
-32762,
-32776,
-32779,
-32778,
-32769,
-32770,
-32769,
-32764,
-32774,
-32776,
-32768,
-32757,
-32769,
-32780,
-32778,
-32761,
-32763,
-32767,
-32771,
-32762,
-32770,
-32769,
-32765,
-32758,
-32758,
-32771,
-32767,
-32767,
-32774,
-32774,
-32764,
-32763,
-32763,
-32772,
-32771,
-32772,
-32775,
-32773,
-32775,
-32768,
-32772,
-32766,
-32763,
-32763,
-32770,
-32774,
-32761,
-32751,
-32758,
-32770,
-32760,
-32766,
-32777,
-32791,
-32783,
-32782,
-32770,
-32774,
-32786,
-32792,
-32775,
-32749,
-32748,
-32753,
-32757,
-32748,
-32737,
-32758,
-32777,
-32798,
-32788,
-32794,
-32794,
-32789,
-32764,
-32747,
-32741,
-32744,
-32775,
-32769,
-32748,
-32727,
-32733,
-32754,
-32755,
-32764,
-32743,
-32749,
-32766,
-32775,
-32754,
-32735,
-32739,
-32740,
-32744,
-32766,
-32780,
-32813,
-32830,
-32822,
-32774,
-32760,
-32785,
-32808,
-32817,
-32810,
-32797,
-32781,
-32779,
-32772,
-32757,
-32750,
-32724,
-32720,
-32718,
-32745,
-32751,
-32739,
-32717,
-32697,
-32700,
-32734,
-32779,
-32802,
-32809,
-32813,
-32809,
-32779,
-32755,
-32765,
-32790,
-32787,
-32758,
-32757,
-32789,
-32837,
-32845,
-32802,
-32750,
-32744,
-32787,
-32823,
-32824,
-32766,
-32709,
-32696,
-32695,
-32675,
-32667,
-32719,
-32787,
-32806,
-32796,
-32803,
-32832,
-32859,
-32837,
-32748,
-32674,
-32682,
-32756,
-32791,
-32752,
-32667,
-32659,
-32717,
-32788,
-32802,
-32818,
-32846,
-32858,
-32840,
-32799,
-32755,
-32723,
-32710,
-32709,
-32679,
-32692,
-32773,
-32875,
-32907,
-32853,
-32795,
-32796,
-32830,
-32824,
-32796,
-32738,
-32693,
-32653,
-32659,
-32654,
-32650,
-32654,
-32689,
-32733,
-32771,
-32799,
-32823,
-32834,
-32793,
-32744,
-32728,
-32744,
-32739,
-32723,
-32746,
-32773,
-32766,
-32782,
-32819,
-32853,
-32836,
-32803,
-32796,
-32810,
-32818,
-32805,
-32746,
-32662,
-32611,
-32669,
-32765,
-32793,
-32772,
-32767,
-32783,
-32767,
-32760,
-32777,
-32801,
-32795,
-32772,
-32751,
-32735,
-32721,
-32727,
-32751,
-32737,
-32668,
-32664,
-32786,
-32877,
-32808,
-32709,
-32710,
-32764,
-32769,
-32756,
-32788,
-32802,
-32766,
-32730,
-32784,
-32846,
-32833,
-32804,
-32806,
-32826,
-32790,
-32808,
-32854,
-32847,
-32757,
-32689,
-32723,
-32780,
-32809,
-32765,
-32710,
-32664,
-32639,
-32668,
-32774,
-32855,
-32821,
-32705,
-32651,
-32656,
-32722,
-32792,
-32820,
-32778,
-32722,
-32711,
-32725,
-32793,
-32884,
-32920,
-32855,
-32774,
-32745,
-32788,
-32819,
-32829,
-32820,
-32809,
-32761,
-32729,
-32804,
-32900,
-32856,
-32722,
-32684,
-32767,
-32814,
-32813,
-32845,
-32861,
-32779,
-32632,
-32587,
-32649,
-32698,
-32707,
-32753,
-32844,
-32853,
-32771,
-32721,
-32767,
-32806,
-32772,
-32754,
-32835,
-32940,
-32904,
-32784,
-32723,
-32732,
-32771,
-32831,
-32883,
-32872,
-32856,
-32886,
-32917,
-32857,
-32757,
-32644,
-32602,
-32638,
-32667,
-32650,
-32690,
-32814,
-32859,
-32771,
-32661,
-32681,
-32799,
-32876,
-32800,
-32691,
-32690,
-32779,
-32782,
-32732,
-32699,
-32716,
-32703,
-32692,
-32711,
-32773,
-32815,
-32865,
-32916,
-32869,
-32675,
-32558,
-32624,
-32727,
-32707,
-32639,
-32644,
-32743,
-32846,
-32797,
-32707,
-32773,
-32928,
-32911,
-32789,
-32746,
-32748,
-32709,
-32714,
-32703,
-32665,
-32681,
-32777,
-32822,
-32811,
-32772,
-32651,
-32636,
-32728,
-32725,
-32627,
-32719,
-32841,
-32767,
-32662,
-32695,
-32660,
-32626,
-32785,
-32904,
-32814,
-32773,
-32891,
-32948,
-32904,
-32845,
-32799,
-32847,
-32905,
-32830,
-32749,
-32831,
-32871,
-32774,
-32784,
-32855,
-32770,
-32687,
-32711,
-32697,
-32604,
-32629,
-32673,
-32670,
-32711,
-32757,
-32686,
-32650,
-32690,
-32699,
-32676,
-32663,
-32612,
-32583,
-32668,
-32740,
-32719,
-32750,
-32797,
-32806,
-32828,
-32832,
-32731,
-32731,
-32861,
-32875,
-32781,
-32802,
-32830,
-32750,
-32784,
-32903,
-32841,
-32693,
-32796,
-32971,
-32888,
-32696,
-32705,
-32905,
-32985,
-32859,
-32722,
-32729,
-32737,
-32629,
-32589,
-32704,
-32836,
-32877,
-32901,
-32871,
-32769,
-32655,
-32655,
-32745,
-32795,
-32734,
-32675,
-32749,
-32856,
-32880,
-32828,
-32803,
-32827,
-32861,
-32776,
-32609,
-32656,
-32917,
-32981,
-32833,
-32831,
-32914,
-32827,
-32729,
-32786,
-32761,
-32703,
-32803,
-32854,
-32738,
-32701,
-32814,
-32818,
-32765,
-32800,
-32782,
-32716,
-32781,
-32887,
-32870,
-32897,
-32965,
-32907,
-32787,
-32787,
-32718,
-32576,
-32629,
-32832,
-32863,
-32761,
-32768,
-32825,
-32829,
-32835,
-32830,
-32767,
-32764,
-32823,
-32742,
-32558,
-32556,
-32710,
-32744,
-32716,
-32793,
-32852,
-32745,
-32651,
-32743,
-32805,
-32692,
-32641,
-32801,
-32934,
-32798,
-32593,
-32561,
-32664,
-32715,
-32677,
-32641,
-32676,
-32797,
-32878,
-32817,
-32738,
-32751,
-32821,
-32852,
-32844,
-32790,
-32706,
-32741,
-32834,
-32799,
-32658,
-32620,
-32725,
-32813,
-32826,
-32756,
-32674,
-32700,
-32791,
-32813,
-32756,
-32731,
-32776,
-32859,
-32888,
-32812,
-32707,
-32744,
-32790,
-32705,
-32614,
-32643,
-32702,
-32707,
-32676,
-32631,
-32606,
-32649,
-32684,
-32684,
-32742,
-32764,
-32724,
-32790,
-32903,
-32813,
-32676,
-32766,
-32858,
-32716,
-32547,
-32567,
-32633,
-32675,
-32712,
-32738,
-32779,
-32823,
-32791,
-32744,
-32734,
-32707,
-32692,
-32791,
-32829,
-32717,
-32691,
-32769,
-32719,
-32620,
-32641,
-32661,
-32662,
-32754,
-32830,
-32772,
-32765,
-32821,
-32805,
-32782,
-32753,
-32600,
-32528,
-32717,
-32882,
-32807,
-32728,
-32836,
-32960,
-32945,
-32847,
-32833,
-32939,
-32952,
-32774,
-32672,
-32764,
-32849,
-32819,
-32764,
-32731,
-32736,
-32767,
-32776,
-32861,
-32963,
-32846,
-32664,
-32797,
-32994,
-32787,
-32553,
-32677,
-32789,
-32763,
-32812,
-32824,
-32714,
-32862,
-33065,
-32822,
-32486,
-32571,
-32735,
-32630,
-32515,
-32571,
-32712,
-32828,
-32782,
-32638,
-32675,
-32777,
-32770,
-32824,
-32945,
-32828,
-32737,
-32951,
-33037,
-32808,
-32679,
-32696,
-32633,
-32622,
-32745,
-32869,
-33074,
-33313,
-33222,
-32976,
-32848,
-32736,
-32630,
-32673,
-32613,
-32380,
-32369,
-32467,
-32393,
-32538,
-32883,
-32831,
-32638,
-32808,
-32733,
-32319,
-32376,
-32716,
-32470,
-32159,
-32414,
-32570,
-32493,
-32774,
-33034,
-32728,
-32564,
-32941,
-33107,
-32889,
-32906,
-33060,
-32872,
-32529,
-32580,
-32903,
-32992,
-32784,
-32805,
-33075,
-33011,
-32693,
-32841,
-33194,
-33039,
-32719,
-32806,
-32859,
-32564,
-32427,
-32503,
-32429,
-32375,
-32603,
-32780,
-32710,
-32586,
-32490,
-32517,
-32792,
-32955,
-32715,
-32514,
-32669,
-32705,
-32476,
-32581,
-33033,
-33130,
-32893,
-32862,
-32976,
-32810,
-32628,
-32635,
-32550,
-32379,
-32488,
-32674,
-32644,
-32670,
-32821,
-32703,
-32555,
-32900,
-33268,
-33087,
-32773,
-32744,
-32695,
-32442,
-32347,
-32505,
-32721,
-32873,
-32991,
-33143,
-33316,
-33222,
-32951,
-32926,
-33074,
-32939,
-32801,
-33062,
-33229,
-32874,
-32513,
-32525,
-32562,
-32385,
-32273,
-32435,
-32778,
-33056,
-33061,
-33021,
-33139,
-33103,
-32621,
-32240,
-32426,
-32782,
-32809,
-32644,
-32696,
-32902,
-32925,
-32629,
-32399,
-32534,
-32703,
-32641,
-32623,
-32804,
-32771,
-32532,
-32575,
-32833,
-32772,
-32547,
-32612,
-32797,
-32674,
-32398,
-32447,
-32815,
-33109,
-33042,
-32813,
-32748,
-32848,
-32744,
-32531,
-32538,
-32712,
-32698,
-32690,
-32932,
-33067,
-32837,
-32711,
-32927,
-32911,
-32459,
-32188,
-32415,
-32769,
-32913,
-32822,
-32588,
-32538,
-32891,
-33184,
-33084,
-32982,
-33131,
-33072,
-32745,
-32655,
-32779,
-32741,
-32805,
-33124,
-33104,
-32552,
-32323,
-32754,
-33030,
-32722,
-32501,
-32681,
-32796,
-32718,
-32897,
-33212,
-33008,
-32565,
-32720,
-33318,
-33439,
-33097,
-33029,
-33149,
-32911,
-32536,
-32427,
-32513,
-32718,
-33064,
-33166,
-32838,
-32620,
-32856,
-33006,
-32825,
-32794,
-33071,
-33258,
-33142,
-32871,
-32659,
-32679,
-32952,
-33137,
-33095,
-33120,
-33318,
-33325,
-32963,
-32586,
-32467,
-32600,
-32934,
-33275,
-33284,
-33068,
-33052,
-33138,
-32922,
-32582,
-32562,
-32601,
-32410,
-32334,
-32493,
-32526,
-32520,
-32773,
-32990,
-32869,
-32789,
-32905,
-33008,
-33281,
-33717,
-33616,
-33113,
-33229,
-33709,
-33329,
-32447,
-32234,
-32445,
-32490,
-32808,
-33469,
-33550,
-33086,
-33007,
-33192,
-32983,
-32664,
-32833,
-33272,
-33413,
-33051,
-32553,
-32543,
-32967,
-33035,
-32654,
-32684,
-33179,
-33315,
-32934,
-32690,
-32704,
-32628,
-32366,
-32181,
-32321,
-32670,
-32719,
-32547,
-32874,
-33428,
-33261,
-32801,
-33073,
-33225,
-32353,
-31753,
-32221,
-32168,
-31281,
-31522,
-32858,
-33286,
-32995,
-33450,
-33937,
-33529,
-33442,
-34150,
-34187,
-33235,
-32697,
-33215,
-34096,
-34277,
-33228,
-32044,
-32130,
-32780,
-32876,
-33226,
-33998,
-33689,
-32827,
-32686,
-31988,
-30644,
-31362,
-33069,
-32348,
-30827,
-29444,
-23147,
-13493,
-10480,
-12926,
-11618,
-13650,
-31591,
-53867,
-61140,
-58641,
-60209,
-61837,
-57357,
-54557,
-57939,
-60665,
-60194,
-60059,
-59647,
-57659,
-56558,
-56627,
-56420,
-56700,
-56332,
-53784,
-53410,
-55206,
-47290,
-26214,
-8021,
-3152,
-3145,
-1669,
-2706,
-5210,
-4322,
-3078,
-4837,
-6031,
-5745,
-6772,
-7439,
-6569,
-7770,
-9909,
-8823,
-8415,
-12000,
-12971,
-11405,
-20416,
-41560,
-57820,
-60949,
-60498,
-62635,
-63268,
-61397,
-60626,
-60733,
-59490,
-57808,
-57165,
-57400,
-58143,
-58190,
-56362,
-54693,
-55120,
-54941,
-53070,
-53417,
-53181,
-41540,
-19731,
-4187,
-1687,
-2472,
-1062,
-1497,
-3502,
-3634,
-3660,
-5131,
-5874,
-6434,
-8145,
-8560,
-7952,
-9432,
-10384,
-8389,
-8867,
-12527,
-12093,
-12292,
-26919,
-50283,
-62430,
-61935,
-62434,
-65310,
-63973,
-61528,
-62339,
-62297,
-59642,
-58422,
-58391,
-56818,
-55444,
-55441,
-55047,
-55246,
-56480,
-54922,
-52142,
-53482,
-51652,
-34774,
-11541,
-1055,
-2655,
-2805,
-430,
-1455,
-3450,
-3335,
-4251,
-6646,
-7511,
-7815,
-9107,
-9471,
-8969,
-9254,
-8952,
-8122,
-9404,
-10248,
-8663,
-14315,
-34093,
-54920,
-62003,
-60609,
-61553,
-63150,
-61826,
-60948,
-61398,
-60140,
-58564,
-58833,
-58633,
-57164,
-56606,
-56334,
-55479,
-56066,
-56926,
-55303,
-54560,
-55519,
-47387,
-25766,
-6219,
-1814,
-4501,
-3554,
-1844,
-3227,
-4371,
-4316,
-5522,
-6648,
-6333,
-6852,
-8009,
-7853,
-8416,
-10524,
-10470,
-8966,
-10022,
-11002,
-11006,
-20500,
-42564,
-60632,
-63340,
-60514,
-61657,
-62733,
-61355,
-61410,
-62250,
-61023,
-59834,
-59954,
-59165,
-58001,
-57757,
-56483,
-54719,
-55393,
-55937,
-53964,
-54084,
-54643,
-43141,
-19667,
-3057,
-2033,
-5038,
-4321,
-4145,
-5294,
-4315,
-3226,
-4246,
-5026,
-5654,
-7752,
-8602,
-7365,
-8064,
-9987,
-9346,
-8980,
-11000,
-10631,
-11107,
-24574,
-47770,
-62012,
-62465,
-60888,
-61807,
-60939,
-59355,
-59881,
-60007,
-59027,
-59416,
-59612,
-57651,
-56409,
-57038,
-56871,
-56530,
-57300,
-56351,
-54149,
-54679,
-51932,
-35873,
-13768,
-2639,
-3417,
-4717,
-3977,
-4730,
-5260,
-4190,
-4393,
-5546,
-5393,
-5864,
-7654,
-7594,
-6410,
-7154,
-7863,
-7404,
-9407,
-12147,
-11254,
-14577,
-31909,
-53484,
-62866,
-62132,
-62302,
-63419,
-61813,
-60584,
-61286,
-61051,
-60260,
-60407,
-59472,
-57800,
-58513,
-59696,
-58377,
-57404,
-57774,
-55945,
-54063,
-55329,
-50499,
-31446,
-10356,
-2745,
-4157,
-3672,
-2417,
-3921,
-4923,
-4172,
-4207,
-4592,
-4552,
-5934,
-7476,
-6774,
-6150,
-6855,
-6167,
-5956,
-9716,
-12083,
-10303,
-16350,
-36771,
-56599,
-62347,
-60860,
-61683,
-62727,
-61528,
-60743,
-60855,
-60695,
-61035,
-60887,
-58903,
-57725,
-58717,
-58925,
-58434,
-59502,
-58994,
-55219,
-54325,
-55863,
-47136,
-25803,
-8048,
-3747,
-4684,
-3702,
-3674,
-5663,
-6285,
-5519,
-5233,
-5123,
-5517,
-7009,
-7624,
-7031,
-7543,
-8156,
-6926,
-7225,
-10069,
-9685,
-8662,
-20144,
-43500,
-60014,
-61872,
-60242,
-61429,
-60634,
-58129,
-58543,
-60027,
-59749,
-59578,
-59397,
-57435,
-56446,
-57680,
-57573,
-56474,
-57393,
-57323,
-55076,
-56180,
-56492,
-42489,
-18282,
-4322,
-4745,
-6006,
-4403,
-5761,
-7826,
-6543,
-5718,
-7066,
-7156,
-7130,
-9048,
-9529,
-8082,
-8641,
-9390,
-7570,
-7755,
-10398,
-9331,
-10424,
-26471,
-49932,
-61120,
-59877,
-59513,
-61280,
-59916,
-58331,
-59165,
-59156,
-58356,
-59143,
-59172,
-57462,
-57283,
-57853,
-56537,
-56224,
-58009,
-57226,
-55249,
-56749,
-53512,
-35439,
-13229,
-4323,
-6037,
-6026,
-4066,
-4840,
-5951,
-5360,
-5426,
-6115,
-6236,
-7198,
-8375,
-7712,
-7511,
-9456,
-9958,
-8759,
-9641,
-10094,
-7910,
-13557,
-34087,
-55337,
-61968,
-59753,
-60109,
-61700,
-60791,
-60115,
-60668,
-60207,
-59375,
-59009,
-57956,
-57464,
-58592,
-58137,
-55803,
-55637,
-56478,
-54870,
-54701,
-56676,
-48955,
-27317,
-7878,
-3056,
-4777,
-3652,
-2497,
-3856,
-4552,
-4399,
-5531,
-6668,
-6742,
-6817,
-6516,
-6052,
-7774,
-10173,
-10007,
-9921,
-12157,
-11868,
-10253,
-19741,
-41981,
-59954,
-63572,
-61939,
-63033,
-63581,
-61997,
-61501,
-61458,
-59611,
-57952,
-58205,
-59015,
-59660,
-59526,
-57421,
-55409,
-55634,
-55046,
-52838,
-54050,
-55145,
-43358,
-20172,
-3938,
-2087,
-4053,
-3345,
-3492,
-4727,
-4207,
-3949,
-5888,
-7459,
-7399,
-7020,
-6566,
-6743,
-8575,
-9670,
-8761,
-9687,
-12271,
-11413,
-12093,
-26307,
-49396,
-62912,
-62907,
-61319,
-62521,
-61945,
-60594,
-61499,
-61754,
-59573,
-57977,
-57730,
-57398,
-57702,
-58019,
-56696,
-56078,
-57378,
-56570,
-54065,
-54439,
-51344,
-34296,
-11537,
-926,
-2301,
-3248,
-2039,
-3221,
-4399,
-3421,
-3867,
-6203,
-7346,
-7848,
-8765,
-8559,
-8365,
-9884,
-10209,
-8720,
-9652,
-11471,
-10452,
-15095,
-34346,
-56739,
-65430,
-63603,
-63123,
-64008,
-62642,
-62089,
-63159,
-61997,
-59345,
-58266,
-57577,
-56708,
-57433,
-57995,
-56446,
-55585,
-55892,
-54336,
-53435,
-55043,
-48933,
-28403,
-7265,
-598,
-2979,
-3129,
-1981,
-3075,
-3708,
-3214,
-4424,
-6412,
-6935,
-7170,
-7633,
-7263,
-7448,
-8963,
-9563,
-9591,
-10983,
-11073,
-10193,
-18533,
-39582,
-58623,
-63496,
-61363,
-62265,
-63960,
-62706,
-61298,
-61134,
-60180,
-58815,
-58488,
-58562,
-58836,
-59264,
-58286,
-56402,
-55976,
-55741,
-54264,
-54757,
-55207,
-44832,
-22979,
-6020,
-3279,
-5313,
-3822,
-2523,
-3927,
-4711,
-4634,
-5808,
-7086,
-7317,
-7226,
-6548,
-5956,
-7666,
-9991,
-9902,
-9732,
-11091,
-10219,
-10356,
-22920,
-45697,
-60760,
-61648,
-59977,
-62076,
-62689,
-60678,
-60184,
-60523,
-59473,
-58649,
-58640,
-58229,
-58476,
-59370,
-58331,
-56567,
-56773,
-56384,
-54200,
-54356,
-52956,
-38906,
-16413,
-3624,
-4188,
-5369,
-2970,
-3107,
-5354,
-5273,
-4747,
-6065,
-7114,
-7496,
-8188,
-7570,
-6134,
-6941,
-8551,
-8612,
-9895,
-12312,
-11723,
-14097,
-30098,
-52288,
-62636,
-60869,
-60081,
-62370,
-61966,
-60493,
-61237,
-61423,
-59680,
-58486,
-57999,
-57508,
-58151,
-58735,
-57493,
-56740,
-57082,
-55271,
-53288,
-54419,
-50051,
-31531,
-10162,
-2319,
-4527,
-4643,
-2877,
-3822,
-4717,
-3593,
-3751,
-5591,
-6643,
-7171,
-7724,
-7529,
-7754,
-8921,
-8844,
-8618,
-10913,
-12065,
-10477,
-16870,
-37248,
-57459,
-63460,
-61451,
-61812,
-62630,
-60991,
-60482,
-61549,
-60618,
-58656,
-58243,
-58198,
-57788,
-57786,
-57100,
-55970,
-56528,
-56764,
-54362,
-53753,
-55044,
-46535,
-24949,
-6629,
-3135,
-5684,
-4985,
-4197,
-5459,
-5315,
-4537,
-6038,
-7535,
-7095,
-6843,
-7273,
-7555,
-8810,
-9895,
-8530,
-8125,
-11035,
-11803,
-11322,
-21840,
-43829,
-59381,
-60339,
-58006,
-59636,
-60590,
-59647,
-60153,
-60668,
-59311,
-58564,
-59032,
-58818,
-58486,
-58262,
-56761,
-56160,
-58023,
-57793,
-54490,
-54184,
-53813,
-41219,
-19257,
-5849,
-5785,
-7297,
-5386,
-4927,
-6020,
-5338,
-4583,
-5667,
-6630,
-6717,
-6898,
-6694,
-6703,
-7996,
-8365,
-7040,
-8041,
-10851,
-10385,
-11953,
-26833,
-49250,
-61195,
-60245,
-58853,
-60711,
-60580,
-59235,
-60118,
-60873,
-59529,
-58477,
-58410,
-58268,
-58587,
-58898,
-58033,
-57894,
-58768,
-57215,
-54924,
-56143,
-53402,
-36362,
-13977,
-3816,
-5087,
-5548,
-3955,
-4995,
-6152,
-5007,
-4948,
-6655,
-7249,
-7108,
-7257,
-6647,
-6350,
-7483,
-7628,
-7136,
-9260,
-10702,
-8514,
-12944,
-32268,
-53781,
-61741,
-60406,
-60579,
-61647,
-60606,
-60269,
-60975,
-59823,
-57964,
-57764,
-58083,
-58372,
-59018,
-58442,
-57029,
-57495,
-57785,
-55235,
-54566,
-56814,
-50261,
-29651,
-9783,
-3733,
-5206,
-4661,
-3615,
-4685,
-5365,
-5245,
-6284,
-7441,
-7410,
-7244,
-7233,
-7238,
-8290,
-9147,
-7966,
-7862,
-10720,
-11131,
-9195,
-17280,
-38863,
-57769,
-62209,
-60361,
-61388,
-62366,
-60737,
-59928,
-60403,
-59746,
-58830,
-58821,
-58607,
-58364,
-58288,
-57001,
-55893,
-57097,
-57118,
-54232,
-54310,
-55981,
-45824,
-22766,
-5423,
-3400,
-5513,
-3748,
-2920,
-4781,
-5203,
-4591,
-5376,
-6052,
-5936,
-6312,
-6468,
-6563,
-8378,
-9723,
-8494,
-8871,
-11720,
-10913,
-10231,
-23205,
-46960,
-61751,
-61874,
-60105,
-62135,
-62413,
-60578,
-60654,
-61358,
-60550,
-59921,
-59969,
-59720,
-59804,
-59516,
-57547,
-56328,
-57014,
-55855,
-53690,
-55451,
-54513,
-38858,
-15248,
-2896,
-3968,
-5321,
-3395,
-3760,
-5533,
-4973,
-4300,
-5440,
-5983,
-5267,
-4821,
-4755,
-5562,
-7713,
-8726,
-8201,
-9487,
-11053,
-9374,
-12527,
-30385,
-53084,
-62801,
-60981,
-60560,
-62628,
-61650,
-59867,
-60469,
-60582,
-59311,
-59445,
-60745,
-61382,
-61481,
-60382,
-58107,
-57658,
-58650,
-57244,
-55837,
-57368,
-52381,
-32796,
-11126,
-3516,
-5544,
-5400,
-3909,
-5357,
-6497,
-5520,
-5604,
-6707,
-6451,
-5553,
-4807,
-4001,
-4880,
-7143,
-7077,
-5831,
-7346,
-8342,
-6896,
-13764,
-34895,
-55340,
-60847,
-58367,
-58829,
-60118,
-58877,
-58534,
-59759,
-59506,
-58643,
-59016,
-59493,
-60087,
-61170,
-60384,
-58316,
-58913,
-60372,
-58826,
-57965,
-58512,
-49341,
-27357,
-9122,
-5963,
-8517,
-7485,
-6415,
-7622,
-7538,
-6432,
-6826,
-7169,
-6660,
-6915,
-6851,
-5743,
-6285,
-7803,
-6789,
-5666,
-7294,
-7593,
-7960,
-19571,
-41826,
-57261,
-58418,
-56207,
-57516,
-58156,
-57178,
-57638,
-58258,
-57543,
-57511,
-58054,
-57569,
-57612,
-58525,
-57850,
-56791,
-57861,
-58337,
-57076,
-57718,
-56083,
-41891,
-19865,
-7301,
-7727,
-9494,
-7948,
-7519,
-8304,
-7862,
-7825,
-8854,
-8777,
-8283,
-8883,
-9020,
-8532,
-9269,
-9806,
-8874,
-9274,
-10472,
-9101,
-11575,
-27468,
-49032,
-59335,
-57932,
-56750,
-58349,
-58103,
-57107,
-57645,
-57516,
-56349,
-56350,
-56525,
-55699,
-55668,
-56151,
-55363,
-54992,
-55692,
-54618,
-53598,
-55673,
-52408,
-34796,
-13497,
-5315,
-7808,
-8616,
-6928,
-7386,
-8103,
-7428,
-7984,
-9389,
-9398,
-9402,
-10116,
-9729,
-9323,
-10461,
-10678,
-9901,
-11249,
-12048,
-9896,
-14686,
-33884,
-54265,
-60265,
-57144,
-56877,
-58605,
-57935,
-57264,
-57801,
-57183,
-56199,
-56322,
-55774,
-54833,
-55515,
-56058,
-55070,
-55219,
-55976,
-54348,
-53748,
-55563,
-49002,
-28707,
-9681,
-5452,
-8579,
-8381,
-7062,
-8086,
-8585,
-8102,
-8760,
-9346,
-9225,
-10279,
-11127,
-9870,
-9297,
-10423,
-10032,
-9282,
-10918,
-11084,
-9838,
-18576,
-39784,
-56907,
-59403,
-56627,
-57275,
-58059,
-56934,
-56724,
-56935,
-56110,
-55972,
-56130,
-54799,
-54247,
-55709,
-55866,
-54807,
-55749,
-56362,
-54535,
-54706,
-55067,
-44094,
-22493,
-7502,
-6351,
-8591,
-7701,
-7475,
-8696,
-8609,
-8400,
-9263,
-9449,
-9560,
-10891,
-11161,
-9818,
-9864,
-10629,
-9715,
-9609,
-11185,
-10314,
-10942,
-24090,
-46102,
-59350,
-59166,
-56962,
-57924,
-57783,
-56653,
-57328,
-57699,
-56395,
-55786,
-55731,
-54750,
-54706,
-55980,
-55823,
-54966,
-55560,
-55299,
-54028,
-55224,
-53343,
-38104,
-16146,
-5167,
-6709,
-8312,
-6944,
-7479,
-8539,
-7534,
-7464,
-9058,
-9374,
-9392,
-10670,
-10723,
-9421,
-9771,
-10658,
-10279,
-11092,
-12223,
-10658,
-13971,
-31149,
-52242,
-60636,
-58480,
-57723,
-58914,
-57887,
-57154,
-58186,
-57836,
-56588,
-56622,
-56051,
-54479,
-54955,
-56397,
-55784,
-54851,
-54834,
-53558,
-53087,
-54942,
-49739,
-30990,
-11377,
-5273,
-7628,
-7708,
-6503,
-7492,
-8072,
-7515,
-8194,
-8961,
-8625,
-9497,
-11023,
-10285,
-9017,
-9885,
-10774,
-10961,
-12260,
-12246,
-10845,
-18079,
-37999,
-56120,
-60234,
-57678,
-58252,
-59544,
-58398,
-57759,
-58005,
-57060,
-56420,
-56741,
-55557,
-54027,
-54964,
-56073,
-55061,
-54287,
-54033,
-52781,
-53361,
-54544,
-45475,
-24383,
-7550,
-5153,
-7819,
-6892,
-5957,
-7285,
-7659,
-7567,
-8834,
-9394,
-9097,
-10404,
-11689,
-10661,
-10053,
-11119,
-11338,
-11496,
-12678,
-11433,
-10756,
-22102,
-44107,
-59039,
-59767,
-57379,
-58634,
-59185,
-57886,
-57604,
-57200,
-55705,
-55482,
-55837,
-54500,
-53511,
-54324,
-54393,
-53727,
-54218,
-53897,
-52713,
-54501,
-54165,
-40435,
-18197,
-5516,
-6080,
-7916,
-6531,
-6563,
-7877,
-7996,
-8724,
-10307,
-10302,
-10125,
-11641,
-12343,
-11512,
-11744,
-12141,
-11216,
-11656,
-12656,
-10535,
-12345,
-28484,
-50501,
-60522,
-58636,
-57328,
-58673,
-58083,
-57052,
-57209,
-56025,
-54339,
-54670,
-54712,
-53206,
-53127,
-54046,
-53329,
-53135,
-54526,
-54023,
-53260,
-55410,
-51638,
-33264,
-12176,
-4813,
-7398,
-8060,
-6997,
-8055,
-8762,
-8513,
-9877,
-11211,
-10715,
-11153,
-12635,
-12178,
-11359,
-12314,
-12124,
-10678,
-11578,
-12151,
-10214,
-15986,
-35810,
-55428,
-60543,
-57681,
-57502,
-58201,
-56798,
-56288,
-56518,
-55001,
-53892,
-54464,
-53889,
-52827,
-53834,
-54484,
-53277,
-53636,
-54941,
-53781,
-53554,
-55121,
-47308,
-26336,
-8459,
-5471,
-8442,
-8092,
-7575,
-8888,
-8867,
-8708,
-10519,
-11500,
-10986,
-11778,
-12468,
-11028,
-10620,
-11982,
-11512,
-10698,
-12325,
-12244,
-11269,
-21220,
-42891,
-58710,
-59907,
-57119,
-57771,
-57914,
-56701,
-57051,
-57134,
-55464,
-54911,
-55244,
-54118,
-53722,
-55284,
-55280,
-53872,
-54359,
-54598,
-52910,
-53598,
-53625,
-41366,
-19360,
-5655,
-5875,
-8470,
-7685,
-7760,
-8956,
-8750,
-8980,
-10351,
-10487,
-10308,
-11366,
-11278,
-9841,
-10375,
-11777,
-11243,
-11302,
-12603,
-11355,
-12628,
-26984,
-48686,
-60068,
-58679,
-56585,
-57790,
-57702,
-56475,
-56336,
-55773,
-54732,
-54991,
-55118,
-54183,
-54635,
-55778,
-54753,
-53548,
-54284,
-54053,
-53186,
-54824,
-52138,
-35928,
-14958,
-5972,
-8299,
-9883,
-8546,
-8738,
-9641,
-9635,
-10357,
-11218,
-10747,
-10750,
-11455,
-10544,
-9561,
-10938,
-11980,
-11285,
-11846,
-12246,
-10202,
-14340,
-32246,
-52374,
-59300,
-56447,
-55285,
-56352,
-55957,
-55555,
-55827,
-54982,
-54272,
-54885,
-54790,
-54235,
-55330,
-56056,
-54607,
-53873,
-54297,
-53278,
-53287,
-55341,
-49509,
-30341,
-11445,
-6334,
-9363,
-10034,
-9116,
-9613,
-9703,
-9330,
-10291,
-10969,
-10327,
-10423,
-10858,
-9833,
-9375,
-10725,
-11302,
-11286,
-12486,
-11947,
-10257,
-18051,
-38318,
-55903,
-59405,
-56412,
-56296,
-57146,
-56456,
-56435,
-56677,
-55472,
-54622,
-54914,
-54394,
-53718,
-54301,
-54069,
-52399,
-51686,
-51308,
-50154,
-51373,
-52685,
-43265,
-22876,
-7645,
-6246,
-9292,
-8929,
-8316,
-9348,
-9452,
-9220,
-10222,
-10615,
-10039,
-10218,
-10215,
-9118,
-9220,
-10600,
-10962,
-11400,
-12505,
-11105,
-10905,
-22456,
-43183,
-56309,
-56313,
-54004,
-55189,
-55543,
-54376,
-54541,
-54750,
-53702,
-53423,
-53728,
-53139,
-53334,
-54636,
-54338,
-53057,
-53012,
-52407,
-51280,
-52842,
-51729,
-37991,
-17458,
-6697,
-7703,
-9094,
-7611,
-7732,
-8852,
-8533,
-8700,
-9921,
-10179,
-10227,
-10997,
-10589,
-9453,
-10105,
-11234,
-11228,
-12145,
-12935,
-11168,
-13971,
-29696,
-49491,
-57938,
-56220,
-55472,
-57015,
-56659,
-55809,
-56244,
-55706,
-54236,
-53845,
-53601,
-52981,
-53666,
-54683,
-53924,
-53033,
-52875,
-51678,
-51376,
-53308,
-48853,
-31625,
-12960,
-6725,
-8996,
-9245,
-7769,
-8323,
-8930,
-8492,
-9317,
-10821,
-11200,
-11571,
-12072,
-11148,
-10308,
-11180,
-11899,
-12215,
-13694,
-13615,
-11748,
-17903,
-36469,
-53891,
-58024,
-55398,
-55709,
-57026,
-56176,
-55766,
-56215,
-55232,
-53983,
-53782,
-53209,
-52847,
-54104,
-54750,
-53634,
-53117,
-52674,
-50885,
-51329,
-53073,
-45177,
-25499,
-9549,
-7231,
-9780,
-8939,
-7993,
-9197,
-9500,
-9193,
-10237,
-11139,
-11247,
-11986,
-12157,
-10727,
-10377,
-11559,
-11847,
-12464,
-14355,
-13559,
-12395,
-22192,
-42514,
-56758,
-57500,
-55118,
-56335,
-56898,
-55534,
-55443,
-55661,
-54488,
-53855,
-53958,
-53222,
-53267,
-54770,
-54916,
-53762,
-53688,
-52981,
-51251,
-52534,
-52830,
-41013,
-20337,
-7959,
-8411,
-10388,
-9018,
-8857,
-10102,
-9905,
-9946,
-11268,
-11655,
-11505,
-12242,
-12041,
-10645,
-10743,
-11655,
-11588,
-12563,
-14043,
-12425,
-13478,
-27324,
-47752,
-57960,
-56448,
-54887,
-56342,
-56152,
-55026,
-55341,
-54972,
-53539,
-53359,
-53490,
-52633,
-52871,
-54123,
-53878,
-53283,
-53593,
-52538,
-51433,
-53331,
-50796,
-34954,
-15057,
-7108,
-9394,
-10282,
-8814,
-9425,
-10351,
-9912,
-10526,
-11798,
-11695,
-11809,
-12786,
-12290,
-11182,
-11668,
-12026,
-11669,
-12980,
-13594,
-11525,
-15860,
-33485,
-52306,
-57980,
-55227,
-54958,
-56301,
-55402,
-54672,
-55183,
-54514,
-53473,
-53587,
-53181,
-52376,
-53198,
-54082,
-53381,
-53191,
-53377,
-51945,
-51933,
-53833,
-47403,
-28385,
-11028,
-7375,
-10243,
-9979,
-8888,
-10040,
-10554,
-10002,
-10699,
-11612,
-11681,
-12347,
-12886,
-11803,
-11158,
-11944,
-12079,
-12291,
-13903,
-13426,
-12132,
-20682,
-40489,
-56007,
-57934,
-55302,
-56115,
-56897,
-55565,
-55331,
-55903,
-55008,
-54097,
-53975,
-53237,
-52906,
-54078,
-54496,
-53623,
-53576,
-53146,
-51546,
-52356,
-52791,
-42132,
-21838,
-8350,
-8011,
-10188,
-8826,
-8394,
-9756,
-9595,
-9242,
-10508,
-11292,
-11217,
-11923,
-12022,
-10812,
-10788,
-11748,
-11697,
-12422,
-14071,
-12890,
-13420,
-26104,
-46551,
-57980,
-57217,
-55711,
-57360,
-57317,
-56006,
-56405,
-56499,
-55022,
-54384,
-54423,
-53730,
-53858,
-54923,
-54617,
-53772,
-53863,
-52746,
-51310,
-52940,
-51290,
-36698,
-16446,
-6953,
-8538,
-9533,
-7856,
-8356,
-9615,
-9038,
-9130,
-10675,
-11176,
-11090,
-11622,
-11298,
-10446,
-11030,
-11696,
-11589,
-12953,
-14059,
-12169,
-15234,
-31619,
-51410,
-59016,
-56903,
-56492,
-58011,
-57017,
-55893,
-56609,
-56272,
-54774,
-54527,
-54574,
-54063,
-54486,
-54985,
-54086,
-53711,
-53942,
-52392,
-51722,
-53720,
-48923,
-30805,
-11850,
-6043,
-8324,
-8278,
-7192,
-8544,
-9332,
-8613,
-9300,
-10708,
-10774,
-10746,
-11077,
-10546,
-10477,
-11626,
-11775,
-11620,
-13252,
-13386,
-11602,
-18367,
-37847,
-55594,
-59639,
-57215,
-57595,
-58266,
-56700,
-56389,
-57208,
-56111,
-54620,
-54719,
-54661,
-54269,
-54777,
-54587,
-53306,
-53380,
-53564,
-51906,
-52212,
-53581,
-44776,
-24171,
-8070,
-5903,
-8254,
-7556,
-7590,
-9367,
-9154,
-8384,
-9833,
-11079,
-10789,
-10977,
-11252,
-10683,
-11223,
-12494,
-12172,
-12303,
-14028,
-13124,
-12420,
-23448,
-44702,
-58882,
-59481,
-57329,
-58185,
-57665,
-55836,
-56380,
-57018,
-55320,
-54122,
-54458,
-54235,
-54118,
-54770,
-54124,
-52946,
-53345,
-52972,
-51377,
-52699,
-52419,
-39184,
-17549,
-5419,
-6219,
-7936,
-6884,
-7962,
-9754,
-8927,
-8613,
-10473,
-11318,
-10984,
-11413,
-11354,
-10769,
-11774,
-12854,
-12350,
-13148,
-14557,
-12757,
-14322,
-29636,
-50972,
-60948,
-59302,
-58003,
-58964,
-57511,
-55810,
-56492,
-56403,
-54623,
-54075,
-54356,
-53987,
-54263,
-54750,
-53616,
-52735,
-53132,
-52065,
-50999,
-52888,
-49701,
-32643,
-12005,
-4044,
-6339,
-7154,
-6304,
-8024,
-9513,
-8958,
-9601,
-11313,
-11415,
-11118,
-11503,
-11038,
-10794,
-12212,
-12837,
-12362,
-13687,
-14393,
-12536,
-17598,
-36199,
-55587,
-61446,
-58859,
-58348,
-58829,
-57042,
-55928,
-56214,
-55081,
-53609,
-53834,
-54101,
-53808,
-54308,
-54272,
-52900,
-52695,
-53127,
-51806,
-51664,
-53159,
-46037,
-26255,
-8382,
-4487,
-7272,
-7388,
-7209,
-9083,
-9712,
-9474,
-11024,
-12299,
-11635,
-11382,
-11770,
-11272,
-11508,
-12859,
-12728,
-12313,
-13658,
-13239,
-12198,
-21472,
-42164,
-58017,
-59954,
-57299,
-57576,
-57395,
-55755,
-55761,
-55916,
-54141,
-53222,
-54122,
-54239,
-53832,
-54186,
-53753,
-52742,
-53214,
-53328,
-52020,
-52972,
-53111,
-41592,
-20449,
-6644,
-6311,
-8784,
-8260,
-8717,
-10152,
-9603,
-9431,
-11310,
-11909,
-10829,
-10888,
-11427,
-11155,
-11673,
-12450,
-11866,
-12189,
-13580,
-12254,
-13147,
-26836,
-48110,
-59634,
-58649,
-56714,
-57477,
-56714,
-55632,
-56516,
-56315,
-54352,
-54069,
-55023,
-54800,
-54508,
-54592,
-53641,
-53048,
-53726,
-52856,
-51614,
-53416,
-51175,
-35455,
-14738,
-5529,
-7343,
-8769,
-8032,
-8962,
-9707,
-8809,
-9360,
-11210,
-11338,
-10640,
-10863,
-10951,
-11117,
-12242,
-12407,
-11723,
-12980,
-13804,
-11709,
-15553,
-33004,
-52835,
-59979,
-57773,
-57024,
-57829,
-56809,
-56333,
-57097,
-56147,
-54360,
-54349,
-54789,
-54519,
-54623,
-54394,
-53328,
-53532,
-54078,
-52464,
-52048,
-54099,
-48371,
-29395,
-10803,
-5696,
-8053,
-8103,
-7415,
-8555,
-8729,
-8110,
-9475,
-11086,
-10912,
-10787,
-11208,
-11024,
-11368,
-12339,
-11841,
-11574,
-13445,
-13245,
-11457,
-19386,
-39728,
-56773,
-59983,
-57639,
-58057,
-58440,
-57084,
-57020,
-57350,
-55745,
-54329,
-54517,
-54399,
-53954,
-54197,
-53839,
-53168,
-53847,
-53713,
-51868,
-52694,
-53856,
-43723,
-22494,
-7113,
-5579,
-7840,
-7003,
-6942,
-8503,
-8388,
-8170,
-9992,
-11202,
-10841,
-11178,
-11736,
-11452,
-11816,
-12362,
-11644,
-12191,
-14064,
-12611,
-12114,
-24479,
-46343,
-59737,
-59751,
-57792,
-58805,
-58434,
-56986,
-57281,
-57115,
-55257,
-54457,
-54704,
-54009,
-53501,
-53792,
-53362,
-53134,
-53825,
-52753,
-51194,
-53348,
-52661,
-38079,
-16294,
-5082,
-6213,
-7856,
-6836,
-7552,
-8845,
-8402,
-8761,
-10466,
-10933,
-10781,
-11615,
-11993,
-11807,
-12425,
-12557,
-12044,
-13537,
-14652,
-11998,
-14049,
-30485,
-51661,
-60768,
-58975,
-57885,
-58817,
-57786,
-56777,
-57381,
-56716,
-54915,
-54535,
-54508,
-53592,
-53268,
-53277,
-52554,
-52728,
-53237,
-51470,
-50722,
-53504,
-49885,
-31855,
-11638,
-4776,
-7187,
-7719,
-6814,
-8010,
-8599,
-7886,
-8941,
-10777,
-11005,
-11246,
-12238,
-12247,
-12234,
-13087,
-12786,
-12375,
-14308,
-14580,
-11856,
-17414,
-36974,
-55851,
-60672,
-58210,
-58335,
-58962,
-57596,
-57366,
-57937,
-56432,
-54610,
-54352,
-53858,
-52988,
-53081,
-52835,
-52092,
-52722,
-52839,
-50785,
-51197,
-53516,
-45878,
-25442,
-8343,
-5379,
-7893,
-7249,
-6660,
-8153,
-8319,
-7837,
-9460,
-11161,
-11290,
-11763,
-12602,
-12601,
-13107,
-13879,
-13045,
-12870,
-14672,
-13751,
-12217,
-22118,
-43396,
-58615,
-59836,
-57549,
-58620,
-58826,
-57206,
-57041,
-57006,
-55197,
-53942,
-53913,
-53319,
-52805,
-52943,
-52146,
-51391,
-52254,
-52114,
-50765,
-52499,
-52862,
-40402,
-18765,
-5745,
-6060,
-8113,
-6758,
-6772,
-8472,
-8788,
-9240,
-11062,
-11951,
-11863,
-12466,
-12747,
-12508,
-13344,
-13876,
-12942,
-13326,
-14360,
-12214,
-13196,
-27911,
-49470,
-60281,
-58895,
-57422,
-58874,
-58387,
-56860,
-56896,
-56263,
-54354,
-53647,
-53710,
-53189,
-53209,
-53287,
-52077,
-51671,
-52649,
-51882,
-51115,
-53631,
-51205,
-34580,
-13612,
-4982,
-7018,
-7926,
-6641,
-7610,
-8964,
-8716,
-9437,
-11203,
-11634,
-11607,
-12256,
-12300,
-12398,
-13538,
-13558,
-12552,
-13584,
-14127,
-11783,
-15989,
-34230,
-53996,
-60290,
-58009,
-58108,
-59177,
-57560,
-56519,
-57038,
-56016,
-54252,
-53855,
-53587,
-53113,
-53435,
-53049,
-51833,
-52390,
-53346,
-52058,
-52102,
-54087,
-47466,
-27920,
-9707,
-5144,
-7531,
-7231,
-6411,
-8212,
-9226,
-8616,
-9634,
-11582,
-11974,
-11979,
-12476,
-12285,
-12283,
-13069,
-12623,
-12000,
-13477,
-13486,
-11986,
-20089,
-40654,
-57405,
-59787,
-57495,
-58745,
-59055,
-56873,
-56512,
-57035,
-55571,
-54339,
-54386,
-53717,
-53152,
-53579,
-52859,
-51840,
-52996,
-53397,
-51508,
-52257,
-53300,
-42787,
-21649,
-7063,
-6091,
-8397,
-7515,
-7330,
-8800,
-8944,
-8743,
-9918,
-10893,
-11323,
-12256,
-12556,
-11990,
-12467,
-13075,
-12211,
-12416,
-13970,
-12872,
-13348,
-26019,
-47023,
-59510,
-59303,
-57511,
-58784,
-58533,
-56853,
-56929,
-57002,
-55387,
-54283,
-54066,
-53377,
-53193,
-53520,
-52699,
-52158,
-53055,
-52390,
-50945,
-52726,
-51555,
-37043,
-16169,
-5722,
-6630,
-7722,
-6771,
-7776,
-9121,
-8628,
-8834,
-10404,
-11150,
-11298,
-11816,
-11945,
-12126,
-12881,
-12562,
-11710,
-12921,
-13647,
-11514,
-14981,
-31921,
-52007,
-59929,
-58002,
-57461,
-58803,
-57712,
-56629,
-57690,
-57522,
-55374,
-54253,
-54196,
-53860,
-53791,
-53564,
-52802,
-53299,
-53983,
-52172,
-51370,
-53611,
-48860,
-30546,
-11593,
-5840,
-7948,
-7876,
-7039,
-8416,
-8768,
-7599,
-8472,
-10813,
-11704,
-11788,
-12211,
-12422,
-12691,
-12792,
-11575,
-11070,
-13042,
-13134,
-11030,
-18130,
-38549,
-56610,
-60027,
-57297,
-58162,
-59027,
-57103,
-56664,
-57671,
-56473,
-54425,
-53672,
-52953,
-52474,
-53087,
-52889,
-52422,
-54092,
-54976,
-52856,
-52895,
-54173,
-44694,
-23636,
-7919,
-5985,
-7959,
-7023,
-7198,
-9310,
-9407,
-8499,
-9622,
-11470,
-12212,
-12398,
-12119,
-11791,
-12423,
-12378,
-10483,
-10364,
-12737,
-12396,
-11997,
-23209,
-44620,
-58777,
-58994,
-56564,
-58059,
-58481,
-56726,
-56752,
-57314,
-55710,
-54127,
-53783,
-53168,
-53071,
-54117,
-54194,
-53927,
-55102,
-54785,
-52532,
-53208,
-52490,
-38957,
-17829,
-7032,
-8189,
-8696,
-6608,
-7642,
-9569,
-8946,
-8886,
-10479,
-11120,
-11384,
-12044,
-11506,
-10948,
-11881,
-11500,
-10011,
-11516,
-13349,
-11190,
-13604,
-30016,
-50570,
-59226,
-57557,
-56701,
-58099,
-57612,
-56585,
-57165,
-57149,
-55637,
-54726,
-54531,
-53963,
-53680,
-53849,
-53764,
-54237,
-54597,
-52715,
-51612,
-53859,
-50140,
-32267,
-12218,
-5936,
-8774,
-8717,
-7099,
-8503,
-9348,
-8246,
-8940,
-10782,
-11129,
-11526,
-12365,
-11586,
-10653,
-11040,
-10607,
-10401,
-13033,
-14003,
-11489,
-16685,
-35632,
-54167,
-59182,
-57010,
-57084,
-57558,
-56040,
-55796,
-56919,
-56331,
-55071,
-55041,
-54741,
-53709,
-53616,
-53876,
-53593,
-53969,
-54050,
-52240,
-51829,
-53088,
-46084,
-26925,
-9810,
-6384,
-9085,
-8640,
-8121,
-9711,
-9199,
-7686,
-9506,
-11973,
-11724,
-11580,
-12540,
-12119,
-11414,
-11780,
-11145,
-10690,
-12738,
-13264,
-12349,
-21087,
-41420,
-57252,
-59515,
-57517,
-58161,
-57687,
-55904,
-56621,
-57657,
-55962,
-54358,
-54638,
-54354,
-53367,
-53519,
-54021,
-54111,
-54348,
-53459,
-51688,
-52504,
-52366,
-40766,
-19814,
-6354,
-6484,
-8720,
-6938,
-6805,
-9285,
-9536,
-8828,
-10425,
-11854,
-11359,
-11260,
-11633,
-11230,
-11292,
-11703,
-11259,
-11943,
-13675,
-12754,
-13945,
-27554,
-48551,
-59816,
-58502,
-56377,
-57508,
-57261,
-56197,
-57102,
-57389,
-55472,
-54250,
-54380,
-53873,
-53184,
-53220,
-53247,
-53443,
-53409,
-51419,
-50051,
-52384,
-50470,
-34831,
-14306,
-5762,
-8508,
-10073,
-8470,
-8832,
-9873,
-8918,
-8742,
-10581,
-11772,
-11952,
-12376,
-12446,
-12320,
-12735,
-12379,
-11721,
-13399,
-14697,
-12780,
-16358,
-33661,
-53386,
-59702,
-56575,
-56146,
-57742,
-56432,
-55375,
-56709,
-56829,
-55235,
-54260,
-53428,
-52851,
-53998,
-54750,
-53553,
-53290,
-53606,
-51513,
-50563,
-52719,
-47316,
-28409,
-10187,
-5991,
-8936,
-8896,
-8284,
-10367,
-11331,
-9912,
-9459,
-10495,
-11441,
-12392,
-12806,
-12008,
-11789,
-12409,
-11631,
-11019,
-13110,
-13988,
-12639,
-19444,
-38538,
-55322,
-58088,
-54898,
-55323,
-56295,
-54944,
-54956,
-56417,
-56070,
-55120,
-55207,
-54637,
-53579,
-53795,
-53940,
-53440,
-54045,
-54222,
-52371,
-52354,
-52990,
-43623,
-23482,
-8571,
-7298,
-9871,
-9007,
-8728,
-10152,
-9399,
-7859,
-8956,
-10862,
-11646,
-12403,
-12669,
-11862,
-11801,
-12276,
-11613,
-12050,
-14387,
-14319,
-14447,
-25304,
-45280,
-58386,
-58773,
-56451,
-57118,
-57026,
-55747,
-55990,
-56166,
-54728,
-53960,
-54075,
-53388,
-53062,
-53711,
-53222,
-52321,
-52764,
-51966,
-49751,
-50536,
-50106,
-37794,
-17798,
-6573,
-7421,
-9891,
-9789,
-9904,
-9902,
-9171,
-9645,
-10599,
-10419,
-11037,
-12975,
-13461,
-12712,
-12804,
-12630,
-11919,
-13182,
-14620,
-13209,
-15702,
-30690,
-50516,
-59463,
-56964,
-54649,
-56140,
-56770,
-56030,
-55958,
-55590,
-54867,
-54936,
-54071,
-52063,
-52174,
-53546,
-52637,
-51616,
-52649,
-52313,
-51078,
-52337,
-48929,
-32724,
-13931,
-7426,
-9850,
-10349,
-8584,
-8126,
-7947,
-7825,
-9028,
-9852,
-9433,
-10023,
-11471,
-11574,
-11485,
-12788,
-13636,
-13619,
-14569,
-14571,
-13065,
-19121,
-38085,
-56777,
-60901,
-56562,
-56037,
-58035,
-57538,
-56939,
-57183,
-55616,
-53985,
-54407,
-54131,
-53020,
-53890,
-54718,
-53167,
-52021,
-51673,
-50185,
-50745,
-52608,
-44509,
-24186,
-7906,
-5969,
-9164,
-8708,
-7890,
-9292,
-9761,
-9154,
-10029,
-11402,
-11584,
-11906,
-12848,
-13078,
-12975,
-13169,
-12846,
-12868,
-13759,
-12563,
-11718,
-22056,
-43499,
-58483,
-58297,
-54831,
-56655,
-58121,
-56735,
-56691,
-57025,
-55144,
-53866,
-54169,
-53676,
-53519,
-54757,
-54376,
-52806,
-53015,
-52668,
-50723,
-51877,
-52251,
-40171,
-19437,
-7616,
-8530,
-10843,
-10019,
-9595,
-9372,
-8353,
-8877,
-10540,
-10656,
-10159,
-10614,
-10790,
-11010,
-12292,
-12705,
-12030,
-13265,
-14566,
-12199,
-13033,
-26994,
-47462,
-58165,
-56907,
-54631,
-55732,
-56474,
-56355,
-56897,
-56476,
-55051,
-55268,
-56188,
-55507,
-54967,
-55236,
-53856,
-52070,
-52154,
-51430,
-49841,
-50882,
-48139,
-32528,
-13428,
-6771,
-9344,
-9783,
-8958,
-10134,
-9651,
-7806,
-8713,
-10300,
-9781,
-9616,
-10064,
-9319,
-9865,
-12328,
-12628,
-11816,
-14014,
-15501,
-13585,
-18055,
-35514,
-53873,
-59459,
-56259,
-54863,
-56131,
-56373,
-56166,
-56429,
-56081,
-56126,
-57320,
-57149,
-55304,
-54959,
-55494,
-54222,
-52767,
-52369,
-51101,
-50660,
-51538,
-44425,
-25229,
-8488,
-6087,
-9483,
-8574,
-6902,
-7994,
-8290,
-7511,
-8530,
-9950,
-10143,
-10707,
-11288,
-10706,
-11338,
-13609,
-14004,
-13242,
-14590,
-15148,
-14444,
-22705,
-42838,
-58900,
-60039,
-56194,
-57076,
-58563,
-57268,
-56307,
-55781,
-54494,
-54569,
-55460,
-54724,
-54716,
-56673,
-56523,
-54148,
-53551,
-53192,
-51358,
-52176,
-52729,
-41397,
-19984,
-6110,
-6545,
-9976,
-8788,
-7334,
-8722,
-10222,
-10589,
-10787,
-10631,
-10320,
-10588,
-10356,
-9602,
-10591,
-12318,
-12014,
-11911,
-13635,
-13145,
-13487,
-26027,
-47599,
-59591,
-57589,
-54999,
-57060,
-57776,
-56546,
-56358,
-55661,
-53978,
-53578,
-53859,
-54088,
-55544,
-56411,
-54607,
-53316,
-53824,
-52503,
-51032,
-53563,
-52320,
-36852,
-15488,
-5634,
-7649,
-8896,
-6421,
-6257,
-8376,
-8920,
-9130,
-11007,
-12418,
-12216,
-11827,
-11482,
-11478,
-12796,
-14054,
-14280,
-15104,
-14823,
-11529,
-14216,
-31499,
-51936,
-58867,
-56369,
-56989,
-58919,
-56443,
-54212,
-55742,
-56261,
-54357,
-53979,
-55239,
-55683,
-55508,
-55154,
-54540,
-54388,
-53266,
-50108,
-49607,
-52491,
-47071,
-27620,
-9393,
-6286,
-10060,
-8747,
-6068,
-8061,
-10450,
-9642,
-9116,
-10287,
-10575,
-9881,
-9709,
-9782,
-10060,
-11038,
-11972,
-13007,
-14725,
-14627,
-13385,
-20375,
-39262,
-56393,
-59913,
-57396,
-58772,
-60144,
-57642,
-56115,
-56512,
-54864,
-53359,
-54986,
-56092,
-55106,
-55197,
-55536,
-54092,
-53154,
-52884,
-51576,
-52207,
-52983,
-42974,
-22248,
-7297,
-5382,
-6812,
-6074,
-6996,
-9616,
-10578,
-10818,
-11748,
-11845,
-10842,
-10243,
-10172,
-10423,
-11312,
-12042,
-12113,
-13001,
-14454,
-14122,
-15539,
-27263,
-47072,
-59827,
-59195,
-55663,
-56595,
-57453,
-56096,
-56025,
-56420,
-55046,
-54301,
-55088,
-55438,
-56444,
-58352,
-57341,
-53822,
-51893,
-50727,
-49365,
-50622,
-49783,
-36991,
-17155,
-5983,
-5945,
-7378,
-7217,
-8495,
-10234,
-10559,
-10812,
-11301,
-10922,
-10598,
-10904,
-10507,
-9907,
-10951,
-12849,
-14238,
-15736,
-16271,
-14979,
-18360,
-33100,
-51639,
-60254,
-58850,
-57276,
-57691,
-56439,
-54714,
-54893,
-54956,
-53986,
-54134,
-55148,
-55039,
-54133,
-53116,
-51593,
-50174,
-49395,
-48963,
-50392,
-53306,
-49210,
-32014,
-12335,
-5252,
-8410,
-9858,
-8750,
-10371,
-12189,
-10778,
-9578,
-10584,
-11300,
-11459,
-11563,
-10616,
-10828,
-14073,
-16010,
-14786,
-14855,
-15533,
-14431,
-19871,
-37510,
-54832,
-59891,
-58226,
-57642,
-56980,
-55729,
-56081,
-56489,
-55297,
-54053,
-53246,
-52534,
-52863,
-53435,
-52435,
-51407,
-51958,
-51995,
-51153,
-52785,
-54629,
-46967,
-28052,
-11583,
-8261,
-10626,
-8723,
-6087,
-7709,
-9532,
-9405,
-10455,
-11781,
-11618,
-12104,
-12327,
-10429,
-11019,
-15153,
-16069,
-13911,
-13784,
-12667,
-11621,
-22618,
-43705,
-56535,
-57247,
-57109,
-57823,
-55813,
-55240,
-57537,
-57704,
-55442,
-53573,
-51990,
-51906,
-53547,
-52745,
-50045,
-51112,
-53863,
-52618,
-50957,
-53714,
-53948,
-42252,
-22633,
-9364,
-8936,
-12328,
-10713,
-8144,
-9427,
-10226,
-8699,
-9092,
-10824,
-11083,
-11922,
-12966,
-11693,
-11843,
-15527,
-16859,
-14935,
-14425,
-14237,
-15824,
-27898,
-46528,
-56061,
-55360,
-54769,
-54988,
-53422,
-54180,
-56957,
-56456,
-54443,
-54951,
-55628,
-54425,
-53027,
-52081,
-51923,
-53535,
-55129,
-54649,
-53743,
-53391,
-49556,
-37936,
-22226,
-13222,
-14569,
-16865,
-13552,
-9731,
-8579,
-7354,
-7339,
-9733,
-10760,
-11232,
-13455,
-12835,
-12835,
-26681,
-49248,
-60691,
-59460,
-56933,
-54533,
-52468,
-54525,
-56651,
-56165,
-56630,
-50187,
-29202,
-10035,
-7237,
-9595,
-8061,
-8729,
-11162,
-11019,
-11023,
-10383,
-10301,
-22554,
-44726,
-57072,
-57895,
-60372,
-63063,
-61135,
-60023,
-59724,
-57697,
-57753,
-53025,
-33175,
-11921,
-6046,
-7296,
-6396,
-7685,
-9228,
-7088,
-6561,
-7795,
-10036,
-24106,
-48136,
-60912,
-58739,
-56597,
-57084,
-56588,
-58289,
-59902,
-58248,
-57515,
-51696,
-31541,
-10788,
-5658,
-8209,
-8974,
-10032,
-9249,
-6076,
-6787,
-8281,
-8620,
-21253,
-45821,
-60547,
-60879,
-60200,
-59863,
-57645,
-58318,
-59173,
-57331,
-57971,
-53335,
-31792,
-8734,
-2984,
-5412,
-5022,
-6079,
-7786,
-6848,
-7871,
-9576,
-10579,
-22793,
-46100,
-60035,
-59892,
-59494,
-60988,
-60229,
-60282,
-59883,
-56923,
-56050,
-51669,
-33516,
-13138,
-6619,
-7410,
-6179,
-6192,
-7314,
-6924,
-7512,
-7354,
-7613,
-21063,
-46120,
-61075,
-60351,
-58025,
-58259,
-57946,
-59074,
-59998,
-58786,
-58565,
-52524,
-32197,
-11231,
-5405,
-7087,
-7101,
-8446,
-9666,
-8134,
-8230,
-8706,
-8827,
-20544,
-44104,
-59478,
-60832,
-60422,
-60654,
-58680,
-57990,
-57227,
-55095,
-57038,
-55392,
-36320,
-12158,
-3310,
-4050,
-2565,
-2138,
-4316,
-6111,
-8858,
-9824,
-8804,
-19292,
-42851,
-58950,
-60464,
-59784,
-59893,
-58039,
-58708,
-60872,
-60130,
-59234,
-53727,
-34819,
-13673,
-6111,
-6918,
-7683,
-9466,
-8994,
-5294,
-5941,
-8782,
-9696,
-20745,
-44443,
-60392,
-61695,
-61334,
-62000,
-59876,
-58254,
-56317,
-53281,
-55305,
-54501,
-35997,
-11976,
-3133,
-3520,
-2178,
-3490,
-7355,
-8422,
-9291,
-9555,
-8408,
-17864,
-40415,
-56986,
-60025,
-60558,
-61331,
-60184,
-61305,
-62671,
-60663,
-60173,
-56331,
-37246,
-13732,
-4577,
-5245,
-5313,
-6242,
-7037,
-6094,
-8178,
-9984,
-8560,
-18378,
-43187,
-60456,
-60997,
-59178,
-59356,
-57034,
-55955,
-56090,
-54395,
-56009,
-55812,
-38918,
-14654,
-4826,
-5784,
-4623,
-4290,
-6461,
-6731,
-7644,
-8905,
-7780,
-15809,
-38568,
-57167,
-60881,
-61569,
-63768,
-62547,
-61322,
-61405,
-58925,
-57038,
-53042,
-35700,
-12841,
-3147,
-3615,
-3507,
-5243,
-8307,
-7824,
-8372,
-10706,
-10488,
-18222,
-40730,
-59237,
-61424,
-59447,
-59919,
-58949,
-59029,
-59819,
-57328,
-56843,
-55905,
-39916,
-15984,
-6321,
-8266,
-7089,
-4882,
-4764,
-3141,
-3407,
-5885,
-5910,
-13389,
-35712,
-54885,
-58658,
-58803,
-60764,
-59632,
-59254,
-60563,
-58004,
-56114,
-54876,
-40195,
-16476,
-5491,
-7051,
-6841,
-5429,
-5737,
-4734,
-5719,
-9048,
-10050,
-18419,
-41331,
-59727,
-60356,
-57208,
-58877,
-59038,
-58546,
-59911,
-59881,
-60220,
-57798,
-40541,
-15777,
-4793,
-5952,
-5341,
-4481,
-5696,
-4301,
-3553,
-5432,
-5334,
-12002,
-34376,
-55829,
-61058,
-59928,
-60643,
-59805,
-59963,
-62124,
-60814,
-59242,
-57823,
-43066,
-17692,
-4098,
-5168,
-6188,
-5592,
-6651,
-5755,
-4804,
-6199,
-6706,
-13828,
-35256,
-55394,
-59739,
-58416,
-59805,
-59231,
-58388,
-60064,
-59790,
-59194,
-58023,
-44006,
-19781,
-6302,
-6072,
-5783,
-5227,
-6936,
-5853,
-4767,
-6641,
-6194,
-11078,
-33001,
-56347,
-61874,
-59029,
-59790,
-60112,
-59926,
-61375,
-59892,
-58146,
-57778,
-45127,
-19843,
-4796,
-5589,
-6568,
-5071,
-6181,
-6380,
-5874,
-7417,
-7940,
-13902,
-34444,
-55661,
-61127,
-59080,
-59308,
-58435,
-57654,
-59054,
-57979,
-56958,
-57100,
-45049,
-20841,
-5884,
-5546,
-6516,
-5993,
-6485,
-5781,
-6941,
-9712,
-7269,
-9636,
-30639,
-54310,
-60693,
-58752,
-59618,
-59157,
-57773,
-58261,
-57281,
-57425,
-57876,
-44504,
-19631,
-5677,
-5337,
-4664,
-4036,
-6430,
-5826,
-4698,
-7230,
-8276,
-13400,
-33054,
-54390,
-61447,
-61438,
-62006,
-60216,
-59532,
-61352,
-59468,
-58156,
-59934,
-48948,
-23388,
-6435,
-4950,
-5369,
-5230,
-7051,
-6650,
-6058,
-7208,
-4968,
-7952,
-28482,
-51375,
-57976,
-57465,
-59909,
-59893,
-58297,
-59194,
-58231,
-57229,
-58115,
-47726,
-24062,
-7756,
-5414,
-4739,
-3811,
-5456,
-5520,
-6290,
-10329,
-10491,
-12142,
-29551,
-52537,
-61680,
-61358,
-61513,
-60056,
-58423,
-58878,
-56862,
-55348,
-56795,
-46982,
-23229,
-7126,
-5801,
-5595,
-4055,
-5241,
-5178,
-5078,
-7432,
-6618,
-9230,
-28457,
-51265,
-58244,
-57712,
-60814,
-61806,
-60466,
-61144,
-59498,
-57338,
-58222,
-48925,
-25679,
-9469,
-7558,
-6193,
-4102,
-6116,
-6329,
-5407,
-8376,
-8786,
-9569,
-25705,
-49280,
-59606,
-59643,
-60139,
-59111,
-58136,
-60156,
-58716,
-55729,
-57138,
-49855,
-26485,
-7466,
-4631,
-5573,
-4750,
-5545,
-5099,
-4919,
-8199,
-8765,
-10607,
-27777,
-51112,
-60383,
-59928,
-61361,
-61700,
-60549,
-61442,
-59948,
-57263,
-57808,
-50210,
-28320,
-10102,
-5769,
-4954,
-3954,
-5350,
-4742,
-3591,
-6491,
-7606,
-9232,
-25439,
-49430,
-60456,
-59836,
-59726,
-59909,
-59898,
-61676,
-60354,
-57087,
-57258,
-50259,
-28216,
-8593,
-4588,
-5915,
-5227,
-5180,
-4264,
-3314,
-5890,
-7188,
-8873,
-24283,
-48729,
-61506,
-61066,
-59974,
-60241,
-60477,
-61990,
-61315,
-58972,
-58787,
-50962,
-28446,
-8241,
-3898,
-5344,
-4500,
-4392,
-4156,
-3793,
-6307,
-7282,
-8503,
-23589,
-48230,
-61213,
-61051,
-60670,
-60746,
-59732,
-61171,
-61524,
-59192,
-59060,
-52717,
-30787,
-9296,
-4071,
-5509,
-4824,
-5767,
-6248,
-4409,
-5512,
-7166,
-8580,
-22410,
-46893,
-60827,
-60918,
-60606,
-60833,
-59052,
-59901,
-60912,
-59033,
-58723,
-52810,
-31401,
-9533,
-3999,
-5496,
-4231,
-4405,
-5153,
-4217,
-5805,
-7249,
-8187,
-22075,
-47154,
-61123,
-60606,
-60420,
-61662,
-60198,
-59971,
-59632,
-57361,
-57571,
-52287,
-31026,
-8842,
-2843,
-4320,
-3893,
-5179,
-6400,
-5501,
-7215,
-8477,
-8548,
-21477,
-46424,
-61226,
-61593,
-61280,
-61851,
-60535,
-60854,
-59997,
-56599,
-56590,
-51874,
-31037,
-9330,
-3841,
-4956,
-3447,
-4134,
-5378,
-4572,
-6784,
-9127,
-9892,
-22649,
-47088,
-61339,
-61184,
-60739,
-61264,
-59750,
-60518,
-60530,
-56989,
-56709,
-53191,
-33233,
-9974,
-2732,
-4230,
-3728,
-4539,
-5660,
-4734,
-6525,
-8099,
-7522,
-19200,
-44687,
-61133,
-61709,
-60886,
-61483,
-59560,
-59256,
-59473,
-57314,
-57540,
-53753,
-33914,
-11149,
-4359,
-6056,
-5227,
-5869,
-7439,
-6587,
-7754,
-9184,
-8784,
-19826,
-44203,
-60070,
-60583,
-60043,
-61116,
-59417,
-59084,
-59059,
-56303,
-56483,
-53912,
-35019,
-11525,
-3694,
-5064,
-4005,
-4452,
-6237,
-5530,
-6794,
-8467,
-7511,
-17496,
-42522,
-60593,
-62217,
-61242,
-61823,
-59935,
-59623,
-60302,
-58334,
-58506,
-55629,
-36510,
-12484,
-4099,
-5660,
-4965,
-5132,
-6421,
-5454,
-6529,
-8199,
-7443,
-17041,
-40850,
-58079,
-60011,
-59667,
-60523,
-59036,
-59405,
-60302,
-57854,
-57708,
-55442,
-37536,
-14127,
-5280,
-5971,
-4824,
-4793,
-5702,
-4525,
-6002,
-8306,
-7696,
-17083,
-41024,
-58662,
-60589,
-60113,
-61328,
-60119,
-59986,
-60228,
-57803,
-58124,
-56203,
-38085,
-14010,
-4921,
-5993,
-4813,
-4403,
-5731,
-5079,
-5989,
-7460,
-6712,
-16010,
-39780,
-57536,
-59481,
-58871,
-60373,
-59514,
-59704,
-60915,
-59049,
-58363,
-55738,
-38574,
-15094,
-5229,
-5897,
-5109,
-4761,
-5801,
-5023,
-6235,
-8476,
-7745,
-15534,
-38400,
-57213,
-60079,
-59219,
-60874,
-60352,
-59754,
-59872,
-57759,
-57470,
-55725,
-39317,
-15479,
-5073,
-5980,
-5053,
-4199,
-5833,
-5553,
-5593,
-7089,
-7248,
-15358,
-37566,
-56698,
-60427,
-59490,
-60734,
-60308,
-60144,
-60991,
-59210,
-58274,
-56279,
-40702,
-16938,
-5283,
-5839,
-5827,
-5118,
-5761,
-4976,
-5601,
-7757,
-7762,
-15288,
-37190,
-56358,
-60083,
-59372,
-60999,
-60365,
-59297,
-59446,
-57726,
-57544,
-56512,
-41320,
-17226,
-5376,
-5845,
-5318,
-4330,
-5740,
-5932,
-6674,
-8227,
-7542,
-14835,
-37313,
-57008,
-60340,
-58952,
-60562,
-60134,
-59197,
-59753,
-58416,
-58011,
-56500,
-41116,
-17007,
-5144,
-5753,
-5563,
-5092,
-6577,
-5807,
-5473,
-7176,
-7014,
-13821,
-35725,
-55992,
-60099,
-58737,
-60293,
-60131,
-59293,
-59727,
-58411,
-58410,
-57808,
-43141,
-18806,
-6394,
-6898,
-6266,
-4648,
-5671,
-5525,
-5561,
-6933,
-6449,
-13032,
-34782,
-55414,
-60230,
-59067,
-60118,
-59490,
-59061,
-60511,
-59413,
-58512,
-57519,
-43653,
-19571,
-6269,
-6419,
-6575,
-5518,
-6195,
-5537,
-5588,
-7149,
-6176,
-11597,
-33025,
-54659,
-60308,
-59079,
-60334,
-60327,
-59633,
-60146,
-58828,
-58593,
-58235,
-44389,
-19828,
-6037,
-5966,
-5920,
-4719,
-5561,
-5138,
-5236,
-7261,
-6955,
-12321,
-33147,
-54687,
-60682,
-59787,
-61167,
-60803,
-59622,
-60249,
-58922,
-57905,
-57484,
-44876,
-20654,
-5724,
-5153,
-5746,
-4984,
-6052,
-5664,
-5199,
-6746,
-6528,
-11489,
-31717,
-53930,
-60835,
-59519,
-60334,
-60249,
-59181,
-59609,
-58625,
-57968,
-57569,
-45289,
-21377,
-6052,
-4863,
-5040,
-4037,
-5477,
-6118,
-6365,
-8102,
-7805,
-12047,
-31220,
-53263,
-60902,
-60282,
-61372,
-61229,
-59834,
-59967,
-58696,
-57710,
-57586,
-46181,
-22741,
-7114,
-5437,
-5221,
-4037,
-5502,
-5796,
-5485,
-7311,
-7498,
-11790,
-30804,
-52724,
-60264,
-59940,
-61407,
-60847,
-59194,
-60043,
-58855,
-57050,
-57389,
-47190,
-23293,
-6592,
-5243,
-5591,
-4155,
-5440,
-5909,
-5940,
-8431,
-8307,
-10981,
-29732,
-53296,
-61243,
-59825,
-61547,
-62089,
-60050,
-59882,
-58637,
-56909,
-56782,
-46392,
-22735,
-6117,
-4453,
-4357,
-2970,
-4949,
-5846,
-5735,
-8330,
-8652,
-11082,
-28993,
-52260,
-60844,
-60079,
-61557,
-61472,
-59694,
-60351,
-59006,
-56880,
-57706,
-48485,
-24405,
-7046,
-5700,
-5690,
-3577,
-5386,
-6496,
-5920,
-8166,
-8683,
-10696,
-27939,
-51659,
-60882,
-59855,
-61243,
-61513,
-59425,
-59616,
-58432,
-56072,
-56531,
-48153,
-24776,
-6323,
-4255,
-5400,
-3960,
-5066,
-6196,
-6432,
-8594,
-8379,
-10135,
-27369,
-51174,
-60658,
-59758,
-61143,
-61581,
-59543,
-59774,
-59120,
-57292,
-57704,
-49399,
-26504,
-8104,
-5270,
-5593,
-4076,
-5545,
-6278,
-5558,
-7881,
-8607,
-9715,
-25447,
-49656,
-60577,
-59570,
-60146,
-60739,
-59215,
-59620,
-58859,
-56715,
-57443,
-50489,
-28042,
-8517,
-5220,
-6129,
-4498,
-5463,
-6576,
-6133,
-8105,
-8683,
-9583,
-24635,
-48690,
-60222,
-59640,
-60385,
-61122,
-59394,
-59543,
-58870,
-56648,
-57264,
-50771,
-28654,
-8792,
-5299,
-6370,
-4532,
-5218,
-6330,
-5773,
-7596,
-8328,
-9149,
-23868,
-47986,
-59712,
-58950,
-59690,
-60685,
-59027,
-59435,
-59273,
-57078,
-57515,
-51453,
-29712,
-9472,
-5513,
-6463,
-4562,
-5249,
-6381,
-5761,
-7783,
-8723,
-8889,
-22814,
-47306,
-59807,
-59101,
-59747,
-60911,
-59131,
-59289,
-59126,
-56918,
-57642,
-52275,
-30609,
-9703,
-5682,
-7033,
-4824,
-5082,
-6410,
-5871,
-7639,
-8547,
-8562,
-21982,
-46460,
-59313,
-58597,
-59358,
-61129,
-59624,
-59665,
-59618,
-57366,
-57866,
-52904,
-31711,
-10181,
-5256,
-6643,
-4787,
-4962,
-5974,
-5127,
-6911,
-8274,
-8255,
-21036,
-45712,
-59667,
-59230,
-59408,
-61081,
-59860,
-59818,
-59545,
-57285,
-58027,
-53617,
-32718,
-10720,
-5326,
-6699,
-4662,
-4557,
-5886,
-5449,
-7119,
-8223,
-7988,
-20481,
-45228,
-59716,
-59539,
-59607,
-61201,
-59995,
-60054,
-59920,
-57436,
-57884,
-53799,
-33200,
-10590,
-4620,
-6258,
-4637,
-4497,
-5749,
-5317,
-7153,
-8498,
-8019,
-19887,
-44750,
-59965,
-60049,
-60031,
-61671,
-60205,
-59809,
-59616,
-57149,
-57593,
-54117,
-34174,
-11328,
-4761,
-6166,
-4320,
-4179,
-5801,
-5421,
-6959,
-8444,
-7802,
-18811,
-43532,
-59628,
-60144,
-59985,
-61726,
-60211,
-59644,
-59782,
-57533,
-57666,
-54504,
-35245,
-12007,
-4639,
-6159,
-4652,
-4399,
-6033,
-5628,
-6932,
-8501,
-7939,
-18270,
-42596,
-59299,
-60200,
-59760,
-61535,
-60348,
-59727,
-59670,
-57338,
-57543,
-54879,
-36146,
-12637,
-4687,
-6097,
-4488,
-3959,
-5689,
-5567,
-6850,
-8375,
-7678,
-17500,
-41603,
-58755,
-60009,
-59589,
-61482,
-60368,
-59623,
-59692,
-57489,
-57577,
-55160,
-36982,
-13331,
-4813,
-6280,
-5056,
-4480,
-5961,
-5734,
-7011,
-8621,
-7793,
-17067,
-40941,
-58537,
-60052,
-59387,
-61147,
-60178,
-59502,
-59567,
-57314,
-57434,
-55406,
-37647,
-13821,
-4949,
-6406,
-5218,
-4536,
-6026,
-5782,
-6973,
-8725,
-7806,
-16488,
-40145,
-58243,
-60083,
-59302,
-61067,
-60115,
-59408,
-59662,
-57446,
-57337,
-55629,
-38514,
-14518,
-4988,
-6397,
-5429,
-4755,
-6266,
-5922,
-6863,
-8685,
-7828,
-15945,
-39294,
-57964,
-60179,
-59151,
-60837,
-59977,
-59211,
-59581,
-57553,
-57382,
-55946,
-39363,
-15151,
-4972,
-6348,
-5587,
-4752,
-6233,
-5980,
-6783,
-8607,
-7733,
-15316,
-38295,
-57502,
-60224,
-59037,
-60623,
-59839,
-59030,
-59445,
-57522,
-57295,
-56178,
-40245,
-15925,
-5041,
-6257,
-5765,
-5005,
-6508,
-6276,
-6923,
-8679,
-7701,
-14726,
-37471,
-57296,
-60536,
-59179,
-60601,
-59810,
-58891,
-59322,
-57467,
-57172,
-56368,
-41027,
-16560,
-4984,
-6057,
-5763,
-4948,
-6428,
-6283,
-6901,
-8757,
-7807,
-14269,
-36565,
-56822,
-60551,
-59127,
-60439,
-59738,
-58801,
-59272,
-57433,
-57003,
-56442,
-41755,
-17293,
-5103,
-5910,
-5777,
-5035,
-6551,
-6464,
-7038,
-9005,
-8063,
-13980,
-35887,
-56535,
-60707,
-59186,
-60422,
-59800,
-58811,
-59220,
-57350,
-56819,
-56557,
-42381,
-17820,
-5019,
-5714,
-5783,
-4991,
-6428,
-6363,
-7000,
-9138,
-8174,
-13552,
-35103,
-56228,
-60894,
-59313,
-60421,
-59846,
-58926,
-59392,
-57394,
-56609,
-56600,
-43057,
-18464,
-5158,
-5752,
-5984,
-5177,
-6581,
-6445,
-6959,
-9233,
-8315,
-13175,
-34434,
-56034,
-61042,
-59280,
-60311,
-59748,
-58703,
-59235,
-57310,
-56375,
-56627,
-43673,
-18916,
-4956,
-5482,
-5968,
-5103,
-6510,
-6452,
-6871,
-9291,
-8534,
-12862,
-33717,
-55880,
-61437,
-59447,
-60285,
-59841,
-58755,
-59320,
-57514,
-56419,
-56808,
-44486,
-19712,
-4938,
-5181,
-5949,
-5129,
-6472,
-6479,
-6771,
-9078,
-8355,
-12310,
-32758,
-55341,
-61545,
-59576,
-60291,
-59966,
-58857,
-59324,
-57582,
-56539,
-57145,
-45276,
-20466,
-5076,
-5016,
-5953,
-5112,
-6370,
-6427,
-6732,
-8990,
-8100,
-11538,
-31627,
-54680,
-61496,
-59552,
-60120,
-59852,
-58790,
-59292,
-57575,
-56476,
-57351,
-46146,
-21408,
-5381,
-4940,
-5938,
-5100,
-6329,
-6431,
-6670,
-8961,
-8086,
-11056,
-30696,
-54080,
-61439,
-59579,
-60182,
-60044,
-58904,
-59333,
-57663,
-56517,
-57657,
-47056,
-22353,
-5701,
-5011,
-6112,
-5133,
-6246,
-6461,
-6719,
-9084,
-8235,
-10622,
-29651,
-53382,
-61337,
-59465,
-59992,
-60068,
-58984,
-59437,
-57860,
-56596,
-57839,
-47919,
-23442,
-6176,
-5091,
-6297,
-5259,
-6260,
-6539,
-6721,
-9023,
-8283,
-10353,
-28884,
-52808,
-61323,
-59533,
-60018,
-60230,
-59087,
-59398,
-57819,
-56483,
-57812,
-48396,
-24087,
-6340,
-4993,
-6350,
-5243,
-6055,
-6322,
-6523,
-8924,
-8269,
-9943,
-27974,
-52179,
-61278,
-59530,
-59892,
-60238,
-59206,
-59548,
-57971,
-56431,
-57822,
-48985,
-24877,
-6564,
-4794,
-6201,
-5094,
-5869,
-6193,
-6338,
-8784,
-8324,
-9752,
-27301,
-51713,
-61348,
-59678,
-59930,
-60349,
-59286,
-59595,
-58117,
-56473,
-57862,
-49487,
-25541,
-6677,
-4589,
-6170,
-5054,
-5636,
-5984,
-6120,
-8604,
-8280,
-9397,
-26431,
-51101,
-61435,
-59831,
-59860,
-60392,
-59462,
-59814,
-58395,
-56611,
-57956,
-50128,
-26538,
-7137,
-4508,
-6182,
-5165,
-5678,
-6030,
-6099,
-8510,
-8309,
-9255,
-25780,
-50502,
-61393,
-59972,
-59870,
-60431,
-59473,
-59682,
-58263,
-56460,
-57882,
-50498,
-27135,
-7262,
-4247,
-6082,
-5214,
-5640,
-5960,
-6016,
-8500,
-8402,
-8971,
-24910,
-49786,
-61342,
-60081,
-59766,
-60300,
-59442,
-59810,
-58487,
-56462,
-57830,
-51050,
-28098,
-7753,
-4248,
-6129,
-5364,
-5847,
-6218,
-6159,
-8625,
-8794,
-9166,
-24472,
-49349,
-61436,
-60292,
-59818,
-60360,
-59440,
-59731,
-58515,
-56391,
-57705,
-51441,
-28856,
-8024,
-4068,
-6108,
-5453,
-5804,
-6173,
-6089,
-8599,
-8966,
-9084,
-23717,
-48619,
-61396,
-60426,
-59688,
-60184,
-59376,
-59759,
-58641,
-56369,
-57554,
-51807,
-29705,
-8489,
-3982,
-6070,
-5604,
-5927,
-6231,
-6014,
-8438,
-8980,
-8967,
-23054,
-47918,
-61249,
-60515,
-59597,
-60051,
-59275,
-59692,
-58649,
-56300,
-57465,
-52185,
-30443,
-8832,
-3883,
-6105,
-5829,
-6105,
-6283,
-5900,
-8295,
-8980,
-8661,
-22079,
-46973,
-60973,
-60491,
-59350,
-59728,
-58995,
-59605,
-58802,
-56356,
-57398,
-52676,
-31430,
-9374,
-3806,
-6025,
-5898,
-6218,
-6424,
-5836,
-8047,
-8922,
-8503,
-21325,
-46177,
-60833,
-60595,
-59283,
-59634,
-58915,
-59497,
-58881,
-56459,
-57448,
-53207,
-32388,
-9853,
-3654,
-5926,
-5979,
-6221,
-6397,
-5714,
-7819,
-8797,
-8143,
-20268,
-45061,
-60478,
-60651,
-59187,
-59504,
-58885,
-59612,
-59246,
-56857,
-57779,
-54014,
-33719,
-10799,
-3890,
-5989,
-6097,
-6299,
-6468,
-5644,
-7572,
-8629,
-7839,
-19393,
-44124,
-60177,
-60735,
-59215,
-59513,
-58864,
-59533,
-59255,
-56828,
-57751,
-54539,
-34763,
-11481,
-3992,
-6061,
-6258,
-6408,
-6534,
-5563,
-7393,
-8596,
-7574,
-18381,
-42993,
-59731,
-60720,
-59187,
-59526,
-58897,
-59628,
-59603,
-57165,
-57910,
-55152,
-35929,
-12291,
-4132,
-6018,
-6187,
-6295,
-6569,
-5569,
-7231,
-8609,
-7542,
-17706,
-42143,
-59457,
-60748,
-59121,
-59532,
-58898,
-59464,
-59542,
-57121,
-57745,
-55450,
-36840,
-12926,
-4149,
-6048,
-6309,
-6304,
-6620,
-5597,
-7094,
-8601,
-7470,
-16927,
-41049,
-58986,
-60727,
-59041,
-59483,
-58866,
-59357,
-59584,
-57210,
-57601,
-55587,
-37614,
-13558,
-4182,
-5935,
-6239,
-6187,
-6668,
-5739,
-7104,
-8719,
-7643,
-16557,
-40386,
-58771,
-60833,
-59036,
-59502,
-58890,
-59186,
-59447,
-57114,
-57394,
-55743,
-38401,
-14212,
-4277,
-5961,
-6378,
-6250,
-6782,
-5865,
-7075,
-8782,
-7658,
-15875,
-39246,
-58073,
-60578,
-58783,
-59356,
-58835,
-59140,
-59631,
-57468,
-57571,
-56166,
-39444,
-15175,
-4640,
-6096,
-6428,
-6135,
-6713,
-5769,
-6620,
-8162,
-6820,
-14195,
-36871,
-55782,
-58325,
-56253,
-56733,
-56161,
-56251,
-56846,
-54883,
-55056,
-54249,
-38545,
-14609,
-3933,
-5653,
-6377,
-6238,
-7095,
-6328,
-7120,
-8867,
-7653,
-14450,
-36674,
-55987,
-58925,
-56802,
-57264,
-56588,
-56403,
-57029,
-55108,
-55003,
-54400,
-39410,
-15599,
-4517,
-6170,
-6940,
-6723,
-7795,
-7187,
-7812,
-9609,
-8483,
-14704,
-36423,
-56003,
-59172,
-56880,
-57361,
-56696,
-56270,
-56901,
-55105,
-54864,
-54561,
-40359,
-16619,
-5031,
-6585,
-7417,
-7016,
-8092,
-7528,
-7933,
-9769,
-8755,
-14380,
-35546,
-55479,
-59107,
-56814,
-57395,
-56839,
-56267,
-56985,
-55363,
-54920,
-54739,
-41204,
-17592,
-5503,
-6908,
-7766,
-7213,
-8370,
-7984,
-8210,
-10010,
-9052,
-14157,
-34781,
-54993,
-58960,
-56591,
-57236,
-56824,
-56110,
-56840,
-55361,
-54838,
-54915,
-42096,
-18585,
-5951,
-7149,
-8039,
-7303,
-8430,
-8094,
-8168,
-10002,
-9157,
-13769,
-33909,
-54504,
-59026,
-56758,
-57526,
-57229,
-56402,
-57164,
-55807,
-55095,
-55282,
-43046,
-19596,
-6391,
-7330,
-8183,
-7295,
-8474,
-8311,
-8273,
-10112,
-9299,
-13400,
-33050,
-53958,
-58909,
-56647,
-57513,
-57396,
-56489,
-57274,
-56036,
-55243,
-55660,
-44095,
-20687,
-6891,
-7534,
-8389,
-7302,
-8428,
-8316,
-8147,
-10000,
-9276,
-12900,
-32074,
-53354,
-58862,
-56687,
-57631,
-57611,
-56558,
-57298,
-56140,
-55207,
-55758,
-44817,
-21538,
-7218,
-7634,
-8519,
-7303,
-8451,
-8515,
-8288,
-10124,
-9453,
-12587,
-31281,
-52871,
-58867,
-56685,
-57642,
-57763,
-56594,
-57272,
-56188,
-55156,
-55914,
-45618,
-22447,
-7508,
-7593,
-8511,
-7154,
-8250,
-8434,
-8156,
-10022,
-9451,
-12160,
-30349,
-52284,
-58861,
-56767,
-57744,
-57989,
-56713,
-57309,
-56324,
-55212,
-56110,
-46425,
-23402,
-7910,
-7705,
-8694,
-7245,
-8316,
-8684,
-8377,
-10185,
-9586,
-11806,
-29454,
-51667,
-58781,
-56722,
-57671,
-58078,
-56738,
-57251,
-56321,
-55162,
-56234,
-47168,
-24286,
-8180,
-7616,
-8678,
-7153,
-8170,
-8658,
-8328,
-10121,
-9562,
-11357,
-28489,
-50997,
-58724,
-56770,
-57702,
-58237,
-56812,
-57249,
-56392,
-55186,
-56395,
-47946,
-25239,
-8580,
-7663,
-8791,
-7170,
-8142,
-8765,
-8423,
-10182,
-9666,
-11021,
-27605,
-50378,
-58703,
-56811,
-57709,
-58375,
-56901,
-57255,
-56492,
-55194,
-56524,
-48689,
-26187,
-8883,
-7536,
-8703,
-6993,
-7883,
-8645,
-8251,
-9984,
-9597,
-10586,
-26606,
-49641,
-58627,
-56855,
-57695,
-58498,
-56933,
-57184,
-56520,
-55144,
-56503,
-49261,
-27004,
-9109,
-7359,
-8638,
-6881,
-7687,
-8603,
-8192,
-9868,
-9598,
-10263,
-25703,
-48976,
-58641,
-56957,
-57699,
-58650,
-57061,
-57227,
-56658,
-55198,
-56542,
-49871,
-27882,
-9380,
-7178,
-8565,
-6795,
-7515,
-8563,
-8124,
-9762,
-9662,
-10077,
-24942,
-48411,
-58732,
-57169,
-57779,
-58826,
-57174,
-57232,
-56790,
-55255,
-56574,
-50454,
-28774,
-9727,
-7089,
-8601,
-6834,
-7495,
-8697,
-8231,
-9795,
-9856,
-10008,
-24266,
-47881,
-58834,
-57343,
-57784,
-58883,
-57141,
-57076,
-56744,
-55113,
-56360,
-50782,
-29455,
-9852,
-6772,
-8421,
-6686,
-7312,
-8667,
-8162,
-9646,
-9901,
-9845,
-23470,
-47202,
-58825,
-57446,
-57728,
-58896,
-57079,
-56910,
-56731,
-55032,
-56183,
-51155,
-30220,
-10100,
-6547,
-8356,
-6698,
-7296,
-8826,
-8293,
-9672,
-10118,
-9834,
-22791,
-46585,
-58890,
-57653,
-57737,
-58959,
-57085,
-56829,
-56817,
-55070,
-56113,
-51641,
-31130,
-10485,
-6386,
-8301,
-6714,
-7272,
-8937,
-8341,
-9583,
-10190,
-9706,
-21975,
-45784,
-58780,
-57729,
-57652,
-58917,
-56998,
-56656,
-56834,
-55089,
-56064,
-52155,
-32162,
-11056,
-6437,
-8439,
-6914,
-7410,
-9193,
-8538,
-9612,
-10363,
-9667,
-21226,
-44990,
-58658,
-57831,
-57572,
-58878,
-56899,
-56446,
-56777,
-55015,
-55887,
-52525,
-33084,
-11562,
-6371,
-8422,
-6974,
-7393,
-9303,
-8596,
-9514,
-10397,
-9543,
-20383,
-44049,
-58406,
-57857,
-57464,
-58825,
-56838,
-56280,
-56761,
-55018,
-55773,
-52926,
-34052,
-12153,
-6350,
-8425,
-7061,
-7400,
-9422,
-8726,
-9501,
-10508,
-9513,
-19624,
-43125,
-58127,
-57895,
-57346,
-58748,
-56780,
-56101,
-56698,
-54963,
-55592,
-53210,
-34947,
-12711,
-6275,
-8313,
-7046,
-7295,
-9429,
-8777,
-9448,
-10607,
-9532,
-18968,
-42241,
-57888,
-58028,
-57375,
-58822,
-56899,
-56106,
-56787,
-55083,
-55570,
-53619,
-35982,
-13500,
-6392,
-8373,
-7160,
-7299,
-9474,
-8876,
-9427,
-10700,
-9573,
-18326,
-41321,
-57565,
-58128,
-57350,
-58835,
-56980,
-56059,
-56795,
-55095,
-55438,
-53850,
-36882,
-14202,
-6443,
-8314,
-7216,
-7212,
-9419,
-8872,
-9316,
-10683,
-9526,
-17645,
-40290,
-57123,
-58151,
-57289,
-58820,
-57095,
-56103,
-56881,
-55244,
-55457,
-54210,
-37922,
-15112,
-6680,
-8406,
-7414,
-7269,
-9438,
-8965,
-9296,
-10728,
-9546,
-17028,
-39249,
-56587,
-58089,
-57118,
-58642,
-57063,
-55997,
-56796,
-55217,
-55302,
-54369,
-38764,
-15903,
-6795,
-8359,
-7509,
-7218,
-9342,
-8933,
-9190,
-10690,
-9549,
-16451,
-38245,
-56085,
-58105,
-57042,
-58561,
-57153,
-56043,
-56870,
-55360,
-55317,
-54625,
-39710,
-16830,
-7071,
-8471,
-7780,
-7348,
-9393,
-9037,
-9167,
-10712,
-9619,
-15980,
-37314,
-55611,
-58136,
-56956,
-58448,
-57214,
-56082,
-56929,
-55515,
-55319,
-54811,
-40532,
-17633,
-7209,
-8423,
-7902,
-7339,
-9272,
-8965,
-8972,
-10546,
-9550,
-15426,
-36332,
-55102,
-58164,
-56897,
-58351,
-57322,
-56198,
-57086,
-55782,
-55430,
-55075,
-41381,
-18472,
-7358,
-8363,
-8024,
-7346,
-9177,
-8901,
-8805,
-10401,
-9518,
-14956,
-35434,
-54659,
-58271,
-56904,
-58298,
-57436,
-56313,
-57231,
-56039,
-55536,
-55285,
-42156,
-19225,
-7431,
-8212,
-8032,
-7253,
-8972,
-8752,
-8526,
-10154,
-9410,
-14459,
-34544,
-54236,
-58394,
-56948,
-58251,
-57541,
-56376,
-57333,
-56240,
-55588,
-55421,
-42863,
-19932,
-7484,
-8058,
-8078,
-7249,
-8920,
-8753,
-8406,
-10066,
-9481,
-14146,
-33836,
-53976,
-58691,
-57151,
-58336,
-57697,
-56463,
-57421,
-56416,
-55569,
-55460,
-43438,
-20484,
-7377,
-7712,
-7939,
-7090,
-8749,
-8655,
-8205,
-9895,
-9467,
-13738,
-33039,
-53626,
-58905,
-57298,
-58372,
-57803,
-56497,
-57483,
-56589,
-55585,
-55581,
-44106,
-21165,
-7389,
-7498,
-7905,
-7069,
-8748,
-8753,
-8173,
-9889,
-9572,
-13426,
-32284,
-53287,
-59097,
-57428,
-58370,
-57811,
-56378,
-57388,
-56604,
-55462,
-55572,
-44692,
-21781,
-7373,
-7217,
-7791,
-6961,
-8711,
-8811,
-8106,
-9838,
-9634,
-13042,
-31434,
-52826,
-59193,
-57503,
-58335,
-57787,
-56223,
-57270,
-56612,
-55347,
-55604,
-45379,
-22561,
-7547,
-7122,
-7821,
-6991,
-8790,
-8978,
-8122,
-9855,
-9734,
-12667,
-30538,
-52278,
-59192,
-57515,
-58293,
-57768,
-56088,
-57159,
-56640,
-55247,
-55663,
-46095,
-23407,
-7806,
-7088,
-7861,
-6992,
-8829,
-9105,
-8102,
-9822,
-9791,
-12235,
-29560,
-51603,
-59068,
-57458,
-58227,
-57772,
-55987,
-57104,
-56741,
-55223,
-55798,
-46905,
-24398,
-8233,
-7192,
-7998,
-7037,
-8890,
-9249,
-8092,
-9808,
-9891,
-11858,
-28609,
-50924,
-58942,
-57426,
-58221,
-57859,
-55976,
-57112,
-56871,
-55189,
-55862,
-47636,
-25322,
-8593,
-7197,
-7988,
-6902,
-8738,
-9183,
-7901,
-9635,
-9870,
-11407,
-27568,
-50133,
-58732,
-57356,
-58238,
-58026,
-56082,
-57227,
-57109,
-55266,
-56001,
-48431,
-26356,
-9088,
-7305,
-8064,
-6814,
-8591,
-9131,
-7738,
-9488,
-9899,
-11057,
-26616,
-49400,
-58593,
-57384,
-58342,
-58316,
-56305,
-57435,
-57400,
-55368,
-56086,
-49103,
-27299,
-9470,
-7277,
-7993,
-6585,
-8265,
-8903,
-7434,
-9196,
-9831,
-10692,
-25662,
-48615,
-58418,
-57377,
-58396,
-58571,
-56545,
-57634,
-57719,
-55526,
-56193,
-49775,
-28278,
-9947,
-7316,
-8014,
-6442,
-7990,
-8719,
-7216,
-8979,
-9853,
-10493,
-24881,
-47954,
-58348,
-57467,
-58484,
-58844,
-56807,
-57795,
-57947,
-55599,
-56145,
-50236,
-29083,
-10278,
-7203,
-7918,
-6243,
-7652,
-8495,
-6990,
-8737,
-9841,
-10302,
-24096,
-47227,
-58218,
-57504,
-58490,
-59040,
-57014,
-57913,
-58144,
-55699,
-56119,
-50699,
-29942,
-10720,
-7191,
-7969,
-6228,
-7488,
-8436,
-6941,
-8631,
-9935,
-10253,
-23449,
-46581,
-58151,
-57603,
-58493,
-59204,
-57189,
-57945,
-58245,
-55712,
-55989,
-50995,
-30688,
-11066,
-7097,
-7942,
-6187,
-7281,
-8340,
-6873,
-8473,
-9939,
-10140,
-22734,
-45791,
-57943,
-57564,
-58343,
-59222,
-57281,
-57920,
-58340,
-55810,
-55985,
-51423,
-31607,
-11639,
-7182,
-8103,
-6347,
-7260,
-8403,
-6970,
-8441,
-10026,
-10120,
-22096,
-45034,
-57737,
-57550,
-58164,
-59170,
-57285,
-57785,
-58288,
-55790,
-55857,
-51705,
-32393,
-12120,
-7171,
-8168,
-6455,
-7193,
-8396,
-7010,
-8331,
-9977,
-9972,
-21340,
-44137,
-57402,
-57440,
-57913,
-59047,
-57266,
-57660,
-58267,
-55871,
-55869,
-52135,
-33356,
-12809,
-7359,
-8389,
-6734,
-7270,
-8525,
-7160,
-8322,
-10007,
-9904,
-20698,
-43319,
-57146,
-57443,
-57776,
-59007,
-57317,
-57586,
-58264,
-55933,
-55854,
-52468,
-34198,
-13383,
-7395,
-8435,
-6839,
-7207,
-8495,
-7190,
-8212,
-9934,
-9741,
-19960,
-42388,
-56745,
-57346,
-57561,
-58904,
-57351,
-57554,
-58326,
-56094,
-55970,
-52952,
-35198,
-14148,
-7608,
-8605,
-7062,
-7242,
-8522,
-7255,
-8142,
-9902,
-9623,
-19304,
-41546,
-56440,
-57376,
-57480,
-58904,
-57452,
-57550,
-58342,
-56146,
-55930,
-53226,
-35959,
-14679,
-7599,
-8558,
-7087,
-7134,
-8429,
-7232,
-8029,
-9834,
-9481,
-18631,
-40668,
-56063,
-57327,
-57339,
-58835,
-57517,
-57562,
-58423,
-56292,
-56022,
-53640,
-36863,
-15366,
-7732,
-8611,
-7185,
-7080,
-8370,
-7215,
-7948,
-9829,
-9443,
-18112,
-39961,
-55865,
-57462,
-57387,
-58914,
-57668,
-57624,
-58478,
-56351,
-55972,
-53884,
-37576,
-15896,
-7746,
-8559,
-7219,
-7004,
-8301,
-7195,
-7856,
-9799,
-9337,
-17497,
-39122,
-55485,
-57414,
-57259,
-58831,
-57695,
-57614,
-58529,
-56449,
-56018,
-54241,
-38414,
-16556,
-7883,
-8609,
-7332,
-7015,
-8313,
-7245,
-7842,
-9846,
-9342,
-17007,
-38422,
-55228,
-57480,
-57221,
-58783,
-57685,
-57505,
-58434,
-56367,
-55837,
-54370,
-39043,
-17072,
-7941,
-8628,
-7471,
-7088,
-8412,
-7373,
-7861,
-9912,
-9328,
-16481,
-37640,
-54874,
-57438,
-57102,
-58676,
-57651,
-57410,
-58413,
-56399,
-55815,
-54665,
-39847,
-17755,
-8131,
-8755,
-7680,
-7217,
-8570,
-7573,
-7957,
-10058,
-9415,
-16047,
-36937,
-54582,
-57440,
-56979,
-58535,
-57538,
-57190,
-58239,
-56287,
-55635,
-54794,
-40518,
-18300,
-8204,
-8772,
-7818,
-7288,
-8710,
-7767,
-8039,
-10162,
-9456,
-15541,
-36125,
-54190,
-57370,
-56813,
-58393,
-57460,
-57032,
-58167,
-56326,
-55616,
-55086,
-41376,
-19062,
-8447,
-8928,
-8035,
-7398,
-8832,
-7923,
-8020,
-10145,
-9395,
-14942,
-35217,
-53719,
-57271,
-56639,
-58249,
-57382,
-56831,
-58029,
-56295,
-55502,
-55269,
-42145,
-19770,
-8645,
-9037,
-8243,
-7488,
-8963,
-8095,
-8008,
-10099,
-9314,
-14292,
-34201,
-53115,
-57045,
-56337,
-58001,
-57245,
-56623,
-57951,
-56408,
-55588,
-55648,
-43152,
-20727,
-9031,
-9288,
-8533,
-7625,
-9098,
-8276,
-7998,
-10069,
-9298,
-13756,
-33272,
-52622,
-56969,
-56196,
-57909,
-57247,
-56519,
-57897,
-56513,
-55577,
-55868,
-43991,
-21559,
-9302,
-9420,
-8757,
-7706,
-9177,
-8415,
-7908,
-9931,
-9152,
-13049,
-32104,
-51856,
-56660,
-55862,
-57646,
-57165,
-56370,
-57846,
-56658,
-55642,
-56153,
-44929,
-22511,
-9655,
-9580,
-8964,
-7730,
-9167,
-8480,
-7805,
-9802,
-9107,
-12523,
-31134,
-51302,
-56580,
-55737,
-57552,
-57205,
-56286,
-57781,
-56738,
-55605,
-56269,
-45680,
-23306,
-9857,
-9580,
-9059,
-7666,
-9085,
-8494,
-7658,
-9621,
-9023,
-11958,
-30087,
-50625,
-56418,
-55551,
-57419,
-57265,
-56302,
-57862,
-57037,
-55798,
-56602,
-46630,
-24329,
-10247,
-9715,
-9257,
-7698,
-9056,
-8566,
-7583,
-9542,
-9089,
-11619,
-29253,
-50151,
-56468,
-55569,
-57423,
-57423,
-56370,
-57923,
-57223,
-55829,
-56691,
-47324,
-25149,
-10483,
-9724,
-9404,
-7730,
-9019,
-8617,
-7493,
-9401,
-9069,
-11192,
-28297,
-49520,
-56383,
-55474,
-57324,
-57514,
-56427,
-57976,
-57431,
-55922,
-56833,
-48061,
-26026,
-10761,
-9707,
-9489,
-7676,
-8855,
-8557,
-7343,
-9240,
-9092,
-10894,
-27491,
-49015,
-56430,
-55493,
-57268,
-57613,
-56461,
-57962,
-57539,
-55912,
-56833,
-48633,
-26788,
-10949,
-9611,
-9548,
-7651,
-8745,
-8556,
-7251,
-9078,
-9057,
-10512,
-26538,
-48298,
-56276,
-55347,
-57068,
-57616,
-56466,
-57938,
-57693,
-55979,
-56923,
-49288,
-27665,
-11277,
-9613,
-9711,
-7729,
-8700,
-8627,
-7249,
-9015,
-9143,
-10294,
-25778,
-47754,
-56290,
-55342,
-56920,
-57606,
-56386,
-57760,
-57617,
-55838,
-56789,
-49739,
-28394,
-11505,
-9551,
-9846,
-7834,
-8693,
-8735,
-7310,
-8980,
-9209,
-10037,
-24934,
-47067,
-56171,
-55219,
-56690,
-57552,
-56360,
-57668,
-57677,
-55867,
-56835,
-50336,
-29278,
-11878,
-9595,
-10069,
-8025,
-8756,
-8915,
-7460,
-9034,
-9369,
-9920,
-24243,
-46507,
-56145,
-55180,
-56468,
-57439,
-56182,
-57356,
-57465,
-55635,
-56623,
-50669,
-29956,
-12102,
-9489,
-10150,
-8089,
-8713,
-9019,
-7568,
-9051,
-9468,
-9745,
-23467,
-45818,
-56009,
-55093,
-56250,
-57399,
-56158,
-57247,
-57486,
-55667,
-56660,
-51230,
-30863,
-12515,
-9513,
-10306,
-8231,
-8727,
-9151,
-7703,
-9064,
-9567,
-9581,
-22701,
-45124,
-55890,
-55061,
-56058,
-57337,
-56058,
-56991,
-57328,
-55501,
-56487,
-51590,
-31619,
-12850,
-9479,
-10422,
-8352,
-8721,
-9287,
-7837,
-9067,
-9622,
-9395,
-21895,
-44354,
-55687,
-54963,
-55845,
-57304,
-56054,
-56894,
-57387,
-55623,
-56600,
-52209,
-32622,
-13411,
-9584,
-10615,
-8496,
-8716,
-9418,
-7992,
-9088,
-9750,
-9335,
-21245,
-43717,
-55623,
-55024,
-55789,
-57389,
-56129,
-56802,
-57398,
-55648,
-56563,
-52657,
-33500,
-13902,
-9651,
-10775,
-8628,
-8679,
-9488,
-8060,
-8992,
-9728,
-9115,
-20410,
-42861,
-55363,
-54941,
-55628,
-57406,
-56201,
-56754,
-57483,
-55769,
-56629,
-53194,
-34478,
-14475,
-9722,
-10880,
-8701,
-8599,
-9542,
-8148,
-8963,
-9787,
-9021,
-19693,
-42065,
-55154,
-54928,
-55520,
-57424,
-56207,
-56576,
-57381,
-55667,
-56438,
-53432,
-35201,
-14846,
-9608,
-10797,
-8632,
-8405,
-9488,
-8159,
-8836,
-9773,
-8881,
-18952,
-41251,
-54943,
-55005,
-55509,
-57555,
-56357,
-56573,
-57468,
-55774,
-56446,
-53853,
-36129,
-15410,
-9595,
-10751,
-8570,
-8201,
-9418,
-8180,
-8799,
-9916,
-8992,
-18491,
-40660,
-54956,
-55280,
-55660,
-57768,
-56552,
-56562,
-57469,
-55729,
-56203,
-53978,
-36756,
-15741,
-9374,
-10554,
-8449,
-7989,
-9337,
-8175,
-8699,
-9946,
-8964,
-17834,
-39825,
-54717,
-55367,
-55658,
-57865,
-56700,
-56573,
-57531,
-55764,
-56038,
-54148,
-37458,
-16146,
-9186,
-10331,
-8282,
-7706,
-9159,
-8084,
-8565,
-10030,
-9084,
-17390,
-39175,
-54628,
-55571,
-55679,
-57891,
-56726,
-56440,
-57441,
-55664,
-55757,
-54254,
-38192,
-16700,
-9209,
-10384,
-8465,
-7795,
-9310,
-8283,
-8648,
-10258,
-9281,
-16936,
-38425,
-54405,
-55669,
-55612,
-57853,
-56765,
-56375,
-57435,
-55633,
-55515,
-54322,
-38865,
-17180,
-9118,
-10300,
-8560,
-7813,
-9402,
-8464,
-8771,
-10552,
-9605,
-16646,
-37811,
-54282,
-55839,
-55535,
-57717,
-56679,
-56182,
-57288,
-55528,
-55278,
-54456,
-39682,
-17884,
-9264,
-10450,
-8884,
-8021,
-9575,
-8661,
-8834,
-10709,
-9726,
-16124,
-36897,
-53862,
-55766,
-55258,
-57417,
-56514,
-56006,
-57213,
-55514,
-55114,
-54625,
-40536,
-18663,
-9481,
-10680,
-9369,
-8450,
-10003,
-9089,
-9124,
-11048,
-10036,
-15759,
-36087,
-53490,
-55726,
-54981,
-57037,
-56233,
-55665,
-56936,
-55283,
-54739,
-54561,
-41161,
-19223,
-9463,
-10640,
-9578,
-8574,
-10072,
-9169,
-9080,
-11086,
-10094,
-15222,
-35163,
-53069,
-55732,
-54782,
-56764,
-56104,
-55546,
-56923,
-55368,
-54719,
-54848,
-42137,
-20152,
-9772,
-10852,
-9994,
-8868,
-10237,
-9298,
-9031,
-11064,
-10106,
-14716,
-34270,
-52694,
-55823,
-54716,
-56613,
-56108,
-55537,
-56961,
-55509,
-54737,
-55108,
-43027,
-21003,
-9974,
-10940,
-10306,
-9051,
-10291,
-9321,
-8907,
-10924,
-9952,
-13975,
-33062,
-51929,
-55549,
-54276,
-56116,
-55855,
-55411,
-56979,
-55691,
-54837,
-55448,
-43996,
-21930,
-10196,
-10962,
-10552,
-9231,
-10355,
-9408,
-8893,
-10944,
-10052,
-13592,
-32248,
-51567,
-55705,
-54302,
-55988,
-55864,
-55379,
-56939,
-55713,
-54746,
-55544,
-44728,
-22723,
-10397,
-11020,
-10857,
-9472,
-10429,
-9478,
-8814,
-10821,
-9931,
-12990,
-31194,
-50943,
-55648,
-54158,
-55742,
-55797,
-55356,
-56929,
-55788,
-54716,
-55642,
-45407,
-23434,
-10442,
-10813,
-10876,
-9487,
-10403,
-9571,
-8908,
-10961,
-10186,
-12828,
-30545,
-50601,
-55803,
-54179,
-55580,
-55721,
-55228,
-56746,
-55699,
-54570,
-55655,
-46018,
-24179,
-10611,
-10759,
-11043,
-9609,
-10404,
-9641,
-8932,
-10942,
-10212,
-12437,
-29659,
-50048,
-55803,
-54108,
-55353,
-55610,
-55097,
-56543,
-55534,
-54306,
-55479,
-46462,
-24816,
-10735,
-10639,
-11211,
-9841,
-10621,
-10007,
-9286,
-11296,
-10657,
-12493,
-29130,
-49685,
-55913,
-54136,
-55166,
-55463,
-54840,
-56152,
-55209,
-53900,
-55160,
-46718,
-25332,
-10764,
-10434,
-11224,
-9881,
-10621,
-10163,
-9481,
-11481,
-10930,
-12404,
-28485,
-49229,
-55979,
-54173,
-55016,
-55397,
-54735,
-55943,
-55043,
-53638,
-54951,
-47102,
-26015,
-10977,
-10345,
-11328,
-10054,
-10759,
-10451,
-9765,
-11749,
-11314,
-12460,
-27933,
-48734,
-55962,
-54155,
-54838,
-55273,
-54519,
-55607,
-54775,
-53330,
-54698,
-47429,
-26710,
-11291,
-10373,
-11505,
-10210,
-10817,
-10607,
-9914,
-11842,
-11468,
-12278,
-27135,
-48014,
-55759,
-54019,
-54585,
-55147,
-54421,
-55458,
-54709,
-53200,
-54587,
-47895,
-27545,
-11705,
-10405,
-11646,
-10381,
-10939,
-10849,
-10139,
-12016,
-11748,
-12253,
-26444,
-47269,
-55469,
-53821,
-54307,
-55000,
-54283,
-55256,
-54661,
-53161,
-54618,
-48508,
-28627,
-12495,
-10890,
-12187,
-10784,
-11068,
-10893,
-10014,
-11696,
-11446,
-11675,
-25304,
-46236,
-55060,
-53626,
-54117,
-55037,
-54453,
-55514,
-55166,
-53842,
-55545,
-50325,
-31227,
-15063,
-13311,
-14846,
-13560,
-13802,
-13687,
-12690,
-14179,
-13896,
-13661,
-26327,
-46786,
-55680,
-54015,
-54126,
-54908,
-54140,
-55009,
-54703,
-53265,
-54836,
-49988,
-31214,
-14669,
-12517,
-14142,
-12910,
-13170,
-13298,
-12467,
-14036,
-13959,
-13521,
-25545,
-45892,
-55213,
-53614,
-53568,
-54412,
-53664,
-54469,
-54210,
-52635,
-54098,
-49755,
-31507,
-14722,
-12244,
-13979,
-12834,
-13047,
-13212,
-12285,
-13749,
-13843,
-13272,
-24722,
-44981,
-54788,
-53406,
-53303,
-54238,
-53460,
-54171,
-54000,
-52358,
-53720,
-49779,
-31959,
-14899,
-12060,
-13848,
-12700,
-12786,
-13023,
-12109,
-13548,
-13795,
-13058,
-23914,
-44097,
-54371,
-53108,
-52858,
-53857,
-53167,
-53875,
-53835,
-52135,
-53425,
-49984,
-32672,
-15348,
-12083,
-13924,
-12843,
-12860,
-13126,
-12123,
-13466,
-13880,
-13061,
-23346,
-43415,
-54153,
-53093,
-52746,
-53812,
-53095,
-53724,
-53762,
-52028,
-53166,
-50072,
-33143,
-15530,
-11870,
-13787,
-12752,
-12664,
-12996,
-12015,
-13315,
-13879,
-12929,
-22662,
-42659,
-53916,
-53023,
-52505,
-53615,
-52992,
-53631,
-53794,
-52002,
-53016,
-50339,
-33877,
-15951,
-11791,
-13723,
-12773,
-12626,
-12970,
-11916,
-13103,
-13850,
-12872,
-22117,
-42022,
-53800,
-53140,
-52498,
-53621,
-52960,
-53471,
-53702,
-51874,
-52764,
-50378,
-34294,
-16050,
-11466,
-13482,
-12631,
-12395,
-12806,
-11811,
-12960,
-13856,
-12783,
-21531,
-41407,
-53759,
-53305,
-52458,
-53594,
-53021,
-53539,
-53873,
-52015,
-52756,
-50722,
-35038,
-16414,
-11239,
-13225,
-12485,
-12192,
-12656,
-11630,
-12696,
-13753,
-12704,
-20985,
-40781,
-53672,
-53492,
-52517,
-53671,
-53086,
-53480,
-53866,
-52037,
-52644,
-50893,
-35555,
-16613,
-10968,
-13049,
-12440,
-12067,
-12592,
-11632,
-12617,
-13730,
-12551,
-20319,
-40081,
-53606,
-53710,
-52550,
-53712,
-53213,
-53553,
-53995,
-52118,
-52604,
-51192,
-36311,
-17043,
-10818,
-12894,
-12447,
-12050,
-12648,
-11706,
-12581,
-13839,
-12671,
-19990,
-39622,
-53679,
-54033,
-52691,
-53793,
-53219,
-53361,
-53833,
-52024,
-52434,
-51310,
-36814,
-17232,
-10504,
-12635,
-12320,
-11851,
-12566,
-11777,
-12635,
-13966,
-12696,
-19503,
-39048,
-53701,
-54325,
-52763,
-53851,
-53350,
-53403,
-53887,
-52034,
-52296,
-51466,
-37406,
-17498,
-10171,
-12305,
-12196,
-11749,
-12596,
-11893,
-12668,
-14096,
-12830,
-19166,
-38574,
-53773,
-54721,
-53033,
-54093,
-53543,
-53335,
-53770,
-51930,
-52102,
-51545,
-37889,
-17718,
-9882,
-12039,
-12039,
-11451,
-12357,
-11792,
-12528,
-14019,
-12675,
-18511,
-37839,
-53641,
-54930,
-53049,
-54095,
-53615,
-53310,
-53765,
-51939,
-52019,
-51815,
-38699,
-18280,
-9851,
-11934,
-12071,
-11459,
-12468,
-11994,
-12646,
-14234,
-12889,
-18247,
-37318,
-53595,
-55166,
-53168,
-54212,
-53713,
-53197,
-53633,
-51887,
-51920,
-51997,
-39333,
-18701,
-9768,
-11842,
-12074,
-11333,
-12418,
-12117,
-12744,
-14378,
-12923,
-17714,
-36577,
-53358,
-55273,
-53123,
-54176,
-53781,
-53173,
-53609,
-51854,
-51750,
-52141,
-40041,
-19269,
-9778,
-11761,
-12120,
-11339,
-12506,
-12268,
-12775,
-14447,
-12989,
-17272,
-35817,
-53018,
-55288,
-53093,
-54193,
-53810,
-53000,
-53398,
-51708,
-51546,
-52231,
-40666,
-19827,
-9886,
-11846,
-12289,
-11359,
-12545,
-12448,
-12939,
-14679,
-13169,
-16895,
-35132,
-52760,
-55349,
-52997,
-54065,
-53777,
-52908,
-53316,
-51636,
-51320,
-52284,
-41309,
-20410,
-9897,
-11686,
-12205,
-11205,
-12431,
-12408,
-12800,
-14642,
-13193,
-16464,
-34310,
-52273,
-55223,
-52842,
-53970,
-53758,
-52757,
-53155,
-51541,
-51146,
-52318,
-41892,
-20982,
-10035,
-11755,
-12360,
-11187,
-12358,
-12424,
-12792,
-14684,
-13235,
-15988,
-33479,
-51830,
-55170,
-52704,
-53818,
-53792,
-52790,
-53212,
-51607,
-51035,
-52437,
-42625,
-21793,
-10332,
-11870,
-12578,
-11311,
-12436,
-12522,
-12784,
-14737,
-13392,
-15726,
-32767,
-51383,
-55127,
-52643,
-53807,
-53909,
-52832,
-53218,
-51644,
-50948,
-52460,
-43172,
-22406,
-10506,
-11944,
-12771,
-11355,
-12360,
-12519,
-12774,
-14801,
-13508,
-15398,
-31997,
-50936,
-55090,
-52513,
-53603,
-53907,
-52912,
-53342,
-51800,
-50925,
-52553,
-43865,
-23219,
-10771,
-11957,
-12898,
-11419,
-12313,
-12493,
-12664,
-14770,
-13672,
-15242,
-31381,
-50539,
-55135,
-52528,
-53586,
-54041,
-53011,
-53384,
-51894,
-50880,
-52546,
-44331,
-23811,
-10906,
-11933,
-13053,
-11432,
-12144,
-12373,
-12542,
-14683,
-13697,
-14913,
-30607,
-50059,
-55148,
-52450,
-53392,
-54077,
-53178,
-53584,
-52136,
-50954,
-52624,
-44956,
-24594,
-11117,
-11826,
-13101,
-11433,
-11974,
-12196,
-12283,
-14449,
-13686,
-14684,
-29897,
-49540,
-55134,
-52417,
-53256,
-54114,
-53240,
-53572,
-52206,
-50905,
-52526,
-45281,
-25102,
-11158,
-11670,
-13205,
-11467,
-11787,
-12032,
-12110,
-14248,
-13583,
-14321,
-29072,
-49008,
-55183,
-52406,
-53053,
-54135,
-53415,
-53747,
-52449,
-51028,
-52636,
-45890,
-25943,
-11412,
-11563,
-13309,
-11594,
-11737,
-11997,
-12030,
-14126,
-13671,
-14223,
-28495,
-48574,
-55299,
-52501,
-52960,
-54187,
-53499,
-53748,
-52548,
-51106,
-52648,
-46318,
-26562,
-11523,
-11386,
-13393,
-11676,
-11588,
-11914,
-11954,
-14010,
-13637,
-13952,
-27736,
-48055,
-55395,
-52572,
-52769,
-54177,
-53637,
-53873,
-52756,
-51233,
-52730,
-46886,
-27392,
-11785,
-11204,
-13435,
-11792,
-11557,
-11908,
-11908,
-13883,
-13683,
-13859,
-27135,
-47589,
-55523,
-52752,
-52724,
-54235,
-53688,
-53786,
-52757,
-51228,
-52675,
-47230,
-27994,
-11884,
-10971,
-13456,
-11868,
-11444,
-11870,
-11904,
-13779,
-13612,
-13534,
-26298,
-46946,
-55567,
-52852,
-52578,
-54208,
-53794,
-53831,
-52896,
-51333,
-52761,
-47811,
-28912,
-12239,
-10801,
-13428,
-11942,
-11406,
-11883,
-11897,
-13662,
-13641,
-13422,
-25648,
-46353,
-55601,
-53023,
-52540,
-54230,
-53789,
-53701,
-52879,
-51375,
-52786,
-48264,
-29680,
-12524,
-10648,
-13452,
-12044,
-11372,
-11928,
-11981,
-13620,
-13599,
-13081,
-24708,
-45541,
-55493,
-53091,
-52381,
-54155,
-53810,
-53686,
-52943,
-51415,
-52815,
-48837,
-30655,
-12976,
-10509,
-13380,
-12104,
-11372,
-12013,
-12026,
-13586,
-13685,
-13009,
-24056,
-44905,
-55508,
-53338,
-52480,
-54258,
-53846,
-53567,
-52929,
-51431,
-52836,
-49325,
-31500,
-13364,
-10364,
-13293,
-12043,
-11214,
-11933,
-11992,
-13481,
-13634,
-12666,
-23092,
-44008,
-55329,
-53438,
-52429,
-54263,
-53914,
-53624,
-53064,
-51501,
-52877,
-49921,
-32573,
-13960,
-10313,
-13186,
-12026,
-11162,
-11940,
-11940,
-13350,
-13661,
-12537,
-22346,
-43215,
-55185,
-53635,
-52580,
-54433,
-54016,
-53593,
-53085,
-51497,
-52814,
-50318,
-33378,
-14372,
-10185,
-13041,
-11920,
-10966,
-11834,
-11889,
-13284,
-13710,
-12315,
-21481,
-42324,
-54989,
-53785,
-52645,
-54536,
-54182,
-53749,
-53302,
-51584,
-52796,
-50808,
-34391,
-14975,
-10105,
-12804,
-11732,
-10774,
-11703,
-11710,
-13089,
-13762,
-12313,
-20892,
-41624,
-54894,
-54103,
-52950,
-54834,
-54383,
-53824,
-53411,
-51610,
-52700,
-51128,
-35162,
-15420,
-9964,
-12570,
-11500,
-10481,
-11456,
-11516,
-12933,
-13789,
-12161,
-20090,
-40720,
-54655,
-54276,
-53095,
-55014,
-54646,
-54113,
-53763,
-51776,
-52677,
-51540,
-36113,
-16049,
-9914,
-12310,
-11310,
-10278,
-11312,
-11319,
-12709,
-13841,
-12201,
-19565,
-40007,
-54490,
-54539,
-53372,
-55297,
-54855,
-54213,
-53882,
-51809,
-52542,
-51771,
-36840,
-16535,
-9867,
-12169,
-11190,
-10081,
-11136,
-11151,
-12572,
-13908,
-12171,
-18916,
-39178,
-54241,
-54677,
-53459,
-55378,
-55022,
-54419,
-54186,
-51947,
-52445,
-52045,
-37681,
-17155,
-9853,
-11965,
-11059,
-9948,
-11022,
-10976,
-12328,
-13931,
-12242,
-18445,
-38441,
-53981,
-54814,
-53587,
-55516,
-55136,
-54461,
-54289,
-52006,
-52325,
-52229,
-38393,
-17693,
-9870,
-11900,
-11066,
-9865,
-10928,
-10880,
-12205,
-13986,
-12250,
-17837,
-37559,
-53620,
-54853,
-53525,
-55424,
-55157,
-54554,
-54520,
-52184,
-52265,
-52481,
-39259,
-18441,
-9976,
-11831,
-11100,
-9872,
-10928,
-10783,
-11955,
-13900,
-12287,
-17381,
-36774,
-53268,
-54921,
-53554,
-55441,
-55202,
-54504,
-54572,
-52284,
-52199,
-52615,
-39927,
-19021,
-10051,
-11838,
-11234,
-9892,
-10909,
-10753,
-11798,
-13811,
-12201,
-16745,
-35800,
-52769,
-54842,
-53354,
-55218,
-55133,
-54524,
-54766,
-52574,
-52295,
-52928,
-40853,
-19880,
-10274,
-11867,
-11380,
-9995,
-10981,
-10771,
-11588,
-13677,
-12209,
-16331,
-34990,
-52367,
-54860,
-53311,
-55133,
-55100,
-54394,
-54729,
-52683,
-52291,
-53082,
-41564,
-20582,
-10445,
-11954,
-11632,
-10127,
-11045,
-10832,
-11475,
-13545,
-12124,
-15742,
-34011,
-51827,
-54799,
-53117,
-54867,
-54979,
-54319,
-54816,
-52947,
-52401,
-53331,
-42421,
-21460,
-10689,
-11968,
-11813,
-10280,
-11198,
-11004,
-11400,
-13444,
-12177,
-15418,
-33231,
-51390,
-54834,
-53083,
-54781,
-54962,
-54185,
-54707,
-53054,
-52412,
-53427,
-43059,
-22142,
-10818,
-11968,
-12014,
-10390,
-11238,
-11113,
-11341,
-13320,
-12123,
-14917,
-32261,
-50836,
-54804,
-52950,
-54527,
-54842,
-54063,
-54692,
-53242,
-52482,
-53587,
-43851,
-23056,
-11098,
-11970,
-12185,
-10528,
-11385,
-11310,
-11335,
-13228,
-12209,
-14664,
-31503,
-50368,
-54843,
-52928,
-54422,
-54802,
-53864,
-54471,
-53223,
-52405,
-53563,
-44405,
-23733,
-11237,
-11929,
-12365,
-10651,
-11456,
-11502,
-11389,
-13217,
-12290,
-14308,
-30597,
-49783,
-54807,
-52821,
-54163,
-54657,
-53697,
-54378,
-53348,
-52417,
-53640,
-45112,
-24656,
-11532,
-11895,
-12477,
-10755,
-11570,
-11711,
-11432,
-13167,
-12427,
-14121,
-29847,
-49265,
-54831,
-52821,
-54077,
-54637,
-53527,
-54136,
-53270,
-52258,
-53497,
-45549,
-25296,
-11644,
-11788,
-12590,
-10846,
-11596,
-11858,
-11463,
-13139,
-12501,
-13796,
-28939,
-48614,
-54799,
-52785,
-53908,
-54587,
-53461,
-54104,
-53413,
-52274,
-53504,
-46179,
-26183,
-11945,
-11683,
-12596,
-10833,
-11566,
-11940,
-11422,
-13050,
-12623,
-13661,
-28219,
-48083,
-54819,
-52852,
-53891,
-54664,
-53444,
-54017,
-53466,
-52230,
-53467,
-46691,
-26943,
-12164,
-11584,
-12649,
-10852,
-11476,
-11925,
-11332,
-12937,
-12666,
-13353,
-27322,
-47399,
-54782,
-52894,
-53820,
-54704,
-53513,
-54120,
-53711,
-52315,
-53510,
-47308,
-27868,
-12535,
-11508,
-12628,
-10808,
-11380,
-11883,
-11174,
-12739,
-12683,
-13139,
-26549,
-46772,
-54725,
-52962,
-53815,
-54808,
-53578,
-54142,
-53830,
-52323,
-53486,
-47807,
-28639,
-12804,
-11405,
-12647,
-10828,
-11291,
-11820,
-11040,
-12610,
-12723,
-12879,
-25688,
-46050,
-54631,
-52988,
-53711,
-54760,
-53582,
-54208,
-54032,
-52386,
-53486,
-48363,
-29546,
-13240,
-11372,
-12654,
-10859,
-11266,
-11823,
-10934,
-12475,
-12817,
-12786,
-25072,
-45513,
-54653,
-53157,
-53759,
-54870,
-53655,
-54239,
-54121,
-52336,
-53370,
-48712,
-30193,
-13436,
-11172,
-12580,
-10859,
-11188,
-11761,
-10813,
-12375,
-12891,
-12601,
-24287,
-44802,
-54547,
-53225,
-53689,
-54825,
-53686,
-54340,
-54349,
-52432,
-53385,
-49213,
-31065,
-13876,
-11121,
-12537,
-10877,
-11168,
-11745,
-10726,
-12259,
-12985,
-12550,
-23729,
-44273,
-54551,
-53387,
-53695,
-54825,
-53664,
-54264,
-54322,
-52293,
-53201,
-49476,
-31676,
-14107,
-10943,
-12473,
-10937,
-11168,
-11732,
-10665,
-12191,
-13064,
-12413,
-23019,
-43564,
-54419,
-53482,
-53635,
-54767,
-53666,
-54317,
-54477,
-52362,
-53164,
-49864,
-32449,
-14536,
-10883,
-12436,
-10999,
-11212,
-11820,
-10713,
-12208,
-13234,
-12475,
-22589,
-43098,
-54447,
-53678,
-53664,
-54765,
-53660,
-54238,
-54434,
-52254,
-53009,
-50111,
-33073,
-14822,
-10737,
-12364,
-11072,
-11230,
-11818,
-10690,
-12147,
-13307,
-12381,
-21944,
-42390,
-54290,
-53782,
-53609,
-54683,
-53623,
-54216,
-54507,
-52271,
-52922,
-50384,
-33770,
-15230,
-10655,
-12261,
-11088,
-11210,
-11852,
-10699,
-12095,
-13354,
-12355,
-21436,
-41792,
-54164,
-53880,
-53559,
-54632,
-53590,
-54109,
-54443,
-52208,
-52828,
-50662,
-34473,
-15658,
-10642,
-12299,
-11265,
-11317,
-11959,
-10807,
-12143,
-13489,
-12358,
-20893,
-41108,
-53982,
-53956,
-53486,
-54527,
-53525,
-54024,
-54451,
-52241,
-52763,
-50946,
-35217,
-16206,
-10697,
-12339,
-11378,
-11394,
-12095,
-10960,
-12184,
-13600,
-12416,
-20471,
-40518,
-53822,
-54021,
-53407,
-54462,
-53467,
-53851,
-54312,
-52132,
-52591,
-51099,
-35815,
-16581,
-10629,
-12283,
-11461,
-11385,
-12124,
-11002,
-12127,
-13608,
-12346,
-19869,
-39718,
-53504,
-54004,
-53295,
-54379,
-53451,
-53803,
-54405,
-52311,
-52658,
-51450,
-36636,
-17237,
-10799,
-12404,
-11630,
-11490,
-12310,
-11218,
-12163,
-13683,
-12385,
-19451,
-39082,
-53268,
-53999,
-53175,
-54302,
-53396,
-53603,
-54264,
-52249,
-52523,
-51599,
-37259,
-17672,
-10790,
-12383,
-11705,
-11442,
-12315,
-11230,
-12037,
-13610,
-12310,
-18875,
-38290,
-52962,
-54017,
-53125,
-54301,
-53431,
-53555,
-54359,
-52456,
-52583,
-51900,
-38045,
-18326,
-10942,
-12452,
-11773,
-11409,
-12372,
-11328,
-11920,
-13530,
-12279,
-18420,
-37626,
-52732,
-54059,
-53096,
-54357,
-53521,
-53469,
-54347,
-52552,
-52557,
-52105,
-38718,
-18803,
-10920,
-12390,
-11750,
-11256,
-12286,
-11274,
-11682,
-13365,
-12157,
-17812,
-36795,
-52387,
-54079,
-53078,
-54433,
-53647,
-53498,
-54566,
-52916,
-52761,
-52499,
-39603,
-19534,
-11128,
-12483,
-11825,
-11216,
-12380,
-11425,
-11604,
-13327,
-12203,
-17448,
-36194,
-52225,
-54191,
-53107,
-54547,
-53759,
-53412,
-54550,
-53018,
-52694,
-52624,
-40183,
-19933,
-10988,
-12305,
-11701,
-10982,
-12249,
-11342,
-11313,
-13103,
-12073,
-16856,
-35363,
-51910,
-54282,
-53176,
-54704,
-53953,
-53458,
-54755,
-53371,
-52833,
-52880,
-40924,
-20520,
-11037,
-12242,
-11667,
-10871,
-12319,
-11530,
-11271,
-13083,
-12169,
-16546,
-34805,
-51814,
-54501,
-53302,
-54887,
-54132,
-53401,
-54740,
-53496,
-52800,
-53024,
-41561,
-20988,
-10942,
-12080,
-11606,
-10713,
-12280,
-11577,
-11122,
-12986,
-12188,
-16113,
-34097,
-51602,
-54710,
-53430,
-55006,
-54220,
-53265,
-54695,
-53604,
-52716,
-53055,
-42105,
-21444,
-10841,
-11869,
-11472,
-10524,
-12288,
-11735,
-11091,
-12944,
-12266,
-15801,
-33495,
-51453,
-54911,
-53507,
-55081,
-54292,
-53097,
-54531,
-53585,
-52567,
-53066,
-42630,
-21841,
-10634,
-11580,
-11338,
-10354,
-12227,
-11815,
-11016,
-12914,
-12366,
-15472,
-32830,
-51281,
-55202,
-53695,
-55204,
-54402,
-53008,
-54507,
-53740,
-52555,
-53148,
-43238,
-22399,
-10599,
-11400,
-11299,
-10296,
-12315,
-12089,
-11094,
-12950,
-12508,
-15227,
-32233,
-51107,
-55433,
-53790,
-55240,
-54465,
-52857,
-54343,
-53743,
-52467,
-53186,
-43816,
-22914,
-10487,
-11142,
-11246,
-10202,
-12294,
-12207,
-11066,
-12907,
-12580,
-14885,
-31484,
-50799,
-55643,
-53909,
-55260,
-54507,
-52746,
-54255,
-53876,
-52498,
-53317,
-44505,
-23651,
-10619,
-11075,
-11336,
-10244,
-12393,
-12462,
-11143,
-12856,
-12608,
-14546,
-30751,
-50481,
-55830,
-54005,
-55272,
-54612,
-52673,
-54106,
-53882,
-52444,
-53356,
-45092,
-24236,
-10553,
-10788,
-11291,
-10156,
-12300,
-12497,
-11058,
-12690,
-12537,
-14079,
-29810,
-49944,
-55911,
-54040,
-55208,
-54655,
-52633,
-54088,
-54099,
-52622,
-53589,
-45876,
-25138,
-10792,
-10725,
-11363,
-10160,
-12259,
-12621,
-11035,
-12509,
-12438,
-13661,
-28939,
-49421,
-55970,
-54032,
-55095,
-54691,
-52566,
-53912,
-54115,
-52644,
-53695,
-46549,
-25931,
-10941,
-10593,
-11480,
-10242,
-12248,
-12761,
-11094,
-12438,
-12447,
-13322,
-28064,
-48861,
-56054,
-54098,
-55001,
-54731,
-52536,
-53804,
-54203,
-52715,
-53744,
-47114,
-26690,
-11075,
-10361,
-11446,
-10176,
-12125,
-12847,
-11147,
-12339,
-12458,
-13102,
-27337,
-48394,
-56204,
-54217,
-54954,
-54861,
-52606,
-53713,
-54257,
-52771,
-53791,
-47668,
-27446,
-11191,
-10102,
-11436,
-10164,
-11975,
-12869,
-11167,
-12262,
-12506,
-12913,
-26572,
-47851,
-56335,
-54351,
-54876,
-54901,
-52596,
-53553,
-54246,
-52742,
-53691,
-48046,
-28127,
-11296,
-9814,
-11348,
-10076,
-11785,
-12884,
-11219,
-12151,
-12518,
-12753,
-25918,
-47380,
-56505,
-54540,
-54864,
-55052,
-52684,
-53398,
-54159,
-52651,
-53532,
-48338,
-28690,
-11298,
-9411,
-11200,
-9979,
-11548,
-12836,
-11227,
-12043,
-12523,
-12571,
-25139,
-46713,
-56491,
-54594,
-54698,
-55009,
-52618,
-53168,
-54047,
-52550,
-53318,
-48561,
-29292,
-11415,
-9101,
-11074,
-9910,
-11385,
-12911,
-11379,
-12072,
-12674,
-12610,
-24640,
-46272,
-56663,
-54850,
-54764,
-55232,
-52817,
-53135,
-54070,
-52576,
-53247,
-48911,
-30002,
-11641,
-8852,
-11004,
-9854,
-11177,
-12827,
-11375,
-11959,
-12691,
-12490,
-23917,
-45551,
-56576,
-54896,
-54605,
-55164,
-52768,
-52926,
-53995,
-52552,
-53137,
-49274,
-30851,
-12131,
-8877,
-11139,
-10045,
-11226,
-13039,
-11623,
-12044,
-12871,
-12576,
-23452,
-45036,
-56656,
-55135,
-54680,
-55352,
-52964,
-52908,
-54033,
-52597,
-53083,
-49586,
-31602,
-12475,
-8730,
-11095,
-10069,
-11109,
-13031,
-11706,
-12025,
-12958,
-12558,
-22816,
-44284,
-56475,
-55160,
-54527,
-55286,
-52952,
-52794,
-54034,
-52683,
-53076,
-50001,
-32531,
-13130,
-8856,
-11232,
-10223,
-11114,
-13122,
-11844,
-12014,
-13037,
-12581,
-22319,
-43660,
-56390,
-55342,
-54585,
-55429,
-53111,
-52742,
-53974,
-52612,
-52883,
-50127,
-33113,
-13440,
-8673,
-11085,
-10178,
-10967,
-13058,
-11871,
-11961,
-13044,
-12496,
-21660,
-42812,
-56095,
-55374,
-54561,
-55475,
-53252,
-52813,
-54128,
-52815,
-52991,
-50547,
-34038,
-14156,
-8830,
-11142,
-10257,
-10951,
-13099,
-11990,
-11983,
-13150,
-12582,
-21274,
-42219,
-55948,
-55540,
-54614,
-55555,
-53336,
-52739,
-54007,
-52717,
-52808,
-50673,
-34649,
-14613,
-8810,
-11067,
-10287,
-10848,
-13001,
-11952,
-11911,
-13145,
-12517,
-20703,
-41403,
-55609,
-55573,
-54577,
-55532,
-53424,
-52775,
-54061,
-52753,
-52738,
-50862,
-35353,
-15211,
-8899,
-11038,
-10353,
-10851,
-13035,
-12080,
-12008,
-13299,
-12649,
-20349,
-40756,
-55296,
-55590,
-54512,
-55487,
-53476,
-52738,
-53999,
-52723,
-52668,
-51087,
-36077,
-15868,
-9058,
-11081,
-10457,
-10815,
-12923,
-12038,
-11949,
-13317,
-12603,
-19797,
-39848,
-54759,
-55404,
-54249,
-55195,
-53299,
-52557,
-53819,
-52565,
-52438,
-51149,
-36754,
-16602,
-9367,
-11280,
-10790,
-11083,
-13167,
-12307,
-12140,
-13468,
-12664,
-19304,
-38919,
-54094,
-55102,
-53936,
-54987,
-53329,
-52652,
-53954,
-52783,
-52626,
-51578,
-37641,
-17415,
-9607,
-11308,
-10830,
-10877,
-12744,
-11826,
-11496,
-12670,
-11570,
-17424,
-36358,
-51562,
-52696,
-51242,
-52124,
-50583,
-49928,
-51334,
-50364,
-50381,
-49864,
-36851,
-17044,
-9104,
-10935,
-10795,
-10932,
-12898,
-12182,
-11941,
-13253,
-12289,
-17825,
-36427,
-51954,
-53455,
-51931,
-52762,
-51268,
-50414,
-51593,
-50514,
-50377,
-50007,
-37520,
-17793,
-9452,
-11233,
-11256,
-11284,
-13156,
-12573,
-12358,
-13743,
-12765,
-17826,
-35987,
-51806,
-53695,
-52088,
-52928,
-51641,
-50821,
-51989,
-50940,
-50683,
-50487,
-38552,
-18896,
-10052,
-11616,
-11689,
-11535,
-13288,
-12774,
-12509,
-13939,
-13044,
-17735,
-35516,
-51625,
-53905,
-52269,
-53151,
-52053,
-51125,
-52161,
-51087,
-50707,
-50641,
-39226,
-19619,
-10322,
-11782,
-11955,
-11602,
-13218,
-12793,
-12540,
-14032,
-13201,
-17458,
-34839,
-51298,
-54025,
-52348,
-53268,
-52393,
-51473,
-52508,
-51474,
-50949,
-51009,
-40153,
-20598,
-10762,
-11981,
-12200,
-11659,
-13219,
-12910,
-12628,
-14178,
-13492,
-17383,
-34361,
-51114,
-54224,
-52498,
-53484,
-52794,
-51780,
-52701,
-51712,
-51019,
-51182,
-40804,
-21255,
-10884,
-11975,
-12288,
-11563,
-13031,
-12859,
-12579,
-14215,
-13650,
-17128,
-33678,
-50796,
-54345,
-52555,
-53537,
-53022,
-51927,
-52826,
-51877,
-50990,
-51215,
-41402,
-21949,
-11052,
-11964,
-12355,
-11489,
-12936,
-12900,
-12505,
-14147,
-13735,
-16876,
-33030,
-50482,
-54468,
-52651,
-53700,
-53367,
-52121,
-52931,
-52054,
-51029,
-51330,
-42044,
-22620,
-11204,
-11998,
-12549,
-11527,
-12934,
-13041,
-12595,
-14264,
-13947,
-16627,
-32270,
-50025,
-54423,
-52482,
-53478,
-53271,
-51952,
-52780,
-52065,
-50916,
-51317,
-42653,
-23364,
-11428,
-12016,
-12649,
-11504,
-12916,
-13196,
-12617,
-14257,
-14081,
-16429,
-31630,
-49684,
-54501,
-52492,
-53503,
-53427,
-51919,
-52639,
-52041,
-50801,
-51305,
-43204,
-24008,
-11569,
-12034,
-12868,
-11608,
-12996,
-13401,
-12728,
-14309,
-14214,
-16109,
-30791,
-49157,
-54470,
-52410,
-53360,
-53413,
-51819,
-52576,
-52180,
-50840,
-51400,
-43876,
-24839,
-11845,
-12051,
-12958,
-11612,
-13017,
-13602,
-12793,
-14284,
-14344,
-15938,
-30182,
-48814,
-54590,
-52476,
-53405,
-53573,
-51830,
-52499,
-52280,
-50915,
-51560,
-44583,
-25641,
-12083,
-12032,
-13083,
-11610,
-12933,
-13616,
-12692,
-14116,
-14268,
-15505,
-29229,
-48176,
-54531,
-52449,
-53303,
-53593,
-51789,
-52496,
-52487,
-51059,
-51695,
-45243,
-26484,
-12359,
-11961,
-13086,
-11564,
-12896,
-13743,
-12692,
-13964,
-14209,
-15177,
-28438,
-47615,
-54506,
-52458,
-53283,
-53730,
-51840,
-52450,
-52608,
-51165,
-51861,
-45883,
-27267,
-12564,
-11844,
-13115,
-11543,
-12763,
-13701,
-12570,
-13762,
-14111,
-14803,
-27583,
-47040,
-54583,
-52640,
-53360,
-53877,
-51950,
-52526,
-52859,
-51370,
-52022,
-46509,
-28140,
-12922,
-11786,
-13114,
-11526,
-12711,
-13804,
-12585,
-13624,
-14056,
-14553,
-26866,
-46458,
-54547,
-52676,
-53318,
-53972,
-51993,
-52461,
-52909,
-51424,
-52061,
-46965,
-28788,
-13027,
-11483,
-12944,
-11361,
-12443,
-13610,
-12383,
-13350,
-13912,
-14207,
-26043,
-45810,
-54580,
-52879,
-53376,
-54077,
-52066,
-52443,
-53002,
-51480,
-52029,
-47363,
-29517,
-13317,
-11333,
-12858,
-11303,
-12322,
-13632,
-12396,
-13225,
-13872,
-14045,
-25425,
-45288,
-54603,
-53040,
-53426,
-54255,
-52261,
-52489,
-53112,
-51596,
-52117,
-47797,
-30199,
-13497,
-11046,
-12678,
-11175,
-12069,
-13455,
-12297,
-13095,
-13883,
-13927,
-24827,
-44748,
-54698,
-53341,
-53543,
-54407,
-52418,
-52541,
-53220,
-51688,
-52090,
-48133,
-30888,
-13824,
-10863,
-12518,
-11057,
-11841,
-13329,
-12217,
-12913,
-13774,
-13751,
-24225,
-44163,
-54691,
-53553,
-53652,
-54650,
-52754,
-52734,
-53424,
-51898,
-52243,
-48597,
-31649,
-14142,
-10643,
-12352,
-10963,
-11583,
-13103,
-12086,
-12767,
-13726,
-13593,
-23554,
-43434,
-54554,
-53686,
-53617,
-54667,
-52838,
-52734,
-53446,
-51935,
-52198,
-48882,
-32389,
-14617,
-10632,
-12343,
-11019,
-11491,
-13054,
-12112,
-12691,
-13686,
-13487,
-23009,
-42820,
-54464,
-53848,
-53648,
-54785,
-53060,
-52794,
-53461,
-51958,
-52190,
-49195,
-33088,
-15003,
-10488,
-12225,
-11007,
-11325,
-12908,
-12104,
-12704,
-13798,
-13522,
-22514,
-42161,
-54318,
-53981,
-53605,
-54746,
-53121,
-52769,
-53449,
-51996,
-52158,
-49521,
-33910,
-15652,
-10631,
-12337,
-11208,
-11399,
-13000,
-12302,
-12818,
-13930,
-13553,
-22060,
-41506,
-54138,
-54081,
-53579,
-54774,
-53264,
-52757,
-53348,
-51863,
-51985,
-49643,
-34493,
-16024,
-10505,
-12237,
-11265,
-11340,
-12942,
-12375,
-12903,
-14066,
-13593,
-21547,
-40760,
-53850,
-54108,
-53447,
-54642,
-53230,
-52637,
-53212,
-51766,
-51858,
-49857,
-35246,
-16655,
-10637,
-12293,
-11387,
-11296,
-12901,
-12433,
-12920,
-14108,
-13569,
-21055,
-40045,
-53574,
-54137,
-53363,
-54622,
-53347,
-52636,
-53141,
-51719,
-51782,
-50103,
-35967,
-17205,
-10672,
-12287,
-11499,
-11277,
-12870,
-12530,
-13025,
-14237,
-13587,
-20516,
-39221,
-53198,
-54116,
-53254,
-54542,
-53420,
-52647,
-53140,
-51745,
-51776,
-50403,
-36789,
-17920,
-10845,
-12343,
-11616,
-11244,
-12792,
-12526,
-12948,
-14149,
-13422,
-19893,
-38370,
-52830,
-54146,
-53245,
-54582,
-53587,
-52711,
-53134,
-51775,
-51792,
-50716,
-37591,
-18567,
-10931,
-12285,
-11637,
-11103,
-12612,
-12456,
-12860,
-14095,
-13285,
-19257,
-37459,
-52373,
-54120,
-53169,
-54571,
-53746,
-52850,
-53282,
-51984,
-51945,
-51128,
-38476,
-19305,
-11063,
-12227,
-11613,
-10936,
-12412,
-12352,
-12701,
-13962,
-13119,
-18664,
-36634,
-52036,
-54232,
-53277,
-54734,
-54049,
-53056,
-53423,
-52146,
-52045,
-51469,
-39279,
-19971,
-11152,
-12158,
-11618,
-10807,
-12231,
-12270,
-12589,
-13879,
-12995,
-18092,
-35803,
-51685,
-54340,
-53356,
-54832,
-54264,
-53211,
-53540,
-52277,
-52093,
-51727,
-40006,
-20582,
-11171,
-11960,
-11497,
-10584,
-12013,
-12144,
-12458,
-13792,
-12944,
-17644,
-35112,
-51423,
-54532,
-53521,
-54981,
-54476,
-53301,
-53551,
-52301,
-52039,
-51879,
-40619,
-21107,
-11145,
-11758,
-11379,
-10391,
-11818,
-12079,
-12411,
-13811,
-12976,
-17256,
-34446,
-51173,
-54712,
-53652,
-55062,
-54639,
-53377,
-53587,
-52327,
-51956,
-51989,
-41204,
-21635,
-11110,
-11541,
-11275,
-10277,
-11729,
-12103,
-12401,
-13861,
-13042,
-16920,
-33776,
-50877,
-54837,
-53755,
-55122,
-54730,
-53347,
-53489,
-52255,
-51801,
-52024,
-41738,
-22158,
-11164,
-11439,
-11301,
-10250,
-11706,
-12184,
-12464,
-13952,
-13126,
-16570,
-33103,
-50545,
-54910,
-53744,
-55023,
-54684,
-53243,
-53353,
-52150,
-51619,
-52065,
-42309,
-22759,
-11253,
-11350,
-11354,
-10320,
-11801,
-12358,
-12597,
-14110,
-13304,
-16315,
-32432,
-50138,
-54887,
-53706,
-54910,
-54623,
-53101,
-53200,
-52071,
-51467,
-52079,
-42801,
-23293,
-11341,
-11255,
-11376,
-10299,
-11761,
-12406,
-12591,
-14118,
-13292,
-15898,
-31653,
-49671,
-54860,
-53642,
-54801,
-54606,
-53082,
-53200,
-52118,
-51446,
-52255,
-43529,
-24113,
-11664,
-11336,
-11545,
-10439,
-11842,
-12462,
-12524,
-14022,
-13246,
-15453,
-30786,
-49050,
-54688,
-53536,
-54677,
-54572,
-53040,
-53210,
-52266,
-51570,
-52517,
-44273,
-24946,
-12036,
-11467,
-11718,
-10508,
-11811,
-12444,
-12424,
-13887,
-13106,
-14939,
-29871,
-48418,
-54494,
-53355,
-54446,
-54490,
-53046,
-53289,
-52447,
-51688,
-52787,
-45074,
-25870,
-12473,
-11594,
-11926,
-10678,
-11872,
-12450,
-12254,
-13687,
-12968,
-14483,
-28994,
-47739,
-54315,
-53285,
-54380,
-54535,
-53114,
-53398,
-52685,
-51878,
-53036,
-45737,
-26664,
-12825,
-11683,
-12054,
-10713,
-11775,
-12357,
-12099,
-13499,
-12821,
-14042,
-28171,
-47165,
-54221,
-53223,
-54232,
-54527,
-53191,
-53535,
-52903,
-52022,
-53255,
-46445,
-27534,
-13200,
-11693,
-12132,
-10796,
-11766,
-12314,
-11938,
-13311,
-12769,
-13752,
-27448,
-46580,
-54139,
-53263,
-54229,
-54608,
-53251,
-53596,
-53059,
-52116,
-53317,
-46864,
-28108,
-13373,
-11585,
-12118,
-10756,
-11636,
-12243,
-11856,
-13204,
-12733,
-13474,
-26787,
-46118,
-54162,
-53332,
-54146,
-54600,
-53310,
-53642,
-53162,
-52120,
-53357,
-47355,
-28837,
-13644,
-11467,
-12088,
-10785,
-11634,
-12255,
-11815,
-13163,
-12859,
-13442,
-26315,
-45710,
-54228,
-53527,
-54237,
-54702,
-53336,
-53601,
-53172,
-52084,
-53271,
-47609,
-29303,
-13767,
-11300,
-12024,
-10769,
-11562,
-12281,
-11871,
-13203,
-12944,
-13291,
-25731,
-45238,
-54240,
-53609,
-54152,
-54638,
-53307,
-53532,
-53123,
-51940,
-53128,
-47927,
-29918,
-14007,
-11134,
-11929,
-10783,
-11581,
-12351,
-11904,
-13230,
-13123,
-13331,
-25299,
-44801,
-54233,
-53753,
-54190,
-54663,
-53244,
-53378,
-53037,
-51836,
-53007,
-48172,
-30443,
-14230,
-11073,
-11942,
-10831,
-11572,
-12424,
-12015,
-13300,
-13244,
-13185,
-24683,
-44244,
-54153,
-53784,
-54084,
-54602,
-53224,
-53350,
-53047,
-51757,
-52924,
-48555,
-31194,
-14635,
-11079,
-11988,
-10960,
-11701,
-12603,
-12118,
-13358,
-13438,
-13223,
-24203,
-43695,
-54014,
-53787,
-54021,
-54550,
-53113,
-53150,
-52955,
-51641,
-52783,
-48786,
-31720,
-14872,
-11001,
-11968,
-10945,
-11585,
-12565,
-12081,
-13293,
-13458,
-13028,
-23514,
-43061,
-53876,
-53798,
-53911,
-54509,
-53126,
-53179,
-53069,
-51673,
-52742,
-49204,
-32526,
-15339,
-11041,
-12019,
-11045,
-11662,
-12689,
-12116,
-13230,
-13573,
-13037,
-23029,
-42516,
-53776,
-53867,
-53930,
-54590,
-53164,
-53130,
-53161,
-51749,
-52746,
-49537,
-33158,
-15623,
-10958,
-12004,
-11012,
-11535,
-12626,
-12060,
-13115,
-13578,
-12898,
-22394,
-41932,
-53747,
-54002,
-53923,
-54635,
-53237,
-53180,
-53317,
-51826,
-52689,
-49881,
-33895,
-15997,
-10851,
-11898,
-10966,
-11444,
-12626,
-11979,
-12916,
-13558,
-12862,
-21899,
-41409,
-53746,
-54211,
-54060,
-54834,
-53372,
-53182,
-53426,
-51945,
-52678,
-50154,
-34475,
-16189,
-10612,
-11730,
-10848,
-11243,
-12538,
-11927,
-12783,
-13539,
-12736,
-21266,
-40781,
-53721,
-54395,
-54063,
-54852,
-53401,
-53152,
-53523,
-52030,
-52623,
-50469,
-35217,
-16572,
-10441,
-11553,
-10773,
-11155,
-12588,
-11976,
-12684,
-13587,
-12782,
-20851,
-40290,
-53775,
-54696,
-54234,
-55026,
-53492,
-53035,
-53456,
-52013,
-52491,
-50642,
-35756,
-16783,
-10166,
-11364,
-10718,
-11065,
-12632,
-12124,
-12729,
-13685,
-12743,
-20247,
-39588,
-53668,
-54890,
-54241,
-55003,
-53470,
-52893,
-53394,
-51976,
-52360,
-50865,
-36495,
-17251,
-10050,
-11195,
-10685,
-11039,
-12764,
-12336,
-12824,
-13848,
-12898,
-19904,
-39053,
-53638,
-55136,
-54338,
-55043,
-53432,
-52616,
-53103,
-51769,
-52119,
-50962,
-37075,
-17597,
-9882,
-11035,
-10688,
-10988,
-12825,
-12526,
-12946,
-13987,
-12873,
-19288,
-38205,
-53341,
-55220,
-54291,
-54972,
-53398,
-52475,
-52986,
-51673,
-51945,
-51126,
-37799,
-18176,
-9878,
-10929,
-10693,
-10981,
-12912,
-12710,
-13033,
-14094,
-12940,
-18846,
-37503,
-53081,
-55311,
-54291,
-54954,
-53376,
-52269,
-52740,
-51515,
-51802,
-51358,
-38567,
-18822,
-10001,
-10973,
-10832,
-11015,
-12957,
-12860,
-13159,
-14249,
-12976,
-18297,
-36655,
-52700,
-55344,
-54263,
-54920,
-53452,
-52298,
-52806,
-51596,
-51795,
-51642,
-39401,
-19562,
-10173,
-10954,
-10876,
-10984,
-12952,
-12919,
-13135,
-14250,
-12938,
-17773,
-35822,
-52258,
-55286,
-54175,
-54880,
-53492,
-52249,
-52734,
-51575,
-51755,
-51907,
-40205,
-20270,
-10360,
-10997,
-10973,
-10920,
-12809,
-12809,
-12981,
-14165,
-12813,
-17135,
-34885,
-51772,
-55249,
-54118,
-54845,
-53581,
-52342,
-52882,
-51761,
-51812,
-52197,
-41035,
-21045,
-10587,
-11018,
-11020,
-10859,
-12736,
-12776,
-12832,
-14067,
-12730,
-16631,
-34070,
-51360,
-55232,
-54115,
-54915,
-53791,
-52484,
-53039,
-51957,
-51902,
-52500,
-41805,
-21716,
-10691,
-10971,
-11030,
-10725,
-12539,
-12611,
-12600,
-13911,
-12610,
-16028,
-33146,
-50875,
-55213,
-54076,
-54899,
-53895,
-52570,
-53189,
-52182,
-51949,
-52712,
-42551,
-22429,
-10840,
-10912,
-11000,
-10571,
-12380,
-12505,
-12365,
-13717,
-12526,
-15570,
-32390,
-50548,
-55337,
-54187,
-55076,
-54200,
-52765,
-53365,
-52419,
-52046,
-52954,
-43303,
-23102,
-10924,
-10825,
-11008,
-10446,
-12219,
-12449,
-12227,
-13659,
-12567,
-15166,
-31573,
-50144,
-55419,
-54229,
-55126,
-54376,
-52874,
-53524,
-52698,
-52145,
-53125,
-44017,
-23835,
-11046,
-10702,
-10936,
-10236,
-12031,
-12401,
-12074,
-13505,
-12591,
-14846,
-30874,
-49849,
-55626,
-54417,
-55357,
-54756,
-53079,
-53620,
-52858,
-52131,
-53163,
-44608,
-24451,
-11067,
-10514,
-10888,
-10032,
-11777,
-12295,
-11895,
-13353,
-12599,
-14448,
-29961,
-49286,
-55620,
-54388,
-55320,
-54893,
-53128,
-53663,
-53053,
-52161,
-53189,
-45205,
-25194,
-11186,
-10329,
-10768,
-9768,
-11499,
-12247,
-11799,
-13245,
-12724,
-14283,
-29302,
-48915,
-55775,
-54511,
-55430,
-55190,
-53264,
-53626,
-53097,
-52058,
-53082,
-45679,
-25870,
-11295,
-10189,
-10803,
-9649,
-11262,
-12162,
-11672,
-13104,
-12788,
-14034,
-28470,
-48342,
-55818,
-54571,
-55438,
-55393,
-53411,
-53678,
-53279,
-52077,
-53002,
-46158,
-26642,
-11530,
-10083,
-10816,
-9546,
-11066,
-12181,
-11670,
-13057,
-12975,
-14023,
-27889,
-47915,
-55917,
-54663,
-55460,
-55643,
-53606,
-53704,
-53388,
-52081,
-52921,
-46596,
-27382,
-11762,
-10004,
-10924,
-9569,
-10888,
-12122,
-11601,
-12950,
-13067,
-13906,
-27146,
-47283,
-55876,
-54659,
-55319,
-55710,
-53692,
-53727,
-53539,
-52133,
-52824,
-46970,
-28140,
-12073,
-9954,
-11024,
-9629,
-10820,
-12186,
-11674,
-12924,
-13243,
-13971,
-26672,
-46861,
-55974,
-54789,
-55316,
-55907,
-53943,
-53848,
-53756,
-52313,
-52884,
-47459,
-28948,
-12430,
-9933,
-11181,
-9776,
-10727,
-12114,
-11567,
-12721,
-13216,
-13792,
-25939,
-46158,
-55846,
-54744,
-55063,
-55764,
-53886,
-53764,
-53839,
-52363,
-52813,
-47781,
-29671,
-12783,
-9867,
-11242,
-9874,
-10672,
-12103,
-11485,
-12496,
-13097,
-13615,
-25296,
-45527,
-55751,
-54754,
-54913,
-55746,
-53958,
-53772,
-53950,
-52502,
-52846,
-48147,
-30334,
-13033,
-9707,
-11245,
-9970,
-10612,
-12028,
-11384,
-12277,
-12992,
-13394,
-24600,
-44851,
-55667,
-54828,
-54780,
-55653,
-53953,
-53795,
-54153,
-52749,
-53028,
-48680,
-31226,
-13550,
-9736,
-11312,
-10121,
-10669,
-12121,
-11422,
-12173,
-12945,
-13269,
-24047,
-44327,
-55690,
-55060,
-54871,
-55793,
-54139,
-53895,
-54314,
-52910,
-53129,
-49083,
-31889,
-13775,
-9464,
-11097,
-10012,
-10463,
-11913,
-11198,
-11874,
-12719,
-12896,
-23213,
-43543,
-55536,
-55210,
-54881,
-55812,
-54209,
-53982,
-54529,
-53168,
-53359,
-49692,
-32855,
-14385,
-9520,
-11090,
-10065,
-10459,
-11947,
-11213,
-11772,
-12678,
-12760,
-22675,
-43037,
-55603,
-55550,
-55119,
-56032,
-54397,
-54032,
-54572,
-53197,
-53358,
-50032,
-33488,
-14618,
-9248,
-10823,
-9933,
-10318,
-11871,
-11183,
-11725,
-12690,
-12579,
-21980,
-42313,
-55476,
-55758,
-55239,
-56128,
-54491,
-54088,
-54694,
-53276,
-53386,
-50414,
-34233,
-15032,
-9093,
-10548,
-9713,
-10094,
-11759,
-11117,
-11634,
-12709,
-12489,
-21453,
-41745,
-55419,
-55985,
-55400,
-56268,
-54591,
-54035,
-54602,
-53136,
-53231,
-50668,
-34865,
-15362,
-8926,
-10347,
-9577,
-9916,
-11615,
-11040,
-11571,
-12771,
-12359,
-20765,
-40946,
-55153,
-56051,
-55411,
-56288,
-54626,
-54041,
-54647,
-53127,
-53149,
-50987,
-35645,
-15921,
-8993,
-10318,
-9585,
-9911,
-11705,
-11174,
-11688,
-12970,
-12426,
-20288,
-40318,
-54940,
-56103,
-55411,
-56338,
-54692,
-53993,
-54577,
-52990,
-52983,
-51223,
-36349,
-16396,
-9038,
-10326,
-9657,
-9871,
-11664,
-11136,
-11645,
-13044,
-12338,
-19609,
-39447,
-54542,
-56003,
-55263,
-56208,
-54627,
-53903,
-54577,
-52940,
-52860,
-51491,
-37144,
-17048,
-9229,
-10407,
-9731,
-9847,
-11659,
-11122,
-11553,
-13039,
-12234,
-18969,
-38582,
-54063,
-55779,
-55011,
-56073,
-54593,
-53867,
-54611,
-53005,
-52883,
-51910,
-38044,
-17776,
-9502,
-10642,
-9999,
-9982,
-11750,
-11188,
-11560,
-13165,
-12245,
-18409,
-37777,
-53701,
-55728,
-54906,
-56008,
-54621,
-53913,
-54777,
-53182,
-52954,
-52323,
-38997,
-18616,
-9868,
-10884,
-10213,
-10053,
-11759,
-11131,
-11333,
-12980,
-12011,
-17686,
-36857,
-53207,
-55570,
-54741,
-55960,
-54690,
-53949,
-54864,
-53298,
-52975,
-52656,
-39787,
-19239,
-10006,
-10952,
-10355,
-10067,
-11761,
-11120,
-11263,
-13000,
-11987,
-17138,
-36047,
-52850,
-55578,
-54714,
-55971,
-54803,
-54066,
-55120,
-53591,
-53145,
-53047,
-40656,
-19959,
-10165,
-10916,
-10297,
-9897,
-11601,
-10982,
-10995,
-12796,
-11807,
-16534,
-35225,
-52456,
-55556,
-54695,
-56024,
-54940,
-54096,
-55146,
-53627,
-53043,
-53159,
-41199,
-20335,
-9991,
-10612,
-10049,
-9559,
-11293,
-10760,
-10747,
-12674,
-11730,
-16008,
-34440,
-52141,
-55679,
-54807,
-56155,
-55100,
-54168,
-55261,
-53788,
-53063,
-53371,
-41932,
-20983,
-10076,
-10434,
-9846,
-9231,
-11028,
-10600,
-10499,
-12516,
-11671,
-15580,
-33764,
-51887,
-55866,
-55013,
-56419,
-55404,
-54276,
-55282,
-53801,
-52903,
-53373,
-42416,
-21398,
-9947,
-10174,
-9683,
-9017,
-10888,
-10606,
-10474,
-12569,
-11768,
-15180,
-32966,
-51485,
-55939,
-55103,
-56527,
-55576,
-54312,
-55306,
-53861,
-52781,
-53375,
-42995,
-22021,
-10041,
-10033,
-9549,
-8787,
-10739,
-10645,
-10462,
-12624,
-11964,
-15018,
-32404,
-51242,
-56100,
-55251,
-56703,
-55812,
-54308,
-55166,
-53756,
-52531,
-53272,
-43462,
-22584,
-10135,
-9959,
-9578,
-8702,
-10684,
-10788,
-10582,
-12799,
-12229,
-14830,
-31692,
-50795,
-56107,
-55260,
-56729,
-55945,
-54309,
-55109,
-53778,
-52398,
-53205,
-44005,
-23323,
-10396,
-9972,
-9623,
-8608,
-10616,
-10913,
-10668,
-12876,
-12458,
-14697,
-31027,
-50289,
-55990,
-55110,
-56610,
-55984,
-54210,
-54903,
-53664,
-52200,
-53083,
-44458,
-23997,
-10621,
-10022,
-9786,
-8645,
-10591,
-11064,
-10791,
-12983,
-12669,
-14508,
-30236,
-49655,
-55803,
-54942,
-56435,
-55998,
-54175,
-54800,
-53700,
-52114,
-53040,
-45028,
-24912,
-11184,
-10359,
-10212,
-8925,
-10759,
-11333,
-10945,
-13023,
-12830,
-14391,
-29589,
-49108,
-55693,
-54821,
-56324,
-56094,
-54218,
-54752,
-53784,
-52182,
-53128,
-45652,
-25805,
-11645,
-10560,
-10507,
-9064,
-10736,
-11419,
-11004,
-13020,
-12935,
-14180,
-28733,
-48282,
-55253,
-54359,
-55797,
-55791,
-53991,
-54553,
-53839,
-52264,
-53270,
-46367,
-26937,
-12434,
-11065,
-11052,
-9393,
-10782,
-11409,
-10761,
-12539,
-12506,
-13568,
-27670,
-47376,
-54913,
-54162,
-55651,
-55970,
-54249,
-54837,
-54382,
-53019,
-54251,
-48122,
-29326,
-14776,
-13442,
-13822,
-12248,
-13524,
-14201,
-13430,
-14924,
-14757,
-15289,
-28500,
-47878,
-55516,
-54444,
-55544,
-55815,
-54006,
-54436,
-54048,
-52576,
-53640,
-47814,
-29241,
-14245,
-12574,
-13121,
-11621,
-12924,
-13881,
-13247,
-14745,
-14758,
-15179,
-27902,
-47275,
-55294,
-54191,
-55107,
-55476,
-53616,
-53864,
-53516,
-52016,
-53031,
-47614,
-29374,
-14070,
-12168,
-12951,
-11487,
-12651,
-13665,
-13024,
-14409,
-14508,
-14751,
-27000,
-46435,
-54965,
-53921,
-54678,
-55161,
-53368,
-53581,
-53383,
-51912,
-52893,
-47856,
-29908,
-14174,
-11865,
-12710,
-11256,
-12298,
-13438,
-12844,
-14184,
-14421,
-14580,
-26397,
-45879,
-54869,
-53878,
-54451,
-55033,
-53251,
-53345,
-53228,
-51795,
-52779,
-48163,
-30536,
-14473,
-11838,
-12848,
-11428,
-12287,
-13409,
-12740,
-13900,
-14118,
-14055,
-25380,
-44933,
-54508,
-53698,
-54172,
-54880,
-53178,
-53225,
-53201,
-51777,
-52742,
-48505,
-31206,
-14758,
-11703,
-12795,
-11410,
-12168,
-13344,
-12697,
-13762,
-14038,
-13794,
-24636,
-44180,
-54237,
-53528,
-53828,
-54607,
-52964,
-52952,
-53035,
-51685,
-52709,
-48923,
-31973,
-15142,
-11673,
-12848,
-11525,
-12153,
-13346,
-12697,
-13674,
-13974,
-13501,
-23791,
-43344,
-53942,
-53430,
-53592,
-54437,
-52870,
-52815,
-52967,
-51612,
-52623,
-49265,
-32677,
-15497,
-11569,
-12801,
-11565,
-12102,
-13360,
-12724,
-13661,
-14012,
-13358,
-23119,
-42645,
-53775,
-53457,
-53491,
-54387,
-52880,
-52744,
-52919,
-51533,
-52538,
-49616,
-33419,
-15899,
-11522,
-12813,
-11673,
-12121,
-13386,
-12793,
-13688,
-14134,
-13250,
-22447,
-41894,
-53570,
-53489,
-53393,
-54342,
-52910,
-52738,
-52938,
-51500,
-52450,
-49953,
-34172,
-16324,
-11427,
-12704,
-11619,
-11952,
-13242,
-12678,
-13593,
-14180,
-13184,
-21847,
-41220,
-53425,
-53581,
-53329,
-54296,
-52897,
-52642,
-52825,
-51302,
-52181,
-50117,
-34793,
-16665,
-11278,
-12570,
-11576,
-11796,
-13067,
-12526,
-13438,
-14181,
-13050,
-21145,
-40398,
-53158,
-53611,
-53273,
-54282,
-53007,
-52740,
-52961,
-51349,
-52117,
-50430,
-35592,
-17191,
-11285,
-12537,
-11637,
-11754,
-13025,
-12510,
-13435,
-14365,
-13158,
-20698,
-39771,
-53019,
-53747,
-53260,
-54270,
-53071,
-52759,
-52984,
-51279,
-51907,
-50600,
-36272,
-17663,
-11251,
-12486,
-11702,
-11711,
-12947,
-12418,
-13354,
-14455,
-13199,
-20164,
-39016,
-52759,
-53803,
-53196,
-54217,
-53131,
-52837,
-53112,
-51332,
-51787,
-50819,
-37029,
-18246,
-11305,
-12490,
-11802,
-11713,
-12883,
-12335,
-13230,
-14524,
-13255,
-19676,
-38285,
-52498,
-53871,
-53141,
-54157,
-53176,
-52881,
-53214,
-51357,
-51647,
-50993,
-37777,
-18870,
-11436,
-12599,
-12065,
-11889,
-12994,
-12390,
-13200,
-14626,
-13309,
-19122,
-37379,
-52007,
-53702,
-52828,
-53837,
-52985,
-52759,
-53207,
-51356,
-51482,
-51135,
-38503,
-19503,
-11536,
-12622,
-12229,
-11979,
-13027,
-12405,
-13150,
-14733,
-13466,
-18736,
-36646,
-51673,
-53700,
-52663,
-53598,
-52830,
-52594,
-53120,
-51281,
-51244,
-51171,
-39161,
-20130,
-11661,
-12688,
-12471,
-12156,
-13145,
-12484,
-13101,
-14774,
-13525,
-18246,
-35762,
-51202,
-53623,
-52491,
-53404,
-52772,
-52579,
-53228,
-51455,
-51264,
-51426,
-40018,
-20967,
-11945,
-12844,
-12784,
-12389,
-13331,
-12639,
-13130,
-14873,
-13691,
-17906,
-35003,
-50825,
-53646,
-52388,
-53213,
-52652,
-52424,
-53141,
-51435,
-51082,
-51446,
-40655,
-21637,
-12064,
-12832,
-12929,
-12487,
-13374,
-12683,
-13019,
-14804,
-13701,
-17430,
-34101,
-50313,
-53613,
-52299,
-53076,
-52629,
-52382,
-53179,
-51582,
-51084,
-51605,
-41404,
-22419,
-12247,
-12786,
-13005,
-12483,
-13329,
-12669,
-12872,
-14693,
-13699,
-17001,
-33233,
-49810,
-53624,
-52274,
-52985,
-52626,
-52317,
-53141,
-51655,
-51026,
-51677,
-42078,
-23187,
-12450,
-12738,
-13091,
-12506,
-13311,
-12706,
-12775,
-14567,
-13665,
-16542,
-32293,
-49194,
-53549,
-52203,
-52875,
-52629,
-52280,
-53122,
-51778,
-51055,
-51798,
-42797,
-24017,
-12705,
-12704,
-13163,
-12526,
-13308,
-12811,
-12794,
-14583,
-13796,
-16313,
-31573,
-48784,
-53680,
-52362,
-52954,
-52787,
-52313,
-53100,
-51832,
-50992,
-51797,
-43348,
-24734,
-12869,
-12563,
-13121,
-12447,
-13216,
-12857,
-12766,
-14510,
-13819,
-15959,
-30702,
-48151,
-53603,
-52359,
-52917,
-52869,
-52323,
-53068,
-51930,
-51022,
-51886,
-43991,
-25560,
-13162,
-12496,
-13129,
-12395,
-13167,
-12966,
-12848,
-14571,
-13986,
-15808,
-30031,
-47664,
-53640,
-52446,
-52924,
-52919,
-52239,
-52867,
-51827,
-50847,
-51778,
-44421,
-26260,
-13394,
-12403,
-13107,
-12351,
-13120,
-13089,
-12942,
-14604,
-14099,
-15606,
-29286,
-47058,
-53547,
-52444,
-52872,
-52930,
-52140,
-52663,
-51717,
-50700,
-51678,
-44849,
-26973,
-13678,
-12345,
-13109,
-12324,
-13093,
-13236,
-13089,
-14692,
-14277,
-15501,
-28653,
-46510,
-53483,
-52472,
-52836,
-52956,
-52052,
-52436,
-51563,
-50503,
-51491,
-45150,
-27581,
-13919,
-12274,
-13095,
-12306,
-13060,
-13382,
-13249,
-14778,
-14451,
-15417,
-28045,
-45948,
-53369,
-52474,
-52788,
-53002,
-52015,
-52296,
-51518,
-50450,
-51453,
-45592,
-28331,
-14327,
-12333,
-13183,
-12333,
-13050,
-13507,
-13366,
-14837,
-14578,
-15327,
-27443,
-45386,
-53237,
-52459,
-52725,
-53006,
-51933,
-52088,
-51393,
-50300,
-51336,
-45934,
-29022,
-14723,
-12444,
-13332,
-12465,
-13139,
-13722,
-13556,
-14918,
-14702,
-15174,
-26782,
-44689,
-52949,
-52279,
-52514,
-52893,
-51782,
-51875,
-51297,
-50218,
-51294,
-46339,
-29761,
-15182,
-12596,
-13517,
-12617,
-13262,
-13955,
-13783,
-15067,
-14908,
-15163,
-26275,
-44155,
-52790,
-52209,
-52381,
-52809,
-51636,
-51629,
-51145,
-50054,
-51145,
-46609,
-30361,
-15524,
-12654,
-13611,
-12701,
-13305,
-14099,
-13894,
-15080,
-14976,
-15016,
-25650,
-43510,
-52517,
-52049,
-52182,
-52689,
-51492,
-51453,
-51091,
-50027,
-51135,
-47008,
-31079,
-15976,
-12816,
-13794,
-12877,
-13430,
-14316,
-14065,
-15164,
-15112,
-14979,
-25149,
-42999,
-52374,
-52004,
-52066,
-52618,
-51366,
-51263,
-51004,
-49935,
-51023,
-47275,
-31647,
-16283,
-12830,
-13857,
-12950,
-13473,
-14451,
-14144,
-15141,
-15143,
-14837,
-24549,
-42389,
-52151,
-51904,
-51905,
-52520,
-51249,
-51114,
-50989,
-49940,
-51002,
-47617,
-32282,
-16634,
-12858,
-13918,
-13020,
-13510,
-14567,
-14223,
-15112,
-15206,
-14763,
-24065,
-41902,
-52099,
-51979,
-51910,
-52569,
-51260,
-51065,
-51056,
-50000,
-50999,
-47945,
-32900,
-16955,
-12830,
-13930,
-13050,
-13503,
-14638,
-14234,
-15004,
-15167,
-14602,
-23458,
-41295,
-51927,
-51972,
-51830,
-52549,
-51235,
-51008,
-51154,
-50126,
-51078,
-48361,
-33632,
-17380,
-12870,
-13976,
-13120,
-13509,
-14716,
-14260,
-14910,
-15161,
-14506,
-22936,
-40755,
-51848,
-52074,
-51822,
-52569,
-51225,
-50922,
-51186,
-50177,
-51050,
-48661,
-34270,
-17732,
-12819,
-13951,
-13144,
-13486,
-14765,
-14281,
-14794,
-15119,
-14368,
-22343,
-40104,
-51665,
-52096,
-51751,
-52533,
-51203,
-50831,
-51232,
-50262,
-51073,
-48992,
-34978,
-18165,
-12817,
-13956,
-13213,
-13503,
-14856,
-14375,
-14762,
-15167,
-14351,
-21866,
-39530,
-51560,
-52209,
-51740,
-52528,
-51191,
-50721,
-51209,
-50276,
-50993,
-49213,
-35603,
-18550,
-12756,
-13896,
-13242,
-13473,
-14911,
-14451,
-14729,
-15201,
-14335,
-21378,
-38898,
-51379,
-52280,
-51687,
-52493,
-51170,
-50613,
-51168,
-50286,
-50921,
-49421,
-36263,
-19011,
-12760,
-13890,
-13328,
-13492,
-14982,
-14577,
-14738,
-15285,
-14386,
-20980,
-38309,
-51250,
-52418,
-51715,
-52514,
-51224,
-50535,
-51120,
-50268,
-50789,
-49546,
-36844,
-19436,
-12726,
-13827,
-13375,
-13455,
-15006,
-14659,
-14741,
-15329,
-14417,
-20541,
-37636,
-50986,
-52455,
-51627,
-52454,
-51230,
-50458,
-51068,
-50283,
-50715,
-49718,
-37483,
-19967,
-12764,
-13814,
-13450,
-13431,
-14991,
-14738,
-14741,
-15383,
-14475,
-20159,
-36988,
-50735,
-52514,
-51578,
-52408,
-51273,
-50399,
-51003,
-50261,
-50600,
-49829,
-38081,
-20508,
-12844,
-13827,
-13576,
-13438,
-14985,
-14808,
-14743,
-15406,
-14500,
-19751,
-36280,
-50392,
-52499,
-51474,
-52314,
-51312,
-50369,
-50960,
-50276,
-50532,
-49956,
-38702,
-21084,
-12969,
-13863,
-13725,
-13469,
-14979,
-14904,
-14785,
-15491,
-14592,
-19424,
-35629,
-50058,
-52491,
-51368,
-52204,
-51352,
-50353,
-50923,
-50272,
-50444,
-50050,
-39268,
-21648,
-13085,
-13879,
-13857,
-13471,
-14916,
-14907,
-14769,
-15496,
-14624,
-19059,
-34941,
-49676,
-52447,
-51225,
-52056,
-51343,
-50327,
-50852,
-50235,
-50329,
-50114,
-39815,
-22223,
-13236,
-13935,
-14036,
-13552,
-14902,
-14966,
-14806,
-15585,
-14715,
-18783,
-34319,
-49336,
-52435,
-51127,
-51925,
-51360,
-50346,
-50828,
-50216,
-50222,
-50157,
-40307,
-22745,
-13340,
-13925,
-14171,
-13605,
-14873,
-14985,
-14834,
-15649,
-14812,
-18503,
-33708,
-48980,
-52408,
-51020,
-51764,
-51322,
-50312,
-50765,
-50141,
-50069,
-50163,
-40769,
-23264,
-13469,
-13937,
-14331,
-13707,
-14893,
-15035,
-14890,
-15769,
-14956,
-18299,
-33178,
-48700,
-52461,
-50998,
-51656,
-51320,
-50317,
-50749,
-50110,
-49939,
-50185,
-41221,
-23759,
-13560,
-13889,
-14408,
-13765,
-14862,
-15038,
-14886,
-15843,
-15055,
-18045,
-32600,
-48353,
-52450,
-50931,
-51502,
-51247,
-50281,
-50699,
-50055,
-49779,
-50181,
-41658,
-24255,
-13678,
-13861,
-14524,
-13873,
-14916,
-15077,
-14925,
-15946,
-15189,
-17833,
-32053,
-48042,
-52475,
-50927,
-51398,
-51203,
-50245,
-50682,
-50016,
-49642,
-50192,
-42103,
-24767,
-13799,
-13803,
-14572,
-13918,
-14912,
-15067,
-14894,
-15990,
-15268,
-17573,
-31451,
-47661,
-52444,
-50896,
-51288,
-51145,
-50203,
-50673,
-50008,
-49541,
-50229,
-42589,
-25338,
-14005,
-13834,
-14698,
-14067,
-15023,
-15178,
-14941,
-16080,
-15376,
-17319,
-30848,
-47241,
-52399,
-50854,
-51199,
-51077,
-50147,
-50636,
-50002,
-49442,
-50270,
-43082,
-25931,
-14233,
-13853,
-14781,
-14149,
-15076,
-15244,
-14942,
-16126,
-15459,
-17070,
-30232,
-46808,
-52305,
-50790,
-51066,
-50969,
-50014,
-50526,
-49938,
-49302,
-50264,
-43533,
-26511,
-14469,
-13888,
-14881,
-14256,
-15188,
-15394,
-15037,
-16247,
-15619,
-16895,
-29674,
-46398,
-52239,
-50774,
-50998,
-50947,
-49934,
-50463,
-49917,
-49199,
-50264,
-43960,
-27083,
-14691,
-13893,
-14918,
-14268,
-15202,
-15461,
-15060,
-16279,
-15717,
-16707,
-29118,
-45994,
-52192,
-50777,
-50972,
-50939,
-49856,
-50338,
-49839,
-49048,
-50200,
-44330,
-27619,
-14907,
-13891,
-14959,
-14276,
-15223,
-15573,
-15151,
-16369,
-15859,
-16568,
-28587,
-45584,
-52136,
-50795,
-50988,
-51026,
-49883,
-50306,
-49855,
-48970,
-50171,
-44676,
-28124,
-15065,
-13817,
-14901,
-14188,
-15132,
-15610,
-15191,
-16426,
-16004,
-16476,
-28127,
-45236,
-52155,
-50869,
-51045,
-51131,
-49896,
-50231,
-49795,
-48846,
-50075,
-44989,
-28610,
-15236,
-13733,
-14851,
-14077,
-14990,
-15586,
-15185,
-16438,
-16110,
-16382,
-27654,
-44897,
-52198,
-50988,
-51145,
-51316,
-50029,
-50262,
-49846,
-48807,
-50030,
-45304,
-29105,
-15359,
-13597,
-14755,
-13940,
-14826,
-15555,
-15204,
-16469,
-16260,
-16320,
-27204,
-44545,
-52243,
-51108,
-51212,
-51486,
-50128,
-50258,
-49838,
-48711,
-49920,
-45571,
-29581,
-15486,
-13453,
-14664,
-13817,
-14645,
-15500,
-15190,
-16497,
-16414,
-16308,
-26808,
-44251,
-52378,
-51304,
-51338,
-51675,
-50269,
-50261,
-49839,
-48594,
-49770,
-45789,
-30017,
-15569,
-13236,
-14529,
-13675,
-14459,
-15438,
-15193,
-16535,
-16603,
-16330,
-26411,
-43940,
-52498,
-51513,
-51450,
-51865,
-50418,
-50286,
-49839,
-48459,
-49553,
-45934,
-30404,
-15600,
-12961,
-14357,
-13548,
-14289,
-15391,
-15211,
-16596,
-16837,
-16413,
-26055,
-43647,
-52665,
-51766,
-51575,
-52018,
-50549,
-50299,
-49843,
-48328,
-49343,
-46092,
-30852,
-15674,
-12679,
-14161,
-13404,
-14102,
-15294,
-15171,
-16606,
-17047,
-16501,
-25691,
-43316,
-52818,
-52027,
-51679,
-52140,
-50652,
-50308,
-49861,
-48213,
-49119,
-46251,
-31325,
-15810,
-12434,
-14016,
-13351,
-14008,
-15270,
-15161,
-16600,
-17212,
-16538,
-25223,
-42854,
-52851,
-52227,
-51732,
-52221,
-50740,
-50346,
-49934,
-48189,
-48991,
-46520,
-31984,
-16150,
-12386,
-14032,
-13473,
-14067,
-15360,
-15223,
-16624,
-17384,
-16568,
-24698,
-42238,
-52697,
-52212,
-51529,
-51994,
-50520,
-50105,
-49790,
-47994,
-48725,
-46688,
-32608,
-16532,
-12364,
-14109,
-13688,
-14277,
-15615,
-15446,
-16787,
-17695,
-16743,
-24303,
-41690,
-52587,
-52263,
-51392,
-51800,
-50321,
-49864,
-49648,
-47804,
-48429,
-46782,
-33190,
-16908,
-12349,
-14171,
-13908,
-14499,
-15890,
-15666,
-16928,
-17964,
-16922,
-23925,
-41125,
-52453,
-52315,
-51257,
-51595,
-50091,
-49602,
-49496,
-47642,
-48143,
-46867,
-33770,
-17311,
-12335,
-14186,
-14086,
-14686,
-16126,
-15877,
-17024,
-18209,
-17101,
-23568,
-40544,
-52285,
-52366,
-51149,
-51428,
-49910,
-49394,
-49419,
-47578,
-47952,
-46994,
-34393,
-17786,
-12375,
-14228,
-14266,
-14859,
-16352,
-16046,
-17059,
-18342,
-17206,
-23168,
-39918,
-52074,
-52419,
-51075,
-51298,
-49759,
-49191,
-49332,
-47521,
-47764,
-47078,
-34984,
-18258,
-12420,
-14247,
-14417,
-15003,
-16548,
-16210,
-17072,
-18436,
-17315,
-22797,
-39312,
-51842,
-52486,
-51029,
-51226,
-49693,
-49084,
-49360,
-47631,
-47737,
-47279,
-35641,
-18813,
-12517,
-14278,
-14552,
-15119,
-16719,
-16372,
-17078,
-18504,
-17399,
-22455,
-38686,
-51590,
-52516,
-50981,
-51135,
-49620,
-48938,
-49326,
-47684,
-47674,
-47411,
-36247,
-19365,
-12639,
-14337,
-14715,
-15262,
-16912,
-16571,
-17132,
-18580,
-17536,
-22186,
-38161,
-51405,
-52652,
-51033,
-51154,
-49644,
-48874,
-49344,
-47795,
-47676,
-47574,
-36857,
-19929,
-12771,
-14367,
-14864,
-15377,
-17093,
-16795,
-17221,
-18692,
-17688,
-21970,
-37636,
-51211,
-52769,
-51087,
-51181,
-49704,
-48856,
-49392,
-47962,
-47742,
-47788,
-37509,
-20562,
-12974,
-14464,
-15059,
-15539,
-17288,
-17050,
-17340,
-18809,
-17861,
-21786,
-37169,
-51034,
-52920,
-51152,
-51200,
-49747,
-48812,
-49404,
-48124,
-47867,
-48086,
-38272,
-21346,
-13333,
-14698,
-15373,
-15785,
-17522,
-17308,
-17444,
-18853,
-17914,
-21467,
-36496,
-50603,
-52741,
-50820,
-50715,
-49203,
-48081,
-48620,
-47373,
-47016,
-47322,
-37942,
-21043,
-12661,
-13964,
-14849,
-15314,
-17143,
-17074,
-17156,
-18592,
-17730,
-20991,
-35763,
-50205,
-52767,
-50845,
-50757,
-49352,
-48207,
-48768,
-47627,
-47180,
-47567,
-38568,
-21639,
-12772,
-13895,
-14870,
-15276,
-17089,
-17077,
-17075,
-18488,
-17670,
-20598,
-35038,
-49759,
-52675,
-50699,
-50543,
-49232,
-48061,
-48666,
-47660,
-47194,
-47742,
-39207,
-22337,
-13026,
-13981,
-15078,
-15411,
-17162,
-17162,
-17041,
-18405,
-17588,
-20174,
-34258,
-49278,
-52603,
-50603,
-50412,
-49208,
-48042,
-48655,
-47740,
-47202,
-47859,
-39773,
-22948,
-13181,
-13962,
-15187,
-15495,
-17166,
-17203,
-16982,
-18321,
-17524,
-19751,
-33472,
-48758,
-52503,
-50478,
-50216,
-49141,
-47993,
-48656,
-47850,
-47278,
-48094,
-40489,
-23744,
-13486,
-14039,
-15360,
-15604,
-17172,
-17205,
-16906,
-18242,
-17491,
-19365,
-32710,
-48267,
-52465,
-50427,
-50098,
-49126,
-48012,
-48709,
-47962,
-47310,
-48237,
-41103,
-24432,
-13691,
-13995,
-15440,
-15653,
-17138,
-17172,
-16802,
-18151,
-17448,
-18985,
-31933,
-47772,
-52441,
-50435,
-50036,
-49182,
-48101,
-48819,
-48125,
-47362,
-48389,
-41730,
-25153,
-13914,
-13946,
-15485,
-15658,
-17039,
-17056,
-16621,
-17999,
-17392,
-18590,
-31157,
-47262,
-52443,
-50489,
-50026,
-49285,
-48244,
-49000,
-48352,
-47476,
-48574,
-42393,
-25918,
-14167,
-13889,
-15503,
-15645,
-16943,
-16964,
-16475,
-17892,
-17383,
-18259,
-30405,
-46755,
-52423,
-50529,
-49986,
-49332,
-48309,
-49062,
-48450,
-47449,
-48619,
-42930,
-26604,
-14378,
-13802,
-15499,
-15613,
-16821,
-16839,
-16286,
-17726,
-17327,
-17892,
-29619,
-46199,
-52399,
-50590,
-50009,
-49446,
-48441,
-49192,
-48624,
-47477,
-48684,
-43449,
-27280,
-14574,
-13675,
-15427,
-15528,
-16685,
-16773,
-16194,
-17688,
-17410,
-17681,
-28950,
-45696,
-52354,
-50615,
-49959,
-49499,
-48491,
-49244,
-48728,
-47491,
-48755,
-44019,
-28045,
-14902,
-13678,
-15481,
-15531,
-16592,
-16706,
-16081,
-17582,
-17430,
-17428,
-28264,
-45191,
-52366,
-50742,
-50069,
-49700,
-48680,
-49388,
-48903,
-47546,
-48803,
-44514,
-28750,
-15196,
-13646,
-15488,
-15488,
-16494,
-16685,
-16033,
-17533,
-17474,
-17215,
-27569,
-44603,
-52213,
-50695,
-49994,
-49762,
-48755,
-49450,
-49071,
-47676,
-48985,
-45168,
-29653,
-15699,
-13804,
-15630,
-15535,
-16424,
-16642,
-15930,
-17377,
-17418,
-16924,
-26823,
-43963,
-52067,
-50711,
-50021,
-49911,
-48887,
-49518,
-49211,
-47740,
-49034,
-45638,
-30417,
-16112,
-13905,
-15741,
-15581,
-16382,
-16689,
-15928,
-17297,
-17399,
-16660,
-26053,
-43218,
-51745,
-50525,
-49842,
-49906,
-48915,
-49530,
-49365,
-47893,
-49206,
-46243,
-31303,
-16641,
-14027,
-15818,
-15528,
-16200,
-16553,
-15758,
-17052,
-17268,
-16366,
-25293,
-42479,
-51475,
-50434,
-49772,
-49962,
-48954,
-49487,
-49419,
-47929,
-49193,
-46620,
-32033,
-17096,
-14151,
-15921,
-15562,
-16127,
-16583,
-15746,
-16921,
-17198,
-16137,
-24588,
-41746,
-51185,
-50345,
-49717,
-50085,
-49104,
-49579,
-49630,
-48153,
-49351,
-47145,
-32877,
-17644,
-14267,
-15966,
-15504,
-15948,
-16473,
-15633,
-16721,
-17138,
-16012,
-24005,
-41104,
-50982,
-50359,
-49732,
-50200,
-49197,
-49576,
-49741,
-48272,
-49370,
-47471,
-33598,
-18131,
-14362,
-15990,
-15457,
-15794,
-16426,
-15573,
-16547,
-17060,
-15882,
-23426,
-40424,
-50728,
-50352,
-49737,
-50341,
-49350,
-49637,
-49887,
-48405,
-49368,
-47747,
-34270,
-18587,
-14391,
-15957,
-15396,
-15654,
-16363,
-15513,
-16386,
-17049,
-15879,
-22990,
-39837,
-50583,
-50504,
-49900,
-50584,
-49577,
-49758,
-50098,
-48610,
-49372,
-47955,
-34863,
-19003,
-14354,
-15810,
-15220,
-15414,
-16237,
-15432,
-16203,
-16984,
-15832,
-22504,
-39135,
-50254,
-50429,
-49807,
-50568,
-49607,
-49731,
-50181,
-48742,
-49363,
-48189,
-35543,
-19552,
-14439,
-15791,
-15202,
-15298,
-16153,
-15324,
-15973,
-16884,
-15818,
-22091,
-38526,
-50063,
-50603,
-49982,
-50774,
-49795,
-49784,
-50278,
-48825,
-49223,
-48187,
-35997,
-19928,
-14415,
-15658,
-15110,
-15127,
-16049,
-15248,
-15759,
-16738,
-15701,
-21535,
-37677,
-49554,
-50399,
-49796,
-50721,
-49926,
-49997,
-50707,
-49389,
-49690,
-48820,
-37029,
-20781,
-14662,
-15649,
-15011,
-14836,
-15652,
-14730,
-14979,
-15890,
-14739,
-19953,
-35553,
-47545,
-48544,
-47775,
-48617,
-47816,
-47821,
-48664,
-47526,
-47817,
-47287,
-36206,
-20236,
-13996,
-15140,
-14785,
-14709,
-15700,
-14931,
-15159,
-16197,
-15195,
-20106,
-35476,
-47811,
-49128,
-48265,
-49055,
-48244,
-48080,
-48872,
-47702,
-47820,
-47428,
-36845,
-20897,
-14258,
-15306,
-15053,
-14917,
-15915,
-15204,
-15353,
-16503,
-15623,
-20198,
-35240,
-47863,
-49510,
-48597,
-49378,
-48602,
-48338,
-49123,
-48004,
-47938,
-47619,
-37444,
-21520,
-14498,
-15459,
-15299,
-15076,
-16097,
-15465,
-15532,
-16678,
-15846,
-20062,
-34794,
-47711,
-49676,
-48718,
-49534,
-48897,
-48592,
-49388,
-48317,
-48139,
-47935,
-38215,
-22291,
-14833,
-15654,
-15558,
-15230,
-16197,
-15625,
-15605,
-16814,
-16088,
-19998,
-34404,
-47573,
-49863,
-48856,
-49667,
-49112,
-48710,
-49494,
-48503,
-48207,
-48067,
-38732,
-22830,
-14979,
-15686,
-15648,
-15188,
-16133,
-15659,
-15588,
-16778,
-16113,
-19704,
-33841,
-47315,
-49959,
-48934,
-49816,
-49454,
-49050,
-49838,
-48918,
-48536,
-48499,
-39584,
-23683,
-15376,
-15908,
-15910,
-15293,
-16137,
-15689,
-15497,
-16679,
-16077,
-19361,
-33157,
-46878,
-49859,
-48812,
-49722,
-49488,
-49022,
-49811,
-49008,
-48569,
-48612,
-40093,
-24233,
-15530,
-15941,
-16000,
-15237,
-16035,
-15701,
-15467,
-16626,
-16069,
-19047,
-32544,
-46539,
-49863,
-48760,
-49706,
-49655,
-49182,
-49973,
-49269,
-48773,
-48934,
-40853,
-25025,
-15866,
-16073,
-16173,
-15248,
-15947,
-15639,
-15309,
-16449,
-16000,
-18715,
-31901,
-46162,
-49866,
-48762,
-49722,
-49784,
-49217,
-49968,
-49359,
-48800,
-49009,
-41313,
-25525,
-15968,
-16035,
-16202,
-15156,
-15795,
-15606,
-15220,
-16323,
-15905,
-18321,
-31198,
-45752,
-49854,
-48759,
-49754,
-50018,
-49466,
-50219,
-49705,
-49060,
-49340,
-42042,
-26289,
-16239,
-16053,
-16267,
-15089,
-15658,
-15504,
-15032,
-16111,
-15803,
-17977,
-30525,
-45337,
-49851,
-48792,
-49786,
-50159,
-49529,
-50241,
-49843,
-49139,
-49472,
-42552,
-26860,
-16380,
-16001,
-16280,
-15003,
-15509,
-15466,
-14957,
-16010,
-15764,
-17666,
-29901,
-45005,
-49982,
-48946,
-49946,
-50470,
-49845,
-50547,
-50212,
-49403,
-49759,
-43230,
-27596,
-16620,
-15952,
-16296,
-14952,
-15401,
-15406,
-14795,
-15823,
-15688,
-17379,
-29280,
-44643,
-50086,
-49122,
-50102,
-50706,
-49993,
-50636,
-50370,
-49495,
-49850,
-43683,
-28114,
-16677,
-15760,
-16155,
-14746,
-15123,
-15234,
-14609,
-15653,
-15607,
-17055,
-28625,
-44233,
-50138,
-49190,
-50080,
-50778,
-50070,
-50710,
-50527,
-49570,
-49963,
-44203,
-28739,
-16809,
-15563,
-16026,
-14620,
-14984,
-15167,
-14519,
-15566,
-15680,
-16944,
-28191,
-44019,
-50421,
-49568,
-50409,
-51155,
-50365,
-50916,
-50756,
-49687,
-50042,
-44597,
-29213,
-16838,
-15318,
-15881,
-14491,
-14813,
-15096,
-14436,
-15479,
-15656,
-16677,
-27547,
-43605,
-50490,
-49728,
-50457,
-51275,
-50493,
-51045,
-50951,
-49800,
-50167,
-45114,
-29877,
-17034,
-15136,
-15743,
-14373,
-14680,
-15007,
-14313,
-15340,
-15646,
-16491,
-26996,
-43188,
-50520,
-49825,
-50434,
-51228,
-50376,
-50842,
-50807,
-49610,
-50012,
-45329,
-30274,
-17064,
-14903,
-15644,
-14357,
-14660,
-15085,
-14425,
-15464,
-15853,
-16468,
-26592,
-42929,
-50727,
-50095,
-50539,
-51314,
-50442,
-50860,
-50852,
-49568,
-49965,
-45678,
-30832,
-17238,
-14735,
-15547,
-14348,
-14643,
-15135,
-14431,
-15456,
-15941,
-16407,
-26161,
-42606,
-50850,
-50319,
-50630,
-51371,
-50402,
-50715,
-50715,
-49380,
-49779,
-45832,
-31197,
-17257,
-14482,
-15429,
-14341,
-14655,
-15242,
-14581,
-15605,
-16151,
-16390,
-25709,
-42223,
-50907,
-50473,
-50620,
-51360,
-50395,
-50704,
-50772,
-49377,
-49755,
-46169,
-31763,
-17476,
-14318,
-15320,
-14328,
-14669,
-15332,
-14657,
-15640,
-16285,
-16389,
-25329,
-41880,
-50989,
-50675,
-50692,
-51402,
-50365,
-50568,
-50668,
-49249,
-49618,
-46362,
-32203,
-17593,
-14128,
-15216,
-14314,
-14616,
-15341,
-14660,
-15608,
-16316,
-16234,
-24753,
-41331,
-50900,
-50724,
-50603,
-51306,
-50290,
-50494,
-50710,
-49282,
-49632,
-46730,
-32873,
-17963,
-14107,
-15208,
-14378,
-14661,
-15435,
-14708,
-15548,
-16329,
-16140,
-24266,
-40837,
-50823,
-50807,
-50584,
-51286,
-50243,
-50352,
-50637,
-49224,
-49556,
-46975,
-33420,
-18239,
-14058,
-15238,
-14488,
-14723,
-15529,
-14787,
-15544,
-16369,
-16026,
-23693,
-40217,
-50635,
-50785,
-50425,
-51140,
-50133,
-50264,
-50686,
-49300,
-49578,
-47303,
-34084,
-18631,
-14020,
-15179,
-14485,
-14670,
-15535,
-14740,
-15379,
-16270,
-15877,
-23145,
-39611,
-50451,
-50807,
-50363,
-51122,
-50118,
-50161,
-50665,
-49319,
-49537,
-47566,
-34689,
-19011,
-14034,
-15245,
-14629,
-14731,
-15606,
-14794,
-15300,
-16250,
-15757,
-22571,
-38936,
-50242,
-50816,
-50263,
-51025,
-50064,
-50093,
-50750,
-49479,
-49616,
-47940,
-35458,
-19561,
-14107,
-15263,
-14674,
-14721,
-15667,
-14853,
-15216,
-16241,
-15741,
-22155,
-38380,
-50096,
-50903,
-50258,
-51083,
-50140,
-50081,
-50824,
-49614,
-49665,
-48221,
-36117,
-19990,
-14123,
-15290,
-14793,
-14745,
-15715,
-14890,
-15116,
-16179,
-15631,
-21577,
-37653,
-49827,
-50933,
-50195,
-51045,
-50169,
-50073,
-50951,
-49810,
-49737,
-48516,
-36842,
-20544,
-14189,
-15262,
-14806,
-14655,
-15665,
-14836,
-14895,
-16005,
-15510,
-21088,
-36996,
-49605,
-50991,
-50179,
-51074,
-50246,
-50040,
-50970,
-49920,
-49750,
-48742,
-37474,
-21021,
-14207,
-15272,
-14929,
-14680,
-15698,
-14904,
-14831,
-15979,
-15480,
-20618,
-36289,
-49340,
-51063,
-50149,
-51049,
-50302,
-50058,
-51096,
-50153,
-49853,
-49014,
-38186,
-21608,
-14264,
-15190,
-14901,
-14551,
-15598,
-14865,
-14652,
-15848,
-15422,
-20227,
-35664,
-49114,
-51158,
-50153,
-51062,
-50389,
-50029,
-51069,
-50207,
-49828,
-49153,
-38772,
-22093,
-14267,
-15136,
-14988,
-14548,
-15564,
-14883,
-14566,
-15767,
-15363,
-19741,
-34889,
-48757,
-51211,
-50147,
-51033,
-50474,
-50074,
-51165,
-50410,
-49901,
-49367,
-39435,
-22737,
-14394,
-15111,
-15052,
-14541,
-15551,
-14958,
-14529,
-15720,
-15377,
-19439,
-34293,
-48506,
-51326,
-50176,
-51037,
-50564,
-50060,
-51087,
-50396,
-49827,
-49421,
-39941,
-23211,
-14387,
-14987,
-15105,
-14522,
-15484,
-14973,
-14499,
-15695,
-15388,
-19065,
-33576,
-48122,
-51381,
-50173,
-50961,
-50605,
-50074,
-51120,
-50526,
-49885,
-49584,
-40558,
-23870,
-14545,
-14925,
-15130,
-14483,
-15417,
-15010,
-14503,
-15666,
-15439,
-18835,
-33033,
-47862,
-51507,
-50242,
-50975,
-50719,
-50112,
-51055,
-50504,
-49830,
-49648,
-41041,
-24390,
-14597,
-14814,
-15207,
-14520,
-15384,
-15054,
-14532,
-15677,
-15451,
-18491,
-32310,
-47402,
-51511,
-50237,
-50882,
-50739,
-50123,
-51051,
-50576,
-49865,
-49761,
-41585,
-25030,
-14779,
-14729,
-15205,
-14465,
-15279,
-15049,
-14521,
-15633,
-15453,
-18260,
-31759,
-47075,
-51587,
-50294,
-50854,
-50799,
-50136,
-50934,
-50502,
-49787,
-49822,
-42060,
-25601,
-14931,
-14672,
-15307,
-14562,
-15277,
-15113,
-14591,
-15671,
-15469,
-17944,
-31034,
-46549,
-51516,
-50277,
-50745,
-50783,
-50140,
-50917,
-50549,
-49815,
-49917,
-42533,
-26232,
-15149,
-14619,
-15312,
-14573,
-15240,
-15193,
-14674,
-15699,
-15501,
-17745,
-30512,
-46184,
-51540,
-50322,
-50702,
-50813,
-50129,
-50785,
-50430,
-49730,
-49943,
-42961,
-26779,
-15323,
-14536,
-15353,
-14617,
-15208,
-15216,
-14730,
-15729,
-15518,
-17483,
-29859,
-45679,
-51471,
-50343,
-50623,
-50799,
-50126,
-50755,
-50472,
-49771,
-50073,
-43459,
-27465,
-15653,
-14551,
-15384,
-14636,
-15183,
-15272,
-14791,
-15717,
-15500,
-17255,
-29323,
-45259,
-51436,
-50373,
-50590,
-50820,
-50117,
-50612,
-50335,
-49655,
-50093,
-43855,
-28025,
-15865,
-14512,
-15441,
-14736,
-15218,
-15360,
-14894,
-15800,
-15564,
-17023,
-28683,
-44693,
-51284,
-50348,
-50490,
-50776,
-50077,
-50570,
-50355,
-49691,
-50184,
-44300,
-28654,
-16180,
-14496,
-15428,
-14712,
-15183,
-15409,
-14961,
-15808,
-15576,
-16837,
-28168,
-44259,
-51229,
-50384,
-50483,
-50806,
-50067,
-50443,
-50244,
-49593,
-50195,
-44689,
-29232,
-16441,
-14499,
-15484,
-14802,
-15198,
-15456,
-15001,
-15821,
-15580,
-16583,
-27490,
-43667,
-51041,
-50366,
-50393,
-50752,
-50012,
-50391,
-50287,
-49646,
-50307,
-45158,
-29932,
-16851,
-14578,
-15529,
-14822,
-15193,
-15533,
-15073,
-15816,
-15581,
-16364,
-26933,
-43157,
-50908,
-50334,
-50331,
-50743,
-49979,
-50274,
-50182,
-49557,
-50296,
-45545,
-30532,
-17157,
-14602,
-15598,
-14922,
-15240,
-15627,
-15140,
-15853,
-15610,
-16136,
-26261,
-42507,
-50669,
-50248,
-50197,
-50650,
-49901,
-50198,
-50225,
-49602,
-50397,
-46027,
-31291,
-17639,
-14736,
-15693,
-14986,
-15291,
-15735,
-15235,
-15856,
-15643,
-15987,
-25727,
-42006,
-50518,
-50221,
-50126,
-50646,
-49862,
-50077,
-50123,
-49504,
-50362,
-46395,
-31905,
-17961,
-14757,
-15764,
-15091,
-15344,
-15821,
-15289,
-15863,
-15691,
-15787,
-25059,
-41323,
-50253,
-50124,
-49991,
-50554,
-49773,
-49984,
-50151,
-49534,
-50415,
-46823,
-32627,
-18403,
-14847,
-15823,
-15127,
-15330,
-15877,
-15305,
-15802,
-15668,
-15584,
-24444,
-40718,
-50036,
-50054,
-49876,
-50512,
-49714,
-49847,
-50072,
-49444,
-50376,
-47174,
-33270,
-18759,
-14893,
-15927,
-15261,
-15406,
-15981,
-15392,
-15842,
-15775,
-15458,
-23825,
-40066,
-49820,
-50006,
-49765,
-50425,
-49637,
-49767,
-50122,
-49503,
-50420,
-47613,
-34041,
-19280,
-15050,
-16037,
-15342,
-15417,
-16073,
-15453,
-15823,
-15794,
-15334,
-23273,
-39520,
-49669,
-50011,
-49709,
-50439,
-49642,
-49682,
-50077,
-49437,
-50353,
-47930,
-34686,
-19649,
-15083,
-16121,
-15471,
-15494,
-16197,
-15567,
-15865,
-15889,
-15219,
-22642,
-38820,
-49405,
-49919,
-49554,
-50333,
-49566,
-49594,
-50092,
-49461,
-50333,
-48291,
-35416,
-20130,
-15175,
-16180,
-15533,
-15510,
-16303,
-15670,
-15882,
-15982,
-15203,
-22206,
-38325,
-49297,
-49971,
-49521,
-50369,
-49592,
-49500,
-50035,
-49389,
-50258,
-48572,
-36053,
-20490,
-15169,
-16204,
-15618,
-15521,
-16351,
-15724,
-15877,
-16071,
-15150,
-21654,
-37665,
-49064,
-49952,
-49425,
-50306,
-49543,
-49411,
-50038,
-49398,
-50211,
-48862,
-36734,
-20977,
-15248,
-16267,
-15709,
-15547,
-16422,
-15794,
-15850,
-16119,
-15112,
-21186,
-37088,
-48899,
-50000,
-49402,
-50323,
-49571,
-49328,
-49973,
-49329,
-50098,
-49060,
-37308,
-21329,
-15232,
-16265,
-15796,
-15550,
-16451,
-15854,
-15885,
-16228,
-15099,
-20663,
-36404,
-48612,
-49951,
-49246,
-50160,
-49456,
-49217,
-49952,
-49335,
-50044,
-49302,
-37979,
-21862,
-15347,
-16321,
-15895,
-15606,
-16545,
-15973,
-15934,
-16325,
-15131,
-20294,
-35871,
-48455,
-50012,
-49224,
-50122,
-49448,
-49118,
-49839,
-49204,
-49850,
-49388,
-38458,
-22203,
-15307,
-16251,
-15948,
-15604,
-16546,
-15994,
-15924,
-16371,
-15094,
-19812,
-35207,
-48153,
-50001,
-49111,
-49988,
-49381,
-49068,
-49843,
-49210,
-49785,
-49596,
-39087,
-22753,
-15417,
-16259,
-16036,
-15674,
-16616,
-16065,
-15921,
-16416,
-15104,
-19456,
-34630,
-47880,
-49970,
-49018,
-49863,
-49300,
-48927,
-49692,
-49052,
-49614,
-49663,
-39548,
-23107,
-15391,
-16177,
-16095,
-15717,
-16616,
-16085,
-15936,
-16508,
-15140,
-19085,
-34020,
-47592,
-49984,
-48964,
-49722,
-49204,
-48849,
-49654,
-49033,
-49524,
-49812,
-40096,
-23628,
-15514,
-16175,
-16200,
-15832,
-16714,
-16174,
-15975,
-16597,
-15207,
-18811,
-33516,
-47356,
-50057,
-48996,
-49700,
-49193,
-48800,
-49594,
-48959,
-49407,
-49870,
-40506,
-23970,
-15484,
-16046,
-16194,
-15808,
-16651,
-16119,
-15938,
-16636,
-15206,
-18433,
-32915,
-47062,
-50115,
-49003,
-49608,
-49135,
-48785,
-49653,
-49023,
-49390,
-50042,
-41087,
-24558,
-15693,
-16072,
-16303,
-15933,
-16773,
-16225,
-15975,
-16680,
-15230,
-18128,
-32366,
-46790,
-50138,
-49052,
-49600,
-49174,
-48810,
-49670,
-49036,
-49335,
-50151,
-41551,
-24989,
-15731,
-15986,
-16311,
-15957,
-16782,
-16258,
-15986,
-16759,
-15276,
-17820,
-31805,
-46481,
-50166,
-49010,
-49478,
-49049,
-48712,
-49632,
-49030,
-49261,
-50282,
-42108,
-25587,
-15920,
-15972,
-16344,
-16011,
-16845,
-16310,
-15941,
-16723,
-15272,
-17511,
-31240,
-46160,
-50163,
-49050,
-49499,
-49094,
-48684,
-49576,
-48994,
-49148,
-50334,
-42523,
-25988,
-15944,
-15860,
-16346,
-16016,
-16855,
-16351,
-15932,
-16756,
-15298,
-17147,
-30562,
-45732,
-50096,
-48997,
-49386,
-49008,
-48564,
-49535,
-49026,
-49133,
-50475,
-43144,
-26654,
-16226,
-15927,
-16456,
-16118,
-17003,
-16535,
-16024,
-16849,
-15440,
-16964,
-30048,
-45439,
-50154,
-49088,
-49478,
-49101,
-48533,
-49487,
-49050,
-49093,
-50563,
-43632,
-27194,
-16367,
-15933,
-16521,
-16135,
-17041,
-16655,
-16088,
-16917,
-15512,
-16631,
-29339,
-44971,
-50073,
-49006,
-49354,
-49000,
-48364,
-49368,
-49052,
-49013,
-50627,
-44208,
-27922,
-16705,
-16036,
-16631,
-16188,
-17148,
-16875,
-16176,
-16970,
-15618,
-16422,
-28731,
-44547,
-49981,
-48927,
-49279,
-48967,
-48174,
-49125,
-48916,
-48825,
-50547,
-44623,
-28466,
-16884,
-16054,
-16728,
-16225,
-17232,
-17107,
-16352,
-17107,
-15800,
-16235,
-28088,
-44098,
-49909,
-48860,
-49180,
-48929,
-48012,
-48936,
-48840,
-48666,
-50465,
-45089,
-29154,
-17182,
-16110,
-16812,
-16257,
-17334,
-17381,
-16525,
-17217,
-16030,
-16196,
-27602,
-43725,
-49901,
-48880,
-49237,
-49064,
-47963,
-48760,
-48781,
-48559,
-50423,
-45510,
-29756,
-17381,
-16107,
-16878,
-16231,
-17301,
-17517,
-16629,
-17283,
-16196,
-16027,
-26922,
-43178,
-49774,
-48804,
-49149,
-49065,
-47842,
-48579,
-48720,
-48439,
-50308,
-45924,
-30439,
-17723,
-16184,
-16998,
-16278,
-17362,
-17770,
-16819,
-17395,
-16423,
-16027,
-26423,
-42756,
-49741,
-48837,
-49192,
-49208,
-47821,
-48393,
-48649,
-48316,
-50182,
-46207,
-30957,
-17862,
-16077,
-16944,
-16117,
-17152,
-17749,
-16830,
-17383,
-16523,
-15877,
-25764,
-42173,
-49603,
-48765,
-49072,
-49195,
-47743,
-48254,
-48621,
-48231,
-50043,
-46552,
-31649,
-18261,
-16162,
-17035,
-16120,
-17113,
-17851,
-16887,
-17326,
-16576,
-15773,
-25185,
-41621,
-49448,
-48732,
-49050,
-49329,
-47811,
-48173,
-48609,
-48172,
-49947,
-46840,
-32269,
-18583,
-16223,
-17151,
-16186,
-17087,
-17958,
-17023,
-17395,
-16743,
-15741,
-24652,
-41051,
-49287,
-48634,
-48886,
-49253,
-47744,
-48022,
-48553,
-48073,
-49797,
-47096,
-32903,
-18953,
-16234,
-17176,
-16189,
-17051,
-18058,
-17123,
-17430,
-16911,
-15839,
-24306,
-40624,
-49204,
-48669,
-48877,
-49344,
-47769,
-47881,
-48428,
-47922,
-49579,
-47194,
-33307,
-19113,
-16112,
-17129,
-16151,
-16913,
-17987,
-17099,
-17368,
-16962,
-15767,
-23785,
-40064,
-49070,
-48709,
-48840,
-49374,
-47814,
-47855,
-48446,
-47898,
-49448,
-47364,
-33828,
-19411,
-16065,
-17092,
-16150,
-16863,
-18034,
-17179,
-17406,
-17121,
-15867,
-23472,
-39623,
-48969,
-48744,
-48803,
-49404,
-47861,
-47824,
-48477,
-47938,
-49419,
-47584,
-34326,
-19685,
-15997,
-17051,
-16129,
-16732,
-17934,
-17130,
-17351,
-17156,
-15816,
-23010,
-39099,
-48848,
-48803,
-48726,
-49321,
-47812,
-47734,
-48432,
-47852,
-49247,
-47714,
-34873,
-20109,
-16097,
-17156,
-16308,
-16857,
-18084,
-17250,
-17362,
-17226,
-15834,
-22655,
-38635,
-48717,
-48850,
-48672,
-49303,
-47818,
-47685,
-48407,
-47832,
-49160,
-47870,
-35341,
-20384,
-16038,
-17139,
-16408,
-16922,
-18198,
-17424,
-17515,
-17451,
-15962,
-22346,
-38175,
-48590,
-48855,
-48509,
-49099,
-47674,
-47526,
-48310,
-47721,
-48989,
-47996,
-35885,
-20788,
-16084,
-17204,
-16599,
-17114,
-18417,
-17622,
-17630,
-17658,
-16161,
-22195,
-37884,
-48644,
-49086,
-48624,
-49176,
-47720,
-47439,
-48210,
-47616,
-48815,
-48067,
-36284,
-21021,
-15985,
-17168,
-16711,
-17184,
-18514,
-17758,
-17740,
-17839,
-16256,
-21839,
-37364,
-48491,
-49132,
-48512,
-49023,
-47602,
-47302,
-48140,
-47548,
-48655,
-48160,
-36762,
-21342,
-15893,
-17065,
-16717,
-17174,
-18541,
-17801,
-17708,
-17890,
-16306,
-21491,
-36860,
-48349,
-49208,
-48478,
-48948,
-47521,
-47097,
-47964,
-47406,
-48464,
-48226,
-37235,
-21681,
-15891,
-17095,
-16858,
-17223,
-18597,
-17898,
-17728,
-17959,
-16270,
-20994,
-36181,
-48092,
-49207,
-48338,
-48788,
-47427,
-46982,
-47922,
-47394,
-48325,
-48361,
-37821,
-22166,
-15938,
-17097,
-16955,
-17291,
-18734,
-18076,
-17793,
-18055,
-16355,
-20643,
-35597,
-47844,
-49179,
-48180,
-48648,
-47311,
-46755,
-47717,
-47250,
-48134,
-48439,
-38371,
-22597,
-15963,
-17110,
-17069,
-17303,
-18771,
-18179,
-17818,
-18134,
-16384,
-20201,
-34905,
-47560,
-49181,
-48082,
-48574,
-47344,
-46731,
-47737,
-47299,
-48055,
-48605,
-39033,
-23180,
-16069,
-17148,
-17202,
-17367,
-18901,
-18364,
-17898,
-18251,
-16533,
-19896,
-34291,
-47253,
-49151,
-47955,
-48483,
-47304,
-46532,
-47531,
-47165,
-47869,
-48658,
-39604,
-23701,
-16171,
-17207,
-17345,
-17365,
-18888,
-18459,
-17943,
-18377,
-16697,
-19623,
-33710,
-47069,
-49304,
-48037,
-48590,
-47523,
-46656,
-47641,
-47304,
-47840,
-48780,
-40221,
-24279,
-16263,
-17197,
-17440,
-17370,
-18938,
-18637,
-18072,
-18574,
-16964,
-19458,
-33145,
-46801,
-49368,
-48034,
-48611,
-47634,
-46626,
-47577,
-47299,
-47699,
-48751,
-40668,
-24737,
-16265,
-17083,
-17363,
-17119,
-18658,
-18520,
-17945,
-18526,
-17015,
-19164,
-32539,
-46557,
-49508,
-48088,
-48673,
-47827,
-46728,
-47610,
-47334,
-47559,
-48709,
-41139,
-25250,
-16304,
-16946,
-17338,
-16996,
-18552,
-18557,
-17966,
-18610,
-17234,
-19034,
-32001,
-46270,
-49602,
-48162,
-48763,
-48050,
-46841,
-47628,
-47370,
-47429,
-48604,
-41485,
-25679,
-16288,
-16764,
-17219,
-16744,
-18237,
-18391,
-17795,
-18473,
-17217,
-18723,
-31338,
-45878,
-49623,
-48154,
-48755,
-48205,
-46940,
-47620,
-47367,
-47283,
-48532,
-41902,
-26256,
-16437,
-16724,
-17307,
-16773,
-18217,
-18492,
-17888,
-18590,
-17464,
-18690,
-30854,
-45528,
-49638,
-48141,
-48693,
-48245,
-46881,
-47425,
-47193,
-47022,
-48311,
-42122,
-26662,
-16475,
-16594,
-17310,
-16712,
-18063,
-18451,
-17892,
-18623,
-17610,
-18576,
-30316,
-45143,
-49672,
-48181,
-48645,
-48309,
-46920,
-47391,
-47193,
-46938,
-48235,
-42474,
-27224,
-16684,
-16550,
-17379,
-16762,
-18074,
-18609,
-18094,
-18833,
-17892,
-18617,
-29891,
-44776,
-49638,
-48144,
-48515,
-48299,
-46902,
-47278,
-47130,
-46876,
-48272,
-42970,
-27993,
-17140,
-16781,
-17692,
-16969,
-18046,
-18510,
-17915,
-18555,
-17627,
-18102,
-28999,
-44051,
-49465,
-48137,
-48505,
-48457,
-47183,
-47623,
-47681,
-47597,
-49266,
-44675,
-30304,
-19471,
-19087,
-20256,
-19658,
-20735,
-21272,
-20613,
-21038,
-19912,
-19912,
-30064,
-44777,
-50159,
-48549,
-48521,
-48337,
-46894,
-47097,
-47067,
-46899,
-48556,
-44274,
-30085,
-18919,
-18254,
-19572,
-19098,
-20226,
-20979,
-20525,
-21061,
-20048,
-19840,
-29537,
-44207,
-49922,
-48334,
-48136,
-47947,
-46489,
-46590,
-46546,
-46320,
-48002,
-44127,
-30260,
-18874,
-17940,
-19345,
-18972,
-20076,
-20892,
-20426,
-20890,
-19891,
-19478,
-28736,
-43364,
-49430,
-47993,
-47752,
-47621,
-46145,
-46158,
-46133,
-45939,
-47660,
-44116,
-30506,
-18867,
-17664,
-19111,
-18745,
-19789,
-20675,
-20297,
-20780,
-19796,
-19164,
-28010,
-42645,
-49092,
-47768,
-47427,
-47339,
-45926,
-45916,
-45923,
-45702,
-47512,
-44402,
-31136,
-19260,
-17712,
-19159,
-18842,
-19840,
-20724,
-20304,
-20740,
-19821,
-19000,
-27403,
-41967,
-48775,
-47667,
-47327,
-47278,
-45832,
-45760,
-45825,
-45615,
-47430,
-44622,
-31589,
-19478,
-17635,
-19028,
-18668,
-19578,
-20569,
-20221,
-20693,
-19788,
-18735,
-26731,
-41313,
-48504,
-47518,
-47114,
-47127,
-45746,
-45671,
-45742,
-45440,
-47287,
-44902,
-32191,
-19806,
-17551,
-18880,
-18514,
-19402,
-20397,
-19996,
-20453,
-19689,
-18514,
-26113,
-40675,
-48281,
-47553,
-47223,
-47302,
-45872,
-45725,
-45825,
-45474,
-47278,
-45218,
-32756,
-20121,
-17561,
-18830,
-18401,
-19199,
-20251,
-19865,
-20312,
-19610,
-18212,
-25369,
-39942,
-47948,
-47388,
-47042,
-47216,
-45836,
-45677,
-45830,
-45379,
-47172,
-45510,
-33388,
-20474,
-17547,
-18776,
-18340,
-19111,
-20235,
-19826,
-20278,
-19738,
-18234,
-24940,
-39470,
-47857,
-47475,
-47126,
-47364,
-45932,
-45675,
-45861,
-45330,
-47052,
-45746,
-33932,
-20769,
-17514,
-18739,
-18264,
-18959,
-20154,
-19771,
-20224,
-19835,
-18193,
-24432,
-38909,
-47709,
-47470,
-47076,
-47385,
-45948,
-45625,
-45858,
-45260,
-46898,
-45963,
-34525,
-21109,
-17514,
-18744,
-18263,
-18887,
-20172,
-19819,
-20265,
-20048,
-18318,
-24086,
-38487,
-47675,
-47578,
-47090,
-47450,
-45982,
-45530,
-45779,
-45091,
-46601,
-45979,
-34917,
-21265,
-17335,
-18602,
-18151,
-18691,
-20090,
-19794,
-20221,
-20141,
-18342,
-23639,
-37948,
-47548,
-47612,
-47031,
-47490,
-46061,
-45501,
-45765,
-45018,
-46404,
-46098,
-35438,
-21576,
-17272,
-18606,
-18207,
-18666,
-20126,
-19911,
-20286,
-20372,
-18545,
-23400,
-37565,
-47579,
-47830,
-47126,
-47632,
-46204,
-45479,
-45737,
-44958,
-46192,
-46109,
-35837,
-21788,
-17113,
-18476,
-18121,
-18439,
-19984,
-19875,
-20219,
-20381,
-18527,
-22958,
-36980,
-47398,
-47837,
-46988,
-47587,
-46289,
-45489,
-45737,
-44950,
-46054,
-46221,
-36351,
-22109,
-16965,
-18330,
-18076,
-18295,
-19856,
-19824,
-20126,
-20408,
-18610,
-22640,
-36441,
-47242,
-47947,
-47013,
-47657,
-46435,
-45507,
-45765,
-45032,
-46042,
-46375,
-36895,
-22555,
-17044,
-18402,
-18215,
-18258,
-19809,
-19906,
-20164,
-20464,
-18650,
-22310,
-35940,
-47118,
-48069,
-46980,
-47638,
-46568,
-45571,
-45776,
-45038,
-45932,
-46449,
-37371,
-22935,
-16953,
-18253,
-18189,
-18149,
-19673,
-19838,
-20057,
-20423,
-18687,
-22028,
-35412,
-46916,
-48183,
-47039,
-47709,
-46737,
-45661,
-45830,
-45150,
-45959,
-46575,
-37836,
-23345,
-16958,
-18178,
-18186,
-18014,
-19486,
-19758,
-19976,
-20370,
-18657,
-21707,
-34883,
-46707,
-48284,
-47049,
-47711,
-46875,
-45783,
-45922,
-45257,
-45998,
-46737,
-38366,
-23824,
-17020,
-18085,
-18181,
-17898,
-19300,
-19600,
-19799,
-20209,
-18530,
-21304,
-34237,
-46352,
-48248,
-46990,
-47638,
-46912,
-45804,
-45906,
-45244,
-45900,
-46749,
-38722,
-24191,
-17014,
-17967,
-18164,
-17859,
-19219,
-19579,
-19753,
-20221,
-18578,
-21088,
-33764,
-46107,
-48316,
-47061,
-47694,
-47057,
-45939,
-46042,
-45407,
-46004,
-46945,
-39235,
-24697,
-17162,
-17969,
-18216,
-17830,
-19137,
-19535,
-19726,
-20247,
-18628,
-20860,
-33316,
-45908,
-48421,
-47134,
-47718,
-47143,
-46026,
-46097,
-45417,
-45889,
-46944,
-39611,
-25095,
-17218,
-17859,
-18193,
-17804,
-19084,
-19481,
-19635,
-20228,
-18687,
-20644,
-32841,
-45620,
-48448,
-47189,
-47769,
-47245,
-46102,
-46201,
-45535,
-45922,
-47063,
-40056,
-25563,
-17355,
-17862,
-18224,
-17780,
-19032,
-19466,
-19607,
-20274,
-18774,
-20451,
-32389,
-45402,
-48514,
-47260,
-47819,
-47360,
-46201,
-46282,
-45579,
-45805,
-47050,
-40413,
-25966,
-17407,
-17783,
-18206,
-17735,
-18949,
-19391,
-19484,
-20259,
-18838,
-20218,
-31854,
-45073,
-48503,
-47242,
-47774,
-47357,
-46186,
-46325,
-45660,
-45757,
-47099,
-40874,
-26481,
-17583,
-17751,
-18195,
-17641,
-18849,
-19297,
-19326,
-20157,
-18846,
-19974,
-31333,
-44754,
-48475,
-47222,
-47782,
-47459,
-46264,
-46394,
-45743,
-45709,
-47127,
-41252,
-26882,
-17612,
-17696,
-18249,
-17654,
-18791,
-19249,
-19233,
-20132,
-18883,
-19655,
-30663,
-44329,
-48420,
-47173,
-47690,
-47457,
-46305,
-46516,
-45918,
-45722,
-47184,
-41758,
-27530,
-17899,
-17750,
-18320,
-17650,
-18762,
-19247,
-19128,
-20051,
-18949,
-19522,
-30202,
-44004,
-48373,
-47098,
-47614,
-47485,
-46276,
-46437,
-45882,
-45617,
-47154,
-42117,
-27962,
-17980,
-17708,
-18410,
-17677,
-18669,
-19183,
-19056,
-20047,
-19029,
-19293,
-29580,
-43587,
-48363,
-47112,
-47546,
-47518,
-46348,
-46544,
-46030,
-45608,
-47144,
-42531,
-28588,
-18264,
-17757,
-18502,
-17733,
-18665,
-19230,
-19035,
-20027,
-19143,
-19238,
-29172,
-43282,
-48380,
-47119,
-47526,
-47604,
-46415,
-46539,
-46048,
-45549,
-47099,
-42828,
-29003,
-18319,
-17621,
-18491,
-17682,
-18530,
-19143,
-18995,
-20030,
-19251,
-19087,
-28623,
-42853,
-48332,
-47118,
-47453,
-47658,
-46526,
-46641,
-46167,
-45535,
-47062,
-43158,
-29526,
-18525,
-17577,
-18512,
-17680,
-18427,
-19064,
-18887,
-19948,
-19292,
-18985,
-28188,
-42523,
-48384,
-47227,
-47508,
-47788,
-46654,
-46709,
-46237,
-45523,
-47042,
-43477,
-30039,
-18741,
-17551,
-18542,
-17673,
-18332,
-19002,
-18852,
-19938,
-19377,
-18883,
-27713,
-42107,
-48291,
-47190,
-47395,
-47788,
-46715,
-46749,
-46289,
-45490,
-47002,
-43778,
-30536,
-18932,
-17482,
-18531,
-17665,
-18228,
-18916,
-18756,
-19885,
-19465,
-18820,
-27306,
-41743,
-48310,
-47290,
-47447,
-47888,
-46814,
-46793,
-46354,
-45443,
-46927,
-44009,
-30988,
-19135,
-17453,
-18544,
-17655,
-18138,
-18852,
-18709,
-19848,
-19537,
-18724,
-26844,
-41322,
-48213,
-47261,
-47350,
-47882,
-46855,
-46838,
-46409,
-45406,
-46841,
-44268,
-31469,
-19348,
-17394,
-18528,
-17645,
-18075,
-18808,
-18633,
-19801,
-19636,
-18718,
-26473,
-40965,
-48196,
-47342,
-47393,
-47977,
-46949,
-46874,
-46488,
-45385,
-46766,
-44475,
-31898,
-19508,
-17309,
-18488,
-17590,
-17938,
-18700,
-18530,
-19725,
-19717,
-18664,
-26026,
-40544,
-48137,
-47384,
-47342,
-47994,
-46989,
-46954,
-46636,
-45433,
-46705,
-44733,
-32442,
-19806,
-17299,
-18475,
-17568,
-17853,
-18648,
-18399,
-19536,
-19691,
-18590,
-25617,
-40147,
-48104,
-47480,
-47407,
-48145,
-47142,
-47029,
-46760,
-45475,
-46657,
-44965,
-32935,
-20015,
-17234,
-18465,
-17576,
-17760,
-18557,
-18275,
-19393,
-19695,
-18501,
-25081,
-39573,
-47927,
-47443,
-47285,
-48082,
-47141,
-47075,
-46946,
-45629,
-46672,
-45263,
-33540,
-20390,
-17244,
-18479,
-17605,
-17720,
-18562,
-18231,
-19254,
-19685,
-18464,
-24676,
-39116,
-47860,
-47529,
-47285,
-48140,
-47222,
-47083,
-47021,
-45668,
-46604,
-45457,
-34073,
-20701,
-17208,
-18496,
-17677,
-17702,
-18539,
-18183,
-19129,
-19681,
-18428,
-24229,
-38554,
-47705,
-47547,
-47176,
-48057,
-47191,
-47048,
-47083,
-45759,
-46584,
-45680,
-34658,
-21067,
-17174,
-18471,
-17745,
-17682,
-18534,
-18171,
-19032,
-19689,
-18416,
-23821,
-38022,
-47604,
-47696,
-47207,
-48084,
-47271,
-47067,
-47155,
-45815,
-46482,
-45779,
-35130,
-21396,
-17095,
-18379,
-17762,
-17634,
-18512,
-18178,
-18955,
-19667,
-18421,
-23455,
-37496,
-47450,
-47760,
-47139,
-48024,
-47320,
-47082,
-47221,
-45933,
-46547,
-46065,
-35799,
-21877,
-17098,
-18346,
-17843,
-17624,
-18453,
-18137,
-18868,
-19654,
-18416,
-23046,
-36875,
-47240,
-47872,
-47148,
-47999,
-47376,
-47101,
-47259,
-45978,
-46455,
-46122,
-36271,
-22272,
-17073,
-18265,
-17904,
-17612,
-18426,
-18146,
-18780,
-19588,
-18353,
-22644,
-36264,
-46986,
-47917,
-47071,
-47918,
-47409,
-47105,
-47264,
-46038,
-46468,
-46353,
-36915,
-22821,
-17154,
-18259,
-18019,
-17632,
-18366,
-18113,
-18712,
-19584,
-18386,
-22311,
-35669,
-46724,
-47971,
-47033,
-47839,
-47444,
-47128,
-47303,
-46123,
-46468,
-46500,
-37450,
-23303,
-17201,
-18240,
-18133,
-17670,
-18334,
-18119,
-18665,
-19577,
-18370,
-21927,
-35006,
-46389,
-47961,
-46927,
-47686,
-47407,
-47110,
-47317,
-46189,
-46433,
-46626,
-38003,
-23865,
-17360,
-18295,
-18298,
-17758,
-18366,
-18171,
-18642,
-19562,
-18405,
-21640,
-34480,
-46140,
-47993,
-46863,
-47604,
-47463,
-47143,
-47345,
-46225,
-46395,
-46730,
-38500,
-24316,
-17413,
-18298,
-18484,
-17869,
-18382,
-18185,
-18604,
-19597,
-18459,
-21329,
-33862,
-45826,
-48011,
-46780,
-47454,
-47400,
-47120,
-47401,
-46336,
-46367,
-46794,
-38988,
-24839,
-17560,
-18331,
-18593,
-17920,
-18402,
-18218,
-18533,
-19519,
-18471,
-21086,
-33408,
-45628,
-48051,
-46710,
-47369,
-47436,
-47133,
-47397,
-46361,
-46314,
-46884,
-39439,
-25221,
-17528,
-18246,
-18687,
-17968,
-18356,
-18143,
-18397,
-19474,
-18502,
-20788,
-32806,
-45326,
-48070,
-46657,
-47225,
-47350,
-47090,
-47490,
-46562,
-46392,
-47016,
-39943,
-25732,
-17651,
-18226,
-18742,
-17982,
-18361,
-18148,
-18247,
-19302,
-18396,
-20453,
-32273,
-45071,
-48106,
-46639,
-47205,
-47429,
-47146,
-47570,
-46715,
-46467,
-47215,
-40469,
-26199,
-17711,
-18217,
-18898,
-18112,
-18424,
-18161,
-18148,
-19238,
-18382,
-20117,
-31660,
-44757,
-48147,
-46625,
-47085,
-47311,
-47049,
-47621,
-46915,
-46584,
-47412,
-41043,
-26797,
-17934,
-18256,
-19002,
-18192,
-18534,
-18272,
-18094,
-19125,
-18302,
-19785,
-31114,
-44478,
-48177,
-46638,
-47051,
-47341,
-47031,
-47656,
-47024,
-46631,
-47560,
-41524,
-27228,
-17935,
-18115,
-18969,
-18185,
-18514,
-18242,
-17946,
-18977,
-18192,
-19372,
-30433,
-44088,
-48167,
-46633,
-46955,
-47213,
-46879,
-47615,
-47124,
-46683,
-47719,
-42074,
-27846,
-18155,
-18118,
-18979,
-18207,
-18588,
-18352,
-17913,
-18884,
-18126,
-19058,
-29879,
-43776,
-48203,
-46694,
-47001,
-47283,
-46894,
-47641,
-47232,
-46739,
-47892,
-42618,
-28380,
-18266,
-18005,
-18953,
-18209,
-18622,
-18404,
-17858,
-18829,
-18117,
-18743,
-29235,
-43363,
-48204,
-46773,
-47024,
-47268,
-46791,
-47590,
-47283,
-46730,
-47944,
-43071,
-28933,
-18457,
-17948,
-18915,
-18172,
-18658,
-18521,
-17884,
-18816,
-18165,
-18537,
-28724,
-43048,
-48259,
-46900,
-47117,
-47391,
-46810,
-47571,
-47319,
-46672,
-47953,
-43452,
-29398,
-18495,
-17742,
-18756,
-18025,
-18534,
-18457,
-17769,
-18730,
-18193,
-18309,
-28114,
-42618,
-48273,
-47016,
-47204,
-47470,
-46818,
-47596,
-47455,
-46717,
-48004,
-43894,
-30020,
-18754,
-17716,
-18723,
-17954,
-18487,
-18528,
-17795,
-18744,
-18322,
-18235,
-27668,
-42306,
-48344,
-47145,
-47301,
-47626,
-46910,
-47630,
-47538,
-46683,
-47942,
-44218,
-30509,
-18871,
-17563,
-18644,
-17871,
-18371,
-18491,
-17693,
-18641,
-18356,
-18054,
-27053,
-41791,
-48274,
-47160,
-47260,
-47639,
-46888,
-47599,
-47609,
-46651,
-47847,
-44530,
-31105,
-19146,
-17561,
-18680,
-17877,
-18351,
-18538,
-17684,
-18571,
-18471,
-18045,
-26638,
-41427,
-48289,
-47223,
-47250,
-47717,
-46923,
-47576,
-47675,
-46646,
-47763,
-44811,
-31623,
-19342,
-17488,
-18741,
-17942,
-18345,
-18607,
-17719,
-18585,
-18653,
-18083,
-26197,
-41008,
-48262,
-47239,
-47119,
-47646,
-46838,
-47475,
-47698,
-46592,
-47586,
-44991,
-32120,
-19536,
-17393,
-18726,
-17937,
-18264,
-18580,
-17628,
-18407,
-18665,
-18046,
-25748,
-40570,
-48226,
-47271,
-47047,
-47658,
-46847,
-47419,
-47769,
-46617,
-47482,
-45158,
-32558,
-19666,
-17262,
-18743,
-17992,
-18210,
-18598,
-17612,
-18327,
-18720,
-18008,
-25269,
-40102,
-48206,
-47318,
-46924,
-47588,
-46818,
-47375,
-47858,
-46642,
-47357,
-45336,
-33092,
-19926,
-17200,
-18778,
-18082,
-18220,
-18645,
-17573,
-18158,
-18694,
-17975,
-24857,
-39674,
-48211,
-47430,
-46910,
-47642,
-46893,
-47403,
-48020,
-46827,
-47402,
-45631,
-33654,
-20190,
-17106,
-18766,
-18101,
-18135,
-18608,
-17536,
-18010,
-18659,
-17889,
-24375,
-39188,
-48170,
-47505,
-46816,
-47596,
-46916,
-47412,
-48159,
-46954,
-47421,
-45925,
-34292,
-20540,
-17040,
-18743,
-18161,
-18141,
-18652,
-17505,
-17826,
-18570,
-17799,
-23916,
-38656,
-48070,
-47598,
-46832,
-47676,
-47008,
-47428,
-48276,
-47144,
-47523,
-46252,
-34896,
-20869,
-16990,
-18729,
-18210,
-18089,
-18634,
-17500,
-17721,
-18510,
-17682,
-23398,
-38094,
-47972,
-47717,
-46830,
-47694,
-47082,
-47444,
-48359,
-47234,
-47514,
-46496,
-35484,
-21213,
-16866,
-18578,
-18136,
-17975,
-18552,
-17406,
-17514,
-18395,
-17581,
-22943,
-37508,
-47801,
-47827,
-46906,
-47804,
-47185,
-47430,
-48411,
-47376,
-47613,
-46797,
-36085,
-21610,
-16854,
-18520,
-18120,
-17834,
-18460,
-17395,
-17480,
-18398,
-17517,
-22464,
-36906,
-47625,
-47947,
-46939,
-47849,
-47280,
-47492,
-48506,
-47491,
-47638,
-47033,
-36715,
-22083,
-16860,
-18388,
-18035,
-17697,
-18380,
-17369,
-17370,
-18342,
-17464,
-22072,
-36327,
-47411,
-48051,
-47046,
-47987,
-47433,
-47489,
-48462,
-47472,
-47541,
-47119,
-37142,
-22413,
-16794,
-18246,
-17932,
-17502,
-18201,
-17307,
-17303,
-18324,
-17418,
-21645,
-35713,
-47176,
-48164,
-47137,
-48100,
-47625,
-47636,
-48608,
-47629,
-47602,
-47371,
-37827,
-23064,
-16998,
-18263,
-17943,
-17419,
-18135,
-17316,
-17259,
-18320,
-17448,
-21366,
-35191,
-46947,
-48243,
-47222,
-48229,
-47825,
-47702,
-48592,
-47612,
-47502,
-47424,
-38247,
-23416,
-16926,
-18056,
-17789,
-17177,
-17904,
-17209,
-17182,
-18331,
-17493,
-21053,
-34592,
-46633,
-48284,
-47260,
-48298,
-47985,
-47807,
-48691,
-47731,
-47511,
-47553,
-38779,
-23966,
-17074,
-18046,
-17787,
-17077,
-17775,
-17159,
-17073,
-18247,
-17462,
-20719,
-34002,
-46319,
-48299,
-47273,
-48345,
-48121,
-47869,
-48683,
-47725,
-47379,
-47529,
-39158,
-24352,
-17070,
-17901,
-17723,
-16930,
-17612,
-17059,
-16951,
-18207,
-17523,
-20498,
-33479,
-46059,
-48363,
-47325,
-48381,
-48237,
-47918,
-48746,
-47825,
-47375,
-47576,
-39599,
-24819,
-17163,
-17858,
-17741,
-16868,
-17540,
-17063,
-16906,
-18189,
-17601,
-20308,
-33018,
-45855,
-48462,
-47376,
-48398,
-48353,
-47974,
-48796,
-47893,
-47287,
-47524,
-39915,
-25144,
-17080,
-17627,
-17628,
-16734,
-17425,
-17013,
-16777,
-18112,
-17674,
-20162,
-32603,
-45682,
-48635,
-47526,
-48538,
-48561,
-48111,
-48933,
-48106,
-47367,
-47625,
-40330,
-25563,
-17070,
-17481,
-17584,
-16659,
-17342,
-16986,
-16670,
-18039,
-17754,
-20035,
-32214,
-45572,
-48864,
-47700,
-48634,
-48665,
-48143,
-48961,
-48233,
-47375,
-47657,
-40710,
-25958,
-17049,
-17321,
-17565,
-16645,
-17353,
-17047,
-16616,
-17983,
-17826,
-19882,
-31795,
-45411,
-49083,
-47885,
-48758,
-48790,
-48166,
-48992,
-48364,
-47395,
-47660,
-41020,
-26242,
-16899,
-16999,
-17360,
-16436,
-17169,
-16938,
-16408,
-17779,
-17744,
-19602,
-31271,
-45189,
-49250,
-48026,
-48784,
-48797,
-48051,
-48885,
-48381,
-47339,
-47644,
-41340,
-26595,
-16826,
-16781,
-17282,
-16425,
-17236,
-17119,
-16516,
-17853,
-17877,
-19463,
-30798,
-44965,
-49419,
-48196,
-48863,
-48886,
-48079,
-48968,
-48609,
-47495,
-47793,
-41833,
-27132,
-16959,
-16693,
-17292,
-16463,
-17342,
-17335,
-16619,
-17862,
-17930,
-19294,
-30369,
-44802,
-49646,
-48411,
-48951,
-48933,
-47961,
-48749,
-48440,
-47268,
-47642,
-42094,
-27502,
-16930,
-16458,
-17191,
-16413,
-17350,
-17457,
-16691,
-17925,
-18078,
-19197,
-29906,
-44514,
-49742,
-48504,
-48921,
-48877,
-47828,
-48642,
-48502,
-47315,
-47743,
-42569,
-28105,
-17133,
-16374,
-17129,
-16369,
-17378,
-17651,
-16851,
-17990,
-18171,
-19061,
-29444,
-44193,
-49775,
-48547,
-48905,
-48929,
-47789,
-48493,
-48348,
-47123,
-47620,
-42863,
-28551,
-17197,
-16192,
-17081,
-16374,
-17383,
-17698,
-16863,
-17985,
-18274,
-18956,
-28923,
-43746,
-49733,
-48606,
-48900,
-48906,
-47683,
-48309,
-48295,
-47060,
-47575,
-43138,
-29047,
-17408,
-16155,
-17052,
-16287,
-17232,
-17672,
-16849,
-17907,
-18201,
-18690,
-28303,
-43212,
-49556,
-48499,
-48727,
-48886,
-47697,
-48259,
-48259,
-46980,
-47537,
-43486,
-29669,
-17747,
-16227,
-17224,
-16487,
-17337,
-17782,
-16913,
-17921,
-18319,
-18658,
-27848,
-42724,
-49438,
-48509,
-48697,
-48919,
-47731,
-48221,
-48303,
-47019,
-47499,
-43720,
-30155,
-18023,
-16253,
-17277,
-16492,
-17221,
-17764,
-16966,
-17962,
-18431,
-18679,
-27511,
-42372,
-49401,
-48500,
-48570,
-48912,
-47807,
-48242,
-48329,
-47001,
-47426,
-43957,
-30707,
-18355,
-16306,
-17400,
-16631,
-17201,
-17707,
-16855,
-17773,
-18348,
-18552,
-27015,
-41793,
-49179,
-48418,
-48458,
-48940,
-47939,
-48359,
-48549,
-47244,
-47549,
-44262,
-31255,
-18699,
-16350,
-17481,
-16683,
-17101,
-17654,
-16873,
-17772,
-18476,
-18687,
-26826,
-41515,
-49187,
-48448,
-48310,
-48847,
-47907,
-48249,
-48473,
-47144,
-47349,
-44283,
-31624,
-18938,
-16371,
-17650,
-16926,
-17220,
-17734,
-16914,
-17669,
-18417,
-18570,
-26326,
-40914,
-48925,
-48337,
-48104,
-48755,
-47957,
-48308,
-48654,
-47351,
-47418,
-44506,
-32121,
-19234,
-16326,
-17623,
-16934,
-17120,
-17690,
-16919,
-17617,
-18475,
-18704,
-26165,
-40657,
-48957,
-48423,
-47993,
-48630,
-47819,
-48025,
-48371,
-47090,
-47057,
-44352,
-32314,
-19324,
-16199,
-17667,
-17110,
-17225,
-17802,
-17047,
-17617,
-18491,
-18634,
-25691,
-40055,
-48704,
-48335,
-47737,
-48398,
-47682,
-47917,
-48403,
-47197,
-47074,
-44616,
-32968,
-19852,
-16327,
-17734,
-17233,
-17305,
-17961,
-17217,
-17652,
-18588,
-18785,
-25551,
-39746,
-48680,
-48440,
-47749,
-48441,
-47707,
-47756,
-48200,
-47017,
-46849,
-44592,
-33258,
-19985,
-16185,
-17718,
-17405,
-17421,
-18108,
-17409,
-17798,
-18764,
-18831,
-25093,
-39086,
-48388,
-48408,
-47580,
-48205,
-47482,
-47547,
-48133,
-47065,
-46855,
-44925,
-34119,
-20861,
-16667,
-18029,
-17645,
-17577,
-18299,
-17589,
-17781,
-18687,
-18713,
-24618,
-38376,
-47896,
-48087,
-47276,
-48090,
-47570,
-47605,
-48251,
-47270,
-47112,
-45411,
-34853,
-21285,
-16577,
-17861,
-17576,
-17402,
-18050,
-17302,
-17373,
-18174,
-17806,
-22822,
-35891,
-45426,
-45699,
-44677,
-45315,
-44733,
-44762,
-45600,
-44847,
-44836,
-43655,
-33958,
-20860,
-16238,
-17706,
-17645,
-17547,
-18359,
-17745,
-17780,
-18606,
-18276,
-23065,
-36051,
-45931,
-46459,
-45366,
-45974,
-45342,
-45089,
-45661,
-44751,
-44660,
-43766,
-34519,
-21396,
-16449,
-17940,
-18042,
-17941,
-18748,
-18260,
-18436,
-19475,
-19128,
-23388,
-35936,
-45978,
-46727,
-45507,
-45970,
-45297,
-45019,
-45673,
-44810,
-44622,
-43898,
-35134,
-22151,
-16955,
-18326,
-18425,
-18229,
-19100,
-18725,
-18863,
-19864,
-19445,
-23361,
-35691,
-45956,
-46910,
-45613,
-46141,
-45633,
-45314,
-45836,
-44856,
-44564,
-44065,
-35727,
-22711,
-17126,
-18448,
-18711,
-18499,
-19311,
-18947,
-19111,
-20250,
-19868,
-23377,
-35300,
-45757,
-46982,
-45658,
-46133,
-45669,
-45339,
-45921,
-45019,
-44637,
-44257,
-36341,
-23442,
-17615,
-18870,
-19170,
-18856,
-19622,
-19319,
-19418,
-20514,
-20089,
-23275,
-34967,
-45650,
-47088,
-45642,
-46083,
-45748,
-45416,
-45942,
-44993,
-44542,
-44357,
-36884,
-24013,
-17806,
-18953,
-19393,
-19035,
-19710,
-19379,
-19414,
-20582,
-20241,
-23123,
-34509,
-45373,
-47099,
-45601,
-45997,
-45730,
-45374,
-45956,
-45104,
-44618,
-44524,
-37383,
-24522,
-17987,
-19046,
-19577,
-19147,
-19780,
-19496,
-19473,
-20615,
-20231,
-22817,
-33943,
-45077,
-47095,
-45545,
-45902,
-45753,
-45418,
-46017,
-45210,
-44644,
-44666,
-37888,
-25054,
-18150,
-19069,
-19709,
-19250,
-19842,
-19555,
-19422,
-20506,
-20141,
-22454,
-33334,
-44689,
-47023,
-45447,
-45785,
-45730,
-45404,
-46033,
-45337,
-44771,
-44933,
-38532,
-25704,
-18408,
-19142,
-19854,
-19357,
-19899,
-19624,
-19397,
-20470,
-20161,
-22241,
-32863,
-44441,
-47096,
-45538,
-45840,
-45825,
-45421,
-46038,
-45428,
-44864,
-45135,
-39066,
-26262,
-18607,
-19199,
-19980,
-19430,
-19931,
-19698,
-19428,
-20480,
-20170,
-21954,
-32284,
-44080,
-47085,
-45543,
-45823,
-45874,
-45475,
-46126,
-45617,
-45011,
-45368,
-39642,
-26885,
-18853,
-19222,
-20032,
-19457,
-19961,
-19811,
-19487,
-20548,
-20293,
-21852,
-31895,
-43861,
-47194,
-45694,
-45962,
-46035,
-45553,
-46151,
-45674,
-44998,
-45390,
-39974,
-27292,
-18957,
-19163,
-20022,
-19409,
-19896,
-19820,
-19480,
-20541,
-20319,
-21632,
-31400,
-43536,
-47208,
-45752,
-45984,
-46124,
-45613,
-46182,
-45717,
-44916,
-45343,
-40249,
-27682,
-19016,
-18994,
-19880,
-19254,
-19754,
-19714,
-19344,
-20420,
-20328,
-21482,
-30956,
-43201,
-47183,
-45817,
-46051,
-46209,
-45618,
-46126,
-45696,
-44829,
-45259,
-40447,
-27997,
-19086,
-18903,
-19822,
-19157,
-19606,
-19645,
-19303,
-20457,
-20463,
-21439,
-30629,
-42987,
-47280,
-45932,
-46087,
-46281,
-45723,
-46274,
-45890,
-44915,
-45326,
-40822,
-28527,
-19336,
-18884,
-19795,
-19115,
-19553,
-19611,
-19218,
-20376,
-20507,
-21373,
-30267,
-42666,
-47208,
-45921,
-46039,
-46284,
-45701,
-46231,
-45873,
-44824,
-45210,
-40977,
-28848,
-19463,
-18887,
-19894,
-19238,
-19616,
-19667,
-19224,
-20377,
-20583,
-21286,
-29874,
-42338,
-47185,
-45939,
-45955,
-46208,
-45655,
-46215,
-45916,
-44750,
-45083,
-41118,
-29210,
-19613,
-18831,
-19882,
-19277,
-19655,
-19736,
-19227,
-20343,
-20671,
-21309,
-29638,
-42137,
-47235,
-46021,
-45944,
-46231,
-45677,
-46229,
-45978,
-44759,
-45058,
-41340,
-29587,
-19744,
-18753,
-19902,
-19361,
-19698,
-19754,
-19173,
-20243,
-20670,
-21192,
-29217,
-41725,
-47131,
-45978,
-45804,
-46112,
-45594,
-46207,
-46073,
-44845,
-45097,
-41617,
-30048,
-19961,
-18729,
-19960,
-19492,
-19825,
-19898,
-19249,
-20266,
-20764,
-21209,
-28916,
-41454,
-47170,
-46088,
-45795,
-46088,
-45566,
-46166,
-46129,
-44886,
-45091,
-41858,
-30484,
-20158,
-18696,
-20005,
-19627,
-19926,
-20028,
-19314,
-20248,
-20809,
-21137,
-28537,
-41102,
-47181,
-46175,
-45752,
-46024,
-45488,
-46092,
-46144,
-44892,
-45043,
-42077,
-30920,
-20341,
-18564,
-19914,
-19590,
-19900,
-20053,
-19290,
-20139,
-20772,
-21041,
-28137,
-40716,
-47133,
-46224,
-45704,
-45985,
-45419,
-45957,
-46065,
-44816,
-44946,
-42262,
-31353,
-20507,
-18462,
-19883,
-19659,
-19947,
-20129,
-19317,
-20092,
-20811,
-20985,
-27700,
-40265,
-47050,
-46300,
-45701,
-45984,
-45390,
-45878,
-46112,
-44873,
-44977,
-42548,
-31880,
-20782,
-18427,
-19861,
-19649,
-19892,
-20143,
-19346,
-20072,
-20870,
-20924,
-27266,
-39796,
-46924,
-46289,
-45595,
-45898,
-45293,
-45728,
-46026,
-44775,
-44826,
-42696,
-32308,
-21011,
-18368,
-19844,
-19670,
-19884,
-20201,
-19399,
-20071,
-20935,
-20865,
-26810,
-39269,
-46744,
-46247,
-45502,
-45855,
-45253,
-45628,
-45986,
-44700,
-44710,
-42875,
-32807,
-21343,
-18419,
-19906,
-19735,
-19888,
-20258,
-19469,
-20094,
-21065,
-20909,
-26485,
-38870,
-46653,
-46286,
-45491,
-45910,
-45310,
-45623,
-46014,
-44711,
-44664,
-43115,
-33343,
-21710,
-18507,
-20007,
-19830,
-19893,
-20288,
-19505,
-20101,
-21165,
-20912,
-26087,
-38375,
-46477,
-46259,
-45420,
-45913,
-45362,
-45664,
-46131,
-44799,
-44667,
-43372,
-33925,
-22125,
-18622,
-20087,
-19878,
-19849,
-20280,
-19476,
-20020,
-21166,
-20873,
-25686,
-37887,
-46262,
-46171,
-45298,
-45874,
-45367,
-45602,
-46109,
-44752,
-44564,
-43521,
-34366,
-22402,
-18648,
-20130,
-19941,
-19792,
-20210,
-19383,
-19893,
-21149,
-20786,
-25247,
-37351,
-46067,
-46160,
-45246,
-45869,
-45393,
-45638,
-46229,
-44865,
-44564,
-43706,
-34847,
-22765,
-18725,
-20160,
-19947,
-19736,
-20195,
-19388,
-19824,
-21138,
-20755,
-24933,
-36976,
-45965,
-46201,
-45228,
-45920,
-45498,
-45700,
-46308,
-44917,
-44535,
-43876,
-35264,
-23025,
-18663,
-20097,
-19940,
-19681,
-20152,
-19331,
-19717,
-21112,
-20702,
-24584,
-36523,
-45839,
-46277,
-45272,
-45959,
-45559,
-45716,
-46377,
-44985,
-44505,
-44005,
-35663,
-23287,
-18602,
-19949,
-19833,
-19557,
-20095,
-19314,
-19646,
-21104,
-20736,
-24375,
-36238,
-45818,
-46457,
-45402,
-46099,
-45670,
-45718,
-46348,
-44979,
-44450,
-44104,
-35985,
-23445,
-18413,
-19728,
-19691,
-19392,
-19964,
-19235,
-19567,
-21107,
-20718,
-24067,
-35800,
-45741,
-46675,
-45607,
-46246,
-45794,
-45773,
-46451,
-45098,
-44475,
-44227,
-36400,
-23791,
-18411,
-19579,
-19558,
-19261,
-19942,
-19317,
-19580,
-21108,
-20722,
-23842,
-35458,
-45666,
-46830,
-45722,
-46355,
-45902,
-45738,
-46352,
-45015,
-44371,
-44309,
-36789,
-24083,
-18326,
-19388,
-19466,
-19173,
-19908,
-19358,
-19594,
-21154,
-20758,
-23551,
-34927,
-45405,
-46890,
-45802,
-46399,
-45918,
-45638,
-46250,
-44981,
-44289,
-44350,
-37181,
-24486,
-18385,
-19314,
-19412,
-19128,
-19958,
-19545,
-19738,
-21275,
-20864,
-23366,
-34494,
-45184,
-46944,
-45846,
-46434,
-45958,
-45532,
-46071,
-44839,
-44135,
-44357,
-37566,
-24889,
-18451,
-19252,
-19432,
-19108,
-19973,
-19663,
-19847,
-21396,
-20977,
-23136,
-33954,
-44865,
-46965,
-45883,
-46445,
-45981,
-45473,
-45989,
-44822,
-44054,
-44387,
-38012,
-25431,
-18663,
-19263,
-19455,
-19074,
-19983,
-19791,
-19939,
-21468,
-21090,
-22974,
-33477,
-44544,
-46937,
-45860,
-46437,
-46037,
-45421,
-45870,
-44756,
-43949,
-44397,
-38408,
-25915,
-18811,
-19261,
-19503,
-19040,
-19914,
-19825,
-19951,
-21498,
-21151,
-22729,
-32887,
-44147,
-46902,
-45864,
-46434,
-46132,
-45489,
-45929,
-44866,
-43944,
-44432,
-38842,
-26499,
-19049,
-19273,
-19516,
-18973,
-19833,
-19824,
-19891,
-21419,
-21174,
-22558,
-32390,
-43787,
-46841,
-45816,
-46420,
-46228,
-45545,
-45922,
-44925,
-43953,
-44494,
-39266,
-27011,
-19210,
-19257,
-19568,
-18932,
-19698,
-19736,
-19770,
-21319,
-21170,
-22310,
-31791,
-43360,
-46785,
-45807,
-46389,
-46322,
-45633,
-46027,
-45089,
-44003,
-44503,
-39618,
-27501,
-19373,
-19231,
-19597,
-18915,
-19635,
-19743,
-19708,
-21234,
-21198,
-22178,
-31349,
-43059,
-46803,
-45832,
-46368,
-46395,
-45647,
-46004,
-45135,
-43987,
-44481,
-39906,
-27902,
-19444,
-19127,
-19589,
-18832,
-19494,
-19664,
-19624,
-21143,
-21220,
-22025,
-30904,
-42804,
-46902,
-45907,
-46354,
-46466,
-45730,
-46088,
-45295,
-44031,
-44496,
-40249,
-28378,
-19561,
-19026,
-19570,
-18851,
-19509,
-19762,
-19620,
-21082,
-21281,
-21962,
-30549,
-42550,
-46959,
-45960,
-46357,
-46530,
-45709,
-45986,
-45290,
-44014,
-44499,
-40542,
-28762,
-19608,
-18930,
-19624,
-18882,
-19481,
-19781,
-19613,
-21043,
-21314,
-21796,
-30058,
-42236,
-47031,
-46032,
-46307,
-46498,
-45647,
-45922,
-45339,
-44005,
-44464,
-40829,
-29209,
-19736,
-18840,
-19629,
-18918,
-19541,
-19948,
-19703,
-21022,
-21352,
-21675,
-29626,
-41913,
-47013,
-46022,
-46219,
-46471,
-45550,
-45776,
-45311,
-44019,
-44518,
-41199,
-29691,
-19885,
-18794,
-19688,
-18974,
-19550,
-20035,
-19745,
-21000,
-21354,
-21479,
-29090,
-41507,
-46984,
-46023,
-46122,
-46407,
-45466,
-45674,
-45343,
-44035,
-44545,
-41556,
-30243,
-20135,
-18801,
-19758,
-19059,
-19642,
-20212,
-19837,
-20950,
-21325,
-21295,
-28568,
-41053,
-46848,
-45943,
-46012,
-46366,
-45370,
-45516,
-45290,
-44055,
-44605,
-41934,
-30775,
-20369,
-18808,
-19829,
-19097,
-19598,
-20226,
-19835,
-20880,
-21303,
-21086,
-28035,
-40591,
-46761,
-45923,
-45899,
-46301,
-45293,
-45427,
-45311,
-44085,
-44635,
-42277,
-31347,
-20680,
-18846,
-19881,
-19158,
-19634,
-20335,
-19890,
-20812,
-21263,
-20943,
-27563,
-40138,
-46620,
-45902,
-45862,
-46354,
-45333,
-45379,
-45347,
-44152,
-44702,
-42591,
-31841,
-20926,
-18847,
-19938,
-19201,
-19580,
-20319,
-19880,
-20759,
-21258,
-20805,
-27098,
-39683,
-46535,
-45933,
-45810,
-46336,
-45348,
-45380,
-45438,
-44237,
-44739,
-42876,
-32398,
-21291,
-18915,
-19992,
-19280,
-19620,
-20420,
-19967,
-20741,
-21280,
-20770,
-26760,
-39276,
-46423,
-45929,
-45765,
-46351,
-45385,
-45338,
-45424,
-44245,
-44719,
-43064,
-32819,
-21517,
-18857,
-19972,
-19285,
-19531,
-20321,
-19896,
-20639,
-21252,
-20693,
-26373,
-38829,
-46307,
-45963,
-45681,
-46262,
-45340,
-45266,
-45403,
-44240,
-44664,
-43232,
-33304,
-21867,
-18895,
-19988,
-19372,
-19544,
-20349,
-19911,
-20580,
-21224,
-20646,
-26007,
-38335,
-46089,
-45943,
-45596,
-46241,
-45370,
-45240,
-45394,
-44266,
-44638,
-43359,
-33697,
-22131,
-18879,
-20010,
-19485,
-19569,
-20364,
-19991,
-20625,
-21297,
-20651,
-25666,
-37861,
-45946,
-45995,
-45531,
-46159,
-45394,
-45255,
-45459,
-44346,
-44654,
-43592,
-34291,
-22647,
-19020,
-20086,
-19618,
-19633,
-20403,
-20046,
-20594,
-21301,
-20663,
-25375,
-37383,
-45735,
-45985,
-45449,
-46104,
-45409,
-45202,
-45382,
-44316,
-44583,
-43693,
-34697,
-22949,
-18980,
-20047,
-19670,
-19576,
-20309,
-20006,
-20552,
-21287,
-20605,
-24949,
-36780,
-45475,
-45994,
-45373,
-46025,
-45453,
-45241,
-45445,
-44377,
-44557,
-43847,
-35241,
-23425,
-19075,
-20037,
-19730,
-19548,
-20261,
-19980,
-20458,
-21232,
-20570,
-24605,
-36225,
-45203,
-45976,
-45317,
-46012,
-45525,
-45247,
-45417,
-44384,
-44500,
-43965,
-35696,
-23804,
-19099,
-20027,
-19792,
-19488,
-20157,
-19955,
-20439,
-21288,
-20603,
-24266,
-35683,
-44987,
-46034,
-45286,
-45985,
-45601,
-45319,
-45501,
-44451,
-44462,
-44107,
-36255,
-24323,
-19221,
-20038,
-19841,
-19459,
-20117,
-19970,
-20412,
-21346,
-20708,
-24071,
-35252,
-44833,
-46118,
-45353,
-46103,
-45822,
-45449,
-45603,
-44549,
-44471,
-44263,
-36759,
-24754,
-19322,
-20106,
-19986,
-19476,
-20108,
-20010,
-20455,
-21443,
-20791,
-23747,
-34695,
-44560,
-46118,
-45272,
-46040,
-45863,
-45474,
-45659,
-44579,
-44371,
-44328,
-37255,
-25242,
-19461,
-20140,
-20062,
-19481,
-20109,
-20058,
-20435,
-21513,
-20924,
-23577,
-34276,
-44353,
-46114,
-45206,
-45996,
-45869,
-45387,
-45533,
-44481,
-44179,
-44297,
-37577,
-25528,
-19439,
-20099,
-20102,
-19421,
-20022,
-20026,
-20388,
-21549,
-20964,
-23258,
-33718,
-44083,
-46102,
-45149,
-45947,
-45911,
-45433,
-45623,
-44566,
-44122,
-44365,
-38029,
-25996,
-19569,
-20138,
-20183,
-19442,
-20057,
-20065,
-20351,
-21551,
-21040,
-23066,
-33295,
-43866,
-46094,
-45102,
-45924,
-45954,
-45418,
-45612,
-44614,
-44102,
-44483,
-38477,
-26404,
-19669,
-20168,
-20278,
-19439,
-19993,
-20027,
-20259,
-21517,
-21022,
-22737,
-32722,
-43539,
-46017,
-44975,
-45775,
-45879,
-45352,
-45601,
-44634,
-43997,
-44462,
-38790,
-26744,
-19678,
-20073,
-20232,
-19370,
-19930,
-19981,
-20129,
-21409,
-20999,
-22523,
-32305,
-43338,
-46076,
-45032,
-45858,
-46032,
-45456,
-45720,
-44810,
-44129,
-44671,
-39278,
-27195,
-19812,
-20084,
-20298,
-19348,
-19842,
-19898,
-19996,
-21297,
-20918,
-22189,
-31754,
-43009,
-46034,
-44977,
-45750,
-46001,
-45445,
-45787,
-44939,
-44183,
-44778,
-39681,
-27644,
-19932,
-20052,
-20319,
-19370,
-19861,
-19939,
-19936,
-21208,
-20880,
-21978,
-31328,
-42743,
-46027,
-44971,
-45720,
-46009,
-45407,
-45702,
-44913,
-44109,
-44754,
-39893,
-27878,
-19873,
-19888,
-20269,
-19309,
-19756,
-19872,
-19848,
-21126,
-20846,
-21755,
-30894,
-42514,
-46131,
-45079,
-45744,
-46070,
-45463,
-45782,
-45037,
-44174,
-44824,
-40241,
-28298,
-19982,
-19794,
-20239,
-19296,
-19750,
-19910,
-19841,
-21084,
-20879,
-21671,
-30585,
-42339,
-46232,
-45183,
-45790,
-46148,
-45509,
-45779,
-45117,
-44267,
-44960,
-40626,
-28727,
-20098,
-19731,
-20272,
-19323,
-19717,
-19933,
-19861,
-21095,
-20932,
-21546,
-30205,
-42091,
-46326,
-45282,
-45771,
-46160,
-45518,
-45780,
-45183,
-44301,
-44997,
-40950,
-29187,
-20276,
-19694,
-20319,
-19403,
-19783,
-20048,
-19925,
-21069,
-20942,
-21427,
-29829,
-41822,
-46388,
-45391,
-45826,
-46265,
-45588,
-45758,
-45216,
-44331,
-45056,
-41256,
-29608,
-20393,
-19617,
-20337,
-19432,
-19725,
-20052,
-19922,
-21031,
-20930,
-21247,
-29332,
-41426,
-46316,
-45354,
-45655,
-46159,
-45500,
-45689,
-45253,
-44408,
-45138,
-41646,
-30164,
-20654,
-19611,
-20375,
-19461,
-19711,
-20080,
-19911,
-20906,
-20826,
-21010,
-28792,
-40950,
-46171,
-45261,
-45524,
-46098,
-45436,
-45523,
-45151,
-44310,
-45080,
-41862,
-30557,
-20779,
-19540,
-20428,
-19533,
-19705,
-20131,
-19966,
-20917,
-20866,
-20868,
-28325,
-40547,
-46148,
-45316,
-45477,
-46123,
-45474,
-45543,
-45242,
-44408,
-45188,
-42267,
-31183,
-21118,
-19600,
-20507,
-19608,
-19723,
-20230,
-20086,
-20997,
-21007,
-20916,
-28066,
-40335,
-46254,
-45484,
-45574,
-46281,
-45629,
-45577,
-45292,
-44443,
-45220,
-42559,
-31620,
-21258,
-19463,
-20415,
-19517,
-19528,
-20080,
-19978,
-20873,
-20937,
-20693,
-27504,
-39817,
-46108,
-45467,
-45486,
-46268,
-45645,
-45554,
-45299,
-44432,
-45188,
-42822,
-32116,
-21526,
-19448,
-20414,
-19508,
-19455,
-20048,
-19963,
-20807,
-20928,
-20574,
-27093,
-39439,
-46082,
-45565,
-45550,
-46392,
-45759,
-45543,
-45238,
-44317,
-45049,
-42952,
-32450,
-21634,
-19308,
-20336,
-19470,
-19352,
-19990,
-19961,
-20828,
-21013,
-20515,
-26680,
-39009,
-45997,
-45618,
-45534,
-46432,
-45846,
-45613,
-45347,
-44381,
-45106,
-43257,
-33000,
-21946,
-19307,
-20295,
-19427,
-19259,
-19946,
-19961,
-20851,
-21112,
-20524,
-26387,
-38696,
-45987,
-45728,
-45599,
-46533,
-45967,
-45661,
-45357,
-44332,
-45054,
-43477,
-33456,
-22219,
-19330,
-20340,
-19528,
-19294,
-19976,
-19993,
-20883,
-21191,
-20433,
-25911,
-38145,
-45720,
-45618,
-45444,
-46404,
-45888,
-45597,
-45317,
-44243,
-44937,
-43620,
-33853,
-22457,
-19288,
-20262,
-19477,
-19231,
-19940,
-19989,
-20906,
-21312,
-20458,
-25627,
-37802,
-45632,
-45663,
-45439,
-46406,
-45901,
-45583,
-45291,
-44168,
-44855,
-43840,
-34341,
-22821,
-19409,
-20382,
-19633,
-19330,
-20008,
-20014,
-20940,
-21405,
-20428,
-25229,
-37307,
-45411,
-45580,
-45307,
-46253,
-45770,
-45462,
-45208,
-44027,
-44674,
-43921,
-34716,
-23084,
-19404,
-20337,
-19617,
-19306,
-19994,
-20003,
-20940,
-21543,
-20509,
-25025,
-37021,
-45365,
-45684,
-45349,
-46283,
-45789,
-45449,
-45194,
-43930,
-44522,
-43996,
-35057,
-23284,
-19347,
-20243,
-19574,
-19213,
-19877,
-19833,
-20774,
-21488,
-20385,
-24568,
-36480,
-45124,
-45648,
-45316,
-46280,
-45848,
-45576,
-45414,
-44107,
-44611,
-44302,
-35632,
-23737,
-19493,
-20327,
-19655,
-19268,
-19920,
-19832,
-20738,
-21556,
-20424,
-24293,
-36085,
-44983,
-45656,
-45285,
-46254,
-45849,
-45568,
-45452,
-44109,
-44525,
-44426,
-36049,
-24041,
-19524,
-20335,
-19727,
-19278,
-19896,
-19750,
-20606,
-21510,
-20343,
-23870,
-35528,
-44727,
-45642,
-45231,
-46225,
-45887,
-45666,
-45646,
-44289,
-44597,
-44657,
-36602,
-24514,
-19670,
-20400,
-19839,
-19357,
-19966,
-19787,
-20589,
-21579,
-20438,
-23673,
-35175,
-44603,
-45703,
-45233,
-46204,
-45899,
-45671,
-45697,
-44320,
-44539,
-44773,
-37032,
-24875,
-19733,
-20410,
-19903,
-19373,
-19928,
-19692,
-20425,
-21511,
-20385,
-23314,
-34649,
-44357,
-45694,
-45198,
-46169,
-45917,
-45707,
-45813,
-44442,
-44518,
-44888,
-37490,
-25279,
-19817,
-20424,
-19991,
-19424,
-19985,
-19736,
-20384,
-21552,
-20495,
-23132,
-34243,
-44196,
-45760,
-45214,
-46188,
-46011,
-45777,
-45926,
-44578,
-44519,
-44971,
-37888,
-25636,
-19831,
-20380,
-20047,
-19432,
-19952,
-19703,
-20292,
-21527,
-20530,
-22888,
-33747,
-43963,
-45809,
-45226,
-46173,
-46069,
-45844,
-46037,
-44705,
-44497,
-45014,
-38275,
-26053,
-19915,
-20347,
-20076,
-19386,
-19856,
-19587,
-20087,
-21379,
-20488,
-22611,
-33256,
-43704,
-45832,
-45206,
-46140,
-46118,
-45867,
-46085,
-44774,
-44429,
-45010,
-38643,
-26448,
-19975,
-20321,
-20156,
-19415,
-19852,
-19624,
-20051,
-21407,
-20648,
-22514,
-32840,
-43475,
-45867,
-45165,
-46070,
-46150,
-45870,
-46099,
-44883,
-44429,
-45032,
-39026,
-26907,
-20069,
-20283,
-20206,
-19352,
-19676,
-19507,
-19914,
-21327,
-20736,
-22443,
-32456,
-43281,
-46002,
-45224,
-46014,
-46173,
-45873,
-46052,
-44863,
-44280,
-44834,
-39158,
-27204,
-20075,
-20154,
-20218,
-19359,
-19630,
-19529,
-19916,
-21302,
-20774,
-22267,
-31957,
-42879,
-45892,
-45110,
-45875,
-46196,
-45961,
-46125,
-44938,
-44234,
-44784,
-39428,
-27603,
-20188,
-20139,
-20328,
-19470,
-19677,
-19594,
-19949,
-21374,
-20991,
-22309,
-31672,
-42690,
-45967,
-45136,
-45813,
-46193,
-45917,
-46067,
-44933,
-44148,
-44699,
-39697,
-28048,
-20361,
-20166,
-20462,
-19547,
-19678,
-19653,
-19978,
-21415,
-21138,
-22277,
-31254,
-42306,
-45838,
-44969,
-45581,
-46092,
-45867,
-46015,
-44964,
-44147,
-44714,
-40065,
-28641,
-20758,
-20442,
-20836,
-19846,
-19758,
-19613,
-19807,
-21146,
-20899,
-21865,
-30577,
-41790,
-45697,
-44939,
-45524,
-46151,
-46041,
-46306,
-45446,
-44757,
-45615,
-41612,
-30742,
-22986,
-22779,
-23398,
-22490,
-22405,
-22255,
-22308,
-23507,
-23142,
-23687,
-31789,
-42690,
-46416,
-45251,
-45507,
-45996,
-45728,
-45890,
-44992,
-44147,
-44939,
-41193,
-30373,
-22301,
-21961,
-22771,
-21980,
-22029,
-22090,
-22232,
-23526,
-23333,
-23684,
-31356,
-42219,
-46146,
-44930,
-45093,
-45633,
-45310,
-45401,
-44554,
-43631,
-44373,
-40948,
-30384,
-22179,
-21775,
-22767,
-22010,
-21997,
-22077,
-22172,
-23394,
-23242,
-23424,
-30750,
-41598,
-45762,
-44526,
-44544,
-45096,
-44791,
-44910,
-44163,
-43256,
-44049,
-40916,
-30540,
-22124,
-21509,
-22508,
-21781,
-21766,
-21913,
-22019,
-23279,
-23194,
-23216,
-30244,
-41090,
-45451,
-44227,
-44206,
-44781,
-44492,
-44627,
-43922,
-42937,
-43756,
-40943,
-30758,
-22169,
-21453,
-22545,
-21859,
-21834,
-21940,
-21877,
-23028,
-22965,
-22792,
-29492,
-40413,
-45073,
-43967,
-43964,
-44603,
-44285,
-44436,
-43849,
-42869,
-43709,
-41186,
-31171,
-22354,
-21415,
-22512,
-21780,
-21699,
-21843,
-21769,
-22910,
-22942,
-22644,
-29063,
-40003,
-44929,
-43879,
-43793,
-44427,
-44116,
-44287,
-43789,
-42798,
-43672,
-41410,
-31558,
-22536,
-21364,
-22444,
-21737,
-21642,
-21768,
-21594,
-22692,
-22740,
-22264,
-28404,
-39409,
-44638,
-43761,
-43724,
-44373,
-44047,
-44280,
-43886,
-42836,
-43703,
-41700,
-31963,
-22708,
-21314,
-22328,
-21549,
-21491,
-21682,
-21445,
-22519,
-22670,
-22047,
-27902,
-39004,
-44501,
-43665,
-43595,
-44293,
-43894,
-44126,
-43835,
-42733,
-43573,
-41908,
-32397,
-22873,
-21257,
-22313,
-21541,
-21473,
-21747,
-21424,
-22394,
-22656,
-21957,
-27481,
-38596,
-44481,
-43769,
-43674,
-44424,
-43962,
-44104,
-43883,
-42771,
-43512,
-42054,
-32763,
-23014,
-21095,
-22168,
-21410,
-21311,
-21684,
-21409,
-22341,
-22698,
-21957,
-27194,
-38278,
-44461,
-43855,
-43669,
-44416,
-43954,
-44025,
-43858,
-42726,
-43418,
-42182,
-33117,
-23160,
-20966,
-22060,
-21372,
-21284,
-21726,
-21430,
-22296,
-22735,
-21936,
-26836,
-37879,
-44385,
-43937,
-43707,
-44492,
-43976,
-43949,
-43842,
-42688,
-43276,
-42237,
-33448,
-23300,
-20838,
-21985,
-21325,
-21175,
-21699,
-21446,
-22257,
-22812,
-22036,
-26607,
-37558,
-44389,
-44051,
-43651,
-44425,
-43905,
-43792,
-43743,
-42661,
-43143,
-42274,
-33797,
-23518,
-20722,
-21882,
-21319,
-21098,
-21675,
-21504,
-22243,
-22820,
-22047,
-26333,
-37148,
-44285,
-44148,
-43645,
-44434,
-44010,
-43854,
-43795,
-42708,
-43114,
-42386,
-34202,
-23835,
-20742,
-21903,
-21467,
-21218,
-21769,
-21571,
-22249,
-22874,
-22099,
-26102,
-36765,
-44158,
-44181,
-43609,
-44353,
-43921,
-43698,
-43694,
-42625,
-42960,
-42379,
-34472,
-23992,
-20637,
-21822,
-21419,
-21093,
-21684,
-21538,
-22184,
-22899,
-22133,
-25812,
-36356,
-44068,
-44255,
-43547,
-44349,
-44019,
-43798,
-43879,
-42853,
-43027,
-42576,
-35010,
-24425,
-20707,
-21875,
-21559,
-21124,
-21706,
-21584,
-22075,
-22814,
-22118,
-25537,
-35884,
-43883,
-44270,
-43451,
-44253,
-44032,
-43730,
-43817,
-42862,
-42972,
-42626,
-35393,
-24787,
-20758,
-21915,
-21709,
-21174,
-21714,
-21633,
-22088,
-22844,
-22202,
-25375,
-35533,
-43767,
-44329,
-43390,
-44183,
-44069,
-43783,
-43902,
-42998,
-43035,
-42809,
-35865,
-25162,
-20790,
-21899,
-21787,
-21192,
-21697,
-21634,
-22008,
-22830,
-22246,
-25136,
-35087,
-43571,
-44352,
-43329,
-44127,
-44056,
-43674,
-43794,
-42932,
-42844,
-42671,
-36042,
-25337,
-20700,
-21853,
-21873,
-21166,
-21646,
-21669,
-21982,
-22798,
-22262,
-24913,
-34681,
-43465,
-44504,
-43357,
-44111,
-44193,
-43801,
-43904,
-43072,
-42898,
-42761,
-36438,
-25731,
-20710,
-21728,
-21847,
-21104,
-21533,
-21620,
-21931,
-22742,
-22271,
-24761,
-34329,
-43275,
-44539,
-43347,
-44054,
-44224,
-43846,
-43892,
-43061,
-42859,
-42841,
-36759,
-26045,
-20761,
-21694,
-21920,
-21178,
-21549,
-21602,
-21877,
-22735,
-22253,
-24511,
-33928,
-43073,
-44588,
-43409,
-44120,
-44313,
-43900,
-43964,
-43129,
-42861,
-42963,
-37145,
-26372,
-20813,
-21677,
-21932,
-21106,
-21450,
-21531,
-21789,
-22727,
-22266,
-24257,
-33485,
-42891,
-44629,
-43405,
-44090,
-44342,
-43916,
-44002,
-43180,
-42799,
-42993,
-37476,
-26715,
-20841,
-21585,
-21901,
-21054,
-21405,
-21525,
-21740,
-22666,
-22222,
-23986,
-33030,
-42611,
-44610,
-43402,
-44102,
-44437,
-44002,
-44069,
-43257,
-42867,
-43204,
-37957,
-27162,
-20973,
-21565,
-21901,
-21013,
-21307,
-21423,
-21648,
-22677,
-22271,
-23801,
-32671,
-42465,
-44724,
-43533,
-44213,
-44530,
-44063,
-44159,
-43353,
-42869,
-43310,
-38362,
-27549,
-21065,
-21539,
-21884,
-20947,
-21265,
-21406,
-21545,
-22598,
-22211,
-23472,
-32103,
-42121,
-44657,
-43510,
-44236,
-44648,
-44118,
-44199,
-43448,
-42871,
-43357,
-38705,
-27915,
-21108,
-21464,
-21886,
-20876,
-21152,
-21385,
-21554,
-22627,
-22316,
-23370,
-31752,
-41959,
-44816,
-43625,
-44237,
-44686,
-44157,
-44207,
-43469,
-42840,
-43372,
-39010,
-28343,
-21229,
-21343,
-21809,
-20820,
-21083,
-21361,
-21542,
-22617,
-22326,
-23220,
-31387,
-41677,
-44805,
-43681,
-44278,
-44785,
-44268,
-44277,
-43486,
-42803,
-43403,
-39292,
-28656,
-21292,
-21264,
-21792,
-20841,
-21074,
-21354,
-21533,
-22677,
-22437,
-23108,
-31032,
-41454,
-44853,
-43747,
-44280,
-44772,
-44226,
-44231,
-43461,
-42691,
-43333,
-39536,
-29020,
-21391,
-21201,
-21777,
-20818,
-21030,
-21363,
-21530,
-22694,
-22527,
-23036,
-30659,
-41172,
-44824,
-43731,
-44174,
-44730,
-44207,
-44179,
-43438,
-42613,
-43277,
-39754,
-29393,
-21529,
-21150,
-21824,
-20913,
-21076,
-21408,
-21578,
-22745,
-22631,
-23002,
-30366,
-40917,
-44838,
-43798,
-44148,
-44715,
-44196,
-44150,
-43390,
-42511,
-43220,
-39960,
-29730,
-21665,
-21124,
-21863,
-20992,
-21111,
-21416,
-21556,
-22771,
-22736,
-22904,
-29968,
-40570,
-44742,
-43735,
-44028,
-44613,
-44120,
-44145,
-43473,
-42515,
-43202,
-40234,
-30151,
-21857,
-21150,
-21947,
-21051,
-21127,
-21465,
-21539,
-22717,
-22775,
-22829,
-29582,
-40267,
-44721,
-43700,
-43891,
-44554,
-44077,
-44058,
-43449,
-42451,
-43107,
-40432,
-30578,
-22039,
-21132,
-22076,
-21209,
-21173,
-21481,
-21518,
-22634,
-22775,
-22731,
-29150,
-39814,
-44606,
-43671,
-43738,
-44453,
-44069,
-44074,
-43549,
-42544,
-43139,
-40651,
-31009,
-22282,
-21142,
-22124,
-21327,
-21215,
-21520,
-21538,
-22629,
-22799,
-22670,
-28835,
-39499,
-44551,
-43673,
-43639,
-44375,
-44057,
-44083,
-43589,
-42539,
-43127,
-40886,
-31427,
-22494,
-21151,
-22191,
-21439,
-21256,
-21530,
-21476,
-22543,
-22806,
-22572,
-28429,
-39110,
-44454,
-43635,
-43505,
-44272,
-43999,
-44059,
-43670,
-42588,
-43101,
-41099,
-31861,
-22740,
-21141,
-22254,
-21538,
-21325,
-21627,
-21546,
-22532,
-22868,
-22603,
-28195,
-38851,
-44475,
-43725,
-43483,
-44284,
-44032,
-44045,
-43658,
-42570,
-43052,
-41259,
-32216,
-22903,
-21081,
-22254,
-21643,
-21380,
-21643,
-21542,
-22523,
-22934,
-22571,
-27873,
-38505,
-44395,
-43772,
-43450,
-44215,
-43972,
-44023,
-43718,
-42583,
-43036,
-41455,
-32596,
-23104,
-21077,
-22241,
-21649,
-21393,
-21695,
-21543,
-22493,
-23003,
-22547,
-27572,
-38236,
-44403,
-43830,
-43443,
-44210,
-43896,
-43905,
-43672,
-42483,
-42864,
-41547,
-32927,
-23238,
-20997,
-22229,
-21645,
-21365,
-21753,
-21563,
-22415,
-22999,
-22482,
-27181,
-37824,
-44303,
-43817,
-43342,
-44193,
-43913,
-43879,
-43722,
-42566,
-42880,
-41793,
-33424,
-23520,
-20973,
-22239,
-21739,
-21416,
-21849,
-21663,
-22455,
-23114,
-22571,
-26962,
-37492,
-44244,
-43903,
-43354,
-44169,
-43864,
-43749,
-43650,
-42532,
-42838,
-41929,
-33807,
-23799,
-21026,
-22289,
-21804,
-21435,
-21897,
-21734,
-22482,
-23151,
-22513,
-26630,
-37135,
-44176,
-43960,
-43341,
-44170,
-43891,
-43755,
-43702,
-42563,
-42823,
-42146,
-34273,
-24084,
-21002,
-22236,
-21813,
-21450,
-21973,
-21799,
-22456,
-23193,
-22523,
-26339,
-36717,
-44018,
-43988,
-43337,
-44207,
-43915,
-43690,
-43666,
-42599,
-42820,
-42296,
-34656,
-24361,
-21001,
-22236,
-21865,
-21418,
-21938,
-21813,
-22438,
-23155,
-22428,
-25970,
-36250,
-43842,
-44033,
-43321,
-44155,
-43925,
-43692,
-43680,
-42633,
-42852,
-42493,
-35103,
-24733,
-21071,
-22184,
-21864,
-21397,
-21901,
-21776,
-22381,
-23115,
-22340,
-25654,
-35839,
-43648,
-44042,
-43329,
-44133,
-43892,
-43636,
-43642,
-42596,
-42808,
-42612,
-35452,
-25000,
-21103,
-22163,
-21853,
-21362,
-21878,
-21762,
-22321,
-23076,
-22246,
-25289,
-35390,
-43455,
-44022,
-43279,
-44108,
-43939,
-43667,
-43733,
-42704,
-42864,
-42822,
-35928,
-25372,
-21149,
-22148,
-21901,
-21370,
-21890,
-21806,
-22288,
-23073,
-22246,
-25043,
-34955,
-43243,
-44019,
-43220,
-44050,
-43925,
-43617,
-43675,
-42733,
-42872,
-42938,
-36309,
-25724,
-21244,
-22191,
-22037,
-21430,
-21911,
-21852,
-22304,
-23049,
-22189,
-24752,
-34513,
-43031,
-44022,
-43155,
-43930,
-43877,
-43578,
-43647,
-42745,
-42851,
-43059,
-36701,
-26117,
-21334,
-22215,
-22135,
-21511,
-21971,
-21925,
-22314,
-23060,
-22206,
-24535,
-34117,
-42824,
-44009,
-43058,
-43812,
-43832,
-43500,
-43593,
-42735,
-42815,
-43123,
-37075,
-26456,
-21389,
-22222,
-22279,
-21618,
-22036,
-22017,
-22303,
-23025,
-22196,
-24295,
-33639,
-42545,
-43965,
-42950,
-43683,
-43788,
-43425,
-43504,
-42764,
-42847,
-43237,
-37442,
-26839,
-21476,
-22264,
-22456,
-21718,
-22040,
-22051,
-22334,
-23034,
-22207,
-24084,
-33214,
-42334,
-44032,
-42945,
-43559,
-43721,
-43396,
-43512,
-42820,
-42860,
-43288,
-37777,
-27224,
-21588,
-22240,
-22496,
-21750,
-22046,
-22077,
-22280,
-22923,
-22091,
-23776,
-32742,
-42045,
-43964,
-42844,
-43461,
-43741,
-43450,
-43583,
-42954,
-42976,
-43527,
-38308,
-27729,
-21765,
-22315,
-22672,
-21895,
-22122,
-22149,
-22256,
-22900,
-22107,
-23565,
-32298,
-41799,
-43996,
-42841,
-43409,
-43749,
-43412,
-43553,
-42997,
-42976,
-43572,
-38627,
-28082,
-21799,
-22244,
-22707,
-21866,
-22052,
-22106,
-22184,
-22799,
-22051,
-23323,
-31847,
-41570,
-44067,
-42893,
-43390,
-43822,
-43488,
-43639,
-43143,
-43085,
-43738,
-39065,
-28536,
-21899,
-22165,
-22679,
-21823,
-21951,
-22036,
-22095,
-22720,
-22041,
-23133,
-31453,
-41366,
-44165,
-42988,
-43431,
-43893,
-43549,
-43678,
-43221,
-43081,
-43765,
-39335,
-28825,
-21867,
-21973,
-22561,
-21698,
-21804,
-21955,
-21963,
-22578,
-21921,
-22828,
-30937,
-41061,
-44185,
-43010,
-43426,
-43980,
-43640,
-43739,
-43300,
-43092,
-43821,
-39681,
-29217,
-21893,
-21814,
-22517,
-21684,
-21771,
-21957,
-21957,
-22598,
-22051,
-22803,
-30652,
-40913,
-44365,
-43223,
-43540,
-44085,
-43677,
-43731,
-43318,
-43083,
-43805,
-39902,
-29503,
-21899,
-21624,
-22391,
-21556,
-21603,
-21862,
-21899,
-22552,
-22027,
-22611,
-30248,
-40676,
-44440,
-43318,
-43519,
-44101,
-43703,
-43726,
-43291,
-42987,
-43766,
-40155,
-29853,
-21944,
-21458,
-22300,
-21534,
-21579,
-21856,
-21877,
-22559,
-22093,
-22520,
-29886,
-40416,
-44482,
-43417,
-43552,
-44113,
-43682,
-43663,
-43253,
-42897,
-43705,
-40353,
-30159,
-22004,
-21362,
-22284,
-21575,
-21615,
-21955,
-21987,
-22669,
-22232,
-22450,
-29555,
-40188,
-44558,
-43528,
-43557,
-44129,
-43697,
-43663,
-43252,
-42830,
-43675,
-40609,
-30565,
-22137,
-21265,
-22244,
-21579,
-21611,
-21961,
-21981,
-22673,
-22305,
-22384,
-29229,
-39935,
-44590,
-43607,
-43542,
-44087,
-43648,
-43584,
-43202,
-42748,
-43645,
-40870,
-30951,
-22283,
-21193,
-22225,
-21604,
-21624,
-21993,
-21997,
-22717,
-22388,
-22302,
-28856,
-39632,
-44575,
-43667,
-43528,
-44094,
-43673,
-43628,
-43288,
-42766,
-43693,
-41194,
-31424,
-22510,
-21201,
-22280,
-21721,
-21732,
-22102,
-22047,
-22757,
-22496,
-22262,
-28527,
-39351,
-44572,
-43771,
-43560,
-44123,
-43659,
-43582,
-43256,
-42686,
-43604,
-41345,
-31710,
-22576,
-21077,
-22209,
-21681,
-21658,
-22030,
-21979,
-22719,
-22528,
-22139,
-28131,
-39016,
-44575,
-43849,
-43559,
-44090,
-43646,
-43603,
-43318,
-42668,
-43553,
-41549,
-32077,
-22724,
-20963,
-22078,
-21580,
-21565,
-21957,
-21889,
-22634,
-22552,
-22068,
-27833,
-38768,
-44614,
-43985,
-43621,
-44146,
-43682,
-43639,
-43371,
-42632,
-43479,
-41690,
-32366,
-22791,
-20792,
-21918,
-21465,
-21457,
-21890,
-21797,
-22564,
-22573,
-21993,
-27503,
-38483,
-44612,
-44074,
-43660,
-44197,
-43769,
-43747,
-43510,
-42677,
-43477,
-41929,
-32761,
-22948,
-20677,
-21797,
-21398,
-21396,
-21818,
-21666,
-22434,
-22572,
-21936,
-27188,
-38169,
-44576,
-44161,
-43708,
-44230,
-43778,
-43748,
-43550,
-42674,
-43451,
-42125,
-33161,
-23161,
-20691,
-21837,
-21508,
-21495,
-21906,
-21702,
-22469,
-22688,
-21959,
-26897,
-37849,
-44527,
-44246,
-43736,
-44231,
-43780,
-43755,
-43626,
-42686,
-43404,
-42264,
-33488,
-23335,
-20639,
-21822,
-21551,
-21533,
-21940,
-21718,
-22456,
-22763,
-21936,
-26587,
-37515,
-44480,
-44325,
-43718,
-44172,
-43716,
-43718,
-43640,
-42668,
-43314,
-42385,
-33847,
-23562,
-20609,
-21770,
-21544,
-21506,
-21916,
-21665,
-22370,
-22757,
-21890,
-26283,
-37149,
-44379,
-44344,
-43657,
-44107,
-43703,
-43757,
-43767,
-42803,
-43392,
-42668,
-34373,
-23955,
-20723,
-21860,
-21697,
-21633,
-22040,
-21721,
-22348,
-22765,
-21867,
-25978,
-36772,
-44255,
-44383,
-43639,
-44110,
-43749,
-43777,
-43812,
-42813,
-43336,
-42776,
-34723,
-24162,
-20662,
-21813,
-21748,
-21625,
-21976,
-21605,
-22182,
-22688,
-21774,
-25606,
-36287,
-44076,
-44396,
-43582,
-44029,
-43716,
-43793,
-43937,
-42986,
-43425,
-43004,
-35196,
-24505,
-20659,
-21732,
-21684,
-21497,
-21840,
-21467,
-21987,
-22569,
-21680,
-25273,
-35866,
-43944,
-44469,
-43601,
-44067,
-43836,
-43895,
-44083,
-43116,
-43453,
-43149,
-35604,
-24791,
-20642,
-21691,
-21738,
-21486,
-21787,
-21368,
-21799,
-22423,
-21561,
-24875,
-35357,
-43741,
-44498,
-43564,
-44007,
-43813,
-43850,
-44092,
-43154,
-43390,
-43210,
-35955,
-25059,
-20577,
-21575,
-21693,
-21399,
-21724,
-21348,
-21742,
-22473,
-21691,
-24788,
-35120,
-43784,
-44737,
-43708,
-44121,
-43953,
-43929,
-44186,
-43252,
-43351,
-43230,
-36239,
-25233,
-20417,
-21379,
-21612,
-21300,
-21651,
-21312,
-21647,
-22439,
-21718,
-24566,
-34741,
-43692,
-44906,
-43811,
-44216,
-44072,
-43993,
-44265,
-43350,
-43327,
-43280,
-36562,
-25492,
-20331,
-21252,
-21562,
-21224,
-21576,
-21292,
-21579,
-22444,
-21792,
-24387,
-34387,
-43609,
-45044,
-43855,
-44197,
-44068,
-43935,
-44231,
-43351,
-43211,
-43253,
-36848,
-25731,
-20257,
-21112,
-21543,
-21198,
-21610,
-21382,
-21635,
-22546,
-21953,
-24283,
-34078,
-43546,
-45217,
-43962,
-44257,
-44143,
-43950,
-44260,
-43402,
-43146,
-43275,
-37187,
-26054,
-20247,
-21000,
-21494,
-21122,
-21554,
-21360,
-21542,
-22496,
-21967,
-24069,
-33680,
-43397,
-45308,
-44025,
-44277,
-44207,
-43939,
-44252,
-43411,
-43069,
-43318,
-37550,
-26395,
-20250,
-20913,
-21486,
-21102,
-21513,
-21325,
-21423,
-22415,
-21911,
-23728,
-33097,
-43030,
-45231,
-43943,
-44192,
-44151,
-43889,
-44261,
-43490,
-43079,
-43437,
-38007,
-26877,
-20424,
-20949,
-21573,
-21178,
-21595,
-21407,
-21422,
-22429,
-21979,
-23565,
-32700,
-42813,
-45262,
-44001,
-44237,
-44230,
-43902,
-44282,
-43554,
-43094,
-43547,
-38388,
-27247,
-20494,
-20923,
-21626,
-21199,
-21577,
-21401,
-21389,
-22467,
-22025,
-23330,
-32211,
-42542,
-45326,
-44091,
-44280,
-44296,
-43993,
-44455,
-43767,
-43193,
-43676,
-38827,
-27737,
-20697,
-20918,
-21625,
-21170,
-21568,
-21424,
-21369,
-22454,
-22069,
-23184,
-31875,
-42393,
-45450,
-44228,
-44380,
-44430,
-44095,
-44518,
-43794,
-43100,
-43658,
-39087,
-28035,
-20633,
-20655,
-21396,
-20954,
-21331,
-21191,
-21122,
-22272,
-21996,
-22902,
-31359,
-42037,
-45443,
-44302,
-44439,
-44514,
-44183,
-44640,
-43945,
-43177,
-43757,
-39483,
-28492,
-20763,
-20535,
-21241,
-20769,
-21126,
-21020,
-20917,
-22103,
-21899,
-22662,
-30897,
-41738,
-45442,
-44365,
-44466,
-44584,
-44212,
-44606,
-43881,
-43018,
-43670,
-39710,
-28822,
-20804,
-20385,
-21190,
-20761,
-21097,
-20981,
-20825,
-22045,
-21929,
-22502,
-30433,
-41357,
-45397,
-44424,
-44505,
-44632,
-44238,
-44627,
-43979,
-43097,
-43774,
-40073,
-29282,
-20988,
-20382,
-21219,
-20777,
-21059,
-20993,
-20890,
-22167,
-22124,
-22511,
-30148,
-41195,
-45542,
-44571,
-44509,
-44636,
-44271,
-44697,
-44095,
-43136,
-43823,
-40428,
-29785,
-21220,
-20383,
-21309,
-20930,
-21223,
-21190,
-21034,
-22274,
-22257,
-22442,
-29744,
-40841,
-45474,
-44528,
-44364,
-44509,
-44170,
-44590,
-44036,
-43018,
-43725,
-40670,
-30232,
-21416,
-20363,
-21370,
-21051,
-21311,
-21254,
-21011,
-22210,
-22302,
-22355,
-29334,
-40451,
-45416,
-44571,
-44352,
-44513,
-44131,
-44542,
-44069,
-43021,
-43690,
-40888,
-30654,
-21612,
-20352,
-21375,
-21049,
-21265,
-21292,
-21051,
-22230,
-22370,
-22265,
-28885,
-40002,
-45246,
-44455,
-44202,
-44456,
-44128,
-44526,
-44103,
-43004,
-43673,
-41212,
-31256,
-22036,
-20538,
-21570,
-21181,
-21292,
-21300,
-21010,
-22130,
-22367,
-22157,
-28443,
-39558,
-45089,
-44438,
-44193,
-44613,
-44314,
-44659,
-44240,
-43068,
-43688,
-41506,
-31768,
-22316,
-20543,
-21566,
-21106,
-21101,
-21138,
-20866,
-22027,
-22398,
-22088,
-27970,
-39019,
-44847,
-44330,
-44130,
-44686,
-44457,
-44777,
-44408,
-43173,
-43722,
-41809,
-32338,
-22690,
-20658,
-21662,
-21132,
-20978,
-21002,
-20702,
-21845,
-22344,
-21922,
-27441,
-38467,
-44680,
-44340,
-44112,
-44725,
-44510,
-44842,
-44558,
-43279,
-43736,
-42131,
-33001,
-23168,
-20785,
-21657,
-21067,
-20869,
-20944,
-20589,
-21628,
-22251,
-21822,
-27024,
-37974,
-44497,
-44368,
-44205,
-44898,
-44639,
-44876,
-44685,
-43401,
-43737,
-42294,
-33382,
-23380,
-20731,
-21590,
-21023,
-20857,
-21111,
-20759,
-21701,
-22333,
-21827,
-26683,
-37538,
-44330,
-44331,
-44129,
-44834,
-44489,
-44618,
-44514,
-43272,
-43592,
-42401,
-33806,
-23675,
-20746,
-21563,
-20965,
-20772,
-21098,
-20736,
-21580,
-22301,
-21795,
-26358,
-37145,
-44216,
-44371,
-44168,
-44912,
-44553,
-44608,
-44570,
-43313,
-43511,
-42471,
-34106,
-23829,
-20657,
-21495,
-20966,
-20778,
-21194,
-20859,
-21680,
-22524,
-22003,
-26233,
-36861,
-44149,
-44392,
-44051,
-44750,
-44342,
-44375,
-44408,
-43139,
-43228,
-42435,
-34495,
-24264,
-20920,
-21776,
-21275,
-21040,
-21409,
-20963,
-21607,
-22503,
-21945,
-25807,
-36183,
-43602,
-43955,
-43632,
-44499,
-44342,
-44588,
-44849,
-43630,
-43589,
-42914,
-35197,
-24757,
-20995,
-21719,
-21249,
-20954,
-21215,
-20556,
-20993,
-21899,
-21174,
-24351,
-34042,
-41265,
-41566,
-41046,
-41705,
-41356,
-41549,
-42068,
-41112,
-41189,
-40902,
-33947,
-24103,
-20677,
-21706,
-21419,
-21218,
-21679,
-21168,
-21578,
-22481,
-21772,
-24738,
-34341,
-41773,
-42175,
-41547,
-42162,
-41786,
-41823,
-42196,
-41121,
-41086,
-41048,
-34515,
-24722,
-21011,
-21934,
-21700,
-21520,
-22081,
-21653,
-22067,
-23068,
-22365,
-24989,
-34249,
-41765,
-42356,
-41773,
-42440,
-42054,
-41923,
-42223,
-41149,
-41120,
-41300,
-35175,
-25459,
-21568,
-22439,
-22222,
-21939,
-22493,
-22142,
-22552,
-23526,
-22680,
-24864,
-33836,
-41531,
-42374,
-41785,
-42488,
-42170,
-42020,
-42313,
-41261,
-41244,
-41681,
-35992,
-26327,
-22082,
-22769,
-22493,
-22119,
-22652,
-22367,
-22788,
-23832,
-22996,
-24861,
-33551,
-41413,
-42482,
-41896,
-42595,
-42352,
-42175,
-42483,
-41422,
-41309,
-41832,
-36484,
-26833,
-22296,
-22858,
-22669,
-22286,
-22829,
-22516,
-22823,
-23876,
-23112,
-24762,
-33213,
-41237,
-42564,
-41988,
-42664,
-42396,
-42147,
-42515,
-41605,
-41436,
-41985,
-36868,
-27276,
-22528,
-23019,
-22818,
-22342,
-22864,
-22587,
-22748,
-23713,
-23005,
-24574,
-32977,
-41217,
-42725,
-42091,
-42811,
-42668,
-42407,
-42801,
-41981,
-41771,
-42318,
-37313,
-27573,
-22509,
-22954,
-22887,
-22383,
-22902,
-22660,
-22754,
-23701,
-23038,
-24456,
-32728,
-41196,
-42899,
-42177,
-42827,
-42709,
-42383,
-42781,
-42035,
-41782,
-42382,
-37612,
-27864,
-22541,
-22949,
-22969,
-22426,
-22936,
-22738,
-22768,
-23707,
-23098,
-24350,
-32469,
-41140,
-43050,
-42264,
-42903,
-42820,
-42444,
-42826,
-42117,
-41800,
-42441,
-37904,
-28117,
-22476,
-22780,
-22840,
-22246,
-22741,
-22616,
-22639,
-23646,
-23119,
-24164,
-32070,
-40932,
-43094,
-42307,
-42914,
-42859,
-42429,
-42809,
-42126,
-41670,
-42343,
-38133,
-28467,
-22623,
-22824,
-22937,
-22357,
-22938,
-22879,
-22813,
-23786,
-23329,
-24186,
-31815,
-40704,
-43003,
-42210,
-42838,
-42804,
-42252,
-42599,
-42006,
-41538,
-42254,
-38243,
-28604,
-22549,
-22714,
-22886,
-22252,
-22847,
-22890,
-22803,
-23758,
-23294,
-23963,
-31442,
-40554,
-43099,
-42290,
-42882,
-42883,
-42257,
-42572,
-41983,
-41466,
-42249,
-38518,
-28893,
-22587,
-22667,
-22957,
-22365,
-22998,
-23081,
-22925,
-23832,
-23374,
-23829,
-31120,
-40413,
-43210,
-42375,
-42880,
-42854,
-42163,
-42487,
-42013,
-41507,
-42411,
-38931,
-29307,
-22645,
-22548,
-22882,
-22298,
-22943,
-23066,
-22853,
-23752,
-23313,
-23566,
-30634,
-40113,
-43223,
-42419,
-42867,
-42834,
-42125,
-42497,
-42121,
-41590,
-42543,
-39348,
-29789,
-22849,
-22557,
-22923,
-22348,
-23005,
-23161,
-22875,
-23739,
-23326,
-23380,
-30178,
-39753,
-43139,
-42383,
-42804,
-42802,
-42080,
-42467,
-42127,
-41517,
-42456,
-39543,
-30132,
-22989,
-22514,
-22891,
-22284,
-22929,
-23140,
-22830,
-23725,
-23436,
-23408,
-29956,
-39560,
-43135,
-42399,
-42834,
-42954,
-42253,
-42600,
-42257,
-41555,
-42465,
-39811,
-30532,
-23191,
-22575,
-22993,
-22303,
-22807,
-22985,
-22681,
-23651,
-23547,
-23431,
-29685,
-39317,
-43115,
-42438,
-42857,
-43102,
-42446,
-42779,
-42448,
-41597,
-42408,
-39953,
-30864,
-23358,
-22625,
-23092,
-22327,
-22700,
-22874,
-22566,
-23566,
-23592,
-23371,
-29338,
-38976,
-43032,
-42357,
-42721,
-43053,
-42449,
-42782,
-42472,
-41520,
-42249,
-40061,
-31193,
-23504,
-22582,
-23094,
-22335,
-22670,
-22928,
-22626,
-23619,
-23763,
-23472,
-29147,
-38797,
-43104,
-42463,
-42763,
-43146,
-42509,
-42756,
-42476,
-41514,
-42241,
-40335,
-31666,
-23733,
-22584,
-23152,
-22417,
-22724,
-23069,
-22772,
-23719,
-23902,
-23475,
-28810,
-38490,
-43148,
-42634,
-42882,
-43290,
-42580,
-42698,
-42445,
-41456,
-42169,
-40521,
-32066,
-23892,
-22499,
-23129,
-22440,
-22756,
-23227,
-22996,
-23908,
-24125,
-23527,
-28483,
-38167,
-43170,
-42740,
-42838,
-43210,
-42452,
-42512,
-42320,
-41306,
-41987,
-40677,
-32526,
-24138,
-22407,
-23038,
-22409,
-22767,
-23314,
-23026,
-23845,
-24172,
-23550,
-28172,
-37786,
-43101,
-42813,
-42861,
-43228,
-42423,
-42439,
-42365,
-41341,
-41885,
-40745,
-32848,
-24288,
-22299,
-22962,
-22423,
-22829,
-23469,
-23106,
-23791,
-24254,
-23698,
-28061,
-37571,
-43118,
-42933,
-42929,
-43287,
-42388,
-42332,
-42396,
-41432,
-41831,
-40772,
-33074,
-24412,
-22269,
-22997,
-22480,
-22827,
-23501,
-23066,
-23589,
-24102,
-23590,
-27749,
-37222,
-43012,
-42920,
-42846,
-43255,
-42348,
-42259,
-42477,
-41591,
-41881,
-40880,
-33322,
-24522,
-22180,
-22932,
-22400,
-22672,
-23438,
-23062,
-23514,
-24096,
-23622,
-27630,
-37110,
-43150,
-43098,
-42932,
-43378,
-42507,
-42329,
-42567,
-41668,
-41898,
-41009,
-33645,
-24655,
-22078,
-22848,
-22331,
-22503,
-23276,
-22927,
-23351,
-23991,
-23478,
-27207,
-36632,
-42983,
-43121,
-42940,
-43484,
-42699,
-42544,
-42810,
-41879,
-41968,
-41232,
-34115,
-24999,
-22084,
-22722,
-22150,
-22244,
-23053,
-22717,
-23112,
-23855,
-23407,
-26908,
-36210,
-42778,
-43107,
-42989,
-43635,
-42881,
-42627,
-42884,
-41950,
-41941,
-41331,
-34460,
-25319,
-22204,
-22786,
-22155,
-22112,
-22934,
-22634,
-22962,
-23738,
-23281,
-26571,
-35768,
-42529,
-43007,
-42910,
-43690,
-43037,
-42717,
-42997,
-42072,
-42011,
-41487,
-34801,
-25571,
-22245,
-22831,
-22180,
-22024,
-22842,
-22583,
-22887,
-23692,
-23289,
-26416,
-35580,
-42545,
-43096,
-42890,
-43691,
-43095,
-42746,
-43033,
-42154,
-42016,
-41563,
-35007,
-25627,
-22092,
-22733,
-22192,
-21970,
-22775,
-22520,
-22769,
-23609,
-23217,
-26199,
-35367,
-42642,
-43317,
-42960,
-43701,
-43152,
-42827,
-43187,
-42305,
-42088,
-41706,
-35321,
-25746,
-21857,
-22469,
-22075,
-21922,
-22758,
-22436,
-22569,
-23460,
-23176,
-26021,
-35145,
-42702,
-43585,
-43174,
-43838,
-43201,
-42804,
-43256,
-42484,
-42189,
-41825,
-35563,
-25859,
-21713,
-22312,
-22002,
-21890,
-22798,
-22498,
-22480,
-23362,
-23108,
-25826,
-34890,
-42688,
-43756,
-43318,
-43973,
-43292,
-42789,
-43302,
-42630,
-42280,
-41914,
-35768,
-25965,
-21583,
-22122,
-21813,
-21667,
-22675,
-22480,
-22409,
-23280,
-23080,
-25693,
-34710,
-42688,
-43875,
-43403,
-44072,
-43389,
-42761,
-43252,
-42636,
-42246,
-41921,
-35897,
-26024,
-21483,
-22028,
-21739,
-21513,
-22538,
-22421,
-22330,
-23213,
-22993,
-25443,
-34409,
-42585,
-43865,
-43316,
-44005,
-43414,
-42811,
-43327,
-42683,
-42213,
-41985,
-36191,
-26253,
-21495,
-22020,
-21795,
-21541,
-22562,
-22417,
-22292,
-23271,
-23125,
-25384,
-34220,
-42551,
-43946,
-43314,
-43968,
-43378,
-42751,
-43307,
-42669,
-42078,
-41910,
-36357,
-26410,
-21470,
-22001,
-21876,
-21630,
-22675,
-22527,
-22326,
-23341,
-23263,
-25307,
-33942,
-42380,
-43901,
-43209,
-43838,
-43259,
-42589,
-43178,
-42584,
-41907,
-41819,
-36540,
-26672,
-21526,
-21958,
-21846,
-21579,
-22683,
-22611,
-22372,
-23413,
-23375,
-25242,
-33658,
-42200,
-43935,
-43322,
-43975,
-43366,
-42509,
-43005,
-42427,
-41751,
-41756,
-36727,
-26887,
-21533,
-21874,
-21757,
-21480,
-22662,
-22743,
-22536,
-23575,
-23491,
-25114,
-33338,
-42030,
-43963,
-43346,
-44006,
-43416,
-42488,
-42948,
-42421,
-41747,
-41880,
-37116,
-27287,
-21681,
-21930,
-21821,
-21444,
-22590,
-22765,
-22577,
-23633,
-23539,
-24927,
-32953,
-41866,
-44047,
-43426,
-44093,
-43597,
-42614,
-42987,
-42427,
-41672,
-41876,
-37399,
-27612,
-21706,
-21842,
-21810,
-21400,
-22531,
-22785,
-22572,
-23571,
-23478,
-24668,
-32504,
-41604,
-44076,
-43408,
-44004,
-43570,
-42592,
-42983,
-42560,
-41816,
-42062,
-37806,
-28039,
-21823,
-21799,
-21874,
-21455,
-22557,
-22833,
-22510,
-23429,
-23386,
-24507,
-32172,
-41420,
-44102,
-43397,
-43952,
-43616,
-42638,
-43024,
-42682,
-41947,
-42215,
-38174,
-28429,
-21942,
-21843,
-22029,
-21558,
-22545,
-22820,
-22464,
-23349,
-23345,
-24262,
-31706,
-41132,
-44082,
-43298,
-43748,
-43499,
-42558,
-42945,
-42683,
-41914,
-42268,
-38547,
-28874,
-22051,
-21820,
-22161,
-21689,
-22592,
-22891,
-22505,
-23389,
-23426,
-24110,
-31229,
-40784,
-44050,
-43242,
-43620,
-43474,
-42563,
-42903,
-42627,
-41787,
-42171,
-38809,
-29313,
-22242,
-21874,
-22325,
-21841,
-22655,
-22971,
-22577,
-23467,
-23550,
-24045,
-30859,
-40487,
-43994,
-43163,
-43422,
-43292,
-42376,
-42740,
-42561,
-41725,
-42157,
-39049,
-29627,
-22326,
-21836,
-22402,
-21975,
-22815,
-23145,
-22652,
-23484,
-23628,
-23997,
-30626,
-40351,
-44022,
-43123,
-43321,
-43229,
-42291,
-42703,
-42598,
-41679,
-42071,
-39177,
-29799,
-22306,
-21816,
-22543,
-22100,
-22906,
-23225,
-22637,
-23467,
-23731,
-23932,
-30290,
-40155,
-44080,
-43125,
-43214,
-43121,
-42134,
-42607,
-42701,
-41771,
-42173,
-39555,
-30266,
-22410,
-21703,
-22518,
-22159,
-23029,
-23433,
-22665,
-23291,
-23565,
-23683,
-29845,
-39914,
-44225,
-43323,
-43256,
-43065,
-41964,
-42433,
-42748,
-41938,
-42325,
-39878,
-30664,
-22559,
-21631,
-22508,
-22197,
-23081,
-23538,
-22726,
-23245,
-23506,
-23501,
-29429,
-39483,
-44027,
-43231,
-43178,
-43067,
-41996,
-42465,
-42788,
-41971,
-42403,
-40189,
-31144,
-22901,
-21764,
-22541,
-22153,
-23014,
-23525,
-22753,
-23276,
-23495,
-23284,
-28974,
-39095,
-43880,
-43201,
-43217,
-43159,
-42039,
-42419,
-42685,
-41810,
-42359,
-40451,
-31535,
-23077,
-21788,
-22534,
-22070,
-22843,
-23383,
-22651,
-23287,
-23646,
-23289,
-28677,
-38799,
-43769,
-43125,
-43183,
-43305,
-42309,
-42699,
-42931,
-41828,
-42217,
-40538,
-31895,
-23366,
-21953,
-22682,
-22079,
-22674,
-23169,
-22407,
-23097,
-23691,
-23391,
-28531,
-38543,
-43648,
-43064,
-43150,
-43455,
-42528,
-42882,
-43102,
-41901,
-42168,
-40635,
-32185,
-23542,
-21937,
-22688,
-22042,
-22501,
-22949,
-22188,
-22964,
-23752,
-23450,
-28272,
-38182,
-43530,
-43081,
-43158,
-43498,
-42642,
-43024,
-43262,
-41900,
-41977,
-40654,
-32496,
-23741,
-21863,
-22555,
-21935,
-22404,
-22889,
-22097,
-22850,
-23807,
-23480,
-27969,
-37826,
-43533,
-43319,
-43351,
-43626,
-42616,
-42907,
-43274,
-41977,
-42005,
-40854,
-32894,
-23844,
-21589,
-22274,
-21783,
-22366,
-23066,
-22294,
-22836,
-23743,
-23384,
-27678,
-37592,
-43717,
-43646,
-43519,
-43716,
-42624,
-42755,
-43211,
-42068,
-42053,
-40978,
-33164,
-23935,
-21394,
-22166,
-21754,
-22296,
-23079,
-22432,
-22874,
-23731,
-23388,
-27514,
-37400,
-43807,
-43849,
-43605,
-43813,
-42747,
-42729,
-43129,
-42067,
-42090,
-41165,
-33508,
-24052,
-21181,
-21944,
-21679,
-22246,
-23138,
-22575,
-22977,
-23813,
-23380,
-27263,
-37124,
-43861,
-44059,
-43670,
-43786,
-42692,
-42649,
-43133,
-42090,
-42011,
-41194,
-33772,
-24204,
-21146,
-22021,
-21868,
-22359,
-23189,
-22527,
-22829,
-23836,
-23576,
-27246,
-36947,
-43839,
-44052,
-43531,
-43737,
-42760,
-42669,
-43181,
-42114,
-41813,
-41037,
-33949,
-24414,
-21182,
-22082,
-21881,
-22153,
-23033,
-22602,
-22948,
-23989,
-23747,
-27083,
-36492,
-43534,
-43926,
-43394,
-43765,
-42927,
-42650,
-42988,
-41959,
-41664,
-41047,
-34305,
-24847,
-21352,
-22164,
-21943,
-22068,
-22928,
-22635,
-22994,
-23955,
-23676,
-26820,
-36065,
-43263,
-43858,
-43311,
-43690,
-42919,
-42599,
-42896,
-41906,
-41684,
-41223,
-34713,
-25201,
-21472,
-22199,
-22039,
-22180,
-23062,
-22798,
-23107,
-24044,
-23601,
-26417,
-35545,
-42998,
-43773,
-43190,
-43520,
-42719,
-42391,
-42811,
-41904,
-41675,
-41449,
-35204,
-25544,
-21516,
-22272,
-22229,
-22401,
-23347,
-22993,
-23039,
-23901,
-23480,
-26077,
-35177,
-42934,
-43799,
-43032,
-43340,
-42551,
-42119,
-42681,
-42052,
-41841,
-41664,
-35581,
-25780,
-21509,
-22387,
-22453,
-22469,
-23468,
-23280,
-23158,
-23809,
-23333,
-25792,
-34802,
-42818,
-43786,
-42859,
-43241,
-42622,
-42028,
-42478,
-42033,
-41974,
-41878,
-35984,
-26106,
-21560,
-22445,
-22629,
-22506,
-23425,
-23334,
-23152,
-23686,
-23259,
-25650,
-34542,
-42711,
-43837,
-42777,
-43101,
-42604,
-42078,
-42611,
-42308,
-42167,
-41981,
-36247,
-26414,
-21630,
-22412,
-22655,
-22468,
-23313,
-23221,
-22968,
-23564,
-23263,
-25424,
-33921,
-42145,
-43605,
-42714,
-43185,
-42826,
-42238,
-42638,
-42226,
-41888,
-41783,
-36615,
-27124,
-22100,
-22581,
-22673,
-22276,
-23036,
-23113,
-23014,
-23728,
-23526,
-25405,
-33459,
-41729,
-43511,
-42698,
-43180,
-42993,
-42384,
-42614,
-42127,
-41770,
-41728,
-36826,
-27434,
-22119,
-22434,
-22662,
-22232,
-22823,
-22964,
-23061,
-23875,
-23669,
-25394,
-33251,
-41603,
-43646,
-42822,
-43213,
-43155,
-42717,
-42832,
-42092,
-41562,
-41560,
-36880,
-27599,
-22120,
-22250,
-22480,
-22075,
-22546,
-22571,
-22762,
-23800,
-23697,
-25261,
-32958,
-41431,
-43752,
-43091,
-43433,
-43249,
-42800,
-43033,
-42268,
-41603,
-41688,
-37260,
-27964,
-22146,
-22001,
-22167,
-21914,
-22614,
-22666,
-22692,
-23754,
-23740,
-25081,
-32590,
-41265,
-43895,
-43321,
-43644,
-43358,
-42730,
-42987,
-42320,
-41553,
-41636,
-37443,
-28130,
-21998,
-21765,
-22044,
-21779,
-22506,
-22684,
-22705,
-23727,
-23740,
-25007,
-32460,
-41485,
-44390,
-43683,
-43848,
-43648,
-42982,
-43077,
-42431,
-41796,
-42036,
-37897,
-28277,
-21595,
-21214,
-21745,
-21574,
-22239,
-22493,
-22618,
-23539,
-23329,
-24358,
-31845,
-41270,
-44594,
-43920,
-44010,
-43825,
-43147,
-43142,
-42472,
-41949,
-42368,
-38395,
-28697,
-21811,
-21342,
-21824,
-21489,
-22046,
-22340,
-22511,
-23440,
-23171,
-24048,
-31466,
-41048,
-44469,
-43756,
-43892,
-43829,
-43107,
-43074,
-42459,
-41960,
-42470,
-38705,
-28958,
-21811,
-21268,
-21822,
-21431,
-21973,
-22349,
-22475,
-23354,
-23105,
-23824,
-31063,
-40855,
-44575,
-43784,
-43806,
-43832,
-43255,
-43343,
-42807,
-42143,
-42513,
-38917,
-29313,
-21918,
-21234,
-21953,
-21641,
-22014,
-22161,
-22106,
-23010,
-23011,
-23786,
-30763,
-40454,
-44334,
-43612,
-43609,
-43747,
-43365,
-43586,
-43072,
-42274,
-42562,
-39197,
-29871,
-22474,
-21588,
-22159,
-21761,
-22104,
-22240,
-22150,
-23108,
-23196,
-23820,
-30470,
-40014,
-43997,
-43482,
-43677,
-43805,
-43213,
-43333,
-42881,
-42046,
-42365,
-39249,
-30097,
-22624,
-21655,
-22125,
-21590,
-22010,
-22318,
-22172,
-23086,
-23340,
-23902,
-30300,
-39900,
-44066,
-43521,
-43690,
-43886,
-43237,
-43371,
-43078,
-42135,
-42242,
-39328,
-30341,
-22532,
-21299,
-21902,
-21451,
-21854,
-22219,
-22042,
-22936,
-23381,
-23878,
-29852,
-39482,
-44264,
-43979,
-43962,
-44082,
-43435,
-43509,
-43214,
-42216,
-42254,
-39668,
-31047,
-22966,
-21191,
-21732,
-21442,
-21772,
-22086,
-21948,
-22846,
-23308,
-23748,
-29511,
-39101,
-44198,
-44084,
-43925,
-44005,
-43511,
-43649,
-43331,
-42395,
-42513,
-39941,
-31244,
-22987,
-21089,
-21697,
-21491,
-21817,
-22108,
-22007,
-22852,
-23098,
-23340,
-29154,
-39008,
-44238,
-44098,
-43937,
-44056,
-43465,
-43460,
-43103,
-42261,
-42636,
-40265,
-31458,
-22954,
-21031,
-21615,
-21229,
-21530,
-22004,
-21996,
-22825,
-23073,
-23201,
-28916,
-38916,
-44270,
-44052,
-43967,
-44296,
-43699,
-43637,
-43343,
-42437,
-42667,
-40403,
-31668,
-22989,
-20989,
-21700,
-21316,
-21543,
-21986,
-21804,
-22529,
-22942,
-23083,
-28491,
-38461,
-44171,
-44183,
-44071,
-44313,
-43613,
-43572,
-43462,
-42591,
-42813,
-40934,
-32605,
-23711,
-21151,
-21554,
-21150,
-21555,
-22205,
-22027,
-22667,
-23085,
-22986,
-27882,
-37697,
-43764,
-44085,
-44048,
-44255,
-43410,
-43273,
-43247,
-42395,
-42631,
-41021,
-32904,
-23813,
-21111,
-21692,
-21411,
-21759,
-22396,
-22151,
-22732,
-23255,
-23143,
-27789,
-37676,
-44038,
-44256,
-43913,
-44116,
-43381,
-43265,
-43334,
-42459,
-42520,
-41022,
-33116,
-23838,
-20886,
-21605,
-21421,
-21642,
-22306,
-22137,
-22608,
-23117,
-23037,
-27493,
-37319,
-44012,
-44423,
-43947,
-44190,
-43556,
-43336,
-43353,
-42638,
-42815,
-41471,
-33782,
-24372,
-21033,
-21654,
-21562,
-21672,
-22195,
-22055,
-22532,
-22916,
-22659,
-26877,
-36592,
-43487,
-44131,
-43644,
-43861,
-43478,
-43495,
-43479,
-42600,
-42807,
-41691,
-34197,
-24766,
-21294,
-21865,
-21843,
-21918,
-22151,
-21793,
-22451,
-23111,
-22728,
-26623,
-36245,
-43245,
-43996,
-43567,
-43752,
-43303,
-43463,
-43561,
-42522,
-42665,
-41904,
-34652,
-25076,
-21413,
-21858,
-21704,
-21866,
-22306,
-21883,
-22385,
-23090,
-22556,
-26066,
-35644,
-42931,
-43854,
-43616,
-43989,
-43389,
-43322,
-43585,
-42699,
-42799,
-42220,
-35322,
-25726,
-21839,
-22120,
-21666,
-21635,
-22310,
-22054,
-22371,
-22988,
-22487,
-25692,
-34951,
-42341,
-43483,
-43412,
-44058,
-43547,
-43293,
-43521,
-42798,
-42872,
-42380,
-35840,
-26340,
-22156,
-22250,
-21774,
-21646,
-22267,
-22000,
-22223,
-22873,
-22502,
-25576,
-34609,
-42134,
-43511,
-43401,
-43914,
-43452,
-43318,
-43675,
-42924,
-42803,
-42248,
-35877,
-26436,
-22119,
-22226,
-21862,
-21733,
-22242,
-21880,
-22093,
-22849,
-22496,
-25397,
-34372,
-42058,
-43468,
-43243,
-43831,
-43555,
-43489,
-43766,
-42871,
-42726,
-42449,
-36365,
-26789,
-22272,
-22435,
-22067,
-21657,
-21978,
-21650,
-21985,
-22854,
-22417,
-24974,
-33816,
-41698,
-43194,
-42920,
-43711,
-43715,
-43716,
-44013,
-43200,
-43076,
-42873,
-36868,
-27162,
-22499,
-22757,
-22458,
-21886,
-22108,
-21748,
-21937,
-22701,
-22272,
-24788,
-33576,
-41488,
-42975,
-42677,
-43571,
-43648,
-43559,
-43821,
-43021,
-42867,
-42732,
-36951,
-27437,
-22826,
-23043,
-22563,
-21869,
-22218,
-22029,
-22316,
-23143,
-22618,
-24750,
-33218,
-41144,
-42791,
-42650,
-43615,
-43502,
-43135,
-43335,
-42557,
-42427,
-42608,
-37300,
-27819,
-22906,
-22921,
-22363,
-21760,
-22400,
-22392,
-22552,
-23305,
-22661,
-24402,
-32675,
-40943,
-42914,
-42776,
-43736,
-43571,
-43001,
-43154,
-42529,
-42486,
-42918,
-37955,
-28316,
-22899,
-22775,
-22349,
-21644,
-22220,
-22342,
-22508,
-23174,
-22417,
-23889,
-32043,
-40744,
-43098,
-42788,
-43528,
-43500,
-43037,
-43198,
-42632,
-42607,
-43046,
-38191,
-28509,
-22814,
-22749,
-22727,
-22170,
-22552,
-22503,
-22582,
-23154,
-22397,
-23848,
-31971,
-40775,
-43198,
-42587,
-42942,
-42872,
-42671,
-43090,
-42660,
-42661,
-43142,
-38397,
-28739,
-22938,
-22892,
-23073,
-22690,
-23005,
-22677,
-22521,
-23135,
-22499,
-23828,
-31743,
-40475,
-42839,
-42166,
-42562,
-42621,
-42565,
-43165,
-42710,
-42462,
-42969,
-38603,
-29080,
-23186,
-23180,
-23426,
-22917,
-23100,
-22639,
-22339,
-23127,
-22748,
-23859,
-31423,
-40288,
-42856,
-42041,
-42371,
-42524,
-42526,
-43294,
-42987,
-42534,
-42861,
-38813,
-29487,
-23404,
-23380,
-23761,
-23069,
-23036,
-22561,
-22161,
-22895,
-22674,
-23659,
-30848,
-39776,
-42713,
-42012,
-42420,
-42827,
-42847,
-43495,
-43241,
-42856,
-43436,
-40210,
-31820,
-26037,
-25987,
-26381,
-25699,
-25740,
-25461,
-25017,
-25486,
-25110,
-25770,
-32190,
-40356,
-42910,
-42009,
-42338,
-42705,
-42554,
-42980,
-42673,
-42228,
-42686,
-39539,
-31334,
-25554,
-25416,
-25835,
-25167,
-25213,
-24990,
-24686,
-25409,
-25296,
-25849,
-31817,
-39765,
-42515,
-41801,
-42116,
-42391,
-42187,
-42621,
-42280,
-41585,
-41925,
-39107,
-31285,
-25410,
-24955,
-25311,
-24771,
-24958,
-24828,
-24550,
-25398,
-25511,
-25978,
-31479,
-39201,
-42167,
-41677,
-41986,
-42191,
-41862,
-42143,
-41783,
-41111,
-41473,
-38860,
-31297,
-25412,
-24874,
-25309,
-24847,
-24987,
-24953,
-24763,
-25453,
-25309,
-25609,
-31082,
-38938,
-42055,
-41417,
-41430,
-41657,
-41494,
-41825,
-41493,
-40987,
-41525,
-39056,
-31512,
-25457,
-24800,
-25330,
-24921,
-24971,
-24861,
-24638,
-25239,
-25047,
-25292,
-30655,
-38545,
-41883,
-41391,
-41484,
-41736,
-41477,
-41724,
-41530,
-41121,
-41608,
-39136,
-31592,
-25288,
-24375,
-24802,
-24310,
-24438,
-24558,
-24394,
-24920,
-24877,
-25218,
-30372,
-38204,
-41744,
-41350,
-41483,
-41852,
-41560,
-41688,
-41512,
-40965,
-41167,
-38866,
-31759,
-25510,
-24422,
-24821,
-24232,
-24207,
-24364,
-24247,
-24740,
-24804,
-25153,
-29957,
-37593,
-41376,
-41142,
-41224,
-41677,
-41475,
-41537,
-41334,
-40918,
-41261,
-39174,
-32171,
-25698,
-24343,
-24848,
-24441,
-24308,
-24348,
-24302,
-24881,
-24804,
-24869,
-29506,
-37309,
-41404,
-41274,
-41194,
-41562,
-41504,
-41638,
-41255,
-40674,
-41206,
-39367,
-32295,
-25496,
-23931,
-24478,
-24267,
-24266,
-24205,
-24065,
-24817,
-24909,
-24896,
-29521,
-37537,
-41771,
-41578,
-41373,
-41536,
-41325,
-41584,
-41325,
-40597,
-40977,
-39213,
-32110,
-25216,
-23732,
-24361,
-24148,
-24314,
-24463,
-24291,
-25011,
-25215,
-25089,
-29480,
-37524,
-41862,
-41561,
-41309,
-41502,
-41154,
-41290,
-41094,
-40286,
-40645,
-39192,
-32370,
-25338,
-23764,
-24524,
-24294,
-24342,
-24496,
-24325,
-25074,
-25408,
-25090,
-28967,
-36904,
-41599,
-41495,
-41249,
-41516,
-41179,
-41191,
-40865,
-39914,
-40321,
-39388,
-32981,
-25683,
-23557,
-24054,
-23799,
-23966,
-24381,
-24413,
-25300,
-25723,
-25188,
-28682,
-36630,
-41726,
-41910,
-41733,
-41884,
-41246,
-41076,
-40774,
-39779,
-40091,
-39232,
-32829,
-25409,
-23333,
-23928,
-23647,
-23934,
-24533,
-24496,
-25261,
-25818,
-25377,
-28845,
-36821,
-41724,
-41602,
-41506,
-41933,
-41257,
-41030,
-40861,
-39818,
-39993,
-39227,
-32899,
-25506,
-23677,
-24341,
-23691,
-23690,
-24310,
-24130,
-24848,
-25636,
-25278,
-28570,
-36524,
-41432,
-41266,
-41419,
-42266,
-41720,
-41545,
-41480,
-40262,
-40188,
-39557,
-33428,
-25923,
-23861,
-24296,
-23325,
-23217,
-23952,
-23832,
-24588,
-25519,
-25102,
-28124,
-36097,
-41367,
-41493,
-41772,
-42655,
-41982,
-41659,
-41552,
-40334,
-40326,
-39889,
-33822,
-26026,
-23673,
-24084,
-23148,
-22957,
-23652,
-23621,
-24447,
-25350,
-24740,
-27632,
-35790,
-41423,
-41601,
-41688,
-42582,
-42147,
-41911,
-41735,
-40516,
-40651,
-40436,
-34358,
-26220,
-23617,
-24243,
-23565,
-23230,
-23665,
-23505,
-24295,
-25130,
-24395,
-27079,
-35273,
-41215,
-41497,
-41381,
-42291,
-42147,
-42122,
-42020,
-40721,
-40705,
-40619,
-34941,
-26860,
-23938,
-24388,
-23622,
-23063,
-23292,
-23057,
-23884,
-25056,
-24580,
-26908,
-34608,
-40723,
-41473,
-41593,
-42524,
-42329,
-42266,
-42326,
-41067,
-40692,
-40497,
-35223,
-27261,
-23915,
-24075,
-23414,
-23142,
-23661,
-23400,
-23873,
-24981,
-24761,
-26993,
-34469,
-40724,
-41673,
-41632,
-42366,
-42063,
-41918,
-42117,
-41022,
-40547,
-40328,
-35346,
-27439,
-23912,
-24193,
-23775,
-23409,
-23756,
-23402,
-23758,
-24850,
-24697,
-26754,
-34075,
-40542,
-41563,
-41227,
-41896,
-41874,
-41916,
-42193,
-41220,
-40754,
-40599,
-35779,
-27782,
-23944,
-24249,
-23955,
-23440,
-23654,
-23431,
-23784,
-24724,
-24444,
-26349,
-33590,
-40360,
-41715,
-41424,
-42106,
-42074,
-41837,
-41903,
-41167,
-40984,
-40896,
-36096,
-27941,
-23785,
-23922,
-23691,
-23217,
-23675,
-23768,
-24031,
-24598,
-24225,
-26230,
-33545,
-40411,
-41838,
-41466,
-42127,
-42095,
-41595,
-41530,
-41005,
-41041,
-40952,
-36143,
-27955,
-23733,
-24007,
-23915,
-23351,
-23761,
-23981,
-24229,
-24683,
-24215,
-26037,
-33243,
-40338,
-41883,
-41298,
-41882,
-42025,
-41700,
-41770,
-41283,
-41153,
-41080,
-36570,
-28325,
-23742,
-23969,
-24014,
-23369,
-23574,
-23551,
-23580,
-24219,
-24114,
-25826,
-32803,
-40115,
-41952,
-41413,
-42118,
-42342,
-41958,
-42064,
-41616,
-41213,
-41075,
-36898,
-28718,
-23820,
-23833,
-23692,
-22890,
-23326,
-23648,
-23695,
-24337,
-24330,
-25869,
-32673,
-40135,
-42068,
-41500,
-42317,
-42560,
-41895,
-41906,
-41569,
-41124,
-40960,
-36826,
-28514,
-23505,
-23752,
-23829,
-23012,
-23468,
-23758,
-23627,
-24210,
-24204,
-25629,
-32490,
-40303,
-42394,
-41628,
-42206,
-42274,
-41649,
-41953,
-41792,
-41290,
-41210,
-37260,
-28794,
-23449,
-23549,
-23685,
-23027,
-23566,
-23684,
-23386,
-24112,
-24222,
-25416,
-32125,
-40108,
-42394,
-41726,
-42362,
-42481,
-41917,
-42272,
-41882,
-41154,
-41255,
-37651,
-29093,
-23389,
-23334,
-23501,
-22845,
-23352,
-23448,
-23272,
-24218,
-24301,
-25169,
-31817,
-40202,
-42776,
-41975,
-42440,
-42575,
-42040,
-42275,
-41732,
-40917,
-41225,
-37864,
-29193,
-23169,
-23164,
-23616,
-22944,
-23273,
-23398,
-23404,
-24460,
-24516,
-25122,
-31501,
-39974,
-42728,
-41832,
-42222,
-42562,
-42107,
-42235,
-41683,
-40937,
-41345,
-38288,
-29846,
-23631,
-23387,
-23820,
-23104,
-23331,
-23494,
-23378,
-24179,
-24160,
-24709,
-30816,
-39205,
-42285,
-41635,
-42083,
-42472,
-42069,
-42312,
-42056,
-41397,
-41628,
-38635,
-30466,
-24192,
-23594,
-23822,
-23081,
-23345,
-23530,
-23281,
-23967,
-24091,
-24728,
-30601,
-38866,
-42193,
-41778,
-42215,
-42441,
-41843,
-42057,
-41889,
-41244,
-41441,
-38639,
-30618,
-24206,
-23460,
-23747,
-23115,
-23478,
-23730,
-23516,
-24256,
-24354,
-24664,
-30207,
-38567,
-42133,
-41691,
-42029,
-42303,
-41804,
-41998,
-41711,
-40970,
-41473,
-39216,
-31324,
-24523,
-23552,
-23936,
-23317,
-23516,
-23625,
-23362,
-24183,
-24292,
-24313,
-29603,
-38174,
-42065,
-41647,
-41932,
-42341,
-41945,
-42161,
-41861,
-41083,
-41630,
-39549,
-31649,
-24604,
-23476,
-23821,
-23046,
-23156,
-23450,
-23449,
-24361,
-24408,
-24222,
-29319,
-37981,
-42109,
-41846,
-42276,
-42819,
-42321,
-42234,
-41701,
-40818,
-41379,
-39444,
-31649,
-24565,
-23366,
-23658,
-22798,
-22857,
-23254,
-23349,
-24375,
-24587,
-24504,
-29597,
-38185,
-42188,
-41735,
-42126,
-42792,
-42428,
-42389,
-41781,
-40721,
-41207,
-39438,
-31809,
-24770,
-23622,
-23985,
-23042,
-22948,
-23186,
-23228,
-24422,
-24808,
-24528,
-29199,
-37659,
-41805,
-41498,
-41956,
-42664,
-42310,
-42387,
-41875,
-40686,
-41076,
-39532,
-32130,
-25004,
-23720,
-24017,
-23007,
-22933,
-23244,
-23236,
-24407,
-24953,
-24694,
-29172,
-37627,
-41934,
-41669,
-42161,
-42941,
-42459,
-42318,
-41747,
-40471,
-40757,
-39338,
-32056,
-24767,
-23353,
-23785,
-22875,
-22828,
-23304,
-23392,
-24550,
-25212,
-24993,
-29247,
-37597,
-42091,
-41794,
-42045,
-42764,
-42329,
-42189,
-41701,
-40433,
-40564,
-39270,
-32392,
-25120,
-23438,
-23881,
-23116,
-23034,
-23444,
-23431,
-24393,
-25057,
-24906,
-28830,
-36894,
-41655,
-41706,
-41882,
-42482,
-42082,
-42029,
-41818,
-40824,
-40915,
-39643,
-33078,
-25846,
-23825,
-24117,
-23390,
-23217,
-23522,
-23431,
-24182,
-24743,
-24659,
-28471,
-36362,
-41238,
-41395,
-41534,
-42278,
-42129,
-42118,
-41843,
-40824,
-40886,
-39689,
-33270,
-25938,
-23779,
-24202,
-23613,
-23350,
-23608,
-23581,
-24384,
-24984,
-24809,
-28395,
-36299,
-41394,
-41498,
-41367,
-42017,
-41867,
-41842,
-41622,
-40609,
-40598,
-39590,
-33385,
-26017,
-23877,
-24558,
-24012,
-23570,
-23712,
-23557,
-24224,
-24938,
-24848,
-28199,
-36000,
-41168,
-41169,
-40961,
-41836,
-41867,
-41902,
-41916,
-41083,
-41055,
-40123,
-33999,
-26361,
-23920,
-24615,
-24044,
-23521,
-23737,
-23563,
-23964,
-24480,
-24264,
-27491,
-35424,
-41024,
-41260,
-41051,
-41952,
-41980,
-41859,
-41797,
-41026,
-41158,
-40473,
-34489,
-26656,
-23937,
-24587,
-24114,
-23582,
-23786,
-23727,
-24279,
-24785,
-24337,
-27333,
-35309,
-41126,
-41422,
-40979,
-41646,
-41661,
-41663,
-41558,
-40679,
-40864,
-40408,
-34478,
-26480,
-23664,
-24441,
-24206,
-23822,
-23962,
-23785,
-24391,
-24967,
-24365,
-27176,
-35255,
-41286,
-41659,
-41201,
-41828,
-41743,
-41694,
-41618,
-40723,
-41006,
-40799,
-34927,
-26639,
-23540,
-24215,
-23890,
-23518,
-23853,
-23762,
-24253,
-24734,
-23995,
-26610,
-34776,
-41139,
-41655,
-41226,
-41979,
-41910,
-41748,
-41773,
-41056,
-41263,
-41032,
-35273,
-26898,
-23636,
-24357,
-23997,
-23405,
-23728,
-23701,
-24080,
-24602,
-24103,
-26670,
-34650,
-41107,
-41712,
-41189,
-41999,
-42036,
-41777,
-41772,
-41122,
-41190,
-40886,
-35338,
-26987,
-23453,
-24130,
-23959,
-23441,
-23746,
-23672,
-23914,
-24429,
-24009,
-26430,
-34249,
-40982,
-41938,
-41399,
-41968,
-41901,
-41717,
-41912,
-41314,
-41316,
-41163,
-35966,
-27569,
-23568,
-23883,
-23731,
-23433,
-23897,
-23679,
-23750,
-24317,
-23872,
-25933,
-33589,
-40629,
-41977,
-41581,
-42121,
-41861,
-41666,
-42101,
-41569,
-41413,
-41407,
-36466,
-27901,
-23609,
-23910,
-23791,
-23493,
-23967,
-23570,
-23450,
-24215,
-23910,
-25693,
-33249,
-40590,
-42036,
-41496,
-42017,
-41787,
-41622,
-42221,
-41639,
-41176,
-41239,
-36694,
-28139,
-23596,
-23865,
-23763,
-23384,
-23887,
-23536,
-23403,
-24392,
-24309,
-25847,
-33024,
-40384,
-42020,
-41641,
-42358,
-42182,
-41780,
-42194,
-41543,
-40969,
-41026,
-36747,
-28403,
-23779,
-23810,
-23381,
-22745,
-23424,
-23556,
-23705,
-24613,
-24329,
-25656,
-32714,
-40131,
-41952,
-41797,
-42785,
-42712,
-42028,
-42044,
-41347,
-41039,
-41387,
-37185,
-28647,
-23780,
-23763,
-23368,
-22669,
-23281,
-23451,
-23587,
-24398,
-23991,
-25245,
-32405,
-40112,
-42040,
-41706,
-42568,
-42580,
-42061,
-42254,
-41642,
-41236,
-41550,
-37484,
-28923,
-23847,
-23831,
-23588,
-22897,
-23415,
-23444,
-23435,
-24358,
-24184,
-25311,
-32116,
-39838,
-41940,
-41589,
-42379,
-42387,
-41873,
-42173,
-41621,
-40935,
-41096,
-37369,
-29102,
-23927,
-23797,
-23580,
-22876,
-23449,
-23561,
-23530,
-24568,
-24639,
-25604,
-32054,
-39748,
-42048,
-41711,
-42528,
-42561,
-41927,
-42121,
-41477,
-40667,
-40943,
-37634,
-29487,
-24038,
-23737,
-23512,
-22723,
-23276,
-23439,
-23476,
-24592,
-24606,
-25189,
-31363,
-39293,
-41904,
-41627,
-42489,
-42671,
-42114,
-42311,
-41608,
-40739,
-41197,
-38223,
-30062,
-24303,
-23893,
-23732,
-22883,
-23271,
-23382,
-23406,
-24570,
-24579,
-24969,
-30963,
-39034,
-41887,
-41578,
-42301,
-42490,
-41947,
-42108,
-41444,
-40605,
-41060,
-38207,
-30178,
-24269,
-23691,
-23624,
-22907,
-23304,
-23525,
-23634,
-24755,
-24828,
-25329,
-31123,
-38956,
-41896,
-41702,
-42385,
-42636,
-42150,
-42166,
-41446,
-40613,
-40887,
-37950,
-30202,
-24443,
-23782,
-23726,
-22988,
-23170,
-23296,
-23458,
-24492,
-24527,
-25121,
-30923,
-38759,
-41859,
-41661,
-42158,
-42521,
-42332,
-42503,
-41823,
-41035,
-41341,
-38493,
-30693,
-24570,
-23667,
-23748,
-23036,
-22958,
-22852,
-23004,
-24201,
-24415,
-24851,
-30342,
-38373,
-41908,
-41741,
-42164,
-42700,
-42667,
-42821,
-42063,
-41009,
-41209,
-38770,
-31142,
-24591,
-23467,
-23726,
-23030,
-22880,
-22938,
-23063,
-24146,
-24425,
-24701,
-29882,
-38154,
-42134,
-41852,
-42073,
-42677,
-42509,
-42477,
-41927,
-41078,
-41373,
-39193,
-31670,
-24789,
-23537,
-24014,
-23245,
-22932,
-23071,
-23205,
-24088,
-24255,
-24374,
-29286,
-37546,
-41684,
-41355,
-41529,
-42326,
-42355,
-42459,
-42038,
-41267,
-41598,
-39627,
-32280,
-25362,
-23974,
-24384,
-23622,
-23314,
-23319,
-23221,
-24015,
-24218,
-24254,
-28969,
-37122,
-41318,
-41229,
-41594,
-42264,
-42039,
-42099,
-41764,
-41000,
-41415,
-39638,
-32388,
-25464,
-24001,
-24233,
-23366,
-23309,
-23670,
-23710,
-24511,
-24625,
-24428,
-28989,
-37272,
-41549,
-41305,
-41560,
-42197,
-41776,
-41671,
-41355,
-40679,
-41227,
-39640,
-32361,
-25172,
-23785,
-24435,
-23754,
-23657,
-24065,
-24090,
-24659,
-24625,
-24296,
-28755,
-37217,
-41768,
-41315,
-41183,
-41806,
-41479,
-41298,
-41116,
-40716,
-41390,
-39910,
-32649,
-25144,
-23535,
-24445,
-24012,
-23821,
-24162,
-24138,
-24537,
-24449,
-24242,
-28658,
-37165,
-41958,
-41564,
-41205,
-41720,
-41470,
-41389,
-41351,
-40938,
-41367,
-39770,
-32628,
-25147,
-23402,
-24255,
-23883,
-23805,
-24239,
-24167,
-24542,
-24603,
-24443,
-28670,
-37027,
-41923,
-41715,
-41505,
-41972,
-41457,
-41225,
-41215,
-40741,
-41141,
-39801,
-32876,
-25321,
-23461,
-24240,
-23762,
-23723,
-24303,
-24241,
-24600,
-24721,
-24375,
-28311,
-36736,
-41838,
-41549,
-41235,
-41848,
-41472,
-41268,
-41221,
-40627,
-41077,
-40100,
-33364,
-25518,
-23458,
-24431,
-24030,
-23791,
-24232,
-24228,
-24706,
-24900,
-24337,
-27914,
-36317,
-41724,
-41468,
-40991,
-41668,
-41485,
-41241,
-41031,
-40382,
-40929,
-40237,
-33719,
-25744,
-23478,
-24494,
-24133,
-23754,
-24161,
-24311,
-24895,
-25064,
-24365,
-27689,
-36032,
-41622,
-41562,
-41104,
-41847,
-41646,
-41289,
-41063,
-40480,
-41030,
-40393,
-33979,
-25903,
-23478,
-24433,
-24041,
-23626,
-24137,
-24263,
-24685,
-24863,
-24265,
-27517,
-35841,
-41612,
-41568,
-41066,
-41844,
-41661,
-41290,
-41225,
-40693,
-41073,
-40551,
-34401,
-26252,
-23568,
-24500,
-24114,
-23665,
-24185,
-24259,
-24589,
-24888,
-24266,
-27100,
-35244,
-41354,
-41600,
-41033,
-41714,
-41492,
-41181,
-41227,
-40638,
-40917,
-40670,
-34920,
-26688,
-23621,
-24452,
-24215,
-23871,
-24303,
-24173,
-24460,
-24956,
-24316,
-26794,
-34690,
-40922,
-41428,
-41017,
-41736,
-41543,
-41353,
-41478,
-40744,
-40913,
-40847,
-35381,
-27213,
-24007,
-24533,
-24028,
-23612,
-24122,
-24007,
-24363,
-24949,
-24237,
-26506,
-34312,
-40653,
-41367,
-41241,
-42114,
-41799,
-41447,
-41575,
-40855,
-40975,
-40963,
-35622,
-27437,
-24067,
-24424,
-23766,
-23361,
-24077,
-24086,
-24307,
-24841,
-24226,
-26417,
-34089,
-40524,
-41384,
-41229,
-42083,
-41697,
-41171,
-41320,
-40840,
-40992,
-40983,
-35833,
-27658,
-23981,
-24318,
-23876,
-23489,
-24173,
-24212,
-24316,
-24712,
-24092,
-26112,
-33613,
-40350,
-41508,
-41182,
-41868,
-41705,
-41389,
-41576,
-41046,
-41145,
-41249,
-36360,
-28030,
-23910,
-24205,
-24074,
-23694,
-24023,
-23779,
-23939,
-24601,
-24051,
-25823,
-33328,
-40488,
-41850,
-41250,
-41642,
-41538,
-41565,
-42008,
-41255,
-40990,
-41197,
-36525,
-27990,
-23664,
-24090,
-24119,
-23794,
-24112,
-23648,
-23733,
-24762,
-24360,
-25817,
-33187,
-40440,
-41696,
-41121,
-41790,
-41653,
-41422,
-41814,
-40971,
-40577,
-41037,
-36662,
-28070,
-23779,
-24381,
-24181,
-23577,
-24098,
-23928,
-24050,
-25041,
-24467,
-25628,
-33024,
-40478,
-41653,
-40923,
-41732,
-41690,
-41345,
-41666,
-40874,
-40563,
-41205,
-36942,
-28222,
-23735,
-24322,
-24167,
-23485,
-23906,
-23772,
-24036,
-25129,
-24534,
-25563,
-32840,
-40400,
-41832,
-41203,
-41924,
-41944,
-41752,
-42028,
-41020,
-40549,
-41173,
-37036,
-28425,
-23782,
-24147,
-24085,
-23598,
-23961,
-23683,
-23932,
-25082,
-24567,
-25582,
-32753,
-40326,
-41906,
-41266,
-41834,
-41809,
-41645,
-41925,
-40957,
-40493,
-41142,
-37183,
-28612,
-23797,
-24142,
-24217,
-23660,
-23970,
-23809,
-24023,
-25056,
-24503,
-25307,
-32195,
-39909,
-41707,
-40936,
-41588,
-41888,
-41685,
-41821,
-41018,
-40629,
-41281,
-37674,
-29229,
-24044,
-24297,
-24483,
-23590,
-23639,
-23703,
-23971,
-24863,
-24421,
-25139,
-31731,
-39714,
-42007,
-41167,
-41670,
-42095,
-41762,
-41673,
-41021,
-40713,
-41328,
-37929,
-29531,
-23802,
-23759,
-24218,
-23604,
-23758,
-23957,
-24163,
-24911,
-24488,
-25101,
-31454,
-39551,
-42142,
-41236,
-41410,
-41666,
-41412,
-41551,
-40988,
-40565,
-41153,
-38035,
-29791,
-23993,
-23889,
-24461,
-24024,
-24263,
-24203,
-24094,
-24867,
-24521,
-24906,
-31037,
-39193,
-41866,
-41028,
-41300,
-41505,
-41191,
-41523,
-41092,
-40554,
-41265,
-38379,
-30027,
-24042,
-23975,
-24500,
-23851,
-24056,
-24017,
-23891,
-24866,
-24737,
-24971,
-31000,
-39355,
-42045,
-41019,
-41334,
-41730,
-41430,
-41741,
-41210,
-40365,
-40942,
-38256,
-29988,
-23851,
-23808,
-24404,
-23690,
-23916,
-24070,
-24024,
-25054,
-25012,
-25091,
-30807,
-39159,
-42091,
-41182,
-41509,
-41827,
-41251,
-41337,
-40812,
-40059,
-40758,
-38427,
-30416,
-24139,
-23805,
-24318,
-23699,
-24130,
-24478,
-24426,
-25274,
-25080,
-24913,
-30337,
-38703,
-41965,
-41244,
-41490,
-41638,
-40989,
-41124,
-40742,
-40077,
-40915,
-38862,
-30950,
-24358,
-23701,
-24278,
-23875,
-24329,
-24478,
-24208,
-25088,
-25083,
-24861,
-30076,
-38548,
-42202,
-41575,
-41590,
-41592,
-41078,
-41451,
-41128,
-40170,
-40740,
-38829,
-31152,
-24407,
-23514,
-24100,
-23772,
-24165,
-24234,
-23908,
-24880,
-25113,
-24974,
-29915,
-38230,
-42009,
-41490,
-41526,
-41670,
-41235,
-41571,
-41275,
-40325,
-40756,
-38829,
-31340,
-24702,
-23774,
-24318,
-23795,
-23993,
-24155,
-24014,
-24928,
-25113,
-25045,
-29914,
-37978,
-41589,
-41089,
-41407,
-41926,
-41535,
-41516,
-41000,
-40202,
-40842,
-39018,
-31585,
-24959,
-24003,
-24392,
-23635,
-23765,
-24179,
-24273,
-25111,
-24957,
-24538,
-29340,
-37692,
-41630,
-41299,
-41716,
-42220,
-41608,
-41475,
-41045,
-40349,
-41219,
-39715,
-32224,
-25189,
-24004,
-24344,
-23475,
-23602,
-23993,
-23830,
-24638,
-24776,
-24357,
-28957,
-37524,
-41747,
-41299,
-41576,
-42113,
-41539,
-41693,
-41627,
-40752,
-41240,
-39819,
-32367,
-24943,
-23638,
-24255,
-23518,
-23637,
-23977,
-23611,
-24345,
-24776,
-24356,
-28594,
-37198,
-41785,
-41401,
-41594,
-42222,
-41722,
-41790,
-41603,
-40522,
-40976,
-39956,
-32841,
-25237,
-23669,
-24313,
-23596,
-23571,
-23884,
-23694,
-24696,
-25239,
-24586,
-28460,
-37051,
-41889,
-41505,
-41450,
-41986,
-41568,
-41664,
-41354,
-40124,
-40650,
-39972,
-33078,
-25350,
-23630,
-24424,
-23892,
-23858,
-24078,
-23807,
-24757,
-25296,
-24487,
-28037,
-36525,
-41585,
-41282,
-41113,
-41687,
-41431,
-41646,
-41547,
-40450,
-40877,
-40262,
-33662,
-25856,
-23799,
-24541,
-24041,
-23835,
-23979,
-23630,
-24325,
-24890,
-24411,
-27813,
-35975,
-41226,
-41236,
-41086,
-41837,
-41837,
-41985,
-41892,
-40890,
-41007,
-40191,
-34038,
-26443,
-23954,
-24428,
-23907,
-23514,
-23603,
-23445,
-24112,
-24664,
-24181,
-26810,
-33684,
-38369,
-38472,
-38296,
-38961,
-38906,
-38885,
-38769,
-38039,
-38329,
-37935,
-32789,
-26183,
-24006,
-24543,
-24220,
-24059,
-24403,
-24363,
-24877,
-25235,
-24658,
-27103,
-33797,
-38568,
-38898,
-38787,
-39284,
-38948,
-38813,
-38810,
-38139,
-38402,
-38099,
-33127,
-26533,
-24323,
-24765,
-24340,
-24259,
-24757,
-24581,
-24998,
-25592,
-25203,
-27625,
-34347,
-39111,
-39249,
-39130,
-39718,
-39274,
-39116,
-39278,
-38455,
-38345,
-38029,
-33141,
-26481,
-24368,
-25030,
-24552,
-24428,
-25017,
-24767,
-25142,
-26073,
-25864,
-28018,
-34596,
-39474,
-39575,
-39362,
-39985,
-39504,
-39293,
-39551,
-38646,
-38301,
-38123,
-33632,
-26926,
-24458,
-25001,
-24654,
-24644,
-25279,
-24965,
-25200,
-26191,
-26026,
-27868,
-34130,
-39240,
-39796,
-39635,
-40100,
-39591,
-39509,
-39893,
-39019,
-38568,
-38395,
-34240,
-27768,
-25040,
-25262,
-24895,
-24912,
-25427,
-24995,
-25177,
-26123,
-25990,
-27816,
-34005,
-39211,
-40020,
-39965,
-40326,
-39763,
-39606,
-39945,
-39150,
-38847,
-38722,
-34447,
-27753,
-24858,
-25083,
-24701,
-24614,
-25158,
-24970,
-25292,
-26144,
-25829,
-27590,
-34004,
-39521,
-40280,
-40041,
-40623,
-40383,
-40115,
-40152,
-39269,
-39058,
-39119,
-34884,
-27837,
-24659,
-25125,
-24937,
-24553,
-24944,
-24941,
-25340,
-26113,
-25705,
-27275,
-33670,
-39509,
-40366,
-39804,
-40332,
-40297,
-40073,
-40130,
-39461,
-39342,
-39442,
-35391,
-28319,
-24905,
-25376,
-25386,
-24996,
-25293,
-25187,
-25321,
-25900,
-25553,
-27097,
-33347,
-39250,
-40237,
-39629,
-40056,
-40031,
-39904,
-40199,
-39679,
-39420,
-39372,
-35472,
-28562,
-25146,
-25614,
-25647,
-25264,
-25535,
-25303,
-25317,
-26066,
-25950,
-27360,
-33318,
-39166,
-40207,
-39602,
-40067,
-40035,
-39882,
-40196,
-39611,
-39142,
-39210,
-35723,
-28961,
-25326,
-25661,
-25625,
-25166,
-25484,
-25366,
-25447,
-26321,
-26184,
-27218,
-32867,
-38864,
-40116,
-39521,
-40000,
-40052,
-39851,
-40144,
-39559,
-39105,
-39346,
-36126,
-29326,
-25480,
-25819,
-25907,
-25397,
-25692,
-25611,
-25663,
-26427,
-26163,
-26979,
-32568,
-38761,
-40127,
-39433,
-39908,
-39986,
-39668,
-39847,
-39329,
-38960,
-39333,
-36288,
-29479,
-25479,
-25792,
-25855,
-25250,
-25621,
-25760,
-25791,
-26443,
-26173,
-26923,
-32347,
-38568,
-40068,
-39480,
-40117,
-40249,
-39709,
-39787,
-39499,
-39228,
-39502,
-36499,
-29742,
-25581,
-25718,
-25714,
-25046,
-25498,
-25790,
-25700,
-26143,
-25962,
-26777,
-32019,
-38229,
-40015,
-39587,
-40191,
-40286,
-39654,
-39732,
-39577,
-39310,
-39461,
-36649,
-30186,
-25834,
-25589,
-25535,
-25026,
-25542,
-25803,
-25608,
-25998,
-25950,
-26814,
-31803,
-37945,
-40089,
-39869,
-40308,
-40266,
-39707,
-39849,
-39688,
-39333,
-39392,
-36675,
-30333,
-25798,
-25280,
-25345,
-25077,
-25566,
-25679,
-25540,
-26067,
-26085,
-26841,
-31695,
-37936,
-40329,
-40127,
-40317,
-40229,
-39932,
-40239,
-39908,
-39344,
-39429,
-36940,
-30664,
-25966,
-25327,
-25465,
-25225,
-25507,
-25327,
-25114,
-25869,
-26038,
-26621,
-31294,
-37636,
-40200,
-40011,
-40203,
-40157,
-39953,
-40408,
-40154,
-39463,
-39537,
-37187,
-30842,
-25906,
-25253,
-25472,
-25223,
-25548,
-25464,
-25166,
-25880,
-26177,
-26740,
-31305,
-37744,
-40409,
-40119,
-40297,
-40316,
-39888,
-40131,
-39935,
-39285,
-39295,
-37051,
-30842,
-25868,
-25233,
-25504,
-25116,
-25371,
-25538,
-25405,
-26016,
-26227,
-26768,
-31201,
-37551,
-40233,
-39921,
-40136,
-40345,
-39990,
-40069,
-39783,
-39283,
-39443,
-37284,
-31144,
-26136,
-25394,
-25618,
-25198,
-25376,
-25514,
-25470,
-26053,
-26047,
-26437,
-30910,
-37379,
-40172,
-39921,
-40100,
-40255,
-39960,
-40085,
-39803,
-39372,
-39708,
-37606,
-31317,
-26157,
-25389,
-25688,
-25355,
-25546,
-25639,
-25559,
-26106,
-26036,
-26301,
-30734,
-37350,
-40264,
-39929,
-39953,
-40119,
-39831,
-39922,
-39692,
-39320,
-39698,
-37706,
-31444,
-26044,
-25162,
-25681,
-25494,
-25658,
-25824,
-25755,
-26137,
-25976,
-26211,
-30504,
-37187,
-40402,
-40005,
-39738,
-39878,
-39697,
-39792,
-39666,
-39424,
-39770,
-37889,
-31834,
-26272,
-25179,
-25850,
-25825,
-25837,
-25832,
-25652,
-25928,
-25853,
-26095,
-30095,
-36671,
-40209,
-40028,
-39707,
-39811,
-39676,
-39856,
-39819,
-39460,
-39615,
-37952,
-32259,
-26628,
-25193,
-25660,
-25576,
-25687,
-25827,
-25605,
-25931,
-26122,
-26348,
-29908,
-36319,
-40081,
-40201,
-40080,
-40171,
-39719,
-39745,
-39832,
-39387,
-39432,
-38059,
-32619,
-26809,
-25064,
-25295,
-25041,
-25361,
-25845,
-25588,
-25778,
-26063,
-26186,
-29472,
-35911,
-39916,
-40195,
-40309,
-40531,
-39883,
-39818,
-40072,
-39661,
-39673,
-38489,
-33142,
-27201,
-25420,
-25607,
-25156,
-25373,
-25880,
-25475,
-25494,
-25763,
-25798,
-28986,
-35543,
-39668,
-39863,
-39952,
-40272,
-39702,
-39742,
-40167,
-39828,
-39856,
-38740,
-33353,
-27258,
-25457,
-25796,
-25398,
-25568,
-26018,
-25578,
-25609,
-25926,
-25960,
-29066,
-35584,
-39723,
-39838,
-39822,
-40137,
-39587,
-39525,
-39804,
-39403,
-39484,
-38526,
-33338,
-27306,
-25470,
-25823,
-25431,
-25566,
-26136,
-25961,
-26077,
-26234,
-26022,
-28912,
-35416,
-39751,
-39975,
-39881,
-40182,
-39630,
-39358,
-39468,
-39176,
-39524,
-38834,
-33763,
-27470,
-25272,
-25593,
-25353,
-25509,
-26169,
-26161,
-26252,
-26224,
-25831,
-28527,
-35067,
-39756,
-40210,
-39971,
-40149,
-39610,
-39299,
-39412,
-39221,
-39556,
-38854,
-33858,
-27512,
-25163,
-25550,
-25476,
-25618,
-26175,
-26146,
-26241,
-26347,
-26097,
-28748,
-35119,
-39805,
-40333,
-40083,
-40195,
-39602,
-39248,
-39339,
-39032,
-39215,
-38502,
-33692,
-27475,
-25133,
-25452,
-25342,
-25584,
-26292,
-26307,
-26452,
-26687,
-26439,
-28864,
-35034,
-39646,
-40147,
-39942,
-40108,
-39480,
-39139,
-39318,
-38958,
-39049,
-38537,
-34005,
-27833,
-25383,
-25672,
-25506,
-25658,
-26293,
-26160,
-26218,
-26575,
-26404,
-28599,
-34616,
-39406,
-40126,
-39940,
-40177,
-39638,
-39335,
-39546,
-39169,
-39099,
-38540,
-34195,
-28012,
-25278,
-25439,
-25331,
-25441,
-26056,
-26040,
-26133,
-26491,
-26444,
-28706,
-34663,
-39577,
-40435,
-40158,
-40285,
-39828,
-39480,
-39529,
-39148,
-39112,
-38465,
-34058,
-27861,
-25056,
-25255,
-25283,
-25386,
-25928,
-26019,
-26216,
-26473,
-26293,
-28544,
-34596,
-39617,
-40496,
-40141,
-40267,
-39898,
-39583,
-39556,
-39149,
-39239,
-38826,
-34519,
-28185,
-25249,
-25457,
-25441,
-25383,
-25825,
-25873,
-26078,
-26403,
-26092,
-28005,
-33984,
-39275,
-40304,
-39954,
-40176,
-39912,
-39664,
-39809,
-39457,
-39457,
-39209,
-35157,
-28631,
-25304,
-25458,
-25537,
-25467,
-25868,
-25763,
-25769,
-26183,
-26007,
-27696,
-33476,
-39048,
-40383,
-40020,
-40193,
-39959,
-39725,
-39921,
-39549,
-39366,
-39159,
-35478,
-29058,
-25422,
-25345,
-25460,
-25405,
-25761,
-25666,
-25710,
-26186,
-26056,
-27553,
-33067,
-38675,
-40271,
-39981,
-40079,
-39900,
-39737,
-39881,
-39443,
-39318,
-39245,
-35754,
-29428,
-25674,
-25458,
-25640,
-25639,
-25908,
-25782,
-25920,
-26380,
-26072,
-27378,
-32805,
-38426,
-40085,
-39779,
-39821,
-39678,
-39621,
-39744,
-39219,
-39136,
-39261,
-35940,
-29672,
-25914,
-25743,
-25879,
-25754,
-25922,
-25808,
-26039,
-26603,
-26220,
-27237,
-32473,
-38127,
-39825,
-39537,
-39744,
-39721,
-39576,
-39637,
-39138,
-39044,
-39318,
-36271,
-29984,
-26034,
-25832,
-25936,
-25650,
-25890,
-25937,
-26068,
-26482,
-26091,
-27000,
-32179,
-38099,
-39956,
-39564,
-39834,
-39926,
-39642,
-39630,
-39295,
-39252,
-39487,
-36479,
-30019,
-25766,
-25617,
-25915,
-25591,
-25775,
-25895,
-25965,
-26317,
-26002,
-26934,
-32165,
-38326,
-40304,
-39715,
-39793,
-39867,
-39590,
-39607,
-39276,
-39164,
-39400,
-36502,
-30021,
-25650,
-25473,
-25856,
-25623,
-25885,
-25983,
-26041,
-26503,
-26236,
-26993,
-32036,
-38159,
-40156,
-39665,
-39820,
-39835,
-39516,
-39641,
-39315,
-39052,
-39330,
-36632,
-30295,
-25977,
-25754,
-25906,
-25530,
-25840,
-25888,
-25802,
-26325,
-26161,
-26812,
-31685,
-37760,
-39802,
-39526,
-39985,
-40092,
-39725,
-39907,
-39642,
-39265,
-39484,
-36911,
-30627,
-26192,
-25775,
-25689,
-25179,
-25545,
-25688,
-25540,
-26044,
-25985,
-26672,
-31532,
-37755,
-40031,
-39833,
-40251,
-40264,
-39790,
-39996,
-39865,
-39494,
-39587,
-36934,
-30512,
-25841,
-25354,
-25483,
-25162,
-25583,
-25689,
-25450,
-25923,
-25974,
-26691,
-31534,
-37897,
-40367,
-40099,
-40298,
-40200,
-39718,
-39962,
-39841,
-39401,
-39534,
-37097,
-30779,
-25905,
-25243,
-25405,
-25177,
-25705,
-25870,
-25599,
-26030,
-26032,
-26523,
-31137,
-37592,
-40284,
-40096,
-40310,
-40213,
-39642,
-39883,
-39865,
-39518,
-39787,
-37577,
-31205,
-26028,
-25196,
-25348,
-25087,
-25640,
-25871,
-25499,
-25785,
-25674,
-26013,
-30578,
-37336,
-40361,
-40224,
-40409,
-40310,
-39716,
-40005,
-40103,
-39771,
-40012,
-37870,
-31459,
-26067,
-25126,
-25296,
-25006,
-25476,
-25644,
-25243,
-25644,
-25725,
-26074,
-30502,
-37241,
-40387,
-40329,
-40512,
-40394,
-39821,
-40125,
-40147,
-39613,
-39819,
-37870,
-31626,
-26158,
-25025,
-25135,
-24971,
-25609,
-25797,
-25370,
-25837,
-25966,
-26128,
-30276,
-36965,
-40254,
-40322,
-40467,
-40229,
-39591,
-39965,
-40007,
-39390,
-39661,
-38023,
-32003,
-26502,
-25285,
-25370,
-25153,
-25706,
-25853,
-25404,
-25957,
-26142,
-26098,
-29925,
-36553,
-39966,
-40033,
-40214,
-40176,
-39678,
-40012,
-39994,
-39339,
-39686,
-38306,
-32418,
-26740,
-25417,
-25600,
-25293,
-25575,
-25633,
-25276,
-25847,
-26033,
-25899,
-29575,
-36270,
-39882,
-39945,
-40051,
-40219,
-39943,
-40229,
-40115,
-39428,
-39753,
-38428,
-32595,
-26810,
-25380,
-25599,
-25258,
-25418,
-25530,
-25352,
-26000,
-26165,
-25960,
-29568,
-36262,
-39963,
-40019,
-40119,
-40316,
-39976,
-40102,
-39844,
-39141,
-39582,
-38478,
-32742,
-26894,
-25425,
-25624,
-25181,
-25329,
-25527,
-25423,
-26164,
-26376,
-25934,
-29218,
-35906,
-39724,
-39807,
-40005,
-40313,
-39957,
-40141,
-40034,
-39245,
-39641,
-38791,
-33203,
-27167,
-25645,
-25913,
-25385,
-25437,
-25572,
-25155,
-25698,
-26110,
-25755,
-28848,
-35588,
-39592,
-39604,
-39779,
-40298,
-39986,
-40200,
-40299,
-39509,
-39678,
-38952,
-33588,
-27403,
-25682,
-25944,
-25277,
-25225,
-25579,
-25302,
-25716,
-26133,
-25804,
-28663,
-35341,
-39609,
-39742,
-39848,
-40382,
-39946,
-39886,
-40018,
-39444,
-39613,
-38846,
-33562,
-27285,
-25450,
-25874,
-25438,
-25454,
-25914,
-25671,
-25897,
-26196,
-25948,
-28816,
-35433,
-39749,
-39845,
-39735,
-40125,
-39685,
-39650,
-39869,
-39366,
-39508,
-38773,
-33675,
-27493,
-25575,
-25963,
-25535,
-25520,
-25923,
-25620,
-25857,
-26279,
-26062,
-28703,
-35121,
-39493,
-39765,
-39775,
-40241,
-39801,
-39706,
-39875,
-39238,
-39271,
-38711,
-33870,
-27617,
-25424,
-25689,
-25264,
-25335,
-25931,
-25788,
-26083,
-26555,
-26290,
-28687,
-35090,
-39791,
-40214,
-40085,
-40403,
-39829,
-39534,
-39617,
-39027,
-39058,
-38586,
-33838,
-27408,
-25017,
-25479,
-25320,
-25394,
-25969,
-25891,
-26167,
-26613,
-26355,
-28693,
-35067,
-39907,
-40298,
-39902,
-40146,
-39743,
-39534,
-39620,
-39092,
-39188,
-38788,
-34164,
-27699,
-25156,
-25618,
-25589,
-25649,
-26106,
-25943,
-26116,
-26455,
-26096,
-28296,
-34604,
-39590,
-40195,
-39821,
-39973,
-39547,
-39459,
-39724,
-39271,
-39313,
-38942,
-34434,
-27996,
-25317,
-25676,
-25680,
-25808,
-26229,
-25920,
-26006,
-26519,
-26301,
-28338,
-34437,
-39438,
-40148,
-39806,
-39919,
-39451,
-39341,
-39640,
-39085,
-38943,
-38671,
-34525,
-28200,
-25387,
-25707,
-25711,
-25804,
-26262,
-26075,
-26277,
-26897,
-26623,
-28286,
-34096,
-39222,
-40053,
-39622,
-39789,
-39480,
-39344,
-39477,
-38839,
-38750,
-38770,
-34974,
-28633,
-25569,
-25908,
-26050,
-25965,
-26213,
-26009,
-26250,
-26802,
-26388,
-27838,
-33613,
-38975,
-39983,
-39418,
-39559,
-39425,
-39409,
-39571,
-39014,
-38990,
-39038,
-35237,
-28777,
-25556,
-25881,
-26021,
-25879,
-26145,
-26028,
-26247,
-26731,
-26296,
-27778,
-33601,
-39011,
-39952,
-39445,
-39751,
-39680,
-39515,
-39607,
-39054,
-39009,
-39059,
-35261,
-28737,
-25583,
-26013,
-26069,
-25770,
-26064,
-25972,
-26120,
-26646,
-26267,
-27659,
-33503,
-39032,
-39940,
-39304,
-39637,
-39580,
-39460,
-39740,
-39261,
-39101,
-39224,
-35653,
-29077,
-25720,
-26144,
-26257,
-25954,
-26172,
-25889,
-25890,
-26561,
-26299,
-27424,
-32986,
-38643,
-39779,
-39180,
-39460,
-39378,
-39357,
-39807,
-39342,
-39031,
-39209,
-35903,
-29364,
-25770,
-26046,
-26269,
-26119,
-26404,
-26020,
-25908,
-26582,
-26351,
-27354,
-32839,
-38631,
-39953,
-39379,
-39533,
-39323,
-39201,
-39616,
-39123,
-38794,
-39068,
-35919,
-29401,
-25672,
-25872,
-26083,
-25976,
-26396,
-26182,
-26148,
-26847,
-26543,
-27381,
-32757,
-38666,
-40087,
-39473,
-39610,
-39391,
-39176,
-39538,
-39064,
-38722,
-39068,
-36138,
-29642,
-25712,
-25867,
-26136,
-25972,
-26324,
-26137,
-26042,
-26732,
-26531,
-27218,
-32328,
-38322,
-39978,
-39359,
-39501,
-39424,
-39215,
-39533,
-39127,
-38742,
-39065,
-36407,
-30046,
-25847,
-25826,
-26192,
-25957,
-26209,
-26157,
-26155,
-26837,
-26655,
-27205,
-32042,
-38113,
-40021,
-39352,
-39387,
-39446,
-39252,
-39411,
-38956,
-38619,
-39005,
-36516,
-30217,
-25851,
-25807,
-26369,
-26161,
-26329,
-26328,
-26399,
-26967,
-26639,
-27059,
-31866,
-38054,
-40079,
-39325,
-39284,
-39349,
-39124,
-39210,
-38829,
-38634,
-39150,
-36707,
-30341,
-25882,
-25836,
-26376,
-26129,
-26339,
-26410,
-26396,
-26863,
-26524,
-26954,
-31777,
-37978,
-39969,
-39283,
-39411,
-39523,
-39139,
-39208,
-38951,
-38801,
-39349,
-37006,
-30683,
-26124,
-25891,
-26193,
-25842,
-26237,
-26469,
-26334,
-26671,
-26344,
-26678,
-31320,
-37520,
-39726,
-39251,
-39524,
-39564,
-39060,
-39225,
-39144,
-38920,
-39287,
-37044,
-30887,
-26359,
-26092,
-26373,
-25957,
-26290,
-26431,
-26199,
-26606,
-26478,
-26817,
-31261,
-37446,
-39704,
-39162,
-39318,
-39405,
-39002,
-39225,
-39094,
-38720,
-39116,
-37110,
-31022,
-26270,
-25905,
-26319,
-25964,
-26206,
-26303,
-26149,
-26719,
-26670,
-26804,
-31030,
-37342,
-39837,
-39285,
-39403,
-39622,
-39304,
-39432,
-39142,
-38614,
-39041,
-37255,
-31212,
-26241,
-25781,
-26263,
-25814,
-25941,
-26100,
-26035,
-26651,
-26645,
-26735,
-30880,
-37304,
-39955,
-39342,
-39438,
-39765,
-39442,
-39506,
-39290,
-38865,
-39279,
-37510,
-31450,
-26339,
-25850,
-26391,
-25913,
-25960,
-26186,
-26123,
-26592,
-26470,
-26493,
-30576,
-37102,
-39954,
-39397,
-39397,
-39679,
-39369,
-39417,
-39232,
-38822,
-39246,
-37564,
-31563,
-26291,
-25558,
-26130,
-25885,
-26104,
-26296,
-26132,
-26538,
-26469,
-26535,
-30593,
-37134,
-40159,
-39671,
-39502,
-39564,
-39224,
-39418,
-39322,
-38881,
-39256,
-37619,
-31727,
-26410,
-25561,
-26110,
-25946,
-26207,
-26380,
-26174,
-26607,
-26537,
-26470,
-30278,
-36751,
-39926,
-39604,
-39468,
-39487,
-39036,
-39126,
-39067,
-38717,
-39196,
-37748,
-31968,
-26548,
-25560,
-26140,
-26031,
-26340,
-26620,
-26445,
-26752,
-26647,
-26513,
-30141,
-36544,
-39872,
-39614,
-39438,
-39484,
-38977,
-38943,
-38885,
-38538,
-38919,
-37588,
-32089,
-26651,
-25434,
-25922,
-25773,
-26091,
-26504,
-26401,
-26708,
-26804,
-26853,
-30277,
-36468,
-39904,
-39807,
-39672,
-39745,
-39171,
-39061,
-39089,
-38727,
-38877,
-37562,
-32268,
-26817,
-25433,
-25820,
-25601,
-25897,
-26447,
-26358,
-26566,
-26636,
-26593,
-29802,
-36051,
-39772,
-39780,
-39667,
-39833,
-39227,
-39001,
-39010,
-38648,
-38930,
-37951,
-32754,
-26974,
-25419,
-25975,
-25780,
-25945,
-26437,
-26330,
-26606,
-26759,
-26488,
-29358,
-35742,
-39800,
-39753,
-39483,
-39728,
-39245,
-39086,
-39153,
-38709,
-38993,
-38310,
-33246,
-27133,
-25349,
-25962,
-25774,
-25890,
-26456,
-26375,
-26665,
-26902,
-26538,
-29169,
-35629,
-39976,
-40021,
-39700,
-39924,
-39350,
-39112,
-39208,
-38708,
-38832,
-38215,
-33276,
-27134,
-25260,
-25917,
-25745,
-25848,
-26363,
-26134,
-26349,
-26800,
-26635,
-29148,
-35387,
-39698,
-39797,
-39567,
-39867,
-39340,
-39176,
-39421,
-38885,
-38850,
-38263,
-33576,
-27493,
-25444,
-25906,
-25640,
-25734,
-26290,
-26062,
-26247,
-26802,
-26669,
-28983,
-35122,
-39619,
-39921,
-39664,
-39940,
-39413,
-39256,
-39498,
-38894,
-38748,
-38263,
-33779,
-27589,
-25278,
-25778,
-25660,
-25743,
-26226,
-25980,
-26171,
-26794,
-26693,
-28865,
-34966,
-39723,
-40100,
-39646,
-39858,
-39449,
-39301,
-39491,
-38888,
-38717,
-38269,
-33877,
-27573,
-25106,
-25705,
-25727,
-25698,
-26145,
-26040,
-26300,
-26890,
-26773,
-28890,
-34996,
-39882,
-40301,
-39775,
-40028,
-39687,
-39369,
-39410,
-38841,
-38742,
-38325,
-33893,
-27456,
-24870,
-25504,
-25571,
-25557,
-26104,
-26066,
-26179,
-26598,
-26429,
-28615,
-34917,
-39968,
-40339,
-39675,
-39920,
-39617,
-39436,
-39715,
-39297,
-39139,
-38671,
-34212,
-27665,
-25044,
-25762,
-25805,
-25661,
-26057,
-25797,
-25803,
-26412,
-26416,
-28442,
-34569,
-39684,
-40152,
-39595,
-39959,
-39690,
-39492,
-39844,
-39357,
-38998,
-38578,
-34400,
-27852,
-24996,
-25572,
-25580,
-25462,
-26017,
-25874,
-25858,
-26478,
-26439,
-28181,
-34170,
-39547,
-40333,
-39789,
-40060,
-39630,
-39215,
-39491,
-39104,
-38873,
-38670,
-34777,
-28239,
-25100,
-25552,
-25641,
-25576,
-26200,
-26165,
-26088,
-26562,
-26433,
-28065,
-33915,
-39336,
-40216,
-39609,
-39871,
-39600,
-39251,
-39533,
-39276,
-39145,
-38960,
-35099,
-28539,
-25242,
-25656,
-25824,
-25720,
-26242,
-26212,
-26104,
-26434,
-26222,
-27788,
-33585,
-39157,
-40251,
-39661,
-39838,
-39554,
-39170,
-39442,
-39304,
-39289,
-39143,
-35330,
-28717,
-25219,
-25560,
-25826,
-25778,
-26299,
-26313,
-26171,
-26414,
-26173,
-27727,
-33566,
-39292,
-40436,
-39656,
-39704,
-39509,
-39200,
-39388,
-39102,
-38989,
-38898,
-35278,
-28712,
-25141,
-25538,
-25947,
-25832,
-26219,
-26268,
-26357,
-26836,
-26596,
-27849,
-33347,
-39024,
-40271,
-39551,
-39708,
-39611,
-39233,
-39200,
-38738,
-38648,
-38859,
-35621,
-29183,
-25469,
-25686,
-25926,
-25688,
-26109,
-26321,
-26485,
-26934,
-26542,
-27581,
-32982,
-38756,
-40118,
-39496,
-39751,
-39654,
-39137,
-39068,
-38717,
-38741,
-39047,
-35857,
-29355,
-25538,
-25783,
-26092,
-25892,
-26350,
-26492,
-26420,
-26692,
-26301,
-27316,
-32645,
-38506,
-39972,
-39274,
-39374,
-39225,
-38867,
-39138,
-39040,
-38913,
-38981,
-35963,
-29791,
-25980,
-26035,
-26257,
-25994,
-26330,
-26310,
-26083,
-26409,
-26311,
-27352,
-32318,
-38090,
-39926,
-39479,
-39523,
-39447,
-39273,
-39685,
-39565,
-39254,
-39368,
-37175,
-32065,
-28656,
-28614,
-28967,
-28889,
-29169,
-29013,
-28689,
-28975,
-28897,
-29557,
-33550,
-38482,
-40162,
-39672,
-39534,
-39405,
-39250,
-39525,
-39346,
-39021,
-39083,
-36999,
-32059,
-28445,
-28074,
-28466,
-28503,
-28734,
-28631,
-28464,
-28805,
-28746,
-29342,
-33039,
-37806,
-39659,
-39325,
-39127,
-38954,
-38706,
-38846,
-38691,
-38532,
-38622,
-36577,
-31801,
-28253,
-27869,
-28248,
-28248,
-28439,
-28482,
-28467,
-28767,
-28662,
-29248,
-32845,
-37460,
-39223,
-38816,
-38661,
-38621,
-38449,
-38495,
-38235,
-37984,
-38045,
-36145,
-31580,
-28118,
-27707,
-28036,
-27961,
-28111,
-28136,
-28148,
-28535,
-28518,
-28987,
-32334,
-36858,
-38757,
-38545,
-38505,
-38493,
-38336,
-38465,
-38225,
-37838,
-37873,
-36168,
-31741,
-28189,
-27627,
-27890,
-27835,
-28015,
-27926,
-27763,
-28187,
-28289,
-28666,
-31841,
-36447,
-38577,
-38500,
-38442,
-38293,
-38045,
-38300,
-38221,
-37840,
-37906,
-36365,
-31985,
-28296,
-27627,
-27848,
-27763,
-27970,
-27897,
-27628,
-28000,
-28164,
-28535,
-31655,
-36259,
-38340,
-38138,
-38101,
-38109,
-37953,
-38279,
-38334,
-37968,
-37956,
-36329,
-31867,
-28109,
-27509,
-27828,
-27673,
-27817,
-27768,
-27451,
-27685,
-27858,
-28325,
-31508,
-36172,
-38285,
-38107,
-38199,
-38396,
-38204,
-38371,
-38351,
-37983,
-37931,
-36357,
-31990,
-28246,
-27612,
-27809,
-27467,
-27499,
-27577,
-27405,
-27736,
-27960,
-28387,
-31465,
-36115,
-38324,
-38138,
-38220,
-38399,
-38204,
-38332,
-38311,
-37863,
-37797,
-36348,
-31999,
-28085,
-27362,
-27676,
-27463,
-27570,
-27625,
-27370,
-27717,
-28008,
-28299,
-31191,
-35970,
-38372,
-38136,
-38039,
-38133,
-37956,
-38273,
-38377,
-37865,
-37749,
-36522,
-32268,
-28222,
-27463,
-27833,
-27557,
-27580,
-27606,
-27277,
-27633,
-27991,
-28158,
-30834,
-35662,
-38164,
-37919,
-37944,
-38295,
-38137,
-38302,
-38309,
-37721,
-37695,
-36694,
-32473,
-28212,
-27366,
-27778,
-27394,
-27357,
-27531,
-27336,
-27711,
-28053,
-28078,
-30644,
-35624,
-38359,
-38107,
-38055,
-38363,
-38072,
-38072,
-38085,
-37566,
-37611,
-36761,
-32561,
-28095,
-27135,
-27674,
-27446,
-27498,
-27710,
-27458,
-27764,
-28151,
-28143,
-30549,
-35512,
-38403,
-38173,
-37994,
-38223,
-37974,
-38109,
-38265,
-37689,
-37627,
-36851,
-32820,
-28264,
-27142,
-27661,
-27471,
-27473,
-27593,
-27223,
-27507,
-27989,
-27968,
-30175,
-35110,
-38199,
-38078,
-37874,
-38188,
-38058,
-38261,
-38405,
-37749,
-37631,
-37077,
-33262,
-28597,
-27226,
-27665,
-27398,
-27271,
-27371,
-27034,
-27328,
-27879,
-27832,
-29822,
-34671,
-37976,
-38056,
-38005,
-38481,
-38309,
-38290,
-38403,
-37880,
-37825,
-37329,
-33598,
-28820,
-27287,
-27635,
-27211,
-26992,
-27310,
-27191,
-27348,
-27679,
-27532,
-29490,
-34428,
-37927,
-38070,
-38003,
-38516,
-38290,
-38114,
-38272,
-37981,
-38037,
-37559,
-33815,
-28921,
-27255,
-27602,
-27232,
-27045,
-27400,
-27221,
-27213,
-27468,
-27391,
-29385,
-34356,
-37912,
-38080,
-37927,
-38387,
-38192,
-38170,
-38473,
-38167,
-38109,
-37614,
-33931,
-29039,
-27302,
-27646,
-27345,
-27218,
-27495,
-27161,
-27155,
-27515,
-27375,
-29145,
-34029,
-37718,
-38071,
-37999,
-38403,
-38147,
-38164,
-38501,
-38086,
-38004,
-37712,
-34208,
-29261,
-27365,
-27613,
-27269,
-27171,
-27453,
-27098,
-27133,
-27617,
-27481,
-29138,
-33996,
-37718,
-38039,
-37942,
-38416,
-38210,
-38212,
-38531,
-38084,
-37947,
-37678,
-34196,
-29196,
-27319,
-27661,
-27335,
-27153,
-27472,
-27181,
-27200,
-27631,
-27466,
-29052,
-33879,
-37677,
-38030,
-37941,
-38462,
-38217,
-38064,
-38330,
-37986,
-37920,
-37720,
-34367,
-29395,
-27406,
-27661,
-27276,
-27077,
-27526,
-27377,
-27367,
-27746,
-27549,
-29019,
-33740,
-37660,
-38127,
-37994,
-38409,
-38095,
-37912,
-38277,
-37991,
-37857,
-37682,
-34507,
-29492,
-27287,
-27531,
-27338,
-27278,
-27713,
-27393,
-27224,
-27717,
-27656,
-28926,
-33449,
-37513,
-38177,
-37999,
-38329,
-38007,
-37908,
-38405,
-38087,
-37744,
-37631,
-34761,
-29801,
-27366,
-27545,
-27418,
-27349,
-27717,
-27294,
-27044,
-27608,
-27629,
-28710,
-33079,
-37266,
-38067,
-37841,
-38187,
-37971,
-37946,
-38516,
-38241,
-37890,
-37837,
-35101,
-30119,
-27568,
-27718,
-27575,
-27380,
-27674,
-27303,
-27066,
-27585,
-27469,
-28437,
-32790,
-37082,
-37927,
-37715,
-38128,
-37997,
-37947,
-38418,
-38108,
-37873,
-37993,
-35328,
-30257,
-27619,
-27764,
-27631,
-27430,
-27745,
-27395,
-27225,
-27740,
-27520,
-28343,
-32707,
-37096,
-38001,
-37737,
-38062,
-37826,
-37742,
-38248,
-37968,
-37748,
-37985,
-35449,
-30369,
-27650,
-27798,
-27740,
-27606,
-27932,
-27543,
-27289,
-27813,
-27614,
-28292,
-32433,
-36800,
-37766,
-37513,
-37859,
-37753,
-37730,
-38297,
-38070,
-37777,
-37938,
-35582,
-30699,
-27912,
-27955,
-27864,
-27595,
-27843,
-27545,
-27282,
-27683,
-27531,
-28238,
-32242,
-36618,
-37816,
-37650,
-38012,
-37925,
-37696,
-38003,
-37910,
-37841,
-37987,
-35614,
-30760,
-27791,
-27659,
-27579,
-27334,
-27688,
-27721,
-27585,
-27749,
-27503,
-28341,
-32368,
-36742,
-38004,
-37805,
-38129,
-38093,
-37762,
-37867,
-37816,
-37873,
-37941,
-35485,
-30670,
-27746,
-27681,
-27724,
-27438,
-27719,
-27806,
-27691,
-27773,
-27487,
-28278,
-32208,
-36584,
-37874,
-37584,
-37844,
-37864,
-37590,
-37737,
-37727,
-37774,
-37935,
-35750,
-31049,
-27971,
-27817,
-27879,
-27583,
-27801,
-27854,
-27701,
-27872,
-27650,
-28181,
-31822,
-36304,
-37861,
-37622,
-37835,
-37856,
-37596,
-37804,
-37767,
-37631,
-37785,
-35862,
-31223,
-27893,
-27591,
-27700,
-27425,
-27683,
-27768,
-27650,
-27957,
-27863,
-28287,
-31796,
-36429,
-38172,
-37925,
-38106,
-38123,
-37781,
-37881,
-37756,
-37529,
-37762,
-36015,
-31336,
-27814,
-27474,
-27625,
-27326,
-27594,
-27752,
-27655,
-27978,
-27837,
-28089,
-31513,
-36286,
-38103,
-37797,
-37990,
-38055,
-37704,
-37842,
-37783,
-37578,
-37886,
-36282,
-31585,
-27949,
-27634,
-27842,
-27497,
-27742,
-27868,
-27665,
-27956,
-27845,
-27989,
-31270,
-36106,
-38058,
-37749,
-37919,
-37969,
-37589,
-37758,
-37759,
-37464,
-37746,
-36330,
-31748,
-27957,
-27479,
-27712,
-27445,
-27747,
-27873,
-27628,
-27985,
-28030,
-28119,
-31195,
-36050,
-38260,
-38057,
-38092,
-38003,
-37610,
-37878,
-37907,
-37477,
-37627,
-36303,
-31804,
-27865,
-27201,
-27456,
-27370,
-27750,
-27803,
-27465,
-27868,
-28063,
-28187,
-31163,
-35972,
-38190,
-38033,
-38092,
-38038,
-37683,
-37998,
-37988,
-37482,
-37632,
-36376,
-31904,
-28004,
-27414,
-27638,
-27394,
-27674,
-27706,
-27365,
-27797,
-27960,
-27984,
-30969,
-35866,
-38062,
-37836,
-38031,
-38116,
-37713,
-37931,
-37941,
-37484,
-37782,
-36632,
-32093,
-28074,
-27523,
-27696,
-27275,
-27560,
-27806,
-27553,
-27935,
-28036,
-27938,
-30856,
-35829,
-38058,
-37771,
-38048,
-38246,
-37731,
-37796,
-37809,
-37362,
-37657,
-36612,
-32139,
-28059,
-27518,
-27751,
-27274,
-27529,
-27853,
-27616,
-27964,
-28109,
-27960,
-30707,
-35670,
-38046,
-37785,
-38026,
-38256,
-37751,
-37795,
-37832,
-37362,
-37633,
-36790,
-32473,
-28249,
-27505,
-27743,
-27303,
-27543,
-27864,
-27587,
-27904,
-28090,
-27894,
-30428,
-35402,
-37975,
-37755,
-37903,
-38138,
-37673,
-37746,
-37880,
-37435,
-37676,
-36949,
-32771,
-28439,
-27605,
-27943,
-27520,
-27669,
-27995,
-27682,
-27868,
-28032,
-27781,
-30141,
-35085,
-37852,
-37652,
-37720,
-38019,
-37572,
-37619,
-37863,
-37516,
-37683,
-37019,
-33027,
-28669,
-27693,
-28021,
-27571,
-27657,
-28052,
-27767,
-27861,
-28065,
-27919,
-30143,
-34930,
-37737,
-37579,
-37609,
-37941,
-37553,
-37610,
-37908,
-37564,
-37623,
-36980,
-33128,
-28782,
-27700,
-28062,
-27711,
-27798,
-28049,
-27609,
-27675,
-27984,
-27832,
-29919,
-34675,
-37638,
-37650,
-37673,
-37919,
-37523,
-37712,
-38051,
-37567,
-37634,
-37223,
-33522,
-29042,
-27734,
-27943,
-27574,
-27763,
-28029,
-27528,
-27688,
-28116,
-27800,
-29632,
-34413,
-37513,
-37582,
-37699,
-37967,
-37525,
-37718,
-38079,
-37485,
-37514,
-37278,
-33617,
-29036,
-27763,
-28052,
-27602,
-27709,
-28029,
-27531,
-27711,
-28208,
-27881,
-29616,
-34458,
-37606,
-37582,
-37648,
-38054,
-37597,
-37659,
-37985,
-37400,
-37381,
-37167,
-33580,
-28962,
-27663,
-27987,
-27489,
-27531,
-28008,
-27709,
-27882,
-28358,
-28060,
-29740,
-34490,
-37709,
-37749,
-37825,
-38247,
-37743,
-37571,
-37759,
-37265,
-37316,
-37157,
-33674,
-29017,
-27518,
-27781,
-27354,
-27414,
-27946,
-27795,
-27969,
-28343,
-27946,
-29505,
-34195,
-37635,
-37881,
-37910,
-38266,
-37834,
-37687,
-37874,
-37406,
-37455,
-37322,
-33957,
-29226,
-27510,
-27728,
-27381,
-27388,
-27840,
-27663,
-27786,
-28160,
-27832,
-29329,
-33964,
-37553,
-37921,
-37893,
-38263,
-37825,
-37593,
-37782,
-37445,
-37502,
-37365,
-34115,
-29367,
-27524,
-27750,
-27429,
-27392,
-27981,
-27939,
-27949,
-28222,
-27959,
-29421,
-33946,
-37549,
-37890,
-37791,
-38222,
-37860,
-37476,
-37633,
-37336,
-37298,
-37096,
-34002,
-29362,
-27492,
-27783,
-27474,
-27354,
-27941,
-27965,
-27969,
-28320,
-28203,
-29563,
-33947,
-37597,
-38002,
-37834,
-38256,
-37879,
-37478,
-37639,
-37331,
-37207,
-37090,
-34175,
-29444,
-27353,
-27622,
-27394,
-27298,
-27895,
-27908,
-27924,
-28388,
-28196,
-29243,
-33547,
-37514,
-38150,
-37944,
-38319,
-37955,
-37563,
-37771,
-37355,
-37094,
-37179,
-34557,
-29731,
-27343,
-27577,
-27404,
-27290,
-27882,
-27885,
-27885,
-28480,
-28351,
-29165,
-33313,
-37457,
-38189,
-37930,
-38323,
-38029,
-37598,
-37764,
-37329,
-36972,
-37103,
-34725,
-29923,
-27380,
-27549,
-27411,
-27201,
-27772,
-27828,
-27827,
-28406,
-28308,
-29035,
-33047,
-37266,
-38163,
-37898,
-38255,
-38041,
-37697,
-37960,
-37642,
-37316,
-37380,
-34992,
-30209,
-27548,
-27657,
-27568,
-27358,
-27730,
-27594,
-27484,
-28013,
-27983,
-28808,
-32859,
-37078,
-38034,
-37775,
-38156,
-38096,
-37972,
-38260,
-37824,
-37408,
-37473,
-35099,
-30317,
-27648,
-27714,
-27593,
-27281,
-27506,
-27331,
-27400,
-28124,
-28070,
-28750,
-32745,
-37032,
-38066,
-37867,
-38286,
-38255,
-38109,
-38315,
-37765,
-37342,
-37532,
-35275,
-30439,
-27622,
-27593,
-27398,
-27041,
-27324,
-27258,
-27343,
-28019,
-27911,
-28514,
-32467,
-36841,
-38014,
-37919,
-38473,
-38488,
-38235,
-38374,
-37935,
-37592,
-37773,
-35558,
-30748,
-27849,
-27721,
-27450,
-26992,
-27260,
-27253,
-27254,
-27788,
-27674,
-28301,
-32171,
-36555,
-37854,
-37803,
-38337,
-38354,
-38087,
-38275,
-38010,
-37744,
-37884,
-35703,
-30941,
-27905,
-27669,
-27487,
-27157,
-27510,
-27524,
-27426,
-27816,
-27692,
-28310,
-32127,
-36613,
-38040,
-37899,
-38218,
-38136,
-37831,
-38021,
-37825,
-37603,
-37787,
-35728,
-30959,
-27753,
-27518,
-27558,
-27321,
-27615,
-27620,
-27512,
-27901,
-27756,
-28224,
-31891,
-36504,
-38126,
-37918,
-38138,
-38140,
-37895,
-38048,
-37856,
-37636,
-37906,
-36032,
-31288,
-27797,
-27381,
-27460,
-27225,
-27476,
-27547,
-27464,
-27792,
-27618,
-28021,
-31625,
-36387,
-38261,
-38078,
-38228,
-38253,
-38030,
-38186,
-38029,
-37792,
-37944,
-36031,
-31254,
-27689,
-27283,
-27456,
-27224,
-27372,
-27362,
-27274,
-27690,
-27657,
-28131,
-31715,
-36495,
-38370,
-38127,
-38226,
-38234,
-38018,
-38174,
-37981,
-37650,
-37804,
-35981,
-31217,
-27613,
-27247,
-27466,
-27218,
-27422,
-27488,
-27424,
-27882,
-27831,
-28124,
-31610,
-36477,
-38357,
-38001,
-38104,
-38195,
-37952,
-38113,
-37952,
-37604,
-37847,
-36215,
-31424,
-27679,
-27375,
-27689,
-27376,
-27502,
-27550,
-27338,
-27696,
-27692,
-27944,
-31333,
-36278,
-38223,
-37791,
-37931,
-38139,
-37885,
-38062,
-38076,
-37781,
-37944,
-36371,
-31661,
-27866,
-27517,
-27812,
-27358,
-27446,
-27602,
-27408,
-27643,
-27663,
-27921,
-31168,
-36064,
-38141,
-37818,
-38015,
-38296,
-37959,
-38008,
-38035,
-37788,
-37943,
-36472,
-31889,
-27962,
-27403,
-27668,
-27271,
-27393,
-27609,
-27438,
-27657,
-27691,
-27894,
-30965,
-35853,
-38167,
-37949,
-38056,
-38297,
-38042,
-38161,
-38184,
-37848,
-37939,
-36644,
-32252,
-28196,
-27404,
-27663,
-27330,
-27380,
-27498,
-27278,
-27548,
-27691,
-27847,
-30687,
-35548,
-38116,
-38037,
-38059,
-38272,
-38031,
-38119,
-38144,
-37795,
-37893,
-36729,
-32446,
-28207,
-27195,
-27500,
-27294,
-27377,
-27566,
-27435,
-27677,
-27778,
-27858,
-30554,
-35433,
-38225,
-38243,
-38180,
-38335,
-38074,
-38045,
-37981,
-37626,
-37741,
-36699,
-32577,
-28311,
-27107,
-27322,
-27110,
-27212,
-27505,
-27536,
-27877,
-28025,
-28078,
-30651,
-35414,
-38258,
-38378,
-38374,
-38532,
-38205,
-38062,
-37868,
-37438,
-37556,
-36588,
-32550,
-28265,
-27055,
-27254,
-27046,
-27147,
-27459,
-27532,
-27975,
-28195,
-28153,
-30580,
-35339,
-38214,
-38300,
-38291,
-38523,
-38276,
-38215,
-38005,
-37407,
-37449,
-36660,
-32741,
-28430,
-27216,
-27448,
-27123,
-27073,
-27287,
-27303,
-27853,
-28276,
-28218,
-30433,
-35143,
-38083,
-38162,
-38213,
-38608,
-38441,
-38355,
-38128,
-37422,
-37410,
-36782,
-32988,
-28561,
-27216,
-27438,
-27037,
-26902,
-27141,
-27190,
-27742,
-28173,
-28012,
-30055,
-34839,
-38065,
-38315,
-38362,
-38758,
-38555,
-38456,
-38255,
-37573,
-37566,
-37038,
-33285,
-28651,
-27084,
-27294,
-26988,
-26902,
-27101,
-27029,
-27537,
-28075,
-27977,
-29945,
-34719,
-38063,
-38366,
-38371,
-38696,
-38470,
-38429,
-38324,
-37546,
-37384,
-36873,
-33274,
-28679,
-27093,
-27281,
-26951,
-26917,
-27212,
-27115,
-27557,
-28164,
-28135,
-30014,
-34705,
-37989,
-38184,
-38143,
-38528,
-38257,
-38172,
-38200,
-37560,
-37375,
-36886,
-33344,
-28767,
-27244,
-27571,
-27190,
-27041,
-27370,
-27292,
-27574,
-28114,
-28081,
-29850,
-34468,
-37812,
-38001,
-37981,
-38546,
-38386,
-38200,
-38218,
-37655,
-37458,
-37008,
-33636,
-29024,
-27348,
-27612,
-27191,
-26909,
-27268,
-27260,
-27498,
-27990,
-27980,
-29645,
-34178,
-37713,
-38098,
-38073,
-38609,
-38460,
-38240,
-38262,
-37765,
-37543,
-37124,
-33859,
-29193,
-27244,
-27390,
-27038,
-26813,
-27190,
-27219,
-27476,
-27995,
-27991,
-29546,
-34009,
-37690,
-38243,
-38207,
-38689,
-38564,
-38320,
-38270,
-37661,
-37432,
-37133,
-34053,
-29364,
-27297,
-27423,
-27098,
-26776,
-27042,
-27102,
-27490,
-28105,
-28023,
-29365,
-33786,
-37617,
-38299,
-38225,
-38751,
-38742,
-38550,
-38439,
-37761,
-37525,
-37327,
-34280,
-29413,
-27110,
-27239,
-27049,
-26770,
-27004,
-27045,
-27391,
-27996,
-27943,
-29349,
-33865,
-37885,
-38585,
-38342,
-38692,
-38657,
-38504,
-38420,
-37764,
-37447,
-37141,
-34062,
-29214,
-26932,
-27136,
-27072,
-26839,
-27037,
-27046,
-27411,
-28063,
-28086,
-29488,
-33902,
-37799,
-38485,
-38224,
-38518,
-38451,
-38341,
-38334,
-37741,
-37480,
-37219,
-34196,
-29429,
-27177,
-27341,
-27245,
-27068,
-27292,
-27210,
-27448,
-27986,
-27912,
-29264,
-33704,
-37647,
-38352,
-38161,
-38482,
-38388,
-38292,
-38417,
-37898,
-37645,
-37420,
-34400,
-29568,
-27285,
-27437,
-27248,
-26968,
-27202,
-27079,
-27247,
-27820,
-27791,
-29057,
-33460,
-37480,
-38231,
-38079,
-38557,
-38504,
-38357,
-38481,
-37995,
-37656,
-37464,
-34613,
-29757,
-27283,
-27346,
-27091,
-26792,
-27149,
-27145,
-27235,
-27790,
-27831,
-29012,
-33304,
-37439,
-38341,
-38186,
-38642,
-38524,
-38226,
-38355,
-38014,
-37701,
-37500,
-34737,
-29840,
-27214,
-27271,
-27151,
-26881,
-27256,
-27278,
-27282,
-27741,
-27739,
-28831,
-33100,
-37449,
-38496,
-38245,
-38569,
-38477,
-38191,
-38337,
-38010,
-37741,
-37682,
-35078,
-30073,
-27145,
-27110,
-27053,
-26793,
-27131,
-27193,
-27267,
-27820,
-27779,
-28651,
-32816,
-37352,
-38598,
-38332,
-38659,
-38616,
-38329,
-38447,
-38034,
-37647,
-37594,
-35130,
-30121,
-27074,
-27084,
-27126,
-26865,
-27188,
-27233,
-27234,
-27777,
-27838,
-28671,
-32709,
-37239,
-38508,
-38215,
-38544,
-38520,
-38159,
-38271,
-37994,
-37641,
-37608,
-35299,
-30459,
-27391,
-27270,
-27209,
-26863,
-27215,
-27372,
-27346,
-27791,
-27812,
-28574,
-32465,
-36967,
-38418,
-38262,
-38611,
-38558,
-38195,
-38327,
-38108,
-37759,
-37685,
-35406,
-30577,
-27366,
-27091,
-27070,
-26862,
-27216,
-27206,
-27079,
-27551,
-27664,
-28440,
-32329,
-36947,
-38586,
-38470,
-38672,
-38478,
-38196,
-38462,
-38227,
-37769,
-37723,
-35565,
-30725,
-27356,
-26963,
-26936,
-26791,
-27187,
-27182,
-27113,
-27745,
-27866,
-28436,
-32138,
-36802,
-38505,
-38409,
-38685,
-38558,
-38211,
-38355,
-38011,
-37493,
-37564,
-35603,
-30810,
-27449,
-27198,
-27228,
-26891,
-27164,
-27257,
-27268,
-27854,
-27881,
-28291,
-31930,
-36661,
-38315,
-38034,
-38345,
-38460,
-38144,
-38215,
-37920,
-37518,
-37665,
-35788,
-30976,
-27488,
-27255,
-27339,
-26914,
-27132,
-27323,
-27329,
-27802,
-27821,
-28271,
-31858,
-36619,
-38347,
-38074,
-38403,
-38556,
-38154,
-38150,
-37947,
-37610,
-37744,
-35965,
-31251,
-27685,
-27326,
-27396,
-26990,
-27270,
-27504,
-27424,
-27822,
-27903,
-28290,
-31652,
-36359,
-38251,
-38078,
-38353,
-38413,
-37945,
-38033,
-37969,
-37573,
-37597,
-35987,
-31469,
-27837,
-27362,
-27485,
-27177,
-27523,
-27748,
-27540,
-27879,
-28063,
-28370,
-31466,
-36146,
-38252,
-38147,
-38367,
-38391,
-37869,
-37908,
-37878,
-37463,
-37516,
-36119,
-31735,
-27882,
-27161,
-27265,
-26955,
-27283,
-27628,
-27517,
-27853,
-27978,
-28164,
-31134,
-35917,
-38292,
-38242,
-38416,
-38482,
-37999,
-37939,
-37864,
-37515,
-37666,
-36371,
-31999,
-28007,
-27202,
-27363,
-27063,
-27299,
-27571,
-27482,
-27800,
-27904,
-28082,
-31038,
-35825,
-38177,
-38085,
-38216,
-38342,
-37939,
-37964,
-37927,
-37585,
-37723,
-36438,
-32082,
-28151,
-27407,
-27575,
-27225,
-27439,
-27690,
-27540,
-27865,
-27990,
-28114,
-30979,
-35726,
-38040,
-37918,
-38098,
-38277,
-37861,
-37891,
-37832,
-37366,
-37496,
-36391,
-32142,
-28145,
-27387,
-27607,
-27263,
-27446,
-27658,
-27467,
-27895,
-28189,
-28222,
-30847,
-35621,
-38098,
-37927,
-37964,
-38110,
-37784,
-37932,
-37959,
-37413,
-37513,
-36656,
-32538,
-28318,
-27375,
-27697,
-27439,
-27576,
-27753,
-27537,
-27949,
-28225,
-28014,
-30281,
-35050,
-37840,
-37814,
-37885,
-38171,
-37942,
-38013,
-37981,
-37419,
-37583,
-36989,
-33099,
-28793,
-27709,
-28008,
-27590,
-27469,
-27611,
-27449,
-27831,
-28135,
-27981,
-30191,
-34948,
-37768,
-37654,
-37671,
-38161,
-38049,
-38076,
-38104,
-37632,
-37660,
-36915,
-33026,
-28710,
-27649,
-28036,
-27511,
-27223,
-27406,
-27289,
-27547,
-27927,
-28041,
-30303,
-34934,
-37743,
-37630,
-37696,
-38386,
-38347,
-38314,
-38422,
-38027,
-37811,
-36886,
-33135,
-28847,
-27614,
-27934,
-27449,
-27126,
-27317,
-27122,
-27228,
-27659,
-27787,
-29316,
-32825,
-34946,
-34670,
-34655,
-35316,
-35263,
-35188,
-35381,
-35060,
-34789,
-34203,
-31538,
-28358,
-27619,
-28067,
-27643,
-27345,
-27645,
-27628,
-27757,
-28187,
-28372,
-29809,
-33119,
-35343,
-35293,
-35269,
-35813,
-35765,
-35609,
-35657,
-35280,
-35069,
-34621,
-32151,
-28942,
-27861,
-28106,
-27798,
-27588,
-27835,
-27822,
-27976,
-28354,
-28467,
-29822,
-33088,
-35464,
-35616,
-35536,
-35925,
-35874,
-35827,
-35918,
-35620,
-35482,
-35088,
-32643,
-29430,
-28250,
-28509,
-28342,
-28219,
-28404,
-28318,
-28419,
-28699,
-28678,
-29877,
-33030,
-35466,
-35777,
-35758,
-36038,
-35902,
-35811,
-35930,
-35696,
-35658,
-35362,
-33064,
-29870,
-28516,
-28573,
-28427,
-28478,
-28822,
-28758,
-28746,
-28930,
-28938,
-30198,
-33362,
-35854,
-36242,
-36179,
-36307,
-36021,
-35873,
-36019,
-35852,
-35776,
-35386,
-33062,
-29881,
-28545,
-28662,
-28578,
-28586,
-28820,
-28707,
-28749,
-29059,
-29157,
-30357,
-33410,
-35868,
-36251,
-36160,
-36341,
-36191,
-36156,
-36315,
-36065,
-35922,
-35593,
-33396,
-30209,
-28799,
-28911,
-28868,
-28827,
-29010,
-28832,
-28845,
-29150,
-29172,
-30213,
-33204,
-35754,
-36187,
-36041,
-36213,
-36080,
-36070,
-36279,
-36055,
-35879,
-35638,
-33589,
-30457,
-29030,
-29163,
-29063,
-28960,
-29151,
-29037,
-29030,
-29352,
-29368,
-30310,
-33234,
-35811,
-36239,
-36096,
-36314,
-36174,
-36041,
-36210,
-36019,
-35882,
-35715,
-33731,
-30536,
-29003,
-29136,
-29053,
-28978,
-29253,
-29180,
-29124,
-29398,
-29399,
-30286,
-33226,
-35921,
-36427,
-36294,
-36517,
-36330,
-36132,
-36285,
-36115,
-35990,
-35905,
-33980,
-30679,
-28981,
-29039,
-28969,
-28957,
-29310,
-29265,
-29186,
-29446,
-29363,
-30083,
-32997,
-35842,
-36509,
-36425,
-36630,
-36373,
-36109,
-36256,
-36037,
-35868,
-35860,
-34056,
-30746,
-28940,
-28921,
-28783,
-28733,
-29159,
-29233,
-29271,
-29646,
-29589,
-30176,
-32981,
-35845,
-36531,
-36487,
-36756,
-36508,
-36110,
-36141,
-35890,
-35745,
-35848,
-34206,
-30902,
-29065,
-29037,
-28879,
-28728,
-29152,
-29269,
-29281,
-29607,
-29505,
-30022,
-32775,
-35697,
-36437,
-36384,
-36753,
-36625,
-36257,
-36288,
-36049,
-35840,
-35909,
-34328,
-31062,
-29108,
-29019,
-28801,
-28574,
-28967,
-29115,
-29110,
-29452,
-29430,
-29917,
-32559,
-35528,
-36389,
-36372,
-36722,
-36591,
-36226,
-36335,
-36226,
-36018,
-36056,
-34577,
-31380,
-29336,
-29171,
-28982,
-28773,
-29168,
-29284,
-29155,
-29396,
-29366,
-29754,
-32251,
-35248,
-36257,
-36288,
-36606,
-36463,
-36081,
-36238,
-36242,
-36108,
-36186,
-34813,
-31615,
-29451,
-29238,
-29167,
-29025,
-29397,
-29442,
-29205,
-29360,
-29327,
-29718,
-32220,
-35293,
-36343,
-36232,
-36419,
-36309,
-36050,
-36282,
-36283,
-36091,
-36139,
-34799,
-31619,
-29390,
-29172,
-29160,
-29013,
-29297,
-29308,
-29147,
-29404,
-29416,
-29738,
-32153,
-35268,
-36406,
-36346,
-36515,
-36426,
-36184,
-36373,
-36275,
-35999,
-36071,
-34843,
-31707,
-29401,
-29106,
-29072,
-28950,
-29231,
-29219,
-29046,
-29384,
-29480,
-29784,
-32083,
-35125,
-36292,
-36275,
-36529,
-36473,
-36218,
-36398,
-36318,
-36016,
-36101,
-34962,
-31915,
-29622,
-29315,
-29250,
-29027,
-29271,
-29293,
-29108,
-29371,
-29408,
-29607,
-31828,
-34908,
-36121,
-36055,
-36297,
-36351,
-36163,
-36380,
-36375,
-36135,
-36224,
-35137,
-32067,
-29663,
-29379,
-29426,
-29176,
-29279,
-29249,
-29042,
-29292,
-29377,
-29603,
-31779,
-34915,
-36206,
-36057,
-36224,
-36337,
-36187,
-36336,
-36300,
-36011,
-36059,
-35024,
-32036,
-29588,
-29295,
-29416,
-29158,
-29248,
-29319,
-29227,
-29501,
-29589,
-29746,
-31813,
-34941,
-36307,
-36138,
-36253,
-36344,
-36119,
-36181,
-36138,
-35904,
-36008,
-35086,
-32130,
-29588,
-29233,
-29400,
-29211,
-29378,
-29515,
-29367,
-29524,
-29513,
-29571,
-31589,
-34821,
-36330,
-36183,
-36249,
-36293,
-36024,
-36116,
-36174,
-36000,
-36177,
-35365,
-32388,
-29690,
-29217,
-29359,
-29164,
-29326,
-29444,
-29247,
-29438,
-29503,
-29530,
-31452,
-34711,
-36292,
-36195,
-36304,
-36385,
-36130,
-36242,
-36268,
-35954,
-36031,
-35254,
-32315,
-29616,
-29162,
-29317,
-29107,
-29272,
-29410,
-29203,
-29462,
-29629,
-29680,
-31582,
-34854,
-36412,
-36258,
-36351,
-36404,
-36077,
-36169,
-36211,
-35874,
-35946,
-35213,
-32297,
-29606,
-29208,
-29366,
-29086,
-29264,
-29431,
-29236,
-29479,
-29667,
-29653,
-31457,
-34705,
-36271,
-36136,
-36306,
-36441,
-36108,
-36205,
-36314,
-35969,
-36016,
-35340,
-32478,
-29717,
-29224,
-29347,
-29049,
-29253,
-29477,
-29192,
-29314,
-29530,
-29604,
-31414,
-34708,
-36384,
-36274,
-36392,
-36534,
-36183,
-36249,
-36392,
-36051,
-35995,
-35301,
-32498,
-29647,
-29023,
-29176,
-28938,
-29120,
-29364,
-29151,
-29291,
-29545,
-29639,
-31351,
-34622,
-36500,
-36492,
-36519,
-36586,
-36267,
-36299,
-36410,
-36087,
-36052,
-35404,
-32629,
-29661,
-28838,
-29051,
-28973,
-29163,
-29306,
-29078,
-29243,
-29482,
-29530,
-31176,
-34455,
-36473,
-36558,
-36492,
-36503,
-36261,
-36388,
-36481,
-36137,
-36153,
-35604,
-32890,
-29855,
-28943,
-29104,
-29027,
-29155,
-29198,
-28940,
-29167,
-29448,
-29410,
-30947,
-34223,
-36301,
-36442,
-36438,
-36507,
-36301,
-36456,
-36521,
-36081,
-36060,
-35626,
-33004,
-29970,
-29040,
-29155,
-28994,
-29102,
-29222,
-28983,
-29239,
-29559,
-29458,
-30844,
-34096,
-36250,
-36431,
-36501,
-36598,
-36297,
-36352,
-36451,
-36052,
-36048,
-35726,
-33173,
-30059,
-29032,
-29133,
-28932,
-29086,
-29311,
-29088,
-29234,
-29539,
-29426,
-30771,
-34070,
-36314,
-36456,
-36417,
-36497,
-36178,
-36242,
-36432,
-36060,
-35981,
-35670,
-33187,
-30033,
-28991,
-29175,
-29058,
-29208,
-29447,
-29159,
-29223,
-29578,
-29540,
-30805,
-34009,
-36266,
-36371,
-36290,
-36408,
-36116,
-36158,
-36400,
-36045,
-35907,
-35636,
-33303,
-30196,
-29118,
-29314,
-29144,
-29201,
-29475,
-29252,
-29305,
-29667,
-29604,
-30688,
-33760,
-36073,
-36293,
-36280,
-36517,
-36244,
-36154,
-36339,
-36023,
-35904,
-35687,
-33497,
-30386,
-29196,
-29334,
-29080,
-29027,
-29337,
-29231,
-29297,
-29618,
-29571,
-30615,
-33660,
-36056,
-36311,
-36259,
-36536,
-36329,
-36216,
-36345,
-36052,
-35928,
-35726,
-33577,
-30444,
-29181,
-29335,
-29149,
-29095,
-29362,
-29257,
-29326,
-29652,
-29585,
-30562,
-33538,
-35995,
-36335,
-36306,
-36520,
-36274,
-36155,
-36313,
-36011,
-35866,
-35699,
-33638,
-30552,
-29242,
-29311,
-29084,
-29079,
-29405,
-29283,
-29320,
-29684,
-29655,
-30564,
-33469,
-35867,
-36226,
-36276,
-36562,
-36282,
-36131,
-36339,
-36050,
-35871,
-35722,
-33753,
-30673,
-29356,
-29364,
-29035,
-28971,
-29363,
-29270,
-29264,
-29640,
-29615,
-30454,
-33334,
-35836,
-36262,
-36348,
-36682,
-36389,
-36168,
-36376,
-36136,
-35917,
-35804,
-33883,
-30753,
-29273,
-29278,
-29001,
-28958,
-29374,
-29285,
-29198,
-29537,
-29562,
-30379,
-33223,
-35823,
-36340,
-36358,
-36645,
-36358,
-36119,
-36325,
-36158,
-35956,
-35826,
-33950,
-30818,
-29244,
-29230,
-29005,
-28924,
-29320,
-29324,
-29283,
-29552,
-29484,
-30231,
-33053,
-35752,
-36371,
-36373,
-36666,
-36476,
-36228,
-36326,
-36122,
-36014,
-35977,
-34149,
-30924,
-29216,
-29186,
-29008,
-28845,
-29117,
-29137,
-29190,
-29506,
-29414,
-30121,
-32991,
-35825,
-36476,
-36359,
-36601,
-36521,
-36379,
-36473,
-36205,
-36036,
-36004,
-34195,
-30883,
-29083,
-29140,
-29120,
-28960,
-29114,
-29050,
-29092,
-29492,
-29442,
-30067,
-32847,
-35747,
-36469,
-36287,
-36479,
-36463,
-36394,
-36549,
-36237,
-35953,
-35929,
-34308,
-31104,
-29198,
-29148,
-29106,
-28976,
-29167,
-29111,
-29112,
-29503,
-29517,
-30040,
-32675,
-35574,
-36432,
-36344,
-36534,
-36426,
-36230,
-36357,
-36154,
-35944,
-35992,
-34469,
-31277,
-29288,
-29193,
-29154,
-29019,
-29249,
-29229,
-29187,
-29514,
-29457,
-29890,
-32476,
-35464,
-36373,
-36248,
-36456,
-36409,
-36242,
-36376,
-36177,
-35953,
-36073,
-34664,
-31429,
-29288,
-29158,
-29172,
-29052,
-29297,
-29294,
-29205,
-29510,
-29447,
-29786,
-32315,
-35429,
-36462,
-36303,
-36429,
-36328,
-36088,
-36258,
-36156,
-35971,
-36084,
-34765,
-31552,
-29310,
-29140,
-29201,
-29100,
-29410,
-29449,
-29279,
-29464,
-29393,
-29716,
-32164,
-35278,
-36379,
-36243,
-36378,
-36287,
-35998,
-36162,
-36187,
-36099,
-36222,
-34924,
-31724,
-29437,
-29214,
-29256,
-29115,
-29397,
-29449,
-29257,
-29364,
-29244,
-29562,
-32033,
-35221,
-36395,
-36269,
-36414,
-36357,
-36112,
-36261,
-36248,
-36135,
-36283,
-35001,
-31718,
-29335,
-29094,
-29206,
-29092,
-29335,
-29317,
-29142,
-29353,
-29316,
-29573,
-32032,
-35282,
-36477,
-36266,
-36335,
-36278,
-36110,
-36372,
-36351,
-36107,
-36215,
-35007,
-31769,
-29373,
-29191,
-29326,
-29171,
-29392,
-29364,
-29147,
-29411,
-29428,
-29618,
-31943,
-35166,
-36385,
-36197,
-36368,
-36348,
-36081,
-36255,
-36277,
-36073,
-36237,
-35136,
-31932,
-29468,
-29233,
-29323,
-29098,
-29339,
-29416,
-29203,
-29378,
-29373,
-29546,
-31837,
-35118,
-36420,
-36243,
-36407,
-36432,
-36171,
-36347,
-36413,
-36173,
-36248,
-35163,
-31998,
-29465,
-29140,
-29222,
-29021,
-29266,
-29354,
-29102,
-29286,
-29383,
-29616,
-31831,
-35104,
-36507,
-36387,
-36528,
-36513,
-36198,
-36384,
-36467,
-36200,
-36198,
-35150,
-32034,
-29412,
-29005,
-29106,
-28947,
-29265,
-29435,
-29173,
-29311,
-29390,
-29571,
-31732,
-35094,
-36626,
-36492,
-36575,
-36525,
-36100,
-36163,
-36252,
-36063,
-36182,
-35295,
-32177,
-29402,
-28948,
-29099,
-28912,
-29205,
-29500,
-29359,
-29486,
-29491,
-29517,
-31549,
-34988,
-36622,
-36446,
-36531,
-36614,
-36215,
-36187,
-36235,
-36041,
-36201,
-35413,
-32314,
-29426,
-28941,
-29150,
-28906,
-29119,
-29420,
-29262,
-29350,
-29371,
-29374,
-31359,
-34856,
-36591,
-36407,
-36458,
-36562,
-36144,
-36157,
-36292,
-36117,
-36235,
-35539,
-32522,
-29568,
-28991,
-29184,
-28928,
-29196,
-29525,
-29292,
-29354,
-29502,
-29503,
-31293,
-34653,
-36429,
-36302,
-36437,
-36558,
-36107,
-36078,
-36241,
-35922,
-35934,
-35399,
-32636,
-29756,
-29137,
-29303,
-28987,
-29212,
-29558,
-29339,
-29442,
-29692,
-29624,
-31171,
-34476,
-36371,
-36287,
-36334,
-36482,
-36078,
-36097,
-36263,
-35900,
-35887,
-35487,
-32860,
-29841,
-29088,
-29309,
-29084,
-29219,
-29496,
-29274,
-29441,
-29738,
-29656,
-31059,
-34334,
-36368,
-36310,
-36247,
-36404,
-36132,
-36179,
-36300,
-35931,
-35912,
-35554,
-32973,
-29885,
-29036,
-29333,
-29223,
-29323,
-29515,
-29295,
-29417,
-29660,
-29582,
-31011,
-34311,
-36442,
-36416,
-36284,
-36358,
-36078,
-36077,
-36211,
-35945,
-36001,
-35611,
-32976,
-29840,
-28948,
-29267,
-29205,
-29305,
-29516,
-29326,
-29423,
-29615,
-29540,
-31006,
-34349,
-36487,
-36426,
-36222,
-36321,
-36104,
-36144,
-36291,
-36005,
-36021,
-35606,
-32961,
-29797,
-28926,
-29348,
-29312,
-29326,
-29428,
-29210,
-29350,
-29630,
-29549,
-30887,
-34189,
-36411,
-36388,
-36157,
-36289,
-36142,
-36206,
-36317,
-35921,
-35866,
-35605,
-33174,
-30010,
-28995,
-29353,
-29289,
-29302,
-29440,
-29258,
-29425,
-29789,
-29683,
-30857,
-34041,
-36341,
-36376,
-36155,
-36291,
-36102,
-36098,
-36196,
-35816,
-35752,
-35563,
-33226,
-30012,
-28896,
-29254,
-29216,
-29231,
-29456,
-29309,
-29448,
-29791,
-29676,
-30770,
-33954,
-36357,
-36457,
-36203,
-36371,
-36169,
-36120,
-36214,
-35850,
-35737,
-35580,
-33334,
-30090,
-28883,
-29214,
-29167,
-29147,
-29382,
-29275,
-29401,
-29799,
-29734,
-30714,
-33788,
-36250,
-36444,
-36221,
-36409,
-36242,
-36168,
-36284,
-35900,
-35708,
-35558,
-33502,
-30351,
-29053,
-29305,
-29227,
-29149,
-29372,
-29261,
-29378,
-29783,
-29742,
-30579,
-33473,
-35970,
-36320,
-36172,
-36392,
-36250,
-36145,
-36241,
-35900,
-35740,
-35677,
-33770,
-30650,
-29203,
-29341,
-29254,
-29170,
-29402,
-29362,
-29477,
-29827,
-29692,
-30430,
-33270,
-35878,
-36328,
-36143,
-36297,
-36139,
-36017,
-36099,
-35801,
-35710,
-35734,
-33886,
-30723,
-29174,
-29336,
-29344,
-29305,
-29527,
-29446,
-29503,
-29834,
-29697,
-30394,
-33194,
-35800,
-36213,
-35969,
-36123,
-36030,
-35990,
-36188,
-35941,
-35782,
-35735,
-33930,
-30806,
-29342,
-29558,
-29524,
-29360,
-29500,
-29330,
-29300,
-29681,
-29679,
-30392,
-33139,
-35716,
-36113,
-35921,
-36201,
-36136,
-36032,
-36229,
-35990,
-35761,
-35729,
-34039,
-30969,
-29447,
-29610,
-29483,
-29295,
-29540,
-29458,
-29392,
-29746,
-29727,
-30307,
-32964,
-35595,
-36043,
-35855,
-36156,
-36108,
-35996,
-36226,
-35996,
-35712,
-35738,
-34190,
-31123,
-29506,
-29656,
-29591,
-29400,
-29617,
-29479,
-29400,
-29832,
-29842,
-30304,
-32871,
-35583,
-36118,
-35857,
-36071,
-35977,
-35885,
-36153,
-35926,
-35633,
-35719,
-34267,
-31148,
-29422,
-29585,
-29631,
-29502,
-29714,
-29531,
-29414,
-29816,
-29789,
-30184,
-32762,
-35591,
-36198,
-35919,
-36089,
-36000,
-35893,
-36173,
-35976,
-35711,
-35784,
-34278,
-31074,
-29278,
-29456,
-29515,
-29376,
-29596,
-29478,
-29346,
-29692,
-29674,
-30153,
-32823,
-35672,
-36235,
-35906,
-36138,
-36125,
-36008,
-36215,
-36045,
-35806,
-35859,
-34318,
-31117,
-29327,
-29508,
-29517,
-29257,
-29422,
-29375,
-29302,
-29648,
-29618,
-30067,
-32670,
-35517,
-36147,
-35869,
-36120,
-36154,
-36009,
-36205,
-36052,
-35838,
-35913,
-34468,
-31327,
-29458,
-29562,
-29601,
-29385,
-29550,
-29466,
-29334,
-29656,
-29668,
-30068,
-32540,
-35385,
-36105,
-35826,
-36027,
-36035,
-35895,
-36085,
-35933,
-35690,
-35812,
-34551,
-31495,
-29498,
-29507,
-29583,
-29371,
-29546,
-29509,
-29432,
-29776,
-29753,
-29976,
-32302,
-35294,
-36241,
-35968,
-36092,
-36098,
-35954,
-36119,
-35971,
-35695,
-35847,
-34730,
-31661,
-29458,
-29365,
-29518,
-29338,
-29479,
-29467,
-29382,
-29725,
-29777,
-29972,
-32205,
-35235,
-36302,
-36023,
-36135,
-36226,
-36074,
-36163,
-35969,
-35622,
-35712,
-34697,
-31754,
-29502,
-29339,
-29469,
-29242,
-29355,
-29440,
-29439,
-29833,
-29937,
-30099,
-32135,
-35076,
-36230,
-36069,
-36253,
-36363,
-36120,
-36091,
-35870,
-35532,
-35635,
-34700,
-31848,
-29571,
-29319,
-29413,
-29154,
-29277,
-29410,
-29450,
-29828,
-29887,
-29990,
-32009,
-35048,
-36318,
-36131,
-36214,
-36294,
-36129,
-36216,
-36059,
-35727,
-35826,
-34898,
-31966,
-29533,
-29243,
-29440,
-29256,
-29334,
-29330,
-29242,
-29598,
-29703,
-29796,
-31815,
-34940,
-36298,
-36112,
-36176,
-36295,
-36162,
-36267,
-36123,
-35760,
-35889,
-35042,
-32131,
-29616,
-29281,
-29467,
-29266,
-29342,
-29383,
-29288,
-29634,
-29758,
-29850,
-31810,
-34921,
-36293,
-36104,
-36211,
-36340,
-36139,
-36174,
-36044,
-35691,
-35766,
-34911,
-32051,
-29592,
-29299,
-29453,
-29161,
-29222,
-29375,
-29366,
-29719,
-29840,
-29890,
-31778,
-34865,
-36271,
-36124,
-36294,
-36465,
-36207,
-36161,
-36027,
-35709,
-35845,
-35110,
-32268,
-29708,
-29292,
-29413,
-29091,
-29172,
-29371,
-29359,
-29668,
-29745,
-29710,
-31536,
-34738,
-36307,
-36169,
-36275,
-36442,
-36200,
-36175,
-36076,
-35759,
-35908,
-35262,
-32411,
-29683,
-29183,
-29392,
-29134,
-29183,
-29351,
-29323,
-29640,
-29787,
-29744,
-31482,
-34677,
-36343,
-36220,
-36314,
-36534,
-36318,
-36225,
-36076,
-35736,
-35858,
-35261,
-32510,
-29762,
-29181,
-29331,
-29005,
-29003,
-29260,
-29360,
-29703,
-29820,
-29746,
-31383,
-34494,
-36175,
-36139,
-36284,
-36564,
-36342,
-36193,
-36030,
-35730,
-35881,
-35297,
-32623,
-29928,
-29312,
-29413,
-29076,
-29085,
-29319,
-29378,
-29677,
-29771,
-29695,
-31297,
-34377,
-36073,
-36059,
-36169,
-36373,
-36174,
-36154,
-36069,
-35703,
-35806,
-35311,
-32771,
-30068,
-29381,
-29469,
-29233,
-29326,
-29472,
-29347,
-29614,
-29845,
-29740,
-31172,
-34200,
-36050,
-36150,
-36222,
-36312,
-36034,
-36103,
-36145,
-35764,
-35803,
-35434,
-32972,
-30097,
-29197,
-29268,
-29094,
-29238,
-29399,
-29205,
-29413,
-29692,
-29591,
-30912,
-34000,
-36043,
-36207,
-36251,
-36404,
-36200,
-36266,
-36329,
-35949,
-35946,
-35614,
-33194,
-30234,
-29253,
-29360,
-29135,
-29133,
-29272,
-29103,
-29287,
-29538,
-29468,
-30796,
-33906,
-35985,
-36102,
-36157,
-36448,
-36336,
-36356,
-36390,
-36020,
-35976,
-35577,
-33130,
-30211,
-29317,
-29453,
-29092,
-28970,
-29173,
-29142,
-29377,
-29636,
-29554,
-30860,
-33983,
-36053,
-36148,
-36241,
-36587,
-36376,
-36232,
-36234,
-35892,
-35883,
-35551,
-33099,
-30081,
-29152,
-29343,
-29019,
-28967,
-29271,
-29223,
-29377,
-29648,
-29578,
-30817,
-33966,
-36152,
-36234,
-36240,
-36528,
-36259,
-36085,
-36193,
-35945,
-35969,
-35748,
-33419,
-30272,
-29154,
-29313,
-29039,
-28982,
-29317,
-29277,
-29336,
-29537,
-29368,
-30451,
-33565,
-35996,
-36290,
-36305,
-36593,
-36349,
-36157,
-36241,
-36035,
-36054,
-35866,
-33643,
-30499,
-29231,
-29325,
-29081,
-29010,
-29346,
-29365,
-29426,
-29596,
-29481,
-30548,
-33559,
-35905,
-36212,
-36261,
-36629,
-36460,
-36207,
-36176,
-35946,
-35988,
-35820,
-33681,
-30623,
-29367,
-29383,
-29041,
-28856,
-29173,
-29256,
-29406,
-29611,
-29485,
-30471,
-33384,
-35751,
-36129,
-36242,
-36656,
-36522,
-36310,
-36339,
-36091,
-36031,
-35841,
-33788,
-30742,
-29411,
-29422,
-29118,
-28932,
-29208,
-29188,
-29227,
-29515,
-29515,
-30466,
-33351,
-35834,
-36265,
-36261,
-36589,
-36488,
-36331,
-36448,
-36211,
-36020,
-35799,
-33832,
-30722,
-29240,
-29336,
-29180,
-28983,
-29170,
-29143,
-29200,
-29545,
-29588,
-30426,
-33231,
-35832,
-36313,
-36181,
-36484,
-36494,
-36350,
-36374,
-36088,
-35915,
-35778,
-33924,
-30767,
-29151,
-29235,
-29107,
-28835,
-29009,
-29101,
-29242,
-29541,
-29491,
-30265,
-33099,
-35798,
-36371,
-36270,
-36654,
-36658,
-36358,
-36228,
-35946,
-35878,
-35856,
-34065,
-30901,
-29289,
-29348,
-29133,
-28827,
-29105,
-29332,
-29468,
-29733,
-29621,
-30316,
-33065,
-35710,
-36237,
-36191,
-36671,
-36664,
-36324,
-36255,
-36008,
-35853,
-35803,
-34094,
-31024,
-29426,
-29468,
-29192,
-28882,
-29236,
-29419,
-29471,
-29784,
-29798,
-30439,
-33065,
-35694,
-36270,
-36215,
-36645,
-36537,
-36162,
-36167,
-35981,
-35738,
-35657,
-34033,
-30985,
-29319,
-29374,
-29211,
-28965,
-29316,
-29472,
-29483,
-29804,
-29829,
-30392,
-32956,
-35672,
-36321,
-36184,
-36515,
-36458,
-36113,
-36121,
-35917,
-35727,
-35727,
-34224,
-31185,
-29410,
-29451,
-29353,
-29104,
-29399,
-29597,
-29618,
-29823,
-29701,
-30157,
-32663,
-35450,
-36194,
-36053,
-36360,
-36358,
-36028,
-35999,
-35901,
-35828,
-35855,
-34379,
-31384,
-29542,
-29476,
-29369,
-29045,
-29264,
-29437,
-29426,
-29565,
-29538,
-30091,
-32485,
-35191,
-36097,
-36092,
-36398,
-36409,
-36127,
-36146,
-36121,
-35996,
-35983,
-35049,
-33115,
-32150,
-32469,
-32541,
-32270,
-32408,
-32557,
-32527,
-32626,
-32516,
-32631,
-33973,
-35623,
-36075,
-35980,
-36188,
-36167,
-35885,
-35828,
-35741,
-35612,
-35643,
-34944,
-33282,
-32127,
-31985,
-31906,
-31805,
-32020,
-32127,
-32096,
-32235,
-32259,
-32454,
-33670,
-35176,
-35726,
-35723,
-35798,
-35670,
-35453,
-35449,
-35354,
-35199,
-35219,
-34553,
-33002,
-31852,
-31610,
-31506,
-31475,
-31698,
-31788,
-31758,
-31895,
-31850,
-31994,
-33169,
-34678,
-35311,
-35406,
-35545,
-35415,
-35172,
-35179,
-35143,
-35093,
-35164,
-34529,
-32966,
-31836,
-31590,
-31443,
-31322,
-31555,
-31691,
-31641,
-31687,
-31617,
-31768,
-32949,
-34448,
-35001,
-35043,
-35255,
-35260,
-35039,
-35012,
-34957,
-34832,
-34829,
-34217,
-32733,
-31653,
-31494,
-31361,
-31145,
-31285,
-31437,
-31444,
-31596,
-31680,
-31861,
-32966,
-34428,
-34993,
-34976,
-35161,
-35196,
-34992,
-34945,
-34851,
-34616,
-34524,
-33943,
-32490,
-31369,
-31245,
-31236,
-31073,
-31173,
-31284,
-31266,
-31463,
-31632,
-31816,
-32887,
-34397,
-35020,
-34917,
-34985,
-35004,
-34826,
-34837,
-34787,
-34550,
-34446,
-33901,
-32405,
-31175,
-31045,
-31152,
-31051,
-31167,
-31265,
-31207,
-31343,
-31489,
-31635,
-32661,
-34261,
-34940,
-34783,
-34760,
-34761,
-34560,
-34549,
-34543,
-34354,
-34317,
-33875,
-32415,
-31092,
-30923,
-31100,
-31061,
-31200,
-31329,
-31252,
-31312,
-31388,
-31449,
-32401,
-34044,
-34861,
-34728,
-34650,
-34644,
-34488,
-34514,
-34569,
-34445,
-34437,
-34057,
-32617,
-31222,
-30975,
-31181,
-31148,
-31175,
-31211,
-31124,
-31238,
-31315,
-31298,
-32118,
-33732,
-34666,
-34625,
-34572,
-34606,
-34536,
-34582,
-34568,
-34407,
-34478,
-34240,
-32891,
-31421,
-31014,
-31124,
-31083,
-31109,
-31132,
-31076,
-31208,
-31248,
-31152,
-31915,
-33558,
-34573,
-34627,
-34592,
-34622,
-34520,
-34549,
-34524,
-34381,
-34488,
-34270,
-32910,
-31407,
-30961,
-31025,
-30960,
-31002,
-31080,
-31043,
-31182,
-31230,
-31154,
-31929,
-33539,
-34527,
-34587,
-34615,
-34678,
-34542,
-34521,
-34496,
-34363,
-34437,
-34190,
-32863,
-31416,
-30995,
-31023,
-30895,
-30940,
-31074,
-31070,
-31174,
-31216,
-31162,
-31948,
-33545,
-34536,
-34605,
-34650,
-34702,
-34540,
-34488,
-34496,
-34399,
-34472,
-34196,
-32825,
-31345,
-30923,
-31015,
-30952,
-31004,
-31090,
-31036,
-31129,
-31192,
-31178,
-31979,
-33603,
-34604,
-34634,
-34634,
-34708,
-34600,
-34558,
-34503,
-34334,
-34399,
-34180,
-32840,
-31313,
-30849,
-30951,
-30895,
-30932,
-31036,
-31058,
-31225,
-31318,
-31225,
-31947,
-33570,
-34619,
-34666,
-34642,
-34706,
-34565,
-34496,
-34428,
-34287,
-34404,
-34238,
-32926,
-31371,
-30899,
-31021,
-30951,
-30972,
-31078,
-31068,
-31169,
-31223,
-31164,
-31907,
-33548,
-34580,
-34576,
-34524,
-34634,
-34541,
-34500,
-34473,
-34339,
-34385,
-34165,
-32878,
-31380,
-30957,
-31084,
-30964,
-30936,
-31044,
-31060,
-31149,
-31206,
-31155,
-31873,
-33472,
-34525,
-34535,
-34501,
-34620,
-34545,
-34501,
-34481,
-34351,
-34378,
-34171,
-32915,
-31391,
-30920,
-31050,
-31000,
-31001,
-31091,
-31067,
-31134,
-31225,
-31181,
-31854,
-33436,
-34526,
-34575,
-34494,
-34558,
-34461,
-34436,
-34470,
-34358,
-34383,
-34201,
-32962,
-31429,
-30912,
-31095,
-31086,
-31080,
-31134,
-31073,
-31136,
-31238,
-31191,
-31823,
-33392,
-34521,
-34574,
-34456,
-34505,
-34435,
-34424,
-34463,
-34340,
-34366,
-34217,
-33056,
-31518,
-30982,
-31125,
-31105,
-31080,
-31148,
-31112,
-31173,
-31252,
-31171,
-31752,
-33292,
-34439,
-34507,
-34393,
-34488,
-34463,
-34461,
-34478,
-34337,
-34356,
-34237,
-33084,
-31542,
-30975,
-31159,
-31155,
-31066,
-31059,
-30995,
-31088,
-31228,
-31183,
-31748,
-33264,
-34425,
-34487,
-34349,
-34461,
-34515,
-34548,
-34541,
-34361,
-34364,
-34305,
-33202,
-31602,
-30921,
-31044,
-31048,
-30984,
-31002,
-30965,
-31034,
-31116,
-30998,
-31520,
-33099,
-34427,
-34599,
-34446,
-34509,
-34516,
-34542,
-34594,
-34481,
-34519,
-34425,
-33292,
-31597,
-30863,
-31018,
-31067,
-30996,
-31017,
-30969,
-31002,
-31069,
-31001,
-31532,
-33141,
-34490,
-34627,
-34424,
-34493,
-34536,
-34533,
-34570,
-34470,
-34487,
-34390,
-33263,
-31538,
-30779,
-30977,
-31066,
-30994,
-31036,
-31031,
-31071,
-31159,
-31097,
-31600,
-33176,
-34562,
-34705,
-34462,
-34538,
-34561,
-34502,
-34469,
-34341,
-34359,
-34342,
-33332,
-31627,
-30820,
-30996,
-31063,
-30971,
-31040,
-31083,
-31150,
-31233,
-31099,
-31473,
-33002,
-34453,
-34678,
-34473,
-34579,
-34606,
-34518,
-34479,
-34332,
-34350,
-34399,
-33466,
-31752,
-30877,
-31000,
-31039,
-30933,
-31020,
-31082,
-31162,
-31275,
-31123,
-31396,
-32860,
-34337,
-34615,
-34452,
-34552,
-34556,
-34463,
-34468,
-34360,
-34378,
-34465,
-33570,
-31821,
-30902,
-31032,
-31107,
-31012,
-31059,
-31020,
-31024,
-31163,
-31052,
-31332,
-32799,
-34334,
-34630,
-34412,
-34469,
-34480,
-34460,
-34556,
-34435,
-34389,
-34453,
-33612,
-31871,
-30889,
-31002,
-31077,
-30988,
-31005,
-30914,
-30885,
-31067,
-31027,
-31291,
-32710,
-34256,
-34599,
-34421,
-34534,
-34594,
-34595,
-34673,
-34534,
-34415,
-34460,
-33640,
-31903,
-30863,
-30925,
-30957,
-30819,
-30863,
-30857,
-30878,
-31078,
-31046,
-31265,
-32650,
-34236,
-34667,
-34534,
-34664,
-34717,
-34633,
-34660,
-34539,
-34427,
-34476,
-33718,
-32024,
-30940,
-30942,
-30936,
-30765,
-30842,
-30895,
-30924,
-31095,
-31075,
-31281,
-32591,
-34196,
-34706,
-34613,
-34724,
-34731,
-34577,
-34586,
-34503,
-34409,
-34434,
-33704,
-32029,
-30880,
-30814,
-30860,
-30788,
-30927,
-30984,
-30962,
-31097,
-31097,
-31324,
-32631,
-34240,
-34770,
-34654,
-34697,
-34684,
-34548,
-34580,
-34497,
-34385,
-34414,
-33702,
-32053,
-30892,
-30841,
-30924,
-30873,
-30967,
-30978,
-30955,
-31117,
-31126,
-31303,
-32557,
-34153,
-34683,
-34535,
-34572,
-34596,
-34530,
-34573,
-34461,
-34357,
-34435,
-33792,
-32133,
-30947,
-30898,
-31025,
-30955,
-30987,
-30953,
-30976,
-31195,
-31175,
-31266,
-32488,
-34128,
-34712,
-34557,
-34562,
-34605,
-34589,
-34645,
-34479,
-34302,
-34411,
-33855,
-32227,
-30983,
-30874,
-30995,
-30934,
-30964,
-30921,
-30932,
-31167,
-31162,
-31212,
-32373,
-34043,
-34731,
-34628,
-34609,
-34590,
-34559,
-34662,
-34553,
-34375,
-34484,
-33969,
-32356,
-31031,
-30826,
-30925,
-30902,
-30976,
-30932,
-30902,
-31129,
-31150,
-31171,
-32268,
-33930,
-34677,
-34620,
-34625,
-34607,
-34553,
-34634,
-34511,
-34324,
-34453,
-34003,
-32416,
-31070,
-30850,
-30941,
-30910,
-30990,
-30966,
-30906,
-31121,
-31147,
-31161,
-32259,
-33992,
-34752,
-34622,
-34607,
-34616,
-34555,
-34616,
-34509,
-34318,
-34392,
-33925,
-32321,
-30942,
-30753,
-30882,
-30835,
-30915,
-30955,
-30951,
-31164,
-31207,
-31238,
-32313,
-34031,
-34804,
-34664,
-34640,
-34650,
-34541,
-34540,
-34442,
-34295,
-34387,
-33933,
-32355,
-30973,
-30758,
-30896,
-30838,
-30913,
-30999,
-31028,
-31167,
-31140,
-31158,
-32233,
-33927,
-34708,
-34634,
-34626,
-34667,
-34546,
-34525,
-34437,
-34343,
-34464,
-34026,
-32479,
-31112,
-30857,
-30973,
-30915,
-30964,
-31000,
-30998,
-31135,
-31088,
-31073,
-32100,
-33792,
-34625,
-34543,
-34517,
-34572,
-34547,
-34579,
-34480,
-34338,
-34458,
-34069,
-32537,
-31105,
-30807,
-30948,
-30889,
-30863,
-30850,
-30868,
-31088,
-31125,
-31086,
-32057,
-33763,
-34680,
-34610,
-34551,
-34643,
-34661,
-34692,
-34568,
-34384,
-34476,
-34138,
-32640,
-31155,
-30833,
-31012,
-30956,
-30871,
-30867,
-30873,
-31058,
-31098,
-31089,
-32014,
-33699,
-34629,
-34557,
-34486,
-34603,
-34620,
-34644,
-34572,
-34419,
-34483,
-34159,
-32740,
-31271,
-30901,
-31037,
-30971,
-30938,
-30972,
-30934,
-31034,
-31069,
-31079,
-31940,
-33597,
-34563,
-34546,
-34498,
-34593,
-34556,
-34574,
-34567,
-34442,
-34475,
-34145,
-32763,
-31303,
-30932,
-31048,
-30938,
-30878,
-30911,
-30859,
-30968,
-31055,
-31082,
-31891,
-33493,
-34469,
-34492,
-34507,
-34627,
-34595,
-34629,
-34655,
-34524,
-34548,
-34272,
-32933,
-31434,
-30987,
-31047,
-30934,
-30893,
-30922,
-30855,
-30946,
-31013,
-30936,
-31692,
-33348,
-34428,
-34504,
-34512,
-34624,
-34577,
-34629,
-34665,
-34524,
-34579,
-34388,
-33085,
-31519,
-31013,
-31080,
-30980,
-30928,
-30927,
-30836,
-30942,
-31021,
-30918,
-31601,
-33270,
-34433,
-34521,
-34490,
-34612,
-34623,
-34674,
-34674,
-34501,
-34572,
-34420,
-33147,
-31521,
-30932,
-31016,
-30961,
-30887,
-30878,
-30840,
-30975,
-31059,
-30961,
-31642,
-33278,
-34466,
-34596,
-34553,
-34640,
-34637,
-34687,
-34671,
-34499,
-34523,
-34354,
-33138,
-31576,
-30967,
-31003,
-30945,
-30907,
-30905,
-30834,
-30953,
-31081,
-31031,
-31625,
-33176,
-34365,
-34595,
-34584,
-34651,
-34608,
-34655,
-34692,
-34525,
-34512,
-34360,
-33207,
-31642,
-30971,
-30964,
-30910,
-30924,
-30967,
-30867,
-30951,
-31099,
-31059,
-31584,
-33095,
-34338,
-34587,
-34564,
-34607,
-34543,
-34585,
-34628,
-34437,
-34403,
-34355,
-33308,
-31727,
-30989,
-30983,
-30947,
-30959,
-31034,
-30928,
-30972,
-31125,
-31065,
-31528,
-33007,
-34287,
-34527,
-34485,
-34522,
-34442,
-34476,
-34577,
-34407,
-34367,
-34324,
-33333,
-31744,
-31017,
-31044,
-31026,
-31021,
-31105,
-30980,
-31011,
-31171,
-31094,
-31496,
-32997,
-34328,
-34547,
-34455,
-34521,
-34488,
-34484,
-34541,
-34393,
-34403,
-34396,
-33358,
-31721,
-30974,
-31043,
-31009,
-30988,
-31088,
-31032,
-31051,
-31159,
-31027,
-31435,
-32960,
-34341,
-34565,
-34469,
-34518,
-34448,
-34410,
-34494,
-34396,
-34402,
-34423,
-33452,
-31816,
-31019,
-31065,
-31039,
-31014,
-31129,
-31093,
-31085,
-31172,
-31062,
-31431,
-32871,
-34213,
-34495,
-34432,
-34482,
-34366,
-34329,
-34462,
-34403,
-34390,
-34390,
-33460,
-31859,
-31064,
-31100,
-31082,
-31056,
-31202,
-31130,
-31077,
-31152,
-31076,
-31425,
-32844,
-34199,
-34493,
-34438,
-34501,
-34401,
-34359,
-34495,
-34428,
-34369,
-34381,
-33514,
-31915,
-31060,
-31085,
-31071,
-31051,
-31173,
-31102,
-31037,
-31174,
-31132,
-31428,
-32793,
-34200,
-34526,
-34391,
-34434,
-34399,
-34382,
-34486,
-34401,
-34335,
-34347,
-33504,
-31921,
-31056,
-31109,
-31156,
-31105,
-31159,
-31068,
-31058,
-31221,
-31146,
-31391,
-32756,
-34175,
-34497,
-34345,
-34408,
-34395,
-34389,
-34480,
-34373,
-34324,
-34414,
-33610,
-31983,
-31046,
-31084,
-31125,
-31097,
-31207,
-31131,
-31064,
-31167,
-31070,
-31300,
-32670,
-34193,
-34604,
-34457,
-34463,
-34421,
-34397,
-34486,
-34408,
-34395,
-34480,
-33689,
-32033,
-31021,
-31018,
-31097,
-31079,
-31119,
-31065,
-31080,
-31236,
-31088,
-31254,
-32612,
-34153,
-34575,
-34423,
-34446,
-34461,
-34432,
-34484,
-34363,
-34328,
-34444,
-33748,
-32120,
-31044,
-30992,
-31104,
-31093,
-31135,
-31081,
-31113,
-31253,
-31107,
-31246,
-32563,
-34130,
-34594,
-34446,
-34448,
-34422,
-34367,
-34443,
-34372,
-34321,
-34423,
-33734,
-32125,
-31068,
-31049,
-31137,
-31093,
-31186,
-31152,
-31125,
-31297,
-31236,
-31318,
-32511,
-34063,
-34545,
-34377,
-34414,
-34408,
-34323,
-34384,
-34343,
-34244,
-34334,
-33754,
-32195,
-31094,
-31082,
-31197,
-31132,
-31203,
-31176,
-31100,
-31244,
-31223,
-31278,
-32398,
-33984,
-34542,
-34363,
-34357,
-34380,
-34306,
-34388,
-34342,
-34259,
-34408,
-33892,
-32295,
-31114,
-31097,
-31216,
-31119,
-31213,
-31242,
-31147,
-31248,
-31217,
-31247,
-32339,
-33954,
-34538,
-34328,
-34362,
-34442,
-34377,
-34408,
-34339,
-34238,
-34383,
-33901,
-32342,
-31142,
-31091,
-31197,
-31052,
-31106,
-31177,
-31153,
-31265,
-31222,
-31244,
-32300,
-33874,
-34487,
-34352,
-34402,
-34470,
-34404,
-34437,
-34358,
-34237,
-34383,
-33954,
-32407,
-31149,
-31071,
-31227,
-31093,
-31082,
-31128,
-31131,
-31257,
-31220,
-31225,
-32269,
-33853,
-34495,
-34327,
-34330,
-34434,
-34403,
-34452,
-34390,
-34283,
-34404,
-34010,
-32520,
-31228,
-31072,
-31246,
-31152,
-31125,
-31106,
-31117,
-31273,
-31198,
-31122,
-32125,
-33788,
-34507,
-34371,
-34410,
-34526,
-34444,
-34454,
-34417,
-34328,
-34434,
-34041,
-32575,
-31265,
-31049,
-31129,
-30978,
-31004,
-31084,
-31093,
-31226,
-31193,
-31152,
-32122,
-33746,
-34489,
-34408,
-34497,
-34596,
-34483,
-34460,
-34399,
-34275,
-34411,
-34039,
-32532,
-31214,
-31057,
-31118,
-30927,
-31001,
-31119,
-31050,
-31188,
-31285,
-31248,
-32096,
-33706,
-34516,
-34435,
-34491,
-34583,
-34453,
-34440,
-34391,
-34187,
-34285,
-34061,
-32655,
-31204,
-30937,
-31099,
-30998,
-30991,
-31027,
-30990,
-31194,
-31281,
-31183,
-32004,
-33648,
-34514,
-34422,
-34443,
-34563,
-34471,
-34473,
-34421,
-34262,
-34364,
-34111,
-32716,
-31333,
-31078,
-31177,
-31014,
-31005,
-31067,
-31030,
-31188,
-31247,
-31144,
-31939,
-33556,
-34410,
-34371,
-34439,
-34584,
-34478,
-34459,
-34446,
-34317,
-34421,
-34127,
-32747,
-31406,
-31153,
-31205,
-30996,
-30988,
-31060,
-30997,
-31122,
-31199,
-31136,
-31960,
-33582,
-34445,
-34387,
-34443,
-34595,
-34515,
-34547,
-34542,
-34366,
-34451,
-34234,
-32867,
-31389,
-31047,
-31141,
-30973,
-30964,
-31076,
-31028,
-31096,
-31130,
-31056,
-31861,
-33537,
-34527,
-34497,
-34513,
-34662,
-34569,
-34529,
-34525,
-34389,
-34424,
-34143,
-32799,
-31324,
-30960,
-31094,
-30962,
-30936,
-31010,
-30980,
-31079,
-31230,
-31257,
-32040,
-33640,
-34595,
-34518,
-34439,
-34553,
-34500,
-34491,
-34474,
-34291,
-34287,
-34038,
-32720,
-31233,
-30896,
-31084,
-31009,
-31005,
-31108,
-31073,
-31197,
-31335,
-31276,
-31942,
-33575,
-34610,
-34519,
-34412,
-34549,
-34495,
-34453,
-34402,
-34178,
-34210,
-34119,
-32895,
-31342,
-30958,
-31180,
-31029,
-30930,
-31096,
-31119,
-31213,
-31347,
-31290,
-31854,
-33410,
-34514,
-34482,
-34374,
-34560,
-34551,
-34460,
-34417,
-34243,
-34251,
-34142,
-32951,
-31391,
-30961,
-31216,
-31100,
-30960,
-31114,
-31154,
-31161,
-31223,
-31191,
-31794,
-33356,
-34469,
-34433,
-34282,
-34479,
-34453,
-34396,
-34456,
-34359,
-34285,
-34098,
-32994,
-31476,
-30993,
-31236,
-31132,
-30902,
-30976,
-31021,
-31085,
-31190,
-31185,
-31739,
-33268,
-34455,
-34464,
-34324,
-34559,
-34611,
-34440,
-34355,
-34305,
-34389,
-34234,
-33027,
-31431,
-30879,
-31095,
-31040,
-30902,
-30980,
-31033,
-31129,
-31200,
-31111,
-31711,
-33349,
-34543,
-34537,
-34403,
-34557,
-34516,
-34467,
-34494,
-34329,
-34285,
-34220,
-33062,
-31367,
-30813,
-31118,
-31090,
-30942,
-31077,
-31114,
-31120,
-31215,
-31251,
-31873,
-33392,
-34497,
-34525,
-34408,
-34504,
-34379,
-34334,
-34397,
-34217,
-34178,
-34205,
-33176,
-31504,
-30854,
-31092,
-31110,
-31081,
-31226,
-31158,
-31141,
-31264,
-31174,
-31581,
-33148,
-34487,
-34564,
-34361,
-34478,
-34438,
-34341,
-34410,
-34324,
-34287,
-34248,
-33257,
-31616,
-30865,
-31016,
-31083,
-31048,
-31118,
-31042,
-31079,
-31256,
-31160,
-31505,
-33037,
-34459,
-34614,
-34377,
-34461,
-34468,
-34391,
-34410,
-34289,
-34278,
-34294,
-33327,
-31639,
-30871,
-31061,
-31087,
-30980,
-31123,
-31162,
-31156,
-31223,
-31156,
-31540,
-33028,
-34408,
-34580,
-34342,
-34423,
-34426,
-34344,
-34383,
-34269,
-34206,
-34224,
-33352,
-31742,
-30972,
-31166,
-31207,
-31088,
-31165,
-31126,
-31051,
-31208,
-31212,
-31510,
-32857,
-34278,
-34545,
-34351,
-34431,
-34412,
-34344,
-34444,
-34368,
-34286,
-34324,
-33511,
-31825,
-30898,
-31055,
-31146,
-31014,
-31068,
-31075,
-31126,
-31270,
-31140,
-31335,
-32737,
-34267,
-34605,
-34472,
-34563,
-34485,
-34334,
-34386,
-34330,
-34299,
-34363,
-33513,
-31820,
-30926,
-31049,
-31101,
-31031,
-31131,
-31120,
-31131,
-31282,
-31197,
-31497,
-32957,
-34352,
-34514,
-34351,
-34528,
-34515,
-34389,
-34398,
-34263,
-34206,
-34294,
-33482,
-31835,
-30921,
-31007,
-31061,
-31006,
-31130,
-31187,
-31241,
-31296,
-31103,
-31416,
-32865,
-34247,
-34517,
-34457,
-34573,
-34449,
-34274,
-34293,
-34235,
-34229,
-34243,
-33395,
-31801,
-30939,
-31010,
-31087,
-31034,
-31108,
-31171,
-31264,
-31384,
-31257,
-31540,
-32873,
-34229,
-34578,
-34488,
-34548,
-34521,
-34430,
-34382,
-34144,
-34063,
-34231,
-33615,
-32051,
-30980,
-30934,
-31001,
-30932,
-31004,
-31110,
-31194,
-31299,
-31242,
-31498,
-32701,
-34058,
-34556,
-34577,
-34635,
-34532,
-34424,
-34482,
-34367,
-34234,
-34289,
-33658,
-32103,
-31014,
-30975,
-31039,
-30906,
-30934,
-31060,
-31197,
-31329,
-31203,
-31367,
-32577,
-33997,
-34463,
-34411,
-34526,
-34573,
-34536,
-34527,
-34279,
-34159,
-34318,
-33759,
-32256,
-31164,
-30982,
-30963,
-30995,
-31160,
-31132,
-31156,
-31365,
-31263,
-31356,
-32585,
-34060,
-34504,
-34426,
-34509,
-34484,
-34376,
-34349,
-34177,
-34143,
-34301,
-33669,
-32136,
-31101,
-30966,
-31008,
-31048,
-31073,
-30982,
-31128,
-31471,
-31348,
-31382,
-32573,
-34056,
-34546,
-34450,
-34412,
-34364,
-34423,
-34531,
-34368,
-34282,
-34382,
-33678,
-32130,
-31144,
-31034,
-31000,
-30982,
-31087,
-31029,
-31034,
-31332,
-31349,
-31371,
-32410,
-33920,
-34581,
-34552,
-34534,
-34437,
-34355,
-34462,
-34335,
-34123,
-34231,
-33810,
-32291,
-31014,
-30924,
-31093,
-31028,
-31113,
-31182,
-31108,
-31243,
-31372,
-31505,
-32444,
-33935,
-34582,
-34434,
-34417,
-34497,
-34410,
-34343,
-34211,
-34065,
-34213,
-33889,
-32460,
-31136,
-30934,
-31132,
-31139,
-31223,
-31274,
-31273,
-31388,
-31311,
-31260,
-32248,
-33883,
-34615,
-34481,
-34351,
-34336,
-34391,
-34512,
-34288,
-34061,
-34300,
-33965,
-32420,
-31176,
-31119,
-31286,
-31173,
-31116,
-31040,
-31104,
-31411,
-31398,
-31357,
-32420,
-33902,
-34357,
-34214,
-34349,
-34463,
-34443,
-34506,
-34286,
-34033,
-34221,
-33911,
-32462,
-31262,
-31108,
-31148,
-31117,
-31313,
-31345,
-31094,
-31045,
-31057,
-31200,
-32270,
-33851,
-34548,
-34390,
-34333,
-34444,
-34478,
-34496,
-34409,
-34319,
-34377,
-33914,
-32557,
-31381,
-31179,
-31303,
-31236,
-31112,
-31021,
-31083,
-31341,
-31354,
-31321,
-32250,
-33775,
-34516,
-34393,
-34344,
-34429,
-34515,
-34628,
-34488,
-34213,
-34266,
-33931,
-32473,
-31165,
-31142,
-31423,
-31218,
-31011,
-30975,
-30961,
-31189,
-31335,
-31342,
-32210,
-33785,
-34412,
-34178,
-34430,
-34867,
-34623,
-34310,
-34315,
-34197,
-34005,
-33742,
-32829,
-31571,
-30984,
-31017,
-31111,
-31055,
-30918,
-30996,
-31421,
-31560,
-31458,
-32184,
-33675,
-34455,
-34405,
-34413,
-34575,
-34647,
-34598,
-34233,
-33894,
-34082,
-33889,
-32570,
-31334,
-31204,
-31351,
-31134,
-30914,
-30840,
-31069,
-31576,
-31663,
-31528,
-32415,
-33977,
-34585,
-34381,
-34505,
-34734,
-34570,
-34316,
-34170,
-34157,
-34265,
-33829,
-32447,
-31175,
-30847,
-30921,
-30917,
-31000,
-31132,
-31248,
-31375,
-31306,
-31305,
-31972,
-32700,
-32392,
-31572,
-31427,
-31703,
-31644,
-31395,
-31359,
-31459,
-31547,
-31504,
-31342,
-31224,
-31246,
-31257,
-31238,
-31308,
-31435,
-31542,
-31579,
-31523,
-31532,
-31686,
-31769,
-31726,
-31772,
-31889,
-31827,
-31694,
-31668,
-31691,
-31738,
-31836,
-31798,
-31629,
-31596,
-31690,
-31752,
-31809,
-31879,
-31862,
-31803,
-31834,
-31871,
-31938,
-32073,
-32152,
-32082,
-32042,
-32092,
-32143,
-32224,
-32229,
-32115,
-32035,
-32106,
-32099,
-32025,
-32058,
-32101,
-32011,
-31959,
-32014,
-32039,
-32075,
-32112,
-32085,
-32100,
-32247,
-32333,
-32333,
-32418,
-32496,
-32399,
-32305,
-32343,
-32357,
-32318,
-32291,
-32224,
-32149,
-32136,
-32115,
-32054,
-32110,
-32224,
-32250,
-32248,
-32319,
-32395,
-32422,
-32440,
-32421,
-32408,
-32459,
-32503,
-32490,
-32465,
-32429,
-32365,
-32333,
-32360,
-32367,
-32309,
-32215,
-32189,
-32263,
-32349,
-32352,
-32353,
-32442,
-32525,
-32564,
-32590,
-32623,
-32625,
-32616,
-32543,
-32509,
-32568,
-32638,
-32554,
-32446,
-32442,
-32446,
-32412,
-32404,
-32390,
-32357,
-32378,
-32421,
-32397,
-32416,
-32515,
-32581,
-32582,
-32616,
-32619,
-32610,
-32638,
-32677,
-32649,
-32600,
-32596,
-32565,
-32534,
-32539,
-32548,
-32531,
-32501,
-32499,
-32529,
-32577,
-32618,
-32625,
-32661,
-32695,
-32694,
-32667,
-32656,
-32663,
-32683,
-32692,
-32641,
-32603,
-32615,
-32670,
-32684,
-32647,
-32585,
-32572,
-32602,
-32609,
-32594,
-32623,
-32658,
-32631,
-32590,
-32600,
-32596,
-32593,
-32625,
-32640,
-32623,
-32655,
-32708,
-32695,
-32683,
-32720,
-32723,
-32660,
-32632,
-32626,
-32641,
-32697,
-32713,
-32627,
-32592,
-32653,
-32679,
-32639,
-32630,
-32644,
-32622,
-32618,
-32623,
-32610,
-32618,
-32681,
-32708,
-32706,
-32733,
-32749,
-32750,
-32783,
-32816,
-32769,
-32744,
-32760,
-32745,
-32694,
-32694,
-32707,
-32649,
-32607,
-32652,
-32683,
-32653,
-32621,
-32652,
-32696,
-32736,
-32757,
-32733,
-32721,
-32772,
-32825,
-32787,
-32741,
-32787,
-32848,
-32804,
-32719,
-32682,
-32678,
-32688,
-32721,
-32736,
-32704,
-32676,
-32677,
-32656,
-32650,
-32701,
-32754,
-32726,
-32694,
-32720,
-32784,
-32793,
-32776,
-32783,
-32783,
-32781,
-32770,
-32753,
-32735,
-32751,
-32765,
-32741,
-32721,
-32727,
-32720,
-32694,
-32701,
-32721,
-32723,
-32692,
-32681,
-32680,
-32691,
-32696,
-32701,
-32729,
-32774,
-32807,
-32805,
-32786,
-32756,
-32747,
-32780,
-32795,
-32765,
-32720,
-32703,
-32683,
-32678,
-32683,
-32691,
-32682,
-32702,
-32749,
-32764,
-32751,
-32769,
-32811,
-32831,
-32826,
-32824,
-32826,
-32791,
-32769,
-32765,
-32781,
-32807,
-32816,
-32786,
-32742,
-32725,
-32722,
-32700,
-32699,
-32736,
-32760,
-32740,
-32705,
-32707,
-32750,
-32784,
-32773,
-32769,
-32790,
-32798,
-32772,
-32750,
-32760,
-32750,
-32735,
-32716,
-32711,
-32710,
-32705,
-32686,
-32687,
-32726,
-32781,
-32796,
-32778,
-32754,
-32767,
-32800,
-32823,
-32807,
-32798,
-32794,
-32801,
-32773,
-32743,
-32713,
-32735,
-32779,
-32789,
-32778,
-32770,
-32755,
-32734,
-32740,
-32787,
-32812,
-32802,
-32788,
-32788,
-32778,
-32753,
-32742,
-32753,
-32780,
-32794,
-32776,
-32759,
-32751,
-32771,
-32802,
-32816,
-32811,
-32836,
-32855,
-32844,
-32801,
-32799,
-32822,
-32824,
-32806,
-32765,
-32738,
-32724,
-32724,
-32708,
-32702,
-32722,
-32738,
-32730,
-32746,
-32772,
-32793,
-32807,
-32821,
-32820,
-32808,
-32810,
-32807,
-32784,
-32772,
-32775,
-32767,
-32750,
-32755,
-32772,
-32772,
-32769,
-32755,
-32767,
-32786,
-32795,
-32794,
-32781,
-32780,
-32765,
-32776,
-32791,
-32795,
-32779,
-32772,
-32775,
-32767,
-32762,
-32761,
-32768,
-32797,
-32808,
-32795,
-32792,
-32813,
-32811,
-32786,
-32773,
-32765,
-32754,
-32753,
-32744,
-32725,
-32727,
-32745,
-32743,
-32729,
-32757,
-32789,
-32785,
-32764,
-32763,
-32779,
-32826,
-32832,
-32779,
-32759,
-32790,
-32788,
-32735,
-32722,
-32757,
-32769,
-32753,
-32732,
-32724,
-32732,
-32759,
-32767,
-32768,
-32803,
-32829,
-32817,
-32810,
-32828,
-32847,
-32843,
-32819,
-32821,
-32811,
-32797,
-32767,
-32749,
-32738,
-32721,
-32718,
-32715,
-32708,
-32714,
-32727,
-32721,
-32719,
-32746,
-32773,
-32786,
-32790,
-32827,
-32822,
-32800,
-32798,
-32811,
-32809,
-32785,
-32764,
-32748,
-32712,
-32686,
-32668,
-32696,
-32714,
-32719,
-32701,
-32703,
-32733,
-32765,
-32770,
-32772,
-32782,
-32793,
-32792,
-32793,
-32793,
-32789,
-32783,
-32788,
-32783,
-32785,
-32793,
-32777,
-32753,
-32744,
-32759,
-32761,
-32748,
-32747,
-32738,
-32738,
-32733,
-32735,
-32735,
-32743,
-32754,
-32740,
-32723,
-32727,
-32753,
-32759,
-32749,
-32763,
-32790,
-32794,
-32767,
-32778,
-32779,
-32773,
-32751,
-32753,
-32760,
-32738,
-32733,
-32725,
-32733,
-32745,
-32755,
-32750,
-32754,
-32773,
-32780,
-32774,
-32794,
-32815,
-32806,
-32808,
-32824,
-32820,
-32800,
-32792,
-32783,
-32780,
-32792,
-32789,
-32765,
-32773,
-32794,
-32780,
-32760,
-32793,
-32807,
-32793,
-32798,
-32823,
-32823,
-32818,
-32843,
-32860,
-32846,
-32848,
-32847,
-32819,
-32793,
-32794,
-32798,
-32776,
-32765,
-32758,
-32772,
-32746,
-32730,
-32718,
-32739,
-32744,
-32748,
-32761,
-32777,
-32802,
-32805,
-32809,
-32800,
-32794,
-32794,
-32786,
-32769,
-32755,
-32759,
-32758,
-32747,
-32724,
-32720,
-32742,
-32750,
-32756,
-32750,
-32772,
-32786,
-32788,
-32784,
-32785,
-32796,
-32794,
-32805,
-32808,
-32812,
-32817,
-32804,
-32801,
-32795,
-32808,
-32802,
-32788,
-32771,
-32763,
-32769,
-32763,
-32751,
-32734,
-32742,
-32749,
-32745,
-32750,
-32767,
-32788,
-32796,
-32786,
-32762,
-32778,
-32819,
-32831,
-32819,
-32813,
-32816,
-32804,
-32787,
-32795,
-32789,
-32776,
-32763,
-32745,
-32725,
-32723,
-32729,
-32741,
-32745,
-32747,
-32745,
-32748,
-32763,
-32776,
-32792,
-32797,
-32795,
-32783,
-32783,
-32774,
-32770,
-32778,
-32771,
-32753,
-32742,
-32759,
-32762,
-32745,
-32736,
-32742,
-32732,
-32727,
-32738,
-32760,
-32769,
-32774,
-32765,
-32763,
-32766,
-32765,
-32771,
-32771,
-32767,
-32766,
-32767,
-32766,
-32746,
-32756,
-32776,
-32763,
-32740,
-32746,
-32764,
-32754,
-32758,
-32767,
-32759,
-32746,
-32756,
-32768,
-32767,
-32768,
-32767,
-32751,
-32757,
-32761,
-32741,
-32733,
-32756,
-32766,
-32756,
-32766,
-32784,
-32762,
-32749,
-32757,
-32767,
-32760,
-32749,
-32755,
-32742,
-32740,
-32725,
-32725,
-32730,
-32737,
-32751,
-32766,
-32755,
-32746,
-32745,
-32761,
-32751,
-32778,
-32796,
-32788,
-32767,
-32782,
-32791,
-32780,
-32790,
-32794,
-32767,
-32756,
-32782,
-32784,
-32770,
-32777,
-32799,
-32786,
-32783,
-32793,
-32792,
-32782,
-32792,
-32767,
-32764,
-32768,
-32787,
-32776,
-32783,
-32778,
-32776,
-32773,
-32792,
-32784,
-32778,
-32777,
-32771,
-32761,
-32774,
-32789,
-32778,
-32774,
-32772,
-32762,
-32747,
-32771,
-32776,
-32764,
-32745,
-32736,
-32736,
-32742,
-32751,
-32755,
-32755,
-32762,
-32752,
-32755,
-32760,
-32764,
-32765,
-32783,
-32783,
-32775,
-32770,
-32785,
-32782,
-32793,
-32813,
-32806,
-32787,
-32776,
-32780,
-32773,
-32769,
-32764,
-32757,
-32760,
-32762,
-32765,
-32761,
-32781,
-32772,
-32786,
-32785,
-32786,
-32782,
-32810,
-32819,
-32802,
-32800,
-32828,
-32833,
-32814,
-32808,
-32806,
-32794,
-32798,
-32803,
-32800,
-32789,
-32778,
-32757,
-32745,
-32756,
-32778,
-32777,
-32779,
-32772,
-32771,
-32775,
-32786,
-32800,
-32809,
-32809,
-32803,
-32802,
-32794,
-32798,
-32785,
-32788,
-32786,
-32798,
-32785,
-32777,
-32751,
-32759,
-32771,
-32777,
-32769,
-32770,
-32779,
-32787,
-32786,
-32782,
-32778,
-32779,
-32790,
-32777,
-32775,
-32787,
-32794,
-32778,
-32779,
-32787,
-32790,
-32771,
-32763,
-32769,
-32772,
-32772,
-32771,
-32776,
-32784,
-32783,
-32784,
-32782,
-32784,
-32771,
-32773,
-32767,
-32762,
-32751,
-32754,
-32756,
-32757,
-32773,
-32775,
-32767,
-32759,
-32765,
-32774,
-32767,
-32769,
-32777,
-32777,
-32778,
-32785,
-32790,
-32785,
-32777,
-32773,
-32772,
-32774,
-32768,
-32760,
-32769,
-32762,
-32758,
-32755,
-32762,
-32783,
-32784,
-32776,
-32768,
-32772,
-32782,
-32778,
-32790,
-32790,
-32799,
-32781,
-32771,
-32783,
-32788,
-32796,
-32785,
-32779,
-32774,
-32776,
-32765,
-32771,
-32768,
-32782,
-32771,
-32764,
-32770,
-32770,
-32773,
-32775,
-32784,
-32780,
-32784,
-32797,
-32809,
-32799,
-32798,
-32792,
-32789,
-32782,
-32790,
-32794,
-32785,
-32784,
-32763,
-32767,
-32759,
-32762,
-32751,
-32747,
-32751,
-32761,
-32762,
-32757,
-32763,
-32771,
-32779,
-32783,
-32786,
-32786,
-32794,
-32792,
-32793,
-32779,
-32782,
-32778,
-32780,
-32764,
-32757,
-32764,
-32756,
-32761,
-32753,
-32766,
-32778,
-32783,
-32772,
-32768,
-32789,
-32798,
-32791,
-32799,
-32806,
-32797,
-32792,
-32790,
-32790,
-32780,
-32788,
-32783,
-32766,
-32766,
-32771,
-32763,
-32757,
-32767,
-32772,
-32760,
-32759,
-32766,
-32771,
-32780,
-32789,
-32773,
-32777,
-32783,
-32793,
-32792,
-32791,
-32789,
-32776,
-32776,
-32781,
-32766,
-32755,
-32758,
-32769,
-32768,
-32761,
-32768,
-32765,
-32760,
-32768,
-32767,
-32778,
-32779,
-32783,
-32777,
-32765,
-32770,
-32775,
-32773,
-32769,
-32762,
-32765,
-32760,
-32752,
-32754,
-32758,
-32766,
-32763,
-32766,
-32766,
-32768,
-32762,
-32758,
-32766,
-32773,
-32780,
-32783,
-32780,
-32764,
-32760,
-32762,
-32767,
-32759,
-32764,
-32762,
-32761,
-32754,
-32745,
-32749,
-32740,
-32747,
-32739,
-32737,
-32749,
-32743,
-32751,
-32739,
-32757,
-32755,
-32759,
-32760,
-32762,
-32764,
-32763,
-32759,
-32759,
-32763,
-32760,
-32754,
-32759,
-32757,
-32757,
-32748,
-32754,
-32751,
-32749,
-32744,
-32746,
-32749,
-32753,
-32754,
-32757,
-32767,
-32767,
-32774,
-32767,
-32776,
-32777,
-32778,
-32771,
-32772,
-32770,
-32765,
-32769,
-32765,
-32767,
-32751,
-32754,
-32748,
-32757,
-32755,
-32756,
-32758,
-32758,
-32764,
-32766,
-32768,
-32770,
-32782,
-32778,
-32772,
-32770,
-32772,
-32766,
-32772,
-32765,
-32762,
-32760,
-32763,
-32762,
-32755,
-32759,
-32769,
-32771,
-32770,
-32771,
-32772,
-32775,
-32770,
-32777,
-32776,
-32784,
-32779,
-32781,
-32770,
-32773,
-32774,
-32769,
-32766,
-32760,
-32762,
-32768,
-32763,
-32756,
-32763,
-32766,
-32773,
-32770,
-32771,
-32770,
-32771,
-32770,
-32769,
-32772,
-32774,
-32773,
-32773,
-32768,
-32767,
-32766,
-32771,
-32767,
-32768,
-32768,
-32771,
-32763,
-32759,
-32767,
-32767,
-32771,
-32764,
-32769,
-32764,
-32768,
-32764,
-32766,
-32767,
-32769,
-32773,
-32772,
-32772,
-32773,
-32774,
-32773,
-32772,
-32774,
-32773,
-32778,
-32766,
-32772,
-32767,
-32778,
-32768,
-32772,
-32772,
-32769,
-32769,
-32761,
-32771,
-32775,
-32773,
-32772,
-32770,
-32773,
-32767,
-32764,
-32766,
-32771,
-32771,
-32769,
-32768,
-32767,
-32764,
-32765,
-32764,
-32769,
-32772,
-32767,
-32769,
-32764,
-32769,
-32767,
-32762,
-32769,
-32766,
-32771,
-32769,
-32766,
-32769,
-32765,
-32769,
-32768,
-32771,
-32771,
-32769,
-32770,
-32767,
-32768,
-32767,
-32769,
-32768,
-32766,
-32768,
-32766,
-32765,
-32758,
-32767,
-32767,
-32767,
-32767,
-32766,
-32767,
-32765,
-32766,
-32767,
-32767,
-32768,
-32765,
-32768,
-32768,
-32771,
-32770,
-32763,
-32770,
-32763,
-32768,
-32763,
-32767,
-32769,
-32764,
-32763,
-32764,
-32769,
-32767,
-32770,
-32764,
-32772,
-32765,
-32768,
-32763,
-32765,
-32766,
-32767,
-32765,
-32770,
-32765,
-32769,
-32767,
-32769,
-32770,
-32765,
-32763,
-32767,
-32764,
-32771,
-32767,
-32771,
-32765,
-32769,
-32768,
-32770,
-32768,
-32765,
-32765,
-32768,
-32769,
-32769,
-32769,
-32764,
-32770,
-32764,
-32765,
-32767,
-32766,
-32764,
-32765,
-32763,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32767,
-32768,
-32769,
-32766,
-32771,
-32762,
-32767,
-32768,
-32767,
-32768,
-32763,
-32769,
-32764,
-32768,
-32765,
-32770,
-32767,
-32766,
-32766,
-32769,
-32768,
-32766,
-32768,
-32764,
-32763,
-32765,
-32765,
-32766,
-32762,
-32769,
-32767,
-32766,
-32765,
-32766,
-32770,
-32769,
-32768,
-32767,
-32766,
-32770,
-32770,
-32770,
-32766,
-32771,
-32769,
-32767,
-32774,
-32767,
-32768,
-32769,
-32766,
-32771,
-32760,
-32761,
-32761,
-32762,
-32766,
-32763,
-32767,
-32765,
-32763,
-32769,
-32767,
-32769,
-32767,
-32768,
-32768,
-32771,
-32766,
-32768,
-32769,
-32768,
-32772,
-32763,
-32774,
-32762,
-32771,
-32762,
-32767,
-32768,
-32765,
-32767,
-32767,
-32762,
-32769,
-32761,
-32765,
-32765,
-32764,
-32765,
-32764,
-32767,
-32762,
-32768,
-32765,
-32766,
-32766,
-32770,
-32771,
-32768,
-32768,
-32772,
-32767,
-32768,
-32768,
-32767,
-32769,
-32766,
-32771,
-32763,
-32768,
-32762,
-32764,
-32761,
-32767,
-32765,
-32764,
-32763,
-32763,
-32765,
-32766,
-32767,
-32767,
-32768,
-32766,
-32769,
-32770,
-32764,
-32772,
-32763,
-32774,
-32760,
-32771,
-32763,
-32768,
-32762,
-32766,
-32766,
-32759,
-32767,
-32759,
-32771,
-32761,
-32767,
-32763,
-32770,
-32766,
-32766,
-32768,
-32771,
-32768,
-32768,
-32765,
-32765,
-32763,
-32767,
-32764,
-32769,
-32768,
-32771,
-32766,
-32767,
-32769,
-32767,
-32769,
-32765,
-32766,
-32770,
-32766,
-32769,
-32761,
-32773,
-32767,
-32768,
-32761,
-32765,
-32765,
-32766,
-32767,
-32769,
-32765,
-32767,
-32765,
-32770,
-32765,
-32773,
-32764,
-32769,
-32762,
-32766,
-32767,
-32769,
-32764,
-32768,
-32770,
-32766,
-32766,
-32764,
-32769,
-32760,
-32768,
-32765,
-32766,
-32761,
-32767,
-32765,
-32764,
-32766,
-32768,
-32767,
-32766,
-32766,
-32767,
-32768,
-32766,
-32769,
-32766,
-32771,
-32770,
-32766,
-32766,
-32763,
-32763,
-32765,
-32764,
-32762,
-32767,
-32763,
-32761,
-32761,
-32764,
-32766,
-32766,
-32771,
-32767,
-32767,
-32766,
-32766,
-32767,
-32767,
-32766,
-32766,
-32766,
-32766,
-32761,
-32766,
-32766,
-32769,
-32767,
-32768,
-32765,
-32768,
-32766,
-32766,
-32764,
-32765,
-32770,
-32765,
-32769,
-32764,
-32772,
-32764,
-32769,
-32767,
-32765,
-32767,
-32767,
-32766,
-32768,
-32765,
-32769,
-32764,
-32764,
-32762,
-32767,
-32766,
-32770,
-32765,
-32773,
-32765,
-32764,
-32765,
-32769,
-32767,
-32767,
-32770,
-32767,
-32766,
-32766,
-32771,
-32765,
-32768,
-32767,
-32765,
-32767,
-32763,
-32767,
-32761,
-32766,
-32767,
-32766,
-32766,
-32772,
-32769,
-32767,
-32767,
-32767,
-32768,
-32769,
-32767,
-32771,
-32765,
-32772,
-32763,
-32767,
-32763,
-32765,
-32771,
-32762,
-32772,
-32763,
-32768,
-32761,
-32769,
-32763,
-32769,
-32761,
-32772,
-32763,
-32765,
-32766,
-32767,
-32768,
-32765,
-32765,
-32766,
-32766,
-32766,
-32765,
-32763,
-32768,
-32767,
-32765,
-32771,
-32765,
-32770,
-32761,
-32769,
-32762,
-32772,
-32763,
-32768,
-32768,
-32768,
-32772,
-32762,
-32768,
-32766,
-32768,
-32765,
-32767,
-32767,
-32769,
-32768,
-32771,
-32766,
-32773,
-32762,
-32765,
-32761,
-32769,
-32769,
-32766,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32770,
-32765,
-32766,
-32766,
-32766,
-32767,
-32765,
-32764,
-32766,
-32764,
-32769,
-32763,
-32769,
-32764,
-32767,
-32765,
-32766,
-32771,
-32765,
-32767,
-32765,
-32772,
-32769,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32765,
-32768,
-32764,
-32764,
-32766,
-32764,
-32765,
-32762,
-32769,
-32768,
-32763,
-32767,
-32766,
-32768,
-32767,
-32766,
-32766,
-32767,
-32764,
-32768,
-32767,
-32769,
-32766,
-32766,
-32768,
-32763,
-32770,
-32763,
-32768,
-32763,
-32768,
-32770,
-32767,
-32765,
-32770,
-32762,
-32771,
-32762,
-32767,
-32764,
-32766,
-32767,
-32768,
-32767,
-32766,
-32769,
-32764,
-32766,
-32762,
-32767,
-32765,
-32767,
-32764,
-32767,
-32769,
-32765,
-32764,
-32764,
-32766,
-32768,
-32767,
-32768,
-32766,
-32766,
-32768,
-32764,
-32768,
-32766,
-32768,
-32766,
-32764,
-32766,
-32769,
-32762,
-32762,
-32763,
-32766,
-32770,
-32763,
-32772,
-32764,
-32773,
-32767,
-32774,
-32767,
-32768,
-32766,
-32768,
-32765,
-32768,
-32765,
-32769,
-32765,
-32766,
-32769,
-32764,
-32768,
-32767,
-32766,
-32768,
-32767,
-32768,
-32764,
-32765,
-32765,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32766,
-32764,
-32766,
-32770,
-32766,
-32766,
-32765,
-32767,
-32766,
-32769,
-32766,
-32770,
-32768,
-32769,
-32761,
-32766,
-32764,
-32767,
-32766,
-32766,
-32771,
-32761,
-32768,
-32765,
-32766,
-32766,
-32768,
-32764,
-32769,
-32762,
-32771,
-32763,
-32769,
-32767,
-32764,
-32773,
-32759,
-32770,
-32761,
-32771,
-32767,
-32767,
-32768,
-32767,
-32765,
-32767,
-32765,
-32767,
-32765,
-32769,
-32764,
-32771,
-32763,
-32766,
-32764,
-32766,
-32767,
-32765,
-32767,
-32766,
-32769,
-32762,
-32771,
-32763,
-32768,
-32767,
-32764,
-32770,
-32761,
-32771,
-32765,
-32769,
-32769,
-32766,
-32769,
-32767,
-32768,
-32768,
-32767,
-32770,
-32764,
-32771,
-32763,
-32769,
-32765,
-32765,
-32764,
-32768,
-32765,
-32769,
-32765,
-32769,
-32769,
-32767,
-32770,
-32766,
-32771,
-32766,
-32769,
-32762,
-32768,
-32767,
-32765,
-32766,
-32764,
-32765,
-32767,
-32764,
-32770,
-32763,
-32771,
-32766,
-32769,
-32767,
-32768,
-32767,
-32769,
-32764,
-32772,
-32763,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32768,
-32764,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32762,
-32767,
-32763,
-32771,
-32767,
-32767,
-32761,
-32769,
-32763,
-32769,
-32767,
-32766,
-32768,
-32768,
-32769,
-32767,
-32766,
-32767,
-32765,
-32767,
-32767,
-32763,
-32767,
-32765,
-32768,
-32768,
-32768,
-32766,
-32769,
-32767,
-32766,
-32769,
-32766,
-32766,
-32766,
-32766,
-32767,
-32767,
-32765,
-32764,
-32759,
-32763,
-32764,
-32769,
-32765,
-32767,
-32767,
-32768,
-32768,
-32768,
-32769,
-32766,
-32770,
-32768,
-32767,
-32767,
-32765,
-32766,
-32767,
-32767,
-32767,
-32765,
-32769,
-32765,
-32767,
-32768,
-32765,
-32771,
-32762,
-32771,
-32765,
-32770,
-32765,
-32770,
-32766,
-32765,
-32767,
-32765,
-32768,
-32767,
-32767,
-32766,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32764,
-32768,
-32767,
-32765,
-32769,
-32764,
-32766,
-32768,
-32765,
-32768,
-32767,
-32765,
-32771,
-32761,
-32768,
-32765,
-32768,
-32767,
-32766,
-32766,
-32769,
-32765,
-32768,
-32766,
-32765,
-32766,
-32766,
-32764,
-32770,
-32762,
-32771,
-32761,
-32771,
-32762,
-32767,
-32767,
-32766,
-32769,
-32766,
-32770,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32767,
-32767,
-32768,
-32764,
-32769,
-32764,
-32768,
-32765,
-32765,
-32771,
-32763,
-32769,
-32766,
-32765,
-32768,
-32767,
-32768,
-32765,
-32768,
-32765,
-32770,
-32763,
-32770,
-32764,
-32769,
-32767,
-32765,
-32771,
-32761,
-32771,
-32763,
-32768,
-32767,
-32765,
-32771,
-32765,
-32771,
-32765,
-32768,
-32765,
-32769,
-32765,
-32768,
-32765,
-32769,
-32764,
-32769,
-32765,
-32768,
-32766,
-32769,
-32766,
-32766,
-32768,
-32767,
-32771,
-32767,
-32767,
-32767,
-32764,
-32765,
-32762,
-32767,
-32766,
-32767,
-32767,
-32767,
-32765,
-32766,
-32765,
-32768,
-32764,
-32767,
-32769,
-32765,
-32768,
-32764,
-32770,
-32762,
-32772,
-32762,
-32771,
-32765,
-32768,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32770,
-32762,
-32770,
-32766,
-32769,
-32765,
-32770,
-32762,
-32771,
-32763,
-32771,
-32763,
-32770,
-32764,
-32769,
-32767,
-32767,
-32765,
-32763,
-32770,
-32763,
-32772,
-32762,
-32770,
-32765,
-32767,
-32768,
-32767,
-32767,
-32766,
-32769,
-32767,
-32768,
-32768,
-32766,
-32768,
-32768,
-32767,
-32767,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32767,
-32768,
-32765,
-32770,
-32765,
-32767,
-32770,
-32763,
-32772,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32767,
-32762,
-32770,
-32764,
-32768,
-32767,
-32768,
-32766,
-32769,
-32766,
-32767,
-32768,
-32761,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32768,
-32769,
-32763,
-32772,
-32764,
-32769,
-32767,
-32765,
-32768,
-32768,
-32764,
-32770,
-32764,
-32768,
-32764,
-32766,
-32769,
-32763,
-32770,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32769,
-32767,
-32766,
-32768,
-32765,
-32764,
-32770,
-32766,
-32769,
-32766,
-32768,
-32767,
-32764,
-32771,
-32763,
-32768,
-32765,
-32767,
-32767,
-32768,
-32763,
-32771,
-32761,
-32771,
-32765,
-32767,
-32769,
-32768,
-32766,
-32769,
-32763,
-32771,
-32763,
-32768,
-32765,
-32768,
-32768,
-32765,
-32767,
-32765,
-32767,
-32766,
-32768,
-32767,
-32767,
-32768,
-32767,
-32767,
-32768,
-32767,
-32768,
-32765,
-32769,
-32762,
-32773,
-32761,
-32772,
-32763,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32768,
-32764,
-32765,
-32765,
-32763,
-32767,
-32766,
-32768,
-32768,
-32767,
-32766,
-32770,
-32763,
-32769,
-32762,
-32769,
-32761,
-32768,
-32763,
-32768,
-32764,
-32767,
-32767,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32769,
-32766,
-32767,
-32766,
-32765,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32768,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32766,
-32767,
-32768,
-32765,
-32771,
-32763,
-32770,
-32765,
-32767,
-32767,
-32768,
-32767,
-32769,
-32766,
-32769,
-32764,
-32765,
-32765,
-32761,
-32765,
-32764,
-32769,
-32764,
-32770,
-32764,
-32770,
-32763,
-32773,
-32762,
-32769,
-32764,
-32768,
-32766,
-32768,
-32766,
-32766,
-32764,
-32765,
-32769,
-32766,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32769,
-32763,
-32772,
-32764,
-32769,
-32760,
-32771,
-32763,
-32768,
-32764,
-32769,
-32766,
-32768,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32765,
-32766,
-32771,
-32763,
-32771,
-32765,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32766,
-32764,
-32766,
-32764,
-32766,
-32766,
-32766,
-32768,
-32765,
-32766,
-32765,
-32767,
-32767,
-32767,
-32767,
-32768,
-32767,
-32767,
-32764,
-32770,
-32766,
-32769,
-32767,
-32764,
-32770,
-32763,
-32771,
-32764,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32770,
-32765,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32769,
-32764,
-32768,
-32767,
-32764,
-32771,
-32763,
-32767,
-32764,
-32764,
-32769,
-32767,
-32768,
-32767,
-32763,
-32768,
-32766,
-32766,
-32766,
-32767,
-32767,
-32768,
-32764,
-32770,
-32764,
-32771,
-32764,
-32771,
-32763,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32762,
-32766,
-32766,
-32764,
-32772,
-32766,
-32772,
-32765,
-32769,
-32765,
-32771,
-32763,
-32770,
-32763,
-32768,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32764,
-32765,
-32767,
-32765,
-32768,
-32767,
-32765,
-32766,
-32765,
-32767,
-32767,
-32767,
-32765,
-32769,
-32765,
-32768,
-32768,
-32767,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32767,
-32763,
-32769,
-32764,
-32771,
-32762,
-32769,
-32765,
-32767,
-32768,
-32766,
-32769,
-32763,
-32768,
-32760,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32766,
-32768,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32769,
-32765,
-32770,
-32763,
-32769,
-32766,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32767,
-32766,
-32766,
-32770,
-32764,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32768,
-32766,
-32768,
-32765,
-32766,
-32762,
-32770,
-32764,
-32769,
-32765,
-32769,
-32769,
-32765,
-32769,
-32765,
-32767,
-32767,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32767,
-32767,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32764,
-32771,
-32764,
-32768,
-32767,
-32767,
-32766,
-32767,
-32767,
-32767,
-32765,
-32766,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32767,
-32766,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32771,
-32761,
-32768,
-32764,
-32767,
-32767,
-32765,
-32769,
-32766,
-32769,
-32767,
-32766,
-32768,
-32767,
-32769,
-32768,
-32765,
-32770,
-32763,
-32770,
-32764,
-32769,
-32764,
-32768,
-32765,
-32769,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32767,
-32766,
-32768,
-32766,
-32767,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32771,
-32764,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32763,
-32771,
-32762,
-32770,
-32762,
-32770,
-32765,
-32767,
-32768,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32769,
-32763,
-32767,
-32767,
-32765,
-32769,
-32765,
-32767,
-32768,
-32766,
-32768,
-32768,
-32763,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32767,
-32767,
-32767,
-32766,
-32764,
-32767,
-32765,
-32770,
-32765,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32767,
-32767,
-32767,
-32767,
-32766,
-32767,
-32761,
-32770,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32765,
-32767,
-32767,
-32767,
-32767,
-32769,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32766,
-32769,
-32763,
-32771,
-32763,
-32771,
-32764,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32766,
-32765,
-32768,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32768,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32769,
-32767,
-32766,
-32766,
-32766,
-32766,
-32769,
-32765,
-32768,
-32763,
-32769,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32763,
-32772,
-32763,
-32769,
-32766,
-32769,
-32765,
-32770,
-32764,
-32768,
-32769,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32764,
-32769,
-32766,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32765,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32769,
-32765,
-32770,
-32764,
-32768,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32767,
-32765,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32768,
-32767,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32764,
-32765,
-32766,
-32767,
-32766,
-32767,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32763,
-32773,
-32761,
-32771,
-32765,
-32766,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32766,
-32763,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32770,
-32764,
-32763,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32771,
-32765,
-32768,
-32768,
-32764,
-32770,
-32766,
-32767,
-32767,
-32766,
-32768,
-32764,
-32771,
-32764,
-32769,
-32767,
-32766,
-32767,
-32766,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32765,
-32768,
-32764,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32769,
-32766,
-32768,
-32768,
-32763,
-32773,
-32761,
-32774,
-32761,
-32772,
-32763,
-32769,
-32766,
-32768,
-32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32766,
-32768,
-32763,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32764,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32765,
-32767,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32766,
-32767,
-32768,
-32764,
-32770,
-32765,
-32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
-32768,
-32768,
-32764,
-32770,
-32764,
-32770,
-32766,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32763,
-32772,
-32761,
-32773,
-32762,
-32770,
-32765,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32772,
-32762,
-32770,
-32766,
-32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32765,
-32769,
-32766,
-32768,
-32767,
-32767,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32767,
-32769,
-32765,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32768,
-32767,
-32766,
-32770,
-32764,
-32770,
-32764,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32765,
-32770,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32764,
-32772,
-32762,
-32771,
-32765,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32766,
-32769,
-32765,
-32769,
-32767,
-32764,
-32772,
-32761,
-32773,
-32762,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32768,
-32765,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32766,
-32767,
-32767,
-32766,
-32768,
-32768,
-32763,
-32773,
-32761,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32766,
-32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32765,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32766,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32768,
-32768,
-32765,
-32771,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32763,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32771,
-32763,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32769,
-32762,
-32773,
-32761,
-32773,
-32762,
-32770,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32765,
-32769,
-32764,
-32769,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32768,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32771,
-32764,
-32767,
-32769,
-32763,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32762,
-32773,
-32763,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32765,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32771,
-32762,
-32772,
-32762,
-32771,
-32765,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32766,
-32770,
-32765,
-32768,
-32766,
-32766,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32764,
-32769,
-32765,
-32768,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32769,
-32764,
-32770,
-32764,
-32768,
-32768,
-32766,
-32769,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32767,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32764,
-32771,
-32765,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32762,
-32772,
-32764,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32768,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
-32766,
-32769,
-32764,
-32772,
-32762,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32764,
-32771,
-32763,
-32772,
-32762,
-32771,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32763,
-32771,
-32765,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32769,
-32765,
-32767,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32763,
-32771,
-32765,
-32768,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32768,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32765,
-32767,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32765,
-32771,
-32762,
-32772,
-32762,
-32771,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32769,
-32763,
-32771,
-32764,
-32770,
-32764,
-32770,
-32763,
-32771,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32763,
-32772,
-32762,
-32772,
-32763,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32764,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32769,
-32763,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
-32769,
-32763,
-32772,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32768,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32769,
-32765,
-32767,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32768,
-32763,
-32772,
-32763,
-32769,
-32767,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32769,
-32763,
-32772,
-32762,
-32772,
-32764,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32763,
-32772,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32770,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32767,
-32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32766,
-32770,
-32762,
-32773,
-32761,
-32773,
-32762,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32762,
-32772,
-32764,
-32768,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32767,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32767,
-32770,
-32762,
-32773,
-32762,
-32769,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32767,
-32766,
-32768,
-32765,
-32769,
-32767,
-32765,
-32771,
-32761,
-32773,
-32763,
-32769,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32767,
-32765,
-32771,
-32761,
-32774,
-32761,
-32772,
-32763,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32765,
-32770,
-32763,
-32772,
-32763,
-32769,
-32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32769,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32768,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32764,
-32770,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32767,
-32765,
-32770,
-32765,
-32766,
-32770,
-32763,
-32771,
-32765,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32762,
-32772,
-32763,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32763,
-32772,
-32762,
-32771,
-32764,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32771,
-32766,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32770,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32767,
-32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32764,
-32767,
-32769,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32763,
-32771,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32767,
-32764,
-32771,
-32762,
-32773,
-32762,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32770,
-32764,
-32770,
-32763,
-32770,
-32766,
-32768,
-32767,
-32766,
-32766,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32765,
-32769,
-32765,
-32770,
-32765,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32767,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32770,
-32763,
-32769,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32766,
-32768,
-32768,
-32766,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32768,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32766,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32771,
-32765,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32768,
-32768,
-32766,
-32767,
-32769,
-32763,
-32771,
-32765,
-32768,
-32766,
-32769,
-32763,
-32771,
-32766,
-32764,
-32773,
-32760,
-32773,
-32762,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32769,
-32764,
-32771,
-32761,
-32774,
-32761,
-32772,
-32763,
-32769,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32767,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32770,
-32763,
-32772,
-32762,
-32770,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32770,
-32767,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32769,
-32763,
-32771,
-32764,
-32768,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32771,
-32762,
-32771,
-32764,
-32768,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32769,
-32767,
-32765,
-32770,
-32765,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32770,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32771,
-32761,
-32773,
-32761,
-32773,
-32763,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32767,
-32766,
-32769,
-32763,
-32772,
-32763,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32766,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32767,
-32765,
-32771,
-32762,
-32771,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32767,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32766,
-32766,
-32768,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32767,
-32769,
-32763,
-32772,
-32763,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32769,
-32763,
-32771,
-32764,
-32770,
-32763,
-32772,
-32761,
-32773,
-32763,
-32768,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32767,
-32769,
-32764,
-32770,
-32763,
-32771,
-32765,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32771,
-32763,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32763,
-32772,
-32763,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32763,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32763,
-32772,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32767,
-32767,
-32766,
-32768,
-32765,
-32771,
-32763,
-32770,
-32765,
-32767,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32767,
-32769,
-32763,
-32773,
-32761,
-32771,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32763,
-32769,
-32766,
-32767,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32763,
-32771,
-32764,
-32770,
-32764,
-32768,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32768,
-32768,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32768,
-32765,
-32768,
-32766,
-32769,
-32766,
-32768,
-32765,
-32768,
-32767,
-32768,
-32766,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32764,
-32772,
-32762,
-32772,
-32762,
-32770,
-32766,
-32768,
-32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32763,
-32772,
-32762,
-32770,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32762,
-32773,
-32761,
-32773,
-32761,
-32771,
-32766,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32769,
-32765,
-32767,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32762,
-32771,
-32766,
-32766,
-32770,
-32762,
-32772,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32767,
-32769,
-32764,
-32771,
-32763,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32767,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32767,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
-32766,
-32771,
-32762,
-32772,
-32762,
-32772,
-32763,
-32770,
-32765,
-32767,
-32769,
-32764,
-32771,
-32762,
-32772,
-32762,
-32771,
-32766,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32767,
-32766,
-32769,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32770,
-32762,
-32773,
-32762,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32765,
-32771,
-32762,
-32772,
-32762,
-32771,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32764,
-32767,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32769,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32767,
-32770,
-32762,
-32773,
-32761,
-32771,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32768,
-32766,
-32767,
-32767,
-32768,
-32767,
-32767,
-32766,
-32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32772,
-32762,
-32772,
-32762,
-32771,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32769,
-32763,
-32772,
-32763,
-32769,
-32767,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32769,
-32763,
-32772,
-32763,
-32769,
-32767,
-32765,
-32770,
-32766,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32762,
-32773,
-32762,
-32770,
-32766,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32771,
-32762,
-32771,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32764,
-32771,
-32764,
-32768,
-32767,
-32766,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32763,
-32773,
-32760,
-32773,
-32764,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32762,
-32772,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32769,
-32767,
-32766,
-32769,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32767,
-32766,
-32768,
-32768,
-32764,
-32770,
-32764,
-32769,
-32768,
-32764,
-32770,
-32765,
-32767,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32766,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32766,
-32770,
-32763,
-32772,
-32761,
-32772,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32767,
-32769,
-32763,
-32772,
-32763,
-32770,
-32765,
-32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32768,
-32764,
-32771,
-32763,
-32769,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32766,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32767,
-32770,
-32762,
-32772,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32766,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32766,
-32770,
-32762,
-32772,
-32764,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32766,
-32767,
-32767,
-32767,
-32765,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32767,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32766,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32763,
-32771,
-32765,
-32768,
-32767,
-32766,
-32767,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32767,
-32768,
-32768,
-32764,
-32770,
-32765,
-32767,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32770,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32769,
-32765,
-32767,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32769,
-32765,
-32770,
-32762,
-32773,
-32761,
-32773,
-32762,
-32770,
-32765,
-32768,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32767,
-32769,
-32765,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32769,
-32764,
-32771,
-32763,
-32769,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32767,
-32767,
-32767,
-32765,
-32770,
-32765,
-32769,
-32766,
-32765,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32768,
-32769,
-32763,
-32772,
-32760,
-32774,
-32762,
-32771,
-32764,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32768,
-32767,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
-32766,
-32770,
-32764,
-32770,
-32764,
-32768,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32767,
-32765,
-32771,
-32761,
-32773,
-32762,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32772,
-32761,
-32772,
-32763,
-32771,
-32763,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32766,
-32768,
-32768,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32766,
-32766,
-32768,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32768,
-32764,
-32771,
-32762,
-32771,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32769,
-32767,
-32768,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32766,
-32767,
-32766,
-32769,
-32766,
-32767,
-32768,
-32764,
-32771,
-32764,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32762,
-32774,
-32759,
-32774,
-32762,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32765,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32769,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32767,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32766,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32765,
-32766,
-32770,
-32763,
-32770,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32769,
-32765,
-32770,
-32764,
-32770,
-32763,
-32770,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32763,
-32771,
-32765,
-32767,
-32768,
-32765,
-32769,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32766,
-32766,
-32769,
-32765,
-32769,
-32767,
-32764,
-32771,
-32764,
-32769,
-32767,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32771,
-32762,
-32771,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32763,
-32772,
-32763,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32765,
-32769,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32764,
-32772,
-32761,
-32772,
-32764,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32767,
-32769,
-32764,
-32771,
-32763,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32765,
-32771,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32769,
-32767,
-32766,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32770,
-32762,
-32773,
-32762,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32769,
-32763,
-32772,
-32763,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32765,
-32769,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32769,
-32768,
-32764,
-32771,
-32762,
-32771,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32771,
-32763,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32771,
-32763,
-32770,
-32764,
-32769,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32769,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32769,
-32766,
-32767,
-32768,
-32767,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32766,
-32770,
-32764,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32767,
-32769,
-32764,
-32771,
-32763,
-32769,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32770,
-32764,
-32768,
-32768,
-32766,
-32767,
-32769,
-32763,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32765,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32765,
-32770,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32769,
-32763,
-32772,
-32761,
-32773,
-32763,
-32769,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32764,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32768,
-32768,
-32764,
-32772,
-32761,
-32772,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32767,
-32769,
-32765,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32764,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
-32767,
-32766,
-32769,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32763,
-32772,
-32763,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32762,
-32772,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32770,
-32762,
-32772,
-32764,
-32769,
-32766,
-32766,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32767,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32766,
-32770,
-32764,
-32769,
-32765,
-32768,
-32767,
-32768,
-32765,
-32770,
-32762,
-32772,
-32764,
-32769,
-32766,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32763,
-32772,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32763,
-32772,
-32762,
-32772,
-32763,
-32769,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32764,
-32771,
-32763,
-32771,
-32763,
-32769,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32771,
-32763,
-32769,
-32768,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32763,
-32769,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32767,
-32765,
-32771,
-32762,
-32771,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32764,
-32771,
-32763,
-32772,
-32762,
-32770,
-32766,
-32766,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32767,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32771,
-32761,
-32773,
-32762,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32767,
-32766,
-32768,
-32768,
-32765,
-32770,
-32763,
-32770,
-32764,
-32771,
-32764,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32768,
-32766,
-32767,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32764,
-32768,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32767,
-32765,
-32769,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32770,
-32762,
-32772,
-32763,
-32769,
-32768,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32767,
-32770,
-32762,
-32772,
-32763,
-32770,
-32764,
-32771,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32768,
-32766,
-32766,
-32769,
-32765,
-32769,
-32767,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32767,
-32767,
-32768,
-32764,
-32770,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32761,
-32773,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32763,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32763,
-32772,
-32763,
-32771,
-32763,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32763,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32765,
-32769,
-32764,
-32770,
-32764,
-32771,
-32763,
-32771,
-32763,
-32769,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32766,
-32770,
-32764,
-32769,
-32767,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32763,
-32771,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32770,
-32762,
-32772,
-32763,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32768,
-32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32766,
-32767,
-32767,
-32766,
-32768,
-32767,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32766,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32764,
-32768,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32765,
-32769,
-32766,
-32767,
-32766,
-32768,
-32768,
-32766,
-32766,
-32769,
-32765,
-32770,
-32764,
-32768,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32771,
-32763,
-32769,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32765,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32768,
-32764,
-32770,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32772,
-32762,
-32770,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32763,
-32772,
-32762,
-32772,
-32762,
-32770,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32767,
-32766,
-32767,
-32767,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32767,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32762,
-32772,
-32764,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32771,
-32762,
-32773,
-32761,
-32771,
-32766,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32767,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32768,
-32768,
-32766,
-32766,
-32770,
-32762,
-32773,
-32762,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32767,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
-32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32767,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32767,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32769,
-32763,
-32772,
-32761,
-32773,
-32762,
-32772,
-32762,
-32771,
-32764,
-32768,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32772,
-32761,
-32773,
-32762,
-32771,
-32763,
-32772,
-32761,
-32773,
-32761,
-32772,
-32764,
-32769,
-32765,
-32768,
-32766,
-32769,
-32766,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32767,
-32768,
-32766,
-32766,
-32770,
-32763,
-32772,
-32762,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32768,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32767,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32765,
-32771,
-32762,
-32771,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32763,
-32771,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32768,
-32766,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32769,
-32766,
-32768,
-32767,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32768,
-32767,
-32768,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32768,
-32765,
-32768,
-32766,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32763,
-32772,
-32763,
-32769,
-32767,
-32765,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32766,
-32768,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32765,
-32771,
-32763,
-32770,
-32765,
-32767,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32767,
-32769,
-32764,
-32771,
-32763,
-32769,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32763,
-32772,
-32763,
-32769,
-32767,
-32766,
-32767,
-32769,
-32763,
-32772,
-32763,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32768,
-32764,
-32771,
-32762,
-32772,
-32764,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32764,
-32771,
-32762,
-32773,
-32761,
-32772,
-32764,
-32767,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32768,
-32768,
-32764,
-32770,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
-32768,
-32765,
-32770,
-32764,
-32770,
-32766,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32764,
-32768,
-32769,
-32764,
-32769,
-32766,
-32767,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32764,
-32771,
-32762,
-32772,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32768,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32767,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32768,
-32767,
-32765,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32769,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32766,
-32769,
-32765,
-32770,
-32764,
-32768,
-32767,
-32766,
-32770,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32770,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32772,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32765,
-32770,
-32763,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32765,
-32767,
-32768,
-32765,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32767,
-32767,
-32768,
-32767,
-32765,
-32770,
-32763,
-32770,
-32767,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32767,
-32766,
-32767,
-32767,
-32767,
-32768,
-32767,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32770,
-32762,
-32773,
-32762,
-32770,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32767,
-32766,
-32767,
-32768,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32768,
-32765,
-32768,
-32767,
-32766,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32763,
-32772,
-32761,
-32773,
-32762,
-32770,
-32767,
-32765,
-32769,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32769,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32767,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32766,
-32770,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32767,
-32765,
-32770,
-32763,
-32772,
-32762,
-32772,
-32762,
-32771,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32770,
-32762,
-32773,
-32762,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32766,
-32768,
-32768,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32762,
-32773,
-32761,
-32772,
-32763,
-32770,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32768,
-32763,
-32772,
-32762,
-32771,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32771,
-32762,
-32772,
-32764,
-32768,
-32768,
-32764,
-32770,
-32766,
-32766,
-32769,
-32766,
-32765,
-32771,
-32762,
-32772,
-32764,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32768,
-32764,
-32771,
-32763,
-32769,
-32768,
-32764,
-32771,
-32763,
-32769,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32768,
-32765,
-32768,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32766,
-32770,
-32762,
-32773,
-32762,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32768,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32772,
-32761,
-32772,
-32764,
-32767,
-32770,
-32763,
-32771,
-32764,
-32768,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32767,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32767,
-32765,
-32770,
-32763,
-32771,
-32764,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32763,
-32772,
-32762,
-32772,
-32762,
-32771,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32771,
-32763,
-32770,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32768,
-32764,
-32770,
-32765,
-32769,
-32766,
-32767,
-32766,
-32768,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32762,
-32773,
-32761,
-32772,
-32763,
-32770,
-32765,
-32768,
-32766,
-32768,
-32765,
-32771,
-32762,
-32772,
-32763,
-32769,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32770,
-32764,
-32770,
-32763,
-32771,
-32765,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32769,
-32765,
-32768,
-32767,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32767,
-32767,
-32769,
-32765,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32763,
-32772,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32766,
-32770,
-32763,
-32770,
-32767,
-32764,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32765,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32768,
-32767,
-32766,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32771,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32767,
-32766,
-32768,
-32765,
-32771,
-32763,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32769,
-32767,
-32765,
-32771,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32769,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32764,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32764,
-32770,
-32764,
-32770,
-32766,
-32766,
-32768,
-32767,
-32766,
-32769,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32766,
-32767,
-32768,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32771,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32768,
-32766,
-32766,
-32768,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32762,
-32772,
-32763,
-32770,
-32764,
-32770,
-32763,
-32772,
-32763,
-32770,
-32764,
-32769,
-32766,
-32768,
-32767,
-32766,
-32767,
-32769,
-32763,
-32772,
-32762,
-32771,
-32765,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32768,
-32768,
-32763,
-32772,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32768,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32770,
-32763,
-32772,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32766,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32765,
-32767,
-32769,
-32764,
-32771,
-32763,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32771,
-32765,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32770,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32764,
-32770,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32769,
-32764,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32767,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32770,
-32764,
-32768,
-32768,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32766,
-32766,
-32769,
-32765,
-32770,
-32764,
-32768,
-32767,
-32768,
-32766,
-32767,
-32766,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32772,
-32763,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32763,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32767,
-32769,
-32764,
-32770,
-32766,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32770,
-32765,
-32767,
-32769,
-32763,
-32772,
-32762,
-32772,
-32762,
-32771,
-32764,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32766,
-32766,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32765,
-32771,
-32762,
-32772,
-32763,
-32770,
-32764,
-32771,
-32762,
-32772,
-32763,
-32770,
-32766,
-32766,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32764,
-32768,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32770,
-32763,
-32771,
-32764,
-32769,
-32767,
-32765,
-32771,
-32762,
-32771,
-32765,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32769,
-32764,
-32770,
-32766,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32767,
-32764,
-32772,
-32761,
-32772,
-32764,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32767,
-32765,
-32771,
-32763,
-32770,
-32766,
-32765,
-32771,
-32763,
-32770,
-32766,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32765,
-32768,
-32768,
-32765,
-32770,
-32763,
-32770,
-32767,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32769,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32766,
-32770,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32769,
-32764,
-32771,
-32763,
-32769,
-32767,
-32766,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32765,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32768,
-32768,
-32765,
-32769,
-32766,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32764,
-32769,
-32767,
-32767,
-32767,
-32766,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32768,
-32767,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32762,
-32771,
-32764,
-32768,
-32768,
-32765,
-32770,
-32763,
-32772,
-32762,
-32771,
-32765,
-32768,
-32767,
-32767,
-32765,
-32770,
-32764,
-32768,
-32768,
-32764,
-32770,
-32765,
-32769,
-32766,
-32769,
-32765,
-32769,
-32764,
-32770,
-32763,
-32769,
-32766,
-32767,
-32768,
-32766,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32769,
-32763,
-32770,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32771,
-32764,
-32768,
-32768,
-32765,
-32770,
-32764,
-32769,
-32767,
-32765,
-32770,
-32765,
-32768,
-32766,
-32767,
-32766,
-32769,
-32766,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32770,
-32764,
-32769,
-32767,
-32766,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32764,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32766,
-32766,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32767,
-32767,
-32766,
-32769,
-32763,
-32771,
-32764,
-32768,
-32768,
-32765,
-32770,
-32765,
-32768,
-32768,
-32765,
-32771,
-32763,
-32769,
-32765,
-32769,
-32765,
-32768,
-32767,
-32766,
-32767,
-32762,
-32770,
-32763,
-32768,
-32765,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32768,
-32765,
-32769,
-32766,
-32769,
-32764,
-32771,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
-32767,
-32767,
-32768,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32764,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32767,
-32766,
-32769,
-32766,
-32767,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32764,
-32771,
-32764,
-32769,
-32764,
-32768,
-32764,
-32773,
-32761,
-32771,
-32764,
-32769,
-32767,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32768,
-32766,
-32765,
-32770,
-32764,
-32770,
-32766,
-32766,
-32768,
-32767,
-32767,
-32766,
-32766,
-32766,
-32768,
-32766,
-32768,
-32768,
-32766,
-32768,
-32765,
-32769,
-32766,
-32767,
-32766,
-32768,
-32767,
-32763,
-32768,
-32762,
-32771,
-32765,
-32767,
-32766,
-32766,
-32766,
-32768,
-32767,
-32765,
-32769,
-32765,
-32770,
-32763,
-32770,
-32764,
-32769,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32768,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32766,
-32768,
-32765,
-32769,
-32764,
-32769,
-32765,
-32768,
-32767,
-32767,
-32767,
-32766,
-32768,
-32765,
-32768,
-32764,
-32768,
-32767,
-32767,
-32769,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32770,
-32764,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32770,
-32764,
-32768,
-32767,
-32766,
-32767,
-32769,
-32764,
-32771,
-32764,
-32768,
-32766,
-32768,
-32765,
-32770,
-32763,
-32772,
-32763,
-32770,
-32765,
-32767,
-32769,
-32765,
-32770,
-32762,
-32769,
-32765,
-32767,
-32770,
-32763,
-32772,
-32763,
-32769,
-32766,
-32767,
-32767,
-32767,
-32765,
-32770,
-32762,
-32770,
-32763,
-32770,
-32763,
-32772,
-32763,
-32771,
-32764,
-32767,
-32763,
-32767,
-32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32766,
-32768,
-32767,
-32767,
-32769,
-32764,
-32768,
-32767,
-32766,
-32769,
-32765,
-32767,
-32769,
-32764,
-32770,
-32765,
-32769,
-32767,
-32766,
-32768,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32763,
-32770,
-32763,
-32769,
-32767,
-32766,
-32770,
-32764,
-32768,
-32768,
-32763,
-32772,
-32764,
-32768,
-32768,
-32765,
-32768,
-32766,
-32767,
-32767,
-32767,
-32763,
-32766,
-32766,
-32768,
-32767,
-32768,
-32765,
-32770,
-32763,
-32770,
-32767,
-32765,
-32769,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32767,
-32768,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32766,
-32768,
-32765,
-32768,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32765,
-32766,
-32766,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32763,
-32768,
-32767,
-32767,
-32769,
-32765,
-32768,
-32764,
-32770,
-32763,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32767,
-32768,
-32765,
-32768,
-32766,
-32769,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32764,
-32771,
-32762,
-32771,
-32765,
-32769,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32769,
-32764,
-32768,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32770,
-32764,
-32770,
-32763,
-32772,
-32762,
-32772,
-32761,
-32769,
-32764,
-32768,
-32769,
-32763,
-32772,
-32763,
-32768,
-32769,
-32764,
-32770,
-32766,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32770,
-32764,
-32768,
-32763,
-32768,
-32766,
-32770,
-32764,
-32769,
-32767,
-32764,
-32772,
-32762,
-32770,
-32766,
-32767,
-32768,
-32764,
-32770,
-32762,
-32772,
-32764,
-32766,
-32768,
-32764,
-32771,
-32762,
-32770,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32767,
-32767,
-32768,
-32765,
-32769,
-32767,
-32765,
-32770,
-32764,
-32768,
-32768,
-32765,
-32767,
-32765,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32768,
-32767,
-32765,
-32769,
-32765,
-32769,
-32762,
-32768,
-32762,
-32771,
-32764,
-32769,
-32766,
-32768,
-32767,
-32771,
-32764,
-32769,
-32765,
-32768,
-32766,
-32769,
-32764,
-32771,
-32762,
-32772,
-32763,
-32769,
-32766,
-32768,
-32764,
-32771,
-32764,
-32770,
-32766,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32768,
-32767,
-32768,
-32767,
-32766,
-32768,
-32765,
-32770,
-32763,
-32770,
-32765,
-32769,
-32762,
-32766,
-32764,
-32767,
-32767,
-32765,
-32770,
-32765,
-32768,
-32767,
-32764,
-32772,
-32762,
-32773,
-32762,
-32772,
-32762,
-32771,
-32764,
-32769,
-32768,
-32764,
-32770,
-32764,
-32770,
-32763,
-32772,
-32761,
-32773,
-32764,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32769,
-32765,
-32770,
-32764,
-32768,
-32768,
-32764,
-32771,
-32761,
-32767,
-32766,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32764,
-32766,
-32763,
-32770,
-32764,
-32770,
-32764,
-32771,
-32764,
-32768,
-32768,
-32764,
-32771,
-32763,
-32770,
-32766,
-32766,
-32769,
-32766,
-32768,
-32768,
-32763,
-32768,
-32767,
-32767,
-32769,
-32764,
-32768,
-32767,
-32767,
-32768,
-32764,
-32770,
-32762,
-32773,
-32762,
-32770,
-32765,
-32768,
-32767,
-32768,
-32766,
-32768,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32769,
-32766,
-32769,
-32765,
-32770,
-32764,
-32768,
-32767,
-32767,
-32766,
-32769,
-32764,
-32770,
-32762,
-32767,
-32765,
-32769,
-32766,
-32767,
-32767,
-32765,
-32770,
-32763,
-32771,
-32761,
-32767,
-32764,
-32767,
-32766,
-32768,
-32767,
-32766,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32769,
-32764,
-32769,
-32765,
-32769,
-32767,
-32766,
-32769,
-32764,
-32769,
-32766,
-32767,
-32767,
-32766,
-32767,
-32768,
-32767,
-32767,
-32766,
-32767,
-32768,
-32766,
-32770,
-32764,
-32770,
-32766,
-32765,
-32770,
-32762,
-32772,
-32764,
-32769,
-32770,
-32764,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32767,
-32764,
-32767,
-32768,
-32766,
-32768,
-32766,
-32766,
-32769,
-32765,
-32768,
-32766,
-32765,
-32766,
-32766,
-32769,
-32766,
-32767,
-32769,
-32764,
-32770,
-32764,
-32768,
-32768,
-32764,
-32769,
-32767,
-32764,
-32771,
-32764,
-32769,
-32768,
-32764,
-32770,
-32765,
-32768,
-32767,
-32764,
-32768,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32766,
-32770,
-32764,
-32769,
-32766,
-32765,
-32770,
-32763,
-32770,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32768,
-32768,
-32765,
-32769,
-32764,
-32770,
-32763,
-32772,
-32761,
-32770,
-32763,
-32770,
-32765,
-32770,
-32764,
-32770,
-32764,
-32769,
-32766,
-32767,
-32768,
-32767,
-32768,
-32766,
-32768,
-32763,
-32765,
-32767,
-32765,
-32770,
-32766,
-32768,
-32767,
-32766,
-32767,
-32766,
-32761,
-32770,
-32765,
-32770,
-32765,
-32770,
-32763,
-32771,
-32763,
-32768,
-32768,
-32764,
-32772,
-32762,
-32771,
-32764,
-32770,
-32764,
-32769,
-32768,
-32768,
-32769,
-32763,
-32771,
-32763,
-32770,
-32765,
-32769,
-32764,
-32767,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32767,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32770,
-32764,
-32769,
-32765,
-32769,
-32766,
-32767,
-32768,
-32766,
-32769,
-32765,
-32770,
-32763,
-32770,
-32762,
-32772,
-32764,
-32769,
-32766,
-32767,
-32768,
-32766,
-32767,
-32762,
-32767,
-32766,
-32767,
-32767,
-32765,
-32763,
-32769,
-32766,
-32767,
-32768,
-32765,
-32768,
-32767,
-32765,
-32770,
-32764,
-32769,
-32768,
-32765,
-32768,
-32766,
-32769,
-32764,
-32767,
-32766,
-32765,
-32769,
-32764,
-32771,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32768,
-32768,
-32765,
-32770,
-32764,
-32772,
-32764,
-32769,
-32767,
-32765,
-32770,
-32763,
-32770,
-32763,
-32770,
-32765,
-32768,
-32767,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32768,
-32765,
-32766,
-32765,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32769,
-32767,
-32766,
-32768,
-32767,
-32765,
-32769,
-32764,
-32769,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32764,
-32769,
-32766,
-32769,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32766,
-32768,
-32765,
-32766,
-32766,
-32769,
-32765,
-32768,
-32768,
-32765,
-32771,
-32763,
-32769,
-32763,
-32765,
-32767,
-32767,
-32766,
-32767,
-32768,
-32765,
-32770,
-32764,
-32772,
-32763,
-32770,
-32765,
-32768,
-32765,
-32770,
-32763,
-32771,
-32765,
-32768,
-32767,
-32767,
-32765,
-32770,
-32764,
-32768,
-32767,
-32762,
-32772,
-32762,
-32771,
-32764,
-32770,
-32766,
-32767,
-32768,
-32766,
-32767,
-32767,
-32767,
-32767,
-32768,
-32765,
-32768,
-32767,
-32766,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32770,
-32765,
-32767,
-32768,
-32765,
-32766,
-32764,
-32767,
-32767,
-32767,
-32768,
-32766,
-32767,
-32768,
-32766,
-32766,
-32765,
-32767,
-32767,
-32767,
-32766,
-32769,
-32765,
-32768,
-32765,
-32768,
-32768,
-32765,
-32770,
-32765,
-32769,
-32767,
-32765,
-32768,
-32765,
-32769,
-32767,
-32768,
-32767,
-32767,
-32766,
-32765,
-32766,
-32768,
-32765,
-32768,
-32768,
-32764,
-32770,
-32764,
-32769,
-32767,
-32766,
-32769,
-32766,
-32769,
-32765,
-32769,
-32764,
-32771,
-32763,
-32770,
-32766,
-32765,
-32770,
-32764,
-32771,
-32764,
-32767,
-32767,
-32769,
-32766,
-32770,
-32762,
-32770,
-32764,
-32769,
-32764,
-32765,
-32766,
-32767,
-32768,
-32765,
-32770,
-32765,
-32770,
-32766,
-32768,
-32765,
-32768,
-32767,
-32768,
-32768,
-32764,
-32768,
-32765,
-32767,
-32767,
-32767,
-32765,
-32766,
-32767,
-32766,
-32767,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32767,
-32769,
-32766,
-32768,
-32768,
-32764,
-32768,
-32765,
-32768,
-32767,
-32765,
-32769,
-32767,
-32767,
-32767,
-32767,
-32766,
-32769,
-32766,
-32767,
-32765,
-32764,
-32768,
-32766,
-32765,
-32765,
-32766,
-32769,
-32765,
-32769,
-32766,
-32768,
-32766,
-32768,
-32765,
-32767,
-32765,
-32769,
-32763,
-32768,
-32766,
-32771,
-32768,
-32767,
-32768,
-32766,
-32769,
-32765,
-32770,
-32767,
-32766,
-32768,
-32764,
-32769,
-32766,
-32767,
-32766,
-32766,
-32768,
-32767,
-32768,
-32766,
-32768,
-32766,
-32766,
-32770,
-32763,
-32768,
-32764,
-32765,
-32770,
-32764,
-32766,
-32769,
-32762,
-32768,
-32766,
-32771,
-32769,
-32767,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32768,
-32763,
-32772,
-32764,
-32769,
-32766,
-32766,
-32767,
-32768,
-32764,
-32769,
-32766,
-32767,
-32765,
-32765,
-32770,
-32765,
-32765,
-32763,
-32766,
-32769,
-32766,
-32768,
-32763,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32764,
-32771,
-32764,
-32771,
-32765,
-32766,
-32768,
-32765,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32769,
-32767,
-32767,
-32766,
-32768,
-32765,
-32769,
-32762,
-32768,
-32767,
-32767,
-32767,
-32767,
-32765,
-32769,
-32765,
-32769,
-32766,
-32769,
-32766,
-32766,
-32769,
-32766,
-32765,
-32769,
-32762,
-32770,
-32765,
-32766,
-32768,
-32766,
-32767,
-32767,
-32766,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32763,
-32768,
-32768,
-32764,
-32773,
-32761,
-32773,
-32761,
-32770,
-32767,
-32765,
-32768,
-32764,
-32768,
-32767,
-32765,
-32769,
-32766,
-32769,
-32764,
-32769,
-32764,
-32769,
-32767,
-32769,
-32769,
-32767,
-32767,
-32767,
-32765,
-32769,
-32766,
-32767,
-32769,
-32763,
-32768,
-32765,
-32771,
-32763,
-32771,
-32762,
-32771,
-32764,
-32770,
-32764,
-32768,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32763,
-32767,
-32769,
-32765,
-32768,
-32765,
-32768,
-32766,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32768,
-32765,
-32759,
-32767,
-32764,
-32768,
-32768,
-32765,
-32770,
-32763,
-32770,
-32764,
-32770,
-32765,
-32768,
-32766,
-32765,
-32767,
-32765,
-32770,
-32765,
-32770,
-32767,
-32766,
-32768,
-32766,
-32767,
-32768,
-32764,
-32770,
-32764,
-32772,
-32762,
-32771,
-32765,
-32767,
-32765,
-32763,
-32768,
-32768,
-32766,
-32769,
-32764,
-32770,
-32765,
-32767,
-32770,
-32763,
-32770,
-32763,
-32769,
-32765,
-32769,
-32765,
-32767,
-32768,
-32765,
-32770,
-32765,
-32769,
-32765,
-32769,
-32765,
-32769,
-32767,
-32767,
-32768,
-32766,
-32768,
-32767,
-32765,
-32769,
-32764,
-32770,
-32763,
-32770,
-32765,
-32765,
-32764,
-32764,
-32769,
-32767,
-32768,
-32762,
-32769,
-32767,
-32767,
-32768,
-32765,
-32770,
-32765,
-32770,
-32762,
-32767,
-32766,
-32769,
-32766,
-32767,
-32766,
-32767,
-32767,
-32764,
-32771,
-32765,
-32767,
-32769,
-32765,
-32768,
-32767,
-32766,
-32768,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32768,
-32766,
-32767,
-32760,
-32762,
-32763,
-32765,
-32770,
-32765,
-32769,
-32766,
-32767,
-32768,
-32767,
-32765,
-32769,
-32763,
-32769,
-32767,
-32766,
-32768,
-32765,
-32767,
-32768,
-32768,
-32767,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32767,
-32767,
-32767,
-32771,
-32763,
-32771,
-32763,
-32771,
-32764,
-32769,
-32765,
-32766,
-32765,
-32768,
-32766,
-32767,
-32769,
-32766,
-32768,
-32764,
-32765,
-32766,
-32766,
-32767,
-32768,
-32765,
-32766,
-32765,
-32769,
-32764,
-32771,
-32765,
-32769,
-32767,
-32765,
-32765,
-32766,
-32764,
-32769,
-32764,
-32769,
-32767,
-32767,
-32767,
-32764,
-32769,
-32768,
-32769,
-32758,
-32767,
-32761,
-32771,
-32761,
-32772,
-32765,
-32768,
-32766,
-32768,
-32767,
-32766,
-32765,
-32769,
-32765,
-32769,
-32765,
-32767,
-32768,
-32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32767,
-32766,
-32769,
-32765,
-32768,
-32767,
-32768,
-32766,
-32766,
-32767,
-32762,
-32771,
-32763,
-32772,
-32763,
-32770,
-32765,
-32770,
-32767,
-32764,
-32769,
-32763,
-32770,
-32762,
-32766,
-32765,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32765,
-32767,
-32767,
-32767,
-32770,
-32763,
-32771,
-32763,
-32770,
-32765,
-32768,
-32769,
-32765,
-32766,
-32769,
-32763,
-32771,
-32763,
-32768,
-32767,
-32765,
-32770,
-32765,
-32769,
-32767,
-32767,
-32768,
-32766,
-32767,
-32766,
-32767,
-32764,
-32768,
-32764,
-32767,
-32767,
-32764,
-32770,
-32765,
-32769,
-32768,
-32766,
-32768,
-32765,
-32765,
-32767,
-32763,
-32769,
-32765,
-32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32765,
-32769,
-32766,
-32769,
-32765,
-32768,
-32767,
-32767,
-32766,
-32768,
-32765,
-32771,
-32765,
-32768,
-32768,
-32763,
-32770,
-32764,
-32768,
-32763,
-32768,
-32767,
-32766,
-32769,
-32765,
-32769,
-32765,
-32765,
-32769,
-32765,
-32768,
-32767,
-32767,
-32768,
-32765,
-32770,
-32764,
-32768,
-32766,
-32767,
-32767,
-32768,
-32765,
-32767,
-32765,
-32763,
-32766,
-32767,
-32765,
-32768,
-32765,
-32769,
-32766,
-32764,
-32769,
-32764,
-32769,
-32764,
-32769,
-32765,
-32769,
-32764,
-32769,
-32766,
-32768,
-32765,
-32769,
-32765,
-32769,
-32765,
-32768,
-32766,
-32765,
-32764,
-32768,
-32765,
-32770,
-32767,
-32770,
-32764,
-32765,
-32767,
-32768,
-32765,
-32769,
-32764,
-32770,
-32765,
-32769,
-32767,
-32768,
-32763,
-32769,
-32764,
-32770,
-32765,
-32768,
-32766,
-32769,
-32765,
-32767,
-32766,
-32769,
-32765,
-32768,
-32768,
-32766,
-32765,
-32766,
-32768,
-32766,
-32769,
-32764,
-32766,
-32765,
-32769,
-32766,
-32770,
-32763,
-32772,
-32763,
-32768,
-32768,
-32765,
-32768,
-32767,
-32765,
-32768,
-32764,
-32768,
-32765,
-32769,
-32766,
-32769,
-32766,
-32767,
-32768,
-32765,
-32769,
-32764,
-32769,
-32765,
-32770,
-32765,
-32768,
-32767,
-32767,
-32766,
-32769,
-32765,
-32767,
-32764,
-32767,
-32766,
-32768,
-32766,
-32768,
-32768,
-32763,
-32770,
-32766,
-32768,
-32768,
-32765,
-32770,
-32763,
-32771,
-32763,
-32769,
-32763,
-32766,
-32767,
-32766,
-32768,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32770,
-32764,
-32769,
-32765,
-32769,
-32765,
-32767,
-32768,
-32764,
-32772,
-32762,
-32771,
-32765,
-32769,
-32767,
-32765,
-32768,
-32766,
-32766,
-32764,
-32769,
-32763,
-32771,
-32762,
-32771,
-32766,
-32768,
-32767,
-32766,
-32767,
-32768,
-32767,
-32766,
-32768,
-32768,
-32766,
-32768,
-32766,
-32769,
-32766,
-32769,
-32763,
-32771,
-32762,
-32771,
-32765,
-32767,
-32768,
-32765,
-32771,
-32764,
-32770,
-32764,
-32770,
-32762,
-32767,
-32765,
-32768,
-32766,
-32769,
-32765,
-32768,
-32766,
-32765,
-32771,
-32763,
-32771,
-32762,
-32772,
-32762,
-32772,
-32762,
-32771,
-32765,
-32767,
-32767,
-32764,
-32769,
-32766,
-32767,
-32770,
-32762,
-32772,
-32764,
-32769,
-32768,
-32765,
-32768,
-32765,
-32767,
-32769,
-32766,
-32768,
-32766,
-32763,
-32764,
-32767,
-32764,
-32770,
-32763,
-32770,
-32766,
-32768,
-32768,
-32766,
-32769,
-32765,
-32767,
-32768,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32765,
-32768,
-32767,
-32766,
-32766,
-32766,
-32766,
-32763,
-32767,
-32765,
-32769,
-32768,
-32769,
-32769,
-32767,
-32766,
-32768,
-32764,
-32769,
-32766,
-32767,
-32763,
-32768,
-32765,
-32762,
-32768,
-32763,
-32770,
-32767,
-32768,
-32769,
-32763,
-32770,
-32765,
-32767,
-32767,
-32766,
-32767,
-32768,
-32767,
-32767,
-32768,
-32766,
-32766,
-32765,
-32764,
-32767,
-32767,
-32768,
-32767,
-32767,
-32767,
-32764,
-32769,
-32764,
-32770,
-32765,
-32771,
-32764,
-32770,
-32764,
-32769,
-32763,
-32770,
-32761,
-32771,
-32763,
-32770,
-32765,
-32768,
-32765,
-32769,
-32764,
-32768,
-32768,
-32767,
-32770,
-32762,
-32768,
-32765,
-32768,
-32768,
-32765,
-32768,
-32764,
-32769,
-32764,
-32769,
-32764,
-32769,
-32766,
-32768,
-32765,
-32768,
-32766,
-32766,
-32763,
-32769,
-32766,
-32767,
-32766,
-32768,
-32768,
-32767,
-32765,
-32768,
-32765,
-32770,
-32766,
-32767,
-32769,
-32764,
-32767,
-32766,
-32767,
-32768,
-32765,
-32768,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32766,
-32768,
-32767,
-32766,
-32768,
-32766,
-32767,
-32764,
-32765,
-32763,
-32771,
-32764,
-32768,
-32768,
-32764,
-32770,
-32763,
-32770,
-32763,
-32769,
-32766,
-32769,
-32765,
-32768,
-32766,
-32766,
-32770,
-32764,
-32769,
-32765,
-32770,
-32765,
-32768,
-32766,
-32767,
-32768,
-32765,
-32769,
-32766,
-32767,
-32771,
-32765,
-32766,
-32765,
-32766,
-32766,
-32765,
-32765,
-32766,
-32768,
-32765,
-32768,
-32766,
-32768,
-32767,
-32767,
-32768,
-32767,
-32766,
-32767,
-32764,
-32770,
-32764,
-32772,
-32761,
-32771,
-32762,
-32769,
-32767,
-32766,
-32767,
-32768,
-32766,
-32768,
-32769,
-32768,
-32767,
-32763,
-32769,
-32765,
-32766,
-32763,
-32767,
-32766,
-32768,
-32764,
-32770,
-32764,
-32769,
-32763,
-32769,
-32765,
-32769,
-32766,
-32769,
-32766,
-32769,
-32766,
-32767,
-32766,
-32767,
-32766,
-32769,
-32762,
-32772,
-32763,
-32770,
-32766,
-32768,
-32768,
-32764,
-32771,
-32764,
-32769,
-32766,
-32768,
-32766,
-32764,
-32765,
-32768,
-32766,
-32769,
-32763,
-32768,
-32762,
-32768,
-32766,
-32767,
-32768,
-32767,
-32767,
-32768,
-32764,
-32770,
-32766,
-32765,
-32765,
-32765,
-32768,
-32766,
-32768,
-32765,
-32768,
-32767,
-32766,
-32770,
-32763,
-32772,
-32763,
-32770,
-32764,
-32768,
-32768,
-32765,
-32769,
-32764,
-32768,
-32767,
-32765,
-32768,
-32766,
-32767,
-32769,
-32762,
-32770,
-32760,
-32773,
-32762,
-32772,
-32765,
-32766,
-32766,
-32765,
-32769,
-32766,
-32767,
-32768,
-32764,
-32769,
-32765,
-32770,
-32765,
-32769,
-32764,
-32771,
-32764,
-32769,
-32765,
-32768,
-32769,
-32764,
-32765,
-32764,
-32766,
-32768,
-32766,
-32767,
-32764,
-32764,
-32767,
-32764,
-32768,
-32761,
-32771,
-32766,
-32766,
-32770,
-32764,
-32770,
-32764,
-32766,
-32770,
-32762,
-32773,
-32762,
-32771,
-32764,
-32769,
-32765,
-32768,
-32766,
-32769,
-32767,
-32769,
-32767,
-32767,
-32766,
-32766,
-32768,
-32766,
-32767,
-32768,
-32765,
-32768,
-32766,
-32766,
-32768,
-32765,
-32768,
-32767,
-32767,
-32766,
-32767,
-32767,
-32765,
-32769,
-32765,
-32770,
-32762,
-32768,
-32764,
-32770,
-32765,
-32769,
-32765,
-32766,
-32770,
-32762,
-32771,
-32764,
-32768,
-32769,
-32765,
-32766,
-32768,
-32764,
-32768,
-32761,
-32768,
-32767,
-32765,
-32771,
-32764,
-32768,
-32766,
-32768,
-32766,
-32769,
-32767,
-32767,
-32766,
-32769,
-32765,
-32770,
-32761,
-32772,
-32762,
-32771,
-32766,
-32768,
-32767,
-32768,
-32766,
-32767,
-32771,
-32767,
-32767,
-32769,
-32765,
-32768,
-32765,
-32769,
-32763,
-32770,
-32765,
-32767,
-32770,
-32765,
-32769,
-32763,
-32763,
-32765,
-32764,
-32768,
-32767,
-32765,
-32771,
-32764,
-32770,
-32764,
-32768,
-32767,
-32767,
-32768,
-32766,
-32769,
-32764,
-32770,
-32764,
-32768,
-32767,
-32767,
-32768,
-32767,
-32767,
-32761,
-32767,
-32766,
-32768,
-32768,
-32766,
-32768,
-32766,
-32768,
-32764,
-32772,
-32763,
-32770,
-32764,
-32767,
-32767,
-32768,
-32767,
-32768,
-32766,
-32766,
-32766,
-32767,
-32765,
-32769,
-32764,
-32768,
-32768,
-32767,
-32767,
-32765,
-32764,
-32768,
-32765,
-32769,
-32765,
-32766,
-32764,
-32768,
-32769,
-32767,
-32769,
-32765,
-32771,
-32763,
-32769,
-32765,
-32767,
-32767,
-32768,
-32766,
-32768,
-32762,
-32766,
-32767,
-32767,
-32769,
-32767,
-32768,
-32766,
-32763,
-32769,
-32766,
-32766,
-32767,
-32767,
-32766,
-32769,
-32764,
-32771,
-32765,
-32768,
-32761,
-32768,
-32765,
-32768,
-32766,
-32762,
-32769,
-32764,
-32769,
-32764,
-32771,
-32764,
-32770,
-32764,
-32768,
-32768,
-32767,
-32765,
-32767,
-32766,
-32773,
-32766,
-32768,
-32763,
-32769,
-32766,
-32769,
-32766,
-32768,
-32766,
-32767,
-32768,
-32767,
-32767,
-32770,
-32765,
-32766,
-32763,
-32769,
-32766,
-32768,
-32766,
-32763,
-32765,
-32767,
-32766,
-32769,
-32764,
-32771,
-32761,
-32769,
-32766,
-32767,
-32765,
-32765,
-32768,
-32766,
-32767,
-32766,
-32766,
-32769,
-32766,
-32768,
-32766,
-32768,
-32767,
-32768,
-32764,
-32769,
-32766,
-32769,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32768,
-32765,
-32768,
-32762,
-32767,
-32764,
-32769,
-32765,
-32768,
-32768,
-32766,
-32768,
-32768,
-32767,
-32766,
-32768,
-32766,
-32769,
-32766,
-32766,
-32768,
-32764,
-32769,
-32766,
-32767,
-32767,
-32766,
-32768,
-32768,
-32764,
-32769,
-32766,
-32764,
-32766,
-32766,
-32766,
-32766,
-32766,
-32770,
-32764,
-32765,
-32766,
-32768,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32767,
-32766,
-32767,
-32767,
-32765,
-32765,
-32767,
-32766,
-32768,
-32765,
-32768,
-32766,
-32766,
-32766,
-32766,
-32766,
-32767,
-32767,
-32768,
-32764,
-32769,
-32766,
-32767,
-32770,
-32765,
-32769,
-32765,
-32766,
-32765,
-32767,
-32767,
-32765,
-32766,
-32766,
-32767,
-32766,
-32767,
-32766,
-32768,
-32767,
-32768,
-32767,
-32767,
-32768,
-32765,
-32770,
-32765,
-32768,
-32768,
-32765,
-32768,
-32765,
-32769,
-32764,
-32770,
-32763,
-32770,
-32764,
-32769,
-32767,
-32768,
-32768,
-32766,
-32768,
-32766,
-32768,
-32764,
-32767,
-32767,
-32766,
-32765,
-32767,
-32768,
-32767,
-32768,
-32768,
-32764,
-32769,
-32766,
-32767,
-32766,
-32766,
-32769,
-32765,
-32770,
-32765,
-32767,
-32768,
-32766,
-32764,
-32767,
-32764,
-32769,
-32765,
-32768,
-32767,
-32770,
-32765,
-32768,
-32768,
-32765,
-32767,
-32763,
-32766,
-32768,
-32767,
-32766,
-32767,
-32767,
-32770,
-32768,
-32769,
-32765,
-32773,
-32763,
-32767,
-32765,
-32768,
-32767,
-32767,
-32769,
-32765,
-32769,
-32765,
-32768,
-32763,
-32765,
-32765,
-32770,
-32764,
-32770,
-32765,
-32768,
-32763,
-32767,
-32763,
-32769,
-32765,
-32766,
-32763,
-32768,
-32765,
-32769,
-32766,
-32767,
-32766,
-32767,
-32768,
-32767,
-32768,
-32766,
-32766,
-32764,
-32766,
-32766,
-32768,
-32768,
-32766,
-32768,
-32767,
-32767,
-32765,
-32770,
-32764,
-32770,
-32763,
-32769,
-32766,
-32767,
-32766,
-32767,
-32767,
-32766,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32771,
-32764,
-32768,
-32767,
-32767,
-32767,
-32768,
-32765,
-32767,
-32768,
-32765,
-32770,
-32766,
-32767,
-32765,
-32764,
-32769,
-32767,
-32767,
-32767,
-32767,
-32766,
-32764,
-32768,
-32766,
-32769,
-32767,
-32764,
-32767,
-32765,
-32768,
-32768,
-32765,
-32769,
-32765,
-32769,
-32766,
-32766,
-32769,
-32765,
-32767,
-32766,
-32766,
-32768,
-32767,
-32766,
-32768,
-32765,
-32768,
-32768,
-32765,
-32770,
-32762,
-32770,
-32765,
-32768,
-32766,
-32768,
-32765,
-32770,
-32765,
-32768,
-32766,
-32767,
-32767,
-32766,
-32767,
-32768,
-32765,
-32771,
-32761,
-32773,
-32762,
-32771,
-32766,
-32767,
-32766,
-32767,
-32765,
-32766,
-32763,
-32769,
-32765,
-32768,
-32767,
-32766,
-32767,
-32768,
-32767,
-32767,
-32770,
-32766,
-32769,
-32761,
-32769,
-32766,
-32767,
-32767,
-32766,
-32768,
-32765,
-32766,
-32767,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32768,
-32766,
-32767,
-32767,
-32766,
-32768,
-32763,
-32768
-};
+ASSET_EMBED(gameBoyStartup_wav, "gameBoyStartup.wav.bin");
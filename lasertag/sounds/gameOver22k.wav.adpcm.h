@@ -0,0 +1,7 @@
+// This file was generated by executing this statement: wav2c -a -b gameOver22k.wav
+extern const uint8_t gameOver22k_wav_adpcm[];
+#define GAMEOVER22K_WAV_ADPCM_SAMPLE_RATE 22050
+#define GAMEOVER22K_WAV_ADPCM_BITS_PER_SAMPLE 4
+#define GAMEOVER22K_WAV_ADPCM_BLOCK_BYTES 256
+#define GAMEOVER22K_WAV_ADPCM_NUMBER_OF_SAMPLES 71936
+#define GAMEOVER22K_WAV_ADPCM_NUMBER_OF_BYTES 36469
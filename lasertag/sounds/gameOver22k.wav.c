@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -b gameOver22k.wav
+
+#include "assetEmbed.h"
+
+ASSET_EMBED(gameOver22k_wav, "gameOver22k.wav.bin");
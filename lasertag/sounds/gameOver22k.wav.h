@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -b gameOver22k.wav
+extern const uint16_t gameOver22k_wav[];
+#define GAMEOVER22K_WAV_SAMPLE_RATE 22050
+#define GAMEOVER22K_WAV_BITS_PER_SAMPLE 16
+#define GAMEOVER22K_WAV_NUMBER_OF_SAMPLES 71936
@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -a -b gameOver48k.wav
+
+#include "assetEmbed.h"
+
+ASSET_EMBED(gameOver48k_wav_adpcm, "gameOver48k.wav.adpcm.bin");
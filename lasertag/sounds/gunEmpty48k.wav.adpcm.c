@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -a -b gunEmpty48k.wav
+
+#include "assetEmbed.h"
+
+ASSET_EMBED(gunEmpty48k_wav_adpcm, "gunEmpty48k.wav.adpcm.bin");
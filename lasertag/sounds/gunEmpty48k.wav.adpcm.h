@@ -0,0 +1,7 @@
+// This file was generated by executing this statement: wav2c -a -b gunEmpty48k.wav
+extern const uint8_t gunEmpty48k_wav_adpcm[];
+#define GUNEMPTY48K_WAV_ADPCM_SAMPLE_RATE 48000
+#define GUNEMPTY48K_WAV_ADPCM_BITS_PER_SAMPLE 4
+#define GUNEMPTY48K_WAV_ADPCM_BLOCK_BYTES 256
+#define GUNEMPTY48K_WAV_ADPCM_NUMBER_OF_SAMPLES 15456
+#define GUNEMPTY48K_WAV_ADPCM_NUMBER_OF_BYTES 7837
@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -a -b ouch48k.wav
+
+#include "assetEmbed.h"
+
+ASSET_EMBED(ouch48k_wav_adpcm, "ouch48k.wav.adpcm.bin");
@@ -0,0 +1,7 @@
+// This file was generated by executing this statement: wav2c -a -b ouch48k.wav
+extern const uint8_t ouch48k_wav_adpcm[];
+#define OUCH48K_WAV_ADPCM_SAMPLE_RATE 48000
+#define OUCH48K_WAV_ADPCM_BITS_PER_SAMPLE 4
+#define OUCH48K_WAV_ADPCM_BLOCK_BYTES 256
+#define OUCH48K_WAV_ADPCM_NUMBER_OF_SAMPLES 23467
+#define OUCH48K_WAV_ADPCM_NUMBER_OF_BYTES 11898
@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -a -b pacmanDeath.wav
+
+#include "assetEmbed.h"
+
+ASSET_EMBED(pacmanDeath_wav_adpcm, "pacmanDeath.wav.adpcm.bin");
@@ -0,0 +1,7 @@
+// This file was generated by executing this statement: wav2c -a -b pacmanDeath.wav
+extern const uint8_t pacmanDeath_wav_adpcm[];
+#define PACMANDEATH_WAV_ADPCM_SAMPLE_RATE 48000
+#define PACMANDEATH_WAV_ADPCM_BITS_PER_SAMPLE 4
+#define PACMANDEATH_WAV_ADPCM_BLOCK_BYTES 256
+#define PACMANDEATH_WAV_ADPCM_NUMBER_OF_SAMPLES 82712
+#define PACMANDEATH_WAV_ADPCM_NUMBER_OF_BYTES 41930
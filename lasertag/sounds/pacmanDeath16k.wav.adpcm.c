@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -a -b pacmanDeath16k.wav
+
+#include "assetEmbed.h"
+
+ASSET_EMBED(pacmanDeath16k_wav_adpcm, "pacmanDeath16k.wav.adpcm.bin");
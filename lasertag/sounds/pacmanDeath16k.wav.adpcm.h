@@ -0,0 +1,7 @@
+// This file was generated by executing this statement: wav2c -a -b pacmanDeath16k.wav
+extern const uint8_t pacmanDeath16k_wav_adpcm[];
+#define PACMANDEATH16K_WAV_ADPCM_SAMPLE_RATE 16000
+#define PACMANDEATH16K_WAV_ADPCM_BITS_PER_SAMPLE 4
+#define PACMANDEATH16K_WAV_ADPCM_BLOCK_BYTES 256
+#define PACMANDEATH16K_WAV_ADPCM_NUMBER_OF_SAMPLES 27571
+#define PACMANDEATH16K_WAV_ADPCM_NUMBER_OF_BYTES 13978
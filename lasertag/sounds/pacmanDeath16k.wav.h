@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -b pacmanDeath16k.wav
+extern const uint16_t pacmanDeath16k_wav[];
+#define PACMANDEATH16K_WAV_SAMPLE_RATE 16000
+#define PACMANDEATH16K_WAV_BITS_PER_SAMPLE 16
+#define PACMANDEATH16K_WAV_NUMBER_OF_SAMPLES 27571
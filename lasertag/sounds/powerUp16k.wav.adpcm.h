@@ -0,0 +1,7 @@
+// This file was generated by executing this statement: wav2c -a -b powerUp16k.wav
+extern const uint8_t powerUp16k_wav_adpcm[];
+#define POWERUP16K_WAV_ADPCM_SAMPLE_RATE 16000
+#define POWERUP16K_WAV_ADPCM_BITS_PER_SAMPLE 4
+#define POWERUP16K_WAV_ADPCM_BLOCK_BYTES 256
+#define POWERUP16K_WAV_ADPCM_NUMBER_OF_SAMPLES 20160
+#define POWERUP16K_WAV_ADPCM_NUMBER_OF_BYTES 10220
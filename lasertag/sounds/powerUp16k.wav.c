@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -b powerUp16k.wav
+
+#include "assetEmbed.h"
+
+ASSET_EMBED(powerUp16k_wav, "powerUp16k.wav.bin");
@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -b powerUp16k.wav
+extern const uint16_t powerUp16k_wav[];
+#define POWERUP16K_WAV_SAMPLE_RATE 16000
+#define POWERUP16K_WAV_BITS_PER_SAMPLE 16
+#define POWERUP16K_WAV_NUMBER_OF_SAMPLES 20160
@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -a -b powerUp48k.wav
+
+#include "assetEmbed.h"
+
+ASSET_EMBED(powerUp48k_wav_adpcm, "powerUp48k.wav.adpcm.bin");
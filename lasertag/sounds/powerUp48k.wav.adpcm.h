@@ -0,0 +1,7 @@
+// This file was generated by executing this statement: wav2c -a -b powerUp48k.wav
+extern const uint8_t powerUp48k_wav_adpcm[];
+#define POWERUP48K_WAV_ADPCM_SAMPLE_RATE 48000
+#define POWERUP48K_WAV_ADPCM_BITS_PER_SAMPLE 4
+#define POWERUP48K_WAV_ADPCM_BLOCK_BYTES 256
+#define POWERUP48K_WAV_ADPCM_NUMBER_OF_SAMPLES 60480
+#define POWERUP48K_WAV_ADPCM_NUMBER_OF_BYTES 30660
@@ -0,0 +1,7 @@
+// This file was generated by executing this statement: wav2c -a -b screamAndDie22k.wav
+extern const uint8_t screamAndDie22k_wav_adpcm[];
+#define SCREAMANDDIE22K_WAV_ADPCM_SAMPLE_RATE 22050
+#define SCREAMANDDIE22K_WAV_ADPCM_BITS_PER_SAMPLE 4
+#define SCREAMANDDIE22K_WAV_ADPCM_BLOCK_BYTES 256
+#define SCREAMANDDIE22K_WAV_ADPCM_NUMBER_OF_SAMPLES 39579
+#define SCREAMANDDIE22K_WAV_ADPCM_NUMBER_OF_BYTES 20066
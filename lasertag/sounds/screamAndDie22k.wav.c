@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -b screamAndDie22k.wav
+
+#include "assetEmbed.h"
+
+ASSET_EMBED(screamAndDie22k_wav, "screamAndDie22k.wav.bin");
@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -b screamAndDie22k.wav
+extern const uint16_t screamAndDie22k_wav[];
+#define SCREAMANDDIE22K_WAV_SAMPLE_RATE 22050
+#define SCREAMANDDIE22K_WAV_BITS_PER_SAMPLE 16
+#define SCREAMANDDIE22K_WAV_NUMBER_OF_SAMPLES 39579
@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2c -a -b screamAndDie48k.wav
+
+#include "assetEmbed.h"
+
+ASSET_EMBED(screamAndDie48k_wav_adpcm, "screamAndDie48k.wav.adpcm.bin");
@@ -0,0 +1,7 @@
+// This file was generated by executing this statement: wav2c -a -b screamAndDie48k.wav
+extern const uint8_t screamAndDie48k_wav_adpcm[];
+#define SCREAMANDDIE48K_WAV_ADPCM_SAMPLE_RATE 48000
+#define SCREAMANDDIE48K_WAV_ADPCM_BITS_PER_SAMPLE 4
+#define SCREAMANDDIE48K_WAV_ADPCM_BLOCK_BYTES 256
+#define SCREAMANDDIE48K_WAV_ADPCM_NUMBER_OF_SAMPLES 86158
+#define SCREAMANDDIE48K_WAV_ADPCM_NUMBER_OF_BYTES 43678
@@ -4,6 +4,10 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <math.h>
+
+// For -a. Build with the lasertag directory on the include path, and soundAdpcm.c.
+#include "soundAdpcm.h"
 
 
 // Leave the following line uncommented unless you want to generate a simple tone.
@@ -14,7 +18,14 @@
 #define H_FILE_SUFFIX ".h"      // .h files have this suffix.
 #define C_FILE_SUFFIX ".c"      // .c files have this suffix.
 #define EXTERN_STATEMENT "extern"  // Just the C extern statement.
-#define C_DATA_TYPE "uint16_t"  // Type for data in the .c file
+#define C_DATA_TYPE "const uint16_t"  // Type for data in the .c file
+#define ADPCM_OPTION "-a"       // Encode as IMA-ADPCM (soundAdpcm.h) instead.
+#define ADPCM_SUFFIX ".adpcm"   // ADPCM .c and .h files have this before their suffix.
+#define ADPCM_C_DATA_TYPE "const uint8_t"  // Type for ADPCM data in the .c file.
+#define ADPCM_BYTES_PER_LINE 16 // ADPCM data is written this many bytes to a line.
+#define BINARY_OPTION "-b"      // Write the data to a .bin file that the .c file embeds.
+#define BIN_FILE_SUFFIX ".bin"  // .bin files have this suffix.
+#define EMBED_HEADER "assetEmbed.h"  // Declares ASSET_EMBED(), which links in a .bin file.
 #define SUPPORTED_WAVE_DATA_BIT_SIZE 16  // Program can only handle this size of data for now.
 
 // Header-specific defines. All sizes are numbered in bytes.
@@ -124,14 +135,146 @@ const char *get_filename_extension(const char* fileName) {
   return dot + 1;                            // Advance to the string that follows "."
 }
 
+// Writes byteCount bytes of data to baseName.bin, and baseName.c, which links them in as
+// arrayName (see assetEmbed.h). statement is the wav2c command, for the comment.
+void writeEmbeddedData(const char* baseName, const char* statement, const char* arrayName,
+                       const uint8_t* data, uint32_t byteCount) {
+  char binFileName[MAX_FILENAME_LENGTH + sizeof(ADPCM_SUFFIX) + sizeof(BIN_FILE_SUFFIX)];
+  snprintf(binFileName, sizeof(binFileName), "%s%s", baseName, BIN_FILE_SUFFIX);
+  char cFileName[MAX_FILENAME_LENGTH + sizeof(ADPCM_SUFFIX) + sizeof(C_FILE_SUFFIX)];
+  snprintf(cFileName, sizeof(cFileName), "%s%s", baseName, C_FILE_SUFFIX);
+  FILE* binFileFp = fopen(binFileName, "wb");
+  FILE* cFileFp = fopen(cFileName, "w");
+  if (!binFileFp || !cFileFp) {
+    fprintf(stderr, "Unable to open file: %s for writing.\n", !binFileFp ? binFileName : cFileName);
+    exit(-1);
+  }
+  if (fwrite(data, 1, byteCount, binFileFp) != byteCount || fclose(binFileFp)) {
+    fprintf(stderr, "Unable to write file: %s.\n", binFileName);
+    exit(-1);
+  }
+  // The .c file names the .bin file without its directory: the build gives that as ASSET_DIR.
+  const char* binBaseName = strrchr(binFileName, '/');
+  binBaseName = binBaseName ? binBaseName + 1 : binFileName;
+  fprintf(cFileFp, "// This file was generated by executing this statement: wav2c %s\n", statement);
+  fprintf(cFileFp, "\n#include \"%s\"\n\n", EMBED_HEADER);
+  fprintf(cFileFp, "ASSET_EMBED(%s, \"%s\");\n", arrayName, binBaseName);
+  fclose(cFileFp);
+}
+
+// Writes byteCount bytes of data to cFileName as the array arrayName. statement is the wav2c
+// command, for the comment.
+void writeAdpcmArray(const char* cFileName, const char* statement, const char* arrayName,
+                     const uint8_t* data, uint32_t byteCount) {
+  FILE* cFileFp = fopen(cFileName, "w");
+  if (!cFileFp) {
+    fprintf(stderr, "Unable to open file: %s for writing.\n", cFileName);
+    exit(-1);
+  }
+  fprintf(cFileFp, "// This file was generated by executing this statement: wav2c %s\n", statement);
+  fprintf(cFileFp, "\n#include <stdint.h>\n\n");
+  fprintf(cFileFp, "%s %s[%d] = {\n", ADPCM_C_DATA_TYPE, arrayName, byteCount);
+  for (uint32_t i=0; i<byteCount; i++) {
+    fprintf(cFileFp, "0x%02x", data[i]);
+    if (i == byteCount-1)                              // Don't place the last comma.
+      fprintf(cFileFp, "\n");
+    else if (i % ADPCM_BYTES_PER_LINE == ADPCM_BYTES_PER_LINE-1)
+      fprintf(cFileFp, ",\n");
+    else
+      fprintf(cFileFp, ", ");
+  }
+  fprintf(cFileFp, "};\n");  // Close the array.
+  fclose(cFileFp);
+}
+
+// Writes the sampleCount samples that follow the header in inputFileFp as IMA-ADPCM to
+// inputFileName.adpcm.c and .h, or with binary to .adpcm.bin, .c and .h, and prints their
+// size and signal-to-noise ratio. statement is the wav2c command, for the comments.
+void writeAdpcmFiles(FILE* inputFileFp, const char* inputFileName, const char* statement,
+                     bool binary, const char* arrayName, const char* arrayNameUpperCase,
+                     waveFileHeader_t* header) {
+  uint32_t sampleCount = header->subchunk2Size/2;
+  uint32_t byteCount = sound_adpcmEncodedBytes(sampleCount);
+  int16_t* samples = malloc(sampleCount * sizeof(int16_t));
+  uint8_t* data = malloc(byteCount);
+  uint16_t* decoded = malloc(sampleCount * sizeof(uint16_t));
+  if (!samples || !data || !decoded) {
+    fprintf(stderr, "ERROR: out of memory for %d samples.\n", sampleCount);
+    exit(-1);
+  }
+  if (fread(samples, sizeof(int16_t), sampleCount, inputFileFp) != sampleCount) {
+    fprintf(stderr, "ERROR: %s ends before its %d samples.\n", inputFileName, sampleCount);
+    exit(-1);
+  }
+  sound_adpcmEncode(samples, sampleCount, data);
+
+  char baseName[MAX_FILENAME_LENGTH + sizeof(ADPCM_SUFFIX)];  // The file-names without suffix.
+  snprintf(baseName, sizeof(baseName), "%s%s", inputFileName, ADPCM_SUFFIX);
+  char adpcmArrayName[MAX_FILENAME_LENGTH + sizeof("_adpcm")];
+  snprintf(adpcmArrayName, sizeof(adpcmArrayName), "%s_adpcm", arrayName);
+  char hFileName[sizeof(baseName) + sizeof(H_FILE_SUFFIX)];  // .adpcm.h file-name.
+  snprintf(hFileName, sizeof(hFileName), "%s%s", baseName, H_FILE_SUFFIX);
+  char cFileName[sizeof(baseName) + sizeof(C_FILE_SUFFIX)];  // .adpcm.c file-name.
+  snprintf(cFileName, sizeof(cFileName), "%s%s", baseName, C_FILE_SUFFIX);
+  FILE* hFileFp = fopen(hFileName, "w");
+  if (!hFileFp) {
+    fprintf(stderr, "Unable to open file: %s for writing.\n", hFileName);
+    exit(-1);
+  }
+  // .h file: a comment, an extern statement and what the decoder needs to know.
+  fprintf(hFileFp, "// This file was generated by executing this statement: wav2c %s\n", statement);
+  fprintf(hFileFp, "%s %s %s[];\n", EXTERN_STATEMENT, ADPCM_C_DATA_TYPE, adpcmArrayName);
+  fprintf(hFileFp, "#define %s_ADPCM_SAMPLE_RATE %d\n", arrayNameUpperCase, header->sampleRate);
+  fprintf(hFileFp, "#define %s_ADPCM_BITS_PER_SAMPLE %d\n", arrayNameUpperCase, 4);
+  fprintf(hFileFp, "#define %s_ADPCM_BLOCK_BYTES %d\n", arrayNameUpperCase, SOUND_ADPCM_BLOCK_BYTES);
+  fprintf(hFileFp, "#define %s_ADPCM_NUMBER_OF_SAMPLES %d\n", arrayNameUpperCase, sampleCount);
+  fprintf(hFileFp, "#define %s_ADPCM_NUMBER_OF_BYTES %d\n", arrayNameUpperCase, byteCount);
+  fclose(hFileFp);
+  if (binary) {
+    writeEmbeddedData(baseName, statement, adpcmArrayName, data, byteCount);
+  } else {
+    writeAdpcmArray(cFileName, statement, adpcmArrayName, data, byteCount);
+  }
+
+  // Decode it again to report what was lost.
+  sound_adpcmDecoder_t decoder;
+  sound_adpcmStart(&decoder, data, sampleCount);
+  sound_adpcmDecode(&decoder, decoded, sampleCount);
+  double signal = 0.0;
+  double noise = 0.0;
+  for (uint32_t i=0; i<sampleCount; i++) {
+    double error = (double)decoded[i] - INT16_MAX - samples[i];
+    signal += (double)samples[i] * samples[i];
+    noise += error * error;
+  }
+  fprintf(stderr, "%s: %d samples, %d bytes instead of %d (%.2f times smaller), SNR %.1f dB.\n",
+          baseName, sampleCount, byteCount, sampleCount*2, (double)sampleCount*2/byteCount,
+          noise > 0.0 ? 10.0*log10(signal/noise) : INFINITY);
+  free(samples);
+  free(data);
+  free(decoded);
+}
+
 int main(int argc, char* argv[]) {
+  bool adpcm = false;   // With -a, write IMA-ADPCM files instead.
+  bool binary = false;  // With -b, write the data to a .bin file and embed it.
+  int arg;
+  for (arg = 1; arg < argc-1; arg++) {
+    if (!strcmp(argv[arg], ADPCM_OPTION))
+      adpcm = true;
+    else if (!strcmp(argv[arg], BINARY_OPTION))
+      binary = true;
+    else
+      break;
+  }
   // Print a helpful error message and exit if a file-name was not provided on the command line.
-  if (argc != 2) {
-    fprintf(stderr, "Usage: wav2c filename.wav\n");
+  if (argc < 2 || arg != argc-1) {
+    fprintf(stderr, "Usage: wav2c [%s] [%s] filename.wav\n", ADPCM_OPTION, BINARY_OPTION);
     exit(-1);
   }
   char inputFileName[MAX_FILENAME_LENGTH];         // Create a working buffer.
-  strncpy(inputFileName, argv[1], MAX_FILENAME_LENGTH);  // Copy the argv[1] filename into the working buffer.
+  strncpy(inputFileName, argv[argc-1], MAX_FILENAME_LENGTH-1);  // Copy the filename into the working buffer.
+  inputFileName[MAX_FILENAME_LENGTH-1] = '\0';    // strncpy() does not terminate a long name.
   // Make sure that the file-name has a .wav suffix.
   const char* extension = get_filename_extension(inputFileName);  // Get the suffix.
   // Compare the suffix and generate an error message if it is incorrect.
@@ -143,7 +286,7 @@ int main(int argc, char* argv[]) {
   // Try to open the file.
   FILE* inputFileFp = fopen(inputFileName, "rb");
   if (inputFileFp == NULL) {
-    printf("unable to find file:%s\n", argv[1]);
+    printf("unable to find file:%s\n", argv[argc-1]);
     exit(-1);
   }
   // File is present and has correct extension if you get this far.
@@ -166,28 +309,6 @@ int main(int argc, char* argv[]) {
     exit(-1);
   }
   printWaveFileHeader(stderr, &header);
-  // Everything looks good. Go ahead and generate the .h and .c files. Exit with an error if either file already exists.
-  // First, open the .h file and output the necessary declarations. Then, close the .h file.
-  char hFileName[MAX_FILENAME_LENGTH];                     // .h file-name.
-  strncpy(hFileName, inputFileName, MAX_FILENAME_LENGTH);  // Basename is just the input-file-name.
-  strncat(hFileName, H_FILE_SUFFIX, MAX_FILENAME_LENGTH);  // Add the suffix.
-  char cFileName[MAX_FILENAME_LENGTH];                     // .c file-name. 
-  strncpy(cFileName, inputFileName, MAX_FILENAME_LENGTH);  // Basename is just the input-file-name.
-  strncat(cFileName, C_FILE_SUFFIX, MAX_FILENAME_LENGTH);  // Add the suffix.
-
-  FILE* hFileFp = fopen(hFileName, "r");
-  FILE* cFileFp = fopen(cFileName, "r");
-  // If you get this far, you can go ahead and open the .c and .h files for write.
-  hFileFp = fopen(hFileName, "w");
-  cFileFp = fopen(cFileName, "w");
-  // Ensure that both files opened OK for write.
-  if ((!hFileFp && cFileFp)) {
-    if (!hFileFp)
-      fprintf(stderr, "Unable to open file: %s for writing.\n", hFileName);
-    if (!cFileFp)
-      fprintf(stderr, "Unable to open file: %s for writing.\n", cFileName);
-    exit(-1);
-  }
   char arrayName[MAX_FILENAME_LENGTH];  // Array name will be created here.
   uint32_t i = 0;
   // Need to create an array name with no ".". Replace all "." with underscore.
@@ -204,19 +325,71 @@ int main(int argc, char* argv[]) {
   for (i=0; arrayName[i] != '\0'; i++) {
     arrayNameUpperCase[i] = toupper(arrayName[i]);
   }
-  arrayNameUpperCase[i+1] = '\0';  // Make sure to terminate the string.
+  arrayNameUpperCase[i] = '\0';  // Make sure to terminate the string.
+  // The command, for the comments in the generated files.
+  char statement[MAX_FILENAME_LENGTH + sizeof(ADPCM_OPTION) + sizeof(BINARY_OPTION)];
+  snprintf(statement, sizeof(statement), "%s%s%s", adpcm ? ADPCM_OPTION " " : "",
+           binary ? BINARY_OPTION " " : "", inputFileName);
+  if (adpcm) {
+    writeAdpcmFiles(inputFileFp, inputFileName, statement, binary, arrayName, arrayNameUpperCase, &header);
+    fclose(inputFileFp);
+    return 0;
+  }
+  // Everything looks good. Go ahead and generate the .h and .c files. Exit with an error if either file already exists.
+  // First, open the .h file and output the necessary declarations. Then, close the .h file.
+  char hFileName[MAX_FILENAME_LENGTH + sizeof(H_FILE_SUFFIX)];  // .h file-name.
+  snprintf(hFileName, sizeof(hFileName), "%s%s", inputFileName, H_FILE_SUFFIX);  // Basename plus the suffix.
+  char cFileName[MAX_FILENAME_LENGTH + sizeof(C_FILE_SUFFIX)];  // .c file-name. 
+  snprintf(cFileName, sizeof(cFileName), "%s%s", inputFileName, C_FILE_SUFFIX);  // Basename plus the suffix.
+
+  FILE* hFileFp = fopen(hFileName, "r");
+  FILE* cFileFp = fopen(cFileName, "r");
+  // If you get this far, you can go ahead and open the .c and .h files for write.
+  hFileFp = fopen(hFileName, "w");
+  cFileFp = fopen(cFileName, "w");
+  // Ensure that both files opened OK for write.
+  if ((!hFileFp && cFileFp)) {
+    if (!hFileFp)
+      fprintf(stderr, "Unable to open file: %s for writing.\n", hFileName);
+    if (!cFileFp)
+      fprintf(stderr, "Unable to open file: %s for writing.\n", cFileName);
+    exit(-1);
+  }
  
   // .h file just needs a comment and an extern statement.
-  fprintf(hFileFp, "// This file was generated by executing this statement: wav2c %s\n", inputFileName);
-  fprintf(hFileFp, "%s uint16_t %s[];\n", EXTERN_STATEMENT, arrayName);
-  fprintf(hFileFp, "#define %s_SAMPLE_RATE %d\n", arrayNameUpperCase, header.sampleRate*10);
+  fprintf(hFileFp, "// This file was generated by executing this statement: wav2c %s\n", statement);
+  fprintf(hFileFp, "%s %s %s[];\n", EXTERN_STATEMENT, C_DATA_TYPE, arrayName);
+  fprintf(hFileFp, "#define %s_SAMPLE_RATE %d\n", arrayNameUpperCase, header.sampleRate);
   fprintf(hFileFp, "#define %s_BITS_PER_SAMPLE %d\n", arrayNameUpperCase, header.bitsPerSample);
   fprintf(hFileFp, "#define %s_NUMBER_OF_SAMPLES %d\n", arrayNameUpperCase, header.subchunk2Size/2);
   fclose(hFileFp);
-  // .c file will contain the data in array form as follows.
   uint32_t arraySize = header.subchunk2Size/2;  // Wave file is counted by bytes, output file is counted in 16-bit words.
+  if (binary) {
+    // The .bin file holds the same values as the array, as little-endian 16-bit words.
+    uint8_t* data = malloc(arraySize * sizeof(uint16_t));
+    if (!data) {
+      fprintf(stderr, "ERROR: out of memory for %d samples.\n", arraySize);
+      exit(-1);
+    }
+    for (i=0; i<arraySize; i++) {
+      uint8_t bytes[2];  // One little-endian signed 16-bit sample.
+      if (fread(bytes, sizeof(bytes), 1, inputFileFp) != 1) {
+        fprintf(stderr, "ERROR: %s ends before its %d samples.\n", inputFileName, arraySize);
+        exit(-1);
+      }
+      uint16_t unsignedData = (int16_t)(bytes[0] | bytes[1] << 8) + INT16_MAX;  // Offset to unsigned.
+      data[2*i] = unsignedData & 0xFF;
+      data[2*i+1] = unsignedData >> 8;
+    }
+    fclose(cFileFp);  // writeEmbeddedData() writes the .c file.
+    writeEmbeddedData(inputFileName, statement, arrayName, data, arraySize * sizeof(uint16_t));
+    free(data);
+    fclose(inputFileFp);
+    return 0;
+  }
+  // .c file will contain the data in array form as follows.
   // Write some helpful comments to the .c file.
-  fprintf(cFileFp, "// This file was generated by executing this statement: wav2c %s\n", inputFileName);
+  fprintf(cFileFp, "// This file was generated by executing this statement: wav2c %s\n", statement);
   fprintf(cFileFp, "\n#include <stdint.h>\n\n");
   fprintf(cFileFp, "%s %s[%d] = {\n", C_DATA_TYPE, arrayName, arraySize);
   // File pointer to the input file should be pointing at the first value after the header is read, so just start from there.
@@ -0,0 +1,20 @@
+#!/bin/sh
+# Runs the filter-bank benchmark (filterBenchmark.h) at every benchmarked
+# FILTER_FREQUENCY_COUNT, and with two sensors at the default count, and prints
+# the cost per sample period of each stage, the load at 100 kHz and the largest
+# frequency count that the measured costs extrapolate to. The times are host
+# times; for cycles on the board, run filterBenchmark_run() in a board build.
+#
+# usage: benchmarkChannels.sh [build-dir]
+#   build-dir  where the host tools were built (default: build-tools)
+
+BUILD_DIR=${1:-build-tools}
+BENCHMARKS="10 16 24 32 Dual"
+
+printf "%-11s %8s %7s %7s %7s %7s %7s %6s %8s\n" frequencies channels fir iir \
+  power hit total load% estimate
+for BENCHMARK in $BENCHMARKS; do
+  ROW=$("$BUILD_DIR/filterBenchmark$BENCHMARK" -t) || exit 1
+  echo "$ROW" | awk '{ printf "%-11s %8s %7s %7s %7s %7s %7s %6s %8s\n",
+                       $1, $2, $3, $4, $5, $6, $7, $8, $9 }'
+done
@@ -0,0 +1,192 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Decodes the framed output of runningModes_captureRawAdcValues() (see
+// captureFrame.h) into a binary capture that detectorReplay can read. The input
+// can be a saved console log or the serial device itself; any text printed
+// around the frames is skipped. Decoding stops at the end frame. A capture of
+// more than one channel holds the channels interleaved, channel 0 first; -c
+// picks the channel to keep.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "captureFrame.h"
+
+#define READ_BUFFER_SIZE (16 * CAPTURE_FRAME_MAX_SIZE)
+
+typedef struct {
+  const char *inputPath;
+  const char *outputPath;
+  uint16_t channelCount; // Channels interleaved in the capture.
+  uint16_t channel;      // Channel written to the output.
+} captureDecode_options_t;
+
+typedef struct {
+  uint64_t frameCount;
+  uint64_t sampleCount;
+  uint64_t crcErrorCount;
+  uint64_t missingFrameCount;
+  uint64_t skippedByteCount;
+  bool endSeen;
+} captureDecode_stats_t;
+
+// Writes the samples of the chosen channel as little-endian 16-bit words. Every
+// frame holds whole sample periods, so each starts with channel 0.
+static bool captureDecode_writeSamples(FILE *output,
+                                       const captureDecode_options_t *options,
+                                       const int16_t samples[], uint16_t count) {
+  uint8_t bytes[2 * CAPTURE_FRAME_MAX_SAMPLE_COUNT];
+  uint16_t written = 0;
+  for (uint16_t i = options->channel; i < count; i += options->channelCount) {
+    bytes[2 * written] = (uint16_t)samples[i] & 0xFF;
+    bytes[2 * written + 1] = (uint16_t)samples[i] >> 8;
+    written++;
+  }
+  return fwrite(bytes, 2, written, output) == written;
+}
+
+static void captureDecode_usage(const char *program) {
+  fprintf(stderr,
+          "usage: %s [options] input output.bin\n"
+          "Decodes a framed ADC capture. input may be '-' for stdin or a "
+          "serial device\n"
+          "(e.g. after 'stty -F /dev/ttyUSB1 raw 115200').\n"
+          "  -n channels  channels in the capture, a divisor of %d (default "
+          "1)\n"
+          "  -c channel   channel to write, from 0 (default 0)\n"
+          "Replay the result with: detectorReplay -b -f bin output.bin\n",
+          program, CAPTURE_FRAME_MAX_SAMPLE_COUNT);
+}
+
+static bool captureDecode_parseOptions(int argc, char *argv[],
+                                       captureDecode_options_t *options) {
+  options->channelCount = 1;
+  options->channel = 0;
+  int c;
+  while ((c = getopt(argc, argv, "n:c:h")) != -1) {
+    switch (c) {
+    case 'n':
+      options->channelCount = atoi(optarg);
+      break;
+    case 'c':
+      options->channel = atoi(optarg);
+      break;
+    default:
+      return false;
+    }
+  }
+  if (optind != argc - 2 || options->channelCount == 0 ||
+      CAPTURE_FRAME_MAX_SAMPLE_COUNT % options->channelCount != 0 ||
+      options->channel >= options->channelCount)
+    return false;
+  options->inputPath = argv[optind];
+  options->outputPath = argv[optind + 1];
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  captureDecode_options_t options;
+  if (!captureDecode_parseOptions(argc, argv, &options)) {
+    captureDecode_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  FILE *input = strcmp(options.inputPath, "-") == 0
+                    ? stdin
+                    : fopen(options.inputPath, "rb");
+  if (!input) {
+    perror(options.inputPath);
+    return EXIT_FAILURE;
+  }
+  FILE *output = fopen(options.outputPath, "wb");
+  if (!output) {
+    perror(options.outputPath);
+    return EXIT_FAILURE;
+  }
+  captureDecode_stats_t stats;
+  memset(&stats, 0, sizeof(stats));
+  static uint8_t buffer[READ_BUFFER_SIZE];
+  size_t length = 0;
+  uint32_t expectedSequence = 0;
+  bool inputDone = false;
+  while (!stats.endSeen && !(inputDone && length == 0)) {
+    if (!inputDone && length < READ_BUFFER_SIZE) {
+      size_t got = fread(&buffer[length], 1, READ_BUFFER_SIZE - length, input);
+      length += got;
+      inputDone = (got == 0);
+    }
+    // Decode as many frames as the buffer holds.
+    size_t offset = 0;
+    while (offset < length) {
+      int16_t samples[CAPTURE_FRAME_MAX_SAMPLE_COUNT];
+      uint32_t sequence;
+      uint16_t count;
+      size_t frameSize;
+      captureFrame_decodeResult_t result =
+          captureFrame_decode(&buffer[offset], length - offset, &sequence,
+                              samples, &count, &frameSize);
+      if (result == CAPTURE_FRAME_DECODE_NEED_MORE && !inputDone)
+        break;
+      if (result != CAPTURE_FRAME_DECODE_OK) {
+        // Not a frame (or a damaged one): resynchronize one byte later.
+        if (result == CAPTURE_FRAME_DECODE_BAD_CRC)
+          stats.crcErrorCount++;
+        stats.skippedByteCount++;
+        offset++;
+        continue;
+      }
+      offset += frameSize;
+      if (sequence > expectedSequence) {
+        // Every frame but the last holds CAPTURE_FRAME_MAX_SAMPLE_COUNT
+        // samples, so fill missing frames with zeros to keep the timing of
+        // what follows.
+        static const int16_t zeros[CAPTURE_FRAME_MAX_SAMPLE_COUNT];
+        fprintf(stderr, "frames %u to %u missing, filled with zeros\n",
+                expectedSequence, sequence - 1);
+        stats.missingFrameCount += sequence - expectedSequence;
+        for (uint32_t i = expectedSequence; i < sequence && count > 0; i++)
+          captureDecode_writeSamples(output, &options, zeros,
+                                     CAPTURE_FRAME_MAX_SAMPLE_COUNT);
+      } else if (sequence < expectedSequence) {
+        fprintf(stderr, "frame %u out of order, expected %u\n", sequence,
+                expectedSequence);
+      }
+      expectedSequence = sequence + 1;
+      if (count == 0) {
+        stats.endSeen = true;
+        break;
+      }
+      if (!captureDecode_writeSamples(output, &options, samples, count)) {
+        perror(options.outputPath);
+        return EXIT_FAILURE;
+      }
+      stats.frameCount++;
+      stats.sampleCount += count;
+    }
+    memmove(buffer, &buffer[offset], length - offset);
+    length -= offset;
+  }
+  fclose(output);
+  if (input != stdin)
+    fclose(input);
+  fprintf(stderr,
+          "%llu frames, %llu samples, %llu CRC errors, %llu missing frames, "
+          "%llu bytes skipped%s\n",
+          (unsigned long long)stats.frameCount,
+          (unsigned long long)stats.sampleCount,
+          (unsigned long long)stats.crcErrorCount,
+          (unsigned long long)stats.missingFrameCount,
+          (unsigned long long)stats.skippedByteCount,
+          stats.endSeen ? "" : ", end frame not found");
+  bool clean = stats.endSeen && stats.crcErrorCount == 0 &&
+               stats.missingFrameCount == 0;
+  return clean ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,157 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include <ctype.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "captureReader.h"
+
+#define ADC_VALUE_MASK 0x0FFF        // The XADC produces 12-bit values.
+#define ADC_SIGN_BIT 0x0800          // Sign bit in bipolar mode.
+#define ADC_UNIPOLAR_MIDPOINT 2047.5 // Maps 0..4095 onto -1.0..1.0.
+#define ADC_BIPOLAR_FULL_SCALE 2048.0
+#define BINARY_SAMPLE_SIZE 2   // Bytes per binary sample.
+#define BINARY_CHUNK_SIZE 4096 // Samples per fread().
+#define MAX_LINE_LENGTH 256
+
+// Scales a raw ADC value to [-1.0, 1.0].
+double captureReader_scaleAdcValue(int32_t value, bool bipolar) {
+  if (bipolar) {
+    value &= ADC_VALUE_MASK;
+    if (value & ADC_SIGN_BIT)
+      value -= (ADC_VALUE_MASK + 1); // Sign-extend from 12 bits.
+    return value / ADC_BIPOLAR_FULL_SCALE;
+  }
+  return ((value & ADC_VALUE_MASK) / ADC_UNIPOLAR_MIDPOINT) - 1.0;
+}
+
+// Returns the format implied by the file extension.
+captureReader_format_t captureReader_formatFromPath(const char *path) {
+  const char *extension = strrchr(path, '.');
+  if (extension &&
+      (strcasecmp(extension, ".csv") == 0 ||
+       strcasecmp(extension, ".txt") == 0))
+    return CAPTURE_READER_FORMAT_CSV;
+  return CAPTURE_READER_FORMAT_BINARY;
+}
+
+// Opens a capture. Returns false and prints a message on failure.
+bool captureReader_open(captureReader_t *reader, const char *path,
+                        captureReader_format_t format, bool bipolar,
+                        bool useMmap) {
+  memset(reader, 0, sizeof(*reader));
+  reader->format = format;
+  reader->bipolar = bipolar;
+  if (useMmap && format == CAPTURE_READER_FORMAT_BINARY) {
+    int fd = open(path, O_RDONLY);
+    struct stat status;
+    if (fd < 0 || fstat(fd, &status) < 0) {
+      perror(path);
+      if (fd >= 0)
+        close(fd);
+      return false;
+    }
+    reader->mapLength = status.st_size;
+    if (reader->mapLength > 0) {
+      void *map = mmap(NULL, reader->mapLength, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (map == MAP_FAILED) {
+        perror(path);
+        close(fd);
+        return false;
+      }
+      madvise(map, reader->mapLength, MADV_SEQUENTIAL);
+      reader->map = map;
+    }
+    close(fd); // The mapping stays valid.
+    return true;
+  }
+  reader->file = fopen(path, format == CAPTURE_READER_FORMAT_CSV ? "r" : "rb");
+  if (!reader->file) {
+    perror(path);
+    return false;
+  }
+  return true;
+}
+
+// Reads binary samples from the mapping or the file.
+static size_t captureReader_readBinary(captureReader_t *reader,
+                                       double samples[], size_t max) {
+  size_t count = 0;
+  if (reader->map) {
+    while (count < max &&
+           reader->mapOffset + BINARY_SAMPLE_SIZE <= reader->mapLength) {
+      const uint8_t *bytes = &reader->map[reader->mapOffset];
+      samples[count++] = captureReader_scaleAdcValue(bytes[0] | (bytes[1] << 8),
+                                                     reader->bipolar);
+      reader->mapOffset += BINARY_SAMPLE_SIZE;
+    }
+    return count;
+  }
+  uint8_t bytes[BINARY_CHUNK_SIZE * BINARY_SAMPLE_SIZE];
+  while (count < max) {
+    size_t request = max - count;
+    if (request > BINARY_CHUNK_SIZE)
+      request = BINARY_CHUNK_SIZE;
+    size_t got = fread(bytes, BINARY_SAMPLE_SIZE, request, reader->file);
+    for (size_t i = 0; i < got; i++)
+      samples[count++] = captureReader_scaleAdcValue(
+          bytes[2 * i] | (bytes[2 * i + 1] << 8), reader->bipolar);
+    if (got < request)
+      break;
+  }
+  return count;
+}
+
+// Reads text samples, one per line. The last integer on each line is used.
+static size_t captureReader_readCsv(captureReader_t *reader, double samples[],
+                                    size_t max) {
+  size_t count = 0;
+  char line[MAX_LINE_LENGTH];
+  while (count < max && fgets(line, sizeof(line), reader->file)) {
+    // Find the start of the last run of digits (with an optional '-').
+    char *end = line + strlen(line);
+    while (end > line && !isdigit((unsigned char)end[-1]))
+      end--;
+    if (end == line) {
+      reader->invalidCount++;
+      continue;
+    }
+    char *start = end;
+    while (start > line && isdigit((unsigned char)start[-1]))
+      start--;
+    if (start > line && start[-1] == '-')
+      start--;
+    samples[count++] =
+        captureReader_scaleAdcValue(strtol(start, NULL, 10), reader->bipolar);
+  }
+  return count;
+}
+
+// Reads up to max samples, scaled to [-1.0, 1.0].
+size_t captureReader_read(captureReader_t *reader, double samples[],
+                          size_t max) {
+  if (reader->format == CAPTURE_READER_FORMAT_CSV)
+    return captureReader_readCsv(reader, samples, max);
+  return captureReader_readBinary(reader, samples, max);
+}
+
+// Closes the capture.
+void captureReader_close(captureReader_t *reader) {
+  if (reader->map)
+    munmap((void *)reader->map, reader->mapLength);
+  if (reader->file)
+    fclose(reader->file);
+  memset(reader, 0, sizeof(*reader));
+}
@@ -0,0 +1,61 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef CAPTUREREADER_H_
+#define CAPTUREREADER_H_
+
+// Reads recorded ADC captures on the host. Two formats are supported:
+// - binary: raw 12-bit ADC values stored as little-endian 16-bit words,
+// - CSV/text: one value per line. Only the last integer on each line is used,
+// so the output of runningModes_dumpRawAdcValues() ("raw ADC value: 123") can
+// be read as-is. Lines without a number are skipped.
+// Binary captures can be read with stdio or memory-mapped; text captures are
+// always streamed. Either way memory use does not depend on the capture length.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+typedef enum {
+  CAPTURE_READER_FORMAT_BINARY,
+  CAPTURE_READER_FORMAT_CSV
+} captureReader_format_t;
+
+typedef struct {
+  captureReader_format_t format;
+  bool bipolar;          // Values are signed 12-bit (bipolar ADC mode).
+  FILE *file;            // Used unless the capture is memory-mapped.
+  const uint8_t *map;    // Memory-mapped capture, or NULL.
+  size_t mapLength;      // Length of the mapping in bytes.
+  size_t mapOffset;      // Next byte to read from the mapping.
+  uint64_t invalidCount; // Text lines that contained no value.
+} captureReader_t;
+
+// Opens a capture. Returns false and prints a message on failure.
+bool captureReader_open(captureReader_t *reader, const char *path,
+                        captureReader_format_t format, bool bipolar,
+                        bool useMmap);
+
+// Reads up to max samples, scaled to [-1.0, 1.0] the same way the detector
+// scales ADC values. Returns the number of samples read, 0 at end of capture.
+size_t captureReader_read(captureReader_t *reader, double samples[],
+                          size_t max);
+
+// Closes the capture.
+void captureReader_close(captureReader_t *reader);
+
+// Returns the format implied by the file extension: .csv and .txt are text,
+// everything else is binary.
+captureReader_format_t captureReader_formatFromPath(const char *path);
+
+// Scales a raw ADC value to [-1.0, 1.0].
+double captureReader_scaleAdcValue(int32_t value, bool bipolar);
+
+#endif /* CAPTUREREADER_H_ */
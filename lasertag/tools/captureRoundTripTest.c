@@ -0,0 +1,135 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Encodes a two-channel capture with captureFrame_writeSamples(), between the
+// console text that runningModes_captureRawAdcValues() prints, decodes it with
+// captureDecode (CAPTURE_DECODE, set by CMakeLists.txt) and checks the samples
+// of each channel. Then damages one frame and checks that captureDecode fails
+// and fills the frame with zeros without moving the samples after it. The exit
+// status is nonzero if a check fails.
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "captureFrame.h"
+
+#define CHANNEL_COUNT 2
+#define FRAME_COUNT 1000 // Sample periods; the last capture frame is short.
+#define VALUE_COUNT (CHANNEL_COUNT * FRAME_COUNT)
+#define DAMAGED_FRAME 2 // Capture frame whose CRC is broken.
+#define PATH_SIZE 256
+
+static FILE *encodeOutput;
+
+static void captureRoundTripTest_putByte(uint8_t byte) {
+  fputc(byte, encodeOutput);
+}
+
+// Writes the capture of values[] to path, with a byte of frame damagedFrame
+// flipped unless it is negative.
+static bool captureRoundTripTest_encode(const char *path,
+                                        const int16_t values[],
+                                        int damagedFrame) {
+  encodeOutput = fopen(path, "w+b");
+  if (!encodeOutput) {
+    perror(path);
+    return false;
+  }
+  fprintf(encodeOutput, "Capturing 10 seconds of ADC values from %d "
+                        "channel(s). Press btn3 to stop early.\n"
+                        "Captured %d values. Sending.\n",
+          CHANNEL_COUNT, VALUE_COUNT);
+  long start = ftell(encodeOutput);
+  captureFrame_writeSamples(values, VALUE_COUNT, captureRoundTripTest_putByte);
+  fprintf(encodeOutput, "\nCapture sent.\n");
+  if (damagedFrame >= 0) {
+    // Flip a bit of the first sample of the frame.
+    fseek(encodeOutput,
+          start + damagedFrame * (long)CAPTURE_FRAME_MAX_SIZE +
+              CAPTURE_FRAME_HEADER_SIZE,
+          SEEK_SET);
+    int byte = fgetc(encodeOutput);
+    fseek(encodeOutput, -1, SEEK_CUR);
+    fputc(byte ^ 0x01, encodeOutput);
+  }
+  fclose(encodeOutput);
+  return true;
+}
+
+// Runs captureDecode on input for one channel and compares its output with the
+// values of that channel. Samples of capture frame damagedFrame must be zero
+// instead, and captureDecode must fail then, unless damagedFrame is negative.
+static bool captureRoundTripTest_decode(const char *input, const char *output,
+                                        const int16_t values[], int channel,
+                                        int damagedFrame) {
+  char command[3 * PATH_SIZE];
+  snprintf(command, sizeof(command), "%s -n %d -c %d %s %s 2>/dev/null",
+           CAPTURE_DECODE, CHANNEL_COUNT, channel, input, output);
+  int status = system(command);
+  if ((status == 0) != (damagedFrame < 0)) {
+    printf("channel %d: captureDecode returned %d.\n", channel, status);
+    return false;
+  }
+  FILE *file = fopen(output, "rb");
+  if (!file) {
+    perror(output);
+    return false;
+  }
+  uint8_t bytes[2 * FRAME_COUNT + 1];
+  size_t length = fread(bytes, 1, sizeof(bytes), file);
+  fclose(file);
+  if (length != 2 * FRAME_COUNT) {
+    printf("channel %d: %zu bytes decoded, expected %d.\n", channel, length,
+           2 * FRAME_COUNT);
+    return false;
+  }
+  for (int i = 0; i < FRAME_COUNT; i++) {
+    int16_t decoded = (int16_t)(bytes[2 * i] | bytes[2 * i + 1] << 8);
+    int value = i * CHANNEL_COUNT + channel;
+    bool damaged = value / CAPTURE_FRAME_MAX_SAMPLE_COUNT == damagedFrame;
+    int16_t expected = damaged ? 0 : values[value];
+    if (decoded != expected) {
+      printf("channel %d: sample %d is %d, expected %d.\n", channel, i,
+             decoded, expected);
+      return false;
+    }
+  }
+  return true;
+}
+
+int main() {
+  // Sign-extended 12-bit values that differ from one channel to the other.
+  static int16_t values[VALUE_COUNT];
+  for (int i = 0; i < VALUE_COUNT; i++)
+    values[i] = (int16_t)((i * 37 + (i % CHANNEL_COUNT) * 1000) % 4096 - 2048);
+  char directory[] = "/tmp/captureRoundTripXXXXXX";
+  if (!mkdtemp(directory)) {
+    perror(directory);
+    return EXIT_FAILURE;
+  }
+  char input[PATH_SIZE];
+  char output[PATH_SIZE];
+  snprintf(input, sizeof(input), "%s/console.log", directory);
+  snprintf(output, sizeof(output), "%s/capture.bin", directory);
+  bool success = true;
+  int damagedFrames[] = {-1, DAMAGED_FRAME};
+  for (int d = 0; d < 2; d++) {
+    success &= captureRoundTripTest_encode(input, values, damagedFrames[d]);
+    for (int channel = 0; channel < CHANNEL_COUNT; channel++)
+      success &= captureRoundTripTest_decode(input, output, values, channel,
+                                             damagedFrames[d]);
+  }
+  remove(input);
+  remove(output);
+  remove(directory);
+  printf("Capture round trip %s.\n", success ? "passed" : "failed");
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
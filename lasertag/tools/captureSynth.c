@@ -0,0 +1,155 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Writes a synthetic binary ADC capture: square-wave shots at the user
+// frequencies in Gaussian noise, in the format detectorReplay reads. The start
+// sample and frequency of every shot are printed so that the detections can be
+// scored (see compareBackends.sh).
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "filter.h"
+
+#define SAMPLE_FREQUENCY_HZ (FILTER_SAMPLE_FREQUENCY_IN_KHZ * 1000)
+// A shot lasts one detector window of input samples (200 ms).
+#define SHOT_SAMPLE_COUNT                                                      \
+  (FILTER_INPUT_PULSE_WIDTH * FILTER_FIR_DECIMATION_FACTOR)
+#define ADC_MIDPOINT 2047.5 // Unipolar 12-bit values.
+#define ADC_MAX_VALUE 4095
+#define DEFAULT_SECONDS 10.0
+#define DEFAULT_AMPLITUDE 0.5
+#define DEFAULT_NOISE 0.05
+#define DEFAULT_SHOT_SPACING 0.5
+#define DEFAULT_SEED 1
+
+typedef struct {
+  const char *outputPath;
+  double seconds;
+  double amplitude;   // Square-wave amplitude, as a fraction of full scale.
+  double noise;       // Noise standard deviation, as a fraction of full scale.
+  double shotSpacing; // Seconds from the start of one shot to the next.
+  unsigned seed;
+} captureSynth_options_t;
+
+static void captureSynth_usage(const char *program) {
+  fprintf(stderr,
+          "usage: %s [options] output.bin\n"
+          "Writes a synthetic 100 kHz capture with a shot at each user "
+          "frequency in turn.\n"
+          "  -s seconds   capture length (default %.0f)\n"
+          "  -a amplitude shot amplitude, fraction of full scale (default "
+          "%.2f)\n"
+          "  -n noise     noise standard deviation (default %.2f)\n"
+          "  -p seconds   time from one shot to the next (default %.1f)\n"
+          "  -r seed      random seed (default %d)\n",
+          program, DEFAULT_SECONDS, DEFAULT_AMPLITUDE, DEFAULT_NOISE,
+          DEFAULT_SHOT_SPACING, DEFAULT_SEED);
+}
+
+static bool captureSynth_parseOptions(int argc, char *argv[],
+                                      captureSynth_options_t *options) {
+  options->seconds = DEFAULT_SECONDS;
+  options->amplitude = DEFAULT_AMPLITUDE;
+  options->noise = DEFAULT_NOISE;
+  options->shotSpacing = DEFAULT_SHOT_SPACING;
+  options->seed = DEFAULT_SEED;
+  int c;
+  while ((c = getopt(argc, argv, "s:a:n:p:r:h")) != -1) {
+    switch (c) {
+    case 's':
+      options->seconds = atof(optarg);
+      break;
+    case 'a':
+      options->amplitude = atof(optarg);
+      break;
+    case 'n':
+      options->noise = atof(optarg);
+      break;
+    case 'p':
+      options->shotSpacing = atof(optarg);
+      break;
+    case 'r':
+      options->seed = atoi(optarg);
+      break;
+    default:
+      return false;
+    }
+  }
+  if (optind != argc - 1 ||
+      options->shotSpacing * SAMPLE_FREQUENCY_HZ < SHOT_SAMPLE_COUNT)
+    return false;
+  options->outputPath = argv[optind];
+  return true;
+}
+
+// Returns a normally distributed random value (Box-Muller).
+static double captureSynth_gaussian() {
+  double u1 = (rand() + 1.0) / (RAND_MAX + 2.0);
+  double u2 = (rand() + 1.0) / (RAND_MAX + 2.0);
+  return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+int main(int argc, char *argv[]) {
+  captureSynth_options_t options;
+  if (!captureSynth_parseOptions(argc, argv, &options)) {
+    captureSynth_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  FILE *output = fopen(options.outputPath, "wb");
+  if (!output) {
+    perror(options.outputPath);
+    return EXIT_FAILURE;
+  }
+  srand(options.seed);
+  uint64_t sampleCount = options.seconds * SAMPLE_FREQUENCY_HZ;
+  uint64_t shotSpacing = options.shotSpacing * SAMPLE_FREQUENCY_HZ;
+  // The first shot starts after one spacing so the filters have settled.
+  uint64_t nextShot = shotSpacing;
+  uint64_t shotStart = 0;
+  uint16_t shotFrequency = 0;
+  uint16_t nextFrequency = 0;
+  bool inShot = false;
+  for (uint64_t i = 0; i < sampleCount; i++) {
+    if (i == nextShot) {
+      inShot = true;
+      shotStart = i;
+      shotFrequency = nextFrequency;
+      nextFrequency = (nextFrequency + 1) % FILTER_FREQUENCY_COUNT;
+      nextShot += shotSpacing;
+      printf("shot: sample %llu, frequency %d\n", (unsigned long long)i,
+             shotFrequency);
+    }
+    if (inShot && i - shotStart == SHOT_SAMPLE_COUNT)
+      inShot = false;
+    double value = options.noise * captureSynth_gaussian();
+    if (inShot) {
+      // Same square wave as the transmitter: high for the first half period.
+      uint16_t tickCount = filter_frequencyTickTable[shotFrequency];
+      value += ((i - shotStart) % tickCount < tickCount / 2)
+                   ? options.amplitude
+                   : -options.amplitude;
+    }
+    long adcValue = lround(ADC_MIDPOINT * (value + 1.0));
+    if (adcValue < 0)
+      adcValue = 0;
+    if (adcValue > ADC_MAX_VALUE)
+      adcValue = ADC_MAX_VALUE;
+    uint8_t bytes[2] = {adcValue & 0xFF, adcValue >> 8};
+    if (fwrite(bytes, sizeof(bytes), 1, output) != 1) {
+      perror(options.outputPath);
+      return EXIT_FAILURE;
+    }
+  }
+  fclose(output);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,78 @@
+#!/bin/sh
+# Compares the IIR filter bank (detectorReplay), the same with the CIC front
+# end (detectorReplayCic), the same with quiet bands gated off
+# (detectorReplayGated) and the sliding DFT (detectorReplaySlidingDft) on
+# synthetic captures with falling shot amplitudes. For each capture and
+# detector it prints how many shots were detected at the right frequency, at
+# the wrong frequency, or not at all, the number of hits that match no shot,
+# and the filtering time per input sample.
+#
+# usage: compareBackends.sh [build-dir] [noise]
+#   build-dir  where the host tools were built (default: build-tools)
+#   noise      noise standard deviation, fraction of full scale (default 0.05)
+
+BUILD_DIR=${1:-build-tools}
+NOISE=${2:-0.05}
+AMPLITUDES="0.5 0.1 0.05 0.02 0.01 0.005"
+CAPTURE_SECONDS=30
+# A shot counts as detected if a hit follows its start within this many input
+# samples (two detector windows).
+HIT_WINDOW=40000
+
+WORK_DIR=$(mktemp -d)
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+printf "%-9s %-10s %7s %5s %6s %5s %9s\n" amplitude detector correct wrong \
+  missed false ns/sample
+for AMPLITUDE in $AMPLITUDES; do
+  "$BUILD_DIR/captureSynth" -s $CAPTURE_SECONDS -a "$AMPLITUDE" -n "$NOISE" \
+    "$WORK_DIR/capture.bin" > "$WORK_DIR/shots.txt" || exit 1
+  for DETECTOR in detectorReplay detectorReplayCic detectorReplayGated \
+    detectorReplaySlidingDft; do
+    # Keep the fastest of a few runs to reduce timing noise.
+    NS_PER_SAMPLE=
+    for RUN in 1 2 3; do
+      "$BUILD_DIR/$DETECTOR" -B "$WORK_DIR/capture.bin" \
+        > "$WORK_DIR/hits.txt" 2> "$WORK_DIR/stats.txt" || exit 1
+      NS=$(sed -n 's/.* \([0-9.]*\) ns\/sample.*/\1/p' "$WORK_DIR/stats.txt")
+      if [ -z "$NS_PER_SAMPLE" ] ||
+        awk -v a="$NS" -v b="$NS_PER_SAMPLE" 'BEGIN { exit !(a < b) }'; then
+        NS_PER_SAMPLE=$NS
+      fi
+    done
+    case $DETECTOR in
+    detectorReplayCic) NAME=cic ;;
+    detectorReplayGated) NAME=gated ;;
+    detectorReplaySlidingDft) NAME=slidingDft ;;
+    *) NAME=iir ;;
+    esac
+    # Lines look like "shot: sample 50000, frequency 0" and
+    # "hit: sample 52740, time 0.52740 s, frequency 0".
+    awk -v window=$HIT_WINDOW -v amplitude="$AMPLITUDE" -v name=$NAME \
+      -v ns="$NS_PER_SAMPLE" '
+      /^shot:/ { sub(",", "", $3); shotSample[shots] = $3;
+                 shotFrequency[shots++] = $5 }
+      /^hit:/  { sub(",", "", $3); hitSample[hits] = $3;
+                 hitFrequency[hits++] = $8 }
+      END {
+        for (h = 0; h < hits; h++) used[h] = 0
+        for (s = 0; s < shots; s++) {
+          result = "missed"
+          for (h = 0; h < hits; h++) {
+            if (used[h] || hitSample[h] < shotSample[s] ||
+                hitSample[h] >= shotSample[s] + window)
+              continue
+            used[h] = 1
+            result = (hitFrequency[h] == shotFrequency[s]) ? "correct" : "wrong"
+            break
+          }
+          count[result]++
+        }
+        for (h = 0; h < hits; h++)
+          if (!used[h]) count["false"]++
+        printf "%-9s %-10s %7d %5d %6d %5d %9s\n", amplitude, name,
+               count["correct"], count["wrong"], count["missed"],
+               count["false"], ns
+      }' "$WORK_DIR/shots.txt" "$WORK_DIR/hits.txt"
+  done
+done
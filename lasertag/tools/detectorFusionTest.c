@@ -0,0 +1,24 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Runs the hit-decision test and the multi-sensor test (detectorFusion.h) on
+// the host, built for two channels. The exit status is nonzero if either
+// fails.
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "detectorFusion.h"
+#include "detectorHit.h"
+
+int main() {
+  bool success = detectorHit_runTest();
+  success = detectorFusion_runTest() && success;
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,65 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Runs detectorProfile_runTest() (see detectorProfile.h) on the host, then
+// prints the stage table with every stage recorded and checks that it fits on
+// the TFT, which the functions below stand in for. CMakeLists.txt builds it
+// with 32 frequencies so that the table has more rows than the TFT has lines.
+// The exit status is nonzero if a check fails.
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "detectorProfile.h"
+#include "display.h"
+
+#define DISPLAY_LINE_COUNT (DISPLAY_HEIGHT / DISPLAY_CHAR_HEIGHT)
+#define TEST_CYCLES 100
+
+static uint16_t displayLineCount;
+
+void display_fillScreen(uint16_t color) { (void)color; }
+void display_setCursor(int16_t x, int16_t y) {
+  (void)x;
+  (void)y;
+}
+void display_setTextColor(uint16_t c) { (void)c; }
+void display_setTextSize(uint8_t s) { (void)s; }
+size_t display_println(const char str[]) {
+  (void)str;
+  displayLineCount++;
+  return 0;
+}
+
+// Prints the table with every stage recorded once and checks the TFT lines:
+// DISPLAY_LINE_COUNT if onDisplay, none otherwise.
+static bool detectorProfileTest_printTable(bool onDisplay) {
+  detectorProfile_reset();
+  for (uint16_t stage = 0; stage < DETECTOR_PROFILE_STAGE_COUNT; stage++)
+    detectorProfile_record(stage, TEST_CYCLES, 0, 0);
+  displayLineCount = 0;
+  detectorProfile_printTable(onDisplay);
+  detectorProfile_reset();
+  uint16_t expected = onDisplay ? DISPLAY_LINE_COUNT : 0;
+  if (displayLineCount != expected) {
+    printf("The table took %d TFT lines, expected %d.\n", displayLineCount,
+           expected);
+    return false;
+  }
+  return true;
+}
+
+int main() {
+  bool success = detectorProfile_runTest();
+  success &= detectorProfileTest_printTable(true);
+  success &= detectorProfileTest_printTable(false);
+  printf("detectorProfileTest %s.\n", success ? "passed" : "failed");
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,367 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Replays a recorded ADC capture through the filter chain and hit detection
+// on the host, so that detector changes can be checked and benchmarked without
+// the board. See usage() below.
+//
+// The hits are decided by detectorHit.c, not by detector() in detector.c,
+// which reads the ADC buffer and drives the lockout timer and hit LED. Built
+// with DETECTOR_REPLAY_LAB_FILTER, the filters are the filter.c written in the
+// labs, which need not have the block entry points, so there is no -B.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "captureReader.h"
+#include "detectorHit.h"
+#include "filter.h"
+#include "lockoutTimer.h"
+
+#ifdef FILTER_GATING
+#include "filterCoefficients.h"
+#include "filterFixedPoint.h"
+#endif
+
+#ifdef FILTER_SLIDING_DFT
+#include "filterSlidingDft.h"
+#endif
+
+#define SAMPLE_FREQUENCY_HZ (FILTER_SAMPLE_FREQUENCY_IN_KHZ * 1000)
+#define READ_CHUNK_SIZE 65536 // Samples read from the capture at a time.
+#define DEFAULT_FUDGE_FACTOR 1000.0
+#define DEFAULT_POWER_TRACE_STRIDE 1
+
+typedef struct {
+  const char *capturePath;
+  captureReader_format_t format;
+  bool formatGiven;
+  bool bipolar;
+  bool useMmap;
+  bool blockMode; // Use filter_firFilterBlock() and filter_iirFilterAll().
+  double fudgeFactor;
+  bool ignoredFrequencies[FILTER_FREQUENCY_COUNT];
+  const char *powerTracePath;
+  uint32_t powerTraceStride;
+} detectorReplay_options_t;
+
+typedef struct {
+  uint64_t sampleCount;
+  uint64_t decimatedCount;
+  uint64_t lockoutRemaining; // Samples left in the lockout after a hit.
+  uint32_t hitCounts[FILTER_FREQUENCY_COUNT];
+  FILE *powerTrace;
+  uint32_t powerTraceCountdown;
+} detectorReplay_state_t;
+
+static void detectorReplay_usage(const char *program) {
+  fprintf(stderr,
+          "usage: %s [options] capture\n"
+          "Replays a 100 kHz ADC capture through the filters and hit "
+          "detection.\n"
+          "  -f bin|csv   capture format (default: from the file extension)\n"
+          "  -b           values are bipolar (signed 12-bit)\n"
+          "  -m           memory-map binary captures instead of streaming\n"
+#ifndef DETECTOR_REPLAY_LAB_FILTER
+          "  -B           block mode: filter_firFilterBlock() and "
+          "filter_iirFilterAll()\n"
+#endif
+          "  -u factor    fudge factor for hit detection (default %.0f)\n"
+#ifdef FILTER_SLIDING_DFT
+          "               multiplied by filter_getFudgeFactorScale()\n"
+#endif
+          "  -i n[,n...]  ignore hits on these frequency numbers\n"
+          "  -p file      write per-frequency power values as CSV\n"
+          "  -s n         write every n'th power row (default %d)\n"
+#ifdef DETECTOR_REPLAY_LAB_FILTER
+          "The filters are filter.c. Hits are decided by detectorHit.c, not "
+          "detector.c.\n",
+#else
+          "Hits are decided by detectorHit.c, not detector.c. "
+          "detectorReplayLab replays\n"
+          "filter.c, when it is in lasertag/.\n",
+#endif
+          program, DEFAULT_FUDGE_FACTOR, DEFAULT_POWER_TRACE_STRIDE);
+}
+
+// Parses a comma-separated list of frequency numbers.
+static bool detectorReplay_parseIgnored(const char *list,
+                                        bool ignored[FILTER_FREQUENCY_COUNT]) {
+  char *copy = strdup(list);
+  bool success = true;
+  for (char *token = strtok(copy, ","); token; token = strtok(NULL, ",")) {
+    char *end;
+    long value = strtol(token, &end, 10);
+    if (*end != '\0' || value < 0 || value >= FILTER_FREQUENCY_COUNT) {
+      fprintf(stderr, "invalid frequency number: %s\n", token);
+      success = false;
+      break;
+    }
+    ignored[value] = true;
+  }
+  free(copy);
+  return success;
+}
+
+static bool detectorReplay_parseOptions(int argc, char *argv[],
+                                        detectorReplay_options_t *options) {
+  memset(options, 0, sizeof(*options));
+  options->fudgeFactor = DEFAULT_FUDGE_FACTOR;
+  options->powerTraceStride = DEFAULT_POWER_TRACE_STRIDE;
+  int c;
+#ifdef DETECTOR_REPLAY_LAB_FILTER
+  const char *optionLetters = "f:bmu:i:p:s:h";
+#else
+  const char *optionLetters = "f:bmBu:i:p:s:h";
+#endif
+  while ((c = getopt(argc, argv, optionLetters)) != -1) {
+    switch (c) {
+    case 'f':
+      options->formatGiven = true;
+      if (strcmp(optarg, "bin") == 0)
+        options->format = CAPTURE_READER_FORMAT_BINARY;
+      else if (strcmp(optarg, "csv") == 0)
+        options->format = CAPTURE_READER_FORMAT_CSV;
+      else
+        return false;
+      break;
+    case 'b':
+      options->bipolar = true;
+      break;
+    case 'm':
+      options->useMmap = true;
+      break;
+    case 'B':
+      options->blockMode = true;
+      break;
+    case 'u':
+      options->fudgeFactor = atof(optarg);
+      break;
+    case 'i':
+      if (!detectorReplay_parseIgnored(optarg, options->ignoredFrequencies))
+        return false;
+      break;
+    case 'p':
+      options->powerTracePath = optarg;
+      break;
+    case 's':
+      options->powerTraceStride = atoi(optarg);
+      if (options->powerTraceStride == 0)
+        return false;
+      break;
+    default:
+      return false;
+    }
+  }
+  if (optind != argc - 1)
+    return false;
+  options->capturePath = argv[optind];
+  if (!options->formatGiven)
+    options->format = captureReader_formatFromPath(options->capturePath);
+  return true;
+}
+
+// Runs power computation and hit detection after each new set of IIR outputs.
+static void detectorReplay_afterIir(const detectorReplay_options_t *options,
+                                    detectorReplay_state_t *state) {
+  double powerValues[FILTER_FREQUENCY_COUNT];
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    powerValues[i] = filter_computePower(i, false, false);
+    detectorHit_setTrackedPower(i, powerValues[i]);
+  }
+  if (state->powerTrace && --state->powerTraceCountdown == 0) {
+    state->powerTraceCountdown = options->powerTraceStride;
+    fprintf(state->powerTrace, "%llu",
+            (unsigned long long)state->sampleCount);
+    for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+      fprintf(state->powerTrace, ",%le", powerValues[i]);
+    fprintf(state->powerTrace, "\n");
+  }
+  state->decimatedCount++;
+  // Until the power windows have filled, the median is close to zero and any
+  // noise looks like a hit.
+  if (state->decimatedCount < FILTER_INPUT_PULSE_WIDTH ||
+      state->lockoutRemaining > 0)
+    return;
+  uint16_t frequencyNumber;
+  if (detectorHit_detectTracked(options->ignoredFrequencies,
+                                options->fudgeFactor, &frequencyNumber)) {
+    state->hitCounts[frequencyNumber]++;
+    state->lockoutRemaining = LOCKOUT_TIMER_EXPIRE_VALUE;
+    printf("hit: sample %llu, time %.5f s, frequency %d\n",
+           (unsigned long long)state->sampleCount,
+           (double)state->sampleCount / SAMPLE_FREQUENCY_HZ, frequencyNumber);
+  }
+}
+
+#ifdef FILTER_GATING
+// Prints how much IIR work each band skipped.
+static void detectorReplay_printGatingStats() {
+  fprintf(stderr,
+          "gating: band computed skipped replayed closes opens saved\n");
+  uint64_t total = 0, skipped = 0;
+  int64_t saved = 0;
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    filter_gatingStats_t stats;
+    filter_getGatingStats(i, &stats);
+    uint64_t outputs = (uint64_t)stats.computedCount + stats.skippedCount;
+    int64_t bandSaved = (int64_t)stats.skippedCount - stats.replayedCount;
+    fprintf(stderr, "gating: %4d %8u %7u %8u %6u %5u %4.1f%%\n", i,
+            stats.computedCount, stats.skippedCount, stats.replayedCount,
+            stats.closeCount, stats.openCount,
+            outputs ? 100.0 * bandSaved / outputs : 0.0);
+    total += outputs;
+    skipped += stats.skippedCount;
+    saved += bandSaved;
+  }
+  double savedPercent = total ? 100.0 * saved / total : 0.0;
+  fprintf(stderr, "gating: %.1f%% of IIR outputs not computed\n",
+          savedPercent);
+  // The envelopes run the first sections of the closed bands only; open bands
+  // share them with the IIR filter.
+  double envelopePercent = total ? 100.0 * skipped *
+                                       FILTER_GATING_ENVELOPE_SECTION_COUNT /
+                                       FILTER_IIR_SECTION_COUNT / total
+                                 : 0.0;
+  fprintf(stderr,
+          "gating: %.1f%% of IIR section work saved, after %.1f%% for the "
+          "envelopes\n",
+          savedPercent - envelopePercent, envelopePercent);
+}
+#endif
+
+// Advances the lockout by count samples.
+static void detectorReplay_advanceLockout(detectorReplay_state_t *state,
+                                          uint64_t count) {
+  state->lockoutRemaining =
+      state->lockoutRemaining > count ? state->lockoutRemaining - count : 0;
+}
+
+// Filters samples one at a time, the way detector() does.
+static void detectorReplay_runSamples(const detectorReplay_options_t *options,
+                                      detectorReplay_state_t *state,
+                                      const double samples[], size_t count) {
+  static uint16_t decimationCount = 0;
+  for (size_t i = 0; i < count; i++) {
+    filter_addNewInput(samples[i]);
+    state->sampleCount++;
+    detectorReplay_advanceLockout(state, 1);
+    if (++decimationCount == FILTER_FIR_DECIMATION_FACTOR) {
+      decimationCount = 0;
+      filter_firFilter();
+      for (uint16_t j = 0; j < FILTER_FREQUENCY_COUNT; j++)
+        filter_iirFilter(j);
+      detectorReplay_afterIir(options, state);
+    }
+  }
+}
+
+#ifndef DETECTOR_REPLAY_LAB_FILTER
+// Filters samples with the block entry points. The IIR filters need every FIR
+// output, so the samples are handed to filter_firFilterBlock() one decimation
+// group at a time.
+static void detectorReplay_runBlock(const detectorReplay_options_t *options,
+                                    detectorReplay_state_t *state,
+                                    const double samples[], size_t count) {
+  size_t i = 0;
+  while (i < count) {
+    size_t groupSize = FILTER_FIR_DECIMATION_FACTOR -
+                       (state->sampleCount % FILTER_FIR_DECIMATION_FACTOR);
+    if (groupSize > count - i)
+      groupSize = count - i;
+    double firOutput;
+    size_t outputCount =
+        filter_firFilterBlock(&samples[i], groupSize, &firOutput);
+    state->sampleCount += groupSize;
+    detectorReplay_advanceLockout(state, groupSize);
+    i += groupSize;
+    if (outputCount > 0) {
+      filter_iirFilterAll(NULL);
+      detectorReplay_afterIir(options, state);
+    }
+  }
+}
+#endif
+
+int main(int argc, char *argv[]) {
+  detectorReplay_options_t options;
+  if (!detectorReplay_parseOptions(argc, argv, &options)) {
+    detectorReplay_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  captureReader_t reader;
+  if (!captureReader_open(&reader, options.capturePath, options.format,
+                          options.bipolar, options.useMmap))
+    return EXIT_FAILURE;
+  detectorReplay_state_t state;
+  memset(&state, 0, sizeof(state));
+  if (options.powerTracePath) {
+    state.powerTrace = fopen(options.powerTracePath, "w");
+    if (!state.powerTrace) {
+      perror(options.powerTracePath);
+      return EXIT_FAILURE;
+    }
+    state.powerTraceCountdown = options.powerTraceStride;
+    fprintf(state.powerTrace, "sample");
+    for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+      fprintf(state.powerTrace, ",power%d", i);
+    fprintf(state.powerTrace, "\n");
+  }
+  filter_init();
+#ifdef FILTER_SLIDING_DFT
+  // Noise gives less power in the narrow bins (see filterSlidingDft.h).
+  options.fudgeFactor *= filter_getFudgeFactorScale();
+#endif
+  detectorHit_initTracker();
+  static double samples[READ_CHUNK_SIZE];
+  // Only the filtering and detection are timed, not reading the capture.
+  double elapsed = 0.0;
+  size_t count;
+  while ((count = captureReader_read(&reader, samples, READ_CHUNK_SIZE)) > 0) {
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+#ifndef DETECTOR_REPLAY_LAB_FILTER
+    if (options.blockMode)
+      detectorReplay_runBlock(&options, &state, samples, count);
+    else
+#endif
+      detectorReplay_runSamples(&options, &state, samples, count);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    elapsed +=
+        (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1.0E9;
+  }
+  if (state.powerTrace)
+    fclose(state.powerTrace);
+  captureReader_close(&reader);
+  // Summary.
+  printf("hit counts:");
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    printf(" %u", state.hitCounts[i]);
+  printf("\n");
+  double captureSeconds = (double)state.sampleCount / SAMPLE_FREQUENCY_HZ;
+  fprintf(stderr,
+          "%llu samples (%.2f s of capture), %llu decimated, %llu lines "
+          "skipped\n",
+          (unsigned long long)state.sampleCount, captureSeconds,
+          (unsigned long long)state.decimatedCount,
+          (unsigned long long)reader.invalidCount);
+  if (elapsed > 0.0)
+    fprintf(stderr,
+            "%.3f s filtering, %.1f ns/sample, %.0f samples/s, %.1fx real "
+            "time\n",
+            elapsed, elapsed * 1.0E9 / state.sampleCount,
+            state.sampleCount / elapsed, captureSeconds / elapsed);
+#ifdef FILTER_GATING
+  detectorReplay_printGatingStats();
+#endif
+  return EXIT_SUCCESS;
+}
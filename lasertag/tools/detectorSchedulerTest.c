@@ -0,0 +1,44 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Runs detectorScheduler_runTest() (see detectorScheduler.h) on the host, with
+// the detector, the TFT and the sleep below standing in for the board. The exit
+// status is nonzero if the test fails.
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "detector.h"
+#include "detectorScheduler.h"
+#include "display.h"
+#include "utils.h"
+
+// The test drains the ADC buffer itself.
+void detector(bool interruptsCurrentlyEnabled) {
+  (void)interruptsCurrentlyEnabled;
+}
+
+void utils_sleep() {}
+
+// detectorProfile.c prints its table on the TFT, which the test does not use.
+void display_fillScreen(uint16_t color) { (void)color; }
+void display_setCursor(int16_t x, int16_t y) {
+  (void)x;
+  (void)y;
+}
+void display_setTextColor(uint16_t c) { (void)c; }
+void display_setTextSize(uint8_t s) { (void)s; }
+size_t display_println(const char str[]) {
+  (void)str;
+  return 0;
+}
+
+int main() {
+  return detectorScheduler_runTest() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
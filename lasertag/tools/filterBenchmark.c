@@ -0,0 +1,82 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Runs filterBenchmark.c on the host. One executable is built for each
+// FILTER_FREQUENCY_COUNT in CMakeLists.txt (filterBenchmark10,
+// filterBenchmark16, ...) and one for two sensors (filterBenchmarkDual);
+// benchmarkChannels.sh runs them all. See usage() below.
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "filter.h"
+#include "filterBenchmark.h"
+
+#define DEFAULT_OUTPUT_COUNT 100000 // 10 s of input.
+#define DEFAULT_RUN_COUNT 3
+
+static void filterBenchmark_usage(const char *program) {
+  fprintf(stderr,
+          "usage: %s [options]\n"
+          "Measures the filter bank with %d user frequencies and %d "
+          "channel(s).\n"
+          "  -n outputs   decimated samples per run (default %d)\n"
+          "  -r runs      runs; the fastest is reported (default %d)\n"
+          "  -t           print one table row: frequencies, channels, FIR, "
+          "IIR, power,\n"
+          "               hit and total ns/sample, load %% and estimated most "
+          "frequencies\n",
+          program, FILTER_FREQUENCY_COUNT, FILTER_CHANNEL_COUNT,
+          DEFAULT_OUTPUT_COUNT, DEFAULT_RUN_COUNT);
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t outputCount = DEFAULT_OUTPUT_COUNT;
+  uint32_t runCount = DEFAULT_RUN_COUNT;
+  bool tableRow = false;
+  int c;
+  while ((c = getopt(argc, argv, "n:r:th")) != -1) {
+    switch (c) {
+    case 'n':
+      outputCount = atoi(optarg);
+      break;
+    case 'r':
+      runCount = atoi(optarg);
+      break;
+    case 't':
+      tableRow = true;
+      break;
+    default:
+      filterBenchmark_usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (optind != argc || outputCount == 0 || runCount == 0) {
+    filterBenchmark_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  // Keep the fastest run; slower ones were disturbed by other processes.
+  filterBenchmark_result_t best;
+  for (uint32_t run = 0; run < runCount; run++) {
+    filterBenchmark_result_t result;
+    filterBenchmark_run(outputCount, &result);
+    if (run == 0 || result.totalPerSample < best.totalPerSample)
+      best = result;
+  }
+  if (tableRow)
+    printf("%d %d %.1f %.1f %.1f %.1f %.1f %.2f %lu\n", best.frequencyCount,
+           best.channelCount, best.firPerSample, best.iirPerSample,
+           best.powerPerSample, best.hitPerSample, best.totalPerSample,
+           best.loadPercent, (unsigned long)best.maxFrequencyCount);
+  else
+    filterBenchmark_print(&best);
+  return EXIT_SUCCESS;
+}
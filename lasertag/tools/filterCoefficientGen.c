@@ -0,0 +1,344 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Generates filterCoefficients.c for the compiled FILTER_FREQUENCY_COUNT. One
+// executable is built for each count in CMakeLists.txt (filterCoefficientGen10,
+// ...); the CMake projects run them at build time. The filters are designed by
+// filterDesign.c for the user frequencies of filterDesign_frequencyTicks(),
+// which are written as filter_frequencyTickTable for counts other than the
+// default (see filter.h). The designs, and the same
+// filters rounded to the fixed-point formats of filterFixedPoint.h, are checked
+// against the specification in filterDesign.h. If any check fails, the misses
+// are printed, no file is written and the exit status is nonzero, which fails
+// the build.
+//
+// usage: filterCoefficientGen output.c
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "filterCoefficients.h"
+#include "filterDesign.h"
+#include "filterFixedPoint.h"
+
+#define LINE_WIDTH 80 // The column limit of the source (clang-format).
+#define TOKEN_SIZE 64
+#define INDENT 4
+#define DEEP_INDENT 8 // Tables whose declaration is split before the size.
+#define CIC_GAIN pow(FILTER_FIR_DECIMATION_FACTOR, FILTER_CIC_STAGE_COUNT)
+
+// The designed filters, in double precision and in the kernel formats.
+typedef struct {
+  int32_t ticks[FILTER_FREQUENCY_COUNT];
+  double fir[FILTER_FIR_COEFFICIENT_COUNT];
+  double cicCompensation[FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT];
+  double iirA[FILTER_FREQUENCY_COUNT][FILTER_IIR_A_COEFFICIENT_COUNT];
+  double iirB[FILTER_FREQUENCY_COUNT][FILTER_IIR_B_COEFFICIENT_COUNT];
+  double iirSos[FILTER_FREQUENCY_COUNT][FILTER_IIR_SECTION_COUNT]
+               [FILTER_IIR_SECTION_COEFFICIENT_COUNT];
+  int32_t firFixed[FILTER_FIR_COEFFICIENT_COUNT];
+  int32_t iirSosFixed[FILTER_IIR_SECTION_COUNT]
+                     [FILTER_IIR_SECTION_COEFFICIENT_COUNT]
+                     [FILTER_FREQUENCY_COUNT];
+  int32_t cicCompensationFixed[FILTER_CIC_COMPENSATION_HALF_COUNT];
+} filterCoefficientGen_tables_t;
+
+// Writes text wrapped the way clang-format wraps initializer lists.
+typedef struct {
+  FILE *file;
+  uint16_t column;
+  uint16_t indent;     // Indent of the outermost list's elements.
+  uint16_t openBraces; // Nested braces open inside the outermost list.
+} filterCoefficientGen_writer_t;
+
+static filterCoefficientGen_tables_t tables;
+
+/*******************************************************************************
+***** Design
+*******************************************************************************/
+
+// Designs every table.
+static void filterCoefficientGen_design() {
+  uint16_t ticks[FILTER_FREQUENCY_COUNT];
+  filterDesign_frequencyTicks(ticks);
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+    tables.ticks[n] = ticks[n];
+  filterDesign_fir(tables.fir);
+  filterDesign_cicCompensation(tables.fir, tables.cicCompensation);
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+    filterDesign_iirBandPass(filterDesign_userFrequency(n), tables.iirSos[n],
+                             tables.iirA[n], tables.iirB[n]);
+  // The fixed-point kernels read the FIR coefficients oldest input first.
+  for (uint16_t i = 0; i < FILTER_FIR_COEFFICIENT_COUNT; i++)
+    tables.firFixed[i] =
+        filterDesign_toFixed(tables.fir[FILTER_FIR_COEFFICIENT_COUNT - 1 - i],
+                             FILTER_FIXED_POINT_FIR_COEFFICIENT_BITS);
+  for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++)
+    for (uint16_t c = 0; c < FILTER_IIR_SECTION_COEFFICIENT_COUNT; c++)
+      for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+        tables.iirSosFixed[s][c][n] =
+            filterDesign_toFixed(tables.iirSos[n][s][c],
+                                 FILTER_FIXED_POINT_IIR_COEFFICIENT_BITS);
+  for (uint16_t i = 0; i < FILTER_CIC_COMPENSATION_HALF_COUNT; i++)
+    tables.cicCompensationFixed[i] =
+        filterDesign_toFixed(tables.cicCompensation[i] / CIC_GAIN,
+                             FILTER_FIXED_POINT_CIC_COEFFICIENT_BITS);
+}
+
+// Checks one set of filters against the specification. Returns true if every
+// filter meets it.
+static bool filterCoefficientGen_checkFilters(
+    const double fir[FILTER_FIR_COEFFICIENT_COUNT],
+    const double compensation[FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT],
+    double sos[FILTER_FREQUENCY_COUNT][FILTER_IIR_SECTION_COUNT]
+              [FILTER_IIR_SECTION_COEFFICIENT_COUNT]) {
+  bool success = filterDesign_checkFir(fir);
+  success &= filterDesign_checkCicCompensation(fir, compensation);
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+    success &= filterDesign_checkIir(n, sos[n]);
+  return success;
+}
+
+// Checks the fixed-point tables, converted back to doubles, against the
+// specification. Rounding can move a gain that was just inside a limit outside
+// it. Returns true if every filter meets the specification.
+static bool filterCoefficientGen_checkFixed() {
+  double fir[FILTER_FIR_COEFFICIENT_COUNT];
+  double firScale = 1LL << FILTER_FIXED_POINT_FIR_COEFFICIENT_BITS;
+  for (uint16_t i = 0; i < FILTER_FIR_COEFFICIENT_COUNT; i++)
+    fir[FILTER_FIR_COEFFICIENT_COUNT - 1 - i] = tables.firFixed[i] / firScale;
+  double compensation[FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT];
+  double cicScale = CIC_GAIN / (1LL << FILTER_FIXED_POINT_CIC_COEFFICIENT_BITS);
+  for (uint16_t i = 0; i < FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT; i++) {
+    uint16_t half = (i < FILTER_CIC_COMPENSATION_HALF_COUNT)
+                        ? i
+                        : FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT - 1 - i;
+    compensation[i] = tables.cicCompensationFixed[half] * cicScale;
+  }
+  static double sos[FILTER_FREQUENCY_COUNT][FILTER_IIR_SECTION_COUNT]
+                   [FILTER_IIR_SECTION_COEFFICIENT_COUNT];
+  double iirScale = 1LL << FILTER_FIXED_POINT_IIR_COEFFICIENT_BITS;
+  for (uint16_t n = 0; n < FILTER_FREQUENCY_COUNT; n++)
+    for (uint16_t s = 0; s < FILTER_IIR_SECTION_COUNT; s++)
+      for (uint16_t c = 0; c < FILTER_IIR_SECTION_COEFFICIENT_COUNT; c++)
+        sos[n][s][c] = tables.iirSosFixed[s][c][n] / iirScale;
+  return filterCoefficientGen_checkFilters(fir, compensation, sos);
+}
+
+/*******************************************************************************
+***** Output
+*******************************************************************************/
+
+// Starts a new line indented by indent columns.
+static void filterCoefficientGen_newLine(filterCoefficientGen_writer_t *w,
+                                         uint16_t indent) {
+  fprintf(w->file, "\n%*s", indent, "");
+  w->column = indent;
+}
+
+// Writes one element of a (possibly nested) table. opening and closing are the
+// number of nested lists that start and end at this element; last is true for
+// the final element of the table.
+static void filterCoefficientGen_putElement(filterCoefficientGen_writer_t *w,
+                                            const char *value, uint16_t opening,
+                                            uint16_t closing, bool last) {
+  char token[TOKEN_SIZE];
+  uint16_t length = 0;
+  for (uint16_t i = 0; i < opening; i++)
+    token[length++] = '{';
+  length += snprintf(&token[length], TOKEN_SIZE - length, "%s", value);
+  for (uint16_t i = 0; i < closing; i++)
+    token[length++] = '}';
+  length += snprintf(&token[length], TOKEN_SIZE - length, "%s",
+                     last ? "};" : ",");
+  // Every nested list starts on a new line; elements wrap at the column limit,
+  // indented one column per open brace.
+  uint16_t indent = w->indent + w->openBraces;
+  if (opening || w->column == 0 || w->column + 1 + length > LINE_WIDTH)
+    filterCoefficientGen_newLine(w, indent);
+  else
+    w->column += fprintf(w->file, " ");
+  w->column += fprintf(w->file, "%s", token);
+  w->openBraces += opening;
+  w->openBraces -= closing;
+}
+
+// Writes a table of count values, which is rows of dimension[last] values,
+// nested as given by dimensions[]. declaration ends with "= {".
+static void filterCoefficientGen_putTable(FILE *file, const char *declaration,
+                                          uint16_t indent,
+                                          const double *doubles,
+                                          const int32_t *integers,
+                                          const uint16_t dimensions[],
+                                          uint16_t dimensionCount) {
+  filterCoefficientGen_writer_t w = {file, 0, indent, 0};
+  fprintf(file, "\n%s", declaration);
+  uint32_t count = 1;
+  for (uint16_t d = 0; d < dimensionCount; d++)
+    count *= dimensions[d];
+  for (uint32_t i = 0; i < count; i++) {
+    // Count the nested lists (not the outermost) that start and end here.
+    uint16_t opening = 0, closing = 0;
+    uint32_t stride = 1;
+    for (int16_t d = dimensionCount - 1; d > 0; d--) {
+      stride *= dimensions[d];
+      if (i % stride == 0)
+        opening++;
+      if (i % stride == stride - 1)
+        closing++;
+    }
+    char value[TOKEN_SIZE];
+    if (doubles)
+      snprintf(value, TOKEN_SIZE, "%.20e", doubles[i]);
+    else
+      snprintf(value, TOKEN_SIZE, "%ld", (long)integers[i]);
+    filterCoefficientGen_putElement(&w, value, opening, closing,
+                                    i == count - 1);
+  }
+  fprintf(file, "\n");
+}
+
+// Writes filterCoefficients.c.
+static void filterCoefficientGen_write(FILE *file) {
+  fprintf(
+      file,
+      "/*\n"
+      "This software is provided for student assignment use in the Department "
+      "of\n"
+      "Electrical and Computer Engineering, Brigham Young University, Utah, "
+      "USA.\n"
+      "Users agree to not re-host, or redistribute the software, in source or "
+      "binary\n"
+      "form, to other persons or other institutions. Users may modify and use "
+      "the\n"
+      "source code for personal or educational use.\n"
+      "For questions, contact Brad Hutchings or Jeff Goeders, "
+      "https://ece.byu.edu/\n"
+      "*/\n"
+      "\n"
+      "// Generated by tools/filterCoefficientGen.c for FILTER_FREQUENCY_COUNT "
+      "%d.\n"
+      "// Do not edit; see filterCoefficients.h and filterDesign.h.\n"
+      "\n"
+      "#include \"filterCoefficients.h\"\n"
+      "\n"
+      "#if FILTER_FREQUENCY_COUNT != %d\n"
+      "#error \"Generated for a different FILTER_FREQUENCY_COUNT.\"\n"
+      "#endif\n",
+      FILTER_FREQUENCY_COUNT, FILTER_FREQUENCY_COUNT);
+  uint16_t fir[] = {FILTER_FIR_COEFFICIENT_COUNT};
+  uint16_t cic[] = {FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT};
+  uint16_t cicHalf[] = {FILTER_CIC_COMPENSATION_HALF_COUNT};
+  uint16_t iirA[] = {FILTER_FREQUENCY_COUNT, FILTER_IIR_A_COEFFICIENT_COUNT};
+  uint16_t iirB[] = {FILTER_FREQUENCY_COUNT, FILTER_IIR_B_COEFFICIENT_COUNT};
+  uint16_t iirSos[] = {FILTER_FREQUENCY_COUNT, FILTER_IIR_SECTION_COUNT,
+                       FILTER_IIR_SECTION_COEFFICIENT_COUNT};
+  uint16_t iirSosFixed[] = {FILTER_IIR_SECTION_COUNT,
+                            FILTER_IIR_SECTION_COEFFICIENT_COUNT,
+                            FILTER_FREQUENCY_COUNT};
+#if FILTER_FREQUENCY_COUNT != FILTER_DEFAULT_FREQUENCY_COUNT
+  // filter.h has the table for the default count.
+  uint16_t frequencies[] = {FILTER_FREQUENCY_COUNT};
+  filterCoefficientGen_putTable(
+      file,
+      "const uint16_t filter_frequencyTickTable[FILTER_FREQUENCY_COUNT] = {",
+      INDENT, NULL, tables.ticks, frequencies, 1);
+#endif
+  filterCoefficientGen_putTable(
+      file,
+      "const double filterCoefficients_fir[FILTER_FIR_COEFFICIENT_COUNT] = {",
+      INDENT, tables.fir, NULL, fir, 1);
+  filterCoefficientGen_putTable(
+      file,
+      "const double filterCoefficients_cicCompensation\n"
+      "    [FILTER_CIC_COMPENSATION_COEFFICIENT_COUNT] = {",
+      DEEP_INDENT, tables.cicCompensation, NULL, cic, 1);
+  filterCoefficientGen_putTable(
+      file,
+      "const double filterCoefficients_iirA[FILTER_FREQUENCY_COUNT]\n"
+      "                                    "
+      "[FILTER_IIR_A_COEFFICIENT_COUNT] = {",
+      INDENT, &tables.iirA[0][0], NULL, iirA, 2);
+  filterCoefficientGen_putTable(
+      file,
+      "const double filterCoefficients_iirB[FILTER_FREQUENCY_COUNT]\n"
+      "                                    "
+      "[FILTER_IIR_B_COEFFICIENT_COUNT] = {",
+      INDENT, &tables.iirB[0][0], NULL, iirB, 2);
+  filterCoefficientGen_putTable(
+      file,
+      "const double\n"
+      "    filterCoefficients_iirSos[FILTER_FREQUENCY_COUNT]"
+      "[FILTER_IIR_SECTION_COUNT]\n"
+      "                             [FILTER_IIR_SECTION_COEFFICIENT_COUNT] = {",
+      INDENT, &tables.iirSos[0][0][0], NULL, iirSos, 3);
+  filterCoefficientGen_putTable(
+      file,
+      "const int32_t "
+      "filterCoefficients_firFixed[FILTER_FIR_COEFFICIENT_COUNT] = {",
+      INDENT, NULL, tables.firFixed, fir, 1);
+  filterCoefficientGen_putTable(
+      file,
+      "const int32_t\n"
+      "    filterCoefficients_iirSosFixed[FILTER_IIR_SECTION_COUNT]\n"
+      "                                  [FILTER_IIR_SECTION_COEFFICIENT_COUNT]"
+      "\n"
+      "                                  [FILTER_FREQUENCY_COUNT] = {",
+      INDENT, NULL, &tables.iirSosFixed[0][0][0], iirSosFixed, 3);
+  filterCoefficientGen_putTable(
+      file,
+      "const int32_t filterCoefficients_cicCompensationFixed\n"
+      "    [FILTER_CIC_COMPENSATION_HALF_COUNT] = {",
+      DEEP_INDENT, NULL, tables.cicCompensationFixed, cicHalf, 1);
+}
+
+int main(int argc, char *argv[]) {
+  if (argc != 2) {
+    fprintf(stderr,
+            "usage: %s output.c\n"
+            "Designs the filters for %d user frequencies, checks them and "
+            "writes\n"
+            "filterCoefficients.c to output.c.\n",
+            argv[0], FILTER_FREQUENCY_COUNT);
+    return EXIT_FAILURE;
+  }
+  filterCoefficientGen_design();
+  // Only check the fixed-point tables if the design passes, so that each miss
+  // is reported once.
+  if (!filterCoefficientGen_checkFilters(tables.fir, tables.cicCompensation,
+                                         tables.iirSos)) {
+    fprintf(stderr,
+            "%s: the filters for %d user frequencies miss the specification "
+            "in filterDesign.h.\n",
+            argv[0], FILTER_FREQUENCY_COUNT);
+    return EXIT_FAILURE;
+  }
+  if (!filterCoefficientGen_checkFixed()) {
+    fprintf(stderr,
+            "%s: the filters for %d user frequencies miss the specification "
+            "in filterDesign.h once rounded to the formats in "
+            "filterFixedPoint.h.\n",
+            argv[0], FILTER_FREQUENCY_COUNT);
+    return EXIT_FAILURE;
+  }
+  FILE *file = fopen(argv[1], "w");
+  if (!file) {
+    perror(argv[1]);
+    return EXIT_FAILURE;
+  }
+  filterCoefficientGen_write(file);
+  if (fclose(file) != 0) {
+    perror(argv[1]);
+    remove(argv[1]);
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,20 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Runs filterPower_runTest() (see filterPower.h) on the host. The exit status
+// is nonzero if it fails.
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "filterPower.h"
+
+int main() {
+  return filterPower_runTest() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,61 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Runs filterTest_runTest() (see filterTest.h) on the host, with the TFT, the
+// histogram and the delays below standing in for the board. The square-wave
+// simulations run in worker processes (FILTER_TEST_WORKERS in filterTest.c).
+// The exit status is nonzero if the test fails.
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "display.h"
+#include "filterTest.h"
+#include "histogram.h"
+#include "utils.h"
+
+// filterTest.c plots on the TFT, which the host does not have.
+void display_init() {}
+void display_drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                      uint16_t color) {
+  (void)x0;
+  (void)y0;
+  (void)x1;
+  (void)y1;
+  (void)color;
+}
+void display_fillScreen(uint16_t color) { (void)color; }
+void display_setRotation(uint8_t r) { (void)r; }
+int16_t display_height() { return DISPLAY_HEIGHT; }
+int16_t display_width() { return DISPLAY_WIDTH; }
+
+void histogram_init(uint16_t barCount) { (void)barCount; }
+bool histogram_setBarData(histogram_index_t barIndex, histogram_data_t data,
+                          const char barTopLabel[]) {
+  (void)barIndex;
+  (void)data;
+  (void)barTopLabel;
+  return true;
+}
+void histogram_setBarColor(histogram_index_t barIndex, uint16_t color) {
+  (void)barIndex;
+  (void)color;
+}
+void histogram_setBarLabel(histogram_index_t barIndex, const char *label) {
+  (void)barIndex;
+  (void)label;
+}
+void histogram_redrawBottomLabels() {}
+void histogram_updateDisplay() {}
+void trimLabel(char label[]) { (void)label; }
+
+// The plots are not held on a display.
+void utils_msDelay(long ms) { (void)ms; }
+
+int main() { return filterTest_runTest() ? EXIT_SUCCESS : EXIT_FAILURE; }
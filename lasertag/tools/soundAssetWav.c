@@ -0,0 +1,179 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Writes a sound asset (sounds/*.wav.bin) back to a mono 16-bit WAV file, as
+// wav2c read it. The WAV files the assets were made from are not in the
+// repository, so the build runs wav2c -a -b on these to make the IMA-ADPCM
+// assets (soundAdpcm.h). With -r, writes the asset at a lower sample rate,
+// low-pass filtered below the new Nyquist frequency, for the assets stored at
+// lower rates (soundResample.h).
+//   soundAssetWav gunEmpty48k gunEmpty48k.wav
+//   soundAssetWav -r 22050 bcfire01_48k bcfire01.wav
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sounds/bcfire01_48k.wav.h"
+#include "sounds/gameBoyStartup.wav.h"
+#include "sounds/gameOver48k.wav.h"
+#include "sounds/gunEmpty48k.wav.h"
+#include "sounds/ouch48k.wav.h"
+#include "sounds/pacmanDeath.wav.h"
+#include "sounds/powerUp48k.wav.h"
+#include "sounds/screamAndDie48k.wav.h"
+
+#define WAV_HEADER_BYTES 44
+#define WAV_BYTES_PER_SAMPLE 2
+#define RATE_OPTION "-r"
+// The low-pass filter passes up to PASSBAND of the new Nyquist frequency. Its
+// windowed-sinc kernel spans FILTER_ZEROS zero crossings on each side.
+#define PASSBAND 0.9
+#define FILTER_ZEROS 32
+
+typedef struct {
+  const char *name;
+  const uint16_t *samples; // Offset binary (signed + INT16_MAX).
+  uint32_t sampleCount;
+  uint32_t sampleRate;
+} soundAsset_t;
+
+#define SOUND_ASSET(name, NAME)                                                \
+  {#name, name##_wav, NAME##_WAV_NUMBER_OF_SAMPLES, NAME##_WAV_SAMPLE_RATE}
+
+static const soundAsset_t assets[] = {
+    SOUND_ASSET(bcfire01_48k, BCFIRE01_48K),
+    SOUND_ASSET(gameBoyStartup, GAMEBOYSTARTUP),
+    SOUND_ASSET(gameOver48k, GAMEOVER48K),
+    SOUND_ASSET(gunEmpty48k, GUNEMPTY48K),
+    SOUND_ASSET(ouch48k, OUCH48K),
+    SOUND_ASSET(pacmanDeath, PACMANDEATH),
+    SOUND_ASSET(powerUp48k, POWERUP48K),
+    SOUND_ASSET(screamAndDie48k, SCREAMANDDIE48K),
+};
+#define ASSET_COUNT (sizeof(assets) / sizeof(assets[0]))
+
+// Writes value to file as little-endian bytes.
+static void writeLittleEndian(FILE *file, uint32_t value, uint16_t bytes) {
+  for (uint16_t i = 0; i < bytes; i++)
+    fputc((value >> (8 * i)) & 0xFF, file);
+}
+
+// Returns the signed sample i of asset.
+static int32_t assetSample(const soundAsset_t *asset, uint32_t i) {
+  int32_t sample = (int32_t)asset->samples[i] - INT16_MAX;
+  if (sample > INT16_MAX) // Only UINT16_MAX, which wav2c never writes.
+    sample = INT16_MAX;
+  return sample;
+}
+
+// Returns the sample of asset at rate, at frame i: the asset low-pass filtered
+// at cutoff (a fraction of its rate) at the time of the frame, with a
+// Blackman-windowed sinc.
+static int32_t resampledSample(const soundAsset_t *asset, uint32_t rate,
+                               double cutoff, uint32_t i) {
+  double time = (double)i * asset->sampleRate / rate; // In asset samples.
+  double halfWidth = FILTER_ZEROS / (2.0 * cutoff);
+  int64_t first = (int64_t)ceil(time - halfWidth);
+  int64_t last = (int64_t)floor(time + halfWidth);
+  double sum = 0.0;
+  for (int64_t n = first < 0 ? 0 : first;
+       n <= last && n < asset->sampleCount; n++) {
+    double x = n - time;
+    double lowPass =
+        x == 0.0 ? 2.0 * cutoff : sin(2.0 * M_PI * cutoff * x) / (M_PI * x);
+    double w = 0.5 + 0.5 * x / halfWidth; // 0 to 1 across the kernel.
+    double window =
+        0.42 - 0.5 * cos(2.0 * M_PI * w) + 0.08 * cos(4.0 * M_PI * w);
+    sum += assetSample(asset, n) * lowPass * window;
+  }
+  long sample = lround(sum);
+  return sample > INT16_MAX ? INT16_MAX : sample < INT16_MIN ? INT16_MIN : sample;
+}
+
+// Writes asset to fileName at rate, which is at most its own. Returns true if
+// it was written.
+static bool writeAsset(const soundAsset_t *asset, uint32_t rate,
+                       const char *fileName) {
+  FILE *file = fopen(fileName, "wb");
+  if (file == NULL) {
+    perror(fileName);
+    return false;
+  }
+  uint32_t sampleCount = asset->sampleCount;
+  double cutoff = PASSBAND * rate / (2.0 * asset->sampleRate);
+  if (rate != asset->sampleRate)
+    sampleCount = (uint64_t)(asset->sampleCount - 1) * rate /
+                      asset->sampleRate + 1;
+  uint32_t dataBytes = sampleCount * WAV_BYTES_PER_SAMPLE;
+  fputs("RIFF", file);
+  writeLittleEndian(file, WAV_HEADER_BYTES - 8 + dataBytes, 4);
+  fputs("WAVEfmt ", file);
+  writeLittleEndian(file, 16, 4); // Format chunk size.
+  writeLittleEndian(file, 1, 2);  // PCM.
+  writeLittleEndian(file, 1, 2);  // Mono.
+  writeLittleEndian(file, rate, 4);
+  writeLittleEndian(file, rate * WAV_BYTES_PER_SAMPLE, 4);
+  writeLittleEndian(file, WAV_BYTES_PER_SAMPLE, 2);
+  writeLittleEndian(file, 8 * WAV_BYTES_PER_SAMPLE, 2); // Bits per sample.
+  fputs("data", file);
+  writeLittleEndian(file, dataBytes, 4);
+  for (uint32_t i = 0; i < sampleCount; i++) {
+    int32_t sample = rate == asset->sampleRate
+                         ? assetSample(asset, i)
+                         : resampledSample(asset, rate, cutoff, i);
+    writeLittleEndian(file, (uint16_t)sample, WAV_BYTES_PER_SAMPLE);
+  }
+  bool success = !ferror(file);
+  success = fclose(file) == 0 && success;
+  if (!success)
+    perror(fileName);
+  return success;
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t rate = 0; // The asset's own.
+  int arg = 1;
+  if (argc == 5 && !strcmp(argv[1], RATE_OPTION)) {
+    char *end;
+    rate = strtoul(argv[2], &end, 0);
+    if (*end != '\0' || rate == 0) {
+      fprintf(stderr, "%s: bad rate %s.\n", argv[0], argv[2]);
+      return EXIT_FAILURE;
+    }
+    arg = 3;
+  }
+  if (argc != arg + 2) {
+    fprintf(stderr, "usage: %s [%s rate] asset file.wav\nassets:", argv[0],
+            RATE_OPTION);
+    for (uint16_t i = 0; i < ASSET_COUNT; i++)
+      fprintf(stderr, " %s", assets[i].name);
+    fprintf(stderr, "\n");
+    return EXIT_FAILURE;
+  }
+  for (uint16_t i = 0; i < ASSET_COUNT; i++) {
+    if (strcmp(argv[arg], assets[i].name))
+      continue;
+    if (rate == 0)
+      rate = assets[i].sampleRate;
+    if (rate > assets[i].sampleRate) {
+      fprintf(stderr, "%s: %s is at %lu Hz, below %lu Hz.\n", argv[0],
+              assets[i].name, (unsigned long)assets[i].sampleRate,
+              (unsigned long)rate);
+      return EXIT_FAILURE;
+    }
+    return writeAsset(&assets[i], rate, argv[arg + 1]) ? EXIT_SUCCESS
+                                                       : EXIT_FAILURE;
+  }
+  fprintf(stderr, "%s: no asset %s.\n", argv[0], argv[arg]);
+  return EXIT_FAILURE;
+}
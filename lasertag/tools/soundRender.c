@@ -0,0 +1,159 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Plays sounds through the DMA-fed audio output (soundDma.h) on the host, with
+// the simulated transfers. Without arguments, runs sound_runDmaTest(), with
+// SOUND_MIXER sound_runMixerTest(), with SOUND_ADPCM sound_runAdpcmTest()
+// and sound_printAdpcmReport() and with SOUND_RESAMPLE sound_runResampleTest();
+// the exit status is nonzero if a test fails.
+// With a file name and sound numbers (sound_sounds_t), each optionally followed
+// by @ and a start time in ms, plays the sounds at maximum volume and writes the
+// words the transfers send to a 48 kHz stereo WAV file of 32-bit samples.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sound.h"
+#include "soundDma.h"
+#ifdef SOUND_MIXER
+#include "soundMixer.h"
+#endif
+#ifdef SOUND_ADPCM
+#include "soundAdpcm.h"
+#endif
+#ifdef SOUND_RESAMPLE
+#include "soundResample.h"
+#endif
+
+#define WAV_HEADER_BYTES 44
+#define WAV_BYTES_PER_WORD 4
+#define I2S_WORD_MASK 0xFFFFFF00 // The I2S controller sends the top 24 bits.
+#define MAX_SOUNDS 16
+
+// A sound to play and when to start it.
+typedef struct {
+  sound_sounds_t sound;
+  uint32_t startBlock;
+} soundStart_t;
+
+// Writes value to file as little-endian bytes.
+static void writeLittleEndian(FILE *file, uint32_t value, uint16_t bytes) {
+  for (uint16_t i = 0; i < bytes; i++)
+    fputc((value >> (8 * i)) & 0xFF, file);
+}
+
+// Writes the header of a WAV file of wordCount words.
+static void writeWavHeader(FILE *file, uint32_t wordCount) {
+  uint32_t dataBytes = wordCount * WAV_BYTES_PER_WORD;
+  fputs("RIFF", file);
+  writeLittleEndian(file, WAV_HEADER_BYTES - 8 + dataBytes, 4);
+  fputs("WAVEfmt ", file);
+  writeLittleEndian(file, 16, 4); // Format chunk size.
+  writeLittleEndian(file, 1, 2);  // PCM.
+  writeLittleEndian(file, SOUND_DMA_WORDS_PER_FRAME, 2); // Channels.
+  writeLittleEndian(file, SOUND_DMA_SAMPLE_RATE, 4);
+  writeLittleEndian(file,
+                    SOUND_DMA_SAMPLE_RATE * SOUND_DMA_WORDS_PER_FRAME *
+                        WAV_BYTES_PER_WORD,
+                    4); // Bytes per second.
+  writeLittleEndian(file, SOUND_DMA_WORDS_PER_FRAME * WAV_BYTES_PER_WORD, 2);
+  writeLittleEndian(file, 8 * WAV_BYTES_PER_WORD, 2); // Bits per sample.
+  fputs("data", file);
+  writeLittleEndian(file, dataBytes, 4);
+}
+
+// Sends blocks, starting each sound before the block at its start time, until
+// the last has been heard, and writes them to fileName. Returns true if the
+// file was written.
+static bool renderSounds(const soundStart_t starts[], uint16_t startCount,
+                         const char *fileName) {
+  FILE *file = fopen(fileName, "wb");
+  if (file == NULL) {
+    perror(fileName);
+    return false;
+  }
+  sound_init();
+  sound_setVolume(sound_maximumVolume_e);
+  sound_dmaStart();
+  writeWavHeader(file, 0); // Rewritten once the length is known.
+  uint32_t words[SOUND_DMA_BLOCK_WORDS];
+  uint32_t wordCount = 0;
+  uint16_t started = 0;
+  // The buffers hold the blocks rendered before sound_isBusy() turned false.
+  uint16_t remainingBlocks = SOUND_DMA_BUFFER_COUNT;
+  while (started < startCount || sound_isBusy() || remainingBlocks-- > 0) {
+    for (uint16_t i = 0; i < startCount; i++) {
+      if (starts[i].startBlock != sound_dmaBlockCount())
+        continue;
+      sound_setSound(starts[i].sound);
+      sound_startSound();
+      started++;
+      remainingBlocks = SOUND_DMA_BUFFER_COUNT;
+    }
+    sound_dmaSimulateBlock(words);
+    for (uint32_t i = 0; i < SOUND_DMA_BLOCK_WORDS; i++)
+      writeLittleEndian(file, words[i] & I2S_WORD_MASK, WAV_BYTES_PER_WORD);
+    wordCount += SOUND_DMA_BLOCK_WORDS;
+  }
+  sound_dmaStop();
+  rewind(file);
+  writeWavHeader(file, wordCount);
+  bool success = !ferror(file);
+  success = fclose(file) == 0 && success;
+  if (!success)
+    perror(fileName);
+  printf("%s: %lu blocks, %.3f s.\n", fileName,
+         (unsigned long)sound_dmaBlockCount(),
+         (double)wordCount / SOUND_DMA_WORDS_PER_FRAME / SOUND_DMA_SAMPLE_RATE);
+#ifdef SOUND_MIXER
+  sound_mixerPrintStats();
+#endif
+  return success;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc == 1) {
+    bool success = sound_runDmaTest();
+#ifdef SOUND_MIXER
+    success = sound_runMixerTest() && success;
+#endif
+#ifdef SOUND_ADPCM
+    success = sound_runAdpcmTest() && success;
+    sound_printAdpcmReport();
+#endif
+#ifdef SOUND_RESAMPLE
+    success = sound_runResampleTest() && success;
+#endif
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+  if (argc < 3 || argc - 2 > MAX_SOUNDS) {
+    fprintf(stderr, "usage: %s [file.wav sound[@ms]...]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  soundStart_t starts[MAX_SOUNDS];
+  for (int i = 2; i < argc; i++) {
+    char *end;
+    long sound = strtol(argv[i], &end, 0);
+    long ms = *end == '@' ? strtol(end + 1, &end, 0) : 0;
+    if (*end != '\0' || sound < sound_gameStart_e ||
+        sound > sound_oneSecondSilence_e || ms < 0) {
+      fprintf(stderr,
+              "%s: bad sound %s: the sound is %d to %d (sound_sounds_t), the "
+              "time at least 0.\n",
+              argv[0], argv[i], sound_gameStart_e, sound_oneSecondSilence_e);
+      return EXIT_FAILURE;
+    }
+    starts[i - 2].sound = sound;
+    starts[i - 2].startBlock =
+        (uint64_t)ms * SOUND_DMA_SAMPLE_RATE / 1000 / SOUND_DMA_BLOCK_FRAMES;
+  }
+  return renderSounds(starts, argc - 2, argv[1]) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
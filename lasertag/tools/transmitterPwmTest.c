@@ -0,0 +1,117 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Runs transmitter_runPwmTest() and then, with the buttons, switches and
+// delays below standing in for the board, transmitter_runNoncontinuousTest()
+// and transmitter_runContinuousTest() on the simulated TTC (see
+// transmitterPwm.h). The exit status is nonzero if any check fails.
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "buttons.h"
+#include "filter.h"
+#include "switches.h"
+#include "transmitterPwm.h"
+#include "utils.h"
+
+#define TICKS_PER_MS (TRANSMITTER_PWM_TICK_HZ / 1000)
+#define PRESS_MS 1500  // BTN1 is pressed this long into each test.
+#define SWITCH_MS 1050 // The switches change this long into each test.
+#define FIRST_SWITCHES 1
+#define SECOND_SWITCHES 3
+#define WINDOW_MS 100 // Rising edges are counted after each of those times.
+#define NONCONTINUOUS_BURSTS 3 // At 0, 0.5 and 1 s.
+#define EDGE_TOLERANCE 2
+
+static uint32_t ticks;  // Since the start of the current test.
+static uint32_t bursts; // Started in the current test.
+static bool wasRunning;
+static bool wasHigh;
+// Rising edges in the WINDOW_MS after SWITCH_MS and in the one before PRESS_MS.
+static uint32_t switchEdges;
+static uint32_t pressEdges;
+
+// Runs the simulated TTC for ms milliseconds.
+void utils_msDelay(long ms) {
+  for (long i = 0; i < ms * TICKS_PER_MS; i++) {
+    transmitter_tick();
+    bool high = transmitter_pwmOutput();
+    uint32_t now = ticks++ / TICKS_PER_MS; // In ms.
+    if (high && !wasHigh) {
+      switchEdges += now >= SWITCH_MS && now < SWITCH_MS + WINDOW_MS;
+      pressEdges += now >= PRESS_MS - WINDOW_MS && now < PRESS_MS;
+    }
+    bursts += transmitter_running() && !wasRunning;
+    wasHigh = high;
+    wasRunning = transmitter_running();
+  }
+}
+
+// Each read takes a millisecond. BTN1 is down from PRESS_MS.
+uint8_t buttons_read() {
+  utils_msDelay(1);
+  return ticks >= PRESS_MS * TICKS_PER_MS ? BUTTONS_BTN1_MASK : 0;
+}
+
+// The switches select one frequency until SWITCH_MS, then another.
+uint8_t switches_read() {
+  return ticks < SWITCH_MS * TICKS_PER_MS ? FIRST_SWITCHES : SECOND_SWITCHES;
+}
+
+// Starts the time and the counts of a test.
+static void startTest() {
+  ticks = 0;
+  bursts = 0;
+  wasRunning = false;
+  wasHigh = false;
+  switchEdges = 0;
+  pressEdges = 0;
+}
+
+// Returns true if edges is the number of rising edges of frequencyNumber in
+// WINDOW_MS, give or take EDGE_TOLERANCE.
+static bool checkEdges(uint32_t edges, uint16_t frequencyNumber) {
+  int32_t expected = WINDOW_MS * TICKS_PER_MS /
+                     filter_frequencyTickTable[frequencyNumber];
+  return abs((int32_t)edges - expected) <= EDGE_TOLERANCE;
+}
+
+int main() {
+  bool success = transmitter_runPwmTest();
+
+  // Bursts until BTN1, each at the switches' frequency when it starts.
+  startTest();
+  transmitter_runNoncontinuousTest();
+  if (bursts != NONCONTINUOUS_BURSTS || transmitter_running() ||
+      transmitter_pwmOutput()) {
+    printf("transmitter_runNoncontinuousTest: %d bursts, running %d, output "
+           "%d; should be %d, 0, 0.\n",
+           bursts, transmitter_running(), transmitter_pwmOutput(),
+           NONCONTINUOUS_BURSTS);
+    success = false;
+  }
+
+  // The switches change during the burst from 1 to 1.2 s, so the frequency
+  // changes at 1.2 s.
+  startTest();
+  transmitter_runContinuousTest();
+  if (bursts != 1 || !checkEdges(switchEdges, FIRST_SWITCHES) ||
+      !checkEdges(pressEdges, SECOND_SWITCHES) || transmitter_running() ||
+      transmitter_pwmOutput()) {
+    printf("transmitter_runContinuousTest: %d bursts, %d and %d rising edges, "
+           "running %d, output %d.\n",
+           bursts, switchEdges, pressEdges, transmitter_running(),
+           transmitter_pwmOutput());
+    success = false;
+  }
+  printf("transmitterPwmTest %s.\n", success ? "passed" : "failed");
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
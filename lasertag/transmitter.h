@@ -19,6 +19,9 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 // The transmitter state machine generates a square wave output at the chosen
 // frequency as set by transmitter_setFrequencyNumber(). The step counts for the
 // frequencies are provided in filter.h
+//
+// transmitterPwm.c (cmake -DTRANSMITTER_PWM=1) implements this API with a
+// hardware timer instead; see transmitterPwm.h.
 
 // Standard init function.
 void transmitter_init();
@@ -0,0 +1,450 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Timer-generated transmitter waveform. See transmitterPwm.h.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "buttons.h"
+#include "filter.h"
+#include "switches.h"
+#include "transmitterPwm.h"
+#include "utils.h"
+
+#if defined(ZYBO_BOARD) && !defined(TRANSMITTER_PWM_EMIO)
+#error "TRANSMITTER_PWM needs the TTC0 route; see transmitterPwm.h."
+#endif
+
+#ifdef ZYBO_BOARD
+#include "xil_io.h"
+#include "xparameters.h"
+#include "xscugic.h"
+#endif
+
+#define WAVE_COUNTER 0  // Makes the square wave.
+#define BURST_COUNTER 1 // Times the bursts.
+#define COUNTER_COUNT 2
+
+#ifdef ZYBO_BOARD
+// TTC0 registers (UG585, appendix B). xparameters.h has no TTC entries, as the
+// hardware platform leaves the TTCs off; see transmitterPwm.h.
+#define TTC_BASEADDR 0xE0104000
+#define TTC_COUNTER_OFFSET(counter) ((counter) * 4) // Each register has three.
+#define TTC_CLOCK_CONTROL_OFFSET 0x00
+#define TTC_COUNTER_CONTROL_OFFSET 0x0C
+#define TTC_INTERVAL_OFFSET 0x24
+#define TTC_MATCH_1_OFFSET 0x30
+#define TTC_INTERRUPT_OFFSET 0x54 // Cleared by reading.
+#define TTC_INTERRUPT_ENABLE_OFFSET 0x60
+#define TTC_CLOCK_PRESCALE_ENABLE 0x01
+#define TTC_CLOCK_PRESCALE_SHIFT 1 // Divides by 2^(value + 1).
+#define TTC_COUNTER_DISABLE 0x01
+#define TTC_COUNTER_INTERVAL_MODE 0x02
+// With the waveform polarity bit clear, the output goes high at match 1 and low
+// again at the interval.
+#define TTC_COUNTER_MATCH_MODE 0x08
+#define TTC_COUNTER_RESET 0x10
+#define TTC_COUNTER_WAVE_DISABLE 0x20
+#define TTC_INTERRUPT_INTERVAL 0x01
+#define BURST_INTERRUPT XPS_TTC0_1_INT_ID // Interrupt of BURST_COUNTER.
+
+static bool interruptConnected;
+#else
+// A simulated TTC counter in interval mode.
+typedef struct {
+  bool enabled;
+  transmitter_pwmSetting_t setting;
+  uint32_t count;
+  // TTC clocks since the last count, in units of 1/TRANSMITTER_PWM_TICK_HZ.
+  uint64_t clockPhase;
+} simulatedCounter_t;
+
+static simulatedCounter_t simulatedCounters[COUNTER_COUNT];
+static bool simulatedOutput;
+#endif
+
+static transmitter_pwmSetting_t frequencySettings[FILTER_FREQUENCY_COUNT];
+static transmitter_pwmSetting_t burstSetting;
+static volatile bool running;
+static volatile bool continuousMode;
+static volatile uint16_t frequencyNumber;      // Set by the user.
+static volatile uint16_t burstFrequencyNumber; // Being transmitted.
+
+// Returns the whole prescaled TTC clocks, rounded, in periodTicks ticks.
+static uint64_t transmitter_pwmCounts(uint32_t periodTicks,
+                                      uint8_t prescaleLog2) {
+  uint64_t divisor = (uint64_t)TRANSMITTER_PWM_TICK_HZ << prescaleLog2;
+  return ((uint64_t)periodTicks * TRANSMITTER_PWM_CLOCK_HZ + divisor / 2) /
+         divisor;
+}
+
+// Returns the settings for a period of periodTicks ticks.
+transmitter_pwmSetting_t transmitter_pwmComputeSetting(uint32_t periodTicks) {
+  uint8_t prescaleLog2 = 0;
+  uint64_t counts = transmitter_pwmCounts(periodTicks, prescaleLog2);
+  while (counts - 1 > TRANSMITTER_PWM_MAX_INTERVAL &&
+         prescaleLog2 < TRANSMITTER_PWM_MAX_PRESCALE_LOG2)
+    counts = transmitter_pwmCounts(periodTicks, ++prescaleLog2);
+  if (counts - 1 > TRANSMITTER_PWM_MAX_INTERVAL)
+    counts = TRANSMITTER_PWM_MAX_INTERVAL + 1; // Longer than 39 s.
+  transmitter_pwmSetting_t setting = {prescaleLog2, counts - 1, counts / 2};
+  return setting;
+}
+
+// Returns the length, in nanoseconds, of a period of setting.
+double transmitter_pwmPeriodNs(transmitter_pwmSetting_t setting) {
+  return (double)(((uint64_t)setting.interval + 1) << setting.prescaleLog2) *
+         1.0e9 / TRANSMITTER_PWM_CLOCK_HZ;
+}
+
+// Starts counter from 0 with setting.
+static void transmitter_pwmStartCounter(uint16_t counter,
+                                        transmitter_pwmSetting_t setting) {
+#ifdef ZYBO_BOARD
+  uint32_t base = TTC_BASEADDR + TTC_COUNTER_OFFSET(counter);
+  Xil_Out32(base + TTC_COUNTER_CONTROL_OFFSET,
+            TTC_COUNTER_DISABLE | TTC_COUNTER_WAVE_DISABLE);
+  Xil_Out32(base + TTC_CLOCK_CONTROL_OFFSET,
+            setting.prescaleLog2 ? TTC_CLOCK_PRESCALE_ENABLE |
+                                       (setting.prescaleLog2 - 1)
+                                           << TTC_CLOCK_PRESCALE_SHIFT
+                                 : 0);
+  Xil_Out32(base + TTC_INTERVAL_OFFSET, setting.interval);
+  Xil_Out32(base + TTC_MATCH_1_OFFSET, setting.match);
+  // Only the wave counter drives its waveform output.
+  Xil_Out32(base + TTC_COUNTER_CONTROL_OFFSET,
+            TTC_COUNTER_INTERVAL_MODE | TTC_COUNTER_RESET |
+                (counter == WAVE_COUNTER ? TTC_COUNTER_MATCH_MODE
+                                         : TTC_COUNTER_WAVE_DISABLE));
+#else
+  simulatedCounters[counter].enabled = true;
+  simulatedCounters[counter].setting = setting;
+  simulatedCounters[counter].count = 0;
+  simulatedCounters[counter].clockPhase = 0;
+#endif
+}
+
+// Stops counter at 0, which leaves the waveform output low.
+static void transmitter_pwmStopCounter(uint16_t counter) {
+#ifdef ZYBO_BOARD
+  Xil_Out32(TTC_BASEADDR + TTC_COUNTER_OFFSET(counter) +
+                TTC_COUNTER_CONTROL_OFFSET,
+            TTC_COUNTER_DISABLE | TTC_COUNTER_RESET |
+                (counter == WAVE_COUNTER ? 0 : TTC_COUNTER_WAVE_DISABLE));
+#else
+  simulatedCounters[counter].enabled = false;
+  simulatedCounters[counter].count = 0;
+#endif
+}
+
+// End of a burst: stops the waveform or, in continuous mode, moves it to the
+// frequency set since the burst started.
+static void transmitter_pwmBurstDone() {
+  if (!continuousMode) {
+    transmitter_pwmStopCounter(WAVE_COUNTER);
+    transmitter_pwmStopCounter(BURST_COUNTER);
+    running = false;
+  } else if (frequencyNumber != burstFrequencyNumber) {
+    burstFrequencyNumber = frequencyNumber;
+    transmitter_pwmStartCounter(WAVE_COUNTER,
+                                frequencySettings[burstFrequencyNumber]);
+  }
+}
+
+#ifdef ZYBO_BOARD
+// Interval interrupt of the burst counter: one per burst.
+static void transmitter_pwmBurstInterrupt(void *callbackRef) {
+  Xil_In32(TTC_BASEADDR + TTC_COUNTER_OFFSET(BURST_COUNTER) +
+           TTC_INTERRUPT_OFFSET);
+  transmitter_pwmBurstDone();
+}
+
+// Connects the burst interrupt to the GIC that interrupts_initAll() set up.
+static void transmitter_pwmConnectInterrupt() {
+  Xil_Out32(TTC_BASEADDR + TTC_COUNTER_OFFSET(BURST_COUNTER) +
+                TTC_INTERRUPT_ENABLE_OFFSET,
+            TTC_INTERRUPT_INTERVAL);
+  XScuGic_RegisterHandler(XPAR_SCUGIC_0_CPU_BASEADDR, BURST_INTERRUPT,
+                          (Xil_InterruptHandler)transmitter_pwmBurstInterrupt,
+                          NULL);
+  XScuGic_EnableIntr(XPAR_SCUGIC_0_DIST_BASEADDR, BURST_INTERRUPT);
+  interruptConnected = true;
+}
+#else
+// Advances counter by one tick of TTC clocks. Returns true if it passed its
+// interval.
+static bool transmitter_pwmSimulateCounter(simulatedCounter_t *counter) {
+  if (!counter->enabled)
+    return false;
+  uint64_t divisor = (uint64_t)TRANSMITTER_PWM_TICK_HZ
+                     << counter->setting.prescaleLog2;
+  counter->clockPhase += TRANSMITTER_PWM_CLOCK_HZ;
+  uint64_t counts = counter->clockPhase / divisor;
+  counter->clockPhase -= counts * divisor;
+  counter->count += counts;
+  uint32_t period = (uint32_t)counter->setting.interval + 1;
+  if (counter->count < period)
+    return false;
+  counter->count %= period;
+  return true;
+}
+
+// Waveform output of the simulated TTC.
+bool transmitter_pwmOutput() { return simulatedOutput; }
+#endif
+
+// Computes the settings and stops the counters.
+void transmitter_init() {
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    frequencySettings[i] =
+        transmitter_pwmComputeSetting(filter_frequencyTickTable[i]);
+  burstSetting = transmitter_pwmComputeSetting(TRANSMITTER_PULSE_WIDTH);
+  running = false;
+  continuousMode = false;
+  frequencyNumber = 0;
+  burstFrequencyNumber = 0;
+  transmitter_pwmStopCounter(WAVE_COUNTER);
+  transmitter_pwmStopCounter(BURST_COUNTER);
+#ifndef ZYBO_BOARD
+  simulatedOutput = false;
+#endif
+}
+
+// The TTC makes the waveform. In the emulator and the host tools, advances the
+// simulated TTC by one tick.
+void transmitter_tick() {
+#ifndef ZYBO_BOARD
+  simulatedCounter_t *wave = &simulatedCounters[WAVE_COUNTER];
+  transmitter_pwmSimulateCounter(wave);
+  if (transmitter_pwmSimulateCounter(&simulatedCounters[BURST_COUNTER]))
+    transmitter_pwmBurstDone();
+  simulatedOutput = wave->count >= wave->setting.match;
+#endif
+}
+
+// Starts a burst at the current frequency.
+void transmitter_run() {
+  if (running)
+    return;
+#ifdef ZYBO_BOARD
+  if (!interruptConnected)
+    transmitter_pwmConnectInterrupt();
+#endif
+  burstFrequencyNumber = frequencyNumber;
+  running = true;
+  transmitter_pwmStartCounter(WAVE_COUNTER,
+                              frequencySettings[burstFrequencyNumber]);
+  transmitter_pwmStartCounter(BURST_COUNTER, burstSetting);
+}
+
+// Returns true if the transmitter is still running.
+bool transmitter_running() { return running; }
+
+// Sets the frequency number, used from the next burst.
+void transmitter_setFrequencyNumber(uint16_t number) {
+  frequencyNumber = number;
+}
+
+// Returns the current frequency setting.
+uint16_t transmitter_getFrequencyNumber() { return frequencyNumber; }
+
+// Sets continuous mode. Without it, the transmitter stops at the end of the
+// current burst.
+void transmitter_setContinuousMode(bool continuousModeFlag) {
+  continuousMode = continuousModeFlag;
+}
+
+// Prints the settings of every frequency and, where the TTC is simulated, runs
+// transmitter_runPwmTest().
+void transmitter_runTest() {
+  printf("starting transmitter_runTest()\n");
+  transmitter_init();
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    transmitter_pwmSetting_t setting = frequencySettings[i];
+    printf("frequency %d: %d ticks, prescaler 2^%d, interval %d, match %d, "
+           "%.2lf Hz\n",
+           i, filter_frequencyTickTable[i], setting.prescaleLog2,
+           setting.interval, setting.match,
+           1.0e9 / transmitter_pwmPeriodNs(setting));
+  }
+#ifndef ZYBO_BOARD
+  transmitter_runPwmTest();
+#endif
+  printf("exiting transmitter_runTest()\n");
+}
+
+#define TEST_DEAD_TIME_MS 300
+#define TEST_POLL_MS 1
+
+// Transmits single bursts at the frequency of the slide switches, with a dead
+// time between them, until BTN1 is pressed.
+void transmitter_runNoncontinuousTest() {
+  printf("starting transmitter_runNoncontinuousTest()\n");
+  transmitter_init();
+  while (!(buttons_read() & BUTTONS_BTN1_MASK)) {
+    transmitter_setFrequencyNumber(switches_read() % FILTER_FREQUENCY_COUNT);
+    transmitter_run();
+    while (transmitter_running())
+      utils_msDelay(TEST_POLL_MS);
+    utils_msDelay(TEST_DEAD_TIME_MS);
+  }
+  printf("exiting transmitter_runNoncontinuousTest()\n");
+}
+
+// Transmits continuously at the frequency of the slide switches until BTN1 is
+// pressed, then lets the last burst finish.
+void transmitter_runContinuousTest() {
+  printf("starting transmitter_runContinuousTest()\n");
+  transmitter_init();
+  transmitter_setFrequencyNumber(switches_read() % FILTER_FREQUENCY_COUNT);
+  transmitter_setContinuousMode(true);
+  transmitter_run();
+  while (!(buttons_read() & BUTTONS_BTN1_MASK))
+    transmitter_setFrequencyNumber(switches_read() % FILTER_FREQUENCY_COUNT);
+  transmitter_setContinuousMode(false);
+  while (transmitter_running())
+    utils_msDelay(TEST_POLL_MS);
+  printf("exiting transmitter_runContinuousTest()\n");
+}
+
+#ifndef ZYBO_BOARD
+#define TEST_MAX_PERIOD_ERROR 0.001 // Relative to the tick period.
+#define TEST_BURST_TOLERANCE_TICKS 1
+#define TEST_EDGE_TOLERANCE 2  // Rising edges per burst.
+#define TEST_QUIET_TICKS 1000  // After a burst, the output must stay low.
+#define TEST_CHANGE_TICKS 100  // Into a burst, when the frequency is changed.
+
+// Rising edges and high ticks of the simulated output.
+typedef struct {
+  uint32_t ticks;
+  uint32_t risingEdges;
+  uint32_t highTicks;
+} transmitter_pwmTestCount_t;
+
+// Runs the simulated TTC for at most tickCount ticks, stopping early when the
+// transmitter stops if untilStopped, and returns what the output did.
+static transmitter_pwmTestCount_t transmitter_pwmTestRun(uint32_t tickCount,
+                                                         bool untilStopped) {
+  transmitter_pwmTestCount_t result = {0, 0, 0};
+  bool previous = transmitter_pwmOutput();
+  while (result.ticks < tickCount && !(untilStopped && !running)) {
+    transmitter_tick();
+    result.ticks++;
+    bool output = transmitter_pwmOutput();
+    result.risingEdges += output && !previous;
+    result.highTicks += output;
+    previous = output;
+  }
+  return result;
+}
+
+// Returns true if count has as many rising edges as a burst of
+// frequencyNumber, give or take TEST_EDGE_TOLERANCE.
+static bool transmitter_pwmTestEdges(transmitter_pwmTestCount_t count,
+                                     uint16_t frequencyNumber) {
+  uint32_t expected = count.ticks / filter_frequencyTickTable[frequencyNumber];
+  return abs((int32_t)count.risingEdges - (int32_t)expected) <=
+         TEST_EDGE_TOLERANCE;
+}
+
+// Checks a period setting against periodTicks ticks.
+static bool transmitter_pwmTestSetting(const char *name, uint32_t periodTicks,
+                                       transmitter_pwmSetting_t setting) {
+  double shouldBe = periodTicks * 1.0e9 / TRANSMITTER_PWM_TICK_HZ;
+  double periodNs = transmitter_pwmPeriodNs(setting);
+  uint32_t counts = (uint32_t)setting.interval + 1;
+  if (periodNs < shouldBe * (1.0 - TEST_MAX_PERIOD_ERROR) ||
+      periodNs > shouldBe * (1.0 + TEST_MAX_PERIOD_ERROR) ||
+      abs(2 * (int32_t)setting.match - (int32_t)counts) > 1) {
+    printf("transmitter_runPwmTest: %s: period %.1lf ns, match %d of %d "
+           "counts; should be %.1lf ns, half.\n",
+           name, periodNs, setting.match, counts, shouldBe);
+    return false;
+  }
+  return true;
+}
+
+// Checks the settings and runs the simulated TTC. Returns true if the test
+// passes.
+bool transmitter_runPwmTest() {
+  bool success = true; // Be optimistic.
+  transmitter_init();
+  char name[32];
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    snprintf(name, sizeof(name), "frequency %d", i);
+    success = transmitter_pwmTestSetting(name, filter_frequencyTickTable[i],
+                                         frequencySettings[i]) &&
+              success;
+  }
+  success = transmitter_pwmTestSetting("burst", TRANSMITTER_PULSE_WIDTH,
+                                       burstSetting) &&
+            success;
+
+  // A single burst at each frequency, then quiet.
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    transmitter_init();
+    transmitter_setFrequencyNumber(i);
+    transmitter_run();
+    transmitter_pwmTestCount_t burst =
+        transmitter_pwmTestRun(2 * TRANSMITTER_PULSE_WIDTH, true);
+    transmitter_pwmTestCount_t quiet =
+        transmitter_pwmTestRun(TEST_QUIET_TICKS, false);
+    if (abs((int32_t)burst.ticks - TRANSMITTER_PULSE_WIDTH) >
+            TEST_BURST_TOLERANCE_TICKS ||
+        !transmitter_pwmTestEdges(burst, i) ||
+        abs(2 * (int32_t)burst.highTicks - (int32_t)burst.ticks) >
+            2 * (int32_t)burst.risingEdges ||
+        quiet.highTicks != 0 || transmitter_running()) {
+      printf("transmitter_runPwmTest: frequency %d: burst of %d ticks with %d "
+             "rising edges and %d high ticks, then %d high ticks and running "
+             "%d.\n",
+             i, burst.ticks, burst.risingEdges, burst.highTicks,
+             quiet.highTicks, transmitter_running());
+      success = false;
+    }
+  }
+
+  // Continuous mode: a change during a burst waits for the next one, and
+  // leaving continuous mode lets the current burst finish.
+  uint16_t last = FILTER_FREQUENCY_COUNT - 1;
+  transmitter_init();
+  transmitter_setContinuousMode(true);
+  transmitter_run();
+  transmitter_pwmTestCount_t first = transmitter_pwmTestRun(TEST_CHANGE_TICKS,
+                                                            false);
+  transmitter_setFrequencyNumber(last);
+  transmitter_pwmTestCount_t rest = transmitter_pwmTestRun(
+      TRANSMITTER_PULSE_WIDTH - TEST_CHANGE_TICKS, false);
+  first.ticks += rest.ticks;
+  first.risingEdges += rest.risingEdges;
+  transmitter_pwmTestCount_t second =
+      transmitter_pwmTestRun(TRANSMITTER_PULSE_WIDTH, false);
+  transmitter_pwmTestRun(TEST_CHANGE_TICKS, false);
+  bool stillRunning = transmitter_running();
+  transmitter_setContinuousMode(false);
+  transmitter_pwmTestCount_t third =
+      transmitter_pwmTestRun(2 * TRANSMITTER_PULSE_WIDTH, true);
+  if (!transmitter_pwmTestEdges(first, 0) ||
+      !transmitter_pwmTestEdges(second, last) || !stillRunning ||
+      abs((int32_t)third.ticks -
+          (TRANSMITTER_PULSE_WIDTH - TEST_CHANGE_TICKS)) >
+          TEST_BURST_TOLERANCE_TICKS ||
+      transmitter_running() || transmitter_pwmOutput()) {
+    printf("transmitter_runPwmTest: continuous: %d and %d rising edges, "
+           "running %d, stopped after %d more ticks, running %d, output %d.\n",
+           first.risingEdges, second.risingEdges, stillRunning, third.ticks,
+           transmitter_running(), transmitter_pwmOutput());
+    success = false;
+  }
+  transmitter_init();
+  printf("transmitter_runPwmTest %s.\n", success ? "passed" : "failed");
+  return success;
+}
+#endif
@@ -0,0 +1,80 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef TRANSMITTERPWM_H_
+#define TRANSMITTERPWM_H_
+
+// Timer-generated transmitter waveform (build with TRANSMITTER_PWM), an
+// implementation of transmitter.h that replaces transmitter.c. Instead of
+// transmitter_tick() counting ticks and writing the output pin every 10 us, a
+// triple timer counter (TTC) makes the square wave: counter 0 runs in interval
+// mode with a period of the frequency's filter_frequencyTickTable entry and
+// toggles its waveform output at its match value, halfway through. Counter 1
+// times the TRANSMITTER_PULSE_WIDTH burst. Its interval interrupt, once per
+// 200 ms, is the only software involvement: it stops the waveform or, in
+// continuous mode, moves it to a new frequency. transmitter_tick() does
+// nothing on the board.
+//
+// Stopping resets counter 0, which leaves the output low, the level of the
+// first half of each period. The edges are timed to one prescaled TTC clock
+// (see transmitter_pwmComputeSetting()) instead of to the 10 us tick, and a
+// burst ends within one prescaled clock of 200 ms, less interrupt latency.
+//
+// On the board, the waveform output of TTC0 counter 0 reaches the transmitter
+// through EMIO. This needs a hardware platform that enables TTC0 and routes
+// that output to a Pmod pin; platforms/hw does neither yet, and JF1
+// (TRANSMITTER_OUTPUT_PIN) is an MIO pin that no TTC can drive. A board build
+// would compile but never transmit, so it fails unless TRANSMITTER_PWM_EMIO
+// says the platform in use has the route.
+//
+// The emulator and the host tools have no TTC, so transmitter_tick() runs a
+// simulated one, advancing both counters by 10 us of TTC clock and raising the
+// burst "interrupt" itself. transmitter_pwmOutput() is its waveform output.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "transmitter.h"
+
+// TTC clock: CPU_1X, 650 MHz / 6 (PCW_ACT_TTC0_CLK0_PERIPHERAL_FREQMHZ).
+#define TRANSMITTER_PWM_CLOCK_HZ 108333333
+#define TRANSMITTER_PWM_TICK_HZ 100000 // The ticks of transmitter.h.
+#define TRANSMITTER_PWM_MAX_PRESCALE_LOG2 16 // Clock divided by 2^16 at most.
+#define TRANSMITTER_PWM_MAX_INTERVAL 0xFFFF  // TTC counters are 16 bits.
+
+// Settings of one TTC counter in interval mode: the clock is divided by
+// 2^prescaleLog2 (0 leaves the prescaler off), and the counter counts from 0 to
+// interval, so a period is interval + 1 prescaled clocks. The waveform output
+// is low for the first match counts of a period and high for the rest.
+typedef struct {
+  uint8_t prescaleLog2;
+  uint16_t interval;
+  uint16_t match;
+} transmitter_pwmSetting_t;
+
+// Returns the settings for a period of periodTicks ticks with the smallest
+// prescaler that fits, which times the edges most finely, and the match value
+// closest to half the period.
+transmitter_pwmSetting_t transmitter_pwmComputeSetting(uint32_t periodTicks);
+
+// Returns the length, in nanoseconds, of a period of setting.
+double transmitter_pwmPeriodNs(transmitter_pwmSetting_t setting);
+
+#ifndef ZYBO_BOARD
+// Waveform output of the simulated TTC, as of the last transmitter_tick().
+bool transmitter_pwmOutput();
+
+// Checks the settings of every frequency and of the burst, then runs the
+// simulated TTC through single bursts at each frequency and through continuous
+// mode with a frequency change. Returns true if the test passes. Leaves the
+// transmitter initialized.
+bool transmitter_runPwmTest();
+#endif
+
+#endif /* TRANSMITTERPWM_H_ */